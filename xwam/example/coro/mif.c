@@ -0,0 +1,226 @@
+/**
+ * @file
+ * @brief 示例：无栈协程
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/osal/thd.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwmd/coro/mif.h>
+#include <xwam/example/coro/mif.h>
+
+#define LOGTAG "coro"
+#define corologf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define CORODEMO_SCHED_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 1)
+#define CORODEMO_PRODUCER_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 2)
+#define CORODEMO_CONSUMER_NUM   3U
+#define CORODEMO_SLOT_NUM       1U
+#define CORODEMO_SEM_POS        0U
+
+/**
+ * @brief 消费者协程
+ * @details
+ * 无栈协程的局部变量在让出CPU后不会保留，需要跨越等待点的状态
+ * 都必须放在协程所在的结构体中。
+ */
+struct corodemo_consumer {
+        struct xwcoro co; /**< 协程，必须是第一个成员 */
+        xwsq_t id; /**< 编号 */
+        xwsq_t cnt; /**< 获取到信号量的次数 */
+};
+
+xwsq_t corodemo_consumer_func(struct xwcoro * co, void * arg);
+xwsq_t corodemo_ticker_func(struct xwcoro * co, void * arg);
+xwer_t corodemo_sched_func(void * arg);
+xwer_t corodemo_producer_func(void * arg);
+
+/**
+ * @brief 协程调度器
+ */
+struct xwcoro_sched corodemo_sched;
+XWCORO_SCHED_DEF_MEM(corodemo_sched, CORODEMO_SLOT_NUM);
+
+/**
+ * @brief 消费者协程
+ */
+struct corodemo_consumer corodemo_consumers[CORODEMO_CONSUMER_NUM];
+
+/**
+ * @brief 计时协程
+ */
+struct xwcoro corodemo_ticker;
+
+/**
+ * @brief 生产者线程与协程之间的信号量
+ */
+struct xwos_sem corodemo_sem;
+
+/**
+ * @brief 调度器线程
+ */
+xwos_thd_d corodemo_sched_thdd;
+
+/**
+ * @brief 生产者线程
+ */
+xwos_thd_d corodemo_producer_thdd;
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwos_example_coro(void)
+{
+        struct xwos_thd_attr attr;
+        xwsq_t i;
+        xwer_t rc;
+
+        rc = xwcoro_sched_init(&corodemo_sched, CORODEMO_SLOT_NUM,
+                               corodemo_sched_bmp, corodemo_sched_slot);
+        if (rc < 0) {
+                goto err_sched_init;
+        }
+        rc = xwos_sem_init(&corodemo_sem, 0, XWSSQ_MAX);
+        if (rc < 0) {
+                goto err_sem_init;
+        }
+        /* 信号量绑定到调度器的信号选择器上，由调度器唤醒等待的协程 */
+        rc = xwos_sem_bind(&corodemo_sem, xwcoro_sched_get_sel(&corodemo_sched),
+                           CORODEMO_SEM_POS);
+        if (rc < 0) {
+                goto err_sem_bind;
+        }
+
+        for (i = 0; i < CORODEMO_CONSUMER_NUM; i++) {
+                corodemo_consumers[i].id = i;
+                corodemo_consumers[i].cnt = 0;
+                xwcoro_init(&corodemo_consumers[i].co, corodemo_consumer_func,
+                            &corodemo_consumers[i]);
+                xwcoro_sched_spawn(&corodemo_sched, &corodemo_consumers[i].co);
+        }
+        xwcoro_init(&corodemo_ticker, corodemo_ticker_func, NULL);
+        xwcoro_sched_spawn(&corodemo_sched, &corodemo_ticker);
+
+        xwos_thd_attr_init(&attr);
+        attr.name = "coro.sched";
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = CORODEMO_SCHED_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        rc = xwos_thd_create(&corodemo_sched_thdd, &attr,
+                             corodemo_sched_func, NULL);
+        if (rc < 0) {
+                goto err_sched_thd_create;
+        }
+
+        xwos_thd_attr_init(&attr);
+        attr.name = "coro.producer";
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = CORODEMO_PRODUCER_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        rc = xwos_thd_create(&corodemo_producer_thdd, &attr,
+                             corodemo_producer_func, NULL);
+        if (rc < 0) {
+                goto err_producer_thd_create;
+        }
+        return XWOK;
+
+err_producer_thd_create:
+err_sched_thd_create:
+        xwos_sem_unbind(&corodemo_sem, xwcoro_sched_get_sel(&corodemo_sched));
+err_sem_bind:
+        xwos_sem_fini(&corodemo_sem);
+err_sem_init:
+        xwcoro_sched_fini(&corodemo_sched);
+err_sched_init:
+        return rc;
+}
+
+/**
+ * @brief 消费者协程的函数
+ */
+xwsq_t corodemo_consumer_func(struct xwcoro * co, void * arg)
+{
+        struct corodemo_consumer * consumer = arg;
+        xwer_t rc;
+
+        XWCORO_BEGIN(co);
+        corologf(INFO, "[消费者%d] 开始运行。\n", consumer->id);
+        while (consumer->cnt < 10U) {
+                XWCORO_SEM_WAIT(co, &corodemo_sem, CORODEMO_SEM_POS,
+                                xwtm_ft(XWTM_S(2)), rc);
+                if (XWOK == rc) {
+                        consumer->cnt++;
+                        corologf(INFO, "[消费者%d] 获取信号量，第%d次。\n",
+                                 consumer->id, consumer->cnt);
+                } else {
+                        corologf(INFO, "[消费者%d] 等待信号量超时，rc:%d。\n",
+                                 consumer->id, rc);
+                }
+                XWCORO_YIELD(co);
+        }
+        corologf(INFO, "[消费者%d] 退出。\n", consumer->id);
+        XWCORO_END(co);
+}
+
+/**
+ * @brief 计时协程的函数
+ */
+xwsq_t corodemo_ticker_func(struct xwcoro * co, void * arg)
+{
+        XWOS_UNUSED(arg);
+
+        XWCORO_BEGIN(co);
+        while (true) {
+                XWCORO_SLEEP(co, XWTM_S(1));
+                corologf(INFO, "[计时] 时间戳：%lld\n", xwtm_nowts());
+        }
+        XWCORO_END(co);
+}
+
+/**
+ * @brief 调度器线程的主函数
+ */
+xwer_t corodemo_sched_func(void * arg)
+{
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        /* 所有协程都运行在这一个线程中，只需要一个线程栈 */
+        rc = xwcoro_sched_run(&corodemo_sched);
+        corologf(INFO, "[调度器] 退出，rc:%d。\n", rc);
+        return rc;
+}
+
+/**
+ * @brief 生产者线程的主函数
+ */
+xwer_t corodemo_producer_func(void * arg)
+{
+        XWOS_UNUSED(arg);
+
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                xwos_cthd_sleep(XWTM_MS(500));
+                xwos_sem_post(&corodemo_sem);
+        }
+        return XWOK;
+}
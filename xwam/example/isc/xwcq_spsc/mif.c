@@ -0,0 +1,257 @@
+/**
+ * @file
+ * @brief 示例：循环队列单生产者单消费者模式的性能测试
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ * @details
+ * 分别测试加锁的循环队列 `struct xwcq` 与无锁的 `struct xwcq_spsc` ：
+ * + 单线程：连续入队再离队，测量每对操作的平均耗时，即锁与关中断的开销；
+ * + 双线程：生产者发送 `CQBM_MSG_NUM` 个带序号的消息，消费者阻塞接收并检查序号，
+ *   测量传输所有消息所用的时间。加锁的循环队列满时会覆盖旧数据，
+ *   因此生产者在队列满时让出CPU等待，与无锁模式返回 `-ENOSPC` 时的处理方式相同。
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/osal/time.h>
+#include <xwos/osal/thd.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwmd/isc/xwcq/mif.h>
+#include <xwmd/isc/xwcq/spsc.h>
+#include <xwam/example/isc/xwcq_spsc/mif.h>
+
+#define LOGTAG "cqspsc"
+#define cqbmlogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define CQBM_THD_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 1)
+#define CQBM_SLOT_SIZE          16U
+#define CQBM_SLOT_NUM           64U
+#define CQBM_PAIR_NUM           100000U
+#define CQBM_MSG_NUM            100000U
+
+xwer_t cqbm_producer_func(void * arg);
+xwer_t cqbm_consumer_func(void * arg);
+
+XWCQ_DEF_MEMPOOL(cqbm_cq_mempool, CQBM_SLOT_SIZE, CQBM_SLOT_NUM);
+XWCQ_DEF_MEMPOOL(cqbm_spsc_mempool, CQBM_SLOT_SIZE, CQBM_SLOT_NUM);
+struct xwcq cqbm_cq;
+struct xwcq_spsc cqbm_spsc;
+struct xwos_sem cqbm_start;
+struct xwos_sem cqbm_done;
+bool cqbm_use_spsc = false; /**< 本轮测试的模式 */
+xwsz_t cqbm_lost = 0; /**< 本轮消费者检测到的序号错误数量 */
+xwos_thd_d cqbm_producer;
+xwos_thd_d cqbm_consumer;
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwmd_example_xwcq_spsc(void)
+{
+        struct xwos_thd_attr attr;
+        xwer_t rc;
+
+        rc = xwcq_init(&cqbm_cq, CQBM_SLOT_SIZE, CQBM_SLOT_NUM, cqbm_cq_mempool);
+        if (rc < 0) {
+                goto err_cq_init;
+        }
+        rc = xwcq_spsc_init(&cqbm_spsc, CQBM_SLOT_SIZE, CQBM_SLOT_NUM,
+                            cqbm_spsc_mempool);
+        if (rc < 0) {
+                goto err_spsc_init;
+        }
+        rc = xwos_sem_init(&cqbm_start, 0, 1);
+        if (rc < 0) {
+                goto err_start_init;
+        }
+        rc = xwos_sem_init(&cqbm_done, 0, 1);
+        if (rc < 0) {
+                goto err_done_init;
+        }
+
+        xwos_thd_attr_init(&attr);
+        attr.name = "cqspsc.consumer";
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = CQBM_THD_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        rc = xwos_thd_create(&cqbm_consumer, &attr, cqbm_consumer_func, NULL);
+        if (rc < 0) {
+                goto err_consumer_create;
+        }
+
+        attr.name = "cqspsc.producer";
+        rc = xwos_thd_create(&cqbm_producer, &attr, cqbm_producer_func, NULL);
+        if (rc < 0) {
+                goto err_producer_create;
+        }
+        return XWOK;
+
+err_producer_create:
+        xwos_thd_quit(cqbm_consumer);
+err_consumer_create:
+        xwos_sem_fini(&cqbm_done);
+err_done_init:
+        xwos_sem_fini(&cqbm_start);
+err_start_init:
+        xwcq_spsc_fini(&cqbm_spsc);
+err_spsc_init:
+        xwcq_fini(&cqbm_cq);
+err_cq_init:
+        return rc;
+}
+
+/**
+ * @brief 单线程测试：连续入队再离队
+ * @param[in] spsc: 是否使用无锁模式
+ * @return 每对操作的平均耗时
+ */
+static
+xwtm_t cqbm_bench_pair(bool spsc)
+{
+        xwu8_t msg[CQBM_SLOT_SIZE] = {0};
+        xwtm_t start;
+        xwsz_t size;
+        xwsq_t i;
+
+        start = xwtm_now();
+        for (i = 0; i < CQBM_PAIR_NUM; i++) {
+                size = sizeof(msg);
+                if (spsc) {
+                        xwcq_spsc_eq(&cqbm_spsc, msg, &size);
+                        xwcq_spsc_trydq(&cqbm_spsc, msg, &size);
+                } else {
+                        xwcq_eq(&cqbm_cq, msg, &size);
+                        xwcq_trydq(&cqbm_cq, msg, &size);
+                }
+        }
+        return (xwtm_now() - start) / (xwtm_t)CQBM_PAIR_NUM;
+}
+
+/**
+ * @brief 双线程测试：生产者发送所有消息
+ * @param[in] spsc: 是否使用无锁模式
+ * @return 传输所有消息所用的时间，小于0时表示错误码
+ */
+static
+xwtm_t cqbm_bench_stream(bool spsc)
+{
+        xwsq_t seq;
+        xwsz_t size;
+        xwsz_t avb;
+        xwtm_t start;
+        xwer_t rc;
+
+        cqbm_use_spsc = spsc;
+        cqbm_lost = 0;
+        xwos_sem_post(&cqbm_start);
+        start = xwtm_now();
+        for (seq = 0; seq < CQBM_MSG_NUM; seq++) {
+                size = sizeof(seq);
+                if (spsc) {
+                        do {
+                                rc = xwcq_spsc_eq(&cqbm_spsc, (const xwu8_t *)&seq,
+                                                  &size);
+                                if (-ENOSPC == rc) {
+                                        xwos_cthd_yield();
+                                }
+                        } while (-ENOSPC == rc);
+                } else {
+                        do {
+                                xwcq_get_availability(&cqbm_cq, &avb);
+                                if (avb >= (CQBM_SLOT_NUM - 1U)) {
+                                        xwos_cthd_yield();
+                                }
+                        } while (avb >= (CQBM_SLOT_NUM - 1U));
+                        xwcq_eq(&cqbm_cq, (const xwu8_t *)&seq, &size);
+                }
+        }
+        rc = xwos_sem_wait_to(&cqbm_done, xwtm_ft(XWTM_S(10)));
+        if (rc < 0) {
+                return (xwtm_t)rc;
+        }
+        return xwtm_now() - start;
+}
+
+/**
+ * @brief 生产者线程的主函数
+ */
+xwer_t cqbm_producer_func(void * arg)
+{
+        xwtm_t locked;
+        xwtm_t lockfree;
+
+        XWOS_UNUSED(arg);
+        locked = cqbm_bench_pair(false);
+        lockfree = cqbm_bench_pair(true);
+        cqbmlogf(INFO, "[生产者] 单线程入队+离队，加锁：%lld 纳秒，无锁：%lld 纳秒。\n",
+                 locked, lockfree);
+
+        locked = cqbm_bench_stream(false);
+        if (locked < 0) {
+                cqbmlogf(ERR, "[生产者] 加锁模式超时。\n");
+                return (xwer_t)locked;
+        }
+        cqbmlogf(INFO, "[生产者] 加锁模式传输%d个消息：%lld 纳秒，序号错误：%d。\n",
+                 CQBM_MSG_NUM, locked, cqbm_lost);
+
+        lockfree = cqbm_bench_stream(true);
+        if (lockfree < 0) {
+                cqbmlogf(ERR, "[生产者] 无锁模式超时。\n");
+                return (xwer_t)lockfree;
+        }
+        cqbmlogf(INFO, "[生产者] 无锁模式传输%d个消息：%lld 纳秒，序号错误：%d。\n",
+                 CQBM_MSG_NUM, lockfree, cqbm_lost);
+        return XWOK;
+}
+
+/**
+ * @brief 消费者线程的主函数
+ */
+xwer_t cqbm_consumer_func(void * arg)
+{
+        xwsq_t expected;
+        xwsq_t seq;
+        xwsz_t size;
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        rc = XWOK;
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                rc = xwos_sem_wait(&cqbm_start);
+                if (rc < 0) {
+                        break;
+                }
+                for (expected = 0; expected < CQBM_MSG_NUM; expected++) {
+                        size = sizeof(seq);
+                        if (cqbm_use_spsc) {
+                                rc = xwcq_spsc_dq(&cqbm_spsc, (xwu8_t *)&seq, &size);
+                        } else {
+                                rc = xwcq_dq(&cqbm_cq, (xwu8_t *)&seq, &size);
+                        }
+                        if (rc < 0) {
+                                break;
+                        }
+                        if (seq != expected) {
+                                cqbm_lost++;
+                                expected = seq;
+                        }
+                }
+                xwos_sem_post(&cqbm_done);
+        }
+        return rc;
+}
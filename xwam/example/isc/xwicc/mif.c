@@ -0,0 +1,369 @@
+/**
+ * @file
+ * @brief 示例：核间通道的性能测试
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ * @details
+ * 每个CPU上各有一个接收线程与一个发送线程，可在QEMU的 `raspi4b` （4核ARMv8-A）上运行：
+ * + 延迟：主线程向下一个CPU发送 `ICCBM_PING` ，对方的接收线程立即回复 `ICCBM_PONG` ，
+ *   测量往返时间的最小值、平均值与最大值；
+ * + 吞吐量：所有发送线程同时向下一个CPU发送 `ICCBM_MSG_NUM` 个带序号的消息，
+ *   测量传输所有消息所用的时间，并统计门铃（核间中断）的数量。
+ *   接收线程来不及处理时，环形缓冲区保持非空，后续的消息不会再产生门铃，
+ *   因此门铃的数量远少于消息的数量。
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/osal/irq.h>
+#include <xwos/osal/skd.h>
+#include <xwos/osal/time.h>
+#include <xwos/osal/thd.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwmd/isc/xwicc/mif.h>
+#include <xwam/example/isc/xwicc/mif.h>
+
+#define LOGTAG "xwicc"
+#define iccbmlogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define ICCBM_THD_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 1)
+#define ICCBM_SLOT_NUM          64U
+#define ICCBM_PING_NUM          1000U
+#define ICCBM_MSG_NUM           100000U
+
+#define ICCBM_PING              1U
+#define ICCBM_PONG              2U
+#define ICCBM_DATA              3U
+
+/**
+ * @brief 测试消息
+ */
+struct iccbm_msg {
+        xwu32_t type; /**< 类型 */
+        xwu32_t seq; /**< 序号 */
+        xwtm_t stamp; /**< 发送时间 */
+};
+
+/**
+ * @brief 每个CPU的统计数据，只由此CPU修改
+ */
+struct __xwcc_alignl1cache iccbm_percpu {
+        xwsz_t doorbell; /**< 收到的门铃数量 */
+        xwsz_t received; /**< 本轮收到的数据消息数量 */
+        xwsz_t lost; /**< 本轮检测到的序号错误数量 */
+        xwu32_t expected; /**< 期望收到的下一个序号 */
+};
+
+xwer_t iccbm_master_func(void * arg);
+xwer_t iccbm_rx_func(void * arg);
+xwer_t iccbm_tx_func(void * arg);
+
+XWICC_DEF_MEMPOOL(iccbm_mempool, sizeof(struct iccbm_msg), ICCBM_SLOT_NUM);
+struct xwicc iccbm_icc;
+struct iccbm_percpu iccbm_percpu[CPUCFG_CPU_NUM];
+struct xwos_sem iccbm_ready;
+struct xwos_sem iccbm_start;
+struct xwos_sem iccbm_done;
+struct xwos_sem iccbm_pong;
+xwtm_t iccbm_rtt = 0; /**< 最近一次往返的时间 */
+xwos_thd_d iccbm_master;
+xwos_thd_d iccbm_rx[CPUCFG_CPU_NUM];
+xwos_thd_d iccbm_tx[CPUCFG_CPU_NUM];
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwmd_example_xwicc(void)
+{
+        struct xwos_thd_attr attr;
+        xwsq_t i;
+        xwer_t rc;
+
+        rc = xwicc_init(&iccbm_icc, ICCBM_IRQN, sizeof(struct iccbm_msg), ICCBM_SLOT_NUM,
+                        iccbm_mempool);
+        if (rc < 0) {
+                goto err_icc_init;
+        }
+        rc = xwos_sem_init(&iccbm_ready, 0, CPUCFG_CPU_NUM * 2U);
+        if (rc < 0) {
+                goto err_ready_init;
+        }
+        rc = xwos_sem_init(&iccbm_start, 0, CPUCFG_CPU_NUM);
+        if (rc < 0) {
+                goto err_start_init;
+        }
+        rc = xwos_sem_init(&iccbm_done, 0, CPUCFG_CPU_NUM);
+        if (rc < 0) {
+                goto err_done_init;
+        }
+        rc = xwos_sem_init(&iccbm_pong, 0, 1);
+        if (rc < 0) {
+                goto err_pong_init;
+        }
+
+        xwos_thd_attr_init(&attr);
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = ICCBM_THD_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        for (i = 0; i < CPUCFG_CPU_NUM; i++) {
+                attr.name = "xwicc.rx";
+                rc = xwos_thd_create(&iccbm_rx[i], &attr, iccbm_rx_func, (void *)i);
+                if (rc < 0) {
+                        goto err_thd_create;
+                }
+                xwos_thd_migrate(iccbm_rx[i], (xwid_t)i);
+                attr.name = "xwicc.tx";
+                rc = xwos_thd_create(&iccbm_tx[i], &attr, iccbm_tx_func, (void *)i);
+                if (rc < 0) {
+                        xwos_thd_quit(iccbm_rx[i]);
+                        goto err_thd_create;
+                }
+                xwos_thd_migrate(iccbm_tx[i], (xwid_t)i);
+        }
+
+        attr.name = "xwicc.master";
+        rc = xwos_thd_create(&iccbm_master, &attr, iccbm_master_func, NULL);
+        if (rc < 0) {
+                goto err_thd_create;
+        }
+        return XWOK;
+
+err_thd_create:
+        while (i > 0) {
+                i--;
+                xwos_thd_quit(iccbm_tx[i]);
+                xwos_thd_quit(iccbm_rx[i]);
+        }
+        xwos_sem_fini(&iccbm_pong);
+err_pong_init:
+        xwos_sem_fini(&iccbm_done);
+err_done_init:
+        xwos_sem_fini(&iccbm_start);
+err_start_init:
+        xwos_sem_fini(&iccbm_ready);
+err_ready_init:
+        xwicc_fini(&iccbm_icc);
+err_icc_init:
+        return rc;
+}
+
+/**
+ * @brief 门铃中断的处理函数
+ */
+void xwmd_example_xwicc_isr(void)
+{
+        iccbm_percpu[xwos_skd_get_cpuid_lc()].doorbell++;
+        xwicc_isr(&iccbm_icc);
+}
+
+/**
+ * @brief 等待线程被迁移到目标CPU
+ * @param[in] cpuid: 目标CPU的ID
+ */
+static
+void iccbm_wait_migration(xwid_t cpuid)
+{
+        while (xwos_skd_get_cpuid_lc() != cpuid) {
+                xwos_cthd_yield();
+        }
+}
+
+/**
+ * @brief 向目的地CPU发送消息，环形缓冲区满时让出CPU等待
+ * @param[in] dst: 目的地CPU的ID
+ * @param[in] msg: 消息
+ */
+static
+void iccbm_send(xwid_t dst, struct iccbm_msg * msg)
+{
+        xwsz_t size;
+        xwer_t rc;
+
+        do {
+                size = sizeof(struct iccbm_msg);
+                rc = xwicc_send(&iccbm_icc, dst, (const xwu8_t *)msg, &size);
+                if (-ENOSPC == rc) {
+                        xwos_cthd_yield();
+                }
+        } while (-ENOSPC == rc);
+}
+
+/**
+ * @brief 主线程的主函数
+ */
+xwer_t iccbm_master_func(void * arg)
+{
+        struct iccbm_msg msg;
+        xwtm_t min;
+        xwtm_t max;
+        xwtm_t sum;
+        xwtm_t start;
+        xwtm_t cost;
+        xwsz_t doorbell;
+        xwsz_t lost;
+        xwsq_t i;
+        xwid_t dst;
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        for (i = 0; i < (CPUCFG_CPU_NUM * 2U); i++) {
+                rc = xwos_sem_wait(&iccbm_ready);
+                if (rc < 0) {
+                        goto err_ready;
+                }
+        }
+        iccbmlogf(INFO, "[主线程] 启动，CPU：%d。\n", CPUCFG_CPU_NUM);
+
+        /* 延迟 */
+        min = XWTM_MAX;
+        max = 0;
+        sum = 0;
+        for (i = 0; i < ICCBM_PING_NUM; i++) {
+                dst = (xwos_skd_get_cpuid_lc() + 1U) % CPUCFG_CPU_NUM;
+                msg.type = ICCBM_PING;
+                msg.seq = (xwu32_t)i;
+                msg.stamp = xwtm_now();
+                iccbm_send(dst, &msg);
+                rc = xwos_sem_wait_to(&iccbm_pong, xwtm_ft(XWTM_S(1)));
+                if (rc < 0) {
+                        iccbmlogf(ERR, "[主线程] 第%d次往返超时。\n", i);
+                        goto err_pong;
+                }
+                cost = iccbm_rtt;
+                min = (cost < min) ? cost : min;
+                max = (cost > max) ? cost : max;
+                sum += cost;
+        }
+        iccbmlogf(INFO, "[主线程] 往返%d次，最小：%lld 纳秒，平均：%lld 纳秒，最大：%lld 纳秒。\n",
+                  ICCBM_PING_NUM, min, sum / (xwtm_t)ICCBM_PING_NUM, max);
+
+        /* 吞吐量 */
+        for (i = 0; i < CPUCFG_CPU_NUM; i++) {
+                iccbm_percpu[i].doorbell = 0;
+        }
+        start = xwtm_now();
+        for (i = 0; i < CPUCFG_CPU_NUM; i++) {
+                xwos_sem_post(&iccbm_start);
+        }
+        for (i = 0; i < CPUCFG_CPU_NUM; i++) {
+                rc = xwos_sem_wait_to(&iccbm_done, xwtm_ft(XWTM_S(10)));
+                if (rc < 0) {
+                        iccbmlogf(ERR, "[主线程] 吞吐量测试超时。\n");
+                        goto err_done;
+                }
+        }
+        cost = xwtm_now() - start;
+        doorbell = 0;
+        lost = 0;
+        for (i = 0; i < CPUCFG_CPU_NUM; i++) {
+                doorbell += iccbm_percpu[i].doorbell;
+                lost += iccbm_percpu[i].lost;
+        }
+        iccbmlogf(INFO, "[主线程] 传输%d个消息：%lld 纳秒，门铃：%d，序号错误：%d。\n",
+                  ICCBM_MSG_NUM * CPUCFG_CPU_NUM, cost, doorbell, lost);
+        return XWOK;
+
+err_done:
+err_pong:
+err_ready:
+        return rc;
+}
+
+/**
+ * @brief 接收线程的主函数
+ */
+xwer_t iccbm_rx_func(void * arg)
+{
+        struct iccbm_percpu * percpu;
+        struct iccbm_msg msg;
+        xwid_t cpuid;
+        xwid_t src;
+        xwsz_t size;
+        xwer_t rc;
+
+        cpuid = (xwid_t)arg;
+        iccbm_wait_migration(cpuid);
+        percpu = &iccbm_percpu[cpuid];
+        percpu->received = 0;
+        percpu->lost = 0;
+        percpu->expected = 0;
+        xwos_irq_enable(ICCBM_IRQN);
+        xwos_sem_post(&iccbm_ready);
+        rc = XWOK;
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                size = sizeof(msg);
+                rc = xwicc_recv(&iccbm_icc, &src, (xwu8_t *)&msg, &size);
+                if (rc < 0) {
+                        break;
+                }
+                switch (msg.type) {
+                case ICCBM_PING:
+                        msg.type = ICCBM_PONG;
+                        iccbm_send(src, &msg);
+                        break;
+                case ICCBM_PONG:
+                        iccbm_rtt = xwtm_now() - msg.stamp;
+                        xwos_sem_post(&iccbm_pong);
+                        break;
+                case ICCBM_DATA:
+                        if (msg.seq != percpu->expected) {
+                                percpu->lost++;
+                        }
+                        percpu->expected = msg.seq + 1U;
+                        percpu->received++;
+                        if (ICCBM_MSG_NUM == percpu->received) {
+                                xwos_sem_post(&iccbm_done);
+                        }
+                        break;
+                default:
+                        break;
+                }
+        }
+        return rc;
+}
+
+/**
+ * @brief 发送线程的主函数
+ */
+xwer_t iccbm_tx_func(void * arg)
+{
+        struct iccbm_msg msg;
+        xwid_t cpuid;
+        xwid_t dst;
+        xwu32_t seq;
+        xwer_t rc;
+
+        cpuid = (xwid_t)arg;
+        iccbm_wait_migration(cpuid);
+        xwos_sem_post(&iccbm_ready);
+        rc = xwos_sem_wait(&iccbm_start);
+        if (rc < 0) {
+                goto err_start;
+        }
+        dst = (cpuid + 1U) % CPUCFG_CPU_NUM;
+        msg.type = ICCBM_DATA;
+        for (seq = 0; seq < ICCBM_MSG_NUM; seq++) {
+                msg.seq = seq;
+                msg.stamp = 0;
+                iccbm_send(dst, &msg);
+        }
+        return XWOK;
+
+err_start:
+        return rc;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @brief 示例：核间通道的性能测试
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#ifndef __xwam_example_isc_xwicc_mif_h__
+#define __xwam_example_isc_xwicc_mif_h__
+
+#include <xwos/standard.h>
+
+/**
+ * @brief 核间通道的门铃使用的核间中断号
+ * @note
+ * + 运行测试前，板级代码需要在 **每个** CPU上将 `xwmd_example_xwicc_isr()`
+ *   注册为此中断的处理函数，可参考 `xwbd/RPi4B/board/init.c` 中的
+ *   `xwos_postinit()` 。
+ */
+#define ICCBM_IRQN              1
+
+xwer_t xwmd_example_xwicc(void);
+void xwmd_example_xwicc_isr(void);
+
+#endif /* xwam/example/isc/xwicc/mif.h */
@@ -0,0 +1,231 @@
+/**
+ * @file
+ * @brief 示例：发布订阅
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ * @details
+ * 发布者周期地发布遥测数据，三个订阅者各自有一个消息队列：
+ * + 日志线程订阅所有标题；
+ * + 界面线程订阅 `[PSDEMO_TOPIC_TEMP, PSDEMO_TOPIC_VOLT]` ；
+ * + 上传线程订阅 `PSDEMO_TOPIC_VOLT` 与 `PSDEMO_TOPIC_ALARM` 两段标题。
+ *
+ * 每条遥测数据只存在一份，订阅者收到的是同一个消息的指针，
+ * 最后一个订阅者释放消息后，消息回到发布者的消息池中。
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwaop.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/osal/thd.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwmd/isc/xwmq/mif.h>
+#include <xwmd/isc/xwps/mif.h>
+#include <xwam/example/isc/xwps/mif.h>
+
+#define LOGTAG "xwps"
+#define pslogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define PSDEMO_THD_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 1)
+#define PSDEMO_POOL_NUM         8U
+#define PSDEMO_TOPIC_TEMP       0x10U
+#define PSDEMO_TOPIC_VOLT       0x11U
+#define PSDEMO_TOPIC_ALARM      0x20U
+
+/**
+ * @brief 遥测数据
+ */
+struct psdemo_sample {
+        xwsq_t seq; /**< 序号 */
+        xwsq_t value; /**< 数值 */
+};
+
+/**
+ * @brief 订阅者线程的参数
+ */
+struct psdemo_subscriber {
+        const char * name; /**< 名称 */
+        struct xwmq mq; /**< 消息队列 */
+        struct xwmq_msg txq[PSDEMO_POOL_NUM]; /**< 消息槽 */
+        xwos_thd_d thd; /**< 线程 */
+};
+
+xwer_t psdemo_publisher_main(void * arg);
+xwer_t psdemo_subscriber_main(void * arg);
+
+struct xwps psdemo_ps;
+struct xwps_msg psdemo_msg[PSDEMO_POOL_NUM];
+struct psdemo_sample psdemo_sample[PSDEMO_POOL_NUM];
+xwbmpaop_define(psdemo_msg_used, PSDEMO_POOL_NUM);
+struct xwos_sem psdemo_msg_free;
+xwos_thd_d psdemo_publisher;
+
+struct psdemo_subscriber psdemo_sub[] = {
+        [0] = {.name = "log",},
+        [1] = {.name = "ui",},
+        [2] = {.name = "uplink",},
+};
+struct xwps_sub psdemo_sub_log;
+struct xwps_sub psdemo_sub_ui;
+struct xwps_sub psdemo_sub_uplink_volt;
+struct xwps_sub psdemo_sub_uplink_alarm;
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwmd_example_xwps(void)
+{
+        struct xwos_thd_attr attr;
+        xwsq_t i;
+        xwer_t rc;
+
+        xwps_init(&psdemo_ps);
+        xwbmpaop_c0all(psdemo_msg_used, PSDEMO_POOL_NUM);
+        rc = xwos_sem_init(&psdemo_msg_free, PSDEMO_POOL_NUM, PSDEMO_POOL_NUM);
+        if (rc < 0) {
+                goto err_sem_init;
+        }
+        for (i = 0; i < xw_array_size(psdemo_sub); i++) {
+                rc = xwmq_init(&psdemo_sub[i].mq, psdemo_sub[i].txq,
+                               xw_array_size(psdemo_sub[i].txq));
+                if (rc < 0) {
+                        goto err_mq_init;
+                }
+        }
+        xwps_subscribe(&psdemo_ps, &psdemo_sub_log, 0, XWSQ_MAX, &psdemo_sub[0].mq);
+        xwps_subscribe(&psdemo_ps, &psdemo_sub_ui,
+                       PSDEMO_TOPIC_TEMP, PSDEMO_TOPIC_VOLT, &psdemo_sub[1].mq);
+        xwps_subscribe(&psdemo_ps, &psdemo_sub_uplink_volt,
+                       PSDEMO_TOPIC_VOLT, PSDEMO_TOPIC_VOLT, &psdemo_sub[2].mq);
+        xwps_subscribe(&psdemo_ps, &psdemo_sub_uplink_alarm,
+                       PSDEMO_TOPIC_ALARM, PSDEMO_TOPIC_ALARM, &psdemo_sub[2].mq);
+
+        xwos_thd_attr_init(&attr);
+        attr.name = "demo.xwps.subscriber";
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = PSDEMO_THD_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        for (i = 0; i < xw_array_size(psdemo_sub); i++) {
+                rc = xwos_thd_create(&psdemo_sub[i].thd, &attr,
+                                     psdemo_subscriber_main, &psdemo_sub[i]);
+                if (rc < 0) {
+                        goto err_thd_create;
+                }
+        }
+        attr.name = "demo.xwps.publisher";
+        rc = xwos_thd_create(&psdemo_publisher, &attr, psdemo_publisher_main, NULL);
+        if (rc < 0) {
+                goto err_thd_create;
+        }
+        return XWOK;
+
+err_thd_create:
+        while (i > 0) {
+                i--;
+                xwos_thd_quit(psdemo_sub[i].thd);
+        }
+        xwps_unsubscribe(&psdemo_ps, &psdemo_sub_uplink_alarm);
+        xwps_unsubscribe(&psdemo_ps, &psdemo_sub_uplink_volt);
+        xwps_unsubscribe(&psdemo_ps, &psdemo_sub_ui);
+        xwps_unsubscribe(&psdemo_ps, &psdemo_sub_log);
+        i = xw_array_size(psdemo_sub);
+err_mq_init:
+        while (i > 0) {
+                i--;
+                xwmq_fini(&psdemo_sub[i].mq);
+        }
+        xwos_sem_fini(&psdemo_msg_free);
+err_sem_init:
+        return rc;
+}
+
+/**
+ * @brief 消息的释放函数：最后一个订阅者释放消息时，消息回到消息池
+ */
+static
+void psdemo_msg_release(struct xwps_msg * msg, void * arg)
+{
+        xwsq_t idx;
+
+        XWOS_UNUSED(arg);
+        idx = (xwsq_t)(msg - psdemo_msg);
+        xwbmpaop_c0i(psdemo_msg_used, idx);
+        xwos_sem_post(&psdemo_msg_free);
+}
+
+/**
+ * @brief 发布者线程的主函数
+ */
+xwer_t psdemo_publisher_main(void * arg)
+{
+        static const xwsq_t topic[] = {
+                PSDEMO_TOPIC_TEMP, PSDEMO_TOPIC_VOLT, PSDEMO_TOPIC_ALARM,
+        };
+        xwsq_t seq;
+        xwssq_t idx;
+        xwsz_t num;
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        pslogf(INFO, "[发布者] 启动。\n");
+        seq = 0;
+        rc = XWOK;
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                rc = xwos_sem_wait(&psdemo_msg_free);
+                if (rc < 0) {
+                        break;
+                }
+                idx = xwbmpaop_ffz_then_s1i(psdemo_msg_used, PSDEMO_POOL_NUM);
+                psdemo_sample[idx].seq = seq;
+                psdemo_sample[idx].value = seq * 7U;
+                xwps_msg_init(&psdemo_msg[idx], topic[seq % xw_array_size(topic)],
+                              &psdemo_sample[idx], psdemo_msg_release, NULL);
+                xwps_publish(&psdemo_ps, &psdemo_msg[idx], &num);
+                pslogf(INFO, "[发布者] 发布{topic = 0x%X, seq = %d}，订阅者：%d。\n",
+                       topic[seq % xw_array_size(topic)], seq, num);
+                seq++;
+                xwos_cthd_sleep(XWTM_MS(500));
+        }
+        pslogf(INFO, "[发布者] 退出。\n");
+        return rc;
+}
+
+/**
+ * @brief 订阅者线程的主函数
+ */
+xwer_t psdemo_subscriber_main(void * arg)
+{
+        struct psdemo_subscriber * sub;
+        struct psdemo_sample * sample;
+        struct xwps_msg * msg;
+        xwsq_t topic;
+        xwer_t rc;
+
+        sub = arg;
+        rc = XWOK;
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                rc = xwmq_dq(&sub->mq, &topic, (void **)&msg);
+                if (rc < 0) {
+                        break;
+                }
+                sample = msg->data;
+                pslogf(INFO, "[%s] 接收{topic = 0x%X, seq = %d, value = %d}。\n",
+                       sub->name, topic, sample->seq, sample->value);
+                xwps_msg_put(msg);
+        }
+        return rc;
+}
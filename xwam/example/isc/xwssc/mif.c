@@ -0,0 +1,523 @@
+/**
+ * @file
+ * @brief 示例：SOC间点对点通讯协议的性能测试
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ * @details
+ * 两个XWSSC通过内存回环 @ref xwmd_isc_xwssc_hwif_loopback 连接，不需要任何硬件，
+ * 回环模拟带宽为 `SSCBM_BANDWIDTH` 、延迟为 `SSCBM_LATENCY` 、
+ * 误码间隔为 `SSCBM_BER` 的链路。
+ *
+ * 按 `sscbm_case` 中的QoS与优先级依次测试，每个用例：
+ * + 发送线程通过 `xwssc_eq()` 连续发送 `SSCBM_MSG_NUM` 个消息，
+ *   同时未完成的消息最多为 `SSCBM_INFLIGHT` 个，消息中带有发送的时间；
+ * + 接收线程通过 `xwssc_rx()` 接收消息，检查数据并统计延迟；
+ * + 打印有效吞吐量（完好送达的数据量除以用时）、延迟的百分位数、
+ *   重传帧与错误帧的数量。
+ *
+ * 延迟按对数分桶统计，每个2的幂区间分为8个桶，百分位数取桶的上界，误差不超过12.5%。
+ *
+ * 将配置 `XWMDCFG_isc_xwssc_WND_SIZE` 改为 `1` ，即可与停等协议的结果对比。
+ * 打开误码时，不可靠消息会丢失，无CRC校验码的消息可能损坏，
+ * 可靠消息依赖重传，用时与 `XWMDCFG_isc_xwssc_RETRY_PERIOD` 有关。
+ *
+ * 打开配置 `XWMDCFG_isc_xwssc_COMPRESS` 时，测试端口启用压缩，
+ * 结束时打印压缩率与压缩、解压的耗时。
+ */
+
+#include <xwos/standard.h>
+#include <string.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/osal/skd.h>
+#include <xwos/osal/time.h>
+#include <xwos/osal/thd.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwmd/isc/xwssc/protocol.h>
+#include <xwmd/isc/xwssc/mif.h>
+#include <xwmd/isc/xwssc/hwif/loopback.h>
+#include <xwam/example/isc/xwssc/mif.h>
+
+#define LOGTAG "xwssc"
+#define sscbmlogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define SSCBM_THD_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 2)
+#define SSCBM_PORT              1U
+#define SSCBM_MSG_SIZE          32U
+#define SSCBM_MSG_NUM           2000U
+#define SSCBM_INFLIGHT          (XWMDCFG_isc_xwssc_WND_SIZE * 2U)
+#define SSCBM_DRAIN_TIME        XWTM_MS(500) /**< 发送完成后等待剩余消息的时间 */
+
+#define SSCBM_BANDWIDTH         (1000000U) /**< 模拟链路的带宽，单位：字节/秒 */
+#define SSCBM_LATENCY           XWTM_US(20) /**< 模拟链路的延迟 */
+#define SSCBM_BER               (0U) /**< 模拟链路的误码间隔，例如 `100000U` */
+
+#define SSCBM_HIST_SUB          (8U) /**< 每个2的幂区间的桶数 */
+#define SSCBM_HIST_NUM          (22U * SSCBM_HIST_SUB) /**< 桶数，最大约16秒 */
+
+/**
+ * @brief 测试用例
+ */
+struct sscbm_case {
+        xwu8_t qos; /**< 服务质量 */
+        xwu8_t pri; /**< 优先级 */
+};
+
+/**
+ * @brief 测试消息的头部，其余部分是由序号产生的填充数据
+ */
+struct sscbm_msghead {
+        xwu32_t tc; /**< 测试用例的序号 */
+        xwu32_t seq; /**< 消息的序号 */
+        xwtm_t ts; /**< 发送的时间 */
+};
+
+/**
+ * @brief 测试用例的结果
+ */
+struct sscbm_result {
+        xwtm_t start; /**< 开始发送的时间 */
+        xwtm_t last; /**< 最后一个完好的消息到达的时间 */
+        xwu32_t sent; /**< 加入发送队列的消息数量 */
+        xwu32_t failed; /**< 发送失败的消息数量，由发送线程统计 */
+        xwu32_t received; /**< 完好送达的消息数量，以下由接收线程统计 */
+        xwu32_t corrupted; /**< 数据损坏的消息数量 */
+        xwu32_t disorder; /**< 序号不连续的次数 */
+        xwu32_t expected; /**< 期望的下一个序号 */
+        xwtm_t maxlat; /**< 最大延迟 */
+        xwu32_t hist[SSCBM_HIST_NUM]; /**< 延迟的直方图 */
+};
+
+static const struct sscbm_case sscbm_case[] = {
+        { .qos = XWSSC_MSG_QOS_0, .pri = XWSSC_MAX_PRI, },
+        { .qos = XWSSC_MSG_QOS_1, .pri = XWSSC_MAX_PRI, },
+        { .qos = XWSSC_MSG_QOS_2, .pri = XWSSC_MAX_PRI, },
+        { .qos = XWSSC_MSG_QOS_3, .pri = XWSSC_MAX_PRI, },
+        { .qos = XWSSC_MSG_QOS_3, .pri = 0, },
+};
+
+#define SSCBM_CASE_NUM          xw_array_size(sscbm_case)
+
+xwer_t sscbm_tx_func(void * arg);
+xwer_t sscbm_rx_func(void * arg);
+
+XWSSC_DEF_MEMPOOL(sscbm_mempool0);
+XWSSC_DEF_MEMPOOL(sscbm_mempool1);
+struct xwssc sscbm_xwssc0;
+struct xwssc sscbm_xwssc1;
+struct xwsscif_loopback sscbm_lb;
+struct xwos_sem sscbm_credit; /**< 可以加入发送队列的消息数量 */
+struct xwos_sem sscbm_done;
+struct sscbm_result sscbm_result[SSCBM_CASE_NUM];
+xwos_thd_d sscbm_tx;
+xwos_thd_d sscbm_rx;
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwmd_example_xwssc(void)
+{
+        struct xwsscif_loopback_cfg lbcfg;
+        struct xwos_thd_attr attr;
+        xwer_t rc;
+
+        xwsscif_loopback_init(&sscbm_lb);
+        lbcfg.bandwidth = SSCBM_BANDWIDTH;
+        lbcfg.latency = SSCBM_LATENCY;
+        lbcfg.ber = SSCBM_BER;
+        lbcfg.seed = 1;
+        xwsscif_loopback_set_cfg(&sscbm_lb, &lbcfg);
+        rc = xwssc_start(&sscbm_xwssc0, "xwssc.bm0",
+                         &xwsscif_loopback_ops, &sscbm_lb.ep[0],
+                         sscbm_mempool0, sizeof(sscbm_mempool0));
+        if (rc < 0) {
+                goto err_xwssc0_start;
+        }
+        rc = xwssc_start(&sscbm_xwssc1, "xwssc.bm1",
+                         &xwsscif_loopback_ops, &sscbm_lb.ep[1],
+                         sscbm_mempool1, sizeof(sscbm_mempool1));
+        if (rc < 0) {
+                goto err_xwssc1_start;
+        }
+        rc = xwos_sem_init(&sscbm_credit, SSCBM_INFLIGHT, SSCBM_INFLIGHT);
+        if (rc < 0) {
+                goto err_credit_init;
+        }
+        rc = xwos_sem_init(&sscbm_done, 0, 1);
+        if (rc < 0) {
+                goto err_done_init;
+        }
+
+        xwos_thd_attr_init(&attr);
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = SSCBM_THD_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        attr.name = "xwssc.bm.rx";
+        rc = xwos_thd_create(&sscbm_rx, &attr, sscbm_rx_func, NULL);
+        if (rc < 0) {
+                goto err_rx_create;
+        }
+        attr.name = "xwssc.bm.tx";
+        rc = xwos_thd_create(&sscbm_tx, &attr, sscbm_tx_func, NULL);
+        if (rc < 0) {
+                goto err_tx_create;
+        }
+        return XWOK;
+
+err_tx_create:
+        xwos_thd_quit(sscbm_rx);
+err_rx_create:
+        xwos_sem_fini(&sscbm_done);
+err_done_init:
+        xwos_sem_fini(&sscbm_credit);
+err_credit_init:
+        xwssc_stop(&sscbm_xwssc1);
+err_xwssc1_start:
+        xwssc_stop(&sscbm_xwssc0);
+err_xwssc0_start:
+        return rc;
+}
+
+/**
+ * @brief 计算延迟所在的桶
+ */
+static
+xwsz_t sscbm_hist_idx(xwtm_t lat)
+{
+        xwu32_t us;
+        xwsz_t e;
+
+        if (lat < 0) {
+                lat = 0;
+        }
+        if (lat >= XWTM_US(1U << 24U)) {
+                us = (1U << 24U) - 1U;
+        } else {
+                us = (xwu32_t)(lat / XWTM_US(1));
+        }
+        if (us < SSCBM_HIST_SUB) {
+                return (xwsz_t)us;
+        }
+        e = (xwsz_t)xwbop_fls(xwu32_t, us);
+        return ((e - 2U) * SSCBM_HIST_SUB) + ((us >> (e - 3U)) & (SSCBM_HIST_SUB - 1U));
+}
+
+/**
+ * @brief 计算桶的上界，单位：微秒
+ */
+static
+xwu32_t sscbm_hist_us(xwsz_t idx)
+{
+        xwsz_t e;
+        xwu32_t lo;
+
+        if (idx < SSCBM_HIST_SUB) {
+                return (xwu32_t)idx;
+        }
+        e = (idx / SSCBM_HIST_SUB) + 2U;
+        lo = (xwu32_t)(SSCBM_HIST_SUB + (idx % SSCBM_HIST_SUB)) << (e - 3U);
+        return lo + ((xwu32_t)1 << (e - 3U)) - 1U;
+}
+
+/**
+ * @brief 计算延迟的百分位数，单位：微秒
+ */
+static
+xwu32_t sscbm_percentile(const struct sscbm_result * res, xwu32_t pct)
+{
+        xwu32_t target;
+        xwu32_t sum;
+        xwu32_t maxus;
+        xwsz_t i;
+
+        maxus = (xwu32_t)(res->maxlat / XWTM_US(1));
+        target = ((res->received * pct) + 99U) / 100U;
+        sum = 0;
+        for (i = 0; i < SSCBM_HIST_NUM; i++) {
+                sum += res->hist[i];
+                if ((sum >= target) && (sum > 0U)) {
+                        return (sscbm_hist_us(i) < maxus) ? sscbm_hist_us(i) : maxus;
+                }
+        }
+        return maxus;
+}
+
+/**
+ * @brief 通知发送结果的回调函数
+ */
+static
+void sscbm_txcb(struct xwssc * xwssc, xwssc_txh_t txh, xwer_t rc, void * arg)
+{
+        struct sscbm_result * res;
+
+        XWOS_UNUSED(xwssc);
+        XWOS_UNUSED(txh);
+        res = arg;
+        if (rc < 0) {
+                res->failed++;
+        }
+        xwos_sem_post(&sscbm_credit);
+}
+
+/**
+ * @brief 打印测试端口的压缩统计信息
+ */
+static
+void sscbm_report_lz(void)
+{
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+        struct xwssc_lzstat tx;
+        struct xwssc_lzstat rx;
+
+        xwssc_get_lzstat(&sscbm_xwssc0, SSCBM_PORT, &tx);
+        xwssc_get_lzstat(&sscbm_xwssc1, SSCBM_PORT, &rx);
+        if ((tx.txraw > 0U) && (rx.rxraw > 0U)) {
+                sscbmlogf(INFO,
+                          "[发送线程] 压缩：%lld -> %lld 字节（%lld%%），"
+                          "压缩耗时：%lld 纳秒/KiB，解压耗时：%lld 纳秒/KiB。\n",
+                          tx.txraw, tx.txlz, (tx.txlz * 100U) / tx.txraw,
+                          (tx.txcost * 1024) / (xwtm_t)tx.txraw,
+                          (rx.rxcost * 1024) / (xwtm_t)rx.rxraw);
+        }
+#endif
+}
+
+/**
+ * @brief 打印测试用例的结果
+ */
+static
+void sscbm_report(xwu32_t tc,
+                  const struct xwssc_stat * stat0, const struct xwssc_stat * stat1,
+                  xwu64_t errbits)
+{
+        const struct sscbm_result * res;
+        xwtm_t cost;
+        xwtm_t goodput;
+
+        res = &sscbm_result[tc];
+        cost = res->last - res->start;
+        goodput = 0;
+        if ((res->received > 0U) && (cost > 0)) {
+                goodput = ((xwtm_t)res->received * SSCBM_MSG_SIZE * XWTM_S(1)) / cost;
+        }
+        sscbmlogf(INFO,
+                  "[用例%u] QoS:%u，优先级:%u，发送:%u，送达:%u，损坏:%u，失败:%u，"
+                  "乱序:%u，用时:%lld 纳秒，有效吞吐量:%lld 字节/秒。\n",
+                  tc, sscbm_case[tc].qos, sscbm_case[tc].pri,
+                  res->sent, res->received, res->corrupted, res->failed,
+                  res->disorder, cost, goodput);
+        sscbmlogf(INFO,
+                  "[用例%u] 延迟（微秒）P50:%u，P90:%u，P99:%u，最大:%u；"
+                  "首发帧:%u，重传帧:%u，错误帧:%u，注入误码:%u 位。\n",
+                  tc,
+                  sscbm_percentile(res, 50U), sscbm_percentile(res, 90U),
+                  sscbm_percentile(res, 99U), (xwu32_t)(res->maxlat / XWTM_US(1)),
+                  (xwu32_t)stat0->txsdu, (xwu32_t)stat0->txrtx,
+                  (xwu32_t)(stat0->rxerr + stat1->rxerr), (xwu32_t)errbits);
+}
+
+/**
+ * @brief 运行一个测试用例
+ */
+static
+xwer_t sscbm_run(xwu32_t tc)
+{
+        union {
+                struct sscbm_msghead head;
+                xwu8_t data[SSCBM_MSG_SIZE];
+        } msg;
+        struct sscbm_result * res;
+        struct xwssc_stat before0;
+        struct xwssc_stat before1;
+        struct xwssc_stat stat0;
+        struct xwssc_stat stat1;
+        xwu64_t errbits;
+        xwsz_t size;
+        xwsz_t i;
+        xwu32_t seq;
+        xwer_t rc;
+
+        res = &sscbm_result[tc];
+        while (XWOK == xwos_sem_trywait(&sscbm_done)) {
+        }
+        xwssc_get_stat(&sscbm_xwssc0, &before0);
+        xwssc_get_stat(&sscbm_xwssc1, &before1);
+        errbits = xwsscif_loopback_get_errbits(&sscbm_lb, 0) +
+                  xwsscif_loopback_get_errbits(&sscbm_lb, 1);
+
+        res->start = xwtm_now();
+        res->last = res->start;
+        for (seq = 0; seq < SSCBM_MSG_NUM; seq++) {
+                rc = xwos_sem_wait(&sscbm_credit);
+                if (rc < 0) {
+                        goto err_credit;
+                }
+                msg.head.tc = tc;
+                msg.head.seq = seq;
+                for (i = sizeof(msg.head); i < sizeof(msg.data); i++) {
+                        msg.data[i] = (xwu8_t)(seq + i);
+                }
+                do {
+                        msg.head.ts = xwtm_now();
+                        size = sizeof(msg);
+                        rc = xwssc_eq(&sscbm_xwssc0, msg.data, &size,
+                                      sscbm_case[tc].pri, SSCBM_PORT,
+                                      sscbm_case[tc].qos,
+                                      sscbm_txcb, res, NULL);
+                        if (-ENOMEM == rc) {
+                                xwos_cthd_yield();
+                        }
+                } while (-ENOMEM == rc);
+                if (rc < 0) {
+                        xwos_sem_post(&sscbm_credit);
+                        goto err_eq;
+                }
+                res->sent++;
+        }
+        /* 等待所有消息发送完成 */
+        for (i = 0; i < SSCBM_INFLIGHT; i++) {
+                rc = xwos_sem_wait(&sscbm_credit);
+                if (rc < 0) {
+                        goto err_credit;
+                }
+        }
+        for (i = 0; i < SSCBM_INFLIGHT; i++) {
+                xwos_sem_post(&sscbm_credit);
+        }
+        /* 不可靠的消息可能丢失，等待一段时间后不再等待 */
+        rc = xwos_sem_wait_to(&sscbm_done, xwtm_ft(SSCBM_DRAIN_TIME));
+        if ((rc < 0) && (-ETIMEDOUT != rc)) {
+                goto err_done;
+        }
+
+        xwssc_get_stat(&sscbm_xwssc0, &stat0);
+        xwssc_get_stat(&sscbm_xwssc1, &stat1);
+        stat0.txsdu -= before0.txsdu;
+        stat0.txrtx -= before0.txrtx;
+        stat0.rxerr -= before0.rxerr;
+        stat1.rxerr -= before1.rxerr;
+        errbits = xwsscif_loopback_get_errbits(&sscbm_lb, 0) +
+                  xwsscif_loopback_get_errbits(&sscbm_lb, 1) - errbits;
+        sscbm_report(tc, &stat0, &stat1, errbits);
+        return XWOK;
+
+err_done:
+err_eq:
+err_credit:
+        return rc;
+}
+
+/**
+ * @brief 发送线程的主函数
+ */
+xwer_t sscbm_tx_func(void * arg)
+{
+        xwu32_t tc;
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        while (!(xwssc_tst_connected(&sscbm_xwssc0) &&
+                 xwssc_tst_connected(&sscbm_xwssc1))) {
+                xwos_cthd_sleep(XWTM_MS(10));
+        }
+        sscbmlogf(INFO,
+                  "[发送线程] 已连接，窗口：%d，带宽：%u 字节/秒，延迟：%lld 纳秒，"
+                  "误码间隔：%u 位。\n",
+                  XWMDCFG_isc_xwssc_WND_SIZE, SSCBM_BANDWIDTH,
+                  (xwtm_t)SSCBM_LATENCY, SSCBM_BER);
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+        xwssc_set_lz(&sscbm_xwssc0, SSCBM_PORT, true);
+        sscbmlogf(INFO, "[发送线程] 压缩：%s。\n",
+                  xwssc_tst_lz(&sscbm_xwssc0) ? "已协商" : "远端不支持");
+#endif
+
+        rc = XWOK;
+        for (tc = 0; tc < SSCBM_CASE_NUM; tc++) {
+                rc = sscbm_run(tc);
+                if (rc < 0) {
+                        sscbmlogf(ERR, "[发送线程] 用例%u失败：%d。\n", tc, rc);
+                        break;
+                }
+        }
+        sscbm_report_lz();
+        return rc;
+}
+
+/**
+ * @brief 检查并统计收到的消息
+ */
+static
+void sscbm_rx_msg(const xwu8_t data[], xwsz_t size, xwtm_t now)
+{
+        struct sscbm_msghead head;
+        struct sscbm_result * res;
+        xwtm_t lat;
+        xwsz_t i;
+
+        if (size != SSCBM_MSG_SIZE) {
+                return;
+        }
+        memcpy(&head, data, sizeof(head));
+        if (head.tc >= SSCBM_CASE_NUM) {
+                return;
+        }
+        res = &sscbm_result[head.tc];
+        for (i = sizeof(head); i < SSCBM_MSG_SIZE; i++) {
+                if (data[i] != (xwu8_t)(head.seq + i)) {
+                        res->corrupted++;
+                        return;
+                }
+        }
+        if (head.seq != res->expected) {
+                res->disorder++;
+        }
+        res->expected = head.seq + 1U;
+        lat = now - head.ts;
+        if (lat > res->maxlat) {
+                res->maxlat = lat;
+        }
+        res->hist[sscbm_hist_idx(lat)]++;
+        res->last = now;
+        res->received++;
+        if (SSCBM_MSG_NUM == res->received) {
+                xwos_sem_post(&sscbm_done);
+        }
+}
+
+/**
+ * @brief 接收线程的主函数
+ */
+xwer_t sscbm_rx_func(void * arg)
+{
+        xwu8_t msg[SSCBM_MSG_SIZE];
+        xwsz_t size;
+        xwu8_t qos;
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        rc = XWOK;
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                size = sizeof(msg);
+                rc = xwssc_rx(&sscbm_xwssc1, SSCBM_PORT, msg, &size, &qos, XWTM_MAX);
+                if (rc < 0) {
+                        break;
+                }
+                sscbm_rx_msg(msg, size, xwtm_now());
+        }
+        return rc;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * @brief 示例：竞技场分配器
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/mm/bma.h>
+#include <xwos/mm/arena.h>
+#include <xwam/example/mm/arena/mif.h>
+
+#define XWMMDEMO_ARENA_BMA_MEMSIZE      8192U
+#define XWMMDEMO_ARENA_BMA_BLKSIZE      256U
+#define XWMMDEMO_ARENA_BMA_BLKODR       5U
+#define XWMMDEMO_ARENA_BLKSIZE          1024U
+
+/**
+ * @brief 伙伴算法内存块分配器的内存区间
+ */
+xwu8_t __xwcc_alignl1cache xwmmdemo_arena_bma_mempool[XWMMDEMO_ARENA_BMA_MEMSIZE];
+
+/**
+ * @brief 竞技场分配器的上级分配器
+ */
+XWMM_BMA_RAWOBJ_DEF(xwmmdemo_arena_bma_raw, XWMMDEMO_ARENA_BMA_BLKODR);
+struct xwmm_bma * xwmmdemo_arena_bma = (struct xwmm_bma *)xwmmdemo_arena_bma_raw;
+
+/**
+ * @brief 竞技场分配器
+ */
+struct xwmm_arena xwmmdemo_arena;
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwmm_example_arena(void)
+{
+        struct xwmm_arena_mark mark;
+        void * hdr;
+        void * payload;
+        xwer_t rc;
+
+        rc = xwmm_bma_init(xwmmdemo_arena_bma, "xwmmdemo_arena_bma",
+                           (xwptr_t)xwmmdemo_arena_bma_mempool,
+                           XWMMDEMO_ARENA_BMA_MEMSIZE,
+                           XWMMDEMO_ARENA_BMA_BLKSIZE, XWMMDEMO_ARENA_BMA_BLKODR);
+        if (rc < 0) {
+                goto err_bma_init;
+        }
+
+        /* 建立竞技场分配器：
+           + 上级分配器：xwmmdemo_arena_bma
+           + 每次从上级分配器申请至少XWMMDEMO_ARENA_BLKSIZE字节的内存块 */
+        rc = xwmm_arena_init_bma(&xwmmdemo_arena, "xwmmdemo_arena",
+                                 xwmmdemo_arena_bma, XWMMDEMO_ARENA_BLKSIZE);
+        if (rc < 0) {
+                goto err_arena_init;
+        }
+
+        /* 每个报文的处理过程：申请的内存在处理结束后一次性释放 */
+        xwmm_arena_mark(&xwmmdemo_arena, &mark);
+        rc = xwmm_arena_alloc(&xwmmdemo_arena, 16, 0, &hdr);
+        if (rc < 0) {
+                goto err_arena_alloc;
+        }
+        /* 超过内存块大小的申请会单独向上级分配器申请一个更大的内存块 */
+        rc = xwmm_arena_alloc(&xwmmdemo_arena, 1500, 64, &payload);
+        if (rc < 0) {
+                goto err_arena_alloc;
+        }
+        xwmm_arena_rewind(&xwmmdemo_arena, &mark);
+
+        /* 复位后只保留第一块内存块 */
+        xwmm_arena_reset(&xwmmdemo_arena);
+        /* 将所有内存块归还给伙伴算法内存块分配器 */
+        xwmm_arena_release(&xwmmdemo_arena);
+        return XWOK;
+
+err_arena_alloc:
+        xwmm_arena_release(&xwmmdemo_arena);
+err_arena_init:
+err_bma_init:
+        return rc;
+}
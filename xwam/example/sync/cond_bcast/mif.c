@@ -0,0 +1,216 @@
+/**
+ * @file
+ * @brief 示例：条件量广播的性能测试
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ * @details
+ * 16个等待线程均匀分布在各个CPU上，等待同一个条件量，条件量关联同一个互斥锁。
+ * 主线程持有互斥锁广播条件量，测量从广播到最后一个等待线程获得互斥锁所用的时间。
+ *
+ * MP内核中，广播只唤醒第一个等待线程，其余的线程被直接转移到互斥锁的等待队列中，
+ * 主线程解锁后互斥锁被逐个交给它们，等待线程不会同时被唤醒再争抢互斥锁。
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/osal/time.h>
+#include <xwos/osal/thd.h>
+#include <xwos/osal/lock/mtx.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwos/osal/sync/cond.h>
+#include <xwam/example/sync/cond_bcast/mif.h>
+
+#define LOGTAG "condbc"
+#define condbclogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define CONDBC_MASTER_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 2)
+#define CONDBC_WAITER_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 1)
+#define CONDBC_WAITER_NUM      16U
+#define CONDBC_ROUND_NUM       100U
+
+xwer_t condbc_master_func(void * arg);
+xwer_t condbc_waiter_func(void * arg);
+
+struct xwos_mtx condbc_mtx;
+struct xwos_cond condbc_cond;
+struct xwos_sem condbc_done;
+xwsq_t condbc_gen = 0; /**< 广播的代数：被互斥锁保护 */
+xwsz_t condbc_waiting = 0; /**< 正在等待的线程数量：被互斥锁保护 */
+xwsz_t condbc_acquired = 0; /**< 本轮已获得互斥锁的线程数量：被互斥锁保护 */
+xwtm_t condbc_end = 0; /**< 本轮最后一个线程获得互斥锁的时间：被互斥锁保护 */
+xwos_thd_d condbc_master;
+xwos_thd_d condbc_waiter[CONDBC_WAITER_NUM];
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwos_example_cond_bcast(void)
+{
+        struct xwos_thd_attr attr;
+        xwsq_t i;
+        xwer_t rc;
+
+        rc = xwos_mtx_init(&condbc_mtx, XWOS_SKD_PRIORITY_RT_MIN);
+        if (rc < 0) {
+                goto err_mtx_init;
+        }
+        rc = xwos_cond_init(&condbc_cond);
+        if (rc < 0) {
+                goto err_cond_init;
+        }
+        rc = xwos_sem_init(&condbc_done, 0, 1);
+        if (rc < 0) {
+                goto err_sem_init;
+        }
+
+        xwos_thd_attr_init(&attr);
+        attr.name = "condbc.waiter";
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = CONDBC_WAITER_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        for (i = 0; i < CONDBC_WAITER_NUM; i++) {
+                rc = xwos_thd_create(&condbc_waiter[i], &attr,
+                                     condbc_waiter_func, (void *)i);
+                if (rc < 0) {
+                        goto err_waiter_create;
+                }
+                /* 将等待线程均匀分布到各个CPU上 */
+                xwos_thd_migrate(condbc_waiter[i], (xwid_t)(i % CPUCFG_CPU_NUM));
+        }
+
+        attr.name = "condbc.master";
+        attr.priority = CONDBC_MASTER_PRIORITY;
+        rc = xwos_thd_create(&condbc_master, &attr, condbc_master_func, NULL);
+        if (rc < 0) {
+                goto err_waiter_create;
+        }
+        return XWOK;
+
+err_waiter_create:
+        while (i > 0) {
+                i--;
+                xwos_thd_quit(condbc_waiter[i]);
+        }
+        xwos_sem_fini(&condbc_done);
+err_sem_init:
+        xwos_cond_fini(&condbc_cond);
+err_cond_init:
+        xwos_mtx_fini(&condbc_mtx);
+err_mtx_init:
+        return rc;
+}
+
+/**
+ * @brief 主线程的主函数
+ */
+xwer_t condbc_master_func(void * arg)
+{
+        xwtm_t start;
+        xwtm_t cost;
+        xwtm_t min;
+        xwtm_t max;
+        xwtm_t sum;
+        xwsz_t waiting;
+        xwsq_t round;
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        condbclogf(INFO, "[主线程] 启动，等待线程：%d，CPU：%d。\n",
+                   CONDBC_WAITER_NUM, CPUCFG_CPU_NUM);
+        min = XWTM_MAX;
+        max = 0;
+        sum = 0;
+        rc = XWOK;
+        for (round = 0; round < CONDBC_ROUND_NUM; round++) {
+                /* 等待所有线程都进入条件量的等待队列 */
+                do {
+                        xwos_mtx_lock(&condbc_mtx);
+                        waiting = condbc_waiting;
+                        if (waiting < CONDBC_WAITER_NUM) {
+                                xwos_mtx_unlock(&condbc_mtx);
+                                xwos_cthd_sleep(XWTM_MS(1));
+                        }
+                } while (waiting < CONDBC_WAITER_NUM);
+
+                /* 持有互斥锁时广播 */
+                condbc_gen++;
+                condbc_acquired = 0;
+                start = xwtm_now();
+                xwos_cond_broadcast(&condbc_cond);
+                xwos_mtx_unlock(&condbc_mtx);
+
+                rc = xwos_sem_wait_to(&condbc_done, xwtm_ft(XWTM_S(1)));
+                if (rc < 0) {
+                        condbclogf(ERR, "[主线程] 第%d轮超时，rc：%d。\n", round, rc);
+                        break;
+                }
+                cost = condbc_end - start;
+                sum += cost;
+                if (cost < min) {
+                        min = cost;
+                }
+                if (cost > max) {
+                        max = cost;
+                }
+        }
+        if (XWOK == rc) {
+                condbclogf(INFO,
+                           "[主线程] 广播到所有线程获得互斥锁，"
+                           "最短：%lld 纳秒，平均：%lld 纳秒，最长：%lld 纳秒。\n",
+                           min, sum / (xwtm_t)CONDBC_ROUND_NUM, max);
+        }
+        return rc;
+}
+
+/**
+ * @brief 等待线程的主函数
+ */
+xwer_t condbc_waiter_func(void * arg)
+{
+        union xwos_ulock ulk;
+        xwsq_t lkst;
+        xwsq_t gen;
+        xwer_t rc;
+
+        XWOS_UNUSED(arg);
+        ulk.osal.mtx = &condbc_mtx;
+        xwos_mtx_lock(&condbc_mtx);
+        gen = condbc_gen;
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                condbc_waiting++;
+                do {
+                        rc = xwos_cond_wait(&condbc_cond, ulk, XWOS_LK_MTX, NULL,
+                                            &lkst);
+                        if ((xwsq_t)XWOS_LKST_UNLOCKED == lkst) {
+                                xwos_mtx_lock(&condbc_mtx);
+                        }
+                } while ((XWOK == rc) && (gen == condbc_gen));
+                condbc_waiting--;
+                if (rc < 0) {
+                        break;
+                }
+                gen = condbc_gen;
+                condbc_acquired++;
+                if (CONDBC_WAITER_NUM == condbc_acquired) {
+                        condbc_end = xwtm_now();
+                        xwos_sem_post(&condbc_done);
+                }
+        }
+        xwos_mtx_unlock(&condbc_mtx);
+        return rc;
+}
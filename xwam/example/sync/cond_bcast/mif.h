@@ -0,0 +1,28 @@
+/**
+ * @file
+ * @brief 示例：条件量广播的性能测试
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#ifndef __xwam_example_sync_cond_bcast_mif_h__
+#define __xwam_example_sync_cond_bcast_mif_h__
+
+#include <xwos/standard.h>
+
+xwer_t xwos_example_cond_bcast(void);
+
+#endif /* xwam/example/sync/cond_bcast/mif.h */
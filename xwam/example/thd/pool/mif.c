@@ -0,0 +1,146 @@
+/**
+ * @file
+ * @brief 示例：线程池
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/osal/thd.h>
+#include <xwam/example/thd/pool/mif.h>
+
+#define LOGTAG "thdpool"
+#define thdpoollogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define THDPOOL_MASTER_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 1)
+#define THDPOOL_WORKER_PRIORITY XWOS_SKD_PRIORITY_DROP(XWOS_SKD_PRIORITY_RT_MAX, 2)
+#define THDPOOL_WORKER_NUM      4U
+#define THDPOOL_WORKER_STACK_SIZE 2048U
+
+xwer_t thdpool_master_func(void * arg);
+xwer_t thdpool_worker_func(void * arg);
+
+/**
+ * @brief 线程池
+ */
+struct xwos_thd_pool thdpool;
+
+/**
+ * @brief 线程池中的线程对象
+ */
+struct xwos_thd thdpool_thds[THDPOOL_WORKER_NUM];
+
+/**
+ * @brief 线程池中的线程栈
+ */
+xwstk_t __xwcc_alignl1cache
+thdpool_stacks[THDPOOL_WORKER_NUM][THDPOOL_WORKER_STACK_SIZE / sizeof(xwstk_t)];
+
+/**
+ * @brief 主线程
+ */
+xwos_thd_d thdpool_master_thdd;
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwos_example_thd_pool(void)
+{
+        struct xwos_thd_attr attr;
+        xwer_t rc;
+
+        rc = xwos_thd_pool_init(&thdpool, "worker.pool",
+                                thdpool_thds, &thdpool_stacks[0][0],
+                                THDPOOL_WORKER_STACK_SIZE, THDPOOL_WORKER_NUM);
+        if (rc < 0) {
+                goto err_pool_init;
+        }
+
+        xwos_thd_attr_init(&attr);
+        attr.name = "thdpool.master";
+        attr.stack = NULL;
+        attr.stack_size = 2048;
+        attr.priority = THDPOOL_MASTER_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        rc = xwos_thd_create(&thdpool_master_thdd, &attr,
+                             thdpool_master_func, NULL);
+        if (rc < 0) {
+                goto err_thd_create;
+        }
+        return XWOK;
+
+err_thd_create:
+err_pool_init:
+        return rc;
+}
+
+/**
+ * @brief 主线程的主函数
+ */
+xwer_t thdpool_master_func(void * arg)
+{
+        struct xwos_thd_attr attr;
+        xwos_thd_d worker;
+        xwer_t rc;
+        xwer_t childrc;
+        xwsq_t cnt;
+
+        XWOS_UNUSED(arg);
+        thdpoollogf(INFO, "[主线程] 开始运行。\n");
+
+        xwos_thd_attr_init(&attr);
+        attr.name = "thdpool.worker";
+        attr.stack_size = THDPOOL_WORKER_STACK_SIZE;
+        attr.priority = THDPOOL_WORKER_PRIORITY;
+        attr.detached = false;
+        attr.privileged = true;
+        cnt = 0;
+        while (!xwos_cthd_frz_shld_stop(NULL)) {
+                /* 从线程池中获取线程，不会调用内存分配器 */
+                rc = xwos_thd_pool_create(&worker, &attr,
+                                          thdpool_worker_func, (void *)cnt);
+                if (rc < 0) {
+                        thdpoollogf(ERR, "[主线程] 获取线程失败，rc:%d。\n", rc);
+                        break;
+                }
+                thdpoollogf(INFO, "[主线程] 线程池中空闲的线程：%d\n",
+                            xwos_thd_pool_get_num_free(&thdpool));
+                /* 线程退出后，线程对象与线程栈回收到线程池中 */
+                rc = xwos_thd_join(worker, &childrc);
+                if (rc < 0) {
+                        thdpoollogf(ERR, "[主线程] 连接线程失败，rc:%d。\n", rc);
+                        break;
+                }
+                thdpoollogf(INFO, "[主线程] 线程返回：%d，线程池中空闲的线程：%d\n",
+                            childrc, xwos_thd_pool_get_num_free(&thdpool));
+                cnt++;
+                xwos_cthd_sleep(XWTM_S(1));
+        }
+        return XWOK;
+}
+
+/**
+ * @brief 工作线程的主函数
+ */
+xwer_t thdpool_worker_func(void * arg)
+{
+        xwsq_t cnt = (xwsq_t)arg;
+
+        thdpoollogf(INFO, "[工作线程] 第%d次运行。\n", cnt);
+        return (xwer_t)cnt;
+}
@@ -21,18 +21,83 @@
 #include <xwos/standard.h>
 #include <xwos/lib/xwlog.h>
 #include <xwos/lib/crc8.h>
+#include <xwos/lib/crc16.h>
 #include <xwos/lib/crc32.h>
 
 #define LOGTAG "crc"
 #define crclogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
 
+#define CRC_STREAM_SIZE 64U
+
+/**
+ * @brief 检查按不同的分段长度增量计算的CRC32与一次性计算的结果是否相同
+ * @details
+ * 分段长度不小于4，使每一段都可能由硬件CRC单元计算，
+ * 检查续算时硬件单元是否正确装载了上一段的余数。
+ */
+static
+xwer_t crc_check_streaming(void)
+{
+        xwu8_t stream[CRC_STREAM_SIZE];
+        struct xwlib_crc32_ctx ctx;
+        xwu32_t expected;
+        xwu32_t expectedc;
+        xwu32_t crc32;
+        xwsz_t chunk;
+        xwsz_t pos;
+        xwsz_t size;
+        xwsz_t i;
+        xwer_t rc;
+
+        for (i = 0; i < CRC_STREAM_SIZE; i++) {
+                stream[i] = (xwu8_t)((i * 7U) + 1U);
+        }
+        size = CRC_STREAM_SIZE;
+        expected = xwlib_crc32_calms(stream, &size);
+        size = CRC_STREAM_SIZE;
+        expectedc = xwlib_crc32c_calms(stream, &size);
+        rc = XWOK;
+        for (chunk = 4; chunk <= 16U; chunk++) {
+                xwlib_crc32_init_ms(&ctx);
+                for (pos = 0; pos < CRC_STREAM_SIZE; pos += chunk) {
+                        size = (CRC_STREAM_SIZE - pos) < chunk ?
+                               (CRC_STREAM_SIZE - pos) : chunk;
+                        xwlib_crc32_update(&ctx, &stream[pos], size);
+                }
+                crc32 = xwlib_crc32_final(&ctx);
+                if (crc32 != expected) {
+                        crclogf(ERR, "CRC32(Streaming/%d):0x%X != 0x%X\n",
+                                chunk, crc32, expected);
+                        rc = -EIO;
+                }
+                xwlib_crc32_init_c(&ctx);
+                for (pos = 0; pos < CRC_STREAM_SIZE; pos += chunk) {
+                        size = (CRC_STREAM_SIZE - pos) < chunk ?
+                               (CRC_STREAM_SIZE - pos) : chunk;
+                        xwlib_crc32_update(&ctx, &stream[pos], size);
+                }
+                crc32 = xwlib_crc32_final(&ctx);
+                if (crc32 != expectedc) {
+                        crclogf(ERR, "CRC32C(Streaming/%d):0x%X != 0x%X\n",
+                                chunk, crc32, expectedc);
+                        rc = -EIO;
+                }
+        }
+        if (XWOK == rc) {
+                crclogf(INFO, "CRC32(Streaming): matches one-shot result.\n");
+        }
+        return rc;
+}
+
 /**
  * @brief 模块的加载函数
  */
 xwer_t xwos_example_crc(void)
 {
         xwu8_t data[] = {'X', 'u', 'a', 'n', 'W', 'u', 'O', 'S', '\0',};
+        struct xwlib_crc32_ctx crc32ctx;
         xwu32_t crc32;
+        xwu16_t crc16;
         xwu8_t crc8;
         xwsz_t size;
 
@@ -63,6 +128,36 @@ xwer_t xwos_example_crc(void)
                         data, &size);
         crclogf(INFO, "CRC32(JAMCRC):0x%X\n", crc32);
 
+        size = sizeof(data) - 1;
+        crc32 = xwlib_crc32c_calms(data, &size);
+        crclogf(INFO, "CRC32C:0x%X\n", crc32);
+
+        /* 分两段增量计算，结果与一次性计算相同 */
+        xwlib_crc32_init_ms(&crc32ctx);
+        xwlib_crc32_update(&crc32ctx, &data[0], 4);
+        xwlib_crc32_update(&crc32ctx, &data[4], sizeof(data) - 1 - 4);
+        crc32 = xwlib_crc32_final(&crc32ctx);
+        crclogf(INFO, "CRC32(Streaming):0x%X\n", crc32);
+        crc_check_streaming();
+
+        size = sizeof(data) - 1;
+        crc16 = xwlib_crc16_calccitt(data, &size);
+        crclogf(INFO, "CRC16(CCITT-FALSE):0x%X\n", crc16);
+
+        size = sizeof(data) - 1;
+        crc16 = xwlib_crc16_calxmodem(data, &size);
+        crclogf(INFO, "CRC16(XMODEM):0x%X\n", crc16);
+
+        size = sizeof(data) - 1;
+        crc16 = xwlib_crc16_calmodbus(data, &size);
+        crclogf(INFO, "CRC16(MODBUS):0x%X\n", crc16);
+
+        crc16 = 0x0;
+        size = sizeof(data) - 1;
+        xwlib_crc16_cal(&crc16, 0x0, true, true, 0x1021,
+                        data, &size);
+        crclogf(INFO, "CRC16(KERMIT):0x%X\n", crc16);
+
         size = sizeof(data) - 1;
         crc8 = xwlib_crc8_calms(data, &size);
         crclogf(INFO, "CRC8:0x%X\n", crc8);
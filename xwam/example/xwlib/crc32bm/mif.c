@@ -0,0 +1,167 @@
+/**
+ * @file
+ * @brief 示例：CRC32的性能测试
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ * @details
+ * 分别用以下方式计算不同长度的数据的CRC32，打印吞吐量，并检查结果是否一致：
+ * + 直驱表法：本示例中逐字节查表的实现，作为对比的基准；
+ * + 主流CRC32参数模型：`xwlib_crc32_calms()` ，
+ *   配置了 `ARCHCFG_LIB_CRC32` 时使用CPU的CRC32指令，否则使用分片查表法；
+ * + JAMCRC：按位镜像翻转输入的模型，会被转换为主流CRC32参数模型计算；
+ * + MPEG-2：多项式0x04C11DB7左移的模型，CPU的CRC32指令不支持，使用分片查表法。
+ *
+ * 数据长度分别对应一个短消息、一帧XWSSC的最大长度与一个Flash扇区。
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwlog.h>
+#include <xwos/lib/crc32.h>
+#include <xwos/osal/time.h>
+#include <xwam/example/xwlib/crc32bm/mif.h>
+
+#define LOGTAG "crc32bm"
+#define crcbmlogf(lv, fmt, ...) xwlogf(lv, LOGTAG, fmt, ##__VA_ARGS__)
+
+#define CRCBM_BUFSIZE           4096U
+#define CRCBM_TOTAL             (1024U * 1024U) /**< 每项测试计算的总字节数 */
+
+enum crcbm_engine_em {
+        CRCBM_ENGINE_DIRECT = 0,
+        CRCBM_ENGINE_MS,
+        CRCBM_ENGINE_JAMCRC,
+        CRCBM_ENGINE_MPEG2,
+        CRCBM_ENGINE_NUM,
+};
+
+const char * const crcbm_engine_name[CRCBM_ENGINE_NUM] = {
+        [CRCBM_ENGINE_DIRECT] = "直驱表法",
+        [CRCBM_ENGINE_MS] = "主流模型",
+        [CRCBM_ENGINE_JAMCRC] = "JAMCRC",
+        [CRCBM_ENGINE_MPEG2] = "MPEG-2",
+};
+
+const xwsz_t crcbm_size[] = {64U, 1024U, CRCBM_BUFSIZE};
+
+xwu8_t crcbm_buf[CRCBM_BUFSIZE];
+
+/**
+ * @brief 逐字节查表计算主流CRC32参数模型的校验值
+ */
+static
+xwu32_t crcbm_direct(const xwu8_t stream[], xwsz_t size)
+{
+        xwu32_t crc;
+        xwsz_t i;
+
+        crc = (xwu32_t)0xFFFFFFFF;
+        for (i = 0; i < size; i++) {
+                crc = xwlib_crc32tbl_0xedb88320[(crc ^ stream[i]) & (xwu32_t)0xFF] ^
+                      (crc >> 8);
+        }
+        return crc ^ (xwu32_t)0xFFFFFFFF;
+}
+
+/**
+ * @brief 用指定的方式计算一次校验值
+ */
+static
+xwu32_t crcbm_cal(xwsq_t engine, xwsz_t size)
+{
+        xwu32_t crc;
+        xwsz_t rest;
+
+        rest = size;
+        switch (engine) {
+        case CRCBM_ENGINE_MS:
+                crc = xwlib_crc32_calms(crcbm_buf, &rest);
+                break;
+        case CRCBM_ENGINE_JAMCRC:
+                crc = (xwu32_t)0xFFFFFFFF;
+                xwlib_crc32_cal(&crc, 0x0, true, true,
+                                0x04C11DB7, XWLIB_CRC32_LEFT_SHIFT,
+                                crcbm_buf, &rest);
+                break;
+        case CRCBM_ENGINE_MPEG2:
+                crc = (xwu32_t)0xFFFFFFFF;
+                xwlib_crc32_cal(&crc, 0x0, false, false,
+                                0x04C11DB7, XWLIB_CRC32_LEFT_SHIFT,
+                                crcbm_buf, &rest);
+                break;
+        default:
+                crc = crcbm_direct(crcbm_buf, size);
+                break;
+        }
+        return crc;
+}
+
+/**
+ * @brief 模块的加载函数
+ */
+xwer_t xwos_example_crc32bm(void)
+{
+        xwu32_t expected[xw_array_size(crcbm_size)];
+        xwu32_t crc;
+        xwu32_t seed;
+        xwtm_t start;
+        xwtm_t cost;
+        xwsz_t i;
+        xwsz_t n;
+        xwsz_t loop;
+        xwsq_t engine;
+        xwer_t rc;
+
+        seed = 1;
+        for (i = 0; i < CRCBM_BUFSIZE; i++) {
+                seed = (seed * (xwu32_t)1103515245) + (xwu32_t)12345;
+                crcbm_buf[i] = (xwu8_t)(seed >> 16);
+        }
+        for (n = 0; n < xw_array_size(crcbm_size); n++) {
+                expected[n] = crcbm_direct(crcbm_buf, crcbm_size[n]);
+        }
+
+        rc = XWOK;
+        for (engine = 0; engine < (xwsq_t)CRCBM_ENGINE_NUM; engine++) {
+                for (n = 0; n < xw_array_size(crcbm_size); n++) {
+                        crc = crcbm_cal(engine, crcbm_size[n]);
+                        /* JAMCRC没有与0xFFFFFFFF异或，MPEG-2的结果与其他模型不同，
+                           只检查前三者 */
+                        if (CRCBM_ENGINE_JAMCRC == engine) {
+                                crc ^= (xwu32_t)0xFFFFFFFF;
+                        }
+                        if ((CRCBM_ENGINE_MPEG2 != engine) && (crc != expected[n])) {
+                                crcbmlogf(ERR, "[%s] %d字节：结果错误 0x%X，应为 0x%X。\n",
+                                          crcbm_engine_name[engine], crcbm_size[n],
+                                          crc, expected[n]);
+                                rc = -EIO;
+                        }
+                        loop = CRCBM_TOTAL / crcbm_size[n];
+                        start = xwtm_now();
+                        for (i = 0; i < loop; i++) {
+                                crcbm_cal(engine, crcbm_size[n]);
+                        }
+                        cost = xwtm_now() - start;
+                        if (cost <= 0) {
+                                cost = 1;
+                        }
+                        crcbmlogf(INFO, "[%s] %d字节：%lld 纳秒/次，%lld 字节/秒。\n",
+                                  crcbm_engine_name[engine], crcbm_size[n],
+                                  cost / (xwtm_t)loop,
+                                  ((xwtm_t)CRCBM_TOTAL * XWTM_S(1)) / cost);
+                }
+        }
+        return rc;
+}
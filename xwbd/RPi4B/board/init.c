@@ -23,6 +23,10 @@
 #include <xwos/mm/mempool/allocator.h>
 #include <xwos/lib/xwaop.h>
 #include "board/xwac/xwds/device.h"
+#if defined(XWAMCFG_example_isc_xwicc) && (1 == XWAMCFG_example_isc_xwicc)
+#  include <xwcd/soc/arm64/v8a/arch_gic2.h>
+#  include <xwam/example/isc/xwicc/mif.h>
+#endif
 
 extern void * mempool_mr_origin[];
 
@@ -59,6 +63,9 @@ void xwos_preinit(void)
 
 /**
  * @brief XWOS后初始化
+ * @note
+ * + 每个CPU启动时都会调用此函数，SGI的中断向量是CPU私有的，
+ *   因此核间通道示例的门铃中断需要在此处为每个CPU注册。
  */
 __xwbsp_init_code
 void xwos_postinit(void)
@@ -66,4 +73,7 @@ void xwos_postinit(void)
         board_mm_init();
         rpi4bxwds_init();
         rpi4bxwds_uart_init();
+#if defined(XWAMCFG_example_isc_xwicc) && (1 == XWAMCFG_example_isc_xwicc)
+        armv8a_gic_irq_set_isr(ICCBM_IRQN, xwmd_example_xwicc_isr);
+#endif
 }
@@ -24,6 +24,9 @@
 #include <xwos/osal/thd.h>
 #include "board/xwac/xwds/device.h"
 #include "bm/ISocC/api.h"
+#if defined(XWAMCFG_example_isc_xwicc) && (1 == XWAMCFG_example_isc_xwicc)
+#  include <xwam/example/isc/xwicc/mif.h>
+#endif
 
 #define SOC_DBGF
 #include <soc_debug.h>
@@ -96,6 +99,14 @@ xwer_t xwos_main(void)
                 goto err_init_thd_create;
         }
 
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+        rc = xwlog_async_start();
+        if (rc < 0) {
+                soc_dbgf("Main", "Failed to start async log ... [%ld]\r\n", rc);
+                goto err_log_start;
+        }
+#endif
+
         rc = xwos_skd_start_lc();
         if (rc < 0) {
                 goto err_skd_start_lc;
@@ -103,6 +114,10 @@ xwer_t xwos_main(void)
 
         return XWOK;
 
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+err_log_start:
+        BOARD_BUG();
+#endif
 err_init_thd_create:
         BOARD_BUG();
 err_skd_start_lc:
@@ -115,9 +130,18 @@ xwer_t main_task(void * arg)
 {
         xwu64_t ms = 0;
         xwtm_t origin;
+#if defined(XWAMCFG_example_isc_xwicc) && (1 == XWAMCFG_example_isc_xwicc)
+        xwer_t rc;
+#endif
 
         XWOS_UNUSED(arg);
         isocc_init();
+#if defined(XWAMCFG_example_isc_xwicc) && (1 == XWAMCFG_example_isc_xwicc)
+        rc = xwmd_example_xwicc();
+        if (rc < 0) {
+                xwlogf(E, "XWOS.Main", "Failed to start xwicc example ... [%ld]\r\n", rc);
+        }
+#endif
         origin = xwtm_now();
         while (!xwos_cthd_shld_stop()) {
                 if (xwos_cthd_shld_frz()) {
@@ -33,6 +33,12 @@
 #define XWLIBCFG_LOG                                    1
 #define XWLIBCFG_XWLOG_LEVEL                            (0U)
 #define XWLIBCFG_XWLOG_BUFSIZE                          (256U)
+#define XWLIBCFG_XWLOG_ASYNC                            0
+#define XWLIBCFG_XWLOG_ASYNC_RINGSIZE                   (4096U)
+#define XWLIBCFG_XWLOG_ASYNC_RECSIZE                    (128U)
+#define XWLIBCFG_XWLOG_ASYNC_STACK_SIZE                 (4096U)
+#define XWLIBCFG_XWLOG_BIN                              0
+#define XWLIBCFG_XWLOG_BIN_RECSIZE                      (64U)
 
 #define XWLIBCFG_SC                                     0
 
@@ -47,6 +53,12 @@
 #define XWLIBCFG_CRC32                                  1
 #define XWLIBCFG_CRC32_0X04C11DB7                       1
 #define XWLIBCFG_CRC32_0XEDB88320                       1
+#define XWLIBCFG_CRC32_0X1EDC6F41                       0
+#define XWLIBCFG_CRC32_0X82F63B78                       1
+#define XWLIBCFG_CRC32_SLICE                            8U
+#define XWLIBCFG_CRC16                                  1
+#define XWLIBCFG_CRC16_0X1021                           1
+#define XWLIBCFG_CRC16_0X8005                           1
 #define XWLIBCFG_CRC8                                   1
 #define XWLIBCFG_CRC8_0X07                              1
 #define XWLIBCFG_CRC8_0X31                              1
@@ -68,6 +80,7 @@
 #define XWMMCFG_ED_STACK                                0
 #define XWMMCFG_FA_STACK                                0
 #define XWMMCFG_EA_STACK                                0
+#define XWMMCFG_STAT                                    1
 
 /******** memslice ********/
 #define XWMMCFG_MEMSLICE                                1
@@ -78,6 +91,11 @@
 /******** mempool ********/
 #define XWMMCFG_MEMPOOL                                 1
 
+/******** arena ********/
+#define XWMMCFG_ARENA                                   1
+#define XWMMCFG_ARENA_CTHD                              1
+#define XWMMCFG_ARENA_CTHD_DATA_POS                     (1U)
+
 /******** ******** ******** ******** ******** ******** ******** ********
  ******** ********          OS Configurations          ******** ********
  ******** ******** ******** ******** ******** ******** ******** ********/
@@ -97,6 +115,7 @@
 #define XWOSCFG_SKD_THD_MEMSLICE                        0
 #define XWOSCFG_SKD_THD_SMA                             0
 #define XWOSCFG_SKD_THD_STDC_MM                         1
+#define XWOSCFG_SKD_THD_POOL                            1 /* MP Only */
 #define XWOSCFG_SKD_THD_LOCAL_DATA_NUM                  (2U)
 #define XWOSCFG_SKD_THD_EXIT                            1
 #define XWOSCFG_SKD_THD_CXX                             1
@@ -106,6 +125,10 @@
 #define XWOSCFG_SKD_SWT_SMA                             0
 #define XWOSCFG_SKD_SWT_STDC_MM                         1
 #define XWOSCFG_SKD_SWT_CXX                             1
+#define XWOSCFG_SKD_WORKQ                               1 /* MP Only */
+#define XWOSCFG_SKD_WORKQ_PRIORITY                      (XWOSCFG_SKD_PRIORITY_RT_NUM - 2U)
+#define XWOSCFG_SKD_WORKQ_STACK_SIZE                    (4096U)
+#define XWOSCFG_SKD_WORKQ_CXX                           1
 
 /******** ******** ******** sync ******** ******** ********/
 #define XWOSCFG_SYNC_PLSEM                              1
@@ -129,6 +152,9 @@
 #define XWOSCFG_SYNC_EVT_SMA                            0
 #define XWOSCFG_SYNC_EVT_STDC_MM                        1
 #define XWOSCFG_SYNC_EVT_CXX                            1
+#define XWOSCFG_SYNC_BR_TREE                            1 /* MP Only */
+
+#define XWOSCFG_SYNC_AW                                 1 /* MP Only */
 
 /******** ******** ******** lock ******** ******** ********/
 #define XWOSCFG_LOCK_MTX                                1
@@ -65,6 +65,13 @@ xwer_t xwos_main(void)
 
         Rte_Init();
 
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+        rc = xwlog_async_start();
+        if (rc < 0) {
+                goto err_log_start;
+        }
+#endif
+
         rc = xwos_skd_start_lc();
         if (rc < 0) {
                 goto err_skd_start_lc;
@@ -73,6 +80,10 @@ xwer_t xwos_main(void)
 
 err_skd_start_lc:
         BOARD_BUG();
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+err_log_start:
+        BOARD_BUG();
+#endif
 err_thd_create:
         BOARD_BUG();
         return rc;
@@ -35,6 +35,7 @@
 
 /******** ******** CRC ******** ********/
 #define SOCCFG_CRC32                            1
+#define SOCCFG_CRC16                            1
 #define SOCCFG_CRC8                             1
 
 #endif /* cfg/soc.h */
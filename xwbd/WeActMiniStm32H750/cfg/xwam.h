@@ -25,6 +25,8 @@
 #define XWAMCFG_example_thd_new                 1
 #define XWAMCFG_example_thd_exit                1
 #define XWAMCFG_example_thd_sleep               1
+#define XWAMCFG_example_thd_pool                0
+#define XWAMCFG_example_coro                    0
 #define XWAMCFG_example_swt                     1
 #define XWAMCFG_example_lock_cpuirq             1
 #define XWAMCFG_example_lock_mtx                1
@@ -32,16 +34,23 @@
 #define XWAMCFG_example_lock_seqlock            1
 #define XWAMCFG_example_sync_sem                1
 #define XWAMCFG_example_sync_cond               1
+#define XWAMCFG_example_sync_cond_bcast         0
 #define XWAMCFG_example_sync_br                 1
 #define XWAMCFG_example_sync_flg                1
 #define XWAMCFG_example_sync_sel                1
 #define XWAMCFG_example_mm_sma                  1
 #define XWAMCFG_example_mm_memslice             1
 #define XWAMCFG_example_mm_bma                  1
+#define XWAMCFG_example_mm_arena                0
 #define XWAMCFG_example_xwlib_crc               1
+#define XWAMCFG_example_xwlib_crc32bm           0
 #define XWAMCFG_example_cxx                     1
 #define XWAMCFG_example_isc_xwmq                1
+#define XWAMCFG_example_isc_xwps                0
+#define XWAMCFG_example_isc_xwicc               0
+#define XWAMCFG_example_isc_xwssc               0
 #define XWAMCFG_example_isc_xwcq                1
+#define XWAMCFG_example_isc_xwcq_spsc           0
 
 #define XWAMCFG_application_w25qpt              1
 #define XWAMCFG_application_ramcode             0
@@ -36,6 +36,9 @@
 #define XWMDCFG_isc_xwssc_PRI_NUM                               (4U)
 #define XWMDCFG_isc_xwssc_RETRY_PERIOD                          (XWTM_MS(1000))
 #define XWMDCFG_isc_xwssc_RETRY_NUM                             (8U)
+#define XWMDCFG_isc_xwssc_WND_SIZE                              (8U)
+#define XWMDCFG_isc_xwssc_RXBUF_SIZE                            (256U)
+#define XWMDCFG_isc_xwssc_COMPRESS                              0
 #define XWMDCFG_isc_xwssc_MEMBLK_SIZE                           (64U)
 #define XWMDCFG_isc_xwssc_MEMBLK_ODR                            (6U)
 #define XWMDCFG_isc_xwssc_RXTHD_PRIORITY                        \
@@ -47,9 +50,23 @@
 /******** ******** Message Queue ******** ********/
 #define XWMDCFG_isc_xwmq                                        1
 
+/******** ******** Publish/Subscribe ******** ********/
+#define XWMDCFG_isc_xwps                                        1
+#define XWMDCFG_isc_xwps_SUB_NUM                                (32U)
+#define XWMDCFG_isc_xwps_HASH_NUM                               (16U)
+
+/******** ******** Inter-Core Channel ******** ********/
+#define XWMDCFG_isc_xwicc                                       0
+
 /******** ******** Circular Queue ******** ********/
 #define XWMDCFG_isc_xwcq                                        1
 #define XWMDCFG_isc_xwcq_CXX                                    1
+#define XWMDCFG_isc_xwcq_SPSC                                   1
+
+/******** ******** ******** ******** ******** ******** ******** ********
+ ******** ********         Stackless Coroutine         ******** ********
+ ******** ******** ******** ******** ******** ******** ******** ********/
+#define XWMDCFG_coro                                            1
 
 /******** ******** ******** ******** ******** ******** ******** ********
  ******** ********      AUTOSAR classical Platform     ******** ********
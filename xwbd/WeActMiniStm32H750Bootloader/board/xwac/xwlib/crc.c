@@ -1,6 +1,6 @@
 /**
  * @file
- * @brief 板级描述层：XWOS适配层：库：CRC32
+ * @brief 板级描述层：XWOS适配层：库：CRC
  * @author
  * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
  * @copyright
@@ -21,6 +21,7 @@
 #include "board/std.h"
 #include <xwos/lib/xwbop.h>
 #include <xwos/lib/crc32.h>
+#include <xwos/lib/crc16.h>
 #include <xwos/osal/skd.h>
 #include <xwos/osal/lock/spinlock.h>
 #include <xwos/osal/lock/mtx.h>
@@ -119,15 +120,17 @@ xwer_t soc_crc32_cal(xwu32_t * crc32,
         seg = *crc32;
         LL_AHB4_GRP1_EnableClock(LL_AHB4_GRP1_PERIPH_CRC);
         LL_CRC_SetPolynomialSize(CRC, LL_CRC_POLYLENGTH_32B);
-        LL_CRC_SetInitialData(CRC, seg);
-        /* STM32H7的CRC单元是左移模式，右移模式需要对参数进行镜像转换 */
+        /* STM32H7的CRC单元是左移模式，右移模式需要对参数进行镜像转换，
+           包括初始值：续算时的初始值是上一段的余数，不一定是镜像对称的 */
         if (XWLIB_CRC32_RIGHT_SHIFT == direction) {
                 polynomial = xwbop_rbit32(polynomial);
+                seg = xwbop_rbit32(seg);
                 refin = !refin;
                 refout = true;
         } else {
                 refout = false;
         }
+        LL_CRC_SetInitialData(CRC, seg);
         if (refin) {
                 LL_CRC_SetInputDataReverseMode(CRC, LL_CRC_INDATA_REVERSE_BYTE);
         } else {
@@ -182,6 +185,84 @@ err_crc_lock:
         return rc;
 }
 
+/**
+ * @brief 使用STM32的CRC硬件单元计算数据的CRC16校验值
+ * @param[in,out] crc16: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示初始值
+ * + (O) 作为输出时，返回计算结果
+ * @param[in] refin: 是否颠倒每个字节中的位的顺序
+ * @param[in] polynomial: 多项式
+ * @param[in] stream: 数据缓冲区
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @return 错误码
+ * @retval XWOK: 计算结果有效
+ * @retval -EOPNOTSUPP: 计算失败
+ * @details
+ * 先按32位写入数据寄存器，不足4字节的尾部再按8位写入。
+ */
+xwer_t soc_crc16_cal(xwu16_t * crc16,
+                     bool refin, xwu16_t polynomial,
+                     const xwu8_t stream[], xwsz_t * size)
+{
+        xwsz_t rest;
+        xwsz_t pos;
+        xwu32_t seg;
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        rc = xwlibac_crc_lock(&cpuirq);
+        if (rc < 0) {
+                goto err_crc_lock;
+        }
+
+        rest = *size;
+        pos = 0;
+        seg = (xwu32_t)*crc16;
+        LL_AHB4_GRP1_EnableClock(LL_AHB4_GRP1_PERIPH_CRC);
+        LL_CRC_SetPolynomialSize(CRC, LL_CRC_POLYLENGTH_16B);
+        LL_CRC_SetInitialData(CRC, seg);
+        if (refin) {
+                LL_CRC_SetInputDataReverseMode(CRC, LL_CRC_INDATA_REVERSE_BYTE);
+        } else {
+                LL_CRC_SetInputDataReverseMode(CRC, LL_CRC_INDATA_REVERSE_NONE);
+        }
+        LL_CRC_SetOutputDataReverseMode(CRC, LL_CRC_OUTDATA_REVERSE_NONE);
+        LL_CRC_SetPolynomialCoef(CRC, (xwu32_t)polynomial);
+        LL_CRC_ResetCRCCalculationUnit(CRC);
+        /* CRC硬件单元从数据寄存器的最高有效字节开始处理数据，
+           按大端顺序拼接，同时避免非对齐访问 */
+        while (rest >= sizeof(xwu32_t)) {
+                seg = (xwu32_t)stream[pos] << 24U;
+                seg |= (xwu32_t)stream[pos + 1] << 16U;
+                seg |= (xwu32_t)stream[pos + 2] << 8U;
+                seg |= (xwu32_t)stream[pos + 3];
+                LL_CRC_FeedData32(CRC, seg);
+                rest -= sizeof(xwu32_t);
+                pos += sizeof(xwu32_t);
+        }
+        while (rest >= sizeof(xwu8_t)) {
+                LL_CRC_FeedData8(CRC, stream[pos]);
+                rest -= sizeof(xwu8_t);
+                pos += sizeof(xwu8_t);
+        }
+        if (pos > 0) {
+                seg = (xwu32_t)LL_CRC_ReadData16(CRC);
+                rc = XWOK;
+        } else {
+                seg = (xwu32_t)*crc16;
+                rc = -EOPNOTSUPP;
+        }
+        LL_AHB4_GRP1_DisableClock(LL_AHB4_GRP1_PERIPH_CRC);
+        *size = rest;
+        *crc16 = (xwu16_t)seg;
+
+        xwlibac_crc_unlock(cpuirq);
+err_crc_lock:
+        return rc;
+}
+
 /**
  * @brief 使用STM32的CRC硬件单元计算数据的CRC8校验值
  * @param[in,out] crc8: 指向缓冲区的指针，此缓冲区：
@@ -77,6 +77,9 @@
 #define ARCHCFG_LIB_XWAOP64                     1
 #define ARCHCFG_LIB_XWBMPAOP                    1
 
+/******** crc ********/
+#define ARCHCFG_LIB_CRC32                       0
+
 /******** ******** ******** ******** ******** ******** ******** ********
  ******** ********         default configures          ******** ********
  ******** ******** ******** ******** ******** ******** ******** ********/
@@ -25,6 +25,8 @@
 #define XWAMCFG_example_thd_new                 0
 #define XWAMCFG_example_thd_exit                0
 #define XWAMCFG_example_thd_sleep               0
+#define XWAMCFG_example_thd_pool                0
+#define XWAMCFG_example_coro                    0
 #define XWAMCFG_example_swt                     0
 #define XWAMCFG_example_lock_cpuirq             0
 #define XWAMCFG_example_lock_mtx                0
@@ -32,16 +34,23 @@
 #define XWAMCFG_example_lock_seqlock            0
 #define XWAMCFG_example_sync_sem                0
 #define XWAMCFG_example_sync_cond               0
+#define XWAMCFG_example_sync_cond_bcast         0
 #define XWAMCFG_example_sync_br                 0
 #define XWAMCFG_example_sync_flg                0
 #define XWAMCFG_example_sync_sel                0
 #define XWAMCFG_example_mm_sma                  0
 #define XWAMCFG_example_mm_memslice             0
 #define XWAMCFG_example_mm_bma                  0
+#define XWAMCFG_example_mm_arena                0
 #define XWAMCFG_example_xwlib_crc               0
+#define XWAMCFG_example_xwlib_crc32bm           0
 #define XWAMCFG_example_cxx                     0
 #define XWAMCFG_example_isc_xwmq                0
+#define XWAMCFG_example_isc_xwps                0
+#define XWAMCFG_example_isc_xwicc               0
+#define XWAMCFG_example_isc_xwssc               0
 #define XWAMCFG_example_isc_xwcq                0
+#define XWAMCFG_example_isc_xwcq_spsc           0
 
 #define XWAMCFG_application_w25qpt              0
 #define XWAMCFG_application_ramcode             1
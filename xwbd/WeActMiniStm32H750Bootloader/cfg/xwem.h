@@ -27,6 +27,9 @@
 #define XWEMCFG_fs_spiffs                               0
 #define XWEMCFG_fs_dhara                                0
 
+#define XWEMCFG_compress_xwlz                           0
+#define XWEMCFG_compress_xwlz_HTBL_ODR                  (10U)
+
 #define XWEMCFG_vm_lua                                  0
 #define XWEMCFG_vm_lua_INT_TYPE                         LUA_INT_LONG
 #define XWEMCFG_vm_lua_FLOAT_TYPE                       LUA_FLOAT_DOUBLE
@@ -0,0 +1,338 @@
+#! /usr/bin/python3
+# -*- coding:utf-8 -*-
+# @file
+# @brief 将二进制日志还原为文本
+# @author
+# + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+# @copyright
+# + Copyright © 2015 xwos.tech, All Rights Reserved.
+# > Licensed under the Apache License, Version 2.0 (the "License");
+# > you may not use this file except in compliance with the License.
+# > You may obtain a copy of the License at
+# >
+# >         http://www.apache.org/licenses/LICENSE-2.0
+# >
+# > Unless required by applicable law or agreed to in writing, software
+# > distributed under the License is distributed on an "AS IS" BASIS,
+# > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# > See the License for the specific language governing permissions and
+# > limitations under the License.
+#
+# 打开配置 `XWLIBCFG_XWLOG_BIN` 后，`xwlogf()` 只输出字典中字符串的编号与参数，
+# 格式字符串保存在ELF文件的 `.xwlog.dict` 段中。数据格式参考 `xwos/lib/xwlog.h` 。
+#
+# 用法：
+#
+# + 串口：xwlogdec.py -e XWOS.elf -i /dev/ttyUSB0 -b 115200
+# + 文件：xwlogdec.py -e XWOS.elf -i log.bin
+# + XWSSC：每条消息为一批记录，每行一条消息的十六进制，
+#   xwlogdec.py -e XWOS.elf -f hex -i msgs.txt
+#
+
+import sys
+import argparse
+import re
+import struct
+
+LEVELS = "VDINWECAG"
+LV_TEXT = 15
+
+ARG_SINT = 0
+ARG_UINT = 1
+ARG_DBL = 2
+ARG_STR = 3
+ARG_PTR = 4
+
+SPEC_RE = re.compile(r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?"
+                     r"(?:\.(?P<prec>\*|\d*))?"
+                     r"(?P<len>hh|h|ll|l|z|j|t|L)?(?P<conv>[diouxXcpfFeEgGaAsn%])")
+
+def parse_arg():
+    parser = argparse.ArgumentParser(description="Decode XWOS binary log records.")
+    parser.add_argument("-e", "--elf", action="store",
+                        dest="elf", required=True,
+                        help="Set ELF file containing the .xwlog.dict section")
+    parser.add_argument("-i", "--input", action="store",
+                        dest="input", default="-",
+                        help="Set input file or serial device, default is stdin")
+    parser.add_argument("-f", "--format", action="store",
+                        dest="format", default="cobs",
+                        choices=["cobs", "raw", "hex"],
+                        help="Set input format: COBS frames (UART), "
+                             "one raw batch, or one hex batch per line (XWSSC)")
+    parser.add_argument("-b", "--baud", action="store", type=int,
+                        dest="baud", default=0,
+                        help="Open input as a serial device with this baudrate (needs pyserial)")
+    return parser
+
+class Elf:
+    """从ELF文件中读取字典"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[0:4] != b"\x7fELF":
+            raise ValueError("%s: not an ELF file" % path)
+        self.is64 = (data[4] == 2)
+        self.endian = "<" if data[5] == 1 else ">"
+        self.long_bits = 64 if self.is64 else 32
+        if self.is64:
+            shoff, = struct.unpack_from(self.endian + "Q", data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", data, 0x3A)
+        else:
+            shoff, = struct.unpack_from(self.endian + "I", data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from(self.endian + "HHH", data, 0x2E)
+        sections = []
+        for i in range(shnum):
+            off = shoff + i * shentsize
+            if self.is64:
+                name, stype, _flags, addr, offset, size = \
+                    struct.unpack_from(self.endian + "IIQQQQ", data, off)
+            else:
+                name, stype, _flags, addr, offset, size = \
+                    struct.unpack_from(self.endian + "IIIIII", data, off)
+            sections.append((name, stype, addr, offset, size))
+        strtab = sections[shstrndx]
+        self.dict = None
+        self.dict_addr = 0
+        for name, stype, addr, offset, size in sections:
+            end = data.index(b"\0", strtab[3] + name)
+            if data[strtab[3] + name:end] == b".xwlog.dict":
+                self.dict = data[offset:offset + size]
+                self.dict_addr = addr
+                break
+        if self.dict is None:
+            raise ValueError("%s: no .xwlog.dict section" % path)
+
+    def lookup(self, sid):
+        off = sid - 1 - self.dict_addr
+        if off < 0 or off >= len(self.dict):
+            return None
+        end = self.dict.find(b"\0", off)
+        if end < 0:
+            end = len(self.dict)
+        return self.dict[off:end].decode("utf-8", "replace")
+
+class Reader:
+    """逐个读取记录中的字段"""
+
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def left(self):
+        return len(self.data) - self.pos
+
+    def byte(self):
+        if self.pos >= len(self.data):
+            raise EOFError()
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def varint(self):
+        v = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            v |= (b & 0x7F) << shift
+            shift += 7
+            if (b & 0x80) == 0:
+                return v
+
+    def zigzag(self):
+        v = self.varint()
+        return (v >> 1) ^ -(v & 1)
+
+    def bytes(self, n):
+        if n > self.left():
+            raise EOFError()
+        b = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return b
+
+def len_bits(length, long_bits):
+    if length == "hh":
+        return 8
+    if length == "h":
+        return 16
+    if length in ("l", "z", "t"):
+        return long_bits
+    if length in ("ll", "j"):
+        return 64
+    return 32
+
+def c_format(fmt, args, long_bits):
+    """按C语言的格式字符串格式化参数，缺少的参数输出为 `<?>`"""
+    out = []
+    pos = 0
+    it = iter(args)
+    def nxt():
+        try:
+            return next(it)
+        except StopIteration:
+            return None
+    for m in SPEC_RE.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        conv = m.group("conv")
+        if conv == "%":
+            out.append("%")
+            continue
+        flags = m.group("flags")
+        width = m.group("width") or ""
+        prec = m.group("prec")
+        if width == "*":
+            w = nxt()
+            width = str(w) if isinstance(w, int) else ""
+        if prec == "*":
+            p = nxt()
+            prec = str(p) if isinstance(p, int) else None
+        spec = "%" + flags + width + ("." + (prec or "0") if prec is not None else "")
+        if conv == "n":
+            nxt()
+            continue
+        v = nxt()
+        if v is None:
+            out.append("<?>")
+            continue
+        bits = len_bits(m.group("len"), long_bits)
+        try:
+            if conv in "di":
+                if isinstance(v, int):
+                    v &= (1 << bits) - 1
+                    if v >= (1 << (bits - 1)):
+                        v -= (1 << bits)
+                out.append((spec + "d") % v)
+            elif conv in "uoxX":
+                if isinstance(v, int):
+                    v &= (1 << bits) - 1
+                if conv == "u":
+                    out.append((spec + "d") % v)
+                elif conv == "o" and "#" in flags:
+                    out.append((spec.replace("#", "") + "s") % (("0%o" % v) if v else "0"))
+                else:
+                    out.append((spec + conv) % v)
+            elif conv == "c":
+                out.append((spec + "c") % chr(v & 0xFF))
+            elif conv == "p":
+                out.append((spec.split(".")[0] + "s") % ("0x%x" % v))
+            elif conv in "aA":
+                s = float(v).hex()
+                out.append((spec.split(".")[0] + "s") % (s.upper() if conv == "A" else s))
+            elif conv in "fFeEgG":
+                out.append((spec + conv) % float(v))
+            else:
+                out.append((spec + "s") % v)
+        except (TypeError, ValueError):
+            out.append("<%s?>" % conv)
+    out.append(fmt[pos:])
+    return "".join(out)
+
+def decode_record(elf, body):
+    """解码一条记录的内容，返回文本"""
+    rd = Reader(body)
+    sid = rd.varint()
+    lvn = rd.byte()
+    lv = lvn >> 4
+    nargs = lvn & 0xF
+    tagbytes = rd.bytes((nargs + 1) // 2)
+    args = []
+    try:
+        for i in range(nargs):
+            t = (tagbytes[i // 2] >> ((i & 1) * 4)) & 0xF
+            if t == ARG_SINT:
+                args.append(rd.zigzag())
+            elif t in (ARG_UINT, ARG_PTR):
+                args.append(rd.varint())
+            elif t == ARG_DBL:
+                args.append(struct.unpack("<d", rd.bytes(8))[0])
+            elif t == ARG_STR:
+                args.append(rd.bytes(rd.varint()).decode("utf-8", "replace"))
+            else:
+                break
+    except EOFError:
+        # 记录的缓冲区不足时，后面的参数被截断
+        pass
+    if sid == 0:
+        return args[0] if args else ""
+    fmt = elf.lookup(sid)
+    if fmt is None:
+        return "?|<unknown id 0x%x> %r\n" % (sid, args)
+    lvc = LEVELS[lv] if lv < len(LEVELS) else "?"
+    return lvc + "|" + c_format(fmt, args, elf.long_bits)
+
+def decode_batch(elf, batch, out):
+    """解码一批记录"""
+    rd = Reader(batch)
+    us = 0
+    try:
+        while rd.left() > 0:
+            size = rd.varint()
+            rec = Reader(rd.bytes(size))
+            us += rec.zigzag()
+            text = decode_record(elf, rec.data[rec.pos:])
+            out.write("[%6d.%06d] %s" % (us // 1000000, us % 1000000, text))
+            if not text.endswith("\n"):
+                out.write("\n")
+    except (EOFError, IndexError):
+        sys.stderr.write("xwlogdec: truncated batch\n")
+    out.flush()
+
+def cobs_decode(frame):
+    out = bytearray()
+    pos = 0
+    while pos < len(frame):
+        code = frame[pos]
+        if code == 0 or pos + code > len(frame):
+            raise ValueError("bad COBS frame")
+        out += frame[pos + 1:pos + code]
+        pos += code
+        if code < 0xFF and pos < len(frame):
+            out.append(0)
+    return bytes(out)
+
+def open_input(args):
+    if args.baud > 0:
+        import serial
+        return serial.Serial(args.input, args.baud)
+    if args.input == "-":
+        return sys.stdin if args.format == "hex" else sys.stdin.buffer
+    return open(args.input, "r" if args.format == "hex" else "rb")
+
+def main():
+    parser = parse_arg()
+    args = parser.parse_args()
+    elf = Elf(args.elf)
+    inp = open_input(args)
+    out = sys.stdout
+
+    if args.format == "hex":
+        for line in inp:
+            line = line.strip()
+            if line:
+                decode_batch(elf, bytes.fromhex(line), out)
+    elif args.format == "raw":
+        decode_batch(elf, inp.read(), out)
+    else:
+        buf = bytearray()
+        while True:
+            chunk = inp.read(1) if args.baud > 0 else inp.read(4096)
+            if not chunk:
+                break
+            buf += chunk
+            while True:
+                end = buf.find(b"\0")
+                if end < 0:
+                    break
+                frame = bytes(buf[:end])
+                del buf[:end + 1]
+                if not frame:
+                    continue
+                try:
+                    decode_batch(elf, cobs_decode(frame), out)
+                except ValueError as e:
+                    sys.stderr.write("xwlogdec: %s\n" % e)
+
+if __name__ == "__main__":
+    main()
@@ -51,3 +51,9 @@ xwer_t xwospl_irq_restore(xwirq_t irqn, xwreg_t flag)
 {
         return armv8a_gic_irq_restore(irqn, flag);
 }
+
+__xwbsp_code
+xwer_t xwospl_irq_ipi(xwirq_t irqn, xwid_t cpuid)
+{
+        return armv8a_gic_sgi_send(irqn, (xwu8_t)((xwu8_t)1 << (xwu8_t)cpuid));
+}
@@ -19,10 +19,10 @@
 #
 
 CPU_INCDIRS :=
-CPU_CFLAGS := -march=armv8-a -mcpu=cortex-a72
-CPU_CXXFLAGS := -march=armv8-a -mcpu=cortex-a72
-CPU_AFLAGS := -march=armv8-a -mcpu=cortex-a72
-CPU_LDFLAGS := -march=armv8-a -mcpu=cortex-a72
+CPU_CFLAGS := -march=armv8-a+crc -mcpu=cortex-a72
+CPU_CXXFLAGS := -march=armv8-a+crc -mcpu=cortex-a72
+CPU_AFLAGS := -march=armv8-a+crc -mcpu=cortex-a72
+CPU_LDFLAGS := -march=armv8-a+crc -mcpu=cortex-a72
 
 CPU_ASRCS :=
 CPU_CSRCS :=
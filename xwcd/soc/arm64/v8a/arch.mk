@@ -42,6 +42,9 @@ ARCH_CSRCS += xwosimpl_soc_xwaop/s64.c
 ARCH_CSRCS += xwosimpl_soc_xwaop/u64.c
 ARCH_CSRCS += xwosimpl_soc_xwaop/bmp.c
 ARCH_CSRCS += xwosimpl_soc_xwbop.c
+ifeq ($(ARCHCFG_LIB_CRC32),y)
+  ARCH_CSRCS += arch_crc32.c
+endif
 ARCH_CSRCS += xwosimpl_soc_lfq.c
 ARCH_CSRCS += xwosimpl_tls.c
 ARCH_CSRCS += arch_init.c
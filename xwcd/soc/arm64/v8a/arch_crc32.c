@@ -0,0 +1,780 @@
+/**
+ * @file
+ * @brief 架构描述层：ARMv8A CRC32指令
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#include <xwos/standard.h>
+#include <string.h>
+#include <xwos/lib/crc32.h>
+
+/**
+ * @brief 交织计算时每一路数据的长度
+ * @details
+ * 长数据被分成连续的三路，三路的CRC32指令互不依赖，可以填满CRC32指令的流水线，
+ * 最后通过后移查询表将三路的结果合并。
+ */
+#define ARMV8A_CRC32_BLKSIZE    (256U)
+
+/**
+ * @brief 多项式0xEDB88320的余数后移 `ARMV8A_CRC32_BLKSIZE` 个0字节的查询表
+ * @details
+ * 余数的计算对于GF(2)是线性的，第k行是余数中第k个字节的贡献，
+ * 四行查表结果异或即为余数后移 `ARMV8A_CRC32_BLKSIZE` 个0字节之后的值。
+ */
+static __xwbsp_rodata
+const xwu32_t armv8a_crc32_shifttbl[4][256] = {
+        [0] = {
+                0x00000000, 0xCE3371CB, 0x4717E5D7, 0x8924941C,
+                0x8E2FCBAE, 0x401CBA65, 0xC9382E79, 0x070B5FB2,
+                0xC72E911D, 0x091DE0D6, 0x803974CA, 0x4E0A0501,
+                0x49015AB3, 0x87322B78, 0x0E16BF64, 0xC025CEAF,
+                0x552C247B, 0x9B1F55B0, 0x123BC1AC, 0xDC08B067,
+                0xDB03EFD5, 0x15309E1E, 0x9C140A02, 0x52277BC9,
+                0x9202B566, 0x5C31C4AD, 0xD51550B1, 0x1B26217A,
+                0x1C2D7EC8, 0xD21E0F03, 0x5B3A9B1F, 0x9509EAD4,
+                0xAA5848F6, 0x646B393D, 0xED4FAD21, 0x237CDCEA,
+                0x24778358, 0xEA44F293, 0x6360668F, 0xAD531744,
+                0x6D76D9EB, 0xA345A820, 0x2A613C3C, 0xE4524DF7,
+                0xE3591245, 0x2D6A638E, 0xA44EF792, 0x6A7D8659,
+                0xFF746C8D, 0x31471D46, 0xB863895A, 0x7650F891,
+                0x715BA723, 0xBF68D6E8, 0x364C42F4, 0xF87F333F,
+                0x385AFD90, 0xF6698C5B, 0x7F4D1847, 0xB17E698C,
+                0xB675363E, 0x784647F5, 0xF162D3E9, 0x3F51A222,
+                0x8FC197AD, 0x41F2E666, 0xC8D6727A, 0x06E503B1,
+                0x01EE5C03, 0xCFDD2DC8, 0x46F9B9D4, 0x88CAC81F,
+                0x48EF06B0, 0x86DC777B, 0x0FF8E367, 0xC1CB92AC,
+                0xC6C0CD1E, 0x08F3BCD5, 0x81D728C9, 0x4FE45902,
+                0xDAEDB3D6, 0x14DEC21D, 0x9DFA5601, 0x53C927CA,
+                0x54C27878, 0x9AF109B3, 0x13D59DAF, 0xDDE6EC64,
+                0x1DC322CB, 0xD3F05300, 0x5AD4C71C, 0x94E7B6D7,
+                0x93ECE965, 0x5DDF98AE, 0xD4FB0CB2, 0x1AC87D79,
+                0x2599DF5B, 0xEBAAAE90, 0x628E3A8C, 0xACBD4B47,
+                0xABB614F5, 0x6585653E, 0xECA1F122, 0x229280E9,
+                0xE2B74E46, 0x2C843F8D, 0xA5A0AB91, 0x6B93DA5A,
+                0x6C9885E8, 0xA2ABF423, 0x2B8F603F, 0xE5BC11F4,
+                0x70B5FB20, 0xBE868AEB, 0x37A21EF7, 0xF9916F3C,
+                0xFE9A308E, 0x30A94145, 0xB98DD559, 0x77BEA492,
+                0xB79B6A3D, 0x79A81BF6, 0xF08C8FEA, 0x3EBFFE21,
+                0x39B4A193, 0xF787D058, 0x7EA34444, 0xB090358F,
+                0xC4F2291B, 0x0AC158D0, 0x83E5CCCC, 0x4DD6BD07,
+                0x4ADDE2B5, 0x84EE937E, 0x0DCA0762, 0xC3F976A9,
+                0x03DCB806, 0xCDEFC9CD, 0x44CB5DD1, 0x8AF82C1A,
+                0x8DF373A8, 0x43C00263, 0xCAE4967F, 0x04D7E7B4,
+                0x91DE0D60, 0x5FED7CAB, 0xD6C9E8B7, 0x18FA997C,
+                0x1FF1C6CE, 0xD1C2B705, 0x58E62319, 0x96D552D2,
+                0x56F09C7D, 0x98C3EDB6, 0x11E779AA, 0xDFD40861,
+                0xD8DF57D3, 0x16EC2618, 0x9FC8B204, 0x51FBC3CF,
+                0x6EAA61ED, 0xA0991026, 0x29BD843A, 0xE78EF5F1,
+                0xE085AA43, 0x2EB6DB88, 0xA7924F94, 0x69A13E5F,
+                0xA984F0F0, 0x67B7813B, 0xEE931527, 0x20A064EC,
+                0x27AB3B5E, 0xE9984A95, 0x60BCDE89, 0xAE8FAF42,
+                0x3B864596, 0xF5B5345D, 0x7C91A041, 0xB2A2D18A,
+                0xB5A98E38, 0x7B9AFFF3, 0xF2BE6BEF, 0x3C8D1A24,
+                0xFCA8D48B, 0x329BA540, 0xBBBF315C, 0x758C4097,
+                0x72871F25, 0xBCB46EEE, 0x3590FAF2, 0xFBA38B39,
+                0x4B33BEB6, 0x8500CF7D, 0x0C245B61, 0xC2172AAA,
+                0xC51C7518, 0x0B2F04D3, 0x820B90CF, 0x4C38E104,
+                0x8C1D2FAB, 0x422E5E60, 0xCB0ACA7C, 0x0539BBB7,
+                0x0232E405, 0xCC0195CE, 0x452501D2, 0x8B167019,
+                0x1E1F9ACD, 0xD02CEB06, 0x59087F1A, 0x973B0ED1,
+                0x90305163, 0x5E0320A8, 0xD727B4B4, 0x1914C57F,
+                0xD9310BD0, 0x17027A1B, 0x9E26EE07, 0x50159FCC,
+                0x571EC07E, 0x992DB1B5, 0x100925A9, 0xDE3A5462,
+                0xE16BF640, 0x2F58878B, 0xA67C1397, 0x684F625C,
+                0x6F443DEE, 0xA1774C25, 0x2853D839, 0xE660A9F2,
+                0x2645675D, 0xE8761696, 0x6152828A, 0xAF61F341,
+                0xA86AACF3, 0x6659DD38, 0xEF7D4924, 0x214E38EF,
+                0xB447D23B, 0x7A74A3F0, 0xF35037EC, 0x3D634627,
+                0x3A681995, 0xF45B685E, 0x7D7FFC42, 0xB34C8D89,
+                0x73694326, 0xBD5A32ED, 0x347EA6F1, 0xFA4DD73A,
+                0xFD468888, 0x3375F943, 0xBA516D5F, 0x74621C94,
+        },
+        [1] = {
+                0x00000000, 0x52955477, 0xA52AA8EE, 0xF7BFFC99,
+                0x9124579D, 0xC3B103EA, 0x340EFF73, 0x669BAB04,
+                0xF939A97B, 0xABACFD0C, 0x5C130195, 0x0E8655E2,
+                0x681DFEE6, 0x3A88AA91, 0xCD375608, 0x9FA2027F,
+                0x290254B7, 0x7B9700C0, 0x8C28FC59, 0xDEBDA82E,
+                0xB826032A, 0xEAB3575D, 0x1D0CABC4, 0x4F99FFB3,
+                0xD03BFDCC, 0x82AEA9BB, 0x75115522, 0x27840155,
+                0x411FAA51, 0x138AFE26, 0xE43502BF, 0xB6A056C8,
+                0x5204A96E, 0x0091FD19, 0xF72E0180, 0xA5BB55F7,
+                0xC320FEF3, 0x91B5AA84, 0x660A561D, 0x349F026A,
+                0xAB3D0015, 0xF9A85462, 0x0E17A8FB, 0x5C82FC8C,
+                0x3A195788, 0x688C03FF, 0x9F33FF66, 0xCDA6AB11,
+                0x7B06FDD9, 0x2993A9AE, 0xDE2C5537, 0x8CB90140,
+                0xEA22AA44, 0xB8B7FE33, 0x4F0802AA, 0x1D9D56DD,
+                0x823F54A2, 0xD0AA00D5, 0x2715FC4C, 0x7580A83B,
+                0x131B033F, 0x418E5748, 0xB631ABD1, 0xE4A4FFA6,
+                0xA40952DC, 0xF69C06AB, 0x0123FA32, 0x53B6AE45,
+                0x352D0541, 0x67B85136, 0x9007ADAF, 0xC292F9D8,
+                0x5D30FBA7, 0x0FA5AFD0, 0xF81A5349, 0xAA8F073E,
+                0xCC14AC3A, 0x9E81F84D, 0x693E04D4, 0x3BAB50A3,
+                0x8D0B066B, 0xDF9E521C, 0x2821AE85, 0x7AB4FAF2,
+                0x1C2F51F6, 0x4EBA0581, 0xB905F918, 0xEB90AD6F,
+                0x7432AF10, 0x26A7FB67, 0xD11807FE, 0x838D5389,
+                0xE516F88D, 0xB783ACFA, 0x403C5063, 0x12A90414,
+                0xF60DFBB2, 0xA498AFC5, 0x5327535C, 0x01B2072B,
+                0x6729AC2F, 0x35BCF858, 0xC20304C1, 0x909650B6,
+                0x0F3452C9, 0x5DA106BE, 0xAA1EFA27, 0xF88BAE50,
+                0x9E100554, 0xCC855123, 0x3B3AADBA, 0x69AFF9CD,
+                0xDF0FAF05, 0x8D9AFB72, 0x7A2507EB, 0x28B0539C,
+                0x4E2BF898, 0x1CBEACEF, 0xEB015076, 0xB9940401,
+                0x2636067E, 0x74A35209, 0x831CAE90, 0xD189FAE7,
+                0xB71251E3, 0xE5870594, 0x1238F90D, 0x40ADAD7A,
+                0x9363A3F9, 0xC1F6F78E, 0x36490B17, 0x64DC5F60,
+                0x0247F464, 0x50D2A013, 0xA76D5C8A, 0xF5F808FD,
+                0x6A5A0A82, 0x38CF5EF5, 0xCF70A26C, 0x9DE5F61B,
+                0xFB7E5D1F, 0xA9EB0968, 0x5E54F5F1, 0x0CC1A186,
+                0xBA61F74E, 0xE8F4A339, 0x1F4B5FA0, 0x4DDE0BD7,
+                0x2B45A0D3, 0x79D0F4A4, 0x8E6F083D, 0xDCFA5C4A,
+                0x43585E35, 0x11CD0A42, 0xE672F6DB, 0xB4E7A2AC,
+                0xD27C09A8, 0x80E95DDF, 0x7756A146, 0x25C3F531,
+                0xC1670A97, 0x93F25EE0, 0x644DA279, 0x36D8F60E,
+                0x50435D0A, 0x02D6097D, 0xF569F5E4, 0xA7FCA193,
+                0x385EA3EC, 0x6ACBF79B, 0x9D740B02, 0xCFE15F75,
+                0xA97AF471, 0xFBEFA006, 0x0C505C9F, 0x5EC508E8,
+                0xE8655E20, 0xBAF00A57, 0x4D4FF6CE, 0x1FDAA2B9,
+                0x794109BD, 0x2BD45DCA, 0xDC6BA153, 0x8EFEF524,
+                0x115CF75B, 0x43C9A32C, 0xB4765FB5, 0xE6E30BC2,
+                0x8078A0C6, 0xD2EDF4B1, 0x25520828, 0x77C75C5F,
+                0x376AF125, 0x65FFA552, 0x924059CB, 0xC0D50DBC,
+                0xA64EA6B8, 0xF4DBF2CF, 0x03640E56, 0x51F15A21,
+                0xCE53585E, 0x9CC60C29, 0x6B79F0B0, 0x39ECA4C7,
+                0x5F770FC3, 0x0DE25BB4, 0xFA5DA72D, 0xA8C8F35A,
+                0x1E68A592, 0x4CFDF1E5, 0xBB420D7C, 0xE9D7590B,
+                0x8F4CF20F, 0xDDD9A678, 0x2A665AE1, 0x78F30E96,
+                0xE7510CE9, 0xB5C4589E, 0x427BA407, 0x10EEF070,
+                0x76755B74, 0x24E00F03, 0xD35FF39A, 0x81CAA7ED,
+                0x656E584B, 0x37FB0C3C, 0xC044F0A5, 0x92D1A4D2,
+                0xF44A0FD6, 0xA6DF5BA1, 0x5160A738, 0x03F5F34F,
+                0x9C57F130, 0xCEC2A547, 0x397D59DE, 0x6BE80DA9,
+                0x0D73A6AD, 0x5FE6F2DA, 0xA8590E43, 0xFACC5A34,
+                0x4C6C0CFC, 0x1EF9588B, 0xE946A412, 0xBBD3F065,
+                0xDD485B61, 0x8FDD0F16, 0x7862F38F, 0x2AF7A7F8,
+                0xB555A587, 0xE7C0F1F0, 0x107F0D69, 0x42EA591E,
+                0x2471F21A, 0x76E4A66D, 0x815B5AF4, 0xD3CE0E83,
+        },
+        [2] = {
+                0x00000000, 0xFDB641B3, 0x201D8527, 0xDDABC494,
+                0x403B0A4E, 0xBD8D4BFD, 0x60268F69, 0x9D90CEDA,
+                0x8076149C, 0x7DC0552F, 0xA06B91BB, 0x5DDDD008,
+                0xC04D1ED2, 0x3DFB5F61, 0xE0509BF5, 0x1DE6DA46,
+                0xDB9D2F79, 0x262B6ECA, 0xFB80AA5E, 0x0636EBED,
+                0x9BA62537, 0x66106484, 0xBBBBA010, 0x460DE1A3,
+                0x5BEB3BE5, 0xA65D7A56, 0x7BF6BEC2, 0x8640FF71,
+                0x1BD031AB, 0xE6667018, 0x3BCDB48C, 0xC67BF53F,
+                0x6C4B58B3, 0x91FD1900, 0x4C56DD94, 0xB1E09C27,
+                0x2C7052FD, 0xD1C6134E, 0x0C6DD7DA, 0xF1DB9669,
+                0xEC3D4C2F, 0x118B0D9C, 0xCC20C908, 0x319688BB,
+                0xAC064661, 0x51B007D2, 0x8C1BC346, 0x71AD82F5,
+                0xB7D677CA, 0x4A603679, 0x97CBF2ED, 0x6A7DB35E,
+                0xF7ED7D84, 0x0A5B3C37, 0xD7F0F8A3, 0x2A46B910,
+                0x37A06356, 0xCA1622E5, 0x17BDE671, 0xEA0BA7C2,
+                0x779B6918, 0x8A2D28AB, 0x5786EC3F, 0xAA30AD8C,
+                0xD896B166, 0x2520F0D5, 0xF88B3441, 0x053D75F2,
+                0x98ADBB28, 0x651BFA9B, 0xB8B03E0F, 0x45067FBC,
+                0x58E0A5FA, 0xA556E449, 0x78FD20DD, 0x854B616E,
+                0x18DBAFB4, 0xE56DEE07, 0x38C62A93, 0xC5706B20,
+                0x030B9E1F, 0xFEBDDFAC, 0x23161B38, 0xDEA05A8B,
+                0x43309451, 0xBE86D5E2, 0x632D1176, 0x9E9B50C5,
+                0x837D8A83, 0x7ECBCB30, 0xA3600FA4, 0x5ED64E17,
+                0xC34680CD, 0x3EF0C17E, 0xE35B05EA, 0x1EED4459,
+                0xB4DDE9D5, 0x496BA866, 0x94C06CF2, 0x69762D41,
+                0xF4E6E39B, 0x0950A228, 0xD4FB66BC, 0x294D270F,
+                0x34ABFD49, 0xC91DBCFA, 0x14B6786E, 0xE90039DD,
+                0x7490F707, 0x8926B6B4, 0x548D7220, 0xA93B3393,
+                0x6F40C6AC, 0x92F6871F, 0x4F5D438B, 0xB2EB0238,
+                0x2F7BCCE2, 0xD2CD8D51, 0x0F6649C5, 0xF2D00876,
+                0xEF36D230, 0x12809383, 0xCF2B5717, 0x329D16A4,
+                0xAF0DD87E, 0x52BB99CD, 0x8F105D59, 0x72A61CEA,
+                0x6A5C648D, 0x97EA253E, 0x4A41E1AA, 0xB7F7A019,
+                0x2A676EC3, 0xD7D12F70, 0x0A7AEBE4, 0xF7CCAA57,
+                0xEA2A7011, 0x179C31A2, 0xCA37F536, 0x3781B485,
+                0xAA117A5F, 0x57A73BEC, 0x8A0CFF78, 0x77BABECB,
+                0xB1C14BF4, 0x4C770A47, 0x91DCCED3, 0x6C6A8F60,
+                0xF1FA41BA, 0x0C4C0009, 0xD1E7C49D, 0x2C51852E,
+                0x31B75F68, 0xCC011EDB, 0x11AADA4F, 0xEC1C9BFC,
+                0x718C5526, 0x8C3A1495, 0x5191D001, 0xAC2791B2,
+                0x06173C3E, 0xFBA17D8D, 0x260AB919, 0xDBBCF8AA,
+                0x462C3670, 0xBB9A77C3, 0x6631B357, 0x9B87F2E4,
+                0x866128A2, 0x7BD76911, 0xA67CAD85, 0x5BCAEC36,
+                0xC65A22EC, 0x3BEC635F, 0xE647A7CB, 0x1BF1E678,
+                0xDD8A1347, 0x203C52F4, 0xFD979660, 0x0021D7D3,
+                0x9DB11909, 0x600758BA, 0xBDAC9C2E, 0x401ADD9D,
+                0x5DFC07DB, 0xA04A4668, 0x7DE182FC, 0x8057C34F,
+                0x1DC70D95, 0xE0714C26, 0x3DDA88B2, 0xC06CC901,
+                0xB2CAD5EB, 0x4F7C9458, 0x92D750CC, 0x6F61117F,
+                0xF2F1DFA5, 0x0F479E16, 0xD2EC5A82, 0x2F5A1B31,
+                0x32BCC177, 0xCF0A80C4, 0x12A14450, 0xEF1705E3,
+                0x7287CB39, 0x8F318A8A, 0x529A4E1E, 0xAF2C0FAD,
+                0x6957FA92, 0x94E1BB21, 0x494A7FB5, 0xB4FC3E06,
+                0x296CF0DC, 0xD4DAB16F, 0x097175FB, 0xF4C73448,
+                0xE921EE0E, 0x1497AFBD, 0xC93C6B29, 0x348A2A9A,
+                0xA91AE440, 0x54ACA5F3, 0x89076167, 0x74B120D4,
+                0xDE818D58, 0x2337CCEB, 0xFE9C087F, 0x032A49CC,
+                0x9EBA8716, 0x630CC6A5, 0xBEA70231, 0x43114382,
+                0x5EF799C4, 0xA341D877, 0x7EEA1CE3, 0x835C5D50,
+                0x1ECC938A, 0xE37AD239, 0x3ED116AD, 0xC367571E,
+                0x051CA221, 0xF8AAE392, 0x25012706, 0xD8B766B5,
+                0x4527A86F, 0xB891E9DC, 0x653A2D48, 0x988C6CFB,
+                0x856AB6BD, 0x78DCF70E, 0xA577339A, 0x58C17229,
+                0xC551BCF3, 0x38E7FD40, 0xE54C39D4, 0x18FA7867,
+        },
+        [3] = {
+                0x00000000, 0xD4B8C91A, 0x72009475, 0xA6B85D6F,
+                0xE40128EA, 0x30B9E1F0, 0x9601BC9F, 0x42B97585,
+                0x13735795, 0xC7CB9E8F, 0x6173C3E0, 0xB5CB0AFA,
+                0xF7727F7F, 0x23CAB665, 0x8572EB0A, 0x51CA2210,
+                0x26E6AF2A, 0xF25E6630, 0x54E63B5F, 0x805EF245,
+                0xC2E787C0, 0x165F4EDA, 0xB0E713B5, 0x645FDAAF,
+                0x3595F8BF, 0xE12D31A5, 0x47956CCA, 0x932DA5D0,
+                0xD194D055, 0x052C194F, 0xA3944420, 0x772C8D3A,
+                0x4DCD5E54, 0x9975974E, 0x3FCDCA21, 0xEB75033B,
+                0xA9CC76BE, 0x7D74BFA4, 0xDBCCE2CB, 0x0F742BD1,
+                0x5EBE09C1, 0x8A06C0DB, 0x2CBE9DB4, 0xF80654AE,
+                0xBABF212B, 0x6E07E831, 0xC8BFB55E, 0x1C077C44,
+                0x6B2BF17E, 0xBF933864, 0x192B650B, 0xCD93AC11,
+                0x8F2AD994, 0x5B92108E, 0xFD2A4DE1, 0x299284FB,
+                0x7858A6EB, 0xACE06FF1, 0x0A58329E, 0xDEE0FB84,
+                0x9C598E01, 0x48E1471B, 0xEE591A74, 0x3AE1D36E,
+                0x9B9ABCA8, 0x4F2275B2, 0xE99A28DD, 0x3D22E1C7,
+                0x7F9B9442, 0xAB235D58, 0x0D9B0037, 0xD923C92D,
+                0x88E9EB3D, 0x5C512227, 0xFAE97F48, 0x2E51B652,
+                0x6CE8C3D7, 0xB8500ACD, 0x1EE857A2, 0xCA509EB8,
+                0xBD7C1382, 0x69C4DA98, 0xCF7C87F7, 0x1BC44EED,
+                0x597D3B68, 0x8DC5F272, 0x2B7DAF1D, 0xFFC56607,
+                0xAE0F4417, 0x7AB78D0D, 0xDC0FD062, 0x08B71978,
+                0x4A0E6CFD, 0x9EB6A5E7, 0x380EF888, 0xECB63192,
+                0xD657E2FC, 0x02EF2BE6, 0xA4577689, 0x70EFBF93,
+                0x3256CA16, 0xE6EE030C, 0x40565E63, 0x94EE9779,
+                0xC524B569, 0x119C7C73, 0xB724211C, 0x639CE806,
+                0x21259D83, 0xF59D5499, 0x532509F6, 0x879DC0EC,
+                0xF0B14DD6, 0x240984CC, 0x82B1D9A3, 0x560910B9,
+                0x14B0653C, 0xC008AC26, 0x66B0F149, 0xB2083853,
+                0xE3C21A43, 0x377AD359, 0x91C28E36, 0x457A472C,
+                0x07C332A9, 0xD37BFBB3, 0x75C3A6DC, 0xA17B6FC6,
+                0xEC447F11, 0x38FCB60B, 0x9E44EB64, 0x4AFC227E,
+                0x084557FB, 0xDCFD9EE1, 0x7A45C38E, 0xAEFD0A94,
+                0xFF372884, 0x2B8FE19E, 0x8D37BCF1, 0x598F75EB,
+                0x1B36006E, 0xCF8EC974, 0x6936941B, 0xBD8E5D01,
+                0xCAA2D03B, 0x1E1A1921, 0xB8A2444E, 0x6C1A8D54,
+                0x2EA3F8D1, 0xFA1B31CB, 0x5CA36CA4, 0x881BA5BE,
+                0xD9D187AE, 0x0D694EB4, 0xABD113DB, 0x7F69DAC1,
+                0x3DD0AF44, 0xE968665E, 0x4FD03B31, 0x9B68F22B,
+                0xA1892145, 0x7531E85F, 0xD389B530, 0x07317C2A,
+                0x458809AF, 0x9130C0B5, 0x37889DDA, 0xE33054C0,
+                0xB2FA76D0, 0x6642BFCA, 0xC0FAE2A5, 0x14422BBF,
+                0x56FB5E3A, 0x82439720, 0x24FBCA4F, 0xF0430355,
+                0x876F8E6F, 0x53D74775, 0xF56F1A1A, 0x21D7D300,
+                0x636EA685, 0xB7D66F9F, 0x116E32F0, 0xC5D6FBEA,
+                0x941CD9FA, 0x40A410E0, 0xE61C4D8F, 0x32A48495,
+                0x701DF110, 0xA4A5380A, 0x021D6565, 0xD6A5AC7F,
+                0x77DEC3B9, 0xA3660AA3, 0x05DE57CC, 0xD1669ED6,
+                0x93DFEB53, 0x47672249, 0xE1DF7F26, 0x3567B63C,
+                0x64AD942C, 0xB0155D36, 0x16AD0059, 0xC215C943,
+                0x80ACBCC6, 0x541475DC, 0xF2AC28B3, 0x2614E1A9,
+                0x51386C93, 0x8580A589, 0x2338F8E6, 0xF78031FC,
+                0xB5394479, 0x61818D63, 0xC739D00C, 0x13811916,
+                0x424B3B06, 0x96F3F21C, 0x304BAF73, 0xE4F36669,
+                0xA64A13EC, 0x72F2DAF6, 0xD44A8799, 0x00F24E83,
+                0x3A139DED, 0xEEAB54F7, 0x48130998, 0x9CABC082,
+                0xDE12B507, 0x0AAA7C1D, 0xAC122172, 0x78AAE868,
+                0x2960CA78, 0xFDD80362, 0x5B605E0D, 0x8FD89717,
+                0xCD61E292, 0x19D92B88, 0xBF6176E7, 0x6BD9BFFD,
+                0x1CF532C7, 0xC84DFBDD, 0x6EF5A6B2, 0xBA4D6FA8,
+                0xF8F41A2D, 0x2C4CD337, 0x8AF48E58, 0x5E4C4742,
+                0x0F866552, 0xDB3EAC48, 0x7D86F127, 0xA93E383D,
+                0xEB874DB8, 0x3F3F84A2, 0x9987D9CD, 0x4D3F10D7,
+        },
+};
+
+/**
+ * @brief 多项式0x82F63B78(CRC-32C)的余数后移 `ARMV8A_CRC32_BLKSIZE` 个0字节的查询表
+ */
+static __xwbsp_rodata
+const xwu32_t armv8a_crc32c_shifttbl[4][256] = {
+        [0] = {
+                0x00000000, 0xDCB17AA4, 0xBC8E83B9, 0x603FF91D,
+                0x7CF17183, 0xA0400B27, 0xC07FF23A, 0x1CCE889E,
+                0xF9E2E306, 0x255399A2, 0x456C60BF, 0x99DD1A1B,
+                0x85139285, 0x59A2E821, 0x399D113C, 0xE52C6B98,
+                0xF629B0FD, 0x2A98CA59, 0x4AA73344, 0x961649E0,
+                0x8AD8C17E, 0x5669BBDA, 0x365642C7, 0xEAE73863,
+                0x0FCB53FB, 0xD37A295F, 0xB345D042, 0x6FF4AAE6,
+                0x733A2278, 0xAF8B58DC, 0xCFB4A1C1, 0x1305DB65,
+                0xE9BF170B, 0x350E6DAF, 0x553194B2, 0x8980EE16,
+                0x954E6688, 0x49FF1C2C, 0x29C0E531, 0xF5719F95,
+                0x105DF40D, 0xCCEC8EA9, 0xACD377B4, 0x70620D10,
+                0x6CAC858E, 0xB01DFF2A, 0xD0220637, 0x0C937C93,
+                0x1F96A7F6, 0xC327DD52, 0xA318244F, 0x7FA95EEB,
+                0x6367D675, 0xBFD6ACD1, 0xDFE955CC, 0x03582F68,
+                0xE67444F0, 0x3AC53E54, 0x5AFAC749, 0x864BBDED,
+                0x9A853573, 0x46344FD7, 0x260BB6CA, 0xFABACC6E,
+                0xD69258E7, 0x0A232243, 0x6A1CDB5E, 0xB6ADA1FA,
+                0xAA632964, 0x76D253C0, 0x16EDAADD, 0xCA5CD079,
+                0x2F70BBE1, 0xF3C1C145, 0x93FE3858, 0x4F4F42FC,
+                0x5381CA62, 0x8F30B0C6, 0xEF0F49DB, 0x33BE337F,
+                0x20BBE81A, 0xFC0A92BE, 0x9C356BA3, 0x40841107,
+                0x5C4A9999, 0x80FBE33D, 0xE0C41A20, 0x3C756084,
+                0xD9590B1C, 0x05E871B8, 0x65D788A5, 0xB966F201,
+                0xA5A87A9F, 0x7919003B, 0x1926F926, 0xC5978382,
+                0x3F2D4FEC, 0xE39C3548, 0x83A3CC55, 0x5F12B6F1,
+                0x43DC3E6F, 0x9F6D44CB, 0xFF52BDD6, 0x23E3C772,
+                0xC6CFACEA, 0x1A7ED64E, 0x7A412F53, 0xA6F055F7,
+                0xBA3EDD69, 0x668FA7CD, 0x06B05ED0, 0xDA012474,
+                0xC904FF11, 0x15B585B5, 0x758A7CA8, 0xA93B060C,
+                0xB5F58E92, 0x6944F436, 0x097B0D2B, 0xD5CA778F,
+                0x30E61C17, 0xEC5766B3, 0x8C689FAE, 0x50D9E50A,
+                0x4C176D94, 0x90A61730, 0xF099EE2D, 0x2C289489,
+                0xA8C8C73F, 0x7479BD9B, 0x14464486, 0xC8F73E22,
+                0xD439B6BC, 0x0888CC18, 0x68B73505, 0xB4064FA1,
+                0x512A2439, 0x8D9B5E9D, 0xEDA4A780, 0x3115DD24,
+                0x2DDB55BA, 0xF16A2F1E, 0x9155D603, 0x4DE4ACA7,
+                0x5EE177C2, 0x82500D66, 0xE26FF47B, 0x3EDE8EDF,
+                0x22100641, 0xFEA17CE5, 0x9E9E85F8, 0x422FFF5C,
+                0xA70394C4, 0x7BB2EE60, 0x1B8D177D, 0xC73C6DD9,
+                0xDBF2E547, 0x07439FE3, 0x677C66FE, 0xBBCD1C5A,
+                0x4177D034, 0x9DC6AA90, 0xFDF9538D, 0x21482929,
+                0x3D86A1B7, 0xE137DB13, 0x8108220E, 0x5DB958AA,
+                0xB8953332, 0x64244996, 0x041BB08B, 0xD8AACA2F,
+                0xC46442B1, 0x18D53815, 0x78EAC108, 0xA45BBBAC,
+                0xB75E60C9, 0x6BEF1A6D, 0x0BD0E370, 0xD76199D4,
+                0xCBAF114A, 0x171E6BEE, 0x772192F3, 0xAB90E857,
+                0x4EBC83CF, 0x920DF96B, 0xF2320076, 0x2E837AD2,
+                0x324DF24C, 0xEEFC88E8, 0x8EC371F5, 0x52720B51,
+                0x7E5A9FD8, 0xA2EBE57C, 0xC2D41C61, 0x1E6566C5,
+                0x02ABEE5B, 0xDE1A94FF, 0xBE256DE2, 0x62941746,
+                0x87B87CDE, 0x5B09067A, 0x3B36FF67, 0xE78785C3,
+                0xFB490D5D, 0x27F877F9, 0x47C78EE4, 0x9B76F440,
+                0x88732F25, 0x54C25581, 0x34FDAC9C, 0xE84CD638,
+                0xF4825EA6, 0x28332402, 0x480CDD1F, 0x94BDA7BB,
+                0x7191CC23, 0xAD20B687, 0xCD1F4F9A, 0x11AE353E,
+                0x0D60BDA0, 0xD1D1C704, 0xB1EE3E19, 0x6D5F44BD,
+                0x97E588D3, 0x4B54F277, 0x2B6B0B6A, 0xF7DA71CE,
+                0xEB14F950, 0x37A583F4, 0x579A7AE9, 0x8B2B004D,
+                0x6E076BD5, 0xB2B61171, 0xD289E86C, 0x0E3892C8,
+                0x12F61A56, 0xCE4760F2, 0xAE7899EF, 0x72C9E34B,
+                0x61CC382E, 0xBD7D428A, 0xDD42BB97, 0x01F3C133,
+                0x1D3D49AD, 0xC18C3309, 0xA1B3CA14, 0x7D02B0B0,
+                0x982EDB28, 0x449FA18C, 0x24A05891, 0xF8112235,
+                0xE4DFAAAB, 0x386ED00F, 0x58512912, 0x84E053B6,
+        },
+        [1] = {
+                0x00000000, 0x547DF88F, 0xA8FBF11E, 0xFC860991,
+                0x541B94CD, 0x00666C42, 0xFCE065D3, 0xA89D9D5C,
+                0xA837299A, 0xFC4AD115, 0x00CCD884, 0x54B1200B,
+                0xFC2CBD57, 0xA85145D8, 0x54D74C49, 0x00AAB4C6,
+                0x558225C5, 0x01FFDD4A, 0xFD79D4DB, 0xA9042C54,
+                0x0199B108, 0x55E44987, 0xA9624016, 0xFD1FB899,
+                0xFDB50C5F, 0xA9C8F4D0, 0x554EFD41, 0x013305CE,
+                0xA9AE9892, 0xFDD3601D, 0x0155698C, 0x55289103,
+                0xAB044B8A, 0xFF79B305, 0x03FFBA94, 0x5782421B,
+                0xFF1FDF47, 0xAB6227C8, 0x57E42E59, 0x0399D6D6,
+                0x03336210, 0x574E9A9F, 0xABC8930E, 0xFFB56B81,
+                0x5728F6DD, 0x03550E52, 0xFFD307C3, 0xABAEFF4C,
+                0xFE866E4F, 0xAAFB96C0, 0x567D9F51, 0x020067DE,
+                0xAA9DFA82, 0xFEE0020D, 0x02660B9C, 0x561BF313,
+                0x56B147D5, 0x02CCBF5A, 0xFE4AB6CB, 0xAA374E44,
+                0x02AAD318, 0x56D72B97, 0xAA512206, 0xFE2CDA89,
+                0x53E4E1E5, 0x0799196A, 0xFB1F10FB, 0xAF62E874,
+                0x07FF7528, 0x53828DA7, 0xAF048436, 0xFB797CB9,
+                0xFBD3C87F, 0xAFAE30F0, 0x53283961, 0x0755C1EE,
+                0xAFC85CB2, 0xFBB5A43D, 0x0733ADAC, 0x534E5523,
+                0x0666C420, 0x521B3CAF, 0xAE9D353E, 0xFAE0CDB1,
+                0x527D50ED, 0x0600A862, 0xFA86A1F3, 0xAEFB597C,
+                0xAE51EDBA, 0xFA2C1535, 0x06AA1CA4, 0x52D7E42B,
+                0xFA4A7977, 0xAE3781F8, 0x52B18869, 0x06CC70E6,
+                0xF8E0AA6F, 0xAC9D52E0, 0x501B5B71, 0x0466A3FE,
+                0xACFB3EA2, 0xF886C62D, 0x0400CFBC, 0x507D3733,
+                0x50D783F5, 0x04AA7B7A, 0xF82C72EB, 0xAC518A64,
+                0x04CC1738, 0x50B1EFB7, 0xAC37E626, 0xF84A1EA9,
+                0xAD628FAA, 0xF91F7725, 0x05997EB4, 0x51E4863B,
+                0xF9791B67, 0xAD04E3E8, 0x5182EA79, 0x05FF12F6,
+                0x0555A630, 0x51285EBF, 0xADAE572E, 0xF9D3AFA1,
+                0x514E32FD, 0x0533CA72, 0xF9B5C3E3, 0xADC83B6C,
+                0xA7C9C3CA, 0xF3B43B45, 0x0F3232D4, 0x5B4FCA5B,
+                0xF3D25707, 0xA7AFAF88, 0x5B29A619, 0x0F545E96,
+                0x0FFEEA50, 0x5B8312DF, 0xA7051B4E, 0xF378E3C1,
+                0x5BE57E9D, 0x0F988612, 0xF31E8F83, 0xA763770C,
+                0xF24BE60F, 0xA6361E80, 0x5AB01711, 0x0ECDEF9E,
+                0xA65072C2, 0xF22D8A4D, 0x0EAB83DC, 0x5AD67B53,
+                0x5A7CCF95, 0x0E01371A, 0xF2873E8B, 0xA6FAC604,
+                0x0E675B58, 0x5A1AA3D7, 0xA69CAA46, 0xF2E152C9,
+                0x0CCD8840, 0x58B070CF, 0xA436795E, 0xF04B81D1,
+                0x58D61C8D, 0x0CABE402, 0xF02DED93, 0xA450151C,
+                0xA4FAA1DA, 0xF0875955, 0x0C0150C4, 0x587CA84B,
+                0xF0E13517, 0xA49CCD98, 0x581AC409, 0x0C673C86,
+                0x594FAD85, 0x0D32550A, 0xF1B45C9B, 0xA5C9A414,
+                0x0D543948, 0x5929C1C7, 0xA5AFC856, 0xF1D230D9,
+                0xF178841F, 0xA5057C90, 0x59837501, 0x0DFE8D8E,
+                0xA56310D2, 0xF11EE85D, 0x0D98E1CC, 0x59E51943,
+                0xF42D222F, 0xA050DAA0, 0x5CD6D331, 0x08AB2BBE,
+                0xA036B6E2, 0xF44B4E6D, 0x08CD47FC, 0x5CB0BF73,
+                0x5C1A0BB5, 0x0867F33A, 0xF4E1FAAB, 0xA09C0224,
+                0x08019F78, 0x5C7C67F7, 0xA0FA6E66, 0xF48796E9,
+                0xA1AF07EA, 0xF5D2FF65, 0x0954F6F4, 0x5D290E7B,
+                0xF5B49327, 0xA1C96BA8, 0x5D4F6239, 0x09329AB6,
+                0x09982E70, 0x5DE5D6FF, 0xA163DF6E, 0xF51E27E1,
+                0x5D83BABD, 0x09FE4232, 0xF5784BA3, 0xA105B32C,
+                0x5F2969A5, 0x0B54912A, 0xF7D298BB, 0xA3AF6034,
+                0x0B32FD68, 0x5F4F05E7, 0xA3C90C76, 0xF7B4F4F9,
+                0xF71E403F, 0xA363B8B0, 0x5FE5B121, 0x0B9849AE,
+                0xA305D4F2, 0xF7782C7D, 0x0BFE25EC, 0x5F83DD63,
+                0x0AAB4C60, 0x5ED6B4EF, 0xA250BD7E, 0xF62D45F1,
+                0x5EB0D8AD, 0x0ACD2022, 0xF64B29B3, 0xA236D13C,
+                0xA29C65FA, 0xF6E19D75, 0x0A6794E4, 0x5E1A6C6B,
+                0xF687F137, 0xA2FA09B8, 0x5E7C0029, 0x0A01F8A6,
+        },
+        [2] = {
+                0x00000000, 0x4A7FF165, 0x94FFE2CA, 0xDE8013AF,
+                0x2C13B365, 0x666C4200, 0xB8EC51AF, 0xF293A0CA,
+                0x582766CA, 0x125897AF, 0xCCD88400, 0x86A77565,
+                0x7434D5AF, 0x3E4B24CA, 0xE0CB3765, 0xAAB4C600,
+                0xB04ECD94, 0xFA313CF1, 0x24B12F5E, 0x6ECEDE3B,
+                0x9C5D7EF1, 0xD6228F94, 0x08A29C3B, 0x42DD6D5E,
+                0xE869AB5E, 0xA2165A3B, 0x7C964994, 0x36E9B8F1,
+                0xC47A183B, 0x8E05E95E, 0x5085FAF1, 0x1AFA0B94,
+                0x6571EDD9, 0x2F0E1CBC, 0xF18E0F13, 0xBBF1FE76,
+                0x49625EBC, 0x031DAFD9, 0xDD9DBC76, 0x97E24D13,
+                0x3D568B13, 0x77297A76, 0xA9A969D9, 0xE3D698BC,
+                0x11453876, 0x5B3AC913, 0x85BADABC, 0xCFC52BD9,
+                0xD53F204D, 0x9F40D128, 0x41C0C287, 0x0BBF33E2,
+                0xF92C9328, 0xB353624D, 0x6DD371E2, 0x27AC8087,
+                0x8D184687, 0xC767B7E2, 0x19E7A44D, 0x53985528,
+                0xA10BF5E2, 0xEB740487, 0x35F41728, 0x7F8BE64D,
+                0xCAE3DBB2, 0x809C2AD7, 0x5E1C3978, 0x1463C81D,
+                0xE6F068D7, 0xAC8F99B2, 0x720F8A1D, 0x38707B78,
+                0x92C4BD78, 0xD8BB4C1D, 0x063B5FB2, 0x4C44AED7,
+                0xBED70E1D, 0xF4A8FF78, 0x2A28ECD7, 0x60571DB2,
+                0x7AAD1626, 0x30D2E743, 0xEE52F4EC, 0xA42D0589,
+                0x56BEA543, 0x1CC15426, 0xC2414789, 0x883EB6EC,
+                0x228A70EC, 0x68F58189, 0xB6759226, 0xFC0A6343,
+                0x0E99C389, 0x44E632EC, 0x9A662143, 0xD019D026,
+                0xAF92366B, 0xE5EDC70E, 0x3B6DD4A1, 0x711225C4,
+                0x8381850E, 0xC9FE746B, 0x177E67C4, 0x5D0196A1,
+                0xF7B550A1, 0xBDCAA1C4, 0x634AB26B, 0x2935430E,
+                0xDBA6E3C4, 0x91D912A1, 0x4F59010E, 0x0526F06B,
+                0x1FDCFBFF, 0x55A30A9A, 0x8B231935, 0xC15CE850,
+                0x33CF489A, 0x79B0B9FF, 0xA730AA50, 0xED4F5B35,
+                0x47FB9D35, 0x0D846C50, 0xD3047FFF, 0x997B8E9A,
+                0x6BE82E50, 0x2197DF35, 0xFF17CC9A, 0xB5683DFF,
+                0x902BC195, 0xDA5430F0, 0x04D4235F, 0x4EABD23A,
+                0xBC3872F0, 0xF6478395, 0x28C7903A, 0x62B8615F,
+                0xC80CA75F, 0x8273563A, 0x5CF34595, 0x168CB4F0,
+                0xE41F143A, 0xAE60E55F, 0x70E0F6F0, 0x3A9F0795,
+                0x20650C01, 0x6A1AFD64, 0xB49AEECB, 0xFEE51FAE,
+                0x0C76BF64, 0x46094E01, 0x98895DAE, 0xD2F6ACCB,
+                0x78426ACB, 0x323D9BAE, 0xECBD8801, 0xA6C27964,
+                0x5451D9AE, 0x1E2E28CB, 0xC0AE3B64, 0x8AD1CA01,
+                0xF55A2C4C, 0xBF25DD29, 0x61A5CE86, 0x2BDA3FE3,
+                0xD9499F29, 0x93366E4C, 0x4DB67DE3, 0x07C98C86,
+                0xAD7D4A86, 0xE702BBE3, 0x3982A84C, 0x73FD5929,
+                0x816EF9E3, 0xCB110886, 0x15911B29, 0x5FEEEA4C,
+                0x4514E1D8, 0x0F6B10BD, 0xD1EB0312, 0x9B94F277,
+                0x690752BD, 0x2378A3D8, 0xFDF8B077, 0xB7874112,
+                0x1D338712, 0x574C7677, 0x89CC65D8, 0xC3B394BD,
+                0x31203477, 0x7B5FC512, 0xA5DFD6BD, 0xEFA027D8,
+                0x5AC81A27, 0x10B7EB42, 0xCE37F8ED, 0x84480988,
+                0x76DBA942, 0x3CA45827, 0xE2244B88, 0xA85BBAED,
+                0x02EF7CED, 0x48908D88, 0x96109E27, 0xDC6F6F42,
+                0x2EFCCF88, 0x64833EED, 0xBA032D42, 0xF07CDC27,
+                0xEA86D7B3, 0xA0F926D6, 0x7E793579, 0x3406C41C,
+                0xC69564D6, 0x8CEA95B3, 0x526A861C, 0x18157779,
+                0xB2A1B179, 0xF8DE401C, 0x265E53B3, 0x6C21A2D6,
+                0x9EB2021C, 0xD4CDF379, 0x0A4DE0D6, 0x403211B3,
+                0x3FB9F7FE, 0x75C6069B, 0xAB461534, 0xE139E451,
+                0x13AA449B, 0x59D5B5FE, 0x8755A651, 0xCD2A5734,
+                0x679E9134, 0x2DE16051, 0xF36173FE, 0xB91E829B,
+                0x4B8D2251, 0x01F2D334, 0xDF72C09B, 0x950D31FE,
+                0x8FF73A6A, 0xC588CB0F, 0x1B08D8A0, 0x517729C5,
+                0xA3E4890F, 0xE99B786A, 0x371B6BC5, 0x7D649AA0,
+                0xD7D05CA0, 0x9DAFADC5, 0x432FBE6A, 0x09504F0F,
+                0xFBC3EFC5, 0xB1BC1EA0, 0x6F3C0D0F, 0x2543FC6A,
+        },
+        [3] = {
+                0x00000000, 0x25BBF5DB, 0x4B77EBB6, 0x6ECC1E6D,
+                0x96EFD76C, 0xB35422B7, 0xDD983CDA, 0xF823C901,
+                0x2833D829, 0x0D882DF2, 0x6344339F, 0x46FFC644,
+                0xBEDC0F45, 0x9B67FA9E, 0xF5ABE4F3, 0xD0101128,
+                0x5067B052, 0x75DC4589, 0x1B105BE4, 0x3EABAE3F,
+                0xC688673E, 0xE33392E5, 0x8DFF8C88, 0xA8447953,
+                0x7854687B, 0x5DEF9DA0, 0x332383CD, 0x16987616,
+                0xEEBBBF17, 0xCB004ACC, 0xA5CC54A1, 0x8077A17A,
+                0xA0CF60A4, 0x8574957F, 0xEBB88B12, 0xCE037EC9,
+                0x3620B7C8, 0x139B4213, 0x7D575C7E, 0x58ECA9A5,
+                0x88FCB88D, 0xAD474D56, 0xC38B533B, 0xE630A6E0,
+                0x1E136FE1, 0x3BA89A3A, 0x55648457, 0x70DF718C,
+                0xF0A8D0F6, 0xD513252D, 0xBBDF3B40, 0x9E64CE9B,
+                0x6647079A, 0x43FCF241, 0x2D30EC2C, 0x088B19F7,
+                0xD89B08DF, 0xFD20FD04, 0x93ECE369, 0xB65716B2,
+                0x4E74DFB3, 0x6BCF2A68, 0x05033405, 0x20B8C1DE,
+                0x4472B7B9, 0x61C94262, 0x0F055C0F, 0x2ABEA9D4,
+                0xD29D60D5, 0xF726950E, 0x99EA8B63, 0xBC517EB8,
+                0x6C416F90, 0x49FA9A4B, 0x27368426, 0x028D71FD,
+                0xFAAEB8FC, 0xDF154D27, 0xB1D9534A, 0x9462A691,
+                0x141507EB, 0x31AEF230, 0x5F62EC5D, 0x7AD91986,
+                0x82FAD087, 0xA741255C, 0xC98D3B31, 0xEC36CEEA,
+                0x3C26DFC2, 0x199D2A19, 0x77513474, 0x52EAC1AF,
+                0xAAC908AE, 0x8F72FD75, 0xE1BEE318, 0xC40516C3,
+                0xE4BDD71D, 0xC10622C6, 0xAFCA3CAB, 0x8A71C970,
+                0x72520071, 0x57E9F5AA, 0x3925EBC7, 0x1C9E1E1C,
+                0xCC8E0F34, 0xE935FAEF, 0x87F9E482, 0xA2421159,
+                0x5A61D858, 0x7FDA2D83, 0x111633EE, 0x34ADC635,
+                0xB4DA674F, 0x91619294, 0xFFAD8CF9, 0xDA167922,
+                0x2235B023, 0x078E45F8, 0x69425B95, 0x4CF9AE4E,
+                0x9CE9BF66, 0xB9524ABD, 0xD79E54D0, 0xF225A10B,
+                0x0A06680A, 0x2FBD9DD1, 0x417183BC, 0x64CA7667,
+                0x88E56F72, 0xAD5E9AA9, 0xC39284C4, 0xE629711F,
+                0x1E0AB81E, 0x3BB14DC5, 0x557D53A8, 0x70C6A673,
+                0xA0D6B75B, 0x856D4280, 0xEBA15CED, 0xCE1AA936,
+                0x36396037, 0x138295EC, 0x7D4E8B81, 0x58F57E5A,
+                0xD882DF20, 0xFD392AFB, 0x93F53496, 0xB64EC14D,
+                0x4E6D084C, 0x6BD6FD97, 0x051AE3FA, 0x20A11621,
+                0xF0B10709, 0xD50AF2D2, 0xBBC6ECBF, 0x9E7D1964,
+                0x665ED065, 0x43E525BE, 0x2D293BD3, 0x0892CE08,
+                0x282A0FD6, 0x0D91FA0D, 0x635DE460, 0x46E611BB,
+                0xBEC5D8BA, 0x9B7E2D61, 0xF5B2330C, 0xD009C6D7,
+                0x0019D7FF, 0x25A22224, 0x4B6E3C49, 0x6ED5C992,
+                0x96F60093, 0xB34DF548, 0xDD81EB25, 0xF83A1EFE,
+                0x784DBF84, 0x5DF64A5F, 0x333A5432, 0x1681A1E9,
+                0xEEA268E8, 0xCB199D33, 0xA5D5835E, 0x806E7685,
+                0x507E67AD, 0x75C59276, 0x1B098C1B, 0x3EB279C0,
+                0xC691B0C1, 0xE32A451A, 0x8DE65B77, 0xA85DAEAC,
+                0xCC97D8CB, 0xE92C2D10, 0x87E0337D, 0xA25BC6A6,
+                0x5A780FA7, 0x7FC3FA7C, 0x110FE411, 0x34B411CA,
+                0xE4A400E2, 0xC11FF539, 0xAFD3EB54, 0x8A681E8F,
+                0x724BD78E, 0x57F02255, 0x393C3C38, 0x1C87C9E3,
+                0x9CF06899, 0xB94B9D42, 0xD787832F, 0xF23C76F4,
+                0x0A1FBFF5, 0x2FA44A2E, 0x41685443, 0x64D3A198,
+                0xB4C3B0B0, 0x9178456B, 0xFFB45B06, 0xDA0FAEDD,
+                0x222C67DC, 0x07979207, 0x695B8C6A, 0x4CE079B1,
+                0x6C58B86F, 0x49E34DB4, 0x272F53D9, 0x0294A602,
+                0xFAB76F03, 0xDF0C9AD8, 0xB1C084B5, 0x947B716E,
+                0x446B6046, 0x61D0959D, 0x0F1C8BF0, 0x2AA77E2B,
+                0xD284B72A, 0xF73F42F1, 0x99F35C9C, 0xBC48A947,
+                0x3C3F083D, 0x1984FDE6, 0x7748E38B, 0x52F31650,
+                0xAAD0DF51, 0x8F6B2A8A, 0xE1A734E7, 0xC41CC13C,
+                0x140CD014, 0x31B725CF, 0x5F7B3BA2, 0x7AC0CE79,
+                0x82E30778, 0xA758F2A3, 0xC994ECCE, 0xEC2F1915,
+        },
+};
+
+static __xwbsp_inline
+xwu32_t armv8a_crc32b(xwu32_t crc, xwu8_t data, bool castagnoli)
+{
+        if (castagnoli) {
+                __asm__ volatile(
+                "       crc32cb %w[__crc], %w[__crc], %w[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        } else {
+                __asm__ volatile(
+                "       crc32b  %w[__crc], %w[__crc], %w[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        }
+        return crc;
+}
+
+static __xwbsp_inline
+xwu32_t armv8a_crc32h(xwu32_t crc, xwu16_t data, bool castagnoli)
+{
+        if (castagnoli) {
+                __asm__ volatile(
+                "       crc32ch %w[__crc], %w[__crc], %w[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        } else {
+                __asm__ volatile(
+                "       crc32h  %w[__crc], %w[__crc], %w[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        }
+        return crc;
+}
+
+static __xwbsp_inline
+xwu32_t armv8a_crc32w(xwu32_t crc, xwu32_t data, bool castagnoli)
+{
+        if (castagnoli) {
+                __asm__ volatile(
+                "       crc32cw %w[__crc], %w[__crc], %w[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        } else {
+                __asm__ volatile(
+                "       crc32w  %w[__crc], %w[__crc], %w[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        }
+        return crc;
+}
+
+static __xwbsp_inline
+xwu32_t armv8a_crc32x(xwu32_t crc, xwu64_t data, bool castagnoli)
+{
+        if (castagnoli) {
+                __asm__ volatile(
+                "       crc32cx %w[__crc], %w[__crc], %x[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        } else {
+                __asm__ volatile(
+                "       crc32x  %w[__crc], %w[__crc], %x[__data]\n"
+                : [__crc] "+r" (crc)
+                : [__data] "r" (data)
+                :);
+        }
+        return crc;
+}
+
+static __xwbsp_inline
+xwu32_t armv8a_crc32_shift(xwu32_t crc, const xwu32_t (* shifttbl)[256])
+{
+        return shifttbl[0][crc & (xwu32_t)0xFF] ^
+               shifttbl[1][(crc >> (xwu32_t)8) & (xwu32_t)0xFF] ^
+               shifttbl[2][(crc >> (xwu32_t)16) & (xwu32_t)0xFF] ^
+               shifttbl[3][crc >> (xwu32_t)24];
+}
+
+/**
+ * @brief 使用CRC32指令或CRC32C指令计算一段数据的余数
+ * @param[in] crc: 初始值
+ * @param[in] castagnoli: 是否使用CRC32C指令
+ * @param[in] stream: 指向数据的指针
+ * @param[in] size: 数据长度
+ * @return 余数
+ * @details
+ * 总是被内联展开， `castagnoli` 是常量，不会在循环中产生分支。
+ */
+static __xwbsp_inline
+xwu32_t armv8a_crc32_update(xwu32_t crc, bool castagnoli,
+                            const xwu8_t stream[], xwsz_t size)
+{
+        const xwu32_t (* shifttbl)[256];
+        xwu32_t crc1;
+        xwu32_t crc2;
+        xwu64_t d64;
+        xwu32_t d32;
+        xwu16_t d16;
+        xwsz_t rest;
+        xwsz_t pos;
+        xwsz_t i;
+
+        shifttbl = castagnoli ? armv8a_crc32c_shifttbl : armv8a_crc32_shifttbl;
+        rest = size;
+        pos = 0;
+        /* 对齐到8字节的边界 */
+        while ((rest > 0U) && ((((xwptr_t)&stream[pos]) & (xwptr_t)7) != 0U)) {
+                crc = armv8a_crc32b(crc, stream[pos], castagnoli);
+                pos++;
+                rest--;
+        }
+        /* 三路交织计算，第二路与第三路从0开始，最后合并到第一路 */
+        while (rest >= (3U * ARMV8A_CRC32_BLKSIZE)) {
+                crc1 = 0;
+                crc2 = 0;
+                for (i = 0; i < ARMV8A_CRC32_BLKSIZE; i += sizeof(xwu64_t)) {
+                        memcpy(&d64, &stream[pos + i], sizeof(d64));
+                        crc = armv8a_crc32x(crc, d64, castagnoli);
+                        memcpy(&d64, &stream[pos + ARMV8A_CRC32_BLKSIZE + i],
+                               sizeof(d64));
+                        crc1 = armv8a_crc32x(crc1, d64, castagnoli);
+                        memcpy(&d64, &stream[pos + (2U * ARMV8A_CRC32_BLKSIZE) + i],
+                               sizeof(d64));
+                        crc2 = armv8a_crc32x(crc2, d64, castagnoli);
+                }
+                crc = armv8a_crc32_shift(crc, shifttbl) ^ crc1;
+                crc = armv8a_crc32_shift(crc, shifttbl) ^ crc2;
+                pos += 3U * ARMV8A_CRC32_BLKSIZE;
+                rest -= 3U * ARMV8A_CRC32_BLKSIZE;
+        }
+        while (rest >= sizeof(xwu64_t)) {
+                memcpy(&d64, &stream[pos], sizeof(d64));
+                crc = armv8a_crc32x(crc, d64, castagnoli);
+                pos += sizeof(xwu64_t);
+                rest -= sizeof(xwu64_t);
+        }
+        if (rest >= sizeof(xwu32_t)) {
+                memcpy(&d32, &stream[pos], sizeof(d32));
+                crc = armv8a_crc32w(crc, d32, castagnoli);
+                pos += sizeof(xwu32_t);
+                rest -= sizeof(xwu32_t);
+        }
+        if (rest >= sizeof(xwu16_t)) {
+                memcpy(&d16, &stream[pos], sizeof(d16));
+                crc = armv8a_crc32h(crc, d16, castagnoli);
+                pos += sizeof(xwu16_t);
+                rest -= sizeof(xwu16_t);
+        }
+        if (rest > 0U) {
+                crc = armv8a_crc32b(crc, stream[pos], castagnoli);
+        }
+        return crc;
+}
+
+/**
+ * @brief 使用ARMv8A的CRC32指令计算数据的CRC32校验值
+ * @param[in,out] crc32: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示初始值
+ * + (O) 作为输出时，返回计算结果
+ * @param[in] refin: 是否按位镜像翻转输入的每个字节
+ * @param[in] plynml: 多项式
+ * @param[in] direction: 数据移位的方向
+ * @param[in] stream: 指向数据的指针
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @return 错误码
+ * @retval XWOK: 计算结果有效
+ * @retval -EOPNOTSUPP: 不支持的参数模型
+ * @details
+ * CRC32指令只支持多项式0xEDB88320右移、不翻转输入的模型，
+ * CRC32C指令只支持多项式0x82F63B78右移、不翻转输入的模型，
+ * 按位镜像翻转输入的模型已由 `xwlib_crc32_cal()` 转换为这两个模型。
+ */
+__xwbsp_code
+xwer_t arch_crc32_cal(xwu32_t * crc32,
+                      bool refin, xwu32_t plynml, xwu32_t direction,
+                      const xwu8_t stream[], xwsz_t * size)
+{
+        xwer_t rc;
+
+        if ((refin) || ((xwu32_t)XWLIB_CRC32_RIGHT_SHIFT != direction)) {
+                rc = -EOPNOTSUPP;
+        } else if ((xwu32_t)0xEDB88320 == plynml) {
+                *crc32 = armv8a_crc32_update(*crc32, false, stream, *size);
+                *size = 0;
+                rc = XWOK;
+        } else if ((xwu32_t)0x82F63B78 == plynml) {
+                *crc32 = armv8a_crc32_update(*crc32, true, stream, *size);
+                *size = 0;
+                rc = XWOK;
+        } else {
+                rc = -EOPNOTSUPP;
+        }
+        return rc;
+}
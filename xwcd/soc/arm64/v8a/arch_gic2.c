@@ -641,3 +641,28 @@ xwer_t armv8a_gic_irq_set_isr(xwirq_t irqn, xwisr_f isr)
         }
         return rc;
 }
+
+__xwbsp_code
+xwer_t armv8a_gic_sgi_send(xwirq_t sgi, xwu8_t cpumask)
+{
+        xwer_t rc;
+        xwu32_t sgir;
+
+        if ((sgi < (xwirq_t)0) || (sgi >= (xwirq_t)ARMV8A_SGI_NUM)) {
+                rc = -ERANGE;
+        } else {
+                /* TargetListFilter = 0: 发送给CPUTargetList中的CPU；
+                   NSATT = 1: 发送Group 1的SGI */
+                sgir = ((xwu32_t)cpumask << (xwu32_t)16) | ((xwu32_t)1 << (xwu32_t)15) |
+                       ((xwu32_t)sgi & (xwu32_t)0xF);
+                armv8a_dsb(ish);
+                armv8a_gic2.d.sgir = sgir;
+                soc_dbgf("GIC2",
+                         "CPU%d sends SGI(%d) to cpumask:0x%X, "
+                         "gic2d.sgir@0x%lX:0x%X\r\n",
+                         xwospl_skd_get_cpuid_lc(), sgi, cpumask,
+                         &armv8a_gic2.d.sgir, sgir);
+                rc = XWOK;
+        }
+        return rc;
+}
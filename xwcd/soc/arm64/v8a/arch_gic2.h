@@ -176,5 +176,6 @@ xwer_t armv8a_gic_irq_get_state(xwirq_t irqn,
                                 bool * enable, bool * pending, bool * active);
 void armv8a_gic_irq_dump(xwirq_t irqn);
 xwer_t armv8a_gic_irq_set_isr(xwirq_t irqn, xwisr_f isr);
+xwer_t armv8a_gic_sgi_send(xwirq_t sgi, xwu8_t cpumask);
 
 #endif /* xwcd/soc/arm64/v8a/arch_gic2.h */
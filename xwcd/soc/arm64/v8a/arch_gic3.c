@@ -843,3 +843,24 @@ xwer_t armv8a_gic_irq_set_isr(xwirq_t irqn, xwisr_f isr)
         }
         return rc;
 }
+
+__xwbsp_code
+xwer_t armv8a_gic_sgi_send(xwirq_t sgi, xwu8_t cpumask)
+{
+        xwer_t rc;
+        xwu64_t sgi1r;
+
+        if ((sgi < (xwirq_t)0) || (sgi >= (xwirq_t)ARMV8A_SGI_NUM)) {
+                rc = -ERANGE;
+        } else {
+                /* CPU的ID即为亲和性Aff0，Aff1~Aff3为0 */
+                sgi1r = (((xwu64_t)sgi & (xwu64_t)0xF) << (xwu64_t)24) | (xwu64_t)cpumask;
+                armv8a_dsb(ish);
+                armv8a_sysreg_write(icc_sgi1r_el1, sgi1r);
+                soc_dbgf("GIC3",
+                         "CPU%d sends SGI(%d) to cpumask:0x%X, icc_sgi1r_el1:0x%lX\r\n",
+                         xwospl_skd_get_cpuid_lc(), sgi, cpumask, sgi1r);
+                rc = XWOK;
+        }
+        return rc;
+}
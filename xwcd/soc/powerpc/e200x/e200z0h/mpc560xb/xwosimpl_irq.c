@@ -53,3 +53,11 @@ xwer_t xwospl_irq_restore(xwirq_t irqn, xwreg_t flag)
 {
         return soc_irq_restore(irqn, flag);
 }
+
+#if defined(XWCFG_CORE__mp)
+__xwbsp_code
+xwer_t xwospl_irq_ipi(__xwcc_unused xwirq_t irqn, __xwcc_unused xwid_t cpuid)
+{
+        return -ENOSYS;
+}
+#endif
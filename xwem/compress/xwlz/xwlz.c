@@ -0,0 +1,319 @@
+/**
+ * @file
+ * @brief XWLZ：轻量级LZ压缩算法
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#include <xwos/standard.h>
+#include <string.h>
+#include <xwem/compress/xwlz/xwlz.h>
+
+/**
+ * @ingroup xwlz
+ * @{
+ */
+
+#define XWLZ_MINMATCH           (4U) /**< 最短的匹配长度 */
+#define XWLZ_LASTLITERALS       (5U) /**< 末尾必须是字面量的字节数 */
+#define XWLZ_MFLIMIT            (12U) /**< 最后一个匹配的起始位置距离末尾的最小距离 */
+#define XWLZ_RUNMSK             (15U) /**< 标记字节中长度字段的最大值 */
+#define XWLZ_MAX_OFFSET         (0xFFFFU) /**< 匹配的最大偏移 */
+
+static
+xwu32_t xwlz_read32(const xwu8_t * p)
+{
+        return ((xwu32_t)p[0] | ((xwu32_t)p[1] << 8U) |
+                ((xwu32_t)p[2] << 16U) | ((xwu32_t)p[3] << 24U));
+}
+
+static
+xwsq_t xwlz_hash(xwu32_t seq)
+{
+        return (xwsq_t)((seq * 2654435761U) >> (32U - XWLZ_HTBL_ODR));
+}
+
+/**
+ * @brief 计算长度字段的扩展字节数
+ */
+static
+xwsz_t xwlz_extsize(xwsz_t len)
+{
+        return (len >= XWLZ_RUNMSK) ? (((len - XWLZ_RUNMSK) / 255U) + 1U) : 0U;
+}
+
+/**
+ * @brief 写入长度字段的扩展字节
+ */
+static
+xwsz_t xwlz_put_ext(xwu8_t * dst, xwsz_t len)
+{
+        xwsz_t pos;
+
+        pos = 0;
+        if (len >= XWLZ_RUNMSK) {
+                len -= XWLZ_RUNMSK;
+                while (len >= 255U) {
+                        dst[pos] = 255U;
+                        pos++;
+                        len -= 255U;
+                }
+                dst[pos] = (xwu8_t)len;
+                pos++;
+        }
+        return pos;
+}
+
+/**
+ * @brief 输出一个序列
+ * @param[in] lit: 字面量
+ * @param[in] litlen: 字面量长度
+ * @param[in] offset: 匹配的偏移，为 `0` 表示最后一个序列
+ * @param[in] mlen: 匹配长度
+ * @param[out] dst: 输出缓冲区
+ * @param[in,out] op: 输出位置
+ * @param[in] dstsize: 输出缓冲区的大小
+ */
+static
+xwer_t xwlz_put_seq(const xwu8_t * lit, xwsz_t litlen,
+                    xwsz_t offset, xwsz_t mlen,
+                    xwu8_t dst[], xwsz_t * op, xwsz_t dstsize)
+{
+        xwsz_t need;
+        xwsz_t pos;
+        xwu8_t token;
+
+        need = 1U + xwlz_extsize(litlen) + litlen;
+        if (offset > 0U) {
+                mlen -= XWLZ_MINMATCH;
+                need += 2U + xwlz_extsize(mlen);
+        }
+        pos = *op;
+        if (need > (dstsize - pos)) {
+                return -ENOSPC;
+        }
+        token = (xwu8_t)(((litlen < XWLZ_RUNMSK) ? litlen : XWLZ_RUNMSK) << 4U);
+        if (offset > 0U) {
+                token |= (xwu8_t)((mlen < XWLZ_RUNMSK) ? mlen : XWLZ_RUNMSK);
+        }
+        dst[pos] = token;
+        pos++;
+        pos += xwlz_put_ext(&dst[pos], litlen);
+        memcpy(&dst[pos], lit, litlen);
+        pos += litlen;
+        if (offset > 0U) {
+                dst[pos] = (xwu8_t)(offset & 0xFFU);
+                dst[pos + 1U] = (xwu8_t)(offset >> 8U);
+                pos += 2U;
+                pos += xwlz_put_ext(&dst[pos], mlen);
+        }
+        *op = pos;
+        return XWOK;
+}
+
+xwer_t xwlz_compress(struct xwlz_enc * enc,
+                     const xwu8_t src[], xwsz_t srcsize,
+                     xwu8_t dst[], xwsz_t * dstsize)
+{
+        xwsz_t ip;
+        xwsz_t anchor;
+        xwsz_t ref;
+        xwsz_t mlen;
+        xwsz_t mlimit;
+        xwsz_t op;
+        xwsq_t h;
+        xwu32_t seq;
+        xwer_t rc;
+
+        if ((NULL == enc) || (NULL == src) || (NULL == dst) || (NULL == dstsize)) {
+                rc = -EFAULT;
+                goto err_nullptr;
+        }
+        if (srcsize > XWLZ_MAX_SRCSIZE) {
+                rc = -E2BIG;
+                goto err_2big;
+        }
+
+        op = 0;
+        anchor = 0;
+        if (srcsize > XWLZ_MFLIMIT) {
+                memset(enc->htbl, 0, sizeof(enc->htbl));
+                mlimit = srcsize - XWLZ_LASTLITERALS;
+                ip = 1;
+                while ((ip + XWLZ_MFLIMIT) <= srcsize) {
+                        seq = xwlz_read32(&src[ip]);
+                        h = xwlz_hash(seq);
+                        ref = enc->htbl[h];
+                        enc->htbl[h] = (xwu16_t)ip;
+                        if ((ref >= ip) || ((ip - ref) > XWLZ_MAX_OFFSET) ||
+                            (xwlz_read32(&src[ref]) != seq)) {
+                                ip++;
+                                continue;
+                        }
+                        /* 向前扩展匹配 */
+                        while ((ip > anchor) && (ref > 0U) &&
+                               (src[ip - 1U] == src[ref - 1U])) {
+                                ip--;
+                                ref--;
+                        }
+                        /* 向后扩展匹配 */
+                        mlen = XWLZ_MINMATCH;
+                        while (((ip + mlen) < mlimit) &&
+                               (src[ip + mlen] == src[ref + mlen])) {
+                                mlen++;
+                        }
+                        rc = xwlz_put_seq(&src[anchor], ip - anchor, ip - ref, mlen,
+                                          dst, &op, *dstsize);
+                        if (rc < 0) {
+                                goto err_nospc;
+                        }
+                        ip += mlen;
+                        anchor = ip;
+                        if ((ip + XWLZ_MFLIMIT) <= srcsize) {
+                                /* 补充匹配内部的位置，提高下一次命中的概率 */
+                                h = xwlz_hash(xwlz_read32(&src[ip - 2U]));
+                                enc->htbl[h] = (xwu16_t)(ip - 2U);
+                        }
+                }
+        }
+        rc = xwlz_put_seq(&src[anchor], srcsize - anchor, 0, 0, dst, &op, *dstsize);
+        if (rc < 0) {
+                goto err_nospc;
+        }
+        *dstsize = op;
+        return XWOK;
+
+err_nospc:
+err_2big:
+err_nullptr:
+        return rc;
+}
+
+/**
+ * @brief 读取长度字段的扩展字节
+ */
+static
+xwer_t xwlz_get_ext(const xwu8_t src[], xwsz_t srcsize, xwsz_t * ip, xwsz_t * len)
+{
+        xwu8_t b;
+
+        do {
+                if (*ip >= srcsize) {
+                        return -EBADMSG;
+                }
+                b = src[*ip];
+                (*ip)++;
+                *len += b;
+        } while (255U == b);
+        return XWOK;
+}
+
+xwer_t xwlz_decompress(const xwu8_t src[], xwsz_t srcsize,
+                       xwu8_t dst[], xwsz_t * dstsize)
+{
+        xwsz_t ip;
+        xwsz_t op;
+        xwsz_t len;
+        xwsz_t offset;
+        xwsz_t ref;
+        xwu8_t token;
+        xwer_t rc;
+
+        if ((NULL == src) || (NULL == dst) || (NULL == dstsize)) {
+                rc = -EFAULT;
+                goto err_nullptr;
+        }
+
+        ip = 0;
+        op = 0;
+        while (ip < srcsize) {
+                token = src[ip];
+                ip++;
+                /* 字面量 */
+                len = (xwsz_t)token >> 4U;
+                if (XWLZ_RUNMSK == len) {
+                        rc = xwlz_get_ext(src, srcsize, &ip, &len);
+                        if (rc < 0) {
+                                goto err_fmt;
+                        }
+                }
+                if (len > (srcsize - ip)) {
+                        rc = -EBADMSG;
+                        goto err_fmt;
+                }
+                if (len > (*dstsize - op)) {
+                        memcpy(&dst[op], &src[ip], *dstsize - op);
+                        op = *dstsize;
+                        rc = -ENOSPC;
+                        goto err_nospc;
+                }
+                memcpy(&dst[op], &src[ip], len);
+                ip += len;
+                op += len;
+                if (ip == srcsize) {
+                        /* 最后一个序列 */
+                        break;
+                }
+                /* 匹配 */
+                if (2U > (srcsize - ip)) {
+                        rc = -EBADMSG;
+                        goto err_fmt;
+                }
+                offset = (xwsz_t)src[ip] | ((xwsz_t)src[ip + 1U] << 8U);
+                ip += 2U;
+                if ((0U == offset) || (offset > op)) {
+                        rc = -EBADMSG;
+                        goto err_fmt;
+                }
+                len = (xwsz_t)token & XWLZ_RUNMSK;
+                if (XWLZ_RUNMSK == len) {
+                        rc = xwlz_get_ext(src, srcsize, &ip, &len);
+                        if (rc < 0) {
+                                goto err_fmt;
+                        }
+                }
+                len += XWLZ_MINMATCH;
+                if (len > (*dstsize - op)) {
+                        len = *dstsize - op;
+                        rc = -ENOSPC;
+                } else {
+                        rc = XWOK;
+                }
+                /* 匹配可以与输出重叠，只能逐字节复制 */
+                ref = op - offset;
+                while (len > 0U) {
+                        dst[op] = dst[ref];
+                        op++;
+                        ref++;
+                        len--;
+                }
+                if (rc < 0) {
+                        goto err_nospc;
+                }
+        }
+        *dstsize = op;
+        return XWOK;
+
+err_nospc:
+        *dstsize = op;
+err_fmt:
+err_nullptr:
+        return rc;
+}
+
+/**
+ * @} xwlz
+ */
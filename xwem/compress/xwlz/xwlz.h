@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @brief XWLZ：轻量级LZ压缩算法
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#ifndef __xwem_compress_xwlz_xwlz_h__
+#define __xwem_compress_xwlz_xwlz_h__
+
+#include <xwos/standard.h>
+
+/**
+ * @defgroup xwlz XWLZ
+ * 面向MCU的轻量级LZ压缩算法，一次压缩或解压一整块内存：
+ *
+ * + 压缩时只需要一个大小固定的哈希表 @ref xwlz_enc 作为工作内存，
+ *   不需要动态内存，也不需要滑动窗口缓冲区（输入数据本身就是窗口）；
+ * + 解压时不需要任何工作内存，输出缓冲区本身就是窗口；
+ * + 压缩数据的格式与LZ4的块格式（Block Format）兼容，
+ *   主机端可以直接使用LZ4的库解压，例如Python的 `lz4.block.decompress()` 。
+ *
+ *
+ * ## 数据格式
+ *
+ * 压缩数据由若干个序列组成，每个序列：
+ *
+ * + 标记字节：高4位为字面量的长度，低4位为匹配长度减4，值为15时后面跟随扩展字节；
+ * + 字面量长度的扩展字节：每个字节累加到长度上，直到遇到不是255的字节；
+ * + 字面量；
+ * + 匹配的偏移：2字节，小端；
+ * + 匹配长度的扩展字节：规则与字面量长度的扩展字节相同。
+ *
+ * 最后一个序列只有字面量，没有匹配的偏移与长度。
+ * 最后5个字节总是字面量，最后一个匹配的起始位置距离末尾至少12个字节。
+ * @{
+ */
+
+#define XWLZ_HTBL_ODR           (XWEMCFG_compress_xwlz_HTBL_ODR) /**< 哈希表大小的阶 */
+#define XWLZ_HTBL_SIZE          (1U << XWLZ_HTBL_ODR) /**< 哈希表的大小 */
+#define XWLZ_MAX_SRCSIZE        (0xFFFFU) /**< 一次压缩的最大输入长度 */
+
+/**
+ * @brief 最坏情况下（数据不可压缩）压缩后的长度
+ * @param[in] srcsize: 输入长度
+ */
+#define XWLZ_BOUND(srcsize)     ((srcsize) + ((srcsize) / 255U) + 16U)
+
+/**
+ * @brief 压缩器的工作内存
+ */
+struct xwlz_enc {
+        xwu16_t htbl[XWLZ_HTBL_SIZE]; /**< 4字节序列的哈希值到其最近出现位置的映射 */
+};
+
+/**
+ * @brief XWLZ API：压缩一块数据
+ * @param[in] enc: 压缩器的工作内存
+ * @param[in] src: 输入数据
+ * @param[in] srcsize: 输入长度，不能超过 @ref XWLZ_MAX_SRCSIZE
+ * @param[out] dst: 输出缓冲区
+ * @param[in,out] dstsize: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示输出缓冲区的大小
+ * + (O) 作为输出时，返回压缩后的长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -E2BIG: 输入太长
+ * @retval -ENOSPC: 输出缓冲区不足
+ * @note
+ * + 上下文：任意
+ * + 可重入：多个调用者各自使用不同的工作内存
+ * @details
+ * 输出缓冲区不小于 @ref XWLZ_BOUND 时一定成功。
+ * 调用者通常传入比输入长度小的输出缓冲区，
+ * 返回 `-ENOSPC` 即表示数据不值得压缩。
+ */
+xwer_t xwlz_compress(struct xwlz_enc * enc,
+                     const xwu8_t src[], xwsz_t srcsize,
+                     xwu8_t dst[], xwsz_t * dstsize);
+
+/**
+ * @brief XWLZ API：解压一块数据
+ * @param[in] src: 压缩数据
+ * @param[in] srcsize: 压缩数据的长度
+ * @param[out] dst: 输出缓冲区
+ * @param[in,out] dstsize: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示输出缓冲区的大小
+ * + (O) 作为输出时，返回解压后的长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOSPC: 输出缓冲区不足
+ * @retval -EBADMSG: 压缩数据格式错误
+ * @note
+ * + 上下文：任意
+ * + 可重入
+ * @details
+ * + 不信任输入：任何格式错误的数据都只会返回 `-EBADMSG` ，不会越界读写；
+ * + 输出缓冲区不足时，输出缓冲区被填满，通过 `*dstsize` 返回已解压的长度，
+ *   并返回 `-ENOSPC` 。
+ */
+xwer_t xwlz_decompress(const xwu8_t src[], xwsz_t srcsize,
+                       xwu8_t dst[], xwsz_t * dstsize);
+
+/**
+ * @} xwlz
+ */
+
+#endif /* xwem/compress/xwlz/xwlz.h */
@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @brief XWLUA库：XWOS内核：内存管理
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > Licensed under the Apache License, Version 2.0 (the "License");
+ * > you may not use this file except in compliance with the License.
+ * > You may obtain a copy of the License at
+ * >
+ * >         http://www.apache.org/licenses/LICENSE-2.0
+ * >
+ * > Unless required by applicable law or agreed to in writing, software
+ * > distributed under the License is distributed on an "AS IS" BASIS,
+ * > WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * > See the License for the specific language governing permissions and
+ * > limitations under the License.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/mm/stat.h>
+#include <xwos/mm/mempool/allocator.h>
+#include "xwem/vm/lua/src/lauxlib.h"
+#include "xwem/vm/lua/xwlua/port.h"
+#include "xwem/vm/lua/xwlua/xwos/mm.h"
+
+#define XWLUA_MM_ODR_NUM        32U
+
+static
+void xwlua_mm_setfield_integer(lua_State * L, const char * k, xwsz_t v)
+{
+        lua_pushinteger(L, (lua_Integer)v);
+        lua_setfield(L, -2, k);
+}
+
+/******** xwos.mm ********/
+int xwlua_mm_stat(lua_State * L)
+{
+        struct xwmm_stat stat;
+        struct xwmm_mempool_ocstat ocstat[XWMM_MEMPOOL_OC_NUM];
+        xwsz_t odrnr[XWLUA_MM_ODR_NUM];
+        xwsz_t i;
+
+        xwmm_mempool_get_stat(xwlua_mempool, &stat);
+        xwmm_mempool_get_ocstat(xwlua_mempool, ocstat, XWMM_MEMPOOL_OC_NUM);
+        xwmm_mempool_get_odrstat(xwlua_mempool, odrnr, XWLUA_MM_ODR_NUM);
+
+        lua_newtable(L);
+        xwlua_mm_setfield_integer(L, "total", stat.total);
+        xwlua_mm_setfield_integer(L, "used", stat.used);
+        xwlua_mm_setfield_integer(L, "peak", stat.peak);
+        xwlua_mm_setfield_integer(L, "largest", stat.largest_free);
+        xwlua_mm_setfield_integer(L, "alloc", stat.alloc_cnt);
+        xwlua_mm_setfield_integer(L, "free", stat.free_cnt);
+        xwlua_mm_setfield_integer(L, "fail", stat.fail_cnt);
+        xwlua_mm_setfield_integer(L, "contention", stat.contention);
+
+        lua_createtable(L, (int)XWMM_MEMPOOL_OC_NUM, 0);
+        for (i = 0; i < XWMM_MEMPOOL_OC_NUM; i++) {
+                lua_createtable(L, 0, 3);
+                xwlua_mm_setfield_integer(L, "objsize", ocstat[i].objsize);
+                xwlua_mm_setfield_integer(L, "capacity", ocstat[i].capacity);
+                xwlua_mm_setfield_integer(L, "idleness", ocstat[i].idleness);
+                lua_rawseti(L, -2, (lua_Integer)i + 1);
+        }
+        lua_setfield(L, -2, "oc");
+
+        lua_createtable(L, (int)XWLUA_MM_ODR_NUM, 0);
+        for (i = 0; i < XWLUA_MM_ODR_NUM; i++) {
+                lua_pushinteger(L, (lua_Integer)odrnr[i]);
+                lua_rawseti(L, -2, (lua_Integer)i + 1);
+        }
+        lua_setfield(L, -2, "page");
+        return 1;
+}
+
+int xwlua_mm_dump(lua_State * L)
+{
+        struct xwmm_stat stat;
+        struct xwmm_mempool_ocstat ocstat[XWMM_MEMPOOL_OC_NUM];
+        xwsz_t odrnr[XWLUA_MM_ODR_NUM];
+        xwsz_t i;
+
+        xwmm_mempool_get_stat(xwlua_mempool, &stat);
+        xwmm_mempool_get_ocstat(xwlua_mempool, ocstat, XWMM_MEMPOOL_OC_NUM);
+        xwmm_mempool_get_odrstat(xwlua_mempool, odrnr, XWLUA_MM_ODR_NUM);
+
+        lua_pushfstring(L,
+                        "mempool: total %I, used %I, peak %I, largest %I\n"
+                        "         alloc %I, free %I, fail %I, contention %I\n",
+                        (lua_Integer)stat.total, (lua_Integer)stat.used,
+                        (lua_Integer)stat.peak, (lua_Integer)stat.largest_free,
+                        (lua_Integer)stat.alloc_cnt, (lua_Integer)stat.free_cnt,
+                        (lua_Integer)stat.fail_cnt, (lua_Integer)stat.contention);
+        lua_writestring(lua_tostring(L, -1), lua_rawlen(L, -1));
+        lua_pop(L, 1);
+        for (i = 0; i < XWMM_MEMPOOL_OC_NUM; i++) {
+                lua_pushfstring(L, "  oc[%I]: capacity %I, idleness %I\n",
+                                (lua_Integer)ocstat[i].objsize,
+                                (lua_Integer)ocstat[i].capacity,
+                                (lua_Integer)ocstat[i].idleness);
+                lua_writestring(lua_tostring(L, -1), lua_rawlen(L, -1));
+                lua_pop(L, 1);
+        }
+        for (i = 0; i < XWLUA_MM_ODR_NUM; i++) {
+                if ((xwsz_t)0 != odrnr[i]) {
+                        lua_pushfstring(L, "  page[%I]: %I\n",
+                                        (lua_Integer)i, (lua_Integer)odrnr[i]);
+                        lua_writestring(lua_tostring(L, -1), lua_rawlen(L, -1));
+                        lua_pop(L, 1);
+                }
+        }
+        return 0;
+}
+
+const luaL_Reg xwlua_mm_libconstructor[] = {
+        {"stat", xwlua_mm_stat},
+        {"dump", xwlua_mm_dump},
+        {NULL, NULL},
+};
+
+void xwlua_os_open_mm(lua_State * L)
+{
+        luaL_newlib(L, xwlua_mm_libconstructor);
+}
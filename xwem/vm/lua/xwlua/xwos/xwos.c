@@ -32,6 +32,7 @@
 #include "xwem/vm/lua/xwlua/xwos/spinlock.h"
 #include "xwem/vm/lua/xwlua/xwos/seqlock.h"
 #include "xwem/vm/lua/xwlua/xwos/pm.h"
+#include "xwem/vm/lua/xwlua/xwos/mm.h"
 
 const luaL_Reg xwlua_os[] = {
         {"skd", NULL},
@@ -46,6 +47,7 @@ const luaL_Reg xwlua_os[] = {
         {"splk", NULL},
         {"sqlk", NULL},
         {"pm", NULL},
+        {"mm", NULL},
         {NULL, NULL},
 };
 
@@ -76,5 +78,7 @@ LUAMOD_API int xwlua_open_os(lua_State * L)
         lua_setfield(L, -2, "sqlk");
         xwlua_os_open_pm(L);
         lua_setfield(L, -2, "pm");
+        xwlua_os_open_mm(L);
+        lua_setfield(L, -2, "mm");
         return 1;
 }
@@ -0,0 +1,273 @@
+/**
+ * @file
+ * @brief 无栈协程
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/lib/bclst.h>
+#include <xwos/osal/time.h>
+#include <xwos/osal/sync/sel.h>
+#include <xwmd/coro/mif.h>
+
+/**
+ * @brief 将等待的协程放入信号槽的等待链表与超时链表
+ * @param[in] sched: 协程调度器的指针
+ * @param[in] co: 协程的指针
+ */
+static __xwmd_code
+void xwcoro_sched_enqueue_wait(struct xwcoro_sched * sched, struct xwcoro * co)
+{
+        struct xwcoro * c;
+
+        if (co->pos >= 0) {
+                xwlib_bclst_add_tail(&sched->slot[co->pos], &co->rdnode);
+                xwbmpop_s1i(sched->msk, (xwsq_t)co->pos);
+        }
+        if (XWTM_MAX != co->to) {
+                /* 超时链表按时间点升序排列，相同的时间点按先来后到排列 */
+                xwlib_bclst_itr_next_entry(c, &sched->tmlist, struct xwcoro, tmnode) {
+                        if (xwtm_cmp(c->to, co->to) > 0) {
+                                break;
+                        }
+                }
+                xwlib_bclst_add_front(&co->tmnode, &c->tmnode);
+        }
+}
+
+/**
+ * @brief 唤醒等待中的协程
+ * @param[in] sched: 协程调度器的指针
+ * @param[in] co: 协程的指针
+ * @param[in] wkuprs: 唤醒原因
+ */
+static __xwmd_code
+void xwcoro_sched_wakeup(struct xwcoro_sched * sched, struct xwcoro * co,
+                         xwsq_t wkuprs)
+{
+        if (co->pos >= 0) {
+                xwlib_bclst_del_init(&co->rdnode);
+                if (xwlib_bclst_tst_empty(&sched->slot[co->pos])) {
+                        xwbmpop_c0i(sched->msk, (xwsq_t)co->pos);
+                }
+        }
+        if (XWTM_MAX != co->to) {
+                xwlib_bclst_del_init(&co->tmnode);
+        }
+        co->waiting = false;
+        co->wkuprs = wkuprs;
+        xwlib_bclst_add_tail(&sched->rdlist, &co->rdnode);
+}
+
+/**
+ * @brief 运行一遍就绪的协程
+ * @param[in] sched: 协程调度器的指针
+ * @details
+ * 只运行进入此函数时已经就绪的协程，让出CPU的协程被放回就绪链表，
+ * 下一遍再运行，以免一直让出CPU的协程阻止调度器检测信号选择器与超时。
+ */
+static __xwmd_code
+void xwcoro_sched_run_ready(struct xwcoro_sched * sched)
+{
+        struct xwlib_bclst_head pass;
+        struct xwcoro * co;
+        xwsq_t st;
+
+        if (xwlib_bclst_tst_empty(&sched->rdlist)) {
+                return;
+        }
+        xwlib_bclst_replace_init(&pass, &sched->rdlist);
+        while (!xwlib_bclst_tst_empty(&pass)) {
+                co = xwlib_bclst_first_entry(&pass, struct xwcoro, rdnode);
+                xwlib_bclst_del_init(&co->rdnode);
+                sched->current = co;
+                st = co->func(co, co->arg);
+                sched->current = NULL;
+                if ((xwsq_t)XWCORO_EXITED == st) {
+                        /* 协程可能已经释放了自己的内存，不可再访问co */
+                        sched->cnt--;
+                } else if (co->waiting) {
+                        xwcoro_sched_enqueue_wait(sched, co);
+                } else {
+                        co->wkuprs = (xwsq_t)XWCORO_WKUPRS_NONE;
+                        xwlib_bclst_add_tail(&sched->rdlist, &co->rdnode);
+                }
+        }
+}
+
+/**
+ * @brief 唤醒被触发的信号槽上所有等待的协程
+ * @param[in] sched: 协程调度器的指针
+ */
+static __xwmd_code
+void xwcoro_sched_wakeup_triggered(struct xwcoro_sched * sched)
+{
+        struct xwcoro * co;
+        xwssq_t pos;
+
+        pos = xwbmpop_ffs(sched->trg, sched->num);
+        while (pos >= 0) {
+                xwbmpop_c0i(sched->trg, (xwsq_t)pos);
+                xwlib_bclst_itr_next_entry_del(co, &sched->slot[pos],
+                                               struct xwcoro, rdnode) {
+                        xwcoro_sched_wakeup(sched, co, (xwsq_t)XWCORO_WKUPRS_SIGNAL);
+                }
+                pos = xwbmpop_ffs(sched->trg, sched->num);
+        }
+}
+
+/**
+ * @brief 唤醒所有已经超时的协程
+ * @param[in] sched: 协程调度器的指针
+ */
+static __xwmd_code
+void xwcoro_sched_wakeup_timedout(struct xwcoro_sched * sched)
+{
+        struct xwcoro * co;
+        xwtm_t now;
+
+        now = xwtm_now();
+        while (!xwlib_bclst_tst_empty(&sched->tmlist)) {
+                co = xwlib_bclst_first_entry(&sched->tmlist, struct xwcoro, tmnode);
+                if (xwtm_cmp(co->to, now) > 0) {
+                        break;
+                }
+                xwcoro_sched_wakeup(sched, co, (xwsq_t)XWCORO_WKUPRS_TIMEDOUT);
+        }
+}
+
+__xwmd_api
+xwer_t xwcoro_sched_init(struct xwcoro_sched * sched, xwsz_t num,
+                         xwbmp_t * bmp, struct xwlib_bclst_head * slot)
+{
+        xwsz_t bmpnum;
+        xwsq_t i;
+        xwer_t rc;
+
+        XWOS_VALIDATE((sched), "nullptr", -EFAULT);
+        XWOS_VALIDATE((bmp), "nullptr", -EFAULT);
+        XWOS_VALIDATE((slot), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num > 0), "zero-num", -ESIZE);
+
+        bmpnum = BITS_TO_XWBMP_T(num);
+        xwbmpop_c0all(bmp, bmpnum * 4U * BITS_PER_XWBMP_T);
+        sched->num = num;
+        sched->msk = &bmp[bmpnum * 2U];
+        sched->trg = &bmp[bmpnum * 3U];
+        sched->slot = slot;
+        for (i = 0; i < num; i++) {
+                xwlib_bclst_init_head(&slot[i]);
+        }
+        xwlib_bclst_init_head(&sched->rdlist);
+        xwlib_bclst_init_head(&sched->tmlist);
+        sched->cnt = 0;
+        sched->current = NULL;
+        rc = xwos_sel_init(&sched->sel, num, &bmp[0], &bmp[bmpnum]);
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcoro_sched_fini(struct xwcoro_sched * sched)
+{
+        XWOS_VALIDATE((sched), "nullptr", -EFAULT);
+
+        return xwos_sel_fini(&sched->sel);
+}
+
+__xwmd_api
+void xwcoro_init(struct xwcoro * co, xwcoro_f func, void * arg)
+{
+        xwlib_bclst_init_node(&co->rdnode);
+        xwlib_bclst_init_node(&co->tmnode);
+        co->sched = NULL;
+        co->func = func;
+        co->arg = arg;
+        co->lc = 0;
+        co->waiting = false;
+        co->pos = -1;
+        co->to = XWTM_MAX;
+        co->wkuprs = (xwsq_t)XWCORO_WKUPRS_NONE;
+}
+
+__xwmd_api
+xwer_t xwcoro_sched_spawn(struct xwcoro_sched * sched, struct xwcoro * co)
+{
+        XWOS_VALIDATE((sched), "nullptr", -EFAULT);
+        XWOS_VALIDATE((co), "nullptr", -EFAULT);
+        XWOS_VALIDATE((co->func), "nullptr", -EFAULT);
+
+        co->sched = sched;
+        sched->cnt++;
+        xwlib_bclst_add_tail(&sched->rdlist, &co->rdnode);
+        return XWOK;
+}
+
+__xwmd_api
+xwer_t xwcoro_wait(struct xwcoro * co, xwssq_t pos)
+{
+        XWOS_VALIDATE((co), "nullptr", -EFAULT);
+        XWOS_VALIDATE((co->sched), "nullptr", -EFAULT);
+        XWOS_VALIDATE((pos < (xwssq_t)co->sched->num), "out-of-range", -ECHRNG);
+
+        co->pos = (pos < 0) ? -1 : pos;
+        co->waiting = true;
+        co->wkuprs = (xwsq_t)XWCORO_WKUPRS_NONE;
+        return XWOK;
+}
+
+__xwmd_api
+xwer_t xwcoro_sched_run(struct xwcoro_sched * sched)
+{
+        struct xwcoro * co;
+        xwtm_t to;
+        xwer_t rc;
+
+        XWOS_VALIDATE((sched), "nullptr", -EFAULT);
+
+        rc = XWOK;
+        while (true) {
+                xwcoro_sched_run_ready(sched);
+                if ((xwsz_t)0 == sched->cnt) {
+                        rc = XWOK;
+                        break;
+                }
+                if (!xwlib_bclst_tst_empty(&sched->rdlist)) {
+                        /* 仍有协程就绪，只检测选择信号，不等待 */
+                        rc = xwos_sel_tryselect(&sched->sel, sched->msk, sched->trg);
+                        if (XWOK == rc) {
+                                xwcoro_sched_wakeup_triggered(sched);
+                        }
+                        rc = XWOK;
+                } else {
+                        if (xwlib_bclst_tst_empty(&sched->tmlist)) {
+                                to = XWTM_MAX;
+                        } else {
+                                co = xwlib_bclst_first_entry(&sched->tmlist,
+                                                             struct xwcoro, tmnode);
+                                to = co->to;
+                        }
+                        if ((XWTM_MAX == to) &&
+                            (xwbmpop_ffs(sched->msk, sched->num) < 0)) {
+                                rc = -EDEADLK;
+                                break;
+                        }
+                        rc = xwos_sel_select_to(&sched->sel, sched->msk, sched->trg, to);
+                        if (XWOK == rc) {
+                                xwcoro_sched_wakeup_triggered(sched);
+                        } else if (-ETIMEDOUT == rc) {
+                                rc = XWOK;
+                        } else {
+                                break;
+                        }
+                }
+                xwcoro_sched_wakeup_timedout(sched);
+        }
+        return rc;
+}
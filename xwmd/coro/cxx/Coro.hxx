@@ -0,0 +1,464 @@
+/**
+ * @file
+ * @brief xwmd::coro::Task & xwmd::coro::Scheduler
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwmd_coro_cxx_Coro_hxx__
+#define __xwmd_coro_cxx_Coro_hxx__
+
+#if !defined(__cpp_impl_coroutine)
+#  error "xwmd/coro/cxx/Coro.hxx requires C++20 coroutines (-std=gnu++20)!"
+#endif
+
+#include <coroutine>
+
+extern "C" {
+#include "xwmd/coro/mif.h"
+}
+#include "xwos/cxx/Bmp.hxx"
+#include "xwos/cxx/sync/Sem.hxx"
+#include "xwos/cxx/sync/Flg.hxx"
+#include "xwos/cxx/sync/Cond.hxx"
+#if defined(XWMDCFG_isc_xwcq_CXX) && (1 == XWMDCFG_isc_xwcq_CXX)
+#  include "xwmd/isc/xwcq/cxx/Xwcq.hxx"
+#endif
+
+namespace xwmd {
+namespace coro {
+
+/**
+ * @defgroup xwmd_coro_cxx 无栈协程 C++20 Lib
+ * @ingroup xwmd_coro
+ *
+ * C++20的协程函数的返回类型为 `xwmd::coro::Task` ，通过 `co_await` 等待同步对象：
+ *
+ * ```Cpp
+ * #include "xwmd/coro/cxx/Coro.hxx"
+ *
+ * xwos::sync::SSem sem;
+ * xwmd::coro::Scheduler<8> sched;
+ *
+ * xwmd::coro::Task session(int id)
+ * {
+ *     while (true) {
+ *         xwer_t rc = co_await xwmd::coro::wait(sem, 0, xwtm_ft(xwtm_ms(100)));
+ *         if (-ETIMEDOUT == rc) {
+ *             co_await xwmd::coro::sleep(xwtm_ms(10));
+ *         }
+ *     }
+ * }
+ *
+ * void thd()
+ * {
+ *     sched.bind(sem, 0);
+ *     for (int i = 0; i < 1000; i++) {
+ *         sched.spawn(session(i));
+ *     }
+ *     sched.run();
+ * }
+ * ```
+ *
+ * 协程帧通过 `operator new` 申请内存。
+ * 使用此头文件的模块需要在 `xwmo.mk` 中增加编译选项 `XWMO_CXXFLAGS += -std=gnu++20` 。
+ *
+ * @{
+ */
+
+/**
+ * @brief 可等待对象的基类
+ * @details
+ * 协程被唤醒后，调度器先调用 `poll()` 尝试获取同步对象，
+ * 只有获取成功或超时才恢复协程的运行，获取失败则继续等待，协程不会被虚假唤醒。
+ */
+class Awaiter
+{
+  public:
+    xwssq_t mPos; /**< 等待的信号槽 */
+    xwtm_t mTo; /**< 期望唤醒的时间点 */
+    xwer_t mRc; /**< 等待的结果 */
+
+  protected:
+    Awaiter(xwssq_t pos, xwtm_t to) : mPos(pos), mTo(to), mRc(XWOK) {}
+
+  public:
+    /**
+     * @brief 尝试获取同步对象
+     * @param[in] co: 被唤醒的协程，首次尝试时为 `nullptr`
+     * @return 是否获取成功
+     */
+    virtual bool poll(struct xwcoro * co) = 0;
+
+    bool await_ready() {
+        bool ready = poll(nullptr);
+        if (ready) {
+            mRc = XWOK;
+        }
+        return ready;
+    }
+
+    template<typename TPromise>
+    bool await_suspend(std::coroutine_handle<TPromise> handle) {
+        TPromise & promise = handle.promise();
+        promise.mCoro.to = mTo;
+        mRc = xwcoro_wait(&promise.mCoro, mPos);
+        if (XWOK == mRc) {
+            promise.mAwaiter = this;
+        }
+        return (XWOK == mRc);
+    }
+
+    xwer_t await_resume() { return mRc; }
+};
+
+/**
+ * @brief 协程函数的返回类型
+ * @details
+ * `Task` 被 `Scheduler::spawn()` 加入调度器后，协程帧由调度器管理，
+ * 协程结束时自动释放；未加入调度器的 `Task` 析构时释放协程帧。
+ */
+class Task
+{
+  public:
+    struct promise_type {
+        struct xwcoro mCoro; /**< C语言协程结构体 */
+        Awaiter * mAwaiter; /**< 正在等待的可等待对象 */
+
+        promise_type() : mAwaiter(nullptr) {}
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() {}
+    };
+
+  private:
+    std::coroutine_handle<promise_type> mHandle;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+
+  public:
+    Task(Task && other) : mHandle(other.mHandle) { other.mHandle = nullptr; }
+    Task(const Task &) = delete;
+    Task & operator=(const Task &) = delete;
+    ~Task() {
+        if (mHandle) {
+            mHandle.destroy();
+        }
+    }
+
+    /**
+     * @brief 取出协程帧的所有权
+     */
+    std::coroutine_handle<promise_type> release() {
+        std::coroutine_handle<promise_type> handle = mHandle;
+        mHandle = nullptr;
+        return handle;
+    }
+
+    /**
+     * @brief C语言协程函数的入口
+     */
+    static xwsq_t sEntry(struct xwcoro * co, void * arg) {
+        promise_type * promise = static_cast<promise_type *>(arg);
+        Awaiter * awaiter = promise->mAwaiter;
+        std::coroutine_handle<promise_type> handle;
+
+        if (nullptr != awaiter) {
+            if (awaiter->poll(co)) {
+                awaiter->mRc = XWOK;
+            } else if ((xwsq_t)XWCORO_WKUPRS_TIMEDOUT == co->wkuprs) {
+                awaiter->mRc = -ETIMEDOUT;
+            } else {
+                xwcoro_wait(co, awaiter->mPos);
+                return XWCORO_YIELDED;
+            }
+            promise->mAwaiter = nullptr;
+        }
+        handle = std::coroutine_handle<promise_type>::from_promise(*promise);
+        handle.resume();
+        if (handle.done()) {
+            handle.destroy();
+            return XWCORO_EXITED;
+        }
+        return XWCORO_YIELDED;
+    }
+};
+
+/**
+ * @brief 让出CPU的可等待对象
+ */
+class YieldAwaiter
+{
+  public:
+    bool await_ready() { return false; }
+    void await_suspend(std::coroutine_handle<>) {}
+    void await_resume() {}
+};
+
+/**
+ * @brief 睡眠的可等待对象
+ */
+class SleepAwaiter : public Awaiter
+{
+  public:
+    explicit SleepAwaiter(xwtm_t to) : Awaiter(-1, to) {}
+    bool poll(struct xwcoro * co) override { XWOS_UNUSED(co); return false; }
+    void await_resume() {}
+};
+
+/**
+ * @brief 信号量的可等待对象
+ */
+class SemAwaiter : public Awaiter
+{
+  private:
+    xwos::sync::Sem & mSem;
+  public:
+    SemAwaiter(xwos::sync::Sem & sem, xwssq_t pos, xwtm_t to)
+        : Awaiter(pos, to), mSem(sem) {}
+    bool poll(struct xwcoro * co) override {
+        XWOS_UNUSED(co);
+        return (XWOK == xwos_sem_trywait(mSem.getXwosObj()));
+    }
+};
+
+/**
+ * @brief 事件标志的可等待对象
+ */
+template<xwsz_t TNum>
+class FlgAwaiter : public Awaiter
+{
+  private:
+    xwos::sync::Flg<TNum> & mFlg;
+    enum xwos::sync::Flg<TNum>::Trigger mTrigger;
+    bool mConsumption;
+    xwos::Bmp<TNum> * mOrigin;
+    xwos::Bmp<TNum> * mMsk;
+  public:
+    FlgAwaiter(xwos::sync::Flg<TNum> & flg, xwssq_t pos,
+               enum xwos::sync::Flg<TNum>::Trigger trigger, bool consumption,
+               xwos::Bmp<TNum> * origin, xwos::Bmp<TNum> * msk, xwtm_t to)
+        : Awaiter(pos, to), mFlg(flg), mTrigger(trigger), mConsumption(consumption)
+        , mOrigin(origin), mMsk(msk) {}
+    bool poll(struct xwcoro * co) override {
+        XWOS_UNUSED(co);
+        return (XWOK == xwos_flg_trywait(mFlg.getXwosObj(),
+                                         (enum xwos_flg_trigger_em)mTrigger,
+                                         mConsumption, mOrigin->mData, mMsk->mData));
+    }
+};
+
+/**
+ * @brief 条件量的可等待对象
+ * @details
+ * 调度器的所有协程都运行在同一个线程中，因此等待条件量时不需要锁。
+ */
+class CondAwaiter : public Awaiter
+{
+  public:
+    CondAwaiter(xwssq_t pos, xwtm_t to) : Awaiter(pos, to) {}
+    bool poll(struct xwcoro * co) override {
+        return ((nullptr != co) && ((xwsq_t)XWCORO_WKUPRS_SIGNAL == co->wkuprs));
+    }
+};
+
+#if defined(XWMDCFG_isc_xwcq_CXX) && (1 == XWMDCFG_isc_xwcq_CXX)
+/**
+ * @brief 循环队列的可等待对象
+ */
+template<xwsz_t TSlotNum, typename T>
+class XwcqAwaiter : public Awaiter
+{
+  private:
+    xwisc::Xwcq<TSlotNum, T> & mCq;
+    T * mData;
+    xwsz_t * mSize;
+  public:
+    XwcqAwaiter(xwisc::Xwcq<TSlotNum, T> & cq, xwssq_t pos,
+                T * data, xwsz_t * size, xwtm_t to)
+        : Awaiter(pos, to), mCq(cq), mData(data), mSize(size) {}
+    bool poll(struct xwcoro * co) override {
+        XWOS_UNUSED(co);
+        return (XWOK == xwcq_trydq(mCq.get(), (xwu8_t *)mData, mSize));
+    }
+};
+#endif
+
+/**
+ * @brief 让出CPU
+ */
+inline YieldAwaiter yield() { return YieldAwaiter(); }
+
+/**
+ * @brief 睡眠一段时间
+ * @param[in] dur: 睡眠的时间
+ */
+inline SleepAwaiter sleep(xwtm_t dur) { return SleepAwaiter(xwtm_ft(dur)); }
+
+/**
+ * @brief 睡眠到时间点
+ * @param[in] to: 期望唤醒的时间点
+ */
+inline SleepAwaiter sleepTo(xwtm_t to) { return SleepAwaiter(to); }
+
+/**
+ * @brief 等待并获取信号量
+ * @param[in] sem: 信号量，必须已经绑定到调度器上
+ * @param[in] pos: 信号量绑定的信号槽
+ * @param[in] to: 期望唤醒的时间点
+ * @return 可等待对象， `co_await` 的结果为错误码： `XWOK` 或 `-ETIMEDOUT`
+ */
+inline SemAwaiter wait(xwos::sync::Sem & sem, xwssq_t pos, xwtm_t to = XWTM_MAX)
+{
+    return SemAwaiter(sem, pos, to);
+}
+
+/**
+ * @brief 等待事件标志
+ * @param[in] flg: 事件标志，必须已经绑定到调度器上
+ * @param[in] pos: 事件标志绑定的信号槽
+ * @param[in] trigger: 事件触发条件
+ * @param[in] consumption: 事件触发后是否清除事件
+ * @param[in,out] origin: 参考 `xwos_flg_trywait()`
+ * @param[in] msk: 事件标志位图掩码
+ * @param[in] to: 期望唤醒的时间点
+ * @return 可等待对象， `co_await` 的结果为错误码： `XWOK` 或 `-ETIMEDOUT`
+ */
+template<xwsz_t TNum>
+FlgAwaiter<TNum> wait(xwos::sync::Flg<TNum> & flg, xwssq_t pos,
+                      enum xwos::sync::Flg<TNum>::Trigger trigger, bool consumption,
+                      xwos::Bmp<TNum> * origin, xwos::Bmp<TNum> * msk,
+                      xwtm_t to = XWTM_MAX)
+{
+    return FlgAwaiter<TNum>(flg, pos, trigger, consumption, origin, msk, to);
+}
+
+/**
+ * @brief 等待条件量被单播或广播
+ * @param[in] cond: 条件量，必须已经绑定到调度器上
+ * @param[in] pos: 条件量绑定的信号槽
+ * @param[in] to: 期望唤醒的时间点
+ * @return 可等待对象， `co_await` 的结果为错误码： `XWOK` 或 `-ETIMEDOUT`
+ */
+inline CondAwaiter wait(xwos::sync::Cond & cond, xwssq_t pos, xwtm_t to = XWTM_MAX)
+{
+    XWOS_UNUSED(cond);
+    return CondAwaiter(pos, to);
+}
+
+#if defined(XWMDCFG_isc_xwcq_CXX) && (1 == XWMDCFG_isc_xwcq_CXX)
+/**
+ * @brief 等待从循环队列的 **首端** 接收数据
+ * @param[in] cq: 循环队列，必须已经绑定到调度器上
+ * @param[in] pos: 循环队列绑定的信号槽
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 参考 `xwcq_trydq()`
+ * @param[in] to: 期望唤醒的时间点
+ * @return 可等待对象， `co_await` 的结果为错误码： `XWOK` 或 `-ETIMEDOUT`
+ */
+template<xwsz_t TSlotNum, typename T>
+XwcqAwaiter<TSlotNum, T> dq(xwisc::Xwcq<TSlotNum, T> & cq, xwssq_t pos,
+                            T * data, xwsz_t * size, xwtm_t to = XWTM_MAX)
+{
+    return XwcqAwaiter<TSlotNum, T>(cq, pos, data, size, to);
+}
+#endif
+
+/**
+ * @brief 协程调度器
+ * @tparam TNum 信号槽的数量
+ */
+template<xwsz_t TNum>
+class Scheduler
+{
+  private:
+    struct xwcoro_sched mSched;
+    xwbmp_t mBmp[XWCORO_SCHED_BMP_NUM(TNum)];
+    struct xwlib_bclst_head mSlot[TNum];
+    xwer_t mCtorRc;
+
+  public:
+    Scheduler() { mCtorRc = xwcoro_sched_init(&mSched, TNum, mBmp, mSlot); }
+    ~Scheduler() { xwcoro_sched_fini(&mSched); }
+    xwer_t getCtorRc() { return mCtorRc; } /**< 获取构造的结果 */
+
+    /**
+     * @brief 将协程加入调度器
+     * @param[in] task: 协程函数返回的 `Task`
+     * @note
+     * + 上下文：运行调度器的线程，包括协程中
+     */
+    xwer_t spawn(Task && task) {
+        std::coroutine_handle<Task::promise_type> handle = task.release();
+        Task::promise_type & promise = handle.promise();
+        xwcoro_init(&promise.mCoro, Task::sEntry, &promise);
+        return xwcoro_sched_spawn(&mSched, &promise.mCoro);
+    }
+
+    /**
+     * @brief 运行调度器，直到所有协程退出
+     * @return 错误码，参考 `xwcoro_sched_run()`
+     * @note
+     * + 上下文：线程
+     */
+    xwer_t run() { return xwcoro_sched_run(&mSched); }
+
+    /**
+     * @brief 绑定信号量到调度器的信号槽
+     */
+    xwer_t bind(xwos::sync::Sem & sem, xwsq_t pos) {
+        return xwos_sem_bind(sem.getXwosObj(), xwcoro_sched_get_sel(&mSched), pos);
+    }
+
+    /**
+     * @brief 绑定事件标志到调度器的信号槽
+     */
+    template<xwsz_t TFlgNum>
+    xwer_t bind(xwos::sync::Flg<TFlgNum> & flg, xwsq_t pos) {
+        return xwos_flg_bind(flg.getXwosObj(), xwcoro_sched_get_sel(&mSched), pos);
+    }
+
+    /**
+     * @brief 绑定条件量到调度器的信号槽
+     */
+    xwer_t bind(xwos::sync::Cond & cond, xwsq_t pos) {
+        return xwos_cond_bind(cond.getXwosObj(), xwcoro_sched_get_sel(&mSched), pos);
+    }
+
+#if defined(XWMDCFG_isc_xwcq_CXX) && (1 == XWMDCFG_isc_xwcq_CXX)
+    /**
+     * @brief 绑定循环队列到调度器的信号槽
+     */
+    template<xwsz_t TSlotNum, typename T>
+    xwer_t bind(xwisc::Xwcq<TSlotNum, T> & cq, xwsq_t pos) {
+        return xwcq_bind(cq.get(), xwcoro_sched_get_sel(&mSched), pos);
+    }
+#endif
+
+    /**
+     * @brief 获取XWOS对象指针
+     */
+    struct xwcoro_sched * getXwosObj() { return &mSched; }
+
+  private:
+    static void * operator new(xwsz_t sz) = delete;
+    void operator delete(void * obj) = delete;
+};
+
+/**
+ * @} xwmd_coro_cxx
+ */
+
+} // namespace coro
+} // namespace xwmd
+
+#endif /* xwmd/coro/cxx/Coro.hxx */
@@ -0,0 +1,414 @@
+/**
+ * @file
+ * @brief 无栈协程：模块接口
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwmd_coro_mif_h__
+#define __xwmd_coro_mif_h__
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/lib/bclst.h>
+#include <xwos/osal/time.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwos/osal/sync/flg.h>
+#include <xwos/osal/sync/cond.h>
+#include <xwos/osal/sync/sel.h>
+#if defined(XWMDCFG_isc_xwcq) && (1 == XWMDCFG_isc_xwcq)
+#  include <xwmd/isc/xwcq/mif.h>
+#endif
+
+/**
+ * @defgroup xwmd_coro 无栈协程
+ * @ingroup xwmd
+ * 每个XWOS线程都需要独立的线程栈，当需要同时处理成百上千个会话时，内存无法满足。
+ * 无栈协程调度器可在 **一个线程** 中运行任意多个协程，每个协程只占用一个
+ * `struct xwcoro` 结构体的内存，等待时不占用线程栈。
+ *
+ *
+ * ## 调度器
+ *
+ * + `xwcoro_sched_init()` ：初始化调度器
+ * + `xwcoro_sched_fini()` ：销毁调度器
+ * + `xwcoro_sched_get_sel()` ：获取调度器的信号选择器
+ * + `xwcoro_sched_spawn()` ：将协程加入调度器
+ * + `xwcoro_sched_run()` ：运行调度器，直到所有协程退出
+ *
+ * 调度器内部有一个 [信号选择器](../Docs/TechRefManual/Sync/Sel) 。
+ * 信号量、事件标志、条件量、循环队列等同步对象需要先绑定到调度器的信号选择器上，
+ * 协程才可以等待它们。调度器不会轮询同步对象，所有的唤醒都来源于信号选择器：
+ * 当所有协程都在等待时，调度器的线程阻塞在 `xwos_sel_select_to()` 上，
+ * 信号选择器的 **选择信号** 或最近的超时时间点会唤醒调度器，调度器再将对应的协程
+ * 放回就绪链表。
+ *
+ * 多个协程可以等待同一个信号槽。信号槽被触发时，等待它的协程都被唤醒，
+ * 并重新尝试获取同步对象，获取失败的协程会再次进入等待。
+ *
+ *
+ * ## 协程（C）
+ *
+ * C语言的协程是 `protothread` 风格的：协程函数的形式为 @ref xwcoro_f ，
+ * 函数体由 `XWCORO_BEGIN()` 开始，由 `XWCORO_END()` 结束，
+ * 等待时协程函数返回，被唤醒后从上次等待的位置继续执行。
+ *
+ * + `XWCORO_YIELD()` ：让出CPU
+ * + `XWCORO_EXIT()` ：退出协程
+ * + `XWCORO_SLEEP()` / `XWCORO_SLEEP_TO()` ：睡眠
+ * + `XWCORO_SEM_WAIT()` ：等待信号量
+ * + `XWCORO_FLG_WAIT()` ：等待事件标志
+ * + `XWCORO_COND_WAIT()` ：等待条件量
+ * + `XWCORO_XWCQ_DQ()` ：等待循环队列中的数据
+ * + `XWCORO_WAIT_UNTIL()` ：等待信号槽被触发，且条件成立
+ *
+ * 协程函数的局部变量在等待后会失效，需要跨越等待点的状态应该保存在 `arg` 中。
+ * 由于续点是通过 `switch` 语句实现的，协程函数体内不可使用 `switch` 语句包含等待点。
+ *
+ *
+ * ## 协程（C++20）
+ *
+ * C++头文件： @ref xwmd/coro/cxx/Coro.hxx
+ * @{
+ */
+
+struct xwcoro;
+struct xwcoro_sched;
+
+/**
+ * @brief 协程函数的返回值枚举
+ */
+enum xwcoro_status_em {
+        XWCORO_YIELDED = 0U, /**< 协程让出CPU或进入等待 */
+        XWCORO_EXITED = 1U, /**< 协程已经退出 */
+};
+
+/**
+ * @brief 协程的唤醒原因枚举
+ */
+enum xwcoro_wkuprs_em {
+        XWCORO_WKUPRS_NONE = 0U, /**< 没有被唤醒 */
+        XWCORO_WKUPRS_SIGNAL = 1U, /**< 等待的信号槽被触发 */
+        XWCORO_WKUPRS_TIMEDOUT = 2U, /**< 超时 */
+};
+
+/**
+ * @brief 协程函数
+ * @param[in] co: 协程的指针
+ * @param[in] arg: 协程函数的参数
+ * @return @ref xwcoro_status_em
+ * @details
+ * 协程函数返回 @ref XWCORO_EXITED 后，调度器不会再访问 `co` ，
+ * 协程函数可以在返回前释放 `co` 的内存。
+ */
+typedef xwsq_t (* xwcoro_f)(struct xwcoro * /*co*/, void * /*arg*/);
+
+/**
+ * @brief 协程
+ */
+struct xwcoro {
+        struct xwlib_bclst_node rdnode; /**< 就绪链表或信号槽等待链表中的节点 */
+        struct xwlib_bclst_node tmnode; /**< 超时链表中的节点 */
+        struct xwcoro_sched * sched; /**< 所属的调度器 */
+        xwcoro_f func; /**< 协程函数 */
+        void * arg; /**< 协程函数的参数 */
+        xwu32_t lc; /**< 续点 */
+        bool waiting; /**< 是否在等待 */
+        xwssq_t pos; /**< 等待的信号槽，负数表示不等待信号槽 */
+        xwtm_t to; /**< 等待超时的时间点 */
+        xwsq_t wkuprs; /**< 唤醒原因，取值 @ref xwcoro_wkuprs_em */
+};
+
+/**
+ * @brief 协程调度器
+ */
+struct xwcoro_sched {
+        struct xwos_sel sel; /**< 信号选择器 */
+        xwsz_t num; /**< 信号槽的数量 */
+        xwbmp_t * msk; /**< 有协程等待的信号槽的位图掩码 */
+        xwbmp_t * trg; /**< 被触发的信号槽的位图 */
+        struct xwlib_bclst_head * slot; /**< 每个信号槽的等待链表 */
+        struct xwlib_bclst_head rdlist; /**< 就绪链表 */
+        struct xwlib_bclst_head tmlist; /**< 超时链表，按超时时间点排序 */
+        xwsz_t cnt; /**< 未退出的协程的数量 */
+        struct xwcoro * current; /**< 正在运行的协程 */
+};
+
+/**
+ * @brief 协程调度器位图的数组大小
+ * @param[in] num: 信号槽的数量
+ */
+#define XWCORO_SCHED_BMP_NUM(num) (BITS_TO_XWBMP_T(num) * 4U)
+
+/**
+ * @brief 定义协程调度器的内存
+ * @param[in] name: 变量名称的前缀
+ * @param[in] num: 信号槽的数量
+ * @details
+ * 定义两个数组： `name##_bmp` 与 `name##_slot` ，
+ * 作为参数传递给 `xwcoro_sched_init()` 。
+ */
+// cppcheck-suppress [misra-c2012-20.7]
+#define XWCORO_SCHED_DEF_MEM(name, num) \
+        xwbmp_t name##_bmp[XWCORO_SCHED_BMP_NUM(num)]; \
+        struct xwlib_bclst_head name##_slot[(num)]
+
+/**
+ * @brief XWCORO API：初始化协程调度器
+ * @param[in] sched: 协程调度器的指针
+ * @param[in] num: 信号槽的数量
+ * @param[in] bmp: 位图数组，大小为 `XWCORO_SCHED_BMP_NUM(num)`
+ * @param[in] slot: 信号槽等待链表数组，大小为 `num`
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ESIZE: `num` 为 `0`
+ * @note
+ * + 上下文：任意
+ * @details
+ * 用户应该使用宏 @ref XWCORO_SCHED_DEF_MEM() 来定义 `bmp` 与 `slot` 。
+ */
+xwer_t xwcoro_sched_init(struct xwcoro_sched * sched, xwsz_t num,
+                         xwbmp_t * bmp, struct xwlib_bclst_head * slot);
+
+/**
+ * @brief XWCORO API：销毁协程调度器
+ * @param[in] sched: 协程调度器的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：任意
+ */
+xwer_t xwcoro_sched_fini(struct xwcoro_sched * sched);
+
+/**
+ * @brief XWCORO API：获取协程调度器的信号选择器
+ * @param[in] sched: 协程调度器的指针
+ * @return 信号选择器的指针
+ * @note
+ * + 上下文：任意
+ * @details
+ * 同步对象需要通过 `xwos_sem_bind()` 、 `xwos_flg_bind()` 、 `xwos_cond_bind()` 、
+ * `xwcq_bind()` 等CAPI绑定到此信号选择器上，协程才可等待它们。
+ */
+static __xwcc_inline
+struct xwos_sel * xwcoro_sched_get_sel(struct xwcoro_sched * sched)
+{
+        return &sched->sel;
+}
+
+/**
+ * @brief XWCORO API：初始化协程
+ * @param[in] co: 协程的指针
+ * @param[in] func: 协程函数
+ * @param[in] arg: 协程函数的参数
+ * @note
+ * + 上下文：任意
+ */
+void xwcoro_init(struct xwcoro * co, xwcoro_f func, void * arg);
+
+/**
+ * @brief XWCORO API：将协程加入调度器的就绪链表
+ * @param[in] sched: 协程调度器的指针
+ * @param[in] co: 协程的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：运行调度器的线程，包括协程函数中
+ */
+xwer_t xwcoro_sched_spawn(struct xwcoro_sched * sched, struct xwcoro * co);
+
+/**
+ * @brief XWCORO API：运行协程调度器
+ * @param[in] sched: 协程调度器的指针
+ * @return 错误码
+ * @retval XWOK: 所有协程都已经退出
+ * @retval -EFAULT: 空指针
+ * @retval -EDEADLK: 所有协程都在永久等待，且没有等待任何信号槽
+ * @retval -EINTR: 等待被中断
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @note
+ * + 上下文：线程
+ * @details
+ * 返回 `-EINTR` 时，协程的状态被保留，可以再次调用此CAPI继续运行。
+ */
+xwer_t xwcoro_sched_run(struct xwcoro_sched * sched);
+
+/**
+ * @brief XWCORO API：登记协程的等待
+ * @param[in] co: 协程的指针
+ * @param[in] pos: 等待的信号槽，负数表示只等待超时
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ECHRNG: 信号槽超出范围
+ * @note
+ * + 上下文：协程函数
+ * @details
+ * 超时时间点由 `co->to` 指定。协程函数随后必须返回 @ref XWCORO_YIELDED ，
+ * 调度器会将协程放入信号槽的等待链表与超时链表。
+ * 此CAPI通常不需要直接调用，而是通过 `XWCORO_WAIT_UNTIL()` 等宏使用。
+ */
+xwer_t xwcoro_wait(struct xwcoro * co, xwssq_t pos);
+
+/**
+ * @brief 设置续点
+ */
+#define XWCORO_LC_SET(co) \
+        (co)->lc = (xwu32_t)__LINE__; case __LINE__:
+
+/**
+ * @brief 协程函数体的开始
+ * @param[in] co: 协程的指针
+ */
+#define XWCORO_BEGIN(co) \
+        switch ((co)->lc) { case 0U:
+
+/**
+ * @brief 协程函数体的结束
+ * @param[in] co: 协程的指针
+ */
+#define XWCORO_END(co) \
+        default: break; } (co)->lc = 0U; return XWCORO_EXITED
+
+/**
+ * @brief 退出协程
+ * @param[in] co: 协程的指针
+ */
+#define XWCORO_EXIT(co) \
+        do { (co)->lc = 0U; return XWCORO_EXITED; } while (0)
+
+/**
+ * @brief 让出CPU，调度器运行完其他就绪的协程后再继续
+ * @param[in] co: 协程的指针
+ */
+#define XWCORO_YIELD(co) \
+        do { \
+                (co)->lc = (xwu32_t)__LINE__; \
+                return XWCORO_YIELDED; \
+                case __LINE__: ; \
+        } while (0)
+
+/**
+ * @brief 等待信号槽 `pos` 被触发，直到条件 `cond` 成立或超时
+ * @param[in] co: 协程的指针
+ * @param[in] pos: 信号槽
+ * @param[in] deadline: 期望唤醒的时间点，只在进入等待时求值一次
+ * @param[in] cond: 条件表达式，每次被唤醒时求值，通常是同步对象的 `trywait` 操作
+ * @param[out] rc: 错误码
+ * + `XWOK` ：条件成立
+ * + `-ETIMEDOUT` ：超时
+ * + `-ECHRNG` ：信号槽超出范围
+ */
+#define XWCORO_WAIT_UNTIL(co, pos, deadline, cond, rc) \
+        do { \
+                (co)->wkuprs = (xwsq_t)XWCORO_WKUPRS_NONE; \
+                (co)->to = (deadline); \
+                XWCORO_LC_SET(co) \
+                if (cond) { \
+                        (rc) = XWOK; \
+                } else if ((xwsq_t)XWCORO_WKUPRS_TIMEDOUT == (co)->wkuprs) { \
+                        (rc) = -ETIMEDOUT; \
+                } else { \
+                        (rc) = xwcoro_wait((co), (xwssq_t)(pos)); \
+                        if (XWOK == (rc)) { \
+                                return XWCORO_YIELDED; \
+                        } \
+                } \
+        } while (0)
+
+/**
+ * @brief 睡眠到时间点 `deadline`
+ * @param[in] co: 协程的指针
+ * @param[in] deadline: 期望唤醒的时间点
+ */
+#define XWCORO_SLEEP_TO(co, deadline) \
+        do { \
+                (co)->wkuprs = (xwsq_t)XWCORO_WKUPRS_NONE; \
+                (co)->to = (deadline); \
+                XWCORO_LC_SET(co) \
+                if ((xwsq_t)XWCORO_WKUPRS_TIMEDOUT != (co)->wkuprs) { \
+                        xwcoro_wait((co), -1); \
+                        return XWCORO_YIELDED; \
+                } \
+        } while (0)
+
+/**
+ * @brief 睡眠一段时间
+ * @param[in] co: 协程的指针
+ * @param[in] dur: 睡眠的时间
+ */
+#define XWCORO_SLEEP(co, dur) XWCORO_SLEEP_TO((co), xwtm_ft(dur))
+
+/**
+ * @brief 等待并获取信号量
+ * @param[in] co: 协程的指针
+ * @param[in] sem: 信号量的指针，必须已经绑定到调度器的信号选择器上
+ * @param[in] pos: 信号量绑定的信号槽
+ * @param[in] deadline: 期望唤醒的时间点
+ * @param[out] rc: 错误码，参考 `XWCORO_WAIT_UNTIL()`
+ */
+#define XWCORO_SEM_WAIT(co, sem, pos, deadline, rc) \
+        XWCORO_WAIT_UNTIL((co), (pos), (deadline), (XWOK == xwos_sem_trywait(sem)), (rc))
+
+/**
+ * @brief 等待事件标志
+ * @param[in] co: 协程的指针
+ * @param[in] flg: 事件标志的指针，必须已经绑定到调度器的信号选择器上
+ * @param[in] pos: 事件标志绑定的信号槽
+ * @param[in] trigger: 事件触发条件，参考 `xwos_flg_trywait()`
+ * @param[in] consumption: 事件触发后是否清除事件
+ * @param[in,out] origin: 参考 `xwos_flg_trywait()`
+ * @param[in] msk: 事件标志位图掩码
+ * @param[in] deadline: 期望唤醒的时间点
+ * @param[out] rc: 错误码，参考 `XWCORO_WAIT_UNTIL()`
+ */
+#define XWCORO_FLG_WAIT(co, flg, pos, trigger, consumption, origin, msk, deadline, rc) \
+        XWCORO_WAIT_UNTIL((co), (pos), (deadline), \
+                          (XWOK == xwos_flg_trywait((flg), (trigger), (consumption), \
+                                                    (origin), (msk))), \
+                          (rc))
+
+/**
+ * @brief 等待条件量被单播或广播
+ * @param[in] co: 协程的指针
+ * @param[in] pos: 条件量绑定的信号槽
+ * @param[in] deadline: 期望唤醒的时间点
+ * @param[out] rc: 错误码，参考 `XWCORO_WAIT_UNTIL()`
+ * @details
+ * 调度器的所有协程都运行在同一个线程中，因此等待条件量时不需要锁。
+ */
+#define XWCORO_COND_WAIT(co, pos, deadline, rc) \
+        XWCORO_WAIT_UNTIL((co), (pos), (deadline), \
+                          ((xwsq_t)XWCORO_WKUPRS_SIGNAL == (co)->wkuprs), \
+                          (rc))
+
+#if defined(XWMDCFG_isc_xwcq) && (1 == XWMDCFG_isc_xwcq)
+/**
+ * @brief 等待从循环队列的 **首端** 接收数据
+ * @param[in] co: 协程的指针
+ * @param[in] cq: 循环队列的指针，必须已经绑定到调度器的信号选择器上
+ * @param[in] pos: 循环队列绑定的信号槽
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 参考 `xwcq_trydq()`
+ * @param[in] deadline: 期望唤醒的时间点
+ * @param[out] rc: 错误码，参考 `XWCORO_WAIT_UNTIL()`
+ */
+#define XWCORO_XWCQ_DQ(co, cq, pos, data, size, deadline, rc) \
+        XWCORO_WAIT_UNTIL((co), (pos), (deadline), \
+                          (XWOK == xwcq_trydq((cq), (data), (size))), \
+                          (rc))
+#endif
+
+/**
+ * @} xwmd_coro
+ */
+
+#endif /* xwmd/coro/mif.h */
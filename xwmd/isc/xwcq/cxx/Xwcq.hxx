@@ -542,6 +542,220 @@ class Xwcq
     xwer_t tryPrq(T * data, xwsz_t * size) {
         return xwcq_tryprq(&mCq, (xwu8_t *)data, size);
     }
+
+    /******** 零拷贝 ********/
+    /**
+     * @brief 预留循环队列 **尾端** 的数据槽
+     * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EBUSY: 已经有数据槽被预留
+     * @note
+     * + 上下文：任意
+     * @details
+     * + 直接在数据槽中构造数据，再调用 `commit()` 将其发布到队列中。
+     */
+    xwer_t reserve(T ** slot) {
+        return xwcq_reserve(&mCq, (xwu8_t **)slot);
+    }
+
+    /**
+     * @brief 将预留的数据槽发布到循环队列的 **尾端**
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -ENOENT: 没有被预留的数据槽
+     * @retval -ENOSPC: 循环队列已满，并且首端之前的数据槽正被消费者占用
+     * @note
+     * + 上下文：任意
+     */
+    xwer_t commit() { return xwcq_commit(&mCq); }
+
+    /**
+     * @brief 放弃预留的数据槽
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -ENOENT: 没有被预留的数据槽
+     * @note
+     * + 上下文：任意
+     * @details
+     * + 数据槽中已构造的数据被丢弃，循环队列的尾端保持不变。
+     */
+    xwer_t cancel() { return xwcq_cancel(&mCq); }
+
+    /**
+     * @brief 等待并占用循环队列 **首端** 的数据槽
+     * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EBUSY: 已经有数据槽被占用
+     * @retval -EINTR: 等待被中断
+     * @retval -ENOTTHDCTX: 不在线程上下文中
+     * @note
+     * + 上下文：线程
+     * @details
+     * + 直接读取数据槽中的数据，使用完毕后调用 `releaseSlot()` 释放。
+     */
+    xwer_t peekSlot(T ** slot) {
+        return xwcq_peek_slot(&mCq, (xwu8_t **)slot);
+    }
+
+    /**
+     * @brief 限时等待并占用循环队列 **首端** 的数据槽
+     * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+     * @param[in] to: 期望唤醒的时间点
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EBUSY: 已经有数据槽被占用
+     * @retval -EINTR: 等待被中断
+     * @retval -ETIMEDOUT: 超时
+     * @retval -ENOTTHDCTX: 不在线程上下文中
+     * @note
+     * + 上下文：线程
+     */
+    xwer_t peekSlot(T ** slot, xwtm_t to) {
+        return xwcq_peek_slot_to(&mCq, (xwu8_t **)slot, to);
+    }
+
+    /**
+     * @brief 等待并占用循环队列 **首端** 的数据槽，并且等待不可被中断
+     * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EBUSY: 已经有数据槽被占用
+     * @retval -ENOTTHDCTX: 不在线程上下文中
+     * @note
+     * + 上下文：线程
+     */
+    xwer_t peekSlotUnintr(T ** slot) {
+        return xwcq_peek_slot_unintr(&mCq, (xwu8_t **)slot);
+    }
+
+    /**
+     * @brief 尝试占用循环队列 **首端** 的数据槽
+     * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EBUSY: 已经有数据槽被占用
+     * @retval -ENODATA: 循环队列为空
+     * @note
+     * + 上下文：任意
+     */
+    xwer_t tryPeekSlot(T ** slot) {
+        return xwcq_trypeek_slot(&mCq, (xwu8_t **)slot);
+    }
+
+    /**
+     * @brief 释放被占用的数据槽
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -ENOENT: 没有被占用的数据槽
+     * @note
+     * + 上下文：任意
+     */
+    xwer_t releaseSlot() { return xwcq_release_slot(&mCq); }
+
+    /******** 批量 ********/
+    /**
+     * @brief 将多个数据批量发送到循环队列的 **尾端** （批量入队）
+     * @param[in] data: 数据数组
+     * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+     * + (I) 作为输入时，表示数组中数据的数量
+     * + (O) 作为输出时，返回实际入队的数据数量
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EBUSY: 有数据槽被预留
+     * @note
+     * + 上下文：任意
+     * @details
+     * + 所有数据在一次上锁中写入队列，队列满时覆盖最旧的数据。
+     */
+    xwer_t eqN(T * data, xwsz_t * num) {
+        return xwcq_eq_n(&mCq, (const xwu8_t *)data, sizeof(T), num);
+    }
+
+    /**
+     * @brief 等待从循环队列的 **首端** 批量接收数据
+     * @param[out] data: 数组缓冲区，用于接收数据
+     * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+     * + (I) 作为输入时，表示数组缓冲区的大小
+     * + (O) 作为输出时，返回实际接收的数据数量
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EINVAL: `*num` 为 `0`
+     * @retval -EINTR: 等待被中断
+     * @retval -ENOTTHDCTX: 不在线程上下文中
+     * @note
+     * + 上下文：线程
+     * @details
+     * + 至少等到一个数据，然后取出队列中已有的数据，最多 `*num` 个。
+     */
+    xwer_t dqN(T * data, xwsz_t * num) {
+        return xwcq_dq_n(&mCq, (xwu8_t *)data, sizeof(T), num);
+    }
+
+    /**
+     * @brief 限时等待从循环队列的 **首端** 批量接收数据
+     * @param[out] data: 数组缓冲区，用于接收数据
+     * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+     * + (I) 作为输入时，表示数组缓冲区的大小
+     * + (O) 作为输出时，返回实际接收的数据数量
+     * @param[in] to: 期望唤醒的时间点
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EINVAL: `*num` 为 `0`
+     * @retval -EINTR: 等待被中断
+     * @retval -ETIMEDOUT: 超时
+     * @retval -ENOTTHDCTX: 不在线程上下文中
+     * @note
+     * + 上下文：线程
+     */
+    xwer_t dqN(T * data, xwsz_t * num, xwtm_t to) {
+        return xwcq_dq_n_to(&mCq, (xwu8_t *)data, sizeof(T), num, to);
+    }
+
+    /**
+     * @brief 等待从循环队列的 **首端** 批量接收数据，并且等待不可被中断
+     * @param[out] data: 数组缓冲区，用于接收数据
+     * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+     * + (I) 作为输入时，表示数组缓冲区的大小
+     * + (O) 作为输出时，返回实际接收的数据数量
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EINVAL: `*num` 为 `0`
+     * @retval -ENOTTHDCTX: 不在线程上下文中
+     * @note
+     * + 上下文：线程
+     */
+    xwer_t dqNUnintr(T * data, xwsz_t * num) {
+        return xwcq_dq_n_unintr(&mCq, (xwu8_t *)data, sizeof(T), num);
+    }
+
+    /**
+     * @brief 尝试从循环队列的 **首端** 批量接收数据
+     * @param[out] data: 数组缓冲区，用于接收数据
+     * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+     * + (I) 作为输入时，表示数组缓冲区的大小
+     * + (O) 作为输出时，返回实际接收的数据数量
+     * @return 错误码
+     * @retval XWOK: 没有错误
+     * @retval -EFAULT: 空指针
+     * @retval -EINVAL: `*num` 为 `0`
+     * @retval -ENODATA: 循环队列为空
+     * @note
+     * + 上下文：任意
+     */
+    xwer_t tryDqN(T * data, xwsz_t * num) {
+        return xwcq_trydq_n(&mCq, (xwu8_t *)data, sizeof(T), num);
+    }
 };
 
 /**
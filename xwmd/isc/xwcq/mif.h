@@ -40,6 +40,7 @@
  *
  * + `xwcq_eq()` ：入队，可在 **任意** 上下文使用
  * + `xwcq_jq()` ：插队，可在 **任意** 上下文使用
+ * + `xwcq_eq_n()` ：批量入队，可在 **任意** 上下文使用
  *
  *
  * ## 接收消息
@@ -49,6 +50,11 @@
  *   + `xwcq_dq_to()` ：限时等待消息，只能在 **线程** 上下文使用
  *   + `xwcq_dq_unintr()` ：不可中断地等待消息，只能在 **线程** 上下文使用
  *   + `xwcq_trydq()` ：尝试获取消息，可在 **任意** 上下文使用
+ * + 首端批量接收
+ *   + `xwcq_dq_n()` ：等待消息，只能在 **线程** 上下文使用
+ *   + `xwcq_dq_n_to()` ：限时等待消息，只能在 **线程** 上下文使用
+ *   + `xwcq_dq_n_unintr()` ：不可中断地等待消息，只能在 **线程** 上下文使用
+ *   + `xwcq_trydq_n()` ：尝试获取消息，可在 **任意** 上下文使用
  * + 尾端离队
  *   + `xwcq_rq()` ：等待消息，只能在 **线程** 上下文使用
  *   + `xwcq_rq_to()` ：限时等待消息，只能在 **线程** 上下文使用
@@ -70,6 +76,37 @@
  *   + `xwcq_tryprq()` ：尝试获取消息，可在 **任意** 上下文使用
  *
  *
+ * ## 零拷贝
+ *
+ * 生产者与消费者可直接访问数据槽的内存，例如让DMA直接将数据写入数据槽，
+ * 或让解析器直接在数据槽中解析数据，省去入队与离队时的两次拷贝：
+ *
+ * + 生产者
+ *   + `xwcq_reserve()` ：预留队列 **尾端** 的数据槽，可在 **任意** 上下文使用
+ *   + `xwcq_commit()` ：将预留的数据槽发布到队列中，可在 **任意** 上下文使用
+ *   + `xwcq_cancel()` ：放弃预留的数据槽，可在 **任意** 上下文使用
+ * + 消费者
+ *   + `xwcq_peek_slot()` ：等待并占用队列 **首端** 的数据槽，只能在 **线程** 上下文使用
+ *   + `xwcq_peek_slot_to()` ：限时等待并占用数据槽，只能在 **线程** 上下文使用
+ *   + `xwcq_peek_slot_unintr()` ：不可中断地等待并占用数据槽，只能在 **线程** 上下文使用
+ *   + `xwcq_trypeek_slot()` ：尝试占用数据槽，可在 **任意** 上下文使用
+ *   + `xwcq_release_slot()` ：释放被占用的数据槽，可在 **任意** 上下文使用
+ *
+ * 同一时刻最多只能有一个被预留的数据槽与一个被占用的数据槽。
+ *
+ * **行为变更** ：尾端的数据槽被 `xwcq_reserve()` 预留期间，
+ * 会写入或移动尾端的拷贝式CAPI（ `xwcq_eq()` 、 `xwcq_jq()` 、 `xwcq_eq_n()` 、
+ * `xwcq_rq()` 、 `xwcq_rq_to()` 、 `xwcq_rq_unintr()` 、 `xwcq_tryrq()` ）
+ * 不再越过预留的数据槽，而是返回 `-EBUSY` ；
+ * 未使用零拷贝CAPI的代码不受影响。
+ *
+ *
+ * ## 单生产者单消费者模式
+ *
+ * 只有一个生产者与一个消费者时，可使用无锁的 @ref xwmd_isc_xwcq_spsc ，
+ * 头文件： @ref xwmd/isc/xwcq/spsc.h
+ *
+ *
  * ## 清空循环队列
  *
  * + `xwcq_flush()` ：将循环队列恢复到初始化状态
@@ -129,6 +166,8 @@ struct xwcq {
         struct xwos_splk lock; /**< 保护队列的锁 */
         xwssz_t rear; /**< 可用于接收的空白数据槽的位置 */
         xwssz_t front; /**< 包含有效数据的数据槽的位置 */
+        xwssz_t rsv; /**< 被生产者预留的数据槽的位置，-1表示没有预留 */
+        xwssz_t pk; /**< 被消费者占用的数据槽的位置，-1表示没有占用 */
         xwu8_t * q; /**< 队列 */
 };
 
@@ -263,6 +302,8 @@ xwer_t xwcq_put(struct xwcq * cq);
  * @return 错误码
  * @retval XWOK: 没有错误
  * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 尾端的数据槽正被 `xwcq_reserve()` 预留
+ * @retval -ENOSPC: 循环队列已满，并且首端之前的数据槽正被消费者占用
  * @note
  * + 上下文：任意
  * @details
@@ -281,6 +322,8 @@ xwer_t xwcq_eq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size);
  * @return 错误码
  * @retval XWOK: 没有错误
  * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 尾端的数据槽正被 `xwcq_reserve()` 预留
+ * @retval -ENOSPC: 首端之前的数据槽正被消费者占用
  * @note
  * + 上下文：任意
  * @details
@@ -291,6 +334,31 @@ xwer_t xwcq_eq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size);
  */
 xwer_t xwcq_jq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size);
 
+/**
+ * @brief XWCQ API：将多个数据批量发送到循环队列的 **尾端** (批量入队)
+ * @param[in] cq: 循环队列对象的指针
+ * @param[in] data: 数据数组
+ * @param[in] size: 数组中每个数据的大小
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组中数据的数量
+ * + (O) 作为输出时，返回实际入队的数据数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 尾端的数据槽正被 `xwcq_reserve()` 预留
+ * @retval -ENOSPC: 循环队列已满，并且首端之前的数据槽正被消费者占用
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 所有数据在一次上锁中入队，每个数据占用一个数据槽，
+ *   数据之间的间隔是 `size` ，如果 `size` 超过 `slotsize` ，数据将被截断。
+ * + 如果循环队列数据已被填满，与 `xwcq_eq()` 一样覆盖最旧的数据。
+ * + 如果入队到一半时遇到被消费者占用的数据槽，只入队前面的数据，
+ *   通过 `*num` 返回入队的数量，若一个数据也没有入队，返回 `-ENOSPC` 。
+ * + 此CAPI不会阻塞调用者，因此可以在中断中使用。
+ */
+xwer_t xwcq_eq_n(struct xwcq * cq, const xwu8_t * data, xwsz_t size, xwsz_t * num);
+
 /**
  * @brief XWCQ API: 等待从循环队列的 **首端** 接收数据 (离队，DeQueue)
  * @param[in] cq: 循环队列对象的指针
@@ -387,6 +455,106 @@ xwer_t xwcq_dq_unintr(struct xwcq * cq, xwu8_t * data, xwsz_t * size);
  */
 xwer_t xwcq_trydq(struct xwcq * cq, xwu8_t * data, xwsz_t * size);
 
+/**
+ * @brief XWCQ API: 等待从循环队列的 **首端** 批量接收数据 (批量离队)
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 数组缓冲区，用于接收数据
+ * @param[in] size: 数组中每个元素的大小
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示最多接收的数据数量
+ * + (O) 作为输出时，返回实际接收的数据数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -EINTR: 等待被中断
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 若循环队列中数据为空，调用此CAPI的线程会阻塞等待，直到循环队列中有消息可取出，
+ *   或等待被中断。
+ * + 取到第一个数据后不再等待，最多取出 `*num` 个已经在队列中的数据，
+ *   所有数据在一次上锁中离队。
+ * + 每个数据被拷贝到 `data + i * size` 处，如果 `size` 小于 `slotsize` ，数据将被截断。
+ */
+xwer_t xwcq_dq_n(struct xwcq * cq, xwu8_t * data, xwsz_t size, xwsz_t * num);
+
+/**
+ * @brief XWCQ API: 限时等待从循环队列的 **首端** 批量接收数据 (批量离队)
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 数组缓冲区，用于接收数据
+ * @param[in] size: 数组中每个元素的大小
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示最多接收的数据数量
+ * + (O) 作为输出时，返回实际接收的数据数量
+ * @param[in] to: 期望唤醒的时间点
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -EINTR: 等待被中断
+ * @retval -ETIMEDOUT: 超时
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 同 `xwcq_dq_n()` ，但等待第一个数据时会指定一个唤醒时间点 `to` 。
+ */
+xwer_t xwcq_dq_n_to(struct xwcq * cq, xwu8_t * data, xwsz_t size, xwsz_t * num,
+                    xwtm_t to);
+
+/**
+ * @brief XWCQ API: 等待从循环队列的 **首端** 批量接收数据 (批量离队)，
+ *        并且等待不可被中断
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 数组缓冲区，用于接收数据
+ * @param[in] size: 数组中每个元素的大小
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示最多接收的数据数量
+ * + (O) 作为输出时，返回实际接收的数据数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 同 `xwcq_dq_n()` ，但等待第一个数据时不可被中断。
+ */
+xwer_t xwcq_dq_n_unintr(struct xwcq * cq, xwu8_t * data, xwsz_t size, xwsz_t * num);
+
+/**
+ * @brief XWCQ API: 尝试从循环队列的 **首端** 批量接收数据 (批量离队)
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 数组缓冲区，用于接收数据
+ * @param[in] size: 数组中每个元素的大小
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示最多接收的数据数量
+ * + (O) 作为输出时，返回实际接收的数据数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -ENODATA: 循环队列为空
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 若循环队列中为空，就立即返回 `-ENODATA` 。
+ * + 此CAPI可在中断中使用。
+ */
+xwer_t xwcq_trydq_n(struct xwcq * cq, xwu8_t * data, xwsz_t size, xwsz_t * num);
+
 /**
  * @brief XWCQ API: 等待从循环队列的 **尾端** 接收数据 (反向离队，Reversely deQueue)
  * @param[in] cq: 循环队列对象的指针
@@ -397,6 +565,7 @@ xwer_t xwcq_trydq(struct xwcq * cq, xwu8_t * data, xwsz_t * size);
  * @return 错误码
  * @retval XWOK: 没有错误
  * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 尾端的数据槽正被 `xwcq_reserve()` 预留
  * @retval -EINTR: 等待被中断
  * @retval -ENOTTHDCTX: 不在线程上下文中
  * @retval -EDISIRQ: 中断被关闭
@@ -423,6 +592,7 @@ xwer_t xwcq_rq(struct xwcq * cq, xwu8_t * data, xwsz_t * size);
  * @return 错误码
  * @retval XWOK: 没有错误
  * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 尾端的数据槽正被 `xwcq_reserve()` 预留
  * @retval -EINTR: 等待被中断
  * @retval -ETIMEDOUT: 超时
  * @retval -ENOTTHDCTX: 不在线程上下文中
@@ -453,6 +623,7 @@ xwer_t xwcq_rq_to(struct xwcq * cq, xwu8_t * data, xwsz_t * size, xwtm_t to);
  * @return 错误码
  * @retval XWOK: 没有错误
  * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 尾端的数据槽正被 `xwcq_reserve()` 预留
  * @retval -ENOTTHDCTX: 不在线程上下文中
  * @retval -EDISIRQ: 中断被关闭
  * @retval -EDISPMPT: 抢占被关闭
@@ -475,6 +646,7 @@ xwer_t xwcq_rq_unintr(struct xwcq * cq, xwu8_t * data, xwsz_t * size);
  * @return 错误码
  * @retval XWOK: 没有错误
  * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 尾端的数据槽正被 `xwcq_reserve()` 预留
  * @retval -ENODATA: 循环队列为空
  * @note
  * + 上下文：任意
@@ -682,6 +854,140 @@ xwer_t xwcq_prq_unintr(struct xwcq * cq, xwu8_t * data, xwsz_t * size);
  */
 xwer_t xwcq_tryprq(struct xwcq * cq, xwu8_t * data, xwsz_t * size);
 
+/**
+ * @brief XWCQ API: 预留循环队列 **尾端** 的数据槽
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 已经有数据槽被预留
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 数据槽的大小为初始化循环队列时指定的 `slotsize` ，
+ *   生产者可直接向数据槽中写入数据，再调用 `xwcq_commit()` 将其发布到队列中。
+ * + 预留期间， `xwcq_eq()` 、 `xwcq_jq()` 与反向离队的CAPI都会返回 `-EBUSY` 。
+ */
+xwer_t xwcq_reserve(struct xwcq * cq, xwu8_t ** slot);
+
+/**
+ * @brief XWCQ API: 将预留的数据槽发布到循环队列的 **尾端**
+ * @param[in] cq: 循环队列对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOENT: 没有被预留的数据槽
+ * @retval -ENOSPC: 循环队列已满，并且首端之前的数据槽正被消费者占用
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 与 `xwcq_eq()` 一样，如果循环队列数据已被填满，会覆盖掉 **首端** 的数据。
+ * + 返回 `-ENOSPC` 时，数据槽仍然被预留，消费者调用 `xwcq_release_slot()` 后可再次提交。
+ */
+xwer_t xwcq_commit(struct xwcq * cq);
+
+/**
+ * @brief XWCQ API: 放弃预留的数据槽
+ * @param[in] cq: 循环队列对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOENT: 没有被预留的数据槽
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 数据槽中已写入的数据被丢弃，循环队列的尾端保持不变。
+ */
+xwer_t xwcq_cancel(struct xwcq * cq);
+
+/**
+ * @brief XWCQ API: 等待并占用循环队列 **首端** 的数据槽
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 已经有数据槽被占用
+ * @retval -EINTR: 等待被中断
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 被占用的数据槽离开队列，消费者可直接读取其中的数据，
+ *   使用完毕后调用 `xwcq_release_slot()` 释放。
+ * + 占用期间，入队的数据不会覆盖此数据槽，循环队列已满时入队将返回 `-ENOSPC` 。
+ */
+xwer_t xwcq_peek_slot(struct xwcq * cq, xwu8_t ** slot);
+
+/**
+ * @brief XWCQ API: 限时等待并占用循环队列 **首端** 的数据槽
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+ * @param[in] to: 期望唤醒的时间点
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 已经有数据槽被占用
+ * @retval -EINTR: 等待被中断
+ * @retval -ETIMEDOUT: 超时
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 同 `xwcq_peek_slot()` ，增加了等待超时的时间点 `to` 。
+ */
+xwer_t xwcq_peek_slot_to(struct xwcq * cq, xwu8_t ** slot, xwtm_t to);
+
+/**
+ * @brief XWCQ API: 等待并占用循环队列 **首端** 的数据槽，并且等待不可被中断
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 已经有数据槽被占用
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ */
+xwer_t xwcq_peek_slot_unintr(struct xwcq * cq, xwu8_t ** slot);
+
+/**
+ * @brief XWCQ API: 尝试占用循环队列 **首端** 的数据槽
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 已经有数据槽被占用
+ * @retval -ENODATA: 循环队列为空
+ * @note
+ * + 上下文：任意
+ */
+xwer_t xwcq_trypeek_slot(struct xwcq * cq, xwu8_t ** slot);
+
+/**
+ * @brief XWCQ API: 释放被占用的数据槽
+ * @param[in] cq: 循环队列对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOENT: 没有被占用的数据槽
+ * @note
+ * + 上下文：任意
+ */
+xwer_t xwcq_release_slot(struct xwcq * cq);
+
 /**
  * @brief XWCQ API: 清空循环队列
  * @param[in] cq: 循环队列对象的指针
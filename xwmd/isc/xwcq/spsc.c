@@ -0,0 +1,207 @@
+/**
+ * @file
+ * @brief 循环队列：单生产者单消费者无锁模式
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ * @note
+ * + `rear` 与 `front` 是一直递增的计数器，二者之差是队列中数据的数量，
+ *   数据槽的位置是计数器的低位（ `slotnum` 是2的幂，计数器回绕时位置仍然连续）。
+ * + 生产者先写数据槽，再以释放内存序更新 `rear` ；
+ *   消费者以获取内存序读取 `rear` 后再读数据槽，反之亦然。
+ * + 消费者阻塞前先设置 `waiting` ，再检查一次队列是否为空；
+ *   生产者更新 `rear` 后检查 `waiting` 。两边都以全屏障隔开，
+ *   因此二者至少有一方能看到对方的修改，不会丢失唤醒。
+ */
+
+#include <string.h>
+#include <xwos/standard.h>
+#include <xwos/lib/xwaop.h>
+#include <xwos/lib/mb.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwmd/isc/xwcq/spsc.h>
+
+__xwmd_api
+xwer_t xwcq_spsc_init(struct xwcq_spsc * cq, xwsz_t slotsize, xwsz_t slotnum,
+                      xwu8_t * mem)
+{
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((mem), "nullptr", -EFAULT);
+        XWOS_VALIDATE((slotsize > 0), "zero-size", -ESIZE);
+        XWOS_VALIDATE((slotnum > 0), "zero-num", -ESIZE);
+        XWOS_VALIDATE(!(slotnum & (slotnum - 1U)), "num-not-pow2", -ESIZE);
+        XWOS_VALIDATE(!(slotsize & XWMM_UNALIGNED_MASK), "size-not-aligned", -EALIGN);
+
+        cq->slotsize = slotsize;
+        cq->slotnum = slotnum;
+        cq->q = mem;
+        xwaop_store(xwsq_t, &cq->waiting, xwaop_mo_relaxed, 0);
+        xwaop_store(xwsq_t, &cq->rear, xwaop_mo_relaxed, 0);
+        xwaop_store(xwsq_t, &cq->front, xwaop_mo_relaxed, 0);
+        return xwos_sem_init(&cq->sem, 0, 1);
+}
+
+__xwmd_api
+xwer_t xwcq_spsc_fini(struct xwcq_spsc * cq)
+{
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+
+        return xwos_sem_fini(&cq->sem);
+}
+
+__xwmd_api
+xwer_t xwcq_spsc_eq(struct xwcq_spsc * cq, const xwu8_t * data, xwsz_t * size)
+{
+        xwsq_t rear;
+        xwsq_t front;
+        xwsq_t waiting;
+        xwsz_t eqsize;
+        xwer_t rc;
+
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((size), "nullptr", -EFAULT);
+
+        eqsize = *size;
+        eqsize = (eqsize > cq->slotsize) ? cq->slotsize : eqsize;
+        rear = xwaop_load(xwsq_t, &cq->rear, xwaop_mo_relaxed);
+        front = xwaop_load(xwsq_t, &cq->front, xwaop_mo_acquire);
+        if ((rear - front) >= (xwsq_t)cq->slotnum) {
+                rc = -ENOSPC;
+                goto err_nospc;
+        }
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(&cq->q[(rear & (cq->slotnum - 1U)) * cq->slotsize], data, eqsize);
+        xwaop_store(xwsq_t, &cq->rear, xwaop_mo_release, rear + 1U);
+        xwmb_mp_mb();
+        if ((xwsq_t)0 != xwaop_load(xwsq_t, &cq->waiting, xwaop_mo_relaxed)) {
+                waiting = 0;
+                xwaop_write(xwsq_t, &cq->waiting, 0, &waiting);
+                if ((xwsq_t)0 != waiting) {
+                        xwos_sem_post(&cq->sem);
+                }
+        }
+        *size = eqsize;
+        return XWOK;
+
+err_nospc:
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_spsc_trydq(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size)
+{
+        xwsq_t rear;
+        xwsq_t front;
+        xwsz_t cpsz;
+        xwer_t rc;
+
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((size), "nullptr", -EFAULT);
+
+        front = xwaop_load(xwsq_t, &cq->front, xwaop_mo_relaxed);
+        rear = xwaop_load(xwsq_t, &cq->rear, xwaop_mo_acquire);
+        if (rear == front) {
+                rc = -ENODATA;
+                goto err_nodata;
+        }
+        cpsz = (*size > cq->slotsize) ? cq->slotsize : *size;
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(data, &cq->q[(front & (cq->slotnum - 1U)) * cq->slotsize], cpsz);
+        xwaop_store(xwsq_t, &cq->front, xwaop_mo_release, front + 1U);
+        *size = cpsz;
+        return XWOK;
+
+err_nodata:
+        return rc;
+}
+
+/**
+ * @brief 阻塞等待从循环队列的首端接收数据
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针
+ * @param[in] to: 期望唤醒的时间点
+ * @param[in] intr: 是否可被中断，为 `false` 时忽略 `to`
+ * @return 错误码
+ */
+static __xwmd_code
+xwer_t xwcq_spsc_dq_blk(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size,
+                        xwtm_t to, bool intr)
+{
+        xwsq_t rear;
+        xwer_t rc;
+
+        while (true) {
+                rc = xwcq_spsc_trydq(cq, data, size);
+                if (-ENODATA != rc) {
+                        break;
+                }
+                xwaop_store(xwsq_t, &cq->waiting, xwaop_mo_relaxed, 1);
+                xwmb_mp_mb();
+                rear = xwaop_load(xwsq_t, &cq->rear, xwaop_mo_relaxed);
+                if (rear != xwaop_load(xwsq_t, &cq->front, xwaop_mo_relaxed)) {
+                        /* 设置 `waiting` 前生产者已经入队，不需要等待 */
+                        xwaop_store(xwsq_t, &cq->waiting, xwaop_mo_relaxed, 0);
+                        continue;
+                }
+                if (intr) {
+                        rc = xwos_sem_wait_to(&cq->sem, to);
+                } else {
+                        rc = xwos_sem_wait_unintr(&cq->sem);
+                }
+                if (rc < 0) {
+                        xwaop_store(xwsq_t, &cq->waiting, xwaop_mo_relaxed, 0);
+                        break;
+                }
+                /* 信号量可能是上一次等待遗留的，因此需要回到循环开始处重新检查 */
+        }
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_spsc_dq(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size)
+{
+        return xwcq_spsc_dq_to(cq, data, size, XWTM_MAX);
+}
+
+__xwmd_api
+xwer_t xwcq_spsc_dq_to(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size,
+                       xwtm_t to)
+{
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((size), "nullptr", -EFAULT);
+
+        return xwcq_spsc_dq_blk(cq, data, size, to, true);
+}
+
+__xwmd_api
+xwer_t xwcq_spsc_dq_unintr(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size)
+{
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((size), "nullptr", -EFAULT);
+
+        return xwcq_spsc_dq_blk(cq, data, size, XWTM_MAX, false);
+}
+
+__xwmd_api
+xwer_t xwcq_spsc_get_availability(struct xwcq_spsc * cq, xwsz_t * avbbuf)
+{
+        xwsq_t rear;
+        xwsq_t front;
+
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((avbbuf), "nullptr", -EFAULT);
+
+        front = xwaop_load(xwsq_t, &cq->front, xwaop_mo_acquire);
+        rear = xwaop_load(xwsq_t, &cq->rear, xwaop_mo_acquire);
+        *avbbuf = (xwsz_t)(rear - front);
+        return XWOK;
+}
@@ -0,0 +1,230 @@
+/**
+ * @file
+ * @brief 循环队列：单生产者单消费者无锁模式
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwmd_isc_xwcq_spsc_h__
+#define __xwmd_isc_xwcq_spsc_h__
+
+#include <xwos/standard.h>
+#include <xwos/osal/sync/sem.h>
+
+/**
+ * @defgroup xwmd_isc_xwcq_spsc 单生产者单消费者循环队列
+ * @ingroup xwmd_isc_xwcq
+ * 单生产者单消费者循环队列是 @ref xwmd_isc_xwcq 的无锁版本，
+ * 适用于只有一个生产者（通常是中断）与一个消费者（通常是线程）的场景。
+ * 需要配置 `XWMDCFG_isc_xwcq_SPSC` 为 `1` 。
+ *
+ *
+ * ## 与普通循环队列的区别
+ *
+ * + 只有生产者写 `rear` ，只有消费者写 `front` ，两者分别位于不同的缓存行，
+ *   通过获取-释放内存序同步，入队与离队都不需要自旋锁，也不需要关闭中断；
+ * + 队列满时，入队返回 `-ENOSPC` ，不会覆盖最旧的数据，因为 `front` 只能由消费者修改；
+ * + 信号量只用于唤醒阻塞的消费者，消费者没有阻塞时，生产者不会发布信号量；
+ * + 只支持 **入队** 与 **首端离队** 。
+ *
+ *
+ * ## 发送消息
+ *
+ * + `xwcq_spsc_eq()` ：入队，可在 **任意** 上下文使用，同一时刻只能有一个生产者
+ *
+ *
+ * ## 接收消息
+ *
+ * + `xwcq_spsc_dq()` ：等待消息，只能在 **线程** 上下文使用
+ * + `xwcq_spsc_dq_to()` ：限时等待消息，只能在 **线程** 上下文使用
+ * + `xwcq_spsc_dq_unintr()` ：不可中断地等待消息，只能在 **线程** 上下文使用
+ * + `xwcq_spsc_trydq()` ：尝试获取消息，可在 **任意** 上下文使用
+ *
+ * 同一时刻只能有一个消费者。
+ *
+ *
+ * ## 获取循环队列中有效数据槽的数量
+ *
+ * + `xwcq_spsc_get_availability()` ：获取循环队列中有效数据槽的数量
+ *
+ * @{
+ */
+
+/**
+ * @brief 单生产者单消费者循环队列对象
+ */
+struct xwcq_spsc {
+        xwsz_t slotsize; /**< 队列中数据槽的大小 */
+        xwsz_t slotnum; /**< 队列中数据槽的数量 */
+        xwu8_t * q; /**< 队列 */
+        struct xwos_sem sem; /**< 唤醒阻塞的消费者的信号量 */
+        atomic_xwsq_t waiting; /**< 消费者是否正在阻塞等待 */
+        __xwcc_alignl1cache atomic_xwsq_t rear; /**< 已入队的数据数量：只由生产者写 */
+        __xwcc_alignl1cache atomic_xwsq_t front; /**< 已离队的数据数量：只由消费者写 */
+};
+
+/**
+ * @brief XWCQ API：初始化单生产者单消费者循环队列
+ * @param[in] cq: 循环队列对象的指针
+ * @param[in] slotsize: 每个数据槽的大小
+ * @param[in] slotnum: 数据槽的数量
+ * @param[in] mem: 数据缓冲区的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ESIZE: `slotsize` 或 `slotnum` 为 `0` ，或 `slotnum` 不是2的幂
+ * @retval -EALIGN: `slotsize` 不是 `XWMMCFG_ALIGNMENT` 的整数倍
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 数据缓冲区 `mem` 大小不能小于 `slotsize * slotnum` ，
+ *   用户应该使用宏 @ref XWCQ_DEF_MEMPOOL() 来定义数据缓冲区。
+ * + 队列最多可容纳 `slotnum` 个数据。
+ * + `slotnum` 必须是2的幂，读写计数器回绕时数据槽的位置才是连续的。
+ */
+xwer_t xwcq_spsc_init(struct xwcq_spsc * cq, xwsz_t slotsize, xwsz_t slotnum,
+                      xwu8_t * mem);
+
+/**
+ * @brief XWCQ API：销毁单生产者单消费者循环队列
+ * @param[in] cq: 循环队列对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：任意
+ */
+xwer_t xwcq_spsc_fini(struct xwcq_spsc * cq);
+
+/**
+ * @brief XWCQ API：将数据发送到循环队列的 **尾端** （入队，EnQueue）
+ * @param[in] cq: 循环队列对象的指针
+ * @param[in] data: 数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据的大小
+ * + (O) 作为输出时，返回实际入队的数据大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOSPC: 循环队列已满
+ * @note
+ * + 上下文：任意
+ * + 同一时刻只能有一个生产者
+ * @details
+ * + 如果数据大小超过数据槽的大小，数据会被截断。
+ * + 如果循环队列已满，此CAPI不会覆盖最旧的数据，而是返回 `-ENOSPC` 。
+ */
+xwer_t xwcq_spsc_eq(struct xwcq_spsc * cq, const xwu8_t * data, xwsz_t * size);
+
+/**
+ * @brief XWCQ API：等待从循环队列的 **首端** 接收数据 （离队，DeQueue）
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的数据大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINTR: 等待被中断
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * + 同一时刻只能有一个消费者
+ */
+xwer_t xwcq_spsc_dq(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size);
+
+/**
+ * @brief XWCQ API：限时等待从循环队列的 **首端** 接收数据 （离队，DeQueue）
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的数据大小
+ * @param[in] to: 期望唤醒的时间点
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINTR: 等待被中断
+ * @retval -ETIMEDOUT: 超时
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * + 同一时刻只能有一个消费者
+ * @details
+ * + `to` 表示等待超时的时间点：
+ *   + `to` 通常是未来的时间，即 **当前系统时间** + `delta` ，
+ *     可以使用 `xwtm_ft(delta)` 表示；
+ *   + 如果 `to` 是过去的时间点，将直接返回 `-ETIMEDOUT` 。
+ */
+xwer_t xwcq_spsc_dq_to(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size,
+                       xwtm_t to);
+
+/**
+ * @brief XWCQ API：等待从循环队列的 **首端** 接收数据 （离队，DeQueue），
+ *                  并且等待不可被中断
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的数据大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * + 同一时刻只能有一个消费者
+ */
+xwer_t xwcq_spsc_dq_unintr(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size);
+
+/**
+ * @brief XWCQ API：尝试从循环队列的 **首端** 接收数据 （离队，DeQueue）
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的数据大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENODATA: 循环队列为空
+ * @note
+ * + 上下文：任意
+ * + 同一时刻只能有一个消费者
+ */
+xwer_t xwcq_spsc_trydq(struct xwcq_spsc * cq, xwu8_t * data, xwsz_t * size);
+
+/**
+ * @brief XWCQ API: 获取循环队列中有效数据槽的数量
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] avbbuf: 指向缓冲区的指针，通过此缓冲区返回有效数据槽的数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：任意
+ * @details
+ * 返回的是调用时的快照，生产者与消费者可能同时在修改队列。
+ */
+xwer_t xwcq_spsc_get_availability(struct xwcq_spsc * cq, xwsz_t * avbbuf);
+
+/**
+ * @} xwmd_isc_xwcq_spsc
+ */
+
+#endif /* xwmd/isc/xwcq/spsc.h */
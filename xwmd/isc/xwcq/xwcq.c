@@ -31,6 +31,8 @@ void xwcq_construct(struct xwcq * cq, xwu8_t * mem)
         cq->slotnum = 0;
         cq->rear = 0;
         cq->front = 0;
+        cq->rsv = -1;
+        cq->pk = -1;
         cq->q = mem;
 }
 
@@ -84,6 +86,8 @@ xwer_t xwcq_activate(struct xwcq * cq, xwsz_t slotsize, xwsz_t slotnum,
         cq->slotnum = slotnum;
         cq->rear = 0;
         cq->front = 0;
+        cq->rsv = -1;
+        cq->pk = -1;
         return XWOK;
 
 err_xwobj_activate:
@@ -149,11 +153,48 @@ xwer_t xwcq_put(struct xwcq * cq)
         return xwos_object_put(&cq->xwobj);
 }
 
+/**
+ * @brief 将尾端的数据槽发布到队列中
+ * @param[in] cq: 循环队列对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENOSPC: 下一个空白数据槽正被消费者占用
+ * @note
+ * + 调用者必须持有锁 `cq->lock`
+ */
+static __xwmd_code
+xwer_t xwcq_advance_rear_locked(struct xwcq * cq)
+{
+        xwssz_t rear;
+        xwer_t rc;
+
+        rear = cq->rear + 1;
+        if (rear >= (xwssz_t)cq->slotnum) {
+                rear = 0;
+        }
+        if (rear == cq->pk) {
+                /* 被消费者占用的数据槽不可被覆盖 */
+                rc = -ENOSPC;
+        } else {
+                cq->rear = rear;
+                if (cq->rear == cq->front) {
+                        /* Queue is overflow. Discard the oldest data */
+                        cq->front++;
+                        if (cq->front >= (xwssz_t)cq->slotnum) {
+                                cq->front = 0;
+                        }
+                }
+                rc = XWOK;
+        }
+        return rc;
+}
+
 __xwmd_api
 xwer_t xwcq_eq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size)
 {
         xwreg_t cpuirq;
         xwsz_t eqsize;
+        xwer_t rc;
 
         XWOS_VALIDATE((cq), "nullptr", -EFAULT);
         XWOS_VALIDATE((data), "nullptr", -EFAULT);
@@ -162,30 +203,34 @@ xwer_t xwcq_eq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size)
         eqsize = *size;
         eqsize = (eqsize > cq->slotsize) ? cq->slotsize : eqsize;
         xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv >= 0) {
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                rc = -EBUSY;
+                goto err_busy;
+        }
         // cppcheck-suppress [misra-c2012-17.7]
         memcpy(&cq->q[(xwsz_t)cq->rear * cq->slotsize], data, eqsize);
-        cq->rear++;
-        if (cq->rear >= (xwssq_t)cq->slotnum) {
-                cq->rear = 0;
-        }
-        if (cq->rear == cq->front) {
-                /* Queue is overflow. Discard the oldest data */
-                cq->front++;
-                if (cq->front >= (xwssq_t)cq->slotnum) {
-                        cq->front = 0;
-                }
-        }
+        rc = xwcq_advance_rear_locked(cq);
         xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+        if (rc < 0) {
+                goto err_nospc;
+        }
         xwos_sem_post(&cq->sem);
         *size = eqsize;
         return XWOK;
+
+err_nospc:
+err_busy:
+        return rc;
 }
 
 __xwmd_api
 xwer_t xwcq_jq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size)
 {
         xwreg_t cpuirq;
+        xwssz_t front;
         xwsz_t eqsize;
+        xwer_t rc;
 
         XWOS_VALIDATE((cq), "nullptr", -EFAULT);
         XWOS_VALIDATE((data), "nullptr", -EFAULT);
@@ -194,15 +239,27 @@ xwer_t xwcq_jq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size)
         eqsize = *size;
         eqsize = (eqsize > cq->slotsize) ? cq->slotsize : eqsize;
         xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
-        cq->front--;
-        if (cq->front < 0) {
-                cq->front = (xwssz_t)cq->slotnum - 1;
+        if (cq->rsv >= 0) {
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                rc = -EBUSY;
+                goto err_busy;
         }
+        front = cq->front - 1;
+        if (front < 0) {
+                front = (xwssz_t)cq->slotnum - 1;
+        }
+        if (front == cq->pk) {
+                /* 被消费者占用的数据槽不可被覆盖 */
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                rc = -ENOSPC;
+                goto err_nospc;
+        }
+        cq->front = front;
         if (cq->front == cq->rear) {
                 /* Queue is overflow. Discard the newest data */
                 cq->rear--;
                 if (cq->rear < 0) {
-                        cq->rear = (xwssz_t)cq->slotnum;
+                        cq->rear = (xwssz_t)cq->slotnum - 1;
                 }
         }
         // cppcheck-suppress [misra-c2012-17.7]
@@ -211,6 +268,62 @@ xwer_t xwcq_jq(struct xwcq * cq, const xwu8_t * data, xwsz_t * size)
         xwos_sem_post(&cq->sem);
         *size = eqsize;
         return XWOK;
+
+err_nospc:
+err_busy:
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_eq_n(struct xwcq * cq, const xwu8_t * data, xwsz_t size, xwsz_t * num)
+{
+        xwreg_t cpuirq;
+        xwsz_t eqsize;
+        xwsz_t n;
+        xwsz_t i;
+        xwer_t rc;
+
+        XWOS_VALIDATE((cq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num), "nullptr", -EFAULT);
+
+        n = *num;
+        eqsize = (size > cq->slotsize) ? cq->slotsize : size;
+        rc = XWOK;
+        xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv >= 0) {
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                rc = -EBUSY;
+                goto err_busy;
+        }
+        for (i = 0; i < n; i++) {
+                // cppcheck-suppress [misra-c2012-17.7]
+                memcpy(&cq->q[(xwsz_t)cq->rear * cq->slotsize], &data[i * size],
+                       eqsize);
+                rc = xwcq_advance_rear_locked(cq);
+                if (rc < 0) {
+                        break;
+                }
+        }
+        xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+        if ((xwsz_t)0 == i) {
+                goto err_nospc;
+        }
+        *num = i;
+        /* 信号量的值不会超过 `slotnum` ，多余的发布没有意义 */
+        if (i > cq->slotnum) {
+                i = cq->slotnum;
+        }
+        while (i > (xwsz_t)0) {
+                xwos_sem_post(&cq->sem);
+                i--;
+        }
+        return XWOK;
+
+err_nospc:
+err_busy:
+        *num = 0;
+        return rc;
 }
 
 __xwmd_api
@@ -318,6 +431,116 @@ err_sem_trywait:
         return rc;
 }
 
+/**
+ * @brief 从循环队列的首端取出多个数据
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] buf: 数组缓冲区
+ * @param[in] size: 数组中每个元素的大小
+ * @param[in] max: 最多取出的数据数量
+ * @return 实际取出的数据数量
+ * @note
+ * + 调用者必须已经获取了一个信号量的值
+ */
+static __xwmd_code
+xwsz_t xwcq_take_front_n(struct xwcq * cq, xwu8_t * buf, xwsz_t size, xwsz_t max)
+{
+        xwreg_t cpuirq;
+        xwsz_t cpsz;
+        xwsz_t cnt;
+        xwsz_t i;
+
+        /* 已经获取了第一个数据，后面的数据只取已经在队列中的，不再等待 */
+        cnt = 1;
+        while ((cnt < max) && (XWOK == xwos_sem_trywait(&cq->sem))) {
+                cnt++;
+        }
+        cpsz = (size > cq->slotsize) ? cq->slotsize : size;
+        xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        for (i = 0; i < cnt; i++) {
+                // cppcheck-suppress [misra-c2012-17.7]
+                memcpy(&buf[i * size], &cq->q[(xwsz_t)cq->front * cq->slotsize], cpsz);
+                cq->front++;
+                if (cq->front >= (xwssz_t)cq->slotnum) {
+                        cq->front = 0;
+                }
+        }
+        xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+        return cnt;
+}
+
+__xwmd_api
+xwer_t xwcq_dq_n(struct xwcq * cq, xwu8_t * buf, xwsz_t size, xwsz_t * num)
+{
+        return xwcq_dq_n_to(cq, buf, size, num, XWTM_MAX);
+}
+
+__xwmd_api
+xwer_t xwcq_dq_n_to(struct xwcq * cq, xwu8_t * buf, xwsz_t size, xwsz_t * num,
+                    xwtm_t to)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+        XWOS_VALIDATE(buf, "nullptr", -EFAULT);
+        XWOS_VALIDATE(num, "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_wait_to(&cq->sem, to);
+        if (rc < 0) {
+                goto err_sem_wait_to;
+        }
+        *num = xwcq_take_front_n(cq, buf, size, *num);
+        return XWOK;
+
+err_sem_wait_to:
+        *num = 0;
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_dq_n_unintr(struct xwcq * cq, xwu8_t * buf, xwsz_t size, xwsz_t * num)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+        XWOS_VALIDATE(buf, "nullptr", -EFAULT);
+        XWOS_VALIDATE(num, "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_wait_unintr(&cq->sem);
+        if (rc < 0) {
+                goto err_sem_wait_unintr;
+        }
+        *num = xwcq_take_front_n(cq, buf, size, *num);
+        return XWOK;
+
+err_sem_wait_unintr:
+        *num = 0;
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_trydq_n(struct xwcq * cq, xwu8_t * buf, xwsz_t size, xwsz_t * num)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+        XWOS_VALIDATE(buf, "nullptr", -EFAULT);
+        XWOS_VALIDATE(num, "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_trywait(&cq->sem);
+        if (rc < 0) {
+                goto err_sem_trywait;
+        }
+        *num = xwcq_take_front_n(cq, buf, size, *num);
+        return XWOK;
+
+err_sem_trywait:
+        *num = 0;
+        return rc;
+}
+
 __xwmd_api
 xwer_t xwcq_rq(struct xwcq * cq, xwu8_t * buf, xwsz_t * size)
 {
@@ -343,6 +566,13 @@ xwer_t xwcq_rq_to(struct xwcq * cq, xwu8_t * buf, xwsz_t * size, xwtm_t to)
                 goto err_sem_wait_to;
         }
         xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv >= 0) {
+                /* 尾端的数据槽正被生产者预留，不可反向离队 */
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                xwos_sem_post(&cq->sem);
+                rc = -EBUSY;
+                goto err_busy;
+        }
         cq->rear--;
         if (cq->rear < 0) {
                 cq->rear = (xwssz_t)cq->slotnum - 1;
@@ -353,6 +583,7 @@ xwer_t xwcq_rq_to(struct xwcq * cq, xwu8_t * buf, xwsz_t * size, xwtm_t to)
         *size = cpsz;
         return XWOK;
 
+err_busy:
 err_sem_wait_to:
         return rc;
 }
@@ -376,6 +607,13 @@ xwer_t xwcq_rq_unintr(struct xwcq * cq, xwu8_t * buf, xwsz_t * size)
                 goto err_sem_wait_unintr;
         }
         xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv >= 0) {
+                /* 尾端的数据槽正被生产者预留，不可反向离队 */
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                xwos_sem_post(&cq->sem);
+                rc = -EBUSY;
+                goto err_busy;
+        }
         cq->rear--;
         if (cq->rear < 0) {
                 cq->rear = (xwssz_t)cq->slotnum - 1;
@@ -386,6 +624,7 @@ xwer_t xwcq_rq_unintr(struct xwcq * cq, xwu8_t * buf, xwsz_t * size)
         *size = cpsz;
         return XWOK;
 
+err_busy:
 err_sem_wait_unintr:
         return rc;
 }
@@ -409,6 +648,13 @@ xwer_t xwcq_tryrq(struct xwcq * cq, xwu8_t * buf, xwsz_t * size)
                 goto err_sem_trywait;
         }
         xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv >= 0) {
+                /* 尾端的数据槽正被生产者预留，不可反向离队 */
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                xwos_sem_post(&cq->sem);
+                rc = -EBUSY;
+                goto err_busy;
+        }
         cq->rear--;
         if (cq->rear < 0) {
                 cq->rear = (xwssz_t)cq->slotnum - 1;
@@ -419,6 +665,7 @@ xwer_t xwcq_tryrq(struct xwcq * cq, xwu8_t * buf, xwsz_t * size)
         *size = cpsz;
         return XWOK;
 
+err_busy:
 err_sem_trywait:
         return rc;
 }
@@ -630,6 +877,193 @@ err_sem_trywait:
         return rc;
 }
 
+__xwmd_api
+xwer_t xwcq_reserve(struct xwcq * cq, xwu8_t ** slot)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+        XWOS_VALIDATE(slot, "nullptr", -EFAULT);
+
+        xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv >= 0) {
+                rc = -EBUSY;
+        } else {
+                /* 尾端的数据槽总是空白的，并且不会被消费者占用 */
+                cq->rsv = cq->rear;
+                *slot = &cq->q[(xwsz_t)cq->rsv * cq->slotsize];
+                rc = XWOK;
+        }
+        xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_commit(struct xwcq * cq)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+
+        xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv < 0) {
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                rc = -ENOENT;
+                goto err_norsv;
+        }
+        rc = xwcq_advance_rear_locked(cq);
+        if (rc < 0) {
+                /* 保留预留，消费者释放数据槽后可再次提交 */
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                goto err_nospc;
+        }
+        cq->rsv = -1;
+        xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+        xwos_sem_post(&cq->sem);
+        return XWOK;
+
+err_nospc:
+err_norsv:
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_cancel(struct xwcq * cq)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+
+        xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->rsv < 0) {
+                rc = -ENOENT;
+        } else {
+                cq->rsv = -1;
+                rc = XWOK;
+        }
+        xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+        return rc;
+}
+
+/**
+ * @brief 占用首端的数据槽
+ * @param[in] cq: 循环队列对象的指针
+ * @param[out] slot: 指向缓冲区的指针，通过此缓冲区返回数据槽的地址
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EBUSY: 已经有数据槽被占用
+ * @note
+ * + 调用者必须已经获得信号量 `cq->sem`
+ * @details
+ * 被占用的数据槽离开队列，首端移动到下一个数据槽，
+ * 其他消费者可以继续接收后面的数据。
+ */
+static __xwmd_code
+xwer_t xwcq_take_front(struct xwcq * cq, xwu8_t ** slot)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->pk >= 0) {
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                xwos_sem_post(&cq->sem);
+                rc = -EBUSY;
+        } else {
+                cq->pk = cq->front;
+                *slot = &cq->q[(xwsz_t)cq->pk * cq->slotsize];
+                cq->front++;
+                if (cq->front >= (xwssz_t)cq->slotnum) {
+                        cq->front = 0;
+                }
+                xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+                rc = XWOK;
+        }
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_peek_slot(struct xwcq * cq, xwu8_t ** slot)
+{
+        return xwcq_peek_slot_to(cq, slot, XWTM_MAX);
+}
+
+__xwmd_api
+xwer_t xwcq_peek_slot_to(struct xwcq * cq, xwu8_t ** slot, xwtm_t to)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+        XWOS_VALIDATE(slot, "nullptr", -EFAULT);
+
+        rc = xwos_sem_wait_to(&cq->sem, to);
+        if (rc < 0) {
+                goto err_sem_wait_to;
+        }
+        rc = xwcq_take_front(cq, slot);
+
+err_sem_wait_to:
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_peek_slot_unintr(struct xwcq * cq, xwu8_t ** slot)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+        XWOS_VALIDATE(slot, "nullptr", -EFAULT);
+
+        rc = xwos_sem_wait_unintr(&cq->sem);
+        if (rc < 0) {
+                goto err_sem_wait_unintr;
+        }
+        rc = xwcq_take_front(cq, slot);
+
+err_sem_wait_unintr:
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_trypeek_slot(struct xwcq * cq, xwu8_t ** slot)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+        XWOS_VALIDATE(slot, "nullptr", -EFAULT);
+
+        rc = xwos_sem_trywait(&cq->sem);
+        if (rc < 0) {
+                goto err_sem_trywait;
+        }
+        rc = xwcq_take_front(cq, slot);
+
+err_sem_trywait:
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwcq_release_slot(struct xwcq * cq)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        XWOS_VALIDATE(cq, "nullptr", -EFAULT);
+
+        xwos_splk_lock_cpuirqsv(&cq->lock, &cpuirq);
+        if (cq->pk < 0) {
+                rc = -ENOENT;
+        } else {
+                cq->pk = -1;
+                rc = XWOK;
+        }
+        xwos_splk_unlock_cpuirqrs(&cq->lock, cpuirq);
+        return rc;
+}
+
 xwer_t xwcq_flush(struct xwcq * cq)
 {
         XWOS_VALIDATE(cq, "nullptr", -EFAULT);
@@ -637,6 +1071,8 @@ xwer_t xwcq_flush(struct xwcq * cq)
         xwos_sem_freeze(&cq->sem);
         cq->rear = 0;
         cq->front = 0;
+        cq->rsv = -1;
+        cq->pk = -1;
         xwos_sem_thaw(&cq->sem);
         return XWOK;
 }
@@ -16,6 +16,10 @@ XWMO_CSRCS := xwcq.c
 XWMO_CFLAGS :=
 XWMO_INCDIRS :=
 
+ifeq ($(XWMDCFG_isc_xwcq_SPSC),y)
+  XWMO_CSRCS += spsc.c
+endif
+
 ifeq ($(XWMDCFG_isc_xwcq_CXX),y)
   XWMO_CXXSRCS :=
   XWMO_CXXFLAGS :=
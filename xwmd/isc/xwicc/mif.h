@@ -0,0 +1,256 @@
+/**
+ * @file
+ * @brief 核间通道：模块接口
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwmd_isc_xwicc_mif_h__
+#define __xwmd_isc_xwicc_mif_h__
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/osal/sync/sem.h>
+
+/**
+ * @defgroup xwmd_isc_xwicc 核间通道
+ * @ingroup xwmd_isc
+ * 核间通道用于多核内核中CPU之间传递定长的数据，需要配置 `XWMDCFG_isc_xwicc` 为 `1` ，
+ * 并且移植层需要实现核间中断 `xwos_irq_ipi()` 。
+ *
+ *
+ * ## 环形缓冲区
+ *
+ * 每一对 **(源CPU, 目的地CPU)** 都有一个独立的单生产者单消费者环形缓冲区：
+ * 生产者只能是源CPU，消费者只能是目的地CPU，因此收发都不需要锁，
+ * 也不会与其他CPU对之间的通讯竞争。
+ *
+ * + 环形缓冲区的生产者计数器、消费者计数器与数据区各自独占高速缓存行，
+ *   避免生产者与消费者之间的伪共享。
+ * + 同一个CPU上的多个线程或中断可以同时使用核间通道，它们之间以关闭本地CPU中断的方式互斥。
+ *
+ *
+ * ## 门铃
+ *
+ * 源CPU只在环形缓冲区由空变为非空时向目的地CPU发送核间中断（门铃），
+ * 目的地CPU尚未取走数据时，后续的发送不会再产生核间中断。
+ * 用户需要在每个目的地CPU上开启核间中断 `irqn` ，并在中断处理函数中调用 `xwicc_isr()` 。
+ *
+ *
+ * ## 数据缓冲区
+ *
+ * 数据缓冲区由用户提供，应该使用宏 @ref XWICC_DEF_MEMPOOL() 来定义。
+ *
+ *
+ * ## 发送与接收
+ *
+ * + `xwicc_send()` ：从本地CPU向目的地CPU发送数据，不会阻塞，可在 **任意** 上下文使用
+ * + `xwicc_tryrecv()` ：本地CPU尝试接收数据，不会阻塞，可在 **任意** 上下文使用
+ * + `xwicc_recv()` ：本地CPU接收数据，缓冲区为空时就阻塞等待，只可在 **线程** 上下文使用
+ * + `xwicc_recv_to()` ：本地CPU限时等待接收数据，只可在 **线程** 上下文使用
+ *
+ * 阻塞接收的线程必须固定在一个CPU上，环形缓冲区只允许目的地CPU消费。
+ * @{
+ */
+
+/**
+ * @brief 一个环形缓冲区的数据区大小，按高速缓存行对齐
+ * @param[in] slotsize: 数据槽的大小
+ * @param[in] slotnum: 数据槽的数量
+ */
+#define XWICC_RING_SIZE(slotsize, slotnum) \
+        XWBOP_ALIGN((slotsize) * (slotnum), CPUCFG_L1_CACHELINE_SIZE)
+
+/**
+ * @brief 定义核间通道的数据缓冲区
+ * @param[in] name: 数组名
+ * @param[in] slotsize: 数据槽的大小
+ * @param[in] slotnum: 数据槽的数量
+ */
+#define XWICC_DEF_MEMPOOL(name, slotsize, slotnum) \
+        __xwcc_alignl1cache xwu8_t name[CPUCFG_CPU_NUM * CPUCFG_CPU_NUM * \
+                                        XWICC_RING_SIZE((slotsize), (slotnum))]
+
+/**
+ * @brief 单生产者单消费者环形缓冲区
+ */
+struct xwicc_ring {
+        __xwcc_alignl1cache atomic_xwsq_t rear; /**< 生产者计数器，只由源CPU写 */
+        __xwcc_alignl1cache atomic_xwsq_t front; /**< 消费者计数器，只由目的地CPU写 */
+        __xwcc_alignl1cache xwu8_t * q; /**< 数据区 */
+};
+
+/**
+ * @brief 目的地CPU的接收端
+ */
+struct __xwcc_alignl1cache xwicc_rx {
+        struct xwos_sem sem; /**< 门铃信号量 */
+        xwid_t next; /**< 下一次从哪个源CPU开始接收 */
+};
+
+/**
+ * @brief 核间通道对象
+ */
+struct xwicc {
+        xwirq_t irqn; /**< 核间中断的中断号 */
+        xwsz_t slotsize; /**< 数据槽的大小 */
+        xwsz_t slotnum; /**< 数据槽的数量 */
+        struct xwicc_ring ring[CPUCFG_CPU_NUM][CPUCFG_CPU_NUM]; /**< 环形缓冲区，
+                                                                      下标为[源CPU][目的地CPU] */
+        struct xwicc_rx rx[CPUCFG_CPU_NUM]; /**< 每个目的地CPU的接收端 */
+};
+
+/**
+ * @brief XWICC API：初始化核间通道
+ * @param[in] icc: 核间通道对象的指针
+ * @param[in] irqn: 核间中断的中断号
+ * @param[in] slotsize: 数据槽的大小
+ * @param[in] slotnum: 数据槽的数量
+ * @param[in] mem: 数据缓冲区
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ESIZE: 大小或数量为0，或数量不是2的幂
+ * @retval -EALIGN: 数据槽的大小没有对齐
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 数据缓冲区应该使用宏 @ref XWICC_DEF_MEMPOOL() 来定义。
+ * + 单个数据槽的大小 `slotsize` 必须是系统配置 `XWMMCFG_ALIGNMENT` 的整数倍。
+ * + 数据槽的数量 `slotnum` 必须是2的幂，读写计数器回绕时数据槽的位置才是连续的。
+ * + 初始化后，用户还需在每个目的地CPU上开启核间中断 `irqn` 。
+ */
+xwer_t xwicc_init(struct xwicc * icc, xwirq_t irqn,
+                  xwsz_t slotsize, xwsz_t slotnum, xwu8_t * mem);
+
+/**
+ * @brief XWICC API：销毁核间通道
+ * @param[in] icc: 核间通道对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：任意
+ */
+xwer_t xwicc_fini(struct xwicc * icc);
+
+/**
+ * @brief XWICC API：从本地CPU向目的地CPU发送数据
+ * @param[in] icc: 核间通道对象的指针
+ * @param[in] dst: 目的地CPU的ID
+ * @param[in] data: 数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据的大小
+ * + (O) 作为输出时，返回实际发送的数据大小，超过数据槽大小的部分被截断
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ERANGE: 目的地CPU的ID超出范围
+ * @retval -ENOSPC: 环形缓冲区已满
+ * @retval -ENOSYS: 移植层没有实现核间中断
+ * @retval -ERANGE: 核间中断的中断号超出范围
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 目的地可以是本地CPU，此时门铃也是发给本地CPU的核间中断。
+ * + 只有环形缓冲区由空变为非空时，此CAPI才会发送门铃。
+ * + 发送门铃失败时，返回 `xwos_irq_ipi()` 的错误码，此时数据已经写入环形缓冲区，
+ *   `size` 也已更新，但目的地CPU不会被唤醒，只能通过 `xwicc_tryrecv()` 取走。
+ */
+xwer_t xwicc_send(struct xwicc * icc, xwid_t dst, const xwu8_t * data, xwsz_t * size);
+
+/**
+ * @brief XWICC API：本地CPU尝试接收数据
+ * @param[in] icc: 核间通道对象的指针
+ * @param[out] src: 指向缓冲区的指针，此缓冲区用于返回源CPU的ID，可为 `NULL`
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的数据大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENODATA: 没有数据
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 此CAPI轮流检查所有源CPU到本地CPU的环形缓冲区，避免某个源CPU的数据一直得不到处理。
+ */
+xwer_t xwicc_tryrecv(struct xwicc * icc, xwid_t * src, xwu8_t * data, xwsz_t * size);
+
+/**
+ * @brief XWICC API：本地CPU接收数据，若没有数据，就无限等待
+ * @param[in] icc: 核间通道对象的指针
+ * @param[out] src: 指向缓冲区的指针，此缓冲区用于返回源CPU的ID，可为 `NULL`
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的数据大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINTR: 等待被中断
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDSPMPT: 抢占被关闭
+ * @retval -EDSBH: 中断底半部被关闭
+ * @retval -EPERM: 接收线程被迁移到了其他CPU
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 接收线程必须固定在一个CPU上（不可调用 `xwos_thd_migrate()` 迁移），
+ *   此CAPI只接收进入时所在CPU的数据；若等待期间线程被迁移，返回 `-EPERM` 。
+ */
+xwer_t xwicc_recv(struct xwicc * icc, xwid_t * src, xwu8_t * data, xwsz_t * size);
+
+/**
+ * @brief XWICC API：本地CPU接收数据，若没有数据，就限时等待
+ * @param[in] icc: 核间通道对象的指针
+ * @param[out] src: 指向缓冲区的指针，此缓冲区用于返回源CPU的ID，可为 `NULL`
+ * @param[out] data: 指向缓冲区的指针，此缓冲区用于接收数据
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的数据大小
+ * @param[in] to: 期望唤醒的时间点
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINTR: 等待被中断
+ * @retval -ETIMEDOUT: 超时
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDSPMPT: 抢占被关闭
+ * @retval -EDSBH: 中断底半部被关闭
+ * @retval -EPERM: 接收线程被迁移到了其他CPU
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 接收线程必须固定在一个CPU上（不可调用 `xwos_thd_migrate()` 迁移），
+ *   此CAPI只接收进入时所在CPU的数据；若等待期间线程被迁移，返回 `-EPERM` 。
+ * + `to` 表示等待超时的时间点：
+ *   + `to` 通常是未来的时间，即 **当前系统时间** + `delta` ，
+ *     可以使用 `xwtm_ft(delta)` 表示；
+ *   + 如果 `to` 是过去的时间点，将直接返回 `-ETIMEDOUT` 。
+ */
+xwer_t xwicc_recv_to(struct xwicc * icc, xwid_t * src, xwu8_t * data, xwsz_t * size,
+                     xwtm_t to);
+
+/**
+ * @brief XWICC API：门铃中断的处理函数
+ * @param[in] icc: 核间通道对象的指针
+ * @note
+ * + 上下文：中断
+ * @details
+ * + 用户需要在每个目的地CPU的核间中断 `irqn` 的处理函数中调用此函数，
+ *   唤醒本地CPU上等待接收的线程。
+ */
+void xwicc_isr(struct xwicc * icc);
+
+/**
+ * @} xwmd_isc_xwicc
+ */
+
+#endif /* xwmd/isc/xwicc/mif.h */
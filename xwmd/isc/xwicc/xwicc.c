@@ -0,0 +1,267 @@
+/**
+ * @file
+ * @brief 核间通道：环形缓冲区与门铃
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ * @note
+ * + `rear` 与 `front` 是一直递增的计数器，二者之差是环形缓冲区中数据的数量，
+ *   数据槽的位置是计数器的低位（ `slotnum` 是2的幂，计数器回绕时位置仍然连续）。
+ * + 源CPU更新 `rear` 后以全屏障隔开，再读取 `front` ：
+ *   若 `front` 等于更新前的 `rear` ，说明目的地CPU已经取走了所有旧数据，
+ *   环形缓冲区由空变为非空，需要发送门铃。
+ * + 目的地CPU发现所有环形缓冲区为空后，以全屏障隔开，再检查一次，仍为空才等待门铃。
+ *   两边都是“写自己的计数器、全屏障、读对方的计数器”，
+ *   因此二者至少有一方能看到对方的修改，不会丢失门铃。
+ */
+
+#include <string.h>
+#include <xwos/standard.h>
+#include <xwos/lib/xwaop.h>
+#include <xwos/lib/mb.h>
+#include <xwos/osal/irq.h>
+#include <xwos/osal/skd.h>
+#include <xwos/osal/sync/sem.h>
+#include <xwmd/isc/xwicc/mif.h>
+
+__xwmd_api
+xwer_t xwicc_init(struct xwicc * icc, xwirq_t irqn,
+                  xwsz_t slotsize, xwsz_t slotnum, xwu8_t * mem)
+{
+        xwsz_t ringsize;
+        xwid_t src;
+        xwid_t dst;
+        xwer_t rc;
+
+        XWOS_VALIDATE((icc), "nullptr", -EFAULT);
+        XWOS_VALIDATE((mem), "nullptr", -EFAULT);
+        XWOS_VALIDATE((slotsize > 0), "zero-size", -ESIZE);
+        XWOS_VALIDATE((slotnum > 0), "zero-num", -ESIZE);
+        XWOS_VALIDATE(!(slotnum & (slotnum - 1U)), "num-not-pow2", -ESIZE);
+        XWOS_VALIDATE(!(slotsize & XWMM_UNALIGNED_MASK), "size-not-aligned", -EALIGN);
+
+        icc->irqn = irqn;
+        icc->slotsize = slotsize;
+        icc->slotnum = slotnum;
+        ringsize = XWICC_RING_SIZE(slotsize, slotnum);
+        for (src = 0; src < (xwid_t)CPUCFG_CPU_NUM; src++) {
+                for (dst = 0; dst < (xwid_t)CPUCFG_CPU_NUM; dst++) {
+                        xwaop_store(xwsq_t, &icc->ring[src][dst].rear,
+                                    xwaop_mo_relaxed, 0);
+                        xwaop_store(xwsq_t, &icc->ring[src][dst].front,
+                                    xwaop_mo_relaxed, 0);
+                        icc->ring[src][dst].q =
+                                &mem[((src * CPUCFG_CPU_NUM) + dst) * ringsize];
+                }
+        }
+        for (dst = 0; dst < (xwid_t)CPUCFG_CPU_NUM; dst++) {
+                icc->rx[dst].next = 0;
+                rc = xwos_sem_init(&icc->rx[dst].sem, 0, 1);
+                if (rc < 0) {
+                        goto err_sem_init;
+                }
+        }
+        return XWOK;
+
+err_sem_init:
+        while (dst > 0) {
+                dst--;
+                xwos_sem_fini(&icc->rx[dst].sem);
+        }
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwicc_fini(struct xwicc * icc)
+{
+        xwid_t dst;
+
+        XWOS_VALIDATE((icc), "nullptr", -EFAULT);
+
+        for (dst = 0; dst < (xwid_t)CPUCFG_CPU_NUM; dst++) {
+                xwos_sem_fini(&icc->rx[dst].sem);
+        }
+        return XWOK;
+}
+
+__xwmd_api
+xwer_t xwicc_send(struct xwicc * icc, xwid_t dst, const xwu8_t * data, xwsz_t * size)
+{
+        struct xwicc_ring * ring;
+        xwreg_t cpuirq;
+        xwsq_t rear;
+        xwsq_t front;
+        xwsz_t eqsize;
+        xwer_t rc;
+
+        XWOS_VALIDATE((icc), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((size), "nullptr", -EFAULT);
+        XWOS_VALIDATE((dst < (xwid_t)CPUCFG_CPU_NUM), "out-of-range", -ERANGE);
+
+        eqsize = *size;
+        eqsize = (eqsize > icc->slotsize) ? icc->slotsize : eqsize;
+        /* 关闭本地CPU的中断：本地CPU上的发送者互斥，并且不会被迁移到其他CPU */
+        xwos_cpuirq_save_lc(&cpuirq);
+        ring = &icc->ring[xwos_skd_get_cpuid_lc()][dst];
+        rear = xwaop_load(xwsq_t, &ring->rear, xwaop_mo_relaxed);
+        front = xwaop_load(xwsq_t, &ring->front, xwaop_mo_acquire);
+        if ((rear - front) >= (xwsq_t)icc->slotnum) {
+                xwos_cpuirq_restore_lc(cpuirq);
+                rc = -ENOSPC;
+                goto err_nospc;
+        }
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(&ring->q[(rear & (icc->slotnum - 1U)) * icc->slotsize], data, eqsize);
+        xwaop_store(xwsq_t, &ring->rear, xwaop_mo_release, rear + 1U);
+        xwmb_mp_mb();
+        front = xwaop_load(xwsq_t, &ring->front, xwaop_mo_relaxed);
+        xwos_cpuirq_restore_lc(cpuirq);
+        *size = eqsize;
+        if (front == rear) {
+                rc = xwos_irq_ipi(icc->irqn, dst);
+                if (rc < 0) {
+                        goto err_ipi;
+                }
+        }
+        return XWOK;
+
+err_ipi:
+err_nospc:
+        return rc;
+}
+
+/**
+ * @brief 从所有源CPU到目的地CPU `dst` 的环形缓冲区中取出一个数据
+ * @note
+ * + 调用者必须在CPU `dst` 上，并且已经关闭了本地CPU的中断
+ */
+static __xwmd_code
+xwer_t xwicc_rx_lc(struct xwicc * icc, xwid_t dst,
+                   xwid_t * src, xwu8_t * data, xwsz_t * size)
+{
+        struct xwicc_ring * ring;
+        struct xwicc_rx * rx;
+        xwid_t s;
+        xwsq_t i;
+        xwsq_t rear;
+        xwsq_t front;
+        xwsz_t cpsz;
+        xwer_t rc;
+
+        rc = -ENODATA;
+        rx = &icc->rx[dst];
+        for (i = 0; i < (xwsq_t)CPUCFG_CPU_NUM; i++) {
+                s = (rx->next + (xwid_t)i) % (xwid_t)CPUCFG_CPU_NUM;
+                ring = &icc->ring[s][dst];
+                front = xwaop_load(xwsq_t, &ring->front, xwaop_mo_relaxed);
+                rear = xwaop_load(xwsq_t, &ring->rear, xwaop_mo_acquire);
+                if (rear != front) {
+                        cpsz = (*size > icc->slotsize) ? icc->slotsize : *size;
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        memcpy(data,
+                               &ring->q[(front & (icc->slotnum - 1U)) * icc->slotsize],
+                               cpsz);
+                        xwaop_store(xwsq_t, &ring->front, xwaop_mo_release, front + 1U);
+                        rx->next = (s + 1U) % (xwid_t)CPUCFG_CPU_NUM;
+                        *size = cpsz;
+                        if (NULL != src) {
+                                *src = s;
+                        }
+                        rc = XWOK;
+                        break;
+                }
+        }
+        return rc;
+}
+
+/**
+ * @brief 在CPU `dst` 上尝试接收数据
+ * @note
+ * + 若调用者已被迁移到其他CPU，返回 `-EPERM` ，不会触碰CPU `dst` 的环形缓冲区，
+ *   以免破坏单消费者的约定。
+ */
+static __xwmd_code
+xwer_t xwicc_tryrecv_on(struct xwicc * icc, xwid_t dst,
+                        xwid_t * src, xwu8_t * data, xwsz_t * size)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        /* 关闭本地CPU的中断：本地CPU上的接收者互斥，并且不会被迁移到其他CPU */
+        xwos_cpuirq_save_lc(&cpuirq);
+        if (xwos_skd_get_cpuid_lc() != dst) {
+                rc = -EPERM;
+        } else {
+                rc = xwicc_rx_lc(icc, dst, src, data, size);
+        }
+        xwos_cpuirq_restore_lc(cpuirq);
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwicc_tryrecv(struct xwicc * icc, xwid_t * src, xwu8_t * data, xwsz_t * size)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        XWOS_VALIDATE((icc), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((size), "nullptr", -EFAULT);
+
+        /* 关闭本地CPU的中断：本地CPU上的接收者互斥，并且不会被迁移到其他CPU */
+        xwos_cpuirq_save_lc(&cpuirq);
+        rc = xwicc_rx_lc(icc, xwos_skd_get_cpuid_lc(), src, data, size);
+        xwos_cpuirq_restore_lc(cpuirq);
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwicc_recv(struct xwicc * icc, xwid_t * src, xwu8_t * data, xwsz_t * size)
+{
+        return xwicc_recv_to(icc, src, data, size, XWTM_MAX);
+}
+
+__xwmd_api
+xwer_t xwicc_recv_to(struct xwicc * icc, xwid_t * src, xwu8_t * data, xwsz_t * size,
+                     xwtm_t to)
+{
+        xwid_t dst;
+        xwer_t rc;
+
+        XWOS_VALIDATE((icc), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((size), "nullptr", -EFAULT);
+
+        /* 接收者固定在进入时的CPU上：
+           即使之后被迁移，等待的仍是此CPU的门铃，醒来后由 `xwicc_tryrecv_on()` 报错 */
+        dst = xwos_skd_get_cpuid_lc();
+        while (true) {
+                rc = xwicc_tryrecv_on(icc, dst, src, data, size);
+                if (-ENODATA != rc) {
+                        break;
+                }
+                /* 上一次更新的 `front` 必须先于再次检查时读取的 `rear` */
+                xwmb_mp_mb();
+                rc = xwicc_tryrecv_on(icc, dst, src, data, size);
+                if (-ENODATA != rc) {
+                        break;
+                }
+                rc = xwos_sem_wait_to(&icc->rx[dst].sem, to);
+                if (rc < 0) {
+                        break;
+                }
+                /* 信号量可能是之前多余的门铃遗留的，因此需要回到循环开始处重新检查 */
+        }
+        return rc;
+}
+
+__xwmd_api
+void xwicc_isr(struct xwicc * icc)
+{
+        xwos_sem_post(&icc->rx[xwos_skd_get_cpuid_lc()].sem);
+}
@@ -48,6 +48,11 @@
  *   + `xwmq_jq_to()` ：限时等待消息槽，只能在 **线程** 上下文使用
  *   + `xwmq_jq_unintr()` ：不可中断地等待消息槽，只能在 **线程** 上下文使用
  *   + `xwmq_tryjq()` ：尝试获取消息槽，可在 **任意** 上下文使用
+ * + 批量入队
+ *   + `xwmq_eq_n()` ：等待消息槽，只能在 **线程** 上下文使用
+ *   + `xwmq_eq_n_to()` ：限时等待消息槽，只能在 **线程** 上下文使用
+ *   + `xwmq_eq_n_unintr()` ：不可中断地等待消息槽，只能在 **线程** 上下文使用
+ *   + `xwmq_tryeq_n()` ：尝试获取消息槽，可在 **任意** 上下文使用
  *
  *
  * ## 接收消息
@@ -57,6 +62,11 @@
  *   + `xwmq_dq_to()` ：限时等待消息，只能在 **线程** 上下文使用
  *   + `xwmq_dq_unintr()` ：不可中断地等待消息，只能在 **线程** 上下文使用
  *   + `xwmq_trydq()` ：尝试获取消息，可在 **任意** 上下文使用
+ * + 首端批量离队
+ *   + `xwmq_dq_n()` ：等待消息，只能在 **线程** 上下文使用
+ *   + `xwmq_dq_n_to()` ：限时等待消息，只能在 **线程** 上下文使用
+ *   + `xwmq_dq_n_unintr()` ：不可中断地等待消息，只能在 **线程** 上下文使用
+ *   + `xwmq_trydq_n()` ：尝试获取消息，可在 **任意** 上下文使用
  * + 尾端离队
  *   + `xwmq_rq()` ：等待消息，只能在 **线程** 上下文使用
  *   + `xwmq_rq_to()` ：限时等待消息，只能在 **线程** 上下文使用
@@ -298,6 +308,116 @@ xwer_t xwmq_eq_unintr(struct xwmq * mq, xwsq_t topic, void * data);
  */
 xwer_t xwmq_tryeq(struct xwmq * mq, xwsq_t topic, void * data);
 
+/**
+ * @brief XWMQ API：等待消息槽，成功后将多条消息批量发送到消息队列的 **尾端** （批量入队）
+ * @param[in] mq: 消息队列对象的指针
+ * @param[in] topic: 消息标题的数组
+ * @param[in] data: 消息数据的数组
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组中消息的数量
+ * + (O) 作为输出时，返回实际发送的消息数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -EINTR: 等待被中断
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 若消息槽队列中没有空闲的消息槽，就阻塞发送线程，直到有空闲的消息槽或被中断。
+ * + 获取到第一个消息槽后不再等待，只使用已经空闲的消息槽，
+ *   最多发送 `*num` 条消息，所有消息在一次上锁中加入接收队列，
+ *   通过 `*num` 返回实际发送的数量，未发送的消息需要调用者重新发送。
+ */
+xwer_t xwmq_eq_n(struct xwmq * mq, const xwsq_t * topic, void * const * data,
+                 xwsz_t * num);
+
+/**
+ * @brief XWMQ API：限时等待消息槽，成功后将多条消息批量发送到消息队列的 **尾端** （批量入队）
+ * @param[in] mq: 消息队列对象的指针
+ * @param[in] topic: 消息标题的数组
+ * @param[in] data: 消息数据的数组
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组中消息的数量
+ * + (O) 作为输出时，返回实际发送的消息数量
+ * @param[in] to: 期望唤醒的时间点
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -EINTR: 等待被中断
+ * @retval -ETIMEDOUT: 超时
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 若消息槽队列中没有空闲的消息槽，就阻塞发送线程，直到有空闲的消息槽或被中断或超时。
+ * + 获取到第一个消息槽后不再等待，只使用已经空闲的消息槽，
+ *   最多发送 `*num` 条消息，所有消息在一次上锁中加入接收队列，
+ *   通过 `*num` 返回实际发送的数量，未发送的消息需要调用者重新发送。
+ */
+xwer_t xwmq_eq_n_to(struct xwmq * mq, const xwsq_t * topic, void * const * data,
+                    xwsz_t * num, xwtm_t to);
+
+/**
+ * @brief XWMQ API：等待消息槽，且等待不可被中断，
+ *        成功后将多条消息批量发送到消息队列的 **尾端** （批量入队）
+ * @param[in] mq: 消息队列对象的指针
+ * @param[in] topic: 消息标题的数组
+ * @param[in] data: 消息数据的数组
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组中消息的数量
+ * + (O) 作为输出时，返回实际发送的消息数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 若消息槽队列中没有空闲的消息槽，就阻塞发送线程，直到有空闲的消息槽。
+ * + 获取到第一个消息槽后不再等待，只使用已经空闲的消息槽，
+ *   最多发送 `*num` 条消息，所有消息在一次上锁中加入接收队列，
+ *   通过 `*num` 返回实际发送的数量，未发送的消息需要调用者重新发送。
+ */
+xwer_t xwmq_eq_n_unintr(struct xwmq * mq, const xwsq_t * topic, void * const * data,
+                        xwsz_t * num);
+
+/**
+ * @brief XWMQ API：尝试获取消息槽，成功后将多条消息批量发送到消息队列的 **尾端** （批量入队）
+ * @param[in] mq: 消息队列对象的指针
+ * @param[in] topic: 消息标题的数组
+ * @param[in] data: 消息数据的数组
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组中消息的数量
+ * + (O) 作为输出时，返回实际发送的消息数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -ENODATA: 没有空闲的消息槽
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 若消息槽队列中没有空闲的消息槽，就立即返回 `-ENODATA`，此CAPI可在中断中使用。
+ * + 获取到第一个消息槽后不再等待，只使用已经空闲的消息槽，
+ *   最多发送 `*num` 条消息，所有消息在一次上锁中加入接收队列，
+ *   通过 `*num` 返回实际发送的数量，未发送的消息需要调用者重新发送。
+ */
+xwer_t xwmq_tryeq_n(struct xwmq * mq, const xwsq_t * topic, void * const * data,
+                    xwsz_t * num);
+
 /**
  * @brief XWMQ API：等待消息槽，成功后将消息发送到消息队列的 **首端** （插队）
  * @param[in] mq: 消息队列对象的指针
@@ -476,6 +596,113 @@ xwer_t xwmq_dq_unintr(struct xwmq * mq, xwsq_t * topic, void ** databuf);
  */
 xwer_t xwmq_trydq(struct xwmq * mq, xwsq_t * topic, void ** databuf);
 
+/**
+ * @brief XWMQ API: 等待从消息队列 **首端** 批量接收消息
+ * @param[in] mq: 消息队列对象的指针
+ * @param[out] topic: 数组缓冲区，用于返回接收消息的标题
+ * @param[out] databuf: 数组缓冲区，用于返回接收消息的数据
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的消息数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -EINTR: 等待被中断
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 若接收队列中没有消息，就阻塞接收线程，直到有新的消息或被中断。
+ * + 取到第一条消息后不再等待，最多取出 `*num` 条已经在接收队列中的消息，
+ *   所有消息在一次上锁中离开接收队列。
+ * + 接收消息后，会释放消息槽。若有发送线程正在等待消息槽，将唤醒发送线程。
+ */
+xwer_t xwmq_dq_n(struct xwmq * mq, xwsq_t * topic, void ** databuf, xwsz_t * num);
+
+/**
+ * @brief XWMQ API: 限时等待从消息队列 **首端** 批量接收消息
+ * @param[in] mq: 消息队列对象的指针
+ * @param[out] topic: 数组缓冲区，用于返回接收消息的标题
+ * @param[out] databuf: 数组缓冲区，用于返回接收消息的数据
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的消息数量
+ * @param[in] to: 期望唤醒的时间点
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -EINTR: 等待被中断
+ * @retval -ETIMEDOUT: 超时
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 若接收队列中没有消息，就阻塞接收线程，直到有新的消息或被中断或超时。
+ * + 取到第一条消息后不再等待，最多取出 `*num` 条已经在接收队列中的消息，
+ *   所有消息在一次上锁中离开接收队列。
+ * + 接收消息后，会释放消息槽。若有发送线程正在等待消息槽，将唤醒发送线程。
+ */
+xwer_t xwmq_dq_n_to(struct xwmq * mq, xwsq_t * topic, void ** databuf, xwsz_t * num,
+                    xwtm_t to);
+
+/**
+ * @brief XWMQ API: 等待从消息队列 **首端** 批量接收消息，且等待不可被中断
+ * @param[in] mq: 消息队列对象的指针
+ * @param[out] topic: 数组缓冲区，用于返回接收消息的标题
+ * @param[out] databuf: 数组缓冲区，用于返回接收消息的数据
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的消息数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -ENOTTHDCTX: 不在线程上下文中
+ * @retval -EDISIRQ: 中断被关闭
+ * @retval -EDISPMPT: 抢占被关闭
+ * @retval -EDISBH: 中断底半部被关闭
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 若接收队列中没有消息，就阻塞接收线程，直到有新的消息。
+ * + 取到第一条消息后不再等待，最多取出 `*num` 条已经在接收队列中的消息，
+ *   所有消息在一次上锁中离开接收队列。
+ * + 接收消息后，会释放消息槽。若有发送线程正在等待消息槽，将唤醒发送线程。
+ */
+xwer_t xwmq_dq_n_unintr(struct xwmq * mq, xwsq_t * topic, void ** databuf,
+                        xwsz_t * num);
+
+/**
+ * @brief XWMQ API: 尝试从消息队列 **首端** 批量接收消息
+ * @param[in] mq: 消息队列对象的指针
+ * @param[out] topic: 数组缓冲区，用于返回接收消息的标题
+ * @param[out] databuf: 数组缓冲区，用于返回接收消息的数据
+ * @param[in,out] num: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数组缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的消息数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `*num` 为 `0`
+ * @retval -ENODATA: 接收队列为空
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 若接收队列中没有新的消息，就立即返回 `-ENODATA` ，此CAPI可在中断中使用。
+ * + 取到第一条消息后不再等待，最多取出 `*num` 条已经在接收队列中的消息，
+ *   所有消息在一次上锁中离开接收队列。
+ * + 接收消息后，会释放消息槽。若有发送线程正在等待消息槽，将唤醒发送线程。
+ */
+xwer_t xwmq_trydq_n(struct xwmq * mq, xwsq_t * topic, void ** databuf, xwsz_t * num);
+
 /**
  * @brief XWMQ API: 等待从消息队列 **尾端** 接收一条消息
  * @param[in] mq: 消息队列对象的指针
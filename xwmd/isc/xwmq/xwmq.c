@@ -259,6 +259,122 @@ err_sem_trywait:
         return rc;
 }
 
+/**
+ * @brief 将多条消息批量加入消息接收队列的尾部
+ * @param[in] mq: 消息队列对象的指针
+ * @param[in] topic: 消息标题的数组
+ * @param[in] data: 消息数据的数组
+ * @param[in] max: 数组中消息的数量
+ * @return 实际发送的消息数量
+ * @note
+ * + 调用前已经获取了第一个消息槽。
+ */
+static __xwmd_code
+xwsz_t xwmq_put_tail_n(struct xwmq * mq, const xwsq_t * topic, void * const * data,
+                       xwsz_t max)
+{
+        struct xwlib_bclst_head list;
+        struct xwmq_msg * msg;
+        xwreg_t cpuirq;
+        xwsz_t cnt;
+        xwsz_t i;
+
+        /* 已经获取了第一个消息槽，后面的消息槽只使用已经空闲的，不再等待 */
+        cnt = 1;
+        while ((cnt < max) && (XWOK == xwos_sem_trywait(&mq->txqsem))) {
+                cnt++;
+        }
+        xwlib_bclst_init_head(&list);
+        for (i = 0; i < cnt; i++) {
+                msg = xwmq_msg_get(mq);
+                msg->topic = topic[i];
+                msg->data = data[i];
+                xwlib_bclst_add_tail(&list, &msg->node);
+        }
+        xwos_splk_lock_cpuirqsv(&mq->rxqlock, &cpuirq);
+        xwlib_bclst_splice_tail(&mq->rxq, &list);
+        xwos_splk_unlock_cpuirqrs(&mq->rxqlock, cpuirq);
+        for (i = 0; i < cnt; i++) {
+                xwos_sem_post(&mq->rxqsem);
+        }
+        return cnt;
+}
+
+__xwmd_api
+xwer_t xwmq_eq_n(struct xwmq * mq, const xwsq_t * topic, void * const * data, xwsz_t * num)
+{
+        return xwmq_eq_n_to(mq, topic, data, num, XWTM_MAX);
+}
+
+__xwmd_api
+xwer_t xwmq_eq_n_to(struct xwmq * mq, const xwsq_t * topic, void * const * data, xwsz_t * num, xwtm_t to)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE((mq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((topic), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num), "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_wait_to(&mq->txqsem, to);
+        if (rc < 0) {
+                goto err_sem_wait_to;
+        }
+        *num = xwmq_put_tail_n(mq, topic, data, *num);
+        return XWOK;
+
+err_sem_wait_to:
+        *num = 0;
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwmq_eq_n_unintr(struct xwmq * mq, const xwsq_t * topic, void * const * data, xwsz_t * num)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE((mq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((topic), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num), "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_wait_unintr(&mq->txqsem);
+        if (rc < 0) {
+                goto err_sem_wait_unintr;
+        }
+        *num = xwmq_put_tail_n(mq, topic, data, *num);
+        return XWOK;
+
+err_sem_wait_unintr:
+        *num = 0;
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwmq_tryeq_n(struct xwmq * mq, const xwsq_t * topic, void * const * data, xwsz_t * num)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE((mq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((topic), "nullptr", -EFAULT);
+        XWOS_VALIDATE((data), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num), "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_trywait(&mq->txqsem);
+        if (rc < 0) {
+                goto err_sem_trywait;
+        }
+        *num = xwmq_put_tail_n(mq, topic, data, *num);
+        return XWOK;
+
+err_sem_trywait:
+        *num = 0;
+        return rc;
+}
+
 __xwmd_api
 xwer_t xwmq_jq(struct xwmq * mq, xwsq_t topic, void * data)
 {
@@ -471,6 +587,125 @@ err_sem_trywait:
         return rc;
 }
 
+/**
+ * @brief 从消息接收队列头部批量取出消息
+ * @param[in] mq: 消息队列对象的指针
+ * @param[out] topic: 数组缓冲区，用于返回消息的标题
+ * @param[out] databuf: 数组缓冲区，用于返回消息的数据
+ * @param[in] max: 数组缓冲区的大小
+ * @return 实际取出的消息数量
+ * @note
+ * + 调用前已经获取了第一条消息。
+ */
+static __xwmd_code
+xwsz_t xwmq_take_head_n(struct xwmq * mq, xwsq_t * topic, void ** databuf,
+                        xwsz_t max)
+{
+        struct xwlib_bclst_head list;
+        struct xwmq_msg * msg;
+        xwreg_t cpuirq;
+        xwsz_t cnt;
+        xwsz_t i;
+
+        /* 已经获取了第一条消息，后面的消息只取已经在队列中的，不再等待 */
+        cnt = 1;
+        while ((cnt < max) && (XWOK == xwos_sem_trywait(&mq->rxqsem))) {
+                cnt++;
+        }
+        xwlib_bclst_init_head(&list);
+        xwos_splk_lock_cpuirqsv(&mq->rxqlock, &cpuirq);
+        for (i = 0; i < cnt; i++) {
+                msg = xwlib_bclst_first_entry(&mq->rxq, struct xwmq_msg, node);
+                xwlib_bclst_del_init(&msg->node);
+                xwlib_bclst_add_tail(&list, &msg->node);
+        }
+        xwos_splk_unlock_cpuirqrs(&mq->rxqlock, cpuirq);
+        for (i = 0; i < cnt; i++) {
+                msg = xwlib_bclst_first_entry(&list, struct xwmq_msg, node);
+                xwlib_bclst_del_init(&msg->node);
+                topic[i] = msg->topic;
+                databuf[i] = msg->data;
+                xwmq_msg_put(mq, msg);
+                xwos_sem_post(&mq->txqsem);
+        }
+        return cnt;
+}
+
+__xwmd_api
+xwer_t xwmq_dq_n(struct xwmq * mq, xwsq_t * topic, void ** databuf, xwsz_t * num)
+{
+        return xwmq_dq_n_to(mq, topic, databuf, num, XWTM_MAX);
+}
+
+__xwmd_api
+xwer_t xwmq_dq_n_to(struct xwmq * mq, xwsq_t * topic, void ** databuf, xwsz_t * num, xwtm_t to)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE((mq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((topic), "nullptr", -EFAULT);
+        XWOS_VALIDATE((databuf), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num), "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_wait_to(&mq->rxqsem, to);
+        if (rc < 0) {
+                goto err_sem_wait_to;
+        }
+        *num = xwmq_take_head_n(mq, topic, databuf, *num);
+        return XWOK;
+
+err_sem_wait_to:
+        *num = 0;
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwmq_dq_n_unintr(struct xwmq * mq, xwsq_t * topic, void ** databuf, xwsz_t * num)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE((mq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((topic), "nullptr", -EFAULT);
+        XWOS_VALIDATE((databuf), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num), "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_wait_unintr(&mq->rxqsem);
+        if (rc < 0) {
+                goto err_sem_wait_unintr;
+        }
+        *num = xwmq_take_head_n(mq, topic, databuf, *num);
+        return XWOK;
+
+err_sem_wait_unintr:
+        *num = 0;
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwmq_trydq_n(struct xwmq * mq, xwsq_t * topic, void ** databuf, xwsz_t * num)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE((mq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((topic), "nullptr", -EFAULT);
+        XWOS_VALIDATE((databuf), "nullptr", -EFAULT);
+        XWOS_VALIDATE((num), "nullptr", -EFAULT);
+        XWOS_VALIDATE((*num > (xwsz_t)0), "zero-num", -EINVAL);
+
+        rc = xwos_sem_trywait(&mq->rxqsem);
+        if (rc < 0) {
+                goto err_sem_trywait;
+        }
+        *num = xwmq_take_head_n(mq, topic, databuf, *num);
+        return XWOK;
+
+err_sem_trywait:
+        *num = 0;
+        return rc;
+}
+
 __xwmd_api
 xwer_t xwmq_rq(struct xwmq * mq, xwsq_t * topic, void ** databuf)
 {
@@ -0,0 +1,222 @@
+/**
+ * @file
+ * @brief 发布订阅：模块接口
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwmd_isc_xwps_mif_h__
+#define __xwmd_isc_xwps_mif_h__
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/osal/lock/spinlock.h>
+#include <xwmd/isc/xwmq/mif.h>
+
+/**
+ * @defgroup xwmd_isc_xwps 发布订阅
+ * @ingroup xwmd_isc
+ * 发布订阅代理建立在 @ref xwmd_isc_xwmq 之上，将一条消息分发给所有订阅了其标题的订阅者。
+ * 需要配置 `XWMDCFG_isc_xwps` 为 `1` 。
+ *
+ *
+ * ## 订阅者
+ *
+ * 每个订阅者拥有自己的消息队列，订阅一段连续的标题 `[first, last]` 。
+ * 代理最多容纳 `XWMDCFG_isc_xwps_SUB_NUM` 个订阅者。
+ *
+ * + `xwps_subscribe()` ：订阅
+ * + `xwps_unsubscribe()` ：取消订阅
+ *
+ *
+ * ## 消息
+ *
+ * 消息 `struct xwps_msg` 由发布者提供，代理只传递其指针，不会拷贝数据。
+ * 消息带有引用计数，每个收到消息的订阅者持有一个引用，
+ * 引用计数减为 `0` 时，调用发布者注册的释放函数回收消息。
+ *
+ * + `xwps_msg_init()` ：初始化消息，引用计数为 `1` ，此引用属于发布者
+ * + `xwps_msg_grab()` ：增加引用计数
+ * + `xwps_msg_put()` ：减少引用计数
+ *
+ *
+ * ## 发布
+ *
+ * + `xwps_publish()` ：发布消息，可在 **任意** 上下文使用
+ *
+ * 订阅者通过 `xwmq_dq()` 等CAPI接收消息，收到的数据是 `struct xwps_msg` 的指针，
+ * 使用完毕后必须调用 `xwps_msg_put()` 。
+ *
+ *
+ * ## 索引
+ *
+ * 标题按 `topic % XWMDCFG_isc_xwps_HASH_NUM` 散列到桶中，每个桶有一个订阅者位图，
+ * 订阅者覆盖的每个桶都置上其位。发布时只检查对应桶位图中的订阅者，
+ * 再比较其标题范围排除散列冲突，不需要遍历所有订阅者。
+ * @{
+ */
+
+struct xwps_msg;
+
+/**
+ * @brief 消息的释放函数
+ * @param[in] msg: 消息的指针
+ * @param[in] arg: 初始化消息时传入的参数
+ */
+typedef void (* xwps_msg_release_f)(struct xwps_msg * msg, void * arg);
+
+/**
+ * @brief 发布订阅的消息
+ */
+struct xwps_msg {
+        xwsq_t topic; /**< 标题 */
+        void * data; /**< 数据 */
+        atomic_xwsq_t refcnt; /**< 引用计数 */
+        xwps_msg_release_f release; /**< 释放函数 */
+        void * arg; /**< 释放函数的参数 */
+};
+
+/**
+ * @brief 订阅者
+ */
+struct xwps_sub {
+        xwsq_t first; /**< 订阅的第一个标题 */
+        xwsq_t last; /**< 订阅的最后一个标题 */
+        struct xwmq * mq; /**< 接收消息的消息队列 */
+        xwssq_t idx; /**< 在代理中的序号，小于0表示没有订阅 */
+};
+
+/**
+ * @brief 发布订阅代理
+ */
+struct xwps {
+        struct xwos_splk lock; /**< 保护订阅者表与索引的锁 */
+        struct xwps_sub * sub[XWMDCFG_isc_xwps_SUB_NUM]; /**< 订阅者表 */
+        xwbmpop_define(slot, XWMDCFG_isc_xwps_SUB_NUM); /**< 订阅者表的占用位图 */
+        xwbmpop_define(bkt[XWMDCFG_isc_xwps_HASH_NUM],
+                       XWMDCFG_isc_xwps_SUB_NUM); /**< 每个散列桶的订阅者位图 */
+};
+
+/**
+ * @brief XWPS API：初始化发布订阅代理
+ * @param[in] ps: 代理对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：任意
+ */
+xwer_t xwps_init(struct xwps * ps);
+
+/**
+ * @brief XWPS API：销毁发布订阅代理
+ * @param[in] ps: 代理对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBUSY: 仍有订阅者
+ * @note
+ * + 上下文：任意
+ */
+xwer_t xwps_fini(struct xwps * ps);
+
+/**
+ * @brief XWPS API：订阅一段标题
+ * @param[in] ps: 代理对象的指针
+ * @param[in] sub: 订阅者对象的指针
+ * @param[in] first: 订阅的第一个标题
+ * @param[in] last: 订阅的最后一个标题
+ * @param[in] mq: 接收消息的消息队列
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: `first` 大于 `last`
+ * @retval -ENOSPC: 订阅者已满
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 订阅期间，代理持有消息队列的引用。
+ * + 同一个消息队列可被多个订阅者使用，以订阅多段标题。
+ */
+xwer_t xwps_subscribe(struct xwps * ps, struct xwps_sub * sub,
+                      xwsq_t first, xwsq_t last, struct xwmq * mq);
+
+/**
+ * @brief XWPS API：取消订阅
+ * @param[in] ps: 代理对象的指针
+ * @param[in] sub: 订阅者对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOENT: 订阅者不在此代理中
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 已经进入消息队列的消息不受影响，订阅者仍需接收并释放它们。
+ */
+xwer_t xwps_unsubscribe(struct xwps * ps, struct xwps_sub * sub);
+
+/**
+ * @brief XWPS API：初始化消息
+ * @param[in] msg: 消息的指针
+ * @param[in] topic: 标题
+ * @param[in] data: 数据
+ * @param[in] release: 释放函数，可为 `NULL`
+ * @param[in] arg: 释放函数的参数
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 初始化后引用计数为 `1` ，此引用属于发布者，由 `xwps_publish()` 消费。
+ */
+void xwps_msg_init(struct xwps_msg * msg, xwsq_t topic, void * data,
+                   xwps_msg_release_f release, void * arg);
+
+/**
+ * @brief XWPS API：增加消息的引用计数
+ * @param[in] msg: 消息的指针
+ * @note
+ * + 上下文：任意
+ */
+void xwps_msg_grab(struct xwps_msg * msg);
+
+/**
+ * @brief XWPS API：减少消息的引用计数
+ * @param[in] msg: 消息的指针
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 引用计数减为 `0` 时，调用消息的释放函数。
+ */
+void xwps_msg_put(struct xwps_msg * msg);
+
+/**
+ * @brief XWPS API：发布消息
+ * @param[in] ps: 代理对象的指针
+ * @param[in] msg: 消息的指针
+ * @param[out] num: 指向缓冲区的指针，通过此缓冲区返回收到消息的订阅者数量，可为 `NULL`
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 消息被放入所有订阅了 `msg->topic` 的订阅者的消息队列的 **尾端** ，
+ *   每个订阅者持有一个引用。
+ * + 发布不会阻塞：订阅者的消息队列没有空闲的消息槽时，此订阅者错过这条消息。
+ * + 代理的锁只在收集订阅者时持有，消息在锁外放入各个消息队列，
+ *   与此同时取消订阅的订阅者仍可能收到这条消息。
+ * + 发布者的引用在发布结束时被释放，没有订阅者收到消息时，消息立即被释放。
+ *   发布者如需在发布后继续使用消息，应在发布前调用 `xwps_msg_grab()` 。
+ */
+xwer_t xwps_publish(struct xwps * ps, struct xwps_msg * msg, xwsz_t * num);
+
+/**
+ * @} xwmd_isc_xwps
+ */
+
+#endif /* xwmd/isc/xwps/mif.h */
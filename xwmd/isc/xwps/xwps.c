@@ -0,0 +1,218 @@
+/**
+ * @file
+ * @brief 发布订阅：代理
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/lib/xwaop.h>
+#include <xwos/osal/lock/spinlock.h>
+#include <xwmd/isc/xwmq/mif.h>
+#include <xwmd/isc/xwps/mif.h>
+
+__xwmd_api
+xwer_t xwps_init(struct xwps * ps)
+{
+        xwsq_t i;
+
+        XWOS_VALIDATE((ps), "nullptr", -EFAULT);
+
+        xwos_splk_init(&ps->lock);
+        for (i = 0; i < XWMDCFG_isc_xwps_SUB_NUM; i++) {
+                ps->sub[i] = NULL;
+        }
+        xwbmpop_c0all(ps->slot, XWMDCFG_isc_xwps_SUB_NUM);
+        for (i = 0; i < XWMDCFG_isc_xwps_HASH_NUM; i++) {
+                xwbmpop_c0all(ps->bkt[i], XWMDCFG_isc_xwps_SUB_NUM);
+        }
+        return XWOK;
+}
+
+__xwmd_api
+xwer_t xwps_fini(struct xwps * ps)
+{
+        xwreg_t cpuirq;
+        xwssq_t used;
+
+        XWOS_VALIDATE((ps), "nullptr", -EFAULT);
+
+        xwos_splk_lock_cpuirqsv(&ps->lock, &cpuirq);
+        used = xwbmpop_ffs(ps->slot, XWMDCFG_isc_xwps_SUB_NUM);
+        xwos_splk_unlock_cpuirqrs(&ps->lock, cpuirq);
+        return (used < 0) ? XWOK : -EBUSY;
+}
+
+__xwmd_api
+xwer_t xwps_subscribe(struct xwps * ps, struct xwps_sub * sub,
+                      xwsq_t first, xwsq_t last, struct xwmq * mq)
+{
+        xwreg_t cpuirq;
+        xwssq_t idx;
+        xwsq_t t;
+        xwer_t rc;
+
+        XWOS_VALIDATE((ps), "nullptr", -EFAULT);
+        XWOS_VALIDATE((sub), "nullptr", -EFAULT);
+        XWOS_VALIDATE((mq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((first <= last), "invalid-range", -EINVAL);
+
+        rc = xwmq_grab(mq);
+        if (rc < 0) {
+                goto err_mq_grab;
+        }
+        sub->first = first;
+        sub->last = last;
+        sub->mq = mq;
+        xwos_splk_lock_cpuirqsv(&ps->lock, &cpuirq);
+        idx = xwbmpop_ffz(ps->slot, XWMDCFG_isc_xwps_SUB_NUM);
+        if (idx < 0) {
+                xwos_splk_unlock_cpuirqrs(&ps->lock, cpuirq);
+                rc = -ENOSPC;
+                goto err_nospc;
+        }
+        xwbmpop_s1i(ps->slot, (xwsq_t)idx);
+        ps->sub[idx] = sub;
+        sub->idx = idx;
+        /* 将订阅者加入其标题范围覆盖的每个散列桶 */
+        if ((last - first) >= (XWMDCFG_isc_xwps_HASH_NUM - 1U)) {
+                for (t = 0; t < XWMDCFG_isc_xwps_HASH_NUM; t++) {
+                        xwbmpop_s1i(ps->bkt[t], (xwsq_t)idx);
+                }
+        } else {
+                for (t = 0; t <= (last - first); t++) {
+                        xwbmpop_s1i(ps->bkt[(first + t) % XWMDCFG_isc_xwps_HASH_NUM],
+                                    (xwsq_t)idx);
+                }
+        }
+        xwos_splk_unlock_cpuirqrs(&ps->lock, cpuirq);
+        return XWOK;
+
+err_nospc:
+        sub->mq = NULL;
+        sub->idx = -1;
+        xwmq_put(mq);
+err_mq_grab:
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwps_unsubscribe(struct xwps * ps, struct xwps_sub * sub)
+{
+        struct xwmq * mq;
+        xwreg_t cpuirq;
+        xwssq_t idx;
+        xwsq_t i;
+
+        XWOS_VALIDATE((ps), "nullptr", -EFAULT);
+        XWOS_VALIDATE((sub), "nullptr", -EFAULT);
+
+        xwos_splk_lock_cpuirqsv(&ps->lock, &cpuirq);
+        idx = sub->idx;
+        if ((idx < 0) || (idx >= (xwssq_t)XWMDCFG_isc_xwps_SUB_NUM) ||
+            (ps->sub[idx] != sub)) {
+                xwos_splk_unlock_cpuirqrs(&ps->lock, cpuirq);
+                return -ENOENT;
+        }
+        for (i = 0; i < XWMDCFG_isc_xwps_HASH_NUM; i++) {
+                xwbmpop_c0i(ps->bkt[i], (xwsq_t)idx);
+        }
+        ps->sub[idx] = NULL;
+        xwbmpop_c0i(ps->slot, (xwsq_t)idx);
+        mq = sub->mq;
+        sub->mq = NULL;
+        sub->idx = -1;
+        xwos_splk_unlock_cpuirqrs(&ps->lock, cpuirq);
+        xwmq_put(mq);
+        return XWOK;
+}
+
+__xwmd_api
+void xwps_msg_init(struct xwps_msg * msg, xwsq_t topic, void * data,
+                   xwps_msg_release_f release, void * arg)
+{
+        msg->topic = topic;
+        msg->data = data;
+        msg->release = release;
+        msg->arg = arg;
+        xwaop_store(xwsq_t, &msg->refcnt, xwaop_mo_release, 1);
+}
+
+__xwmd_api
+void xwps_msg_grab(struct xwps_msg * msg)
+{
+        xwaop_add(xwsq_t, &msg->refcnt, 1, NULL, NULL);
+}
+
+__xwmd_api
+void xwps_msg_put(struct xwps_msg * msg)
+{
+        xwsq_t nv;
+
+        xwaop_sub(xwsq_t, &msg->refcnt, 1, &nv, NULL);
+        if (((xwsq_t)0 == nv) && (NULL != msg->release)) {
+                msg->release(msg, msg->arg);
+        }
+}
+
+__xwmd_api
+xwer_t xwps_publish(struct xwps * ps, struct xwps_msg * msg, xwsz_t * num)
+{
+        xwbmpop_define(match, XWMDCFG_isc_xwps_SUB_NUM);
+        struct xwmq * mq[XWMDCFG_isc_xwps_SUB_NUM];
+        struct xwps_sub * sub;
+        xwreg_t cpuirq;
+        xwssq_t idx;
+        xwsz_t mqnum;
+        xwsz_t cnt;
+        xwsz_t i;
+        xwer_t rc;
+
+        XWOS_VALIDATE((ps), "nullptr", -EFAULT);
+        XWOS_VALIDATE((msg), "nullptr", -EFAULT);
+
+        /* 在锁内只收集订阅者的消息队列并增加其引用计数，
+           入队在锁外进行，持锁关中断的时间与订阅者的数量无关 */
+        mqnum = 0;
+        xwos_splk_lock_cpuirqsv(&ps->lock, &cpuirq);
+        xwbmpop_assign(match, ps->bkt[msg->topic % XWMDCFG_isc_xwps_HASH_NUM],
+                       XWMDCFG_isc_xwps_SUB_NUM);
+        idx = xwbmpop_ffs(match, XWMDCFG_isc_xwps_SUB_NUM);
+        while (idx >= 0) {
+                xwbmpop_c0i(match, (xwsq_t)idx);
+                sub = ps->sub[idx];
+                /* 同一个桶中可能有其他标题范围的订阅者 */
+                if ((msg->topic >= sub->first) && (msg->topic <= sub->last)) {
+                        /* 订阅者持有消息队列的引用，这里不会失败 */
+                        xwmq_grab(sub->mq); // cppcheck-suppress [misra-c2012-17.7]
+                        mq[mqnum] = sub->mq;
+                        mqnum++;
+                }
+                idx = xwbmpop_ffs(match, XWMDCFG_isc_xwps_SUB_NUM);
+        }
+        xwos_splk_unlock_cpuirqrs(&ps->lock, cpuirq);
+
+        cnt = 0;
+        for (i = 0; i < mqnum; i++) {
+                xwps_msg_grab(msg);
+                rc = xwmq_tryeq(mq[i], msg->topic, msg);
+                if (XWOK == rc) {
+                        cnt++;
+                } else {
+                        /* 发布者仍持有引用，这里不会减为0 */
+                        xwaop_sub(xwsq_t, &msg->refcnt, 1, NULL, NULL);
+                }
+                xwmq_put(mq[i]);
+        }
+        xwps_msg_put(msg);
+        if (NULL != num) {
+                *num = cnt;
+        }
+        return XWOK;
+}
@@ -0,0 +1,446 @@
+/**
+ * @file
+ * @brief SOC间点对点通讯协议：硬件接口层：内存回环
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#include <xwos/standard.h>
+#include <string.h>
+#include <xwos/osal/time.h>
+#include <xwos/osal/lock/spinlock.h>
+#include <xwos/osal/sync/cond.h>
+#include <xwmd/isc/xwssc/protocol.h>
+#include <xwmd/isc/xwssc/hwifal.h>
+#include <xwmd/isc/xwssc/hwif/loopback.h>
+
+/**
+ * @ingroup xwmd_isc_xwssc_hwif_loopback
+ * @{
+ */
+
+static __xwmd_code
+xwer_t xwsscif_loopback_open(struct xwssc * xwssc);
+
+static __xwmd_code
+xwer_t xwsscif_loopback_close(struct xwssc * xwssc);
+
+static __xwmd_code
+xwer_t xwsscif_loopback_tx(struct xwssc * xwssc, const xwu8_t * data, xwsz_t size);
+
+static __xwmd_code
+xwer_t xwsscif_loopback_rx(struct xwssc * xwssc, xwu8_t * buf, xwsz_t * size);
+
+__xwmd_rodata
+const struct xwssc_hwifal_operation xwsscif_loopback_ops = {
+        .open = xwsscif_loopback_open,
+        .close = xwsscif_loopback_close,
+        .tx = xwsscif_loopback_tx,
+        .rx = xwsscif_loopback_rx,
+        .rxbulk = xwsscif_loopback_rx,
+        .notify = NULL,
+};
+
+static __xwmd_code
+void xwsscif_loopback_pipe_init(struct xwsscif_loopback_pipe * pipe)
+{
+        xwos_splk_init(&pipe->lock);
+        xwos_cond_init(&pipe->cond); // cppcheck-suppress [misra-c2012-17.7]
+        pipe->rpos = 0;
+        pipe->wpos = 0;
+        pipe->cnt = 0;
+        // cppcheck-suppress [misra-c2012-17.7]
+        memset(&pipe->cfg, 0, sizeof(pipe->cfg));
+        pipe->wtot = 0;
+        pipe->rtot = 0;
+        pipe->idle = 0;
+        pipe->mark.head = 0;
+        pipe->mark.num = 0;
+        pipe->rnd = 1;
+        pipe->errgap = 0;
+        pipe->errbits = 0;
+}
+
+/**
+ * @brief 产生伪随机数（xorshift32）
+ */
+static __xwmd_code
+xwu32_t xwsscif_loopback_rand(struct xwsscif_loopback_pipe * pipe)
+{
+        xwu32_t x;
+
+        x = pipe->rnd;
+        x ^= x << 13U;
+        x ^= x >> 17U;
+        x ^= x << 5U;
+        pipe->rnd = x;
+        return x;
+}
+
+/**
+ * @brief 随机产生到下一个误码的间隔
+ * @details
+ * 间隔在 `[0, 2 * ber)` 中均匀分布，加上误码本身的1位，平均间隔约为 `ber` 位。
+ */
+static __xwmd_code
+xwu32_t xwsscif_loopback_errgap(struct xwsscif_loopback_pipe * pipe)
+{
+        xwu64_t range;
+
+        range = (xwu64_t)pipe->cfg.ber * 2U;
+        return (xwu32_t)(((xwu64_t)xwsscif_loopback_rand(pipe) * range) >> 32U);
+}
+
+/**
+ * @brief 在写入管道的数据中注入误码
+ * @param[in] pipe: 管道的指针
+ * @param[in] data: 刚写入缓冲区的数据
+ * @param[in] size: 数据的长度
+ * @note
+ * + 调用者需持有锁 `pipe->lock` 。
+ */
+static __xwmd_code
+void xwsscif_loopback_inject(struct xwsscif_loopback_pipe * pipe,
+                             xwu8_t * data, xwsz_t size)
+{
+        xwsz_t bits;
+        xwsz_t pos;
+
+        if (0U != pipe->cfg.ber) {
+                bits = size * 8U;
+                pos = 0;
+                while ((bits - pos) > (xwsz_t)pipe->errgap) {
+                        pos += (xwsz_t)pipe->errgap;
+                        data[pos >> 3U] ^= (xwu8_t)(1U << (pos & 7U));
+                        pipe->errbits++;
+                        pos++;
+                        pipe->errgap = xwsscif_loopback_errgap(pipe);
+                }
+                pipe->errgap -= (xwu32_t)(bits - pos);
+        }
+}
+
+/**
+ * @brief 测试管道是否模拟带宽或延迟
+ */
+static __xwmd_code
+bool xwsscif_loopback_tst_timed(struct xwsscif_loopback_pipe * pipe)
+{
+        return ((0U != pipe->cfg.bandwidth) || (0 != pipe->cfg.latency));
+}
+
+/**
+ * @brief 记录刚写入管道的一段数据的到达时间
+ * @param[in] pipe: 管道的指针
+ * @param[in] size: 数据的长度
+ * @note
+ * + 调用者需持有锁 `pipe->lock` ；
+ * + 数据段用完时延长最后一段，最后一段中较早的数据会晚一些到达。
+ */
+static __xwmd_code
+void xwsscif_loopback_mark(struct xwsscif_loopback_pipe * pipe, xwsz_t size)
+{
+        struct xwsscif_loopback_mark * m;
+        xwtm_t now;
+
+        now = xwtm_now();
+        if (pipe->idle < now) {
+                pipe->idle = now;
+        }
+        if (0U != pipe->cfg.bandwidth) {
+                pipe->idle += ((xwtm_t)size * XWTM_S(1)) / (xwtm_t)pipe->cfg.bandwidth;
+        }
+        if (XWSSCIF_LOOPBACK_MARK_NUM == pipe->mark.num) {
+                m = &pipe->mark.m[(pipe->mark.head + pipe->mark.num - 1U) %
+                                  XWSSCIF_LOOPBACK_MARK_NUM];
+        } else {
+                m = &pipe->mark.m[(pipe->mark.head + pipe->mark.num) %
+                                  XWSSCIF_LOOPBACK_MARK_NUM];
+                pipe->mark.num++;
+        }
+        m->end = pipe->wtot;
+        m->at = pipe->idle + pipe->cfg.latency;
+}
+
+/**
+ * @brief 计算管道中已经到达接收端的数据量
+ * @param[in] pipe: 管道的指针
+ * @param[out] next: 指向缓冲区的指针，通过此缓冲区返回下一段数据的到达时间，
+ *                   没有未到达的数据时返回 `XWTM_MAX`
+ * @return 可以读取的数据量
+ * @note
+ * + 调用者需持有锁 `pipe->lock` 。
+ */
+static __xwmd_code
+xwsz_t xwsscif_loopback_arrived(struct xwsscif_loopback_pipe * pipe, xwtm_t * next)
+{
+        struct xwsscif_loopback_mark * m;
+        xwsz_t limit;
+        xwsz_t i;
+        xwtm_t now;
+
+        *next = XWTM_MAX;
+        if (0U == pipe->mark.num) {
+                return pipe->cnt;
+        }
+        now = xwtm_now();
+        limit = pipe->rtot;
+        for (i = 0; i < pipe->mark.num; i++) {
+                m = &pipe->mark.m[(pipe->mark.head + i) % XWSSCIF_LOOPBACK_MARK_NUM];
+                if (m->at > now) {
+                        *next = m->at;
+                        return limit - pipe->rtot;
+                }
+                limit = m->end;
+        }
+        return pipe->cnt;
+}
+
+/**
+ * @brief 丢弃已经读完的数据段
+ * @note
+ * + 调用者需持有锁 `pipe->lock` 。
+ */
+static __xwmd_code
+void xwsscif_loopback_unmark(struct xwsscif_loopback_pipe * pipe)
+{
+        struct xwsscif_loopback_mark * m;
+
+        while (pipe->mark.num > 0U) {
+                m = &pipe->mark.m[pipe->mark.head];
+                if ((xwssz_t)(m->end - pipe->rtot) > 0) {
+                        break;
+                }
+                pipe->mark.head = (pipe->mark.head + 1U) % XWSSCIF_LOOPBACK_MARK_NUM;
+                pipe->mark.num--;
+        }
+}
+
+/**
+ * @brief XWSSC内存回环API：初始化内存回环
+ * @param[in] lb: 内存回环的指针
+ * @note
+ * + 上下文：任意
+ * @details
+ * 两个端点的发送管道与接收管道交叉连接。
+ */
+__xwmd_api
+void xwsscif_loopback_init(struct xwsscif_loopback * lb)
+{
+        xwsscif_loopback_pipe_init(&lb->pipe[0]);
+        xwsscif_loopback_pipe_init(&lb->pipe[1]);
+        lb->ep[0].tx = &lb->pipe[0];
+        lb->ep[0].rx = &lb->pipe[1];
+        lb->ep[1].tx = &lb->pipe[1];
+        lb->ep[1].rx = &lb->pipe[0];
+}
+
+/**
+ * @brief XWSSC内存回环API：销毁内存回环
+ * @param[in] lb: 内存回环的指针
+ * @note
+ * + 上下文：线程
+ * @details
+ * 调用之前，两个端点上的XWSSC必须都已停止。
+ */
+__xwmd_api
+void xwsscif_loopback_fini(struct xwsscif_loopback * lb)
+{
+        xwos_cond_fini(&lb->pipe[0].cond); // cppcheck-suppress [misra-c2012-17.7]
+        xwos_cond_fini(&lb->pipe[1].cond); // cppcheck-suppress [misra-c2012-17.7]
+}
+
+/**
+ * @brief XWSSC内存回环API：设置模拟链路的参数
+ * @param[in] lb: 内存回环的指针
+ * @param[in] cfg: 模拟链路的参数，两个方向使用相同的参数
+ * @note
+ * + 上下文：线程
+ * @details
+ * + 应在启动XWSSC之前设置；
+ * + 两个方向的误码由不同的伪随机数序列产生，相同的种子产生相同的误码位置。
+ */
+__xwmd_api
+void xwsscif_loopback_set_cfg(struct xwsscif_loopback * lb,
+                              const struct xwsscif_loopback_cfg * cfg)
+{
+        struct xwsscif_loopback_pipe * pipe;
+        xwsq_t i;
+
+        for (i = 0; i < 2U; i++) {
+                pipe = &lb->pipe[i];
+                xwos_splk_lock(&pipe->lock);
+                pipe->cfg = *cfg;
+                pipe->rnd = cfg->seed + (xwu32_t)i;
+                if (0U == pipe->rnd) {
+                        pipe->rnd = 1;
+                }
+                pipe->errgap = xwsscif_loopback_errgap(pipe);
+                xwos_splk_unlock(&pipe->lock);
+        }
+}
+
+/**
+ * @brief XWSSC内存回环API：获取已经注入的误码数量
+ * @param[in] lb: 内存回环的指针
+ * @param[in] dir: 方向，0表示 `ep[0]` 到 `ep[1]` ，1表示 `ep[1]` 到 `ep[0]`
+ * @return 已经翻转的位数
+ * @note
+ * + 上下文：线程
+ */
+__xwmd_api
+xwu64_t xwsscif_loopback_get_errbits(struct xwsscif_loopback * lb, xwsq_t dir)
+{
+        struct xwsscif_loopback_pipe * pipe;
+        xwu64_t errbits;
+
+        pipe = &lb->pipe[dir & 1U];
+        xwos_splk_lock(&pipe->lock);
+        errbits = pipe->errbits;
+        xwos_splk_unlock(&pipe->lock);
+        return errbits;
+}
+
+static __xwmd_code
+xwer_t xwsscif_loopback_open(struct xwssc * xwssc)
+{
+        XWOS_UNUSED(xwssc);
+        return XWOK;
+}
+
+static __xwmd_code
+xwer_t xwsscif_loopback_close(struct xwssc * xwssc)
+{
+        XWOS_UNUSED(xwssc);
+        return XWOK;
+}
+
+/**
+ * @brief 将数据写入管道，管道已满时阻塞
+ * @details
+ * 每次拷贝到缓冲区的数据作为一段，按模拟链路的参数注入误码并记录到达时间。
+ */
+static __xwmd_code
+xwer_t xwsscif_loopback_tx(struct xwssc * xwssc, const xwu8_t * data, xwsz_t size)
+{
+        struct xwsscif_loopback_ep * ep;
+        struct xwsscif_loopback_pipe * pipe;
+        union xwos_ulock ulk;
+        xwsq_t lkst;
+        xwsz_t pos;
+        xwsz_t cp;
+        xwer_t rc;
+
+        ep = xwssc->hwifcb;
+        pipe = ep->tx;
+        ulk.osal.splk = &pipe->lock;
+        pos = 0;
+        rc = XWOK;
+        xwos_splk_lock(&pipe->lock);
+        while (pos < size) {
+                if (XWSSCIF_LOOPBACK_BUFSIZE == pipe->cnt) {
+                        rc = xwos_cond_wait(&pipe->cond, ulk, XWOS_LK_SPLK, NULL, &lkst);
+                        if (rc < 0) {
+                                if ((xwsq_t)XWOS_LKST_UNLOCKED == lkst) {
+                                        xwos_splk_lock(&pipe->lock);
+                                }
+                                break;
+                        }
+                        continue;
+                }
+                cp = XWSSCIF_LOOPBACK_BUFSIZE - pipe->cnt;
+                if (cp > (XWSSCIF_LOOPBACK_BUFSIZE - pipe->wpos)) {
+                        cp = XWSSCIF_LOOPBACK_BUFSIZE - pipe->wpos;
+                }
+                if (cp > (size - pos)) {
+                        cp = size - pos;
+                }
+                memcpy(&pipe->buf[pipe->wpos], &data[pos], cp);
+                xwsscif_loopback_inject(pipe, &pipe->buf[pipe->wpos], cp);
+                pipe->wpos = (pipe->wpos + cp) % XWSSCIF_LOOPBACK_BUFSIZE;
+                pipe->cnt += cp;
+                pipe->wtot += cp;
+                pos += cp;
+                if (xwsscif_loopback_tst_timed(pipe)) {
+                        xwsscif_loopback_mark(pipe, cp);
+                }
+                xwos_cond_broadcast(&pipe->cond); // cppcheck-suppress [misra-c2012-17.7]
+        }
+        xwos_splk_unlock(&pipe->lock);
+        return rc;
+}
+
+/**
+ * @brief 从管道中读取数据，管道中没有已到达的数据时阻塞
+ * @details
+ * 只要管道中有已到达的数据就返回，通过 `*size` 返回实际读取的数据量。
+ */
+static __xwmd_code
+xwer_t xwsscif_loopback_rx(struct xwssc * xwssc, xwu8_t * buf, xwsz_t * size)
+{
+        struct xwsscif_loopback_ep * ep;
+        struct xwsscif_loopback_pipe * pipe;
+        union xwos_ulock ulk;
+        xwsq_t lkst;
+        xwsz_t avail;
+        xwsz_t pos;
+        xwsz_t cp;
+        xwtm_t next;
+        xwer_t rc;
+
+        ep = xwssc->hwifcb;
+        pipe = ep->rx;
+        ulk.osal.splk = &pipe->lock;
+        pos = 0;
+        rc = XWOK;
+        xwos_splk_lock(&pipe->lock);
+        avail = xwsscif_loopback_arrived(pipe, &next);
+        while (0U == avail) {
+                if (XWTM_MAX == next) {
+                        rc = xwos_cond_wait(&pipe->cond, ulk, XWOS_LK_SPLK, NULL, &lkst);
+                } else {
+                        rc = xwos_cond_wait_to(&pipe->cond, ulk, XWOS_LK_SPLK, NULL,
+                                               next, &lkst);
+                }
+                if (rc < 0) {
+                        if ((xwsq_t)XWOS_LKST_UNLOCKED == lkst) {
+                                xwos_splk_lock(&pipe->lock);
+                        }
+                        if (-ETIMEDOUT != rc) {
+                                break;
+                        }
+                        rc = XWOK;
+                }
+                avail = xwsscif_loopback_arrived(pipe, &next);
+        }
+        while ((pos < *size) && (pos < avail)) {
+                cp = avail - pos;
+                if (cp > (XWSSCIF_LOOPBACK_BUFSIZE - pipe->rpos)) {
+                        cp = XWSSCIF_LOOPBACK_BUFSIZE - pipe->rpos;
+                }
+                if (cp > (*size - pos)) {
+                        cp = *size - pos;
+                }
+                memcpy(&buf[pos], &pipe->buf[pipe->rpos], cp);
+                pipe->rpos = (pipe->rpos + cp) % XWSSCIF_LOOPBACK_BUFSIZE;
+                pipe->cnt -= cp;
+                pipe->rtot += cp;
+                pos += cp;
+        }
+        if (pos > 0U) {
+                xwsscif_loopback_unmark(pipe);
+                xwos_cond_broadcast(&pipe->cond); // cppcheck-suppress [misra-c2012-17.7]
+        }
+        xwos_splk_unlock(&pipe->lock);
+        *size = pos;
+        return rc;
+}
+
+/**
+ * @} xwmd_isc_xwssc_hwif_loopback
+ */
@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @brief SOC间点对点通讯协议：硬件接口层：内存回环
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwmd_isc_xwssc_hwif_loopback_h__
+#define __xwmd_isc_xwssc_hwif_loopback_h__
+
+#include <xwos/standard.h>
+#include <xwos/osal/lock/spinlock.h>
+#include <xwos/osal/sync/cond.h>
+#include <xwmd/isc/xwssc/hwifal.h>
+
+/**
+ * @defgroup xwmd_isc_xwssc_hwif_loopback SOC间点对点通讯协议：硬件接口层：内存回环
+ * @ingroup xwmd_isc_xwssc_hwif
+ * 在同一个系统中用两个内存管道连接两个XWSSC，不需要任何硬件，
+ * 用于测试协议本身与测量协议的性能。
+ *
+ * 管道默认是理想的链路，可以通过 `xwsscif_loopback_set_cfg()` 模拟真实的链路：
+ * + 带宽：数据按带宽依次占用链路，链路忙时后写入的数据排队；
+ * + 延迟：数据离开链路后再经过固定的传播延迟才能被读出；
+ * + 误码：按平均间隔随机翻转数据中的位，模拟线路上的干扰。
+ *
+ * 带宽与延迟按写入时的时间计算每段数据的到达时间，发送不阻塞，
+ * 只有管道的缓冲区满时才阻塞，相当于串口的发送FIFO。
+ * 尚未到达的数据也占用缓冲区，带宽与延迟的乘积应远小于 @ref XWSSCIF_LOOPBACK_BUFSIZE ，
+ * 否则吞吐量受缓冲区大小限制。
+ *
+ * 用法：
+ * ```C
+ * struct xwsscif_loopback lb;
+ * struct xwsscif_loopback_cfg cfg = {
+ *         .bandwidth = 115200U / 10U, // 模拟波特率115200的串口（8N1）
+ *         .latency = XWTM_US(100),
+ *         .ber = 1000000U, // 平均每10^6位一个误码
+ *         .seed = 1U,
+ * };
+ *
+ * xwsscif_loopback_init(&lb);
+ * xwsscif_loopback_set_cfg(&lb, &cfg);
+ * xwssc_start(&xwssc0, "xwssc0", &xwsscif_loopback_ops, &lb.ep[0], mem0, size0);
+ * xwssc_start(&xwssc1, "xwssc1", &xwsscif_loopback_ops, &lb.ep[1], mem1, size1);
+ * ```
+ * @{
+ */
+
+#define XWSSCIF_LOOPBACK_BUFSIZE (1024U) /**< 每个管道的缓冲区大小 */
+#define XWSSCIF_LOOPBACK_MARK_NUM (32U) /**< 每个管道记录到达时间的数据段数量 */
+
+/**
+ * @brief 模拟链路的参数
+ * @details
+ * 所有成员为0时是理想的链路：数据写入后立即可以读出，不会出错。
+ */
+struct xwsscif_loopback_cfg {
+        xwu32_t bandwidth; /**< 带宽，单位：字节/秒，0表示不限制 */
+        xwtm_t latency; /**< 传播延迟，单位：纳秒 */
+        xwu32_t ber; /**< 误码间隔：平均每传输 `ber` 位翻转1位，0表示不注入误码，
+                          误码率即 `1 / ber` */
+        xwu32_t seed; /**< 注入误码的伪随机数种子，0被当作1 */
+};
+
+/**
+ * @brief 管道中一段数据的到达时间
+ */
+struct xwsscif_loopback_mark {
+        xwsz_t end; /**< 数据段末尾的累计写入量 */
+        xwtm_t at; /**< 数据段全部到达接收端的时间 */
+};
+
+/**
+ * @brief 单向内存管道
+ */
+struct xwsscif_loopback_pipe {
+        struct xwos_splk lock; /**< 保护管道的自旋锁 */
+        struct xwos_cond cond; /**< 管道中的数据量改变时广播的条件量 */
+        xwsz_t rpos; /**< 读位置 */
+        xwsz_t wpos; /**< 写位置 */
+        xwsz_t cnt; /**< 管道中的数据量 */
+        xwu8_t buf[XWSSCIF_LOOPBACK_BUFSIZE]; /**< 缓冲区 */
+
+        /* 模拟链路 */
+        struct xwsscif_loopback_cfg cfg; /**< 模拟链路的参数 */
+        xwsz_t wtot; /**< 累计写入量 */
+        xwsz_t rtot; /**< 累计读取量 */
+        xwtm_t idle; /**< 链路空闲的时间，之前写入的数据已全部离开发送端 */
+        struct {
+                xwsz_t head; /**< 最早的数据段 */
+                xwsz_t num; /**< 数据段的数量 */
+                struct xwsscif_loopback_mark m[XWSSCIF_LOOPBACK_MARK_NUM];
+        } mark; /**< 尚未读完的数据段的到达时间，
+                     数据段用完时最后一段被延长，只在限制带宽或有延迟时使用 */
+        xwu32_t rnd; /**< 伪随机数的状态 */
+        xwu32_t errgap; /**< 距离下一个误码的位数 */
+        xwu64_t errbits; /**< 已经翻转的位数 */
+};
+
+/**
+ * @brief 回环的端点，作为 `xwssc_start()` 的参数 `hwifcb`
+ */
+struct xwsscif_loopback_ep {
+        struct xwsscif_loopback_pipe * tx; /**< 发送管道 */
+        struct xwsscif_loopback_pipe * rx; /**< 接收管道 */
+};
+
+/**
+ * @brief 内存回环：两个方向的管道与两个端点
+ */
+struct xwsscif_loopback {
+        struct xwsscif_loopback_pipe pipe[2]; /**< 管道 */
+        struct xwsscif_loopback_ep ep[2]; /**< 端点，
+                                               `ep[0]` 发送的数据由 `ep[1]` 接收，
+                                               反之亦然 */
+};
+
+void xwsscif_loopback_init(struct xwsscif_loopback * lb);
+void xwsscif_loopback_fini(struct xwsscif_loopback * lb);
+void xwsscif_loopback_set_cfg(struct xwsscif_loopback * lb,
+                              const struct xwsscif_loopback_cfg * cfg);
+xwu64_t xwsscif_loopback_get_errbits(struct xwsscif_loopback * lb, xwsq_t dir);
+
+extern
+const struct xwssc_hwifal_operation xwsscif_loopback_ops; /**< 内存回环接口操作函数集 */
+
+/**
+ * @} xwmd_isc_xwssc_hwif_loopback
+ */
+
+#endif /* xwmd/isc/xwssc/hwif/loopback.h */
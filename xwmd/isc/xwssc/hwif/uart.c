@@ -11,6 +11,7 @@
  */
 
 #include <xwos/standard.h>
+#include <string.h>
 #include <xwcd/ds/uart/controller.h>
 #include <xwmd/isc/xwssc/protocol.h>
 #include <xwmd/isc/xwssc/hwifal.h>
@@ -30,9 +31,16 @@ xwer_t xwsscif_uart_close(struct xwssc * xwssc);
 static __xwmd_code
 xwer_t xwsscif_uart_tx(struct xwssc * xwssc, const xwu8_t * data, xwsz_t size);
 
+static __xwmd_code
+xwer_t xwsscif_uart_txv(struct xwssc * xwssc,
+                        const struct xwssc_iovec * iov, xwsz_t iovcnt);
+
 static __xwmd_code
 xwer_t xwsscif_uart_rx(struct xwssc * xwssc, xwu8_t * buf, xwsz_t * size);
 
+static __xwmd_code
+xwer_t xwsscif_uart_rxbulk(struct xwssc * xwssc, xwu8_t * buf, xwsz_t * size);
+
 static __xwmd_code
 void xwsscif_uart_notify(struct xwssc * xwssc, xwsq_t ntf);
 
@@ -41,7 +49,9 @@ const struct xwssc_hwifal_operation xwsscif_uart_ops = {
         .open = xwsscif_uart_open,
         .close = xwsscif_uart_close,
         .tx = xwsscif_uart_tx,
+        .txv = xwsscif_uart_txv,
         .rx = xwsscif_uart_rx,
+        .rxbulk = xwsscif_uart_rxbulk,
         .notify = xwsscif_uart_notify,
 };
 
@@ -65,12 +75,96 @@ xwer_t xwsscif_uart_tx(struct xwssc * xwssc, const xwu8_t * data, xwsz_t size)
         return xwds_uartc_tx(xwssc->hwifcb, data, &size, XWTM_MAX);
 }
 
+/**
+ * @brief 聚集发送
+ * @details
+ * 帧头、帧尾等较短的数据段先合并到栈上的缓冲区中一起发送，
+ * 较长的数据段直接从用户的缓冲区发送，减少调用UART驱动的次数。
+ */
+static __xwmd_code
+xwer_t xwsscif_uart_txv(struct xwssc * xwssc,
+                        const struct xwssc_iovec * iov, xwsz_t iovcnt)
+{
+        xwu8_t stream[XWSSC_FRM_ONSTACK_MAXSIZE];
+        xwsz_t pos;
+        xwsz_t size;
+        xwsz_t i;
+        xwer_t rc;
+
+        pos = 0;
+        rc = XWOK;
+        for (i = 0; i < iovcnt; i++) {
+                if ((pos + iov[i].size) <= sizeof(stream)) {
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        memcpy(&stream[pos], iov[i].base, iov[i].size);
+                        pos += iov[i].size;
+                        continue;
+                }
+                if (pos > 0U) {
+                        size = pos;
+                        rc = xwds_uartc_tx(xwssc->hwifcb, stream, &size, XWTM_MAX);
+                        if (rc < 0) {
+                                goto err_uartc_tx;
+                        }
+                        pos = 0;
+                }
+                if (iov[i].size <= sizeof(stream)) {
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        memcpy(stream, iov[i].base, iov[i].size);
+                        pos = iov[i].size;
+                } else {
+                        size = iov[i].size;
+                        rc = xwds_uartc_tx(xwssc->hwifcb, iov[i].base, &size, XWTM_MAX);
+                        if (rc < 0) {
+                                goto err_uartc_tx;
+                        }
+                }
+        }
+        if (pos > 0U) {
+                size = pos;
+                rc = xwds_uartc_tx(xwssc->hwifcb, stream, &size, XWTM_MAX);
+        }
+
+err_uartc_tx:
+        return rc;
+}
+
 static __xwmd_code
 xwer_t xwsscif_uart_rx(struct xwssc * xwssc, xwu8_t * buf, xwsz_t * size)
 {
 	return xwds_uartc_rx(xwssc->hwifcb, buf, size, XWTM_MAX);
 }
 
+/**
+ * @brief 阻塞接收第1个字节，然后取走UART接收队列中已到达的其他数据
+ */
+static __xwmd_code
+xwer_t xwsscif_uart_rxbulk(struct xwssc * xwssc, xwu8_t * buf, xwsz_t * size)
+{
+        xwsz_t first;
+        xwsz_t rest;
+        xwer_t rc;
+
+        first = 1;
+        rc = xwds_uartc_rx(xwssc->hwifcb, buf, &first, XWTM_MAX);
+        if (rc < 0) {
+                *size = 0;
+                goto err_uartc_rx;
+        }
+        rest = *size - first;
+        if (rest > 0U) {
+                rc = xwds_uartc_try_rx(xwssc->hwifcb, &buf[first], &rest);
+                if (-ENODATA == rc) {
+                        rc = XWOK;
+                }
+        }
+        *size = first + rest;
+        return rc;
+
+err_uartc_rx:
+        return rc;
+}
+
 static __xwmd_code
 void xwsscif_uart_notify(struct xwssc * xwssc, xwsq_t ntf)
 {
@@ -49,6 +49,8 @@ xwer_t xwssc_hwifal_open(struct xwssc * xwssc, void * hwifcb)
         xwer_t rc;
 
         xwssc->hwifcb = hwifcb;
+        xwssc->rxq.buf.pos = 0;
+        xwssc->rxq.buf.end = 0;
         if ((NULL != xwssc->hwifops) && (NULL != xwssc->hwifops->open)) {
                 rc = xwssc->hwifops->open(xwssc);
         } else {
@@ -119,6 +121,132 @@ xwer_t xwssc_hwifal_tx(struct xwssc * xwssc, const xwu8_t * stream, xwsz_t size)
         return rc;
 }
 
+/**
+ * @brief 通过硬件接口聚集发送多个数据段
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] iov: 数据段数组
+ * @param[in] iovcnt: 数据段的数量
+ * @return 错误码
+ * @details
+ * 硬件接口没有提供 `txv` 时，逐个数据段调用 `tx` 。
+ * 调用者必须持有发送锁，保证数据段之间不会插入其他帧。
+ */
+__xwmd_code
+xwer_t xwssc_hwifal_txv(struct xwssc * xwssc,
+                        const struct xwssc_iovec * iov, xwsz_t iovcnt)
+{
+        xwsz_t i;
+        xwer_t rc;
+
+        if (NULL != xwssc->hwifops->txv) {
+                rc = xwssc->hwifops->txv(xwssc, iov, iovcnt);
+        } else {
+                rc = XWOK;
+                for (i = 0; i < iovcnt; i++) {
+                        if (iov[i].size > 0U) {
+                                rc = xwssc->hwifops->tx(xwssc, iov[i].base, iov[i].size);
+                                if (rc < 0) {
+                                        break;
+                                }
+                        }
+                }
+        }
+        return rc;
+}
+
+/**
+ * @brief 从硬件接口读取数据填充接收缓冲区
+ * @param[in] xwssc: XWSSC对象的指针
+ * @return 错误码
+ * @details
+ * 只在接收缓冲区中的数据都已被解析后调用：
+ * + 硬件接口提供了 `rxbulk` 时，一次读取所有已到达的数据，最多填满缓冲区；
+ * + 否则只能通过 `rx` 每次读取1个字节。
+ */
+static __xwmd_code
+xwer_t xwssc_hwifal_rx_fill(struct xwssc * xwssc)
+{
+        xwsz_t rxsize;
+        xwer_t rc;
+
+        xwssc->rxq.buf.pos = 0;
+        xwssc->rxq.buf.end = 0;
+        if (NULL != xwssc->hwifops->rxbulk) {
+                rxsize = sizeof(xwssc->rxq.buf.mem);
+                rc = xwssc->hwifops->rxbulk(xwssc, xwssc->rxq.buf.mem, &rxsize);
+        } else {
+                rxsize = 1;
+                rc = xwssc->hwifops->rx(xwssc, xwssc->rxq.buf.mem, &rxsize);
+        }
+        if (rxsize > sizeof(xwssc->rxq.buf.mem)) {
+                rxsize = 0;
+        }
+        xwssc->rxq.buf.end = rxsize;
+        return rc;
+}
+
+/**
+ * @brief 从接收缓冲区中读取1个字节，缓冲区为空时从硬件接口填充
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[out] byte: 指向缓冲区的指针，通过此缓冲区返回字节
+ * @return 错误码
+ */
+static __xwmd_code
+xwer_t xwssc_hwifal_rx_byte(struct xwssc * xwssc, xwu8_t * byte)
+{
+        xwer_t rc;
+
+        while (xwssc->rxq.buf.pos >= xwssc->rxq.buf.end) {
+                rc = xwssc_hwifal_rx_fill(xwssc);
+                if (rc < 0) {
+                        goto err_rx_fill;
+                }
+        }
+        *byte = xwssc->rxq.buf.mem[xwssc->rxq.buf.pos];
+        xwssc->rxq.buf.pos++;
+        return XWOK;
+
+err_rx_fill:
+        return rc;
+}
+
+/**
+ * @brief 从接收缓冲区中读取指定长度的数据，缓冲区为空时从硬件接口填充
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[out] stream: 指向缓冲区的指针，通过此缓冲区返回数据
+ * @param[in] size: 数据长度
+ * @return 错误码
+ */
+static __xwmd_code
+xwer_t xwssc_hwifal_rx_stream(struct xwssc * xwssc, xwu8_t * stream, xwsz_t size)
+{
+        xwsz_t pos;
+        xwsz_t cp;
+        xwer_t rc;
+
+        pos = 0;
+        while (pos < size) {
+                if (xwssc->rxq.buf.pos >= xwssc->rxq.buf.end) {
+                        rc = xwssc_hwifal_rx_fill(xwssc);
+                        if (rc < 0) {
+                                goto err_rx_fill;
+                        }
+                        continue;
+                }
+                cp = xwssc->rxq.buf.end - xwssc->rxq.buf.pos;
+                if (cp > (size - pos)) {
+                        cp = size - pos;
+                }
+                memcpy(&stream[pos], &xwssc->rxq.buf.mem[xwssc->rxq.buf.pos], cp);
+                xwssc->rxq.buf.pos += cp;
+                pos += cp;
+        }
+        return XWOK;
+
+err_rx_fill:
+        return rc;
+}
+
 /**
  * @brief 通过硬件接口接收消息帧头
  * @param[in] xwssc: XWSSC对象的指针
@@ -126,6 +254,9 @@ xwer_t xwssc_hwifal_tx(struct xwssc * xwssc, const xwu8_t * stream, xwsz_t size)
  * @return 错误码
  * @retval XWOK: 接收成功
  * @retval -EAGAIN: 接收错误
+ * @details
+ * 数据从接收缓冲区中解析，硬件接口只在缓冲区为空时才被调用。
+ * 帧同步失败时，已经读入缓冲区的后续数据不会被丢弃，下一次调用从失败的位置继续搜索帧首定界符。
  */
 __xwmd_code
 xwer_t xwssc_hwifal_rx_head(struct xwssc * xwssc, struct xwssc_frm * frm)
@@ -134,9 +265,6 @@ xwer_t xwssc_hwifal_rx_head(struct xwssc * xwssc, struct xwssc_frm * frm)
         xwu8_t * stream;
         xwu8_t delim;
         xwsz_t delimcnt;
-        xwsz_t rxsize;
-        xwsz_t total;
-        xwssz_t rest;
         xwu8_t headsize;
         xwu8_t headsize_mirror;
         bool headchk;
@@ -144,8 +272,7 @@ xwer_t xwssc_hwifal_rx_head(struct xwssc * xwssc, struct xwssc_frm * frm)
         /* 接收帧首定界符 */
         delimcnt = 0;
         do { // cppcheck-suppress [misra-c2012-15.4]
-                rxsize = 1;
-                rc = xwssc->hwifops->rx(xwssc, &delim, &rxsize);
+                rc = xwssc_hwifal_rx_byte(xwssc, &delim);
                 if (rc < 0) {
                         goto err_sof_ifrx;
                 }
@@ -171,18 +298,10 @@ xwer_t xwssc_hwifal_rx_head(struct xwssc * xwssc, struct xwssc_frm * frm)
                 rc = -EAGAIN;
                 goto err_head_ifrx;
         }
-        total = headsize;
-        rest = (xwssz_t)total - 1;
-        do {
-                rxsize = (xwsz_t)rest;
-                rc = xwssc->hwifops->rx(xwssc,
-                                        &stream[total - rxsize],
-                                        &rxsize);
-                if (rc < 0) {
-                        goto err_head_ifrx;
-                }
-                rest -= (xwssz_t)rxsize;
-        } while (rest > 0);
+        rc = xwssc_hwifal_rx_stream(xwssc, &stream[1], (xwsz_t)headsize - 1U);
+        if (rc < 0) {
+                goto err_head_ifrx;
+        }
         headchk = xwssc_chk_head((xwu8_t *)&frm->head, headsize);
         if (!headchk) {
                 rc = -EAGAIN;
@@ -209,32 +328,20 @@ xwer_t xwssc_hwifal_rx_body(struct xwssc * xwssc,
                             struct xwssc_frm * frm, xwsz_t sdusize)
 {
         xwer_t rc;
-        xwsz_t rxsize;
-        xwsz_t total;
-        xwssz_t rest;
         xwu8_t * sdupos;
         xwu8_t delim;
         xwsz_t delimcnt;
 
         sdupos = &frm->head.ecsdusz[XWSSC_ECSIZE(&frm->head)];
-        total = sdusize + XWSSC_CRC32_SIZE;
-        rest = (xwssz_t)total;
-        do {
-                rxsize = (xwsz_t)rest;
-                rc = xwssc->hwifops->rx(xwssc,
-                                        &sdupos[total - rxsize],
-                                        &rxsize);
-                if (rc < 0) {
-                        goto err_body_ifrx;
-                }
-                rest -= (xwssz_t)rxsize;
-        } while (rest > 0);
+        rc = xwssc_hwifal_rx_stream(xwssc, sdupos, sdusize + XWSSC_CRC32_SIZE);
+        if (rc < 0) {
+                goto err_body_ifrx;
+        }
 
         /* 接收帧尾定界符 */
         delimcnt = 0;
         do { // cppcheck-suppress [misra-c2012-15.4]
-                rxsize = 1;
-                rc = xwssc->hwifops->rx(xwssc, &delim, &rxsize);
+                rc = xwssc_hwifal_rx_byte(xwssc, &delim);
                 if (rc < 0) {
                         goto err_eof_ifrx;
                 }
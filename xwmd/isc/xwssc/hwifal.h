@@ -24,6 +24,7 @@
 struct xwssc;
 union xwssc_slot;
 struct xwssc_frm;
+struct xwssc_iovec;
 
 /**
  * @brief 硬件接口抽象层操作函数集
@@ -34,7 +35,14 @@ struct xwssc_hwifal_operation {
         // cppcheck-suppress [misra-c2012-5.8]
         xwer_t (* close)(struct xwssc *); /**< 关闭硬件接口 */
         xwer_t (* tx)(struct xwssc *, const xwu8_t *, xwsz_t); /**< 发送数据 */
+        xwer_t (* txv)(struct xwssc *,
+                       const struct xwssc_iovec *, xwsz_t); /**< 聚集发送：按顺序发送多个数据段，
+                                                                 可为 `NULL` */
         xwer_t (* rx)(struct xwssc *, xwu8_t *, xwsz_t *); /**< 接收数据 */
+        xwer_t (* rxbulk)(struct xwssc *, xwu8_t *, xwsz_t *); /**< 批量接收数据：
+                                                                    阻塞到至少有1个字节，
+                                                                    然后返回已到达的所有数据，
+                                                                    可为 `NULL` */
         void (* notify)(struct xwssc *, xwsq_t); /**< 通知事件 */
 };
 
@@ -59,6 +67,8 @@ enum xwssc_hwifal_notification_em {
 xwer_t xwssc_hwifal_open(struct xwssc * xwssc, void * hwifcb);
 xwer_t xwssc_hwifal_close(struct xwssc * xwssc);
 xwer_t xwssc_hwifal_tx(struct xwssc * xwssc, const xwu8_t * stream, xwsz_t size);
+xwer_t xwssc_hwifal_txv(struct xwssc * xwssc,
+                        const struct xwssc_iovec * iov, xwsz_t iovcnt);
 xwer_t xwssc_hwifal_rx_head(struct xwssc * xwssc, struct xwssc_frm * frm);
 xwer_t xwssc_hwifal_rx_body(struct xwssc * xwssc,
                             struct xwssc_frm * frm, xwsz_t sdusize);
@@ -17,6 +17,7 @@
 #include <xwos/lib/xwbop.h>
 #include <xwos/mm/bma.h>
 #include <xwos/osal/thd.h>
+#include <xwos/osal/swt.h>
 #include <xwos/osal/lock/spinlock.h>
 #include <xwmd/isc/xwssc/hwifal.h>
 #include <xwmd/isc/xwssc/protocol.h>
@@ -122,12 +123,41 @@ xwer_t xwssc_start(struct xwssc * xwssc, const char * name,
         xwssc->txq.remote.id = 0;
         xwssc->txq.tmp = NULL;
         xwos_splk_init(&xwssc->txq.notiflk);
+        xwssc->txq.wnd.size = 1;
+        xwssc->txq.wnd.next = 0;
+        xwssc->txq.wnd.ackbmp = 0;
+        xwssc->txq.wnd.rtxbmp = 0;
+        xwssc->txq.rmtcap = 0;
+        rc = xwos_sem_init(&xwssc->txq.wnd.sem, 0, 1);
+        if (rc < 0) {
+                xwssclogf(xwssc, E,
+                          "[A][START] Init TX window semaphore ... <rc:%d>\r\n", rc);
+                goto err_wndsem_init; // cppcheck-suppress [misra-c2012-15.2]
+        }
+        for (i = 0; (xwsq_t)i < XWSSC_WND_SIZE; i++) {
+                xwssc->txq.wnd.slot[i].xwssc = xwssc;
+                xwssc->txq.wnd.slot[i].car = NULL;
+                xwssc->txq.wnd.slot[i].cnt = 0;
+                rc = xwos_swt_init(&xwssc->txq.wnd.slot[i].swt, XWOS_SWT_FLAG_NULL);
+                if (rc < 0) {
+                        xwssclogf(xwssc, E,
+                                  "[A][START] Init TX window timer[%d] ... <rc:%d>\r\n",
+                                  i, rc);
+                        goto err_wndswt_init; // cppcheck-suppress [misra-c2012-15.2]
+                }
+        }
 
         /* 初始化接收状态机 */
         xwssc->rxq.cnt = 0;
+        xwssc->rxq.wnd.size = 1;
+        for (j = 0; (xwsq_t)j < XWSSC_WND_SIZE; j++) {
+                xwssc->rxq.wnd.ooo[j] = NULL;
+        }
         for (i = 0; (xwsq_t)i < XWSSC_PORT_NUM; i++) {
                 xwlib_bclst_init_head(&xwssc->rxq.q[i]);
                 xwos_splk_init(&xwssc->rxq.lock[i]);
+                xwssc->rxq.ntf[i].cb = NULL;
+                xwssc->rxq.ntf[i].arg = NULL;
                 rc = xwos_sem_init(&xwssc->rxq.sem[i], 0, XWSSC_MEMBLK_NUM);
                 if (rc < 0) {
                         xwssclogf(xwssc, E,
@@ -137,6 +167,20 @@ xwer_t xwssc_start(struct xwssc * xwssc, const char * name,
                 }
         }
 
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+        /* 初始化压缩 */
+        // cppcheck-suppress [misra-c2012-17.7]
+        memset((void *)&xwssc->lz.portbmp, 0, sizeof(xwssc->lz.portbmp));
+        xwos_splk_init(&xwssc->lz.statlock);
+        // cppcheck-suppress [misra-c2012-17.7]
+        memset(xwssc->lz.stat, 0, sizeof(xwssc->lz.stat));
+#endif
+
+        /* 初始化统计信息 */
+        xwssc->stat.txsdu = 0;
+        xwssc->stat.txrtx = 0;
+        xwssc->stat.rxerr = 0;
+
         /* 打开硬件接口 */
         rc = xwssc_hwifal_open(xwssc, hwifcb);
         if (rc < 0) {
@@ -185,6 +229,13 @@ err_rxqsem_init:
         for (j = i - 1; j >= 0; j--) {
                 xwos_sem_fini(&xwssc->rxq.sem[j]);
         }
+        i = (xwssq_t)XWSSC_WND_SIZE;
+err_wndswt_init:
+        for (j = i - 1; j >= 0; j--) {
+                xwos_swt_fini(&xwssc->txq.wnd.slot[j].swt);
+        }
+        xwos_sem_fini(&xwssc->txq.wnd.sem);
+err_wndsem_init:
         xwos_cond_fini(&xwssc->txq.cscond);
 err_cscond_init:
         xwos_mtx_fini(&xwssc->txq.csmtx);
@@ -266,10 +317,15 @@ xwer_t xwssc_gc(struct xwos_object * obj)
                         xwmm_bma_free(xwssc->mempool, slot);
                 } while (true);
         }
+        xwssc_rxwnd_flush(xwssc);
 
         for (j = (xwssq_t)XWSSC_PORT_NUM - 1; j >= 0; j--) {
                 xwos_sem_fini(&xwssc->rxq.sem[j]);
         }
+        for (j = (xwssq_t)XWSSC_WND_SIZE - 1; j >= 0; j--) {
+                xwos_swt_fini(&xwssc->txq.wnd.slot[j].swt);
+        }
+        xwos_sem_fini(&xwssc->txq.wnd.sem);
         xwos_cond_fini(&xwssc->txq.cscond);
         xwos_mtx_fini(&xwssc->txq.csmtx);
         xwos_sem_fini(&xwssc->txq.qsem);
@@ -425,6 +481,45 @@ err_ifnotrdy:
         return rc;
 }
 
+__xwmd_api
+xwer_t xwssc_eqv(struct xwssc * xwssc,
+                 const struct xwssc_iovec iov[], xwsz_t iovcnt,
+                 xwu8_t pri, xwu8_t port, xwu8_t qos,
+                 xwssc_ntf_f ntfcb, void * cbarg,
+                 xwssc_txh_t * txhbuf)
+{
+        xwsz_t sdusize;
+        xwsz_t i;
+        xwer_t rc;
+
+        XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != iov), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((iovcnt > 0U), "iovcnt-invalid", -EINVAL);
+        XWSSC_VALIDATE((pri < XWSSC_PRI_NUM), "pri-invalid", -E2BIG);
+        XWSSC_VALIDATE((port < XWSSC_PORT_NUM), "no-such-port", -ENODEV);
+        XWSSC_VALIDATE((qos < XWSSC_MSG_QOS_NUM), "qos-invalid", -EINVAL);
+
+        sdusize = 0;
+        for (i = 0; i < iovcnt; i++) {
+                XWSSC_VALIDATE_FORCE(((NULL != iov[i].base) || (0U == iov[i].size)),
+                                     "nullptr", -EFAULT);
+                sdusize += iov[i].size;
+        }
+        XWSSC_VALIDATE_FORCE((sdusize <= XWSSC_SDU_MAX_SIZE), "size-invalid", -E2BIG);
+
+        rc = xwssc_grab(xwssc);
+        if (rc < 0) {
+                rc = -EPERM;
+                goto err_ifnotrdy;
+        }
+        rc = xwssc_eq_msgv(xwssc, iov, iovcnt, sdusize, pri, port, qos,
+                           ntfcb, cbarg, txhbuf);
+        xwssc_put(xwssc); // cppcheck-suppress [misra-c2012-17.7]
+
+err_ifnotrdy:
+        return rc;
+}
+
 __xwmd_api
 xwer_t xwssc_abort(struct xwssc * xwssc, xwssc_txh_t txh)
 {
@@ -448,16 +543,64 @@ xwsq_t xwssc_get_txstate(xwssc_txh_t txh)
         return txh->state;
 }
 
+/**
+ * @brief 从帧槽中读取消息到用户的缓冲区
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] slot: 帧槽的指针
+ * @param[out] rxbuf: 用户的缓冲区
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示用户的缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的消息大小
+ * @param[out] qos: 返回消息的QoS的缓冲区，可为 `NULL`
+ * @return 错误码
+ * @note
+ * + 压缩的数据被解压；缓冲区不足时只拷贝缓冲区能容纳的部分；
+ * + 不释放帧槽。
+ */
+static __xwmd_code
+xwer_t xwssc_rxq_read(struct xwssc * xwssc, union xwssc_slot * slot,
+                      xwu8_t rxbuf[], xwsz_t * size, xwu8_t * qos)
+{
+        xwu8_t * sdupos;
+        xwsz_t bufsize;
+        xwsz_t sdusize;
+        xwsz_t realsize;
+        xwer_t rc;
+
+        bufsize = *size;
+        sdupos = XWSSC_SDUPOS(&slot->rx.frm.head);
+        sdusize = XWSSC_RXSDUSIZE(&slot->rx);
+        if ((xwu8_t)0 != (slot->rx.frm.head.qos & XWSSC_QOS_LZ)) {
+                realsize = bufsize;
+                rc = xwssc_rxq_unlz(xwssc, slot->rx.frm.head.port,
+                                    sdupos, sdusize, rxbuf, &realsize);
+        } else {
+                if (bufsize < sdusize) {
+                        realsize = bufsize;
+                        xwssclogf(xwssc, W,
+                                  "[A][RX] Buffer is too small(%d)! "
+                                  "Expected size is %ld\r\n",
+                                  bufsize, sdusize);
+                } else {
+                        realsize = sdusize;
+                }
+                // cppcheck-suppress [misra-c2012-17.7]
+                memcpy(rxbuf, sdupos, realsize);
+                rc = XWOK;
+        }
+        if (NULL != qos) {
+                *qos = slot->rx.frm.head.qos & (xwu8_t)XWSSC_MSG_QOS_MSK;
+        }
+        *size = realsize;
+        return rc;
+}
+
 __xwmd_api
 xwer_t xwssc_rx(struct xwssc * xwssc, xwu8_t port,
                 xwu8_t rxbuf[], xwsz_t * size, xwu8_t * qos,
                 xwtm_t to)
 {
         union xwssc_slot * slot;
-        xwu8_t * sdupos;
-        xwsz_t bufsize;
-        xwsz_t sdusize;
-        xwsz_t realsize;
         xwer_t rc;
 
         XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
@@ -471,36 +614,17 @@ xwer_t xwssc_rx(struct xwssc * xwssc, xwu8_t port,
                 goto err_ifnotrdy;
         }
 
-        bufsize = *size;
-        xwssclogf(xwssc, V, "[A][RX] port:%d, size:%ld\r\n", port, bufsize);
+        xwssclogf(xwssc, V, "[A][RX] port:%d, size:%ld\r\n", port, *size);
         rc = xwos_sem_wait_to(&xwssc->rxq.sem[port], to);
         if (rc < 0) {
                 goto err_sem_wait_to;
         }
 
         slot = xwssc_rxq_choose(xwssc, port);
-        sdupos = XWSSC_SDUPOS(&slot->rx.frm.head);
-        sdusize = XWSSC_RXSDUSIZE(&slot->rx);
-
-        if (bufsize < sdusize) {
-                realsize = bufsize;
-                xwssclogf(xwssc, W,
-                          "[A][RX] Buffer is too small(%d)! Expected size is %ld\r\n",
-                          bufsize, sdusize);
-        } else {
-                realsize = sdusize;
-        }
-
-        // cppcheck-suppress [misra-c2012-17.7]
-        memcpy(rxbuf, sdupos, realsize);
-        if (NULL != qos) {
-                *qos = slot->rx.frm.head.qos;
-        }
-        *size = realsize;
-
+        rc = xwssc_rxq_read(xwssc, slot, rxbuf, size, qos);
         xwmm_bma_free(xwssc->mempool, slot); // cppcheck-suppress [misra-c2012-17.7]
         xwssc_put(xwssc); // cppcheck-suppress [misra-c2012-17.7]
-        return XWOK;
+        return rc;
 
 err_sem_wait_to:
         xwssc_put(xwssc); // cppcheck-suppress [misra-c2012-17.7]
@@ -513,10 +637,6 @@ xwer_t xwssc_try_rx(struct xwssc * xwssc, xwu8_t port,
                     xwu8_t rxbuf[], xwsz_t * size, xwu8_t * qos)
 {
         union xwssc_slot * slot;
-        xwu8_t * sdupos;
-        xwsz_t bufsize;
-        xwsz_t sdusize;
-        xwsz_t realsize;
         xwer_t rc;
 
         XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
@@ -530,36 +650,17 @@ xwer_t xwssc_try_rx(struct xwssc * xwssc, xwu8_t port,
                 goto err_ifnotrdy;
         }
 
-        bufsize = *size;
-        xwssclogf(xwssc, V, "[A][TRYRX] port:%d, size:%ld\r\n", port, bufsize);
+        xwssclogf(xwssc, V, "[A][TRYRX] port:%d, size:%ld\r\n", port, *size);
         rc = xwos_sem_trywait(&xwssc->rxq.sem[port]);
         if (rc < 0) {
                 goto err_sem_trywait;
         }
 
         slot = xwssc_rxq_choose(xwssc, port);
-        sdupos = XWSSC_SDUPOS(&slot->rx.frm.head);
-        sdusize = XWSSC_RXSDUSIZE(&slot->rx);
-
-        if (bufsize < sdusize) {
-                realsize = bufsize;
-                xwssclogf(xwssc, W,
-                          "[A][TRYRX] Buffer is too small(%d)! "
-                          "Expected size is %d\r\n",
-                          bufsize, sdusize);
-        } else {
-                realsize = sdusize;
-        }
-        // cppcheck-suppress [misra-c2012-17.7]
-        memcpy(rxbuf, sdupos, realsize);
-        if (NULL != qos) {
-                *qos = slot->rx.frm.head.qos;
-        }
-        *size = realsize;
-
+        rc = xwssc_rxq_read(xwssc, slot, rxbuf, size, qos);
         xwmm_bma_free(xwssc->mempool, slot); // cppcheck-suppress [misra-c2012-17.7]
         xwssc_put(xwssc); // cppcheck-suppress [misra-c2012-17.7]
-        return XWOK;
+        return rc;
 
 err_sem_trywait:
         xwssc_put(xwssc); // cppcheck-suppress [misra-c2012-17.7]
@@ -567,6 +668,131 @@ err_ifnotrdy:
         return rc;
 }
 
+__xwmd_api
+xwer_t xwssc_set_rxcb(struct xwssc * xwssc, xwu8_t port, xwssc_rxcb_f cb, void * arg)
+{
+        xwreg_t cpuirq;
+
+        XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((port < XWSSC_PORT_NUM), "no-such-port", -ENODEV);
+
+        xwos_splk_lock_cpuirqsv(&xwssc->rxq.lock[port], &cpuirq);
+        xwssc->rxq.ntf[port].cb = cb;
+        xwssc->rxq.ntf[port].arg = arg;
+        xwos_splk_unlock_cpuirqrs(&xwssc->rxq.lock[port], cpuirq);
+        return XWOK;
+}
+
+__xwmd_api
+xwer_t xwssc_rxh_peek(xwssc_rxh_t rxh, const xwu8_t ** sdu, xwsz_t * size, xwu8_t * qos)
+{
+        xwer_t rc;
+
+        XWSSC_VALIDATE((NULL != rxh), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != sdu), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != size), "nullptr", -EFAULT);
+
+        if ((xwu8_t)0 != (rxh->rx.frm.head.qos & XWSSC_QOS_LZ)) {
+                rc = -ENOTSUP;
+        } else {
+                *sdu = XWSSC_SDUPOS(&rxh->rx.frm.head);
+                *size = XWSSC_RXSDUSIZE(&rxh->rx);
+                if (NULL != qos) {
+                        *qos = rxh->rx.frm.head.qos & (xwu8_t)XWSSC_MSG_QOS_MSK;
+                }
+                rc = XWOK;
+        }
+        return rc;
+}
+
+__xwmd_api
+xwer_t xwssc_rxh_read(struct xwssc * xwssc, xwssc_rxh_t rxh,
+                      xwu8_t rxbuf[], xwsz_t * size, xwu8_t * qos)
+{
+        XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != rxh), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != rxbuf), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != size), "nullptr", -EFAULT);
+
+        return xwssc_rxq_read(xwssc, rxh, rxbuf, size, qos);
+}
+
+__xwmd_api
+xwer_t xwssc_rxh_free(struct xwssc * xwssc, xwssc_rxh_t rxh)
+{
+        XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != rxh), "nullptr", -EFAULT);
+
+        return xwmm_bma_free(xwssc->mempool, rxh);
+}
+
+__xwmd_api
+xwer_t xwssc_get_stat(struct xwssc * xwssc, struct xwssc_stat * statbuf)
+{
+        XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != statbuf), "nullptr", -EFAULT);
+
+        xwaop_read(xwsq_t, &xwssc->stat.txsdu, &statbuf->txsdu);
+        xwaop_read(xwsq_t, &xwssc->stat.txrtx, &statbuf->txrtx);
+        xwaop_read(xwsq_t, &xwssc->stat.rxerr, &statbuf->rxerr);
+        return XWOK;
+}
+
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+__xwmd_api
+bool xwssc_tst_lz(struct xwssc * xwssc)
+{
+        return (xwssc_tst_connected(xwssc) &&
+                ((xwu8_t)0 != (xwssc->txq.rmtcap & (xwu8_t)XWSSC_CAP_LZ)));
+}
+
+__xwmd_api
+xwer_t xwssc_set_lz(struct xwssc * xwssc, xwu8_t port, bool enable)
+{
+        XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((port < XWSSC_PORT_NUM), "no-such-port", -ENODEV);
+
+        if (enable) {
+                xwbmpaop_s1i(xwssc->lz.portbmp, (xwsq_t)port);
+        } else {
+                xwbmpaop_c0i(xwssc->lz.portbmp, (xwsq_t)port);
+        }
+        return XWOK;
+}
+
+__xwmd_api
+xwer_t xwssc_get_lzstat(struct xwssc * xwssc, xwu8_t port,
+                        struct xwssc_lzstat * statbuf)
+{
+        xwreg_t cpuirq;
+
+        XWSSC_VALIDATE((NULL != xwssc), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((NULL != statbuf), "nullptr", -EFAULT);
+        XWSSC_VALIDATE((port < XWSSC_PORT_NUM), "no-such-port", -ENODEV);
+
+        xwos_splk_lock_cpuirqsv(&xwssc->lz.statlock, &cpuirq);
+        *statbuf = xwssc->lz.stat[port];
+        xwos_splk_unlock_cpuirqrs(&xwssc->lz.statlock, cpuirq);
+        return XWOK;
+}
+#endif
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+__xwmd_api
+xwer_t xwssc_log_sink(void * arg, const xwu8_t data[], xwsz_t size)
+{
+        struct xwssc_log_sink * sink;
+        xwsz_t sz;
+
+        XWSSC_VALIDATE((NULL != arg), "nullptr", -EFAULT);
+
+        sink = arg;
+        sz = size;
+        return xwssc_eq(sink->xwssc, data, &sz, sink->pri, sink->port, sink->qos,
+                        NULL, NULL, NULL);
+}
+#endif
+
 /**
  * @} xwmd_isc_xwssc_mif
  */
@@ -32,11 +32,21 @@
 #if (XWMDCFG_isc_xwssc_PRI_NUM > 64)
 #  error "XWSSC Only supports 64 priorities!"
 #endif
+#if ((XWMDCFG_isc_xwssc_WND_SIZE < 1) || \
+     (XWMDCFG_isc_xwssc_WND_SIZE & (XWMDCFG_isc_xwssc_WND_SIZE - 1)))
+#  error "XWMDCFG_isc_xwssc_WND_SIZE must be the power of 2!"
+#endif
+#if (XWMDCFG_isc_xwssc_WND_SIZE > 32)
+#  error "XWSSC Only supports 32 frames in the sliding window!"
+#endif
+#if (XWMDCFG_isc_xwssc_RXBUF_SIZE < 1)
+#  error "XWMDCFG_isc_xwssc_RXBUF_SIZE must be greater than 0!"
+#endif
 
-#define XWSSC_VERSION           ("1.0.0") /**< XWSSC的版本号字符串 */
+#define XWSSC_VERSION           ("1.0.2") /**< XWSSC的版本号字符串 */
 #define XWSSC_VERSION_MAJOR     1U /**< XWSSC的大版本号 */
 #define XWSSC_VERSION_MINOR     0U /**< XWSSC的小版本号 */
-#define XWSSC_VERSION_REVISION  0U /**< XWSSC的修订版本号 */
+#define XWSSC_VERSION_REVISION  2U /**< XWSSC的修订版本号 */
 
 #define XWSSC_PRI_NUM (XWMDCFG_isc_xwssc_PRI_NUM) /**< 优先级数量 */
 #define XWSSC_INVALID_PRI (0xFFU) /**< 无效优先级 */
@@ -44,6 +54,8 @@
 #define XWSSC_PORT_NUM (XWMDCFG_isc_xwssc_PORT_NUM) /**< 端口号 */
 #define XWSSC_RETRY_PERIOD (XWMDCFG_isc_xwssc_RETRY_PERIOD) /**< 重试发送的周期 */
 #define XWSSC_RETRY_NUM (XWMDCFG_isc_xwssc_RETRY_NUM) /**< 重试发送的次数 */
+#define XWSSC_WND_SIZE (XWMDCFG_isc_xwssc_WND_SIZE) /**< 滑动窗口的大小 */
+#define XWSSC_RXBUF_SIZE (XWMDCFG_isc_xwssc_RXBUF_SIZE) /**< 接收缓冲区的大小 */
 #define XWSSC_MEMBLK_SIZE (XWMDCFG_isc_xwssc_MEMBLK_SIZE) /**< 单位内存块的大小 */
 #define XWSSC_MEMBLK_ODR (XWMDCFG_isc_xwssc_MEMBLK_ODR) /**< 内存块数量的阶，
                                                              阶是指2的n次方中的n */
@@ -60,12 +72,26 @@
 struct xwssc;
 struct xwssc_hwifal_operation;
 struct xwssc_carrier;
+union xwssc_slot;
 
 /**
  * @brief 发送句柄
  */
 typedef struct xwssc_carrier * xwssc_txh_t;
 
+/**
+ * @brief 接收句柄，指向接收到的帧槽
+ */
+typedef union xwssc_slot * xwssc_rxh_t;
+
+/**
+ * @brief 分散的数据段
+ */
+struct xwssc_iovec {
+        const xwu8_t * base; /**< 数据段的首地址 */
+        xwsz_t size; /**< 数据段的长度 */
+};
+
 /**
  * @brief 发送状态枚举
  */
@@ -92,6 +118,32 @@ enum xwssc_msg_qos_em {
                              XWSSC_MSG_QOS_RELIABLE_MSK), /**< 掩码，BIT(0) | BIT(1) */
 };
 
+/**
+ * @brief 链路统计信息
+ * @details
+ * 计数器从 `xwssc_start()` 开始累加，溢出后回绕，
+ * 测量一段时间内的数量时取前后两次读取的差值。
+ */
+struct xwssc_stat {
+        xwsq_t txsdu; /**< 发送：首次发送的数据帧数量 */
+        xwsq_t txrtx; /**< 发送：超时重传的数据帧数量 */
+        xwsq_t rxerr; /**< 接收：因数据流错误或校验错误而丢弃的帧数量 */
+};
+
+/**
+ * @brief 端口的压缩统计信息
+ * @details
+ * + 发送的压缩率为 `txlz / txraw` ，不值得压缩而原样发送的数据也计入；
+ * + 耗时为 `xwtm_now()` 的差值累加，单位为纳秒。
+ */
+struct xwssc_lzstat {
+        xwu64_t txraw; /**< 发送：压缩前的数据总长度 */
+        xwu64_t txlz; /**< 发送：实际发送的数据总长度 */
+        xwtm_t txcost; /**< 发送：压缩所用的总时间 */
+        xwu64_t rxlz; /**< 接收：收到的压缩数据总长度 */
+        xwu64_t rxraw; /**< 接收：解压后的数据总长度 */
+        xwtm_t rxcost; /**< 接收：解压所用的总时间 */
+};
 
 /**
  * @brief 通知发送结果的回调函数
@@ -101,6 +153,17 @@ typedef void (* xwssc_ntf_f)(struct xwssc * /* xwssc */,
                              xwer_t /* rc */,
                              void * /* arg */);
 
+/**
+ * @brief 通知接收到消息的回调函数
+ * @details
+ * 回调函数获得接收句柄 `rxh` 的所有权，
+ * 必须在处理完消息后调用 `xwssc_rxh_free()` 将帧槽释放回内存池。
+ */
+typedef void (* xwssc_rxcb_f)(struct xwssc * /* xwssc */,
+                              xwu8_t /* port */,
+                              xwssc_rxh_t /* rxh */,
+                              void * /* arg */);
+
 /**
  * @brief XWSSC API: 启动XWSSC
  * @param[in] xwssc: XWSSC对象的指针
@@ -222,6 +285,42 @@ xwer_t xwssc_eq(struct xwssc * xwssc,
                 xwssc_ntf_f ntfcb, void * cbarg,
                 xwssc_txh_t * txhbuf);
 
+/**
+ * @brief XWSSC API: 将分散在多个缓冲区中的一条用户数据加入到XWSSC的发送队列中，不拷贝数据
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] iov: 数据段数组
+ * @param[in] iovcnt: 数据段的数量
+ * @param[in] pri: 优先级
+ * @param[in] port: 端口
+ * @param[in] qos: 服务质量
+ * @param[in] ntfcb: 通知发送结果的回调函数
+ * @param[in] cbarg: 调用回调函数时的用户数据
+ * @param[out] txhbuf: 指向缓冲区的指针，通过此缓冲区返回发送句柄
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -E2BIG: 数据太长
+ * @retval -ENODEV: 端口号超出范围
+ * @retval -EINVAL: qos错误或数据段的数量为0
+ * @retval -ENOMEM: 帧槽被使用完
+ * @retval -EPERM: XWSSC未启动
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * + 异步函数
+ * @details
+ * + 所有数据段按顺序组成一条消息，远程端收到的消息与 `xwssc_eq()` 发送的相同；
+ * + 内存池中只存放帧头、CRC32、帧尾与数据段数组的副本，
+ *   数据段本身直接通过硬件接口的聚集发送函数发出，
+ *   因此在回调函数 `ntfcb` 被调用之前，数据段指向的缓冲区必须一直有效且不能被修改；
+ *   数组 `iov` 本身在函数返回后即可释放；
+ * + CRC32在入队时逐个数据段累积计算，重传时不再重新计算。
+ */
+xwer_t xwssc_eqv(struct xwssc * xwssc,
+                 const struct xwssc_iovec iov[], xwsz_t iovcnt,
+                 xwu8_t pri, xwu8_t port, xwu8_t qos,
+                 xwssc_ntf_f ntfcb, void * cbarg,
+                 xwssc_txh_t * txhbuf);
+
 /**
  * @brief XWSSC API: 中断发送
  * @param[in] xwssc: XWSSC对象的指针
@@ -263,6 +362,7 @@ xwsq_t xwssc_get_txstate(xwssc_txh_t txh);
  * @retval -EFAULT: 空指针
  * @retval -ENODEV: 端口号超出范围
  * @retval -EPERM: XWSSC未启动
+ * @retval -EBADMSG: 压缩的数据格式错误
  * @retval -ETIMEDOUT: 超时
  * @note
  * + 上下文：线程
@@ -291,12 +391,192 @@ xwer_t xwssc_rx(struct xwssc * xwssc, xwu8_t port,
  * @retval -ENODEV: 端口号超出范围
  * @retval -ENODATA: 接收队列为空
  * @retval -EPERM: XWSSC未启动
+ * @retval -EBADMSG: 压缩的数据格式错误
  * @note
  * + 上下文：中断、中断底半部、线程
  */
 xwer_t xwssc_try_rx(struct xwssc * xwssc, xwu8_t port,
                     xwu8_t rxbuf[], xwsz_t * size, xwu8_t * qos);
 
+/**
+ * @brief XWSSC API: 设置端口的接收回调函数
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] port: 端口
+ * @param[in] cb: 接收回调函数，`NULL` 表示恢复为接收队列
+ * @param[in] arg: 调用回调函数时的用户数据
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENODEV: 端口号超出范围
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * + 设置回调函数后，接收线程收到此端口的消息时直接调用回调函数，
+ *   不再将消息放入接收队列，也不再发布信号量，
+ *   省去唤醒接收消息的线程与一次上下文切换；
+ * + 回调函数在XWSSC的接收线程中按消息到达的顺序执行，
+ *   如果在回调函数中长时间阻塞，会导致XWSSC停止接收，
+ *   需要较长时间处理的消息应在回调函数中转交给其他线程；
+ * + 回调函数获得帧槽的所有权，可以通过 `xwssc_rxh_peek()` 直接访问数据，
+ *   或通过 `xwssc_rxh_read()` 拷贝数据，
+ *   然后（可以在其他线程中）通过 `xwssc_rxh_free()` 释放帧槽；
+ *   帧槽不释放会耗尽内存池；
+ * + 设置回调函数之前已经在接收队列中的消息仍然需要通过 `xwssc_rx()` 接收。
+ */
+xwer_t xwssc_set_rxcb(struct xwssc * xwssc, xwu8_t port, xwssc_rxcb_f cb, void * arg);
+
+/**
+ * @brief XWSSC API: 直接访问接收句柄中的数据，不拷贝
+ * @param[in] rxh: 接收句柄
+ * @param[out] sdu: 指向缓冲区的指针，通过此缓冲区返回数据的首地址
+ * @param[out] size: 指向缓冲区的指针，通过此缓冲区返回数据的长度
+ * @param[out] qos: 指向缓冲区的指针，通过此缓冲区返回消息的QoS，可为 `NULL`
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOTSUP: 数据经过压缩，只能通过 `xwssc_rxh_read()` 读取
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * 返回的数据在 `xwssc_rxh_free()` 之前一直有效。
+ */
+xwer_t xwssc_rxh_peek(xwssc_rxh_t rxh, const xwu8_t ** sdu, xwsz_t * size, xwu8_t * qos);
+
+/**
+ * @brief XWSSC API: 从接收句柄中拷贝数据
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] rxh: 接收句柄
+ * @param[out] rxbuf: 指向缓冲区的指针，此缓冲区用于接收消息
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示接收缓冲区的大小
+ * + (O) 作为输出时，返回实际接收的消息大小
+ * @param[out] qos: 指向缓冲区的指针，通过此缓冲区返回消息的QoS，可为 `NULL`
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EBADMSG: 压缩的数据格式错误
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * 与 `xwssc_rx()` 相同，压缩的数据被解压，缓冲区不足时只拷贝缓冲区能容纳的部分；
+ * 此函数不释放帧槽。
+ */
+xwer_t xwssc_rxh_read(struct xwssc * xwssc, xwssc_rxh_t rxh,
+                      xwu8_t rxbuf[], xwsz_t * size, xwu8_t * qos);
+
+/**
+ * @brief XWSSC API: 释放接收句柄
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] rxh: 接收句柄
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * 必须在 `xwssc_stop()` 之前释放所有的接收句柄。
+ */
+xwer_t xwssc_rxh_free(struct xwssc * xwssc, xwssc_rxh_t rxh);
+
+/**
+ * @brief XWSSC API: 获取链路统计信息
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[out] statbuf: 指向缓冲区的指针，通过此缓冲区返回统计信息
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * 每个计数器单独读取，不保证多个计数器之间是同一时刻的值。
+ */
+xwer_t xwssc_get_stat(struct xwssc * xwssc, struct xwssc_stat * statbuf);
+
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+/**
+ * @brief XWSSC API: 测试与远端的链路是否支持压缩
+ * @param[in] xwssc: XWSSC对象的指针
+ * @return 布尔值
+ * @retval true: 支持
+ * @retval false: 不支持或未连接
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * 连接时双方通过连接帧中的能力标志协商，远端为旧版本时不支持压缩。
+ */
+bool xwssc_tst_lz(struct xwssc * xwssc);
+
+/**
+ * @brief XWSSC API: 设置端口发送时是否压缩数据
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] port: 端口
+ * @param[in] enable: 是否压缩
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENODEV: 端口号超出范围
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * + 只影响本地发送的数据，接收时由帧中的压缩标志决定是否解压；
+ * + 压缩在发送线程中第一次发送帧之前进行，只有与远端协商支持压缩时才生效；
+ * + 压缩后不比原数据短的数据原样发送；
+ * + 通过 `xwssc_eqv()` 发送的数据不在帧槽中，不压缩。
+ */
+xwer_t xwssc_set_lz(struct xwssc * xwssc, xwu8_t port, bool enable);
+
+/**
+ * @brief XWSSC API: 获取端口的压缩统计信息
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] port: 端口
+ * @param[out] statbuf: 指向缓冲区的指针，通过此缓冲区返回统计信息
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENODEV: 端口号超出范围
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ */
+xwer_t xwssc_get_lzstat(struct xwssc * xwssc, xwu8_t port,
+                        struct xwssc_lzstat * statbuf);
+#endif
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+/**
+ * @brief 通过XWSSC输出二进制日志的参数
+ */
+struct xwssc_log_sink {
+        struct xwssc * xwssc; /**< XWSSC对象的指针 */
+        xwu8_t port; /**< 端口 */
+        xwu8_t pri; /**< 优先级 */
+        xwu8_t qos; /**< 服务质量 */
+};
+
+/**
+ * @brief XWSSC API: 二进制日志的输出函数，每批记录作为一条消息发送
+ * @param[in] arg: 指向 @ref xwssc_log_sink 的指针
+ * @param[in] data: 一批记录
+ * @param[in] size: 数据的长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -E2BIG: 数据太长
+ * @retval -ENOMEM: 帧槽被使用完
+ * @retval -EPERM: XWSSC未启动
+ * @note
+ * + 上下文：中断、中断底半部、线程
+ * @details
+ * 通过 `xwlog_bin_set_sink(xwssc_log_sink, &sink)` 设置，
+ * 远端收到的每条消息都是完整的一批记录，不需要COBS编码，
+ * 主机端可直接交给 `xwbs/util/py/xwlogdec.py` 解码。
+ *
+ * + 异步日志每批最多 `2 * XWLIBCFG_XWLOG_BUFSIZE` 字节，
+ *   不能超过 @ref XWSSC_SDU_MAX_SIZE ；
+ * + 发送失败的日志被丢弃，不重试；
+ * + 应关闭 `XWMDCFG_isc_xwssc_LOG` ，否则XWSSC自身的日志会与发送互相触发。
+ */
+xwer_t xwssc_log_sink(void * arg, const xwu8_t data[], xwsz_t size);
+#endif
+
 /**
  * @} xwmd_isc_xwssc_mif
  */
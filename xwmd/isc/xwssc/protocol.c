@@ -18,6 +18,7 @@
 #include <xwos/lib/crc32.h>
 #include <xwos/mm/bma.h>
 #include <xwos/osal/thd.h>
+#include <xwos/osal/time.h>
 #include <xwos/osal/lock/spinlock.h>
 #include <xwos/osal/lock/mtx.h>
 #include <xwos/osal/sync/sem.h>
@@ -39,12 +40,12 @@ const xwu8_t xwssc_frm_connection[] = {
         (xwu8_t)XWSSC_SOF,
         (xwu8_t)XWSSC_SOF,
         (xwu8_t)0x66, /* 帧头长度 | 长度的镜像 */
-        (xwu8_t)0x7E, /* 帧头校验和 */
+        (xwu8_t)0x0, /* 帧头校验和，发送时填充 */
         (xwu8_t)0x0, /* 端口：不使用，默认为0 */
         (xwu8_t)0x0, /* ID：不使用，默认为0 */
         ((xwu8_t)XWSSC_MSG_QOS_3 |
          (xwu8_t)XWSSC_FLAG_CONNECT), /* Qos: 可靠消息 + CRC校验码 + CONNECT */
-        (xwu8_t)0x8, /* SDU长度 */
+        (xwu8_t)XWSSC_CONN_SDUSIZE, /* SDU长度 */
         (xwu8_t)'X', /* sdu[0]: protocol 0 */
         (xwu8_t)'W', /* sdu[1]: protocol 1 */
         (xwu8_t)'S', /* sdu[2]: protocol 2 */
@@ -53,10 +54,12 @@ const xwu8_t xwssc_frm_connection[] = {
         (xwu8_t)XWSSC_VERSION_MAJOR, /* sdu[5]: major version */
         (xwu8_t)XWSSC_VERSION_MINOR, /* sdu[6]: minor version */
         (xwu8_t)XWSSC_VERSION_REVISION, /* sdu[7]: revision */
-        (xwu8_t)0x78, /* CRC32 第一字节（最高有效字节） */
-        (xwu8_t)0x59, /* CRC32 第二字节 */
-        (xwu8_t)0xB2, /* CRC32 第三字节 */
-        (xwu8_t)0x85, /* CRC32 第四字节（第低有效字节） */
+        (xwu8_t)XWSSC_WND_SIZE, /* sdu[8]: 本地的窗口大小 */
+        (xwu8_t)XWSSC_CAP, /* sdu[9]: 本地的能力标志 */
+        (xwu8_t)0, /* CRC32 第一字节（最高有效字节），发送时填充 */
+        (xwu8_t)0, /* CRC32 第二字节，发送时填充 */
+        (xwu8_t)0, /* CRC32 第三字节，发送时填充 */
+        (xwu8_t)0, /* CRC32 第四字节（第低有效字节），发送时填充 */
         (xwu8_t)XWSSC_EOF,
         (xwu8_t)XWSSC_EOF,
 };
@@ -69,13 +72,13 @@ const xwu8_t xwssc_ackfrm_connection[] = {
         (xwu8_t)XWSSC_SOF,
         (xwu8_t)XWSSC_SOF,
         (xwu8_t)0x66, /* 帧头长度 | 长度的镜像 */
-        (xwu8_t)0xFD, /* 帧头校验和 */
+        (xwu8_t)0x0, /* 帧头校验和，发送时填充 */
         (xwu8_t)0x0, /* 端口：不使用，默认为0 */
         (xwu8_t)0x0, /* ID：不使用，默认为0 */
         ((xwu8_t)XWSSC_MSG_QOS_3 |
          (xwu8_t)XWSSC_FLAG_CONNECT |
          (xwu8_t)XWSSC_FLAG_ACK), /* (可靠消息 + CRC校验码) + CONNECT + ACK */
-        (xwu8_t)0x8, /* SDU长度 */
+        (xwu8_t)XWSSC_CONN_SDUSIZE, /* SDU长度 */
         (xwu8_t)'X', /* sdu[0]: protocol 0 */
         (xwu8_t)'W', /* sdu[1]: protocol 1 */
         (xwu8_t)'S', /* sdu[2]: protocol 2 */
@@ -84,10 +87,12 @@ const xwu8_t xwssc_ackfrm_connection[] = {
         (xwu8_t)XWSSC_VERSION_MAJOR, /* sdu[5]: major version */
         (xwu8_t)XWSSC_VERSION_MINOR, /* sdu[6]: minor version */
         (xwu8_t)XWSSC_VERSION_REVISION, /* sdu[7]: revision */
-        (xwu8_t)0x78, /* CRC32 第一字节（最高有效字节） */
-        (xwu8_t)0x59, /* CRC32 第二字节 */
-        (xwu8_t)0xB2, /* CRC32 第三字节 */
-        (xwu8_t)0x85, /* CRC32 第四字节（第低有效字节） */
+        (xwu8_t)XWSSC_WND_SIZE, /* sdu[8]: 本地的窗口大小 */
+        (xwu8_t)XWSSC_CAP, /* sdu[9]: 本地的能力标志 */
+        (xwu8_t)0, /* CRC32 第一字节（最高有效字节），发送时填充 */
+        (xwu8_t)0, /* CRC32 第二字节，发送时填充 */
+        (xwu8_t)0, /* CRC32 第三字节，发送时填充 */
+        (xwu8_t)0, /* CRC32 第四字节（第低有效字节），发送时填充 */
         (xwu8_t)XWSSC_EOF,
         (xwu8_t)XWSSC_EOF,
 };
@@ -115,6 +120,38 @@ const xwu8_t xwssc_ackfrm_sdu[] = {
         (xwu8_t)XWSSC_EOF,
 };
 
+/**
+ * @brief 选择性应答帧模板
+ * @note
+ * + 只在协商的窗口大小大于1时使用：
+ *   + ID：累积应答，此ID及之前的所有帧都已收到
+ *   + sdu[1:4]：选择性应答位图（最高有效字节在前），
+ *     位 `i` 表示ID为 `(ID + 2 + i)` 的帧已收到
+ */
+static __xwmd_rodata
+const xwu8_t xwssc_ackfrm_sack[] = {
+        (xwu8_t)XWSSC_SOF,
+        (xwu8_t)XWSSC_SOF,
+        (xwu8_t)0x66, /* 帧头长度 | mirror */
+        (xwu8_t)0x0, /* 帧头校验和，依据实际情况填充 */
+        (xwu8_t)0x0, /* 端口，依据实际情况填充 */
+        (xwu8_t)0x0, /* ID，依据实际情况填充 */
+        ((xwu8_t)XWSSC_MSG_QOS_3 |
+         (xwu8_t)XWSSC_FLAG_ACK), /* (可靠消息 + CRC校验码) + ACK */
+        (xwu8_t)XWSSC_SACK_SDUSIZE, /* SDU长度 */
+        (xwu8_t)0, /* sdu[0]: 应答，依据实际情况填充 */
+        (xwu8_t)0, /* sdu[1]: 选择性应答位图 第一字节（最高有效字节） */
+        (xwu8_t)0, /* sdu[2]: 选择性应答位图 第二字节 */
+        (xwu8_t)0, /* sdu[3]: 选择性应答位图 第三字节 */
+        (xwu8_t)0, /* sdu[4]: 选择性应答位图 第四字节（最低有效字节） */
+        (xwu8_t)0, /* CRC32 第一字节（最高有效字节），依据实际情况填充 */
+        (xwu8_t)0, /* CRC32 第二字节，依据实际情况填充 */
+        (xwu8_t)0, /* CRC32 第三字节，依据实际情况填充 */
+        (xwu8_t)0, /* CRC32 第四字节（第低有效字节），依据实际情况填充 */
+        (xwu8_t)XWSSC_EOF,
+        (xwu8_t)XWSSC_EOF,
+};
+
 /**
  * @brief 应答错误对照表
  */
@@ -139,23 +176,41 @@ const xwu8_t xwssc_ecsdusz_shift_table[] = {
 static __xwmd_code
 xwer_t xwssc_chk_frm(struct xwssc_frm * frm, xwsz_t sdusize);
 
+static __xwmd_code
+void xwssc_fill_frm(struct xwssc_frm * frm, xwsz_t sdusize);
+
+static __xwmd_code
+xwu8_t xwssc_nego_wnd(xwu8_t * sdupos, xwsz_t sdusize);
+
+static __xwmd_code
+xwu8_t xwssc_nego_cap(xwu8_t * sdupos, xwsz_t sdusize);
+
 static __xwmd_code
 void xwssc_rxq_pub(struct xwssc * xwssc,
                    union xwssc_slot * slot,
                    xwu8_t port);
 
 static __xwmd_code
-xwer_t xwssc_rx_connection(struct xwssc * xwssc, struct xwssc_frm * frm);
+xwer_t xwssc_rx_connection(struct xwssc * xwssc, struct xwssc_frm * frm,
+                           xwsz_t sdusize);
 
 static __xwmd_code
-xwer_t xwssc_rx_ack_connection(struct xwssc * xwssc, struct xwssc_frm * frm);
+xwer_t xwssc_rx_ack_connection(struct xwssc * xwssc, struct xwssc_frm * frm,
+                               xwsz_t sdusize);
 
 static __xwmd_code
 xwer_t xwssc_rx_sdu(struct xwssc * xwssc, union xwssc_slot * slot);
 
+static __xwmd_code
+xwer_t xwssc_rx_sdu_wnd(struct xwssc * xwssc, union xwssc_slot * slot);
+
 static __xwmd_code
 xwer_t xwssc_rx_ack_sdu(struct xwssc * xwssc, struct xwssc_frm * frm);
 
+static __xwmd_code
+xwer_t xwssc_rx_sack_sdu(struct xwssc * xwssc, struct xwssc_frm * frm,
+                         xwsz_t sdusize);
+
 static __xwmd_code
 xwer_t xwssc_rxfsm(struct xwssc * xwssc);
 
@@ -171,6 +226,25 @@ xwer_t xwssc_tx_connection(struct xwssc * xwssc);
 static __xwmd_code
 xwer_t xwssc_tx_ack_connection(struct xwssc * xwssc);
 
+static __xwmd_code
+xwer_t xwssc_tx_sack_sdu(struct xwssc * xwssc, xwu8_t port, xwu8_t ack);
+
+static __xwmd_code
+xwer_t xwssc_txq_slot_alloc(struct xwssc * xwssc, xwsz_t need,
+                            union xwssc_slot ** slotbuf);
+
+static __xwmd_code
+xwer_t xwssc_tx_slot(struct xwssc * xwssc, union xwssc_slot * slot);
+
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+static __xwmd_code
+void xwssc_tx_lz_rewrite(union xwssc_slot * slot,
+                         const xwu8_t sdu[], xwsz_t sdusize, xwu8_t qos);
+#endif
+
+static __xwmd_code
+void xwssc_tx_lz(struct xwssc * xwssc, union xwssc_slot * slot);
+
 static __xwmd_code
 xwer_t xwssc_connect(struct xwssc * xwssc);
 
@@ -180,6 +254,30 @@ void xwssc_finish_tx(struct xwssc * xwssc, struct xwssc_carrier * car);
 static __xwmd_code
 xwer_t xwssc_tx_frm(struct xwssc * xwssc, struct xwssc_carrier * car);
 
+static __xwmd_code
+void xwssc_txq_finish(struct xwssc * xwssc, struct xwssc_carrier * car, xwer_t rc);
+
+static __xwmd_code
+void xwssc_txwnd_swtcb(struct xwos_swt * swt, void * arg);
+
+static __xwmd_code
+void xwssc_txwnd_arm(struct xwssc_txwnd_slot * ws);
+
+static __xwmd_code
+void xwssc_txwnd_complete(struct xwssc * xwssc);
+
+static __xwmd_code
+xwer_t xwssc_txwnd_retransmit(struct xwssc * xwssc);
+
+static __xwmd_code
+xwer_t xwssc_txwnd_fill(struct xwssc * xwssc);
+
+static __xwmd_code
+void xwssc_txwnd_flush(struct xwssc * xwssc);
+
+static __xwmd_code
+xwer_t xwssc_txfsm_wnd(struct xwssc * xwssc);
+
 static __xwmd_code
 xwer_t xwssc_txfsm(struct xwssc * xwssc);
 
@@ -343,24 +441,115 @@ xwer_t xwssc_chk_frm(struct xwssc_frm * frm, xwsz_t sdusize)
         return rc;
 }
 
+/**
+ * @brief 填充帧头校验和与数据的CRC32校验码
+ * @param[in] frm: 消息帧的指针
+ * @param[in] sdusize: 数据长度
+ */
+static __xwmd_code
+void xwssc_fill_frm(struct xwssc_frm * frm, xwsz_t sdusize)
+{
+        xwu8_t * sdupos;
+        xwu8_t * crc32pos;
+        xwsz_t calsz;
+        xwu32_t crc32;
+
+        frm->head.chksum = 0; /* 计算前先填0 */
+        calsz = XWSSC_FRMHEAD_SIZE(frm->head.headsize);
+        frm->head.chksum = xwssc_cal_head_chksum((xwu8_t *)&frm->head, calsz);
+        sdupos = XWSSC_SDUPOS(&frm->head);
+        crc32pos = &sdupos[sdusize];
+        calsz = sdusize;
+        crc32 = xwlib_crc32_calms(sdupos, &calsz);
+        crc32pos[0] = (xwu8_t)((crc32 >> (xwu32_t)24) & (xwu32_t)0xFF);
+        crc32pos[1] = (xwu8_t)((crc32 >> (xwu32_t)16) & (xwu32_t)0xFF);
+        crc32pos[2] = (xwu8_t)((crc32 >> (xwu32_t)8) & (xwu32_t)0xFF);
+        crc32pos[3] = (xwu8_t)((crc32 >> (xwu32_t)0) & (xwu32_t)0xFF);
+}
+
+/**
+ * @brief 依据远端连接帧中的窗口大小协商窗口大小
+ * @param[in] sdupos: 连接帧的数据
+ * @param[in] sdusize: 连接帧的数据长度
+ * @return 协商后的窗口大小
+ * @note
+ * + 版本1.0.0的连接帧没有窗口大小，只能使用停等模式，窗口大小为1；
+ * + 双方取较小的窗口大小。
+ */
+static __xwmd_code
+xwu8_t xwssc_nego_wnd(xwu8_t * sdupos, xwsz_t sdusize)
+{
+        xwu8_t wnd;
+
+        if (sdusize < XWSSC_CONN_SDUSIZE_V2) {
+                wnd = 1;
+        } else {
+                wnd = sdupos[XWSSC_CONN_SDUSIZE_V1];
+                if ((xwu8_t)0 == wnd) {
+                        wnd = 1;
+                } else if (wnd > (xwu8_t)XWSSC_WND_SIZE) {
+                        wnd = (xwu8_t)XWSSC_WND_SIZE;
+                } else {
+                        wnd = (xwu8_t)(1U << (xwu8_t)xwbop_fls(xwu8_t, wnd));
+                }
+        }
+        return wnd;
+}
+
+/**
+ * @brief 依据远端连接帧中的能力标志协商链路的能力
+ * @param[in] sdupos: 连接帧的数据
+ * @param[in] sdusize: 连接帧的数据长度
+ * @return 双方都支持的能力标志
+ * @note
+ * + 版本1.0.1及之前的连接帧没有能力标志，不支持任何扩展能力。
+ */
+static __xwmd_code
+xwu8_t xwssc_nego_cap(xwu8_t * sdupos, xwsz_t sdusize)
+{
+        xwu8_t cap;
+
+        if (sdusize < XWSSC_CONN_SDUSIZE) {
+                cap = 0;
+        } else {
+                cap = sdupos[XWSSC_CONN_SDUSIZE_V2] & XWSSC_CAP;
+        }
+        return cap;
+}
+
 /**
  * @brief 发布数据帧到接收队列
  * @param[in] xwssc: XWSSC对象的指针
  * @param[in] slot: 待发布的帧槽指针
  * @param[in] port: 端口值
+ * @note
+ * + 端口设置了接收回调函数时，直接调用回调函数并转交帧槽的所有权，
+ *   不放入接收队列。
  */
 static __xwmd_code
 void xwssc_rxq_pub(struct xwssc * xwssc,
                    union xwssc_slot * slot,
                    xwu8_t port)
 {
+        xwssc_rxcb_f cb;
+        void * arg;
+        xwreg_t cpuirq;
+
         xwssclogf(xwssc, D,
                   "[R][RX][SDU] Publish slot::0x%lX, port:0x%X, frmsize:0x%u\r\n",
                   (xwptr_t)slot, port, slot->rx.frmsize);
-        xwos_splk_lock(&xwssc->rxq.lock[port]);
-        xwlib_bclst_add_tail(&xwssc->rxq.q[port], &slot->rx.node);
-        xwos_splk_unlock(&xwssc->rxq.lock[port]);
-        xwos_sem_post(&xwssc->rxq.sem[port]);
+        xwos_splk_lock_cpuirqsv(&xwssc->rxq.lock[port], &cpuirq);
+        cb = xwssc->rxq.ntf[port].cb;
+        arg = xwssc->rxq.ntf[port].arg;
+        if (NULL == cb) {
+                xwlib_bclst_add_tail(&xwssc->rxq.q[port], &slot->rx.node);
+        }
+        xwos_splk_unlock_cpuirqrs(&xwssc->rxq.lock[port], cpuirq);
+        if (NULL == cb) {
+                xwos_sem_post(&xwssc->rxq.sem[port]);
+        } else {
+                cb(xwssc, port, (xwssc_rxh_t)slot, arg);
+        }
 }
 
 /**
@@ -384,14 +573,37 @@ union xwssc_slot * xwssc_rxq_choose(struct xwssc * xwssc, xwu8_t port)
         return slot;
 }
 
+/**
+ * @brief 释放接收窗口中缓存的乱序帧
+ * @param[in] xwssc: XWSSC对象的指针
+ */
+__xwmd_code
+void xwssc_rxwnd_flush(struct xwssc * xwssc)
+{
+        xwsq_t i;
+
+        for (i = 0; i < XWSSC_WND_SIZE; i++) {
+                if (NULL != xwssc->rxq.wnd.ooo[i]) {
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        xwmm_bma_free(xwssc->mempool, xwssc->rxq.wnd.ooo[i]);
+                        xwssc->rxq.wnd.ooo[i] = NULL;
+                }
+        }
+}
+
 /**
  * @brief 接收同步帧
  * @param[in] xwssc: XWSSC对象的指针
  * @param[in] frm: 消息帧
+ * @param[in] sdusize: 数据长度
  * @return 错误码
+ * @note
+ * + 接收窗口的大小由远端连接帧中的窗口大小协商得到，
+ *   远端为版本1.0.0时，接收窗口大小为1，使用停等模式。
  */
 static __xwmd_code
-xwer_t xwssc_rx_connection(struct xwssc * xwssc, struct xwssc_frm * frm)
+xwer_t xwssc_rx_connection(struct xwssc * xwssc, struct xwssc_frm * frm,
+                           xwsz_t sdusize)
 {
         xwu8_t * sdupos;
         xwer_t rc;
@@ -411,6 +623,8 @@ xwer_t xwssc_rx_connection(struct xwssc * xwssc, struct xwssc_frm * frm)
             (XWSSC_VERSION_MINOR == sdupos[6])) {
                 rc = xwssc_tx_ack_connection(xwssc);
                 if (XWOK == rc) {
+                        xwssc_rxwnd_flush(xwssc);
+                        xwssc->rxq.wnd.size = xwssc_nego_wnd(sdupos, sdusize);
                         xwaop_write(xwu32_t, &xwssc->rxq.cnt, 0, NULL);
                 }
         } else {
@@ -423,10 +637,16 @@ xwer_t xwssc_rx_connection(struct xwssc * xwssc, struct xwssc_frm * frm)
  * @brief 接收同步应答帧
  * @param[in] xwssc: XWSSC对象的指针
  * @param[in] frm: 消息帧
+ * @param[in] sdusize: 数据长度
  * @return 错误码
+ * @note
+ * + 发送窗口的大小由远端连接应答帧中的窗口大小协商得到，
+ *   远端为版本1.0.0时，发送窗口大小为1，使用停等模式；
+ * + 远端的能力标志决定发送时能否压缩数据。
  */
 static __xwmd_code
-xwer_t xwssc_rx_ack_connection(struct xwssc * xwssc, struct xwssc_frm * frm)
+xwer_t xwssc_rx_ack_connection(struct xwssc * xwssc, struct xwssc_frm * frm,
+                               xwsz_t sdusize)
 {
         xwu8_t * sdupos;
         xwsq_t hwifst;
@@ -446,7 +666,13 @@ xwer_t xwssc_rx_ack_connection(struct xwssc * xwssc, struct xwssc_frm * frm)
                 if ((0 == strcmp(proto, "XWSSC")) &&
                     (XWSSC_VERSION_MAJOR == sdupos[5]) &&
                     (XWSSC_VERSION_MINOR == sdupos[6])) {
+                        xwssc->txq.wnd.size = xwssc_nego_wnd(sdupos, sdusize);
+                        xwssc->txq.wnd.next = 0;
+                        xwssc->txq.rmtcap = xwssc_nego_cap(sdupos, sdusize);
                         xwaop_write(xwu32_t, &xwssc->txq.cnt, 0, NULL);
+                        xwssclogf(xwssc, I,
+                                  "[R][RX][CONNACK] TX window:%d, capability:0x%X\r\n",
+                                  xwssc->txq.wnd.size, xwssc->txq.rmtcap);
                         xwaop_s1m(xwsq_t, &xwssc->hwifst, XWSSC_HWIFST_CONNECT,
                                   NULL, NULL);
                         xwssc_hwifal_notify(xwssc, XWSSC_HWIFNTF_CONNECT);
@@ -498,7 +724,12 @@ xwer_t xwssc_rx_sdu(struct xwssc * xwssc, union xwssc_slot * slot)
                   "Remote ID:0x%X, Local ID:0x%X, Rx counter:0x%X\r\n",
                   (xwptr_t)slot,
                   port, qos, slot->rx.frmsize, rmtid, lclid, rxcnt);
-        if ((xwu8_t)0 != (qos & (xwu8_t)XWSSC_MSG_QOS_RELIABLE_MSK)) {
+        if ((xwu8_t)0 == (qos & (xwu8_t)XWSSC_MSG_QOS_RELIABLE_MSK)) {
+                xwssc_rxq_pub(xwssc, slot, port);
+                rc = XWOK;
+        } else if (xwssc->rxq.wnd.size > (xwu8_t)1) {
+                rc = xwssc_rx_sdu_wnd(xwssc, slot);
+        } else {
                 if (rmtid == lclid) {
                         /* 收到数据 */
                         rc = xwssc_tx_ack_sdu(xwssc, port, rmtid, XWSSC_ACK_OK);
@@ -515,10 +746,82 @@ xwer_t xwssc_rx_sdu(struct xwssc * xwssc, union xwssc_slot * slot)
                         xwssc_tx_ack_sdu(xwssc, port, rmtid, XWSSC_ACK_ECONNRESET);
                         rc = -ECONNRESET;
                 }
-        } else {
+        }
+        return rc;
+}
+
+/**
+ * @brief 以滑动窗口模式接收可靠的数据帧
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] slot: 接收到的帧槽指针
+ * @return 错误码
+ * @note
+ * + 以期望的ID为起点，距离为 `d` 的帧：
+ *   + `d == 0` ：发布此帧，以及缓存中紧随其后的连续的乱序帧；
+ *   + `0 < d < 窗口大小` ：缓存为乱序帧；
+ *   + 落后于期望的ID不超过窗口大小：重复的帧；
+ *   + 其他：连接被复位。
+ * + 除连接被复位外，都回复当前的累积应答与选择性应答位图。
+ */
+static __xwmd_code
+xwer_t xwssc_rx_sdu_wnd(struct xwssc * xwssc, union xwssc_slot * slot)
+{
+        union xwssc_slot * ooo;
+        xwu32_t rxcnt;
+        xwu8_t rmtid;
+        xwu8_t lclid;
+        xwu8_t dist;
+        xwu8_t port;
+        xwsq_t idx;
+        xwer_t rc;
+
+        xwaop_read(xwu32_t, &xwssc->rxq.cnt, &rxcnt);
+        lclid = XWSSC_ID(rxcnt);
+        rmtid = slot->rx.frm.head.id;
+        port = slot->rx.frm.head.port;
+        dist = XWSSC_ID(rmtid - lclid);
+        if ((xwu8_t)0 == dist) {
+                /* 收到期望的数据 */
                 xwssc_rxq_pub(xwssc, slot, port);
+                rxcnt++;
+                idx = XWSSC_WND_IDX(rxcnt);
+                ooo = xwssc->rxq.wnd.ooo[idx];
+                while (NULL != ooo) {
+                        xwssc->rxq.wnd.ooo[idx] = NULL;
+                        xwssc_rxq_pub(xwssc, ooo, ooo->rx.frm.head.port);
+                        rxcnt++;
+                        idx = XWSSC_WND_IDX(rxcnt);
+                        ooo = xwssc->rxq.wnd.ooo[idx];
+                }
+                xwaop_write(xwu32_t, &xwssc->rxq.cnt, rxcnt, NULL);
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwssc_tx_sack_sdu(xwssc, port, XWSSC_ACK_OK);
                 rc = XWOK;
+        } else if (dist < xwssc->rxq.wnd.size) {
+                /* 收到乱序的数据 */
+                idx = XWSSC_WND_IDX(rxcnt + (xwu32_t)dist);
+                if (NULL == xwssc->rxq.wnd.ooo[idx]) {
+                        xwssc->rxq.wnd.ooo[idx] = slot;
+                        rc = XWOK;
+                } else {
+                        rc = -EALREADY;
+                }
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwssc_tx_sack_sdu(xwssc, port, XWSSC_ACK_OK);
+        } else if (XWSSC_ID(lclid - rmtid) <= xwssc->rxq.wnd.size) {
+                /* 收到重复的数据 */
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwssc_tx_sack_sdu(xwssc, port, XWSSC_ACK_OK);
+                rc = -EALREADY;
+        } else {
+                /* 连接被复位 */
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwssc_tx_sack_sdu(xwssc, port, XWSSC_ACK_ECONNRESET);
+                rc = -ECONNRESET;
         }
+        xwssclogf(xwssc, D,
+                  "[R][RX][SDU] Remote ID:0x%X, Local ID:0x%X, rc:%d\r\n",
+                  rmtid, lclid, rc);
         return rc;
 }
 
@@ -561,6 +864,82 @@ err_mtx_lock:
         return rc;
 }
 
+/**
+ * @brief 以滑动窗口模式接收数据应答帧
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] frm: 消息帧
+ * @param[in] sdusize: 数据长度
+ * @return 错误码
+ * @note
+ * + 累积应答与选择性应答只标记发送窗口中已被确认的帧，
+ *   由发送线程完成这些帧的通知与释放；
+ * + 远端复位后可能回复停等模式的应答帧，只处理其中的 `XWSSC_ACK_ECONNRESET` 。
+ */
+static __xwmd_code
+xwer_t xwssc_rx_sack_sdu(struct xwssc * xwssc, struct xwssc_frm * frm,
+                         xwsz_t sdusize)
+{
+        xwu8_t * sdupos;
+        xwu32_t sack;
+        xwu32_t base;
+        xwu32_t inflight;
+        xwu32_t i;
+        xwu8_t cumid;
+        xwu8_t dist;
+        xwu8_t ack;
+        xwer_t rc;
+
+        sdupos = XWSSC_SDUPOS(&frm->head);
+        cumid = XWSSC_ID(frm->head.id);
+        ack = sdupos[0];
+        xwssclogf(xwssc, D, "[R][SACK] ID:0x%X, ACK:0x%X\r\n", cumid, ack);
+        rc = xwos_mtx_lock(&xwssc->txq.csmtx);
+        if (rc < 0) {
+                goto err_mtx_lock;
+        }
+        if ((xwu8_t)XWSSC_ACK_ECONNRESET == ack) {
+                xwssclogf(xwssc, W, "[R][SACK] Link has been severed!\r\n");
+                xwaop_c0m(xwsq_t, &xwssc->hwifst, XWSSC_HWIFST_CONNECT, NULL, NULL);
+        } else if (XWSSC_SACK_SDUSIZE == sdusize) {
+                if ((xwu8_t)XWSSC_ACK_NOMEM == ack) {
+                        xwssclogf(xwssc, W, "[R][SACK] Remote has no memory!\r\n");
+                }
+                sack = ((xwu32_t)sdupos[1] << (xwu32_t)24) |
+                       ((xwu32_t)sdupos[2] << (xwu32_t)16) |
+                       ((xwu32_t)sdupos[3] << (xwu32_t)8) |
+                       ((xwu32_t)sdupos[4] << (xwu32_t)0);
+                xwaop_read(xwu32_t, &xwssc->txq.cnt, &base);
+                inflight = xwssc->txq.wnd.next - base;
+                /* 累积应答 */
+                dist = XWSSC_ID((xwu32_t)cumid - base);
+                if ((xwu32_t)dist < inflight) {
+                        for (i = 0; i <= (xwu32_t)dist; i++) {
+                                xwssc->txq.wnd.ackbmp |=
+                                        ((xwu32_t)1 << XWSSC_WND_IDX(base + i));
+                        }
+                }
+                /* 选择性应答 */
+                for (i = 0; (xwu32_t)0 != sack; i++) {
+                        if ((xwu32_t)0 != (sack & (xwu32_t)1)) {
+                                dist = XWSSC_ID((xwu32_t)cumid + (xwu32_t)2 + i - base);
+                                if ((xwu32_t)dist < inflight) {
+                                        xwssc->txq.wnd.ackbmp |=
+                                                ((xwu32_t)1 <<
+                                                 XWSSC_WND_IDX(base + (xwu32_t)dist));
+                                }
+                        }
+                        sack >>= (xwu32_t)1;
+                }
+        } else {
+                rc = -ENOMSG;
+        }
+        xwos_mtx_unlock(&xwssc->txq.csmtx);
+        xwos_sem_post(&xwssc->txq.wnd.sem); // cppcheck-suppress [misra-c2012-17.7]
+
+err_mtx_lock:
+        return rc;
+}
+
 /**
  * @brief XWSSC的接收线程状态机
  * @param[in] xwssc: XWSSC对象的指针
@@ -611,10 +990,18 @@ xwer_t xwssc_rxfsm(struct xwssc * xwssc)
                 /* 申请用于接收数据的帧槽 */
                 rc = xwmm_bma_alloc(xwssc->mempool, (xwsq_t)odr, &mem.raw);
                 if (rc < 0) {
-                        // cppcheck-suppress [misra-c2012-17.7]
-                        xwssc_tx_ack_sdu(xwssc,
-                                         stream.frm.head.port, stream.frm.head.id,
-                                         XWSSC_ACK_NOMEM);
+                        if (xwssc->rxq.wnd.size <= (xwu8_t)1) {
+                                // cppcheck-suppress [misra-c2012-17.7]
+                                xwssc_tx_ack_sdu(xwssc,
+                                                 stream.frm.head.port,
+                                                 stream.frm.head.id,
+                                                 XWSSC_ACK_NOMEM);
+                        } else if ((xwu8_t)0 !=
+                                   (qos & (xwu8_t)XWSSC_MSG_QOS_RELIABLE_MSK)) {
+                                // cppcheck-suppress [misra-c2012-17.7]
+                                xwssc_tx_sack_sdu(xwssc, stream.frm.head.port,
+                                                  XWSSC_ACK_NOMEM);
+                        }
                         goto err_bma_alloc;
                 }
                 /* 初始化帧槽 */
@@ -659,10 +1046,13 @@ xwer_t xwssc_rxfsm(struct xwssc * xwssc)
                 /* 处理消息 */
                 if ((xwu8_t)0 != ((xwu8_t)XWSSC_FLAG_CONNECT & qos)) {
                         if ((xwu8_t)0 != ((xwu8_t)XWSSC_FLAG_ACK & qos)) {
-                                rc = xwssc_rx_ack_connection(xwssc, &stream.frm);
+                                rc = xwssc_rx_ack_connection(xwssc, &stream.frm,
+                                                             sdusize);
                         } else {
-                                rc = xwssc_rx_connection(xwssc, &stream.frm);
+                                rc = xwssc_rx_connection(xwssc, &stream.frm, sdusize);
                         }
+                } else if (xwssc->txq.wnd.size > (xwu8_t)1) {
+                        rc = xwssc_rx_sack_sdu(xwssc, &stream.frm, sdusize);
                 } else {
                         rc = xwssc_rx_ack_sdu(xwssc, &stream.frm);
                 }
@@ -713,6 +1103,7 @@ xwer_t xwssc_rxthd(struct xwssc * xwssc)
                 case XWOK:
                         break;
                 case -EAGAIN:
+                        xwaop_add(xwsq_t, &xwssc->stat.rxerr, 1, NULL, NULL);
                         xwssclogf(xwssc, W,
                                   "[R] Data stream error! Wait for SOF.\r\n");
                         break;
@@ -727,6 +1118,7 @@ xwer_t xwssc_rxthd(struct xwssc * xwssc)
                         xwssclogf(xwssc, D, "[R] No Memory\r\n");
                         break;
                 case -EBADMSG:
+                        xwaop_add(xwsq_t, &xwssc->stat.rxerr, 1, NULL, NULL);
                         xwssclogf(xwssc, W, "[R] Bad Message Frame!\r\n");
                         break;
                 case -EPERM:
@@ -858,14 +1250,16 @@ struct xwssc_carrier * xwssc_txq_choose(struct xwssc * xwssc)
 static __xwmd_code
 xwer_t xwssc_tx_connection(struct xwssc * xwssc)
 {
+        xwu8_t stream[sizeof(xwssc_frm_connection)];
         xwer_t rc;
 
         xwssclogf(xwssc, D, "[T][TX][CONN] Connecting ...\r\n");
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(stream, xwssc_frm_connection, sizeof(xwssc_frm_connection));
+        xwssc_fill_frm((struct xwssc_frm *)stream, XWSSC_CONN_SDUSIZE);
         rc = xwos_mtx_lock(&xwssc->txq.csmtx);
         if (XWOK == rc) {
-                rc = xwssc_hwifal_tx(xwssc,
-                                     xwssc_frm_connection,
-                                     sizeof(xwssc_frm_connection));
+                rc = xwssc_hwifal_tx(xwssc, stream, sizeof(xwssc_frm_connection));
                 xwos_mtx_unlock(&xwssc->txq.csmtx);
         }
         return rc;
@@ -880,14 +1274,16 @@ xwer_t xwssc_tx_connection(struct xwssc * xwssc)
 static __xwmd_code
 xwer_t xwssc_tx_ack_connection(struct xwssc * xwssc)
 {
+        xwu8_t stream[sizeof(xwssc_ackfrm_connection)];
         xwer_t rc;
 
         xwssclogf(xwssc, D, "[R][TX][CONNACK] Connecting ...\r\n");
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(stream, xwssc_ackfrm_connection, sizeof(xwssc_ackfrm_connection));
+        xwssc_fill_frm((struct xwssc_frm *)stream, XWSSC_CONN_SDUSIZE);
         rc = xwos_mtx_lock(&xwssc->txq.csmtx);
         if (XWOK == rc) {
-                rc = xwssc_hwifal_tx(xwssc,
-                                     xwssc_ackfrm_connection,
-                                     sizeof(xwssc_ackfrm_connection));
+                rc = xwssc_hwifal_tx(xwssc, stream, sizeof(xwssc_ackfrm_connection));
                 xwos_mtx_unlock(&xwssc->txq.csmtx);
         }
         return rc;
@@ -942,6 +1338,77 @@ xwer_t xwssc_tx_ack_sdu(struct xwssc * xwssc, xwu8_t port, xwu8_t id, xwu8_t ack
         return rc;
 }
 
+/**
+ * @brief 发送选择性应答帧
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] port: 端口
+ * @param[in] ack: 应答
+ * @return 错误码
+ * @note
+ * + 累积应答的ID与选择性应答位图都由接收窗口的当前状态生成。
+ */
+static __xwmd_code
+xwer_t xwssc_tx_sack_sdu(struct xwssc * xwssc, xwu8_t port, xwu8_t ack)
+{
+        xwu8_t stream[sizeof(xwssc_ackfrm_sack)];
+        struct xwssc_frm * frm;
+        xwu8_t * sdupos;
+        xwu32_t rxcnt;
+        xwu32_t sack;
+        xwu32_t i;
+        xwer_t rc;
+
+        xwaop_read(xwu32_t, &xwssc->rxq.cnt, &rxcnt);
+        sack = 0;
+        for (i = 1; i < (xwu32_t)xwssc->rxq.wnd.size; i++) {
+                if (NULL != xwssc->rxq.wnd.ooo[XWSSC_WND_IDX(rxcnt + i)]) {
+                        sack |= ((xwu32_t)1 << (i - (xwu32_t)1));
+                }
+        }
+        xwssclogf(xwssc, D, "[R][TX][SACK] ACK:0x%X, ID:0x%X, SACK:0x%X\r\n",
+                  ack, XWSSC_ID(rxcnt - (xwu32_t)1), sack);
+        frm = (struct xwssc_frm *)stream;
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(stream, xwssc_ackfrm_sack, sizeof(xwssc_ackfrm_sack));
+        frm->head.port = port;
+        frm->head.id = XWSSC_ID(rxcnt - (xwu32_t)1);
+        sdupos = XWSSC_SDUPOS(&frm->head);
+        sdupos[0] = ack;
+        sdupos[1] = (xwu8_t)((sack >> (xwu32_t)24) & (xwu32_t)0xFF);
+        sdupos[2] = (xwu8_t)((sack >> (xwu32_t)16) & (xwu32_t)0xFF);
+        sdupos[3] = (xwu8_t)((sack >> (xwu32_t)8) & (xwu32_t)0xFF);
+        sdupos[4] = (xwu8_t)((sack >> (xwu32_t)0) & (xwu32_t)0xFF);
+        xwssc_fill_frm(frm, XWSSC_SACK_SDUSIZE);
+        rc = xwos_mtx_lock(&xwssc->txq.csmtx);
+        if (XWOK == rc) {
+                rc = xwssc_hwifal_tx(xwssc, stream, sizeof(xwssc_ackfrm_sack));
+                xwos_mtx_unlock(&xwssc->txq.csmtx);
+        }
+        return rc;
+}
+
+/**
+ * @brief 从内存池中申请帧槽
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] need: 需要的内存大小
+ * @param[out] slotbuf: 指向缓冲区的指针，通过此缓冲区返回帧槽
+ * @return 错误码
+ */
+static __xwmd_code
+xwer_t xwssc_txq_slot_alloc(struct xwssc * xwssc, xwsz_t need,
+                            union xwssc_slot ** slotbuf)
+{
+        xwsz_t neednum;
+        xwssq_t odr;
+
+        neednum = XWBOP_DIV_ROUND_UP(need, XWSSC_MEMBLK_SIZE);
+        odr = xwbop_fls(xwsz_t, neednum);
+        if ((odr < 0) || ((XWSSC_MEMBLK_SIZE << (xwsz_t)odr) < need)) {
+                odr++;
+        }
+        return xwmm_bma_alloc(xwssc->mempool, (xwsq_t)odr, (void **)slotbuf);
+}
+
 /**
  * @brief 格式化数据帧并加入到发送队列
  * @param[in] xwssc: XWSSC对象的指针
@@ -988,8 +1455,6 @@ xwer_t xwssc_eq_msg(struct xwssc * xwssc,
         struct xwssc_carrier * car;
         union xwssc_slot * slot;
         xwsz_t need;
-        xwsz_t neednum;
-        xwssq_t odr;
         xwu8_t * sdupos;
         xwu8_t * crc32pos;
         xwsz_t calsz;
@@ -1008,12 +1473,7 @@ xwer_t xwssc_eq_msg(struct xwssc * xwssc,
         xwssc_encode_sdusize(sdusize, ecsdusz, &ecsize);
         need = sizeof(union xwssc_slot) + ecsize + sdusize +
                XWSSC_CRC32_SIZE + XWSSC_EOF_SIZE;
-        neednum = XWBOP_DIV_ROUND_UP(need, XWSSC_MEMBLK_SIZE);
-        odr = xwbop_fls(xwsz_t, neednum);
-        if ((odr < 0) || ((XWSSC_MEMBLK_SIZE << (xwsz_t)odr) < need)) {
-                odr++;
-        }
-        rc = xwmm_bma_alloc(xwssc->mempool, (xwsq_t)odr, (void **)&slot);
+        rc = xwssc_txq_slot_alloc(xwssc, need, &slot);
         if (rc < 0) {
                 goto err_bma_alloc;
         }
@@ -1024,6 +1484,8 @@ xwer_t xwssc_eq_msg(struct xwssc * xwssc,
         slot->tx.cbarg = cbarg;
         slot->tx.frmsize = sizeof(struct xwssc_frm) + ecsize + sdusize +
                            XWSSC_CRC32_SIZE + XWSSC_EOF_SIZE;
+        slot->tx.iovcnt = 0;
+        slot->tx.iov = NULL;
 
         xwssclogf(xwssc, D,
                   "[A][EQ] car(0x%lX), slot(0x%lX), "
@@ -1069,6 +1531,7 @@ xwer_t xwssc_eq_msg(struct xwssc * xwssc,
         /* 加入到发送队列 */
         xwssc_txq_add_tail(xwssc, car);
         xwos_sem_post(&xwssc->txq.qsem);
+        xwos_sem_post(&xwssc->txq.wnd.sem); // cppcheck-suppress [misra-c2012-17.7]
 
         if (NULL != txhbuf) {
                 *txhbuf = (xwssc_txh_t)car;
@@ -1082,11 +1545,358 @@ err_car_alloc:
 }
 
 /**
- * @brief 连接远端
+ * @brief 格式化聚集发送的数据帧并加入到发送队列
  * @param[in] xwssc: XWSSC对象的指针
- * @return 错误码
- */
-static __xwmd_code
+ * @param[in] iov: 数据段数组
+ * @param[in] iovcnt: 数据段的数量
+ * @param[in] sdusize: 所有数据段的总长度
+ * @param[in] pri: 优先级
+ * @param[in] port: 端口
+ * @param[in] qos: 服务质量
+ * @param[in] ntfcb: 通知发送结果的回调函数
+ * @param[in] cbarg: 调用回调函数时的用户数据
+ * @param[out] txhbuf: 指向缓冲区的指针，通过此缓冲区返回发送句柄
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENOMEM: 内存不足
+ * @note
+ * + 帧槽中的布局：
+ *   + SOF、帧头与编码的数据长度：聚集发送的第一个数据段
+ *   + CRC32与EOF：聚集发送的最后一个数据段
+ *   + 对齐后的数据段数组：帧头、用户的数据段、帧尾
+ * + 在线路上，帧的格式与 `xwssc_eq_msg()` 完全相同。
+ */
+__xwmd_code
+xwer_t xwssc_eq_msgv(struct xwssc * xwssc,
+                     const struct xwssc_iovec iov[], xwsz_t iovcnt, xwsz_t sdusize,
+                     xwu8_t pri, xwu8_t port, xwu8_t qos,
+                     xwssc_ntf_f ntfcb, void * cbarg,
+                     xwssc_txh_t * txhbuf)
+{
+        xwu8_t ecsdusz[sizeof(xwsz_t) << 1];
+        xwu8_t ecsize;
+        xwu8_t frmheadsz;
+        xwu8_t frmheadszmir;
+        struct xwssc_carrier * car;
+        union xwssc_slot * slot;
+        xwsz_t need;
+        xwu8_t * crc32pos;
+        xwptr_t iovpos;
+        struct xwlib_crc32_ctx crc32ctx;
+        xwsz_t i;
+        xwu32_t crc32;
+        xwer_t rc;
+
+        /* 申请发送装置 */
+        car = xwssc_txq_carrier_alloc(xwssc);
+        if (NULL == car) {
+                rc = -ENOMEM;
+                goto err_car_alloc;
+        }
+        car->pri = pri;
+
+        /* 申请帧槽：数据段不拷贝，只需要存放帧头、帧尾与数据段数组 */
+        xwssc_encode_sdusize(sdusize, ecsdusz, &ecsize);
+        need = sizeof(union xwssc_slot) + ecsize +
+               XWSSC_CRC32_SIZE + XWSSC_EOF_SIZE + (sizeof(xwptr_t) - 1U) +
+               ((iovcnt + 2U) * sizeof(struct xwssc_iovec));
+        rc = xwssc_txq_slot_alloc(xwssc, need, &slot);
+        if (rc < 0) {
+                goto err_bma_alloc;
+        }
+        car->slot = slot;
+
+        /* 设置发送信息 */
+        slot->tx.ntfcb = ntfcb;
+        slot->tx.cbarg = cbarg;
+        slot->tx.frmsize = sizeof(struct xwssc_frm) + ecsize + sdusize +
+                           XWSSC_CRC32_SIZE + XWSSC_EOF_SIZE;
+
+        xwssclogf(xwssc, D,
+                  "[A][EQV] car(0x%lX), slot(0x%lX), "
+                  "pri:0x%X, port:0x%X, sdusize:0x%X, iovcnt:%d\r\n",
+                  (xwptr_t)car, (xwptr_t)slot, pri, port, sdusize, iovcnt);
+        /* SOF */
+        // cppcheck-suppress [misra-c2012-17.7]
+        memset(slot->tx.frm.sof, XWSSC_SOF, XWSSC_SOF_SIZE);
+        /* Head */
+        frmheadsz = sizeof(struct xwssc_frmhead) + ecsize;
+        frmheadszmir = xwbop_rbit(xwu8_t, frmheadsz);
+        slot->tx.frm.head.headsize = frmheadsz | frmheadszmir;
+        slot->tx.frm.head.port = port;
+        slot->tx.frm.head.qos = qos & (xwu8_t)XWSSC_MSG_QOS_MSK;
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(slot->tx.frm.head.ecsdusz, ecsdusz, ecsize);
+        /* slot->tx.frm.head.id 与 slot->tx.frm.head.chksum 待发送时才能确定 */
+
+        /* CRC32：逐个数据段累积计算 */
+        crc32pos = XWSSC_SDUPOS(&slot->tx.frm.head);
+        if ((xwu8_t)0 != (qos & (xwu8_t)XWSSC_MSG_QOS_CHKSUM_MSK)) {
+                xwlib_crc32_init_ms(&crc32ctx);
+                for (i = 0; i < iovcnt; i++) {
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        xwlib_crc32_update(&crc32ctx, iov[i].base, iov[i].size);
+                }
+                crc32 = xwlib_crc32_final(&crc32ctx);
+                crc32pos[0] = (xwu8_t)((crc32 >> 24U) & 0xFFU);
+                crc32pos[1] = (xwu8_t)((crc32 >> 16U) & 0xFFU);
+                crc32pos[2] = (xwu8_t)((crc32 >> 8U) & 0xFFU);
+                crc32pos[3] = (xwu8_t)((crc32 >> 0U) & 0xFFU);
+        } else {
+                crc32pos[0] = 0;
+                crc32pos[1] = 0;
+                crc32pos[2] = 0;
+                crc32pos[3] = 0;
+        }
+
+        /* EOF */
+        // cppcheck-suppress [misra-c2012-17.7]
+        memset(&crc32pos[XWSSC_CRC32_SIZE], XWSSC_EOF, XWSSC_EOF_SIZE);
+
+        /* 数据段数组 */
+        iovpos = (xwptr_t)&crc32pos[XWSSC_CRC32_SIZE + XWSSC_EOF_SIZE];
+        iovpos = XWBOP_ALIGN(iovpos, (xwptr_t)sizeof(xwptr_t));
+        slot->tx.iov = (struct xwssc_iovec *)iovpos;
+        slot->tx.iovcnt = iovcnt + 2U;
+        slot->tx.iov[0].base = (const xwu8_t *)&slot->tx.frm;
+        slot->tx.iov[0].size = sizeof(struct xwssc_frm) + ecsize;
+        for (i = 0; i < iovcnt; i++) {
+                slot->tx.iov[i + 1U] = iov[i];
+        }
+        slot->tx.iov[iovcnt + 1U].base = crc32pos;
+        slot->tx.iov[iovcnt + 1U].size = XWSSC_CRC32_SIZE + XWSSC_EOF_SIZE;
+
+        /* 加入到发送队列 */
+        xwssc_txq_add_tail(xwssc, car);
+        xwos_sem_post(&xwssc->txq.qsem);
+        xwos_sem_post(&xwssc->txq.wnd.sem); // cppcheck-suppress [misra-c2012-17.7]
+
+        if (NULL != txhbuf) {
+                *txhbuf = (xwssc_txh_t)car;
+        }
+        return XWOK;
+
+err_bma_alloc:
+        xwssc_txq_carrier_free(xwssc, car);
+err_car_alloc:
+        return rc;
+}
+
+/**
+ * @brief 通过硬件接口发送帧槽中的帧
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] slot: 帧槽的指针
+ * @return 错误码
+ * @note
+ * + 调用者必须持有锁 `txq.csmtx` 。
+ */
+static __xwmd_code
+xwer_t xwssc_tx_slot(struct xwssc * xwssc, union xwssc_slot * slot)
+{
+        xwer_t rc;
+
+        if ((xwsz_t)0 == slot->tx.iovcnt) {
+                rc = xwssc_hwifal_tx(xwssc, (const xwu8_t *)&slot->tx.frm,
+                                     slot->tx.frmsize);
+        } else {
+                rc = xwssc_hwifal_txv(xwssc, slot->tx.iov, slot->tx.iovcnt);
+        }
+        return rc;
+}
+
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+/**
+ * @brief 用新的数据重写帧槽中的帧
+ * @param[in] slot: 帧槽的指针
+ * @param[in] sdu: 新的数据，不能在帧槽中
+ * @param[in] sdusize: 新的数据长度，不能超过帧槽申请时的数据长度
+ * @param[in] qos: 新的QoS
+ * @note
+ * + 重写数据长度的编码、数据、CRC32与EOF，帧头的ID与校验和待发送时才填充。
+ */
+static __xwmd_code
+void xwssc_tx_lz_rewrite(union xwssc_slot * slot,
+                         const xwu8_t sdu[], xwsz_t sdusize, xwu8_t qos)
+{
+        xwu8_t ecsdusz[sizeof(xwsz_t) << 1];
+        xwu8_t ecsize;
+        xwu8_t frmheadsz;
+        xwu8_t frmheadszmir;
+        xwu8_t * sdupos;
+        xwu8_t * crc32pos;
+        xwsz_t calsz;
+        xwu32_t crc32;
+
+        xwssc_encode_sdusize(sdusize, ecsdusz, &ecsize);
+        frmheadsz = sizeof(struct xwssc_frmhead) + ecsize;
+        frmheadszmir = xwbop_rbit(xwu8_t, frmheadsz);
+        slot->tx.frm.head.headsize = frmheadsz | frmheadszmir;
+        slot->tx.frm.head.qos = qos;
+        // cppcheck-suppress [misra-c2012-17.7]
+        memcpy(slot->tx.frm.head.ecsdusz, ecsdusz, ecsize);
+        sdupos = XWSSC_SDUPOS(&slot->tx.frm.head);
+        memcpy(sdupos, sdu, sdusize); // cppcheck-suppress [misra-c2012-17.7]
+        crc32pos = &sdupos[sdusize];
+        if ((xwu8_t)0 != (qos & (xwu8_t)XWSSC_MSG_QOS_CHKSUM_MSK)) {
+                calsz = sdusize;
+                crc32 = xwlib_crc32_calms(sdupos, &calsz);
+                crc32pos[0] = (xwu8_t)((crc32 >> 24U) & 0xFFU);
+                crc32pos[1] = (xwu8_t)((crc32 >> 16U) & 0xFFU);
+                crc32pos[2] = (xwu8_t)((crc32 >> 8U) & 0xFFU);
+                crc32pos[3] = (xwu8_t)((crc32 >> 0U) & 0xFFU);
+        } else {
+                crc32pos[0] = 0;
+                crc32pos[1] = 0;
+                crc32pos[2] = 0;
+                crc32pos[3] = 0;
+        }
+        // cppcheck-suppress [misra-c2012-17.7]
+        memset(&crc32pos[XWSSC_CRC32_SIZE], XWSSC_EOF, XWSSC_EOF_SIZE);
+        slot->tx.frmsize = sizeof(struct xwssc_frm) + ecsize + sdusize +
+                           XWSSC_CRC32_SIZE + XWSSC_EOF_SIZE;
+}
+#endif
+
+/**
+ * @brief 依据链路与端口的状态压缩帧槽中的数据
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] slot: 帧槽的指针
+ * @note
+ * + 只被发送线程调用，在填充帧头的ID与校验和之前调用；
+ * + 帧第一次发送前压缩，重传与重新入队的帧已经带有压缩标志，不再压缩；
+ * + 压缩后不比原数据短时，原样发送；
+ * + 已压缩的帧在重新连接后遇到不支持压缩的远端时，解压还原后发送；
+ * + 聚集发送的帧的数据不在帧槽中，不压缩。
+ */
+static __xwmd_code
+void xwssc_tx_lz(struct xwssc * xwssc, union xwssc_slot * slot)
+{
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+        struct xwssc_lzstat * stat;
+        xwu8_t * sdupos;
+        xwsz_t sdusize;
+        xwsz_t lzsize;
+        xwu8_t port;
+        xwu8_t qos;
+        bool lzon;
+        xwtm_t ts;
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        port = slot->tx.frm.head.port;
+        qos = slot->tx.frm.head.qos;
+        lzon = ((xwu8_t)0 != (xwssc->txq.rmtcap & (xwu8_t)XWSSC_CAP_LZ)) &&
+               xwbmpaop_t1i(xwssc->lz.portbmp, (xwsq_t)port);
+        sdupos = XWSSC_SDUPOS(&slot->tx.frm.head);
+        xwssc_decode_sdusize(slot->tx.frm.head.ecsdusz, &sdusize);
+        if ((xwu8_t)0 != (qos & XWSSC_QOS_LZ)) {
+                if (!lzon) {
+                        lzsize = sizeof(xwssc->lz.buf);
+                        rc = xwlz_decompress(sdupos, sdusize, xwssc->lz.buf, &lzsize);
+                        XWSSC_BUG_ON(rc < 0);
+                        xwssc_tx_lz_rewrite(slot, xwssc->lz.buf, lzsize,
+                                            qos & (xwu8_t)~XWSSC_QOS_LZ);
+                        xwssclogf(xwssc, D,
+                                  "[T][LZ] Restore slot(0x%lX), port:0x%X, size:%d\r\n",
+                                  (xwptr_t)slot, port, lzsize);
+                }
+        } else if ((lzon) && ((xwsz_t)0 == slot->tx.iovcnt) &&
+                   (sdusize > (xwsz_t)0)) {
+                /* 输出缓冲区比原数据短，压缩后不比原数据短时返回 `-ENOSPC` */
+                lzsize = sdusize - (xwsz_t)1;
+                ts = xwtm_now();
+                rc = xwlz_compress(&xwssc->lz.enc, sdupos, sdusize,
+                                   xwssc->lz.buf, &lzsize);
+                ts = xwtm_now() - ts;
+                if (XWOK == rc) {
+                        xwssc_tx_lz_rewrite(slot, xwssc->lz.buf, lzsize,
+                                            qos | XWSSC_QOS_LZ);
+                } else {
+                        lzsize = sdusize;
+                }
+                xwssclogf(xwssc, D,
+                          "[T][LZ] slot(0x%lX), port:0x%X, size:%d -> %d\r\n",
+                          (xwptr_t)slot, port, sdusize, lzsize);
+                stat = &xwssc->lz.stat[port];
+                xwos_splk_lock_cpuirqsv(&xwssc->lz.statlock, &cpuirq);
+                stat->txraw += sdusize;
+                stat->txlz += lzsize;
+                stat->txcost += ts;
+                xwos_splk_unlock_cpuirqrs(&xwssc->lz.statlock, cpuirq);
+        } else {
+                /* 不需要压缩 */
+        }
+#else
+        XWOS_UNUSED(xwssc);
+        XWOS_UNUSED(slot);
+#endif
+}
+
+/**
+ * @brief 将接收到的压缩数据解压到用户的缓冲区
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] port: 端口
+ * @param[in] sdu: 压缩数据
+ * @param[in] sdusize: 压缩数据的长度
+ * @param[out] rxbuf: 用户的缓冲区
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示用户的缓冲区的大小
+ * + (O) 作为输出时，返回解压后的长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EBADMSG: 压缩的数据格式错误，或未启用压缩
+ * @note
+ * + 用户的缓冲区不足时，与未压缩的消息相同，只返回缓冲区能容纳的部分。
+ */
+__xwmd_code
+xwer_t xwssc_rxq_unlz(struct xwssc * xwssc, xwu8_t port,
+                      xwu8_t sdu[], xwsz_t sdusize,
+                      xwu8_t rxbuf[], xwsz_t * size)
+{
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+        struct xwssc_lzstat * stat;
+        xwtm_t ts;
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        ts = xwtm_now();
+        rc = xwlz_decompress(sdu, sdusize, rxbuf, size);
+        ts = xwtm_now() - ts;
+        if (-ENOSPC == rc) {
+                xwssclogf(xwssc, W,
+                          "[A][RX] Buffer is too small(%d)! Compressed size is %d\r\n",
+                          *size, sdusize);
+                rc = XWOK;
+        }
+        if (XWOK == rc) {
+                stat = &xwssc->lz.stat[port];
+                xwos_splk_lock_cpuirqsv(&xwssc->lz.statlock, &cpuirq);
+                stat->rxlz += sdusize;
+                stat->rxraw += *size;
+                stat->rxcost += ts;
+                xwos_splk_unlock_cpuirqrs(&xwssc->lz.statlock, cpuirq);
+        } else {
+                xwssclogf(xwssc, E, "[A][RX] Bad compressed data! <rc:%d>\r\n", rc);
+                *size = 0;
+        }
+        return rc;
+#else
+        XWOS_UNUSED(xwssc);
+        XWOS_UNUSED(port);
+        XWOS_UNUSED(sdu);
+        XWOS_UNUSED(sdusize);
+        XWOS_UNUSED(rxbuf);
+        *size = 0;
+        return -EBADMSG;
+#endif
+}
+
+/**
+ * @brief 连接远端
+ * @param[in] xwssc: XWSSC对象的指针
+ * @return 错误码
+ */
+static __xwmd_code
 xwer_t xwssc_connect(struct xwssc * xwssc)
 {
         xwsq_t hwifst;
@@ -1213,6 +2023,9 @@ xwer_t xwssc_tx_frm(struct xwssc * xwssc, struct xwssc_carrier * car)
         xwsq_t hwifst;
         xwer_t rc;
 
+        /* 压缩 */
+        xwssc_tx_lz(xwssc, car->slot);
+
         /* 填充Head剩余字节 */
         xwaop_read(xwu32_t, &xwssc->txq.cnt, &txcnt);
         id = XWSSC_ID(txcnt);
@@ -1237,15 +2050,18 @@ xwer_t xwssc_tx_frm(struct xwssc * xwssc, struct xwssc_carrier * car)
                         xwssclogf(xwssc, D,
                                   "[T][.] carrier(0x%lX), ID:0x%X, cnt:0x%X\r\n",
                                   (xwptr_t)car, id, cnt);
-                        rc = xwssc_hwifal_tx(xwssc,
-                                             (const xwu8_t *)&car->slot->tx.frm,
-                                             car->slot->tx.frmsize);
+                        rc = xwssc_tx_slot(xwssc, car->slot);
                         if (rc < 0) {
                                 xwaop_c0m(xwsq_t, &xwssc->hwifst, XWSSC_HWIFST_TX,
                                           NULL, NULL);
                                 xwos_mtx_unlock(&xwssc->txq.csmtx);
                                 goto err_if_tx;
                         }
+                        if ((xwsz_t)0 == cnt) {
+                                xwaop_add(xwsq_t, &xwssc->stat.txsdu, 1, NULL, NULL);
+                        } else {
+                                xwaop_add(xwsq_t, &xwssc->stat.txrtx, 1, NULL, NULL);
+                        }
                         rc = xwos_cond_wait_to(&xwssc->txq.cscond,
                                                ulk, XWOS_LK_MTX, NULL,
                                                xwtm_ft(XWSSC_RETRY_PERIOD), &lkst);
@@ -1287,13 +2103,12 @@ xwer_t xwssc_tx_frm(struct xwssc * xwssc, struct xwssc_carrier * car)
                         xwssc_doze(3); // cppcheck-suppress [misra-c2012-17.7]
                 }
         } else {
-                rc = xwssc_hwifal_tx(xwssc,
-                                     (const xwu8_t *)&car->slot->tx.frm,
-                                     car->slot->tx.frmsize);
+                rc = xwssc_tx_slot(xwssc, car->slot);
                 if (rc < 0) {
                         xwos_mtx_unlock(&xwssc->txq.csmtx);
                         goto err_if_tx;
                 }
+                xwaop_add(xwsq_t, &xwssc->stat.txsdu, 1, NULL, NULL);
                 xwos_mtx_unlock(&xwssc->txq.csmtx);
                 xwos_splk_lock(&xwssc->txq.notiflk);
                 if (NULL != car->slot->tx.ntfcb) {
@@ -1313,6 +2128,306 @@ err_mtx_lock:
         return rc;
 }
 
+/**
+ * @brief 通知发送结果并释放发送装置
+ * @param[in] xwssc: XWSSC对象的指针
+ * @param[in] car: 发送装置的指针
+ * @param[in] rc: 发送结果
+ */
+static __xwmd_code
+void xwssc_txq_finish(struct xwssc * xwssc, struct xwssc_carrier * car, xwer_t rc)
+{
+        if (XWOK == rc) {
+                xwaop_write(xwu32_t, &car->state, XWSSC_CRS_FINISH, NULL);
+        }
+        xwos_splk_lock(&xwssc->txq.notiflk);
+        if (NULL != car->slot->tx.ntfcb) {
+                car->slot->tx.ntfcb(xwssc, (xwssc_txh_t)car, rc, car->slot->tx.cbarg);
+        }
+        xwos_splk_unlock(&xwssc->txq.notiflk);
+        // cppcheck-suppress [misra-c2012-17.7]
+        xwmm_bma_free(xwssc->mempool, car->slot);
+        car->slot = NULL;
+        xwssc_txq_carrier_free(xwssc, car);
+}
+
+/**
+ * @brief 在途帧的重传定时器的回调函数
+ * @param[in] swt: 软件定时器的指针
+ * @param[in] arg: 在途帧的指针
+ * @note
+ * + 只标记需要重传的帧并唤醒发送线程，重传由发送线程完成。
+ */
+static __xwmd_code
+void xwssc_txwnd_swtcb(struct xwos_swt * swt, void * arg)
+{
+        struct xwssc_txwnd_slot * ws;
+        struct xwssc * xwssc;
+        xwu32_t idx;
+
+        XWOS_UNUSED(swt);
+        ws = arg;
+        xwssc = ws->xwssc;
+        idx = (xwu32_t)(ws - xwssc->txq.wnd.slot);
+        xwaop_s1m(xwu32_t, &xwssc->txq.wnd.rtxbmp, ((xwu32_t)1 << idx), NULL, NULL);
+        xwos_sem_post(&xwssc->txq.wnd.sem); // cppcheck-suppress [misra-c2012-17.7]
+}
+
+/**
+ * @brief 启动在途帧的重传定时器
+ * @param[in] ws: 在途帧的指针
+ */
+static __xwmd_code
+void xwssc_txwnd_arm(struct xwssc_txwnd_slot * ws)
+{
+        xwos_swt_stop(&ws->swt); // cppcheck-suppress [misra-c2012-17.7]
+        // cppcheck-suppress [misra-c2012-17.7]
+        xwos_swt_start(&ws->swt, xwtm_now(), XWSSC_RETRY_PERIOD,
+                       xwssc_txwnd_swtcb, ws);
+}
+
+/**
+ * @brief 按顺序完成发送窗口头部已被确认的帧
+ * @param[in] xwssc: XWSSC对象的指针
+ * @note
+ * + 调用者需持有锁 `xwssc->txq.csmtx` 。
+ */
+static __xwmd_code
+void xwssc_txwnd_complete(struct xwssc * xwssc)
+{
+        struct xwssc_txwnd_slot * ws;
+        struct xwssc_carrier * car;
+        xwu32_t base;
+        xwu32_t msk;
+
+        xwaop_read(xwu32_t, &xwssc->txq.cnt, &base);
+        while (base != xwssc->txq.wnd.next) {
+                msk = (xwu32_t)1 << XWSSC_WND_IDX(base);
+                if ((xwu32_t)0 == (xwssc->txq.wnd.ackbmp & msk)) {
+                        break;
+                }
+                ws = &xwssc->txq.wnd.slot[XWSSC_WND_IDX(base)];
+                xwos_swt_stop(&ws->swt); // cppcheck-suppress [misra-c2012-17.7]
+                xwaop_c0m(xwu32_t, &xwssc->txq.wnd.rtxbmp, msk, NULL, NULL);
+                xwssc->txq.wnd.ackbmp &= ~msk;
+                car = ws->car;
+                ws->car = NULL;
+                base++;
+                xwaop_write(xwu32_t, &xwssc->txq.cnt, base, NULL);
+                xwssclogf(xwssc, D, "[T][>] carrier(0x%lX) is acknowledged.\r\n",
+                          (xwptr_t)car);
+                xwssc_txq_finish(xwssc, car, XWOK);
+        }
+}
+
+/**
+ * @brief 重传超时的在途帧
+ * @param[in] xwssc: XWSSC对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ETIMEDOUT: 有帧的发送次数已达到 @ref XWSSC_RETRY_NUM ，远端无响应
+ * @retval <0: 硬件接口错误，未重传的帧在下一轮重传
+ * @note
+ * + 调用者需持有锁 `xwssc->txq.csmtx` 。
+ */
+static __xwmd_code
+xwer_t xwssc_txwnd_retransmit(struct xwssc * xwssc)
+{
+        struct xwssc_txwnd_slot * ws;
+        xwu32_t rtxbmp;
+        xwu32_t msk;
+        xwssq_t idx;
+        xwer_t rc;
+
+        rc = XWOK;
+        xwaop_write(xwu32_t, &xwssc->txq.wnd.rtxbmp, 0, &rtxbmp);
+        rtxbmp &= ~xwssc->txq.wnd.ackbmp;
+        while ((xwu32_t)0 != rtxbmp) {
+                idx = xwbop_ffs(xwu32_t, rtxbmp);
+                msk = (xwu32_t)1 << (xwu32_t)idx;
+                ws = &xwssc->txq.wnd.slot[idx];
+                if (NULL != ws->car) {
+                        if (ws->cnt >= XWSSC_RETRY_NUM) {
+                                rc = -ETIMEDOUT;
+                                break;
+                        }
+                        xwssclogf(xwssc, D,
+                                  "[T][.] Retransmit carrier(0x%lX), ID:0x%X, cnt:0x%X\r\n",
+                                  (xwptr_t)ws->car, ws->car->slot->tx.frm.head.id,
+                                  ws->cnt);
+                        rc = xwssc_tx_slot(xwssc, ws->car->slot);
+                        if (rc < 0) {
+                                xwaop_s1m(xwu32_t, &xwssc->txq.wnd.rtxbmp, rtxbmp,
+                                          NULL, NULL);
+                                break;
+                        }
+                        ws->cnt++;
+                        xwaop_add(xwsq_t, &xwssc->stat.txrtx, 1, NULL, NULL);
+                        xwssc_txwnd_arm(ws);
+                }
+                rtxbmp &= ~msk;
+        }
+        return rc;
+}
+
+/**
+ * @brief 在发送窗口未满时发送新的帧
+ * @param[in] xwssc: XWSSC对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval <0: 硬件接口错误，帧被放回发送队列的头部
+ * @note
+ * + 调用者需持有锁 `xwssc->txq.csmtx` ；
+ * + 不可靠的帧不占用发送窗口，发送后立即完成。
+ */
+static __xwmd_code
+xwer_t xwssc_txwnd_fill(struct xwssc * xwssc)
+{
+        struct xwssc_txwnd_slot * ws;
+        struct xwssc_carrier * car;
+        union xwssc_slot * slot;
+        xwu32_t base;
+        xwu32_t state;
+        xwsz_t calsz;
+        xwer_t rc;
+
+        rc = XWOK;
+        xwaop_read(xwu32_t, &xwssc->txq.cnt, &base);
+        while ((xwssc->txq.wnd.next - base) < (xwu32_t)xwssc->txq.wnd.size) {
+                rc = xwos_sem_trywait(&xwssc->txq.qsem);
+                if (rc < 0) {
+                        rc = XWOK;
+                        break;
+                }
+                car = xwssc_txq_choose(xwssc);
+                rc = xwaop_teq_then_write(xwu32_t, &car->state,
+                                          XWSSC_CRS_READY,
+                                          XWSSC_CRS_INPROGRESS,
+                                          &state);
+                if (rc < 0) {
+                        if ((xwu32_t)XWSSC_CRS_ABORT == state) {
+                                xwssc_txq_finish(xwssc, car, -ECONNABORTED);
+                        } else {
+                                xwssc_txq_finish(xwssc, car, -EPROTO);
+                        }
+                        rc = XWOK;
+                } else {
+                        /* 压缩 */
+                        slot = car->slot;
+                        xwssc_tx_lz(xwssc, slot);
+
+                        /* 填充Head剩余字节 */
+                        slot->tx.frm.head.id = XWSSC_ID(xwssc->txq.wnd.next);
+                        slot->tx.frm.head.chksum = 0; /* 计算前先填0 */
+                        calsz = XWSSC_FRMHEAD_SIZE(slot->tx.frm.head.headsize);
+                        slot->tx.frm.head.chksum =
+                                xwssc_cal_head_chksum((xwu8_t *)&slot->tx.frm.head,
+                                                      calsz);
+                        xwssclogf(xwssc, D,
+                                  "[T][.] carrier(0x%lX), ID:0x%X\r\n",
+                                  (xwptr_t)car, slot->tx.frm.head.id);
+                        rc = xwssc_tx_slot(xwssc, slot);
+                        if (rc < 0) {
+                                xwaop_write(xwu32_t, &car->state, XWSSC_CRS_READY, NULL);
+                                xwssc_txq_add_head(xwssc, car);
+                                xwos_sem_post(&xwssc->txq.qsem);
+                                break;
+                        }
+                        xwaop_add(xwsq_t, &xwssc->stat.txsdu, 1, NULL, NULL);
+                        if ((xwu8_t)0 != (slot->tx.frm.head.qos &
+                                          (xwu8_t)XWSSC_MSG_QOS_RELIABLE_MSK)) {
+                                ws = &xwssc->txq.wnd.slot[
+                                        XWSSC_WND_IDX(xwssc->txq.wnd.next)];
+                                ws->car = car;
+                                ws->cnt = 1;
+                                xwssc_txwnd_arm(ws);
+                                xwssc->txq.wnd.next++;
+                        } else {
+                                xwssc_txq_finish(xwssc, car, XWOK);
+                        }
+                }
+        }
+        return rc;
+}
+
+/**
+ * @brief 清空发送窗口
+ * @param[in] xwssc: XWSSC对象的指针
+ * @note
+ * + 已被确认的帧被完成，未被确认的帧按原顺序放回发送队列的头部，
+ *   重新连接后再发送；
+ * + 调用者需持有锁 `xwssc->txq.csmtx` 。
+ */
+static __xwmd_code
+void xwssc_txwnd_flush(struct xwssc * xwssc)
+{
+        struct xwssc_txwnd_slot * ws;
+        struct xwssc_carrier * car;
+        xwu32_t base;
+        xwu32_t msk;
+
+        xwaop_read(xwu32_t, &xwssc->txq.cnt, &base);
+        while (base != xwssc->txq.wnd.next) {
+                xwssc->txq.wnd.next--;
+                msk = (xwu32_t)1 << XWSSC_WND_IDX(xwssc->txq.wnd.next);
+                ws = &xwssc->txq.wnd.slot[XWSSC_WND_IDX(xwssc->txq.wnd.next)];
+                xwos_swt_stop(&ws->swt); // cppcheck-suppress [misra-c2012-17.7]
+                car = ws->car;
+                ws->car = NULL;
+                if ((xwu32_t)0 != (xwssc->txq.wnd.ackbmp & msk)) {
+                        xwssc_txq_finish(xwssc, car, XWOK);
+                } else {
+                        xwaop_write(xwu32_t, &car->state, XWSSC_CRS_READY, NULL);
+                        xwssc_txq_add_head(xwssc, car);
+                        xwos_sem_post(&xwssc->txq.qsem);
+                }
+        }
+        xwssc->txq.wnd.ackbmp = 0;
+        xwaop_write(xwu32_t, &xwssc->txq.wnd.rtxbmp, 0, NULL);
+}
+
+/**
+ * @brief XWSSC的发送线程状态机：滑动窗口模式
+ * @param[in] xwssc: XWSSC对象的指针
+ * @return 错误码
+ * @note
+ * + 每一轮依次完成已被确认的帧、重传超时的帧、在窗口未满时发送新的帧，
+ *   然后等待应答、重传定时器或新的帧唤醒发送线程；
+ * + 有帧的发送次数达到 @ref XWSSC_RETRY_NUM 时，断开连接并清空发送窗口。
+ */
+static __xwmd_code
+xwer_t xwssc_txfsm_wnd(struct xwssc * xwssc)
+{
+        xwer_t rc;
+
+        rc = xwos_mtx_lock(&xwssc->txq.csmtx);
+        if (rc < 0) {
+                goto err_mtx_lock;
+        }
+        xwssc_txwnd_complete(xwssc);
+        rc = xwssc_txwnd_retransmit(xwssc);
+        if (rc < 0) {
+                if (-ETIMEDOUT == rc) {
+                        xwaop_c0m(xwsq_t, &xwssc->hwifst, XWSSC_HWIFST_CONNECT,
+                                  NULL, NULL);
+                        xwssc_txwnd_flush(xwssc);
+                }
+                xwos_mtx_unlock(&xwssc->txq.csmtx);
+                goto err_retransmit;
+        }
+        rc = xwssc_txwnd_fill(xwssc);
+        xwos_mtx_unlock(&xwssc->txq.csmtx);
+        if (rc < 0) {
+                goto err_fill;
+        }
+        rc = xwos_sem_wait(&xwssc->txq.wnd.sem);
+
+err_fill:
+err_retransmit:
+err_mtx_lock:
+        return rc;
+}
+
 /**
  * @brief XWSSC的发送线程状态机
  * @param[in] xwssc: XWSSC对象的指针
@@ -1327,7 +2442,13 @@ xwer_t xwssc_txfsm(struct xwssc * xwssc)
         xwer_t rc;
 
         xwaop_read(xwsq_t, &xwssc->hwifst, &hwifst);
-        if ((xwsq_t)0 != ((xwsq_t)XWSSC_HWIFST_CONNECT & hwifst)) {
+        if (((xwsq_t)0 != ((xwsq_t)XWSSC_HWIFST_CONNECT & hwifst)) &&
+            (xwssc->txq.wnd.size > (xwu8_t)1)) {
+                rc = xwssc_txfsm_wnd(xwssc);
+                if (rc < 0) {
+                        goto err_txfsm_wnd;
+                }
+        } else if ((xwsq_t)0 != ((xwsq_t)XWSSC_HWIFST_CONNECT & hwifst)) {
                 /* 选择一个待发送的帧 */
                 if (NULL != xwssc->txq.tmp) {
                         car = xwssc->txq.tmp;
@@ -1356,30 +2477,19 @@ xwer_t xwssc_txfsm(struct xwssc * xwssc)
                         }
                 } else {
                         if ((xwu32_t)XWSSC_CRS_ABORT == state) {
-                                xwos_splk_lock(&xwssc->txq.notiflk);
-                                if (NULL != car->slot->tx.ntfcb) {
-                                        car->slot->tx.ntfcb(xwssc,
-                                                            (xwssc_txh_t)car,
-                                                            -ECONNABORTED,
-                                                            car->slot->tx.cbarg);
-                                }
-                                xwos_splk_unlock(&xwssc->txq.notiflk);
+                                xwssc_txq_finish(xwssc, car, -ECONNABORTED);
                         } else {
-                                xwos_splk_lock(&xwssc->txq.notiflk);
-                                if (NULL != car->slot->tx.ntfcb) {
-                                        car->slot->tx.ntfcb(xwssc,
-                                                            (xwssc_txh_t)car,
-                                                            -EPROTO,
-                                                            car->slot->tx.cbarg);
-                                }
-                                xwos_splk_unlock(&xwssc->txq.notiflk);
+                                xwssc_txq_finish(xwssc, car, -EPROTO);
                         }
-                        // cppcheck-suppress [misra-c2012-17.7]
-                        xwmm_bma_free(xwssc->mempool, car->slot);
-                        car->slot = NULL;
-                        xwssc_txq_carrier_free(xwssc, car);
                 }
         } else {
+                /* 清空发送窗口 */
+                rc = xwos_mtx_lock(&xwssc->txq.csmtx);
+                if (rc < 0) {
+                        goto err_connect;
+                }
+                xwssc_txwnd_flush(xwssc);
+                xwos_mtx_unlock(&xwssc->txq.csmtx);
                 /* 连接 */
                 rc = xwssc_connect(xwssc);
                 if (rc < 0) {
@@ -1391,6 +2501,7 @@ xwer_t xwssc_txfsm(struct xwssc * xwssc)
 err_tx_frm:
         xwssc->txq.tmp = car;
 err_txqsem_wait:
+err_txfsm_wnd:
 err_connect:
         return rc;
 }
@@ -1445,6 +2556,9 @@ xwer_t xwssc_txthd(struct xwssc * xwssc)
                 xwssc->txq.tmp = NULL;
                 xwos_sem_post(&xwssc->txq.qsem);
         }
+        xwos_mtx_lock_unintr(&xwssc->txq.csmtx); // cppcheck-suppress [misra-c2012-17.7]
+        xwssc_txwnd_flush(xwssc);
+        xwos_mtx_unlock(&xwssc->txq.csmtx);
         return rc;
 }
 
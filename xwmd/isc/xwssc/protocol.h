@@ -21,12 +21,16 @@
 #include <xwos/lib/xwlog.h>
 #include <xwos/mm/bma.h>
 #include <xwos/osal/thd.h>
+#include <xwos/osal/swt.h>
 #include <xwos/osal/lock/spinlock.h>
 #include <xwos/osal/lock/mtx.h>
 #include <xwos/osal/sync/sem.h>
 #include <xwos/osal/sync/cond.h>
 #include <xwmd/isc/xwssc/hwifal.h>
 #include <xwmd/isc/xwssc/mif.h>
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+#  include <xwem/compress/xwlz/xwlz.h>
+#endif
 
 /**
  * @ingroup xwmd_isc_xwssc_protocol
@@ -46,6 +50,13 @@
 #define XWSSC_ID_MSK            (0xFFU)
 #define XWSSC_ID(id)            ((xwu8_t)((xwu8_t)(id) & XWSSC_ID_MSK))
 
+#define XWSSC_WND_MSK           (XWSSC_WND_SIZE - 1U)
+#define XWSSC_WND_IDX(id)       ((xwsq_t)(id) & XWSSC_WND_MSK)
+#define XWSSC_CONN_SDUSIZE_V1   (8U) /**< 版本1.0.0的连接帧的SDU长度（不含窗口大小） */
+#define XWSSC_CONN_SDUSIZE_V2   (9U) /**< 版本1.0.1的连接帧的SDU长度（不含能力标志） */
+#define XWSSC_CONN_SDUSIZE      (10U) /**< 连接帧的SDU长度 */
+#define XWSSC_SACK_SDUSIZE      (5U) /**< 选择性应答帧的SDU长度 */
+
 #define XWSSC_ECSIZE(head)      (XWSSC_FRMHEAD_SIZE((head)->headsize) - \
                                  sizeof(struct xwssc_frmhead))
 #define XWSSC_SDUPOS(head)      (&((head)->ecsdusz[XWSSC_ECSIZE(head)]))
@@ -92,6 +103,21 @@ enum xwssc_flag_em {
         XWSSC_FLAG_MSK = 0xF0U,
 };
 
+#define XWSSC_QOS_LZ            ((xwu8_t)0x04) /**< QoS中的压缩标志：数据经过XWLZ压缩 */
+
+/**
+ * @brief 连接帧中的能力标志
+ */
+enum xwssc_cap_em {
+        XWSSC_CAP_LZ = 0x01U, /**< 可以解压XWLZ压缩的数据 */
+};
+
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+#  define XWSSC_CAP             ((xwu8_t)XWSSC_CAP_LZ) /**< 本地的能力标志 */
+#else
+#  define XWSSC_CAP             ((xwu8_t)0) /**< 本地的能力标志 */
+#endif
+
 /**
  * @brief 应答信号枚举
  */
@@ -111,7 +137,7 @@ struct __xwcc_packed xwssc_frmhead {
         xwu8_t chksum; /**< 帧头的校验和 */
         xwu8_t port; /**< 端口 */
         xwu8_t id; /**< 消息的ID */
-        xwu8_t qos; /**< [0:3]: QoS, [4:7]: 协议内部标签 */
+        xwu8_t qos; /**< [0:1]: QoS, [2]: 压缩标志, [4:7]: 协议内部标签 */
         xwu8_t ecsdusz[0]; /**< 数据长度：变长编码 */
 };
 
@@ -134,6 +160,9 @@ union xwssc_slot {
                 xwssc_ntf_f ntfcb; /**< 通知发送结果的回调函数 */
                 void * cbarg; /**< 调用回调函数时的用户数据 */
                 xwsz_t frmsize; /**< 帧的总长度 */
+                xwsz_t iovcnt; /**< 聚集发送的数据段数量（含帧头与帧尾），
+                                    0表示整个帧连续存放在帧槽中 */
+                struct xwssc_iovec * iov; /**< 聚集发送的数据段数组，存放在帧槽的末尾 */
                 struct xwssc_frm frm; /**< 帧 */
         } tx; /**< 发送时的帧槽 */
         struct {
@@ -154,6 +183,16 @@ struct xwssc_carrier {
         union xwssc_slot * slot;
 };
 
+/**
+ * @brief 发送窗口中的在途帧
+ */
+struct xwssc_txwnd_slot {
+        struct xwos_swt swt; /**< 重传定时器 */
+        struct xwssc * xwssc; /**< 所属的XWSSC对象 */
+        struct xwssc_carrier * car; /**< 在途的发送装置，`NULL` 表示空闲 */
+        xwsz_t cnt; /**< 已经发送的次数 */
+};
+
 /**
  * @brief XWSSC对象
  */
@@ -189,6 +228,16 @@ struct xwssc {
                 } remote; /**< 正在发送的帧信息 */
                 struct xwssc_carrier * tmp; /**< 缓存正在发送的帧槽 */
                 struct xwos_splk notiflk; /**< 保证通知回调函数原子性的自旋锁 */
+                struct {
+                        xwu8_t size; /**< 协商后的窗口大小，1表示停等模式 */
+                        xwu32_t next; /**< 下一帧的发送计数，
+                                           `txq.cnt` 为最早的未确认帧的发送计数 */
+                        xwu32_t ackbmp; /**< 已被确认的在途帧的位图 */
+                        atomic_xwu32_t rtxbmp; /**< 需要重传的在途帧的位图 */
+                        struct xwssc_txwnd_slot slot[XWSSC_WND_SIZE]; /**< 在途帧 */
+                        struct xwos_sem sem; /**< 唤醒发送线程的信号量 */
+                } wnd; /**< 发送窗口，除 `rtxbmp` 与 `sem` 外被锁 `csmtx` 保护 */
+                xwu8_t rmtcap; /**< 远端的能力标志，由连接应答帧得到 */
         } txq; /**< 发送队列 */
 
         /* 接收状态机 */
@@ -200,7 +249,39 @@ struct xwssc {
                 struct xwlib_bclst_head q[XWSSC_PORT_NUM]; /**< 每个端口的接收队列 */
                 struct xwos_splk lock[XWSSC_PORT_NUM]; /**< 保护每个接收队列的锁 */
                 struct xwos_sem sem[XWSSC_PORT_NUM]; /**< 每个接收队列的信号量 */
+                struct {
+                        xwssc_rxcb_f cb; /**< 接收回调函数，`NULL` 表示放入接收队列 */
+                        void * arg; /**< 调用回调函数时的用户数据 */
+                } ntf[XWSSC_PORT_NUM]; /**< 每个端口的接收回调函数，被锁 `lock[port]` 保护 */
+                struct {
+                        xwu8_t size; /**< 协商后的窗口大小，1表示停等模式 */
+                        union xwssc_slot * ooo[XWSSC_WND_SIZE]; /**< 乱序到达的帧 */
+                } wnd; /**< 接收窗口，只被接收线程访问 */
+                struct {
+                        xwsz_t pos; /**< 下一个待解析的字节的位置 */
+                        xwsz_t end; /**< 有效数据的末尾 */
+                        xwu8_t mem[XWSSC_RXBUF_SIZE]; /**< 缓冲区 */
+                } buf; /**< 从硬件接口批量读取数据的缓冲区，只被接收线程访问 */
         } rxq; /**< 接收队列 */
+
+        /* 统计 */
+        struct {
+                atomic_xwsq_t txsdu; /**< 首次发送的数据帧数量 */
+                atomic_xwsq_t txrtx; /**< 超时重传的数据帧数量 */
+                atomic_xwsq_t rxerr; /**< 接收时丢弃的错误帧数量 */
+        } stat; /**< 链路统计信息，参考 @ref xwssc_stat */
+
+#if defined(XWMDCFG_isc_xwssc_COMPRESS) && (1 == XWMDCFG_isc_xwssc_COMPRESS)
+        /* 压缩 */
+        struct {
+                xwbmpaop_define(portbmp, XWSSC_PORT_NUM); /**< 发送时启用压缩的端口的位图 */
+                struct xwlz_enc enc; /**< 压缩器的工作内存，只被发送线程访问 */
+                xwu8_t buf[XWSSC_SDU_MAX_SIZE]; /**< 压缩与还原数据的缓冲区，
+                                                     只被发送线程访问 */
+                struct xwos_splk statlock; /**< 保护统计信息的自旋锁 */
+                struct xwssc_lzstat stat[XWSSC_PORT_NUM]; /**< 每个端口的统计信息 */
+        } lz; /**< 压缩 */
+#endif
 };
 
 xwer_t xwssc_grab(struct xwssc * xwssc);
@@ -219,8 +300,17 @@ xwer_t xwssc_eq_msg(struct xwssc * xwssc,
                     xwu8_t pri, xwu8_t port, xwu8_t qos,
                     xwssc_ntf_f ntfcb, void * cbarg,
                     xwssc_txh_t * txhbuf);
+xwer_t xwssc_eq_msgv(struct xwssc * xwssc,
+                     const struct xwssc_iovec iov[], xwsz_t iovcnt, xwsz_t sdusize,
+                     xwu8_t pri, xwu8_t port, xwu8_t qos,
+                     xwssc_ntf_f ntfcb, void * cbarg,
+                     xwssc_txh_t * txhbuf);
+xwer_t xwssc_rxq_unlz(struct xwssc * xwssc, xwu8_t port,
+                      xwu8_t sdu[], xwsz_t sdusize,
+                      xwu8_t rxbuf[], xwsz_t * size);
 xwer_t xwssc_tx_ack_sdu(struct xwssc * xwssc, xwu8_t port, xwu8_t id, xwu8_t ack);
 xwer_t xwssc_txthd(struct xwssc * xwssc);
+void xwssc_rxwnd_flush(struct xwssc * xwssc);
 
 /**
  * @} xwmd_isc_xwssc_protocol
@@ -13,11 +13,16 @@ include $(XWOS_WKSPC_DIR)/XWOS.cfg
 include xwbs/functions.mk
 
 $(eval $(call XwmoReqCfg,XWLIBCFG_CRC32,y))
+$(eval $(call XwmoReqCfg,XWOSCFG_SKD_SWT,y))
 
-XWMO_CSRCS := protocol.c hwifal.c hwif/uart.c mif.c
+XWMO_CSRCS := protocol.c hwifal.c hwif/uart.c hwif/loopback.c mif.c
 XWMO_CFLAGS :=
 XWMO_INCDIRS :=
 
+ifeq ($(XWMDCFG_isc_xwssc_COMPRESS),y)
+  $(eval $(call XwmoReqCfg,XWEMCFG_compress_xwlz,y))
+endif
+
 ifeq ($(XWMDCFG_isc_xwssc_CXX),y)
   XWMO_CXXSRCS := cxx/XwsscPortProxy.cxx
   XWMO_CXXFLAGS :=
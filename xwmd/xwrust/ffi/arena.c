@@ -0,0 +1,127 @@
+/**
+ * @file
+ * @brief XWRUST FFI：竞技场分配器
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/mm/mempool/allocator.h>
+#include <xwos/mm/arena.h>
+
+#if defined(XWMMCFG_ARENA) && (1 == XWMMCFG_ARENA)
+extern struct xwmm_mempool * xwrust_mempool;
+
+xwer_t xwrustffi_arena_init(struct xwmm_arena * arena, xwsz_t blksize)
+{
+        return xwmm_arena_init_mempool(arena, "xwrust.arena", xwrust_mempool, blksize);
+}
+
+void * xwrustffi_arena_alloc(struct xwmm_arena * arena, xwsz_t alignment, xwsz_t size)
+{
+        void * mem = NULL;
+
+        if (alignment < (xwsz_t)XWMM_ALIGNMENT) {
+                alignment = 0; // cppcheck-suppress [misra-c2012-17.8]
+        }
+        // cppcheck-suppress [misra-c2012-17.7]
+        xwmm_arena_alloc(arena, size, alignment, &mem);
+        return mem;
+}
+
+void xwrustffi_arena_mark(struct xwmm_arena * arena, struct xwmm_arena_mark * mark)
+{
+        xwmm_arena_mark(arena, mark);
+}
+
+xwer_t xwrustffi_arena_rewind(struct xwmm_arena * arena,
+                              const struct xwmm_arena_mark * mark)
+{
+        return xwmm_arena_rewind(arena, mark);
+}
+
+void xwrustffi_arena_reset(struct xwmm_arena * arena)
+{
+        xwmm_arena_reset(arena);
+}
+
+void xwrustffi_arena_release(struct xwmm_arena * arena)
+{
+        xwmm_arena_release(arena);
+}
+
+xwsz_t xwrustffi_arena_get_used(struct xwmm_arena * arena)
+{
+        return xwmm_arena_get_used(arena);
+}
+
+#  if defined(XWMMCFG_ARENA_CTHD) && (1 == XWMMCFG_ARENA_CTHD)
+xwer_t xwrustffi_arena_cthd_set(struct xwmm_arena * arena)
+{
+        return xwmm_arena_cthd_set(arena);
+}
+#  else
+xwer_t xwrustffi_arena_cthd_set(struct xwmm_arena * arena)
+{
+        XWOS_UNUSED(arena);
+        return -ENOSYS;
+}
+#  endif
+#else
+/* 未配置竞技场分配器时仍提供符号，避免 xwrust 链接失败 */
+xwer_t xwrustffi_arena_init(struct xwmm_arena * arena, xwsz_t blksize)
+{
+        XWOS_UNUSED(arena);
+        XWOS_UNUSED(blksize);
+        return -ENOSYS;
+}
+
+void * xwrustffi_arena_alloc(struct xwmm_arena * arena, xwsz_t alignment, xwsz_t size)
+{
+        XWOS_UNUSED(arena);
+        XWOS_UNUSED(alignment);
+        XWOS_UNUSED(size);
+        return NULL;
+}
+
+void xwrustffi_arena_mark(struct xwmm_arena * arena, struct xwmm_arena_mark * mark)
+{
+        XWOS_UNUSED(arena);
+        XWOS_UNUSED(mark);
+}
+
+xwer_t xwrustffi_arena_rewind(struct xwmm_arena * arena,
+                              const struct xwmm_arena_mark * mark)
+{
+        XWOS_UNUSED(arena);
+        XWOS_UNUSED(mark);
+        return -ENOSYS;
+}
+
+void xwrustffi_arena_reset(struct xwmm_arena * arena)
+{
+        XWOS_UNUSED(arena);
+}
+
+void xwrustffi_arena_release(struct xwmm_arena * arena)
+{
+        XWOS_UNUSED(arena);
+}
+
+xwsz_t xwrustffi_arena_get_used(struct xwmm_arena * arena)
+{
+        XWOS_UNUSED(arena);
+        return 0;
+}
+
+xwer_t xwrustffi_arena_cthd_set(struct xwmm_arena * arena)
+{
+        XWOS_UNUSED(arena);
+        return -ENOSYS;
+}
+#endif
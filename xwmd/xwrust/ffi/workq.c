@@ -0,0 +1,60 @@
+/**
+ * @file
+ * @brief XWRUST FFI：工作队列
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/osal/skd.h>
+
+#if defined(XWOSCFG_SKD_WORKQ) && (1 == XWOSCFG_SKD_WORKQ)
+#include <xwos/osal/workq.h>
+
+void xwrustffi_work_init(struct xwos_work * work, xwos_work_f func, void * arg)
+{
+        xwos_work_init(work, func, arg);
+}
+
+xwer_t xwrustffi_work_queue(struct xwos_work * work)
+{
+        return xwos_work_queue(xwos_workq_get_sys(), work);
+}
+
+xwer_t xwrustffi_work_queue_on(struct xwos_work * work, xwid_t cpuid)
+{
+        return xwos_work_queue_on(xwos_workq_get_sys(), cpuid, work);
+}
+
+xwer_t xwrustffi_work_queue_delayed(struct xwos_work * work, xwtm_t delay)
+{
+        return xwos_work_queue_delayed(xwos_workq_get_sys(),
+                                       xwos_skd_get_cpuid_lc(),
+                                       work, delay);
+}
+
+xwer_t xwrustffi_work_cancel(struct xwos_work * work)
+{
+        return xwos_work_cancel(work);
+}
+
+xwer_t xwrustffi_work_flush(struct xwos_work * work)
+{
+        return xwos_work_flush(work);
+}
+
+bool xwrustffi_work_tst_busy(struct xwos_work * work)
+{
+        return xwos_work_tst_busy(work);
+}
+
+xwer_t xwrustffi_workq_flush(void)
+{
+        return xwos_workq_flush(xwos_workq_get_sys());
+}
+#endif
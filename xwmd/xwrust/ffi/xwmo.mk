@@ -11,8 +11,8 @@
 
 include $(XWOS_WKSPC_DIR)/XWOS.cfg
 include xwbs/functions.mk
-XWMO_CSRCS := allocator.c
-XWMO_CSRCS += xwtm.c skd.c thd.c swt.c pm.c
+XWMO_CSRCS := allocator.c arena.c
+XWMO_CSRCS += xwtm.c skd.c thd.c swt.c workq.c pm.c
 XWMO_CSRCS += spinlock.c seqlock.c mtx.c
 XWMO_CSRCS += sem.c cond.c flg.c br.c sel.c
 XWMO_CSRCS += xwmq.c xwcq.c
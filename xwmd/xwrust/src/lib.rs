@@ -104,10 +104,12 @@
 //!
 //! + [内存管理](crate::xwmm)
 //!   + [全局内存分配器](crate::xwmm::allocator)
+//!   + [竞技场分配器](crate::xwmm::arena)
 //! + [调度器](crate::xwos::skd)
 //! + [电源管理](crate::xwos::pm)
 //! + [线程](crate::xwos::thd)
 //! + [软件定时器](crate::xwos::swt)
+//! + [工作队列](crate::xwos::workq)
 //! + [锁](crate::xwos::lock)
 //!   + [互斥锁](crate::xwos::lock::mtx)
 //!   + [自旋锁](crate::xwos::lock::spinlock)
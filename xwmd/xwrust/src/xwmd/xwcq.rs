@@ -104,6 +104,33 @@
 //! + [`Xwcq::tryprq()`] 若循环队列中为空，就立即返回，可在中断中使用。
 //!
 //!
+//! # 零拷贝
+//!
+//! 发送与接收大块数据时，可直接在循环队列的数据槽中读写，省去一次拷贝。
+//!
+//! + [`Xwcq::reserve()`] 预留 **尾端** 的数据槽，返回 [`XwcqSlotMut`] ，
+//!   填写完成后调用 [`XwcqSlotMut::commit()`] 提交，数据槽才会进入队列。
+//!   [`XwcqSlotMut`] 没有提交就被丢弃时，预留被放弃，写入的数据不会进入队列。
+//! + [`Xwcq::peek_slot()`] ， [`Xwcq::peek_slot_to()`] ， [`Xwcq::peek_slot_unintr()`] ，
+//!   [`Xwcq::trypeek_slot()`] 从 **首端** 取出数据槽，返回 [`XwcqSlot`] ，
+//!   [`XwcqSlot`] 被丢弃时，数据槽被释放。
+//!
+//! 同一时刻只能有一个预留的数据槽与一个被取出的数据槽：
+//!
+//! + 预留数据槽期间，其他的预留、入队、插队与尾端离队都会返回错误码 [`XwcqError::Busy`] ；
+//! + 循环队列已满，且发送会覆盖被取出的数据槽时，返回错误码 [`XwcqError::NoSpace`] 。
+//!
+//!
+//! # 批量发送与接收
+//!
+//! 一次发送或接收多个数据，整批数据只上锁一次。
+//!
+//! + [`Xwcq::eq_n()`] 将切片中的数据依次发送到循环队列的 **尾端** ，返回实际发送的数量。
+//! + [`Xwcq::dq_n()`] ， [`Xwcq::dq_n_to()`] ， [`Xwcq::dq_n_unintr()`] ，
+//!   [`Xwcq::trydq_n()`] 至少等到一个数据，再从 **首端** 取出已在队列中的数据填入切片，
+//!   返回实际接收的数量。
+//!
+//!
 //! # 清空循环队列
 //!
 //! [`Xwcq::flush()`] 可将循环队列的所有数据槽清空。
@@ -138,6 +165,10 @@ use core::ffi::*;
 use core::result::Result;
 use core::cell::UnsafeCell;
 use core::mem;
+use core::ptr;
+use core::ops::Deref;
+use core::ops::DerefMut;
+use core::slice;
 
 use crate::cfg::*;
 use crate::types::*;
@@ -172,6 +203,20 @@ extern "C" {
     fn xwcq_prq_to(cq: *mut XwmdXwcq, data: *mut u8, size: *mut XwSz, to: XwTm) -> XwEr;
     fn xwcq_prq_unintr(cq: *mut XwmdXwcq, data: *mut u8, size: *mut XwSz) -> XwEr;
     fn xwcq_tryprq(cq: *mut XwmdXwcq, data: *mut u8, size: *mut XwSz) -> XwEr;
+    fn xwcq_reserve(cq: *mut XwmdXwcq, slot: *mut *mut u8) -> XwEr;
+    fn xwcq_commit(cq: *mut XwmdXwcq) -> XwEr;
+    fn xwcq_cancel(cq: *mut XwmdXwcq) -> XwEr;
+    fn xwcq_peek_slot(cq: *mut XwmdXwcq, slot: *mut *mut u8) -> XwEr;
+    fn xwcq_peek_slot_to(cq: *mut XwmdXwcq, slot: *mut *mut u8, to: XwTm) -> XwEr;
+    fn xwcq_peek_slot_unintr(cq: *mut XwmdXwcq, slot: *mut *mut u8) -> XwEr;
+    fn xwcq_trypeek_slot(cq: *mut XwmdXwcq, slot: *mut *mut u8) -> XwEr;
+    fn xwcq_release_slot(cq: *mut XwmdXwcq) -> XwEr;
+    fn xwcq_eq_n(cq: *mut XwmdXwcq, data: *const u8, size: XwSz, num: *mut XwSz) -> XwEr;
+    fn xwcq_dq_n(cq: *mut XwmdXwcq, buf: *mut u8, size: XwSz, num: *mut XwSz) -> XwEr;
+    fn xwcq_dq_n_to(cq: *mut XwmdXwcq, buf: *mut u8, size: XwSz, num: *mut XwSz,
+                    to: XwTm) -> XwEr;
+    fn xwcq_dq_n_unintr(cq: *mut XwmdXwcq, buf: *mut u8, size: XwSz, num: *mut XwSz) -> XwEr;
+    fn xwcq_trydq_n(cq: *mut XwmdXwcq, buf: *mut u8, size: XwSz, num: *mut XwSz) -> XwEr;
     fn xwcq_flush(cq: *mut XwmdXwcq) -> XwEr;
     fn xwcq_get_capacity(cq: *mut XwmdXwcq, capbuf: *mut XwSz) -> XwEr;
     fn xwcq_get_size(cq: *mut XwmdXwcq, szbuf: *mut XwSz) -> XwEr;
@@ -205,6 +250,10 @@ pub enum XwcqError {
     DisIrq(XwEr),
     /// 循环队列中没有数据
     NoData(XwEr),
+    /// 已有预留的数据槽或被取出的数据槽
+    Busy(XwEr),
+    /// 循环队列已满，且发送会覆盖被取出的数据槽
+    NoSpace(XwEr),
     /// 未知错误
     Unknown(XwEr),
 }
@@ -224,6 +273,8 @@ impl XwcqError {
             Self::DisBh(rc) => rc,
             Self::DisIrq(rc) => rc,
             Self::NoData(rc) => rc,
+            Self::Busy(rc) => rc,
+            Self::NoSpace(rc) => rc,
             Self::Unknown(rc) => rc,
         }
     }
@@ -244,11 +295,11 @@ const XWCQ_MM_MSK: XwSz = XWCQ_MM_ALIGN - 1;
 
 /// 循环队列对象占用的内存大小
 #[cfg(target_pointer_width = "32")]
-pub const SIZEOF_XWCQ: usize = 96;
+pub const SIZEOF_XWCQ: usize = 104;
 
 /// 循环队列对象占用的内存大小
 #[cfg(target_pointer_width = "64")]
-pub const SIZEOF_XWCQ: usize = 192;
+pub const SIZEOF_XWCQ: usize = 208;
 
 /// 用于构建循环队列的内存数组类型
 #[repr(C)]
@@ -378,6 +429,8 @@ where
     /// + [`XwcqError::Ok`] 没有错误
     /// + [`XwcqError::NotInit`] 循环队列没有初始化
     /// + [`XwcqError::DataSize`] 数据大小错误
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
+    /// + [`XwcqError::NoSpace`] 循环队列已满，且发送会覆盖被取出的数据槽
     ///
     /// # 上下文
     ///
@@ -427,6 +480,10 @@ where
                     xwcq_put(self.cq.get());
                     if XWOK == rc {
                         Ok(datasz)
+                    } else if -EBUSY == rc {
+                        Err(XwcqError::Busy(rc))
+                    } else if -ENOSPC == rc {
+                        Err(XwcqError::NoSpace(rc))
                     } else {
                         Err(XwcqError::Unknown(rc))
                     }
@@ -454,6 +511,8 @@ where
     /// + [`XwcqError::Ok`] 没有错误
     /// + [`XwcqError::NotInit`] 循环队列没有初始化
     /// + [`XwcqError::DataSize`] 数据大小错误
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
+    /// + [`XwcqError::NoSpace`] 循环队列已满，且发送会覆盖被取出的数据槽
     ///
     /// # 上下文
     ///
@@ -503,6 +562,10 @@ where
                     xwcq_put(self.cq.get());
                     if XWOK == rc {
                         Ok(datasz)
+                    } else if -EBUSY == rc {
+                        Err(XwcqError::Busy(rc))
+                    } else if -ENOSPC == rc {
+                        Err(XwcqError::NoSpace(rc))
                     } else {
                         Err(XwcqError::Unknown(rc))
                     }
@@ -894,6 +957,7 @@ where
     /// + [`XwcqError::DisPmpt`] 抢占被关闭
     /// + [`XwcqError::DisBh`] 中断底半部被关闭
     /// + [`XwcqError::DisIrq`] 中断被关闭
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
     ///
     /// # 示例
     ///
@@ -951,6 +1015,8 @@ where
                         Err(XwcqError::DisBh(rc))
                     } else if -EDISIRQ == rc {
                         Err(XwcqError::DisIrq(rc))
+                    } else if -EBUSY == rc {
+                        Err(XwcqError::Busy(rc))
                     } else {
                         Err(XwcqError::Unknown(rc))
                     }
@@ -991,6 +1057,7 @@ where
     /// + [`XwcqError::DisPmpt`] 抢占被关闭
     /// + [`XwcqError::DisBh`] 中断底半部被关闭
     /// + [`XwcqError::DisIrq`] 中断被关闭
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
     ///
     /// # 上下文
     ///
@@ -1056,6 +1123,8 @@ where
                         Err(XwcqError::DisBh(rc))
                     } else if -EDISIRQ == rc {
                         Err(XwcqError::DisIrq(rc))
+                    } else if -EBUSY == rc {
+                        Err(XwcqError::Busy(rc))
                     } else {
                         Err(XwcqError::Unknown(rc))
                     }
@@ -1088,6 +1157,7 @@ where
     /// + [`XwcqError::DisPmpt`] 抢占被关闭
     /// + [`XwcqError::DisBh`] 中断底半部被关闭
     /// + [`XwcqError::DisIrq`] 中断被关闭
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
     ///
     /// # 示例
     ///
@@ -1144,6 +1214,8 @@ where
                         Err(XwcqError::DisBh(rc))
                     } else if -EDISIRQ == rc {
                         Err(XwcqError::DisIrq(rc))
+                    } else if -EBUSY == rc {
+                        Err(XwcqError::Busy(rc))
                     } else {
                         Err(XwcqError::Unknown(rc))
                     }
@@ -1173,6 +1245,7 @@ where
     /// + [`XwcqError::Ok`] 没有错误
     /// + [`XwcqError::NotInit`] 循环队列没有初始化
     /// + [`XwcqError::NoData`] 循环队列中没有数据
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
     ///
     /// # 示例
     ///
@@ -1221,6 +1294,8 @@ where
                         Ok(data)
                     } else if -ENODATA == rc {
                         Err(XwcqError::NoData(rc))
+                    } else if -EBUSY == rc {
+                        Err(XwcqError::Busy(rc))
                     } else {
                         Err(XwcqError::Unknown(rc))
                     }
@@ -1955,6 +2030,522 @@ where
         }
     }
 
+    /// 预留循环队列 **尾端** 的数据槽（零拷贝发送）
+    ///
+    /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
+    /// + 预留成功后返回 [`XwcqSlotMut`] ，可通过它直接写数据槽，大小为 [`Xwcq::size()`] 。
+    /// + 调用 [`XwcqSlotMut::commit()`] 后，数据槽才会进入队列，可被接收；
+    ///   [`XwcqSlotMut`] 没有提交就被丢弃时，预留被放弃，写入的数据不会进入队列。
+    /// + 同一时刻只能有一个预留的数据槽。
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// use xwrust::xwmd::xwcq::*;
+    ///
+    /// static CQ: Xwcq<64, 16> = Xwcq::new();
+    ///
+    /// pub fn xwrust_example_xwcq() {
+    ///     CQ.init();
+    ///     // ...省略...
+    ///     match CQ.reserve() {
+    ///         Ok(mut slot) => { // 预留数据槽成功
+    ///             let msg = "零拷贝".as_bytes();
+    ///             slot[..msg.len()].copy_from_slice(msg);
+    ///             let rc = slot.commit();
+    ///         },
+    ///         Err(e) => { // 预留数据槽失败
+    ///         },
+    ///     };
+    /// }
+    /// ```
+    pub fn reserve(&self) -> Result<XwcqSlotMut<'_, S, N>, XwcqError> {
+        unsafe {
+            let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+            if rc == 0 {
+                let mut slot: *mut u8 = ptr::null_mut();
+                rc = xwcq_reserve(self.cq.get(), &mut slot);
+                xwcq_put(self.cq.get());
+                if XWOK == rc {
+                    Ok(XwcqSlotMut { cq: self, slot: slot })
+                } else if -EBUSY == rc {
+                    Err(XwcqError::Busy(rc))
+                } else {
+                    Err(XwcqError::Unknown(rc))
+                }
+            } else {
+                Err(XwcqError::NotInit(rc))
+            }
+        }
+    }
+
+    fn peek_slot_result(&self, rc: XwEr, slot: *mut u8) -> Result<XwcqSlot<'_, S, N>, XwcqError> {
+        if XWOK == rc {
+            Ok(XwcqSlot { cq: self, slot: slot })
+        } else if -EINTR == rc {
+            Err(XwcqError::Interrupt(rc))
+        } else if -ETIMEDOUT == rc {
+            Err(XwcqError::Timedout(rc))
+        } else if -ENOTTHDCTX == rc {
+            Err(XwcqError::NotThreadContext(rc))
+        } else if -EDISPMPT == rc {
+            Err(XwcqError::DisPmpt(rc))
+        } else if -EDISBH == rc {
+            Err(XwcqError::DisBh(rc))
+        } else if -EDISIRQ == rc {
+            Err(XwcqError::DisIrq(rc))
+        } else if -ENODATA == rc {
+            Err(XwcqError::NoData(rc))
+        } else if -EBUSY == rc {
+            Err(XwcqError::Busy(rc))
+        } else {
+            Err(XwcqError::Unknown(rc))
+        }
+    }
+
+    /// 等待从循环队列的 **首端** 取出数据槽（零拷贝接收）
+    ///
+    /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
+    /// + 若循环队列为空，线程会阻塞等待。
+    /// + 取出成功后返回 [`XwcqSlot`] ，可通过它直接读数据槽，大小为 [`Xwcq::size()`] 。
+    /// + [`XwcqSlot`] 被丢弃时，数据槽被释放。在此之前，发送者不会覆盖此数据槽。
+    /// + 同一时刻只能有一个被取出的数据槽。
+    /// + 当线程阻塞等待被中断时，返回错误码 [`XwcqError::Interrupt`] 。
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::Interrupt`] 等待被中断
+    /// + [`XwcqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwcqError::DisPmpt`] 抢占被关闭
+    /// + [`XwcqError::DisBh`] 中断底半部被关闭
+    /// + [`XwcqError::DisIrq`] 中断被关闭
+    /// + [`XwcqError::Busy`] 已有被取出的数据槽
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// use xwrust::xwmd::xwcq::*;
+    ///
+    /// static CQ: Xwcq<64, 16> = Xwcq::new();
+    ///
+    /// pub fn xwrust_example_xwcq() {
+    ///     CQ.init();
+    ///     // ...省略...
+    ///     match CQ.peek_slot() {
+    ///         Ok(slot) => { // 取出数据槽成功
+    ///             let first = slot[0];
+    ///         }, // `slot` 被丢弃，数据槽被释放
+    ///         Err(e) => { // 取出数据槽失败
+    ///         },
+    ///     };
+    /// }
+    /// ```
+    pub fn peek_slot(&self) -> Result<XwcqSlot<'_, S, N>, XwcqError> {
+        unsafe {
+            let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+            if rc == 0 {
+                let mut slot: *mut u8 = ptr::null_mut();
+                rc = xwcq_peek_slot(self.cq.get(), &mut slot);
+                xwcq_put(self.cq.get());
+                self.peek_slot_result(rc, slot)
+            } else {
+                Err(XwcqError::NotInit(rc))
+            }
+        }
+    }
+
+    /// 限时等待从循环队列的 **首端** 取出数据槽（零拷贝接收）
+    ///
+    /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
+    /// + 若循环队列为空，线程会阻塞等待，等待时会指定一个唤醒时间点。
+    /// + 取出成功后返回 [`XwcqSlot`] ， [`XwcqSlot`] 被丢弃时，数据槽被释放。
+    /// + 当线程阻塞等待被中断时，返回错误码 [`XwcqError::Interrupt`] 。
+    /// + 当到达指定的唤醒时间点，线程被唤醒，返回错误码 [`XwcqError::Timedout`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + to: 期望唤醒的时间点
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::Interrupt`] 等待被中断
+    /// + [`XwcqError::Timedout`] 等待超时
+    /// + [`XwcqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwcqError::DisPmpt`] 抢占被关闭
+    /// + [`XwcqError::DisBh`] 中断底半部被关闭
+    /// + [`XwcqError::DisIrq`] 中断被关闭
+    /// + [`XwcqError::Busy`] 已有被取出的数据槽
+    pub fn peek_slot_to(&self, to: XwTm) -> Result<XwcqSlot<'_, S, N>, XwcqError> {
+        unsafe {
+            let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+            if rc == 0 {
+                let mut slot: *mut u8 = ptr::null_mut();
+                rc = xwcq_peek_slot_to(self.cq.get(), &mut slot, to);
+                xwcq_put(self.cq.get());
+                self.peek_slot_result(rc, slot)
+            } else {
+                Err(XwcqError::NotInit(rc))
+            }
+        }
+    }
+
+    /// 等待从循环队列的 **首端** 取出数据槽（零拷贝接收），并且等待不可被中断
+    ///
+    /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
+    /// + 若循环队列为空，线程会阻塞等待，且不可被中断。
+    /// + 取出成功后返回 [`XwcqSlot`] ， [`XwcqSlot`] 被丢弃时，数据槽被释放。
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwcqError::DisPmpt`] 抢占被关闭
+    /// + [`XwcqError::DisBh`] 中断底半部被关闭
+    /// + [`XwcqError::DisIrq`] 中断被关闭
+    /// + [`XwcqError::Busy`] 已有被取出的数据槽
+    pub fn peek_slot_unintr(&self) -> Result<XwcqSlot<'_, S, N>, XwcqError> {
+        unsafe {
+            let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+            if rc == 0 {
+                let mut slot: *mut u8 = ptr::null_mut();
+                rc = xwcq_peek_slot_unintr(self.cq.get(), &mut slot);
+                xwcq_put(self.cq.get());
+                self.peek_slot_result(rc, slot)
+            } else {
+                Err(XwcqError::NotInit(rc))
+            }
+        }
+    }
+
+    /// 尝试从循环队列的 **首端** 取出数据槽（零拷贝接收）
+    ///
+    /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
+    /// + 若循环队列为空，立即返回 [`XwcqError::NoData`] ，此方法不会阻塞。
+    /// + 取出成功后返回 [`XwcqSlot`] ， [`XwcqSlot`] 被丢弃时，数据槽被释放。
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::NoData`] 循环队列中没有数据
+    /// + [`XwcqError::Busy`] 已有被取出的数据槽
+    pub fn trypeek_slot(&self) -> Result<XwcqSlot<'_, S, N>, XwcqError> {
+        unsafe {
+            let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+            if rc == 0 {
+                let mut slot: *mut u8 = ptr::null_mut();
+                rc = xwcq_trypeek_slot(self.cq.get(), &mut slot);
+                xwcq_put(self.cq.get());
+                self.peek_slot_result(rc, slot)
+            } else {
+                Err(XwcqError::NotInit(rc))
+            }
+        }
+    }
+
+    /// 将切片中的数据批量发送到循环队列的 **尾端** （批量入队）
+    ///
+    /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
+    /// + 所有数据在一次上锁中写入队列，队列满时覆盖最旧的数据。
+    /// + 当 `T` 大小大于循环队列的数据槽大小 `S` ，发送会失败，并返回错误码 [`XwcqError::DataSize`] 。
+    /// + 返回实际发送的数据数量，数量小于 `data.len()` 时，剩余的数据需要重新发送。
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::DataSize`] 数据大小错误
+    /// + [`XwcqError::Busy`] 已有预留的数据槽
+    /// + [`XwcqError::NoSpace`] 循环队列已满，且发送会覆盖被取出的数据槽
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// use xwrust::xwmd::xwcq::*;
+    ///
+    /// static CQ: Xwcq<8, 16> = Xwcq::new();
+    ///
+    /// pub fn xwrust_example_xwcq() {
+    ///     CQ.init();
+    ///     let samples: [u32; 4] = [1, 2, 3, 4];
+    ///     match CQ.eq_n(&samples) {
+    ///         Ok(n) => { // 发送了n个数据
+    ///         },
+    ///         Err(e) => { // 发送数据失败
+    ///         },
+    ///     };
+    /// }
+    /// ```
+    pub fn eq_n<T>(&self, data: &[T]) -> Result<XwSz, XwcqError>
+    where
+        T: Sized + Send
+    {
+        unsafe {
+            let datasz: XwSz = mem::size_of::<T>();
+            if (datasz <= self.size()) && (datasz > 0) {
+                let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+                if rc == 0 {
+                    let mut num: XwSz = data.len();
+                    rc = xwcq_eq_n(self.cq.get(), data.as_ptr() as *const u8, datasz,
+                                   &mut num);
+                    xwcq_put(self.cq.get());
+                    if XWOK == rc {
+                        Ok(num)
+                    } else if -EBUSY == rc {
+                        Err(XwcqError::Busy(rc))
+                    } else if -ENOSPC == rc {
+                        Err(XwcqError::NoSpace(rc))
+                    } else {
+                        Err(XwcqError::Unknown(rc))
+                    }
+                } else {
+                    Err(XwcqError::NotInit(rc))
+                }
+            } else {
+                Err(XwcqError::DataSize(-ESIZE))
+            }
+        }
+    }
+
+    fn dq_n_result(&self, rc: XwEr, num: XwSz) -> Result<XwSz, XwcqError> {
+        if XWOK == rc {
+            Ok(num)
+        } else if -EINTR == rc {
+            Err(XwcqError::Interrupt(rc))
+        } else if -ETIMEDOUT == rc {
+            Err(XwcqError::Timedout(rc))
+        } else if -ENOTTHDCTX == rc {
+            Err(XwcqError::NotThreadContext(rc))
+        } else if -EDISPMPT == rc {
+            Err(XwcqError::DisPmpt(rc))
+        } else if -EDISBH == rc {
+            Err(XwcqError::DisBh(rc))
+        } else if -EDISIRQ == rc {
+            Err(XwcqError::DisIrq(rc))
+        } else if -ENODATA == rc {
+            Err(XwcqError::NoData(rc))
+        } else if -EINVAL == rc {
+            Err(XwcqError::DataSize(rc))
+        } else {
+            Err(XwcqError::Unknown(rc))
+        }
+    }
+
+    /// 等待从循环队列的 **首端** 批量接收数据
+    ///
+    /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
+    /// + 若循环队列为空，线程会阻塞等待；等到第一个数据后，不再等待，
+    ///   取出队列中已有的数据，最多 `buf.len()` 个，返回实际接收的数量。
+    /// + 当 `T` 大小大于循环队列的数据槽大小 `S` 或 `buf` 为空，接收会失败，并返回错误码 [`XwcqError::DataSize`] 。
+    /// + 当线程阻塞等待被中断时，返回错误码 [`XwcqError::Interrupt`] 。
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::DataSize`] 数据大小错误
+    /// + [`XwcqError::Interrupt`] 等待被中断
+    /// + [`XwcqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwcqError::DisPmpt`] 抢占被关闭
+    /// + [`XwcqError::DisBh`] 中断底半部被关闭
+    /// + [`XwcqError::DisIrq`] 中断被关闭
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// use xwrust::xwmd::xwcq::*;
+    ///
+    /// static CQ: Xwcq<8, 16> = Xwcq::new();
+    ///
+    /// pub fn xwrust_example_xwcq() {
+    ///     CQ.init();
+    ///     // ...省略...
+    ///     let mut samples: [u32; 8] = [0; 8];
+    ///     match CQ.dq_n(&mut samples) {
+    ///         Ok(n) => { // samples[..n] 是接收到的数据
+    ///         },
+    ///         Err(e) => { // 接收数据失败
+    ///         },
+    ///     };
+    /// }
+    /// ```
+    pub fn dq_n<T>(&self, buf: &mut [T]) -> Result<XwSz, XwcqError>
+    where
+        T: Sized + Send
+    {
+        unsafe {
+            let datasz: XwSz = mem::size_of::<T>();
+            if (datasz <= self.size()) && (datasz > 0) && (buf.len() > 0) {
+                let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+                if rc == 0 {
+                    let mut num: XwSz = buf.len();
+                    rc = xwcq_dq_n(self.cq.get(), buf.as_mut_ptr() as *mut u8, datasz,
+                                   &mut num);
+                    xwcq_put(self.cq.get());
+                    self.dq_n_result(rc, num)
+                } else {
+                    Err(XwcqError::NotInit(rc))
+                }
+            } else {
+                Err(XwcqError::DataSize(-ESIZE))
+            }
+        }
+    }
+
+    /// 限时等待从循环队列的 **首端** 批量接收数据
+    ///
+    /// + 与 [`Xwcq::dq_n()`] 相同，但等待时会指定一个唤醒时间点。
+    /// + 当到达指定的唤醒时间点，线程被唤醒，返回错误码 [`XwcqError::Timedout`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + buf: 接收数据的切片
+    /// + to: 期望唤醒的时间点
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::DataSize`] 数据大小错误
+    /// + [`XwcqError::Interrupt`] 等待被中断
+    /// + [`XwcqError::Timedout`] 等待超时
+    /// + [`XwcqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwcqError::DisPmpt`] 抢占被关闭
+    /// + [`XwcqError::DisBh`] 中断底半部被关闭
+    /// + [`XwcqError::DisIrq`] 中断被关闭
+    pub fn dq_n_to<T>(&self, buf: &mut [T], to: XwTm) -> Result<XwSz, XwcqError>
+    where
+        T: Sized + Send
+    {
+        unsafe {
+            let datasz: XwSz = mem::size_of::<T>();
+            if (datasz <= self.size()) && (datasz > 0) && (buf.len() > 0) {
+                let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+                if rc == 0 {
+                    let mut num: XwSz = buf.len();
+                    rc = xwcq_dq_n_to(self.cq.get(), buf.as_mut_ptr() as *mut u8, datasz,
+                                      &mut num, to);
+                    xwcq_put(self.cq.get());
+                    self.dq_n_result(rc, num)
+                } else {
+                    Err(XwcqError::NotInit(rc))
+                }
+            } else {
+                Err(XwcqError::DataSize(-ESIZE))
+            }
+        }
+    }
+
+    /// 等待从循环队列的 **首端** 批量接收数据，并且等待不可被中断
+    ///
+    /// + 与 [`Xwcq::dq_n()`] 相同，但线程的阻塞等待不可被中断。
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::DataSize`] 数据大小错误
+    /// + [`XwcqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwcqError::DisPmpt`] 抢占被关闭
+    /// + [`XwcqError::DisBh`] 中断底半部被关闭
+    /// + [`XwcqError::DisIrq`] 中断被关闭
+    pub fn dq_n_unintr<T>(&self, buf: &mut [T]) -> Result<XwSz, XwcqError>
+    where
+        T: Sized + Send
+    {
+        unsafe {
+            let datasz: XwSz = mem::size_of::<T>();
+            if (datasz <= self.size()) && (datasz > 0) && (buf.len() > 0) {
+                let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+                if rc == 0 {
+                    let mut num: XwSz = buf.len();
+                    rc = xwcq_dq_n_unintr(self.cq.get(), buf.as_mut_ptr() as *mut u8, datasz,
+                                          &mut num);
+                    xwcq_put(self.cq.get());
+                    self.dq_n_result(rc, num)
+                } else {
+                    Err(XwcqError::NotInit(rc))
+                }
+            } else {
+                Err(XwcqError::DataSize(-ESIZE))
+            }
+        }
+    }
+
+    /// 尝试从循环队列的 **首端** 批量接收数据
+    ///
+    /// + 与 [`Xwcq::dq_n()`] 相同，但若循环队列为空，立即返回 [`XwcqError::NoData`] 。
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwcqError::NotInit`] 循环队列没有初始化
+    /// + [`XwcqError::DataSize`] 数据大小错误
+    /// + [`XwcqError::NoData`] 循环队列中没有数据
+    pub fn trydq_n<T>(&self, buf: &mut [T]) -> Result<XwSz, XwcqError>
+    where
+        T: Sized + Send
+    {
+        unsafe {
+            let datasz: XwSz = mem::size_of::<T>();
+            if (datasz <= self.size()) && (datasz > 0) && (buf.len() > 0) {
+                let mut rc = xwrustffi_xwcq_acquire(self.cq.get(), *self.tik.get());
+                if rc == 0 {
+                    let mut num: XwSz = buf.len();
+                    rc = xwcq_trydq_n(self.cq.get(), buf.as_mut_ptr() as *mut u8, datasz,
+                                      &mut num);
+                    xwcq_put(self.cq.get());
+                    self.dq_n_result(rc, num)
+                } else {
+                    Err(XwcqError::NotInit(rc))
+                }
+            } else {
+                Err(XwcqError::DataSize(-ESIZE))
+            }
+        }
+    }
+
     /// 清空循环队列
     ///
     /// + 当循环队列未初始化，返回错误码 [`XwcqError::NotInit`] 。
@@ -2027,3 +2618,132 @@ where
         }
     }
 }
+
+/// 循环队列中预留的数据槽
+///
+/// 由 [`Xwcq::reserve()`] 返回，可当作 `[u8]` 切片直接写数据槽。
+/// 调用 [`XwcqSlotMut::commit()`] 后，数据槽进入队列；
+/// 调用 [`XwcqSlotMut::cancel()`] 或没有提交就被丢弃时，预留被放弃，写入的数据不会进入队列。
+pub struct XwcqSlotMut<'a, const S: XwSz, const N: XwSz>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    cq: &'a Xwcq<S, N>,
+    slot: *mut u8,
+}
+
+impl<'a, const S: XwSz, const N: XwSz> XwcqSlotMut<'a, S, N>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    /// 提交预留的数据槽
+    ///
+    /// + 提交成功后，数据槽进入队列的 **尾端** ，可被接收。
+    /// + 若循环队列已满，且提交会覆盖被取出的数据槽，返回 [`XwcqError::NoSpace`] 以及 `self` ，
+    ///   数据槽仍然保持预留，可在被取出的数据槽被释放后再次提交。
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    pub fn commit(mut self) -> Result<(), (Self, XwcqError)> {
+        unsafe {
+            let rc = xwcq_commit(self.cq.cq.get());
+            if XWOK == rc {
+                mem::forget(self);
+                Ok(())
+            } else if -ENOSPC == rc {
+                Err((self, XwcqError::NoSpace(rc)))
+            } else {
+                // 预留已被清空循环队列取消，数据槽不再有效
+                self.slot = ptr::null_mut();
+                Err((self, XwcqError::Unknown(rc)))
+            }
+        }
+    }
+
+    /// 放弃预留的数据槽
+    ///
+    /// + 数据槽中已写入的数据被丢弃，循环队列的 **尾端** 保持不变。
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    pub fn cancel(self) {
+        drop(self);
+    }
+}
+
+impl<const S: XwSz, const N: XwSz> Deref for XwcqSlotMut<'_, S, N>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        if self.slot.is_null() {
+            &[]
+        } else {
+            unsafe { slice::from_raw_parts(self.slot, self.cq.size()) }
+        }
+    }
+}
+
+impl<const S: XwSz, const N: XwSz> DerefMut for XwcqSlotMut<'_, S, N>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    fn deref_mut(&mut self) -> &mut [u8] {
+        if self.slot.is_null() {
+            &mut []
+        } else {
+            unsafe { slice::from_raw_parts_mut(self.slot, self.cq.size()) }
+        }
+    }
+}
+
+impl<const S: XwSz, const N: XwSz> Drop for XwcqSlotMut<'_, S, N>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    fn drop(&mut self) {
+        if !self.slot.is_null() {
+            unsafe {
+                xwcq_cancel(self.cq.cq.get());
+            }
+        }
+    }
+}
+
+/// 从循环队列中取出的数据槽
+///
+/// 由 [`Xwcq::peek_slot()`] 等方法返回，可当作 `[u8]` 切片直接读数据槽。
+/// 被丢弃时，数据槽被释放。
+pub struct XwcqSlot<'a, const S: XwSz, const N: XwSz>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    cq: &'a Xwcq<S, N>,
+    slot: *mut u8,
+}
+
+impl<const S: XwSz, const N: XwSz> Deref for XwcqSlot<'_, S, N>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        unsafe { slice::from_raw_parts(self.slot, self.cq.size()) }
+    }
+}
+
+impl<const S: XwSz, const N: XwSz> Drop for XwcqSlot<'_, S, N>
+where
+    [u8; ((S + XWCQ_MM_ALIGN - 1) & (!XWCQ_MM_MSK)) * N]: Sized
+{
+    fn drop(&mut self) {
+        unsafe {
+            xwcq_release_slot(self.cq.cq.get());
+        }
+    }
+}
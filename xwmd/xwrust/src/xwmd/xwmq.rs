@@ -210,6 +210,17 @@
 //! + 当消息队列中有可用的消息时，接收线程会取走一个消息，并释放消息槽。
 //!
 //!
+//! # 批量发送与接收
+//!
+//! 一次发送或接收多条消息，整批消息只操作一次接收队列的锁：
+//!
+//! + [`XwmqTx::eq_n()`] ， [`XwmqTx::eq_n_to()`] ， [`XwmqTx::eq_n_unintr()`] ， [`XwmqTx::tryeq_n()`]
+//!   至少等到一个消息槽，再使用已经空闲的消息槽，将 [`Vec`] 头部的消息依次发送到消息队列的 **尾端** ，
+//!   已发送的消息从 [`Vec`] 中移除，未发送的消息留在 [`Vec`] 中。
+//! + [`XwmqRx::dq_n()`] ， [`XwmqRx::dq_n_to()`] ， [`XwmqRx::dq_n_unintr()`] ， [`XwmqRx::trydq_n()`]
+//!   至少等到一条消息，再从 **首端** 取出已经在队列中的消息，最多 `max` 条，通过 [`Vec`] 返回。
+//!
+//!
 //! # 示例
 //!
 //! [XWOS/xwam/xwrust-example/xwrust_example_xwmq](https://gitee.com/xwos/XWOS/blob/main/xwam/xwrust-example/xwrust_example_xwmq/src/lib.rs)
@@ -297,6 +308,7 @@
 //! [`Ok()`]: <https://doc.rust-lang.org/core/result/enum.Result.html#variant.Ok>
 //! [`Err()`]: <https://doc.rust-lang.org/core/result/enum.Result.html#variant.Err>
 //! [`xwrust::xwmd::xwmq`]: crate::xwmd::xwmq
+//! [`Vec`]: <https://doc.rust-lang.org/alloc/vec/struct.Vec.html>
 
 extern crate core;
 use core::ffi::*;
@@ -307,6 +319,7 @@ use core::marker::PhantomData;
 
 extern crate alloc;
 use alloc::boxed::Box;
+use alloc::vec::Vec;
 
 use crate::types::*;
 use crate::errno::*;
@@ -336,6 +349,22 @@ extern "C" {
     fn xwmq_rq_to(mq: *mut XwmdXwmq, topic: *mut XwSq, data: *mut *mut c_void, to: XwTm) -> XwEr;
     fn xwmq_rq_unintr(mq: *mut XwmdXwmq, topic: *mut XwSq, data: *mut *mut c_void) -> XwEr;
     fn xwmq_tryrq(mq: *mut XwmdXwmq, topic: *mut XwSq, data: *mut *mut c_void) -> XwEr;
+    fn xwmq_eq_n(mq: *mut XwmdXwmq, topic: *const XwSq, data: *const *mut c_void,
+                 num: *mut XwSz) -> XwEr;
+    fn xwmq_eq_n_to(mq: *mut XwmdXwmq, topic: *const XwSq, data: *const *mut c_void,
+                    num: *mut XwSz, to: XwTm) -> XwEr;
+    fn xwmq_eq_n_unintr(mq: *mut XwmdXwmq, topic: *const XwSq, data: *const *mut c_void,
+                        num: *mut XwSz) -> XwEr;
+    fn xwmq_tryeq_n(mq: *mut XwmdXwmq, topic: *const XwSq, data: *const *mut c_void,
+                    num: *mut XwSz) -> XwEr;
+    fn xwmq_dq_n(mq: *mut XwmdXwmq, topic: *mut XwSq, data: *mut *mut c_void,
+                 num: *mut XwSz) -> XwEr;
+    fn xwmq_dq_n_to(mq: *mut XwmdXwmq, topic: *mut XwSq, data: *mut *mut c_void,
+                    num: *mut XwSz, to: XwTm) -> XwEr;
+    fn xwmq_dq_n_unintr(mq: *mut XwmdXwmq, topic: *mut XwSq, data: *mut *mut c_void,
+                        num: *mut XwSz) -> XwEr;
+    fn xwmq_trydq_n(mq: *mut XwmdXwmq, topic: *mut XwSq, data: *mut *mut c_void,
+                    num: *mut XwSz) -> XwEr;
 }
 
 /// 消息队列的错误码
@@ -1136,6 +1165,187 @@ where
             }
         }
     }
+
+    fn eq_n_with<F>(&self, data: &mut Vec<T>, f: F) -> XwmqError
+    where
+        F: FnOnce(*mut XwmdXwmq, *const XwSq, *const *mut c_void, *mut XwSz) -> XwEr
+    {
+        if data.is_empty() {
+            return XwmqError::Ok(XWOK);
+        }
+        unsafe {
+            let mut rc = xwrustffi_xwmq_acquire(self.xwmq.mq.get(), *self.xwmq.tik.get());
+            if rc == 0 {
+                let mut num: XwSz = data.len();
+                let mut topic: Vec<XwSq> = Vec::with_capacity(num);
+                topic.resize(num, 0);
+                let raw: Vec<*mut c_void> = data.drain(..)
+                    .map(|d| Box::into_raw(Box::new(d)) as *mut c_void)
+                    .collect();
+                rc = f(self.xwmq.mq.get(), topic.as_ptr(), raw.as_ptr(), &mut num);
+                xwmq_put(self.xwmq.mq.get());
+                // 未发送的消息放回 `data`
+                for r in &raw[num..] {
+                    data.push(*Box::from_raw(*r as *mut T));
+                }
+                if XWOK == rc {
+                    XwmqError::Ok(rc)
+                } else if -EINTR == rc {
+                    XwmqError::Interrupt(rc)
+                } else if -ETIMEDOUT == rc {
+                    XwmqError::Timedout(rc)
+                } else if -ENOTTHDCTX == rc {
+                    XwmqError::NotThreadContext(rc)
+                } else if -EDISPMPT == rc {
+                    XwmqError::DisPmpt(rc)
+                } else if -EDISBH == rc {
+                    XwmqError::DisBh(rc)
+                } else if -EDISIRQ == rc {
+                    XwmqError::DisIrq(rc)
+                } else if -ENODATA == rc {
+                    XwmqError::NoSlot(rc)
+                } else {
+                    XwmqError::Unknown(rc)
+                }
+            } else {
+                XwmqError::NotInit(rc)
+            }
+        }
+    }
+
+    /// 等待消息槽，成功后将 [`Vec`] 头部的多条消息批量发送到消息队列的 **尾端** （批量入队）
+    ///
+    /// + 当消息队列中没有可用的消息槽可用时，发送线程会阻塞等待。
+    /// + 取得第一个消息槽后不再等待，只使用已经空闲的消息槽，所有消息在一次上锁中加入接收队列。
+    /// + 已发送的消息从 `data` 中移除，未发送的消息按原来的顺序留在 `data` 中。
+    /// + 当发送线程阻塞等待被中断时，返回 [`XwmqError::Interrupt`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + data: 待发送的消息
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::Ok`] 没有错误
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::Interrupt`] 等待被中断
+    /// + [`XwmqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwmqError::DisPmpt`] 抢占被关闭
+    /// + [`XwmqError::DisBh`] 中断底半部被关闭
+    /// + [`XwmqError::DisIrq`] 中断被关闭
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// extern crate alloc;
+    /// use alloc::string::String;
+    /// use alloc::string::ToString;
+    /// use alloc::vec::Vec;
+    ///
+    /// use xwrust::xwmd::xwmq::*;
+    ///
+    /// static MQ: Xwmq<16, String> = Xwmq::new();
+    ///
+    /// pub fn xwrust_example_xwmq() {
+    ///     let (tx, rx) = MQ.init();
+    ///     // ...省略...
+    ///     let mut msgs: Vec<String> = Vec::new();
+    ///     msgs.push("message0".to_string());
+    ///     msgs.push("message1".to_string());
+    ///     while !msgs.is_empty() {
+    ///         tx.eq_n(&mut msgs);
+    ///     }
+    ///     // ...省略...
+    /// }
+    /// ```
+    pub fn eq_n(&self, data: &mut Vec<T>) -> XwmqError {
+        self.eq_n_with(data, |mq, topic, raw, num| unsafe {
+            xwmq_eq_n(mq, topic, raw, num)
+        })
+    }
+
+    /// 限时等待消息槽，成功后将 [`Vec`] 头部的多条消息批量发送到消息队列的 **尾端** （批量入队）
+    ///
+    /// + 与 [`XwmqTx::eq_n()`] 相同，但等待时会指定一个唤醒时间点。
+    /// + 当到达指定的唤醒时间点，线程被唤醒，并返回 [`XwmqError::Timedout`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + data: 待发送的消息
+    /// + to: 期望唤醒的时间点
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::Ok`] 没有错误
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::Interrupt`] 等待被中断
+    /// + [`XwmqError::Timedout`] 等待超时
+    /// + [`XwmqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwmqError::DisPmpt`] 抢占被关闭
+    /// + [`XwmqError::DisBh`] 中断底半部被关闭
+    /// + [`XwmqError::DisIrq`] 中断被关闭
+    pub fn eq_n_to(&self, data: &mut Vec<T>, to: XwTm) -> XwmqError {
+        self.eq_n_with(data, |mq, topic, raw, num| unsafe {
+            xwmq_eq_n_to(mq, topic, raw, num, to)
+        })
+    }
+
+    /// 等待消息槽，且等待不可被中断，成功后将 [`Vec`] 头部的多条消息批量发送到消息队列的 **尾端** （批量入队）
+    ///
+    /// + 与 [`XwmqTx::eq_n()`] 相同，但发送线程的阻塞等待不可被中断。
+    ///
+    /// # 参数说明
+    ///
+    /// + data: 待发送的消息
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::Ok`] 没有错误
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwmqError::DisPmpt`] 抢占被关闭
+    /// + [`XwmqError::DisBh`] 中断底半部被关闭
+    /// + [`XwmqError::DisIrq`] 中断被关闭
+    pub fn eq_n_unintr(&self, data: &mut Vec<T>) -> XwmqError {
+        self.eq_n_with(data, |mq, topic, raw, num| unsafe {
+            xwmq_eq_n_unintr(mq, topic, raw, num)
+        })
+    }
+
+    /// 尝试获取消息槽，成功后将 [`Vec`] 头部的多条消息批量发送到消息队列的 **尾端** （批量入队）
+    ///
+    /// + 与 [`XwmqTx::eq_n()`] 相同，但当消息队列中没有可用的消息槽时，立即返回 [`XwmqError::NoSlot`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + data: 待发送的消息
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::Ok`] 没有错误
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::NoSlot`] 消息队列中没有可用的消息槽
+    pub fn tryeq_n(&self, data: &mut Vec<T>) -> XwmqError {
+        self.eq_n_with(data, |mq, topic, raw, num| unsafe {
+            xwmq_tryeq_n(mq, topic, raw, num)
+        })
+    }
 }
 
 impl<'a, const N: XwSz, T> XwmqRx<'a, N, T>
@@ -1775,4 +1985,180 @@ where
             }
         }
     }
+
+    fn dq_n_with<F>(&self, max: XwSz, f: F) -> Result<Vec<Box<T>>, XwmqError>
+    where
+        F: FnOnce(*mut XwmdXwmq, *mut XwSq, *mut *mut c_void, *mut XwSz) -> XwEr
+    {
+        if max == 0 {
+            return Ok(Vec::new());
+        }
+        unsafe {
+            let mut rc = xwrustffi_xwmq_acquire(self.xwmq.mq.get(), *self.xwmq.tik.get());
+            if rc == 0 {
+                let mut num: XwSz = max;
+                let mut topic: Vec<XwSq> = Vec::with_capacity(max);
+                topic.resize(max, 0);
+                let mut raw: Vec<*mut c_void> = Vec::with_capacity(max);
+                raw.resize(max, ptr::null_mut());
+                rc = f(self.xwmq.mq.get(), topic.as_mut_ptr(), raw.as_mut_ptr(), &mut num);
+                xwmq_put(self.xwmq.mq.get());
+                if XWOK == rc {
+                    let mut msgs: Vec<Box<T>> = Vec::with_capacity(num);
+                    for r in &raw[..num] {
+                        msgs.push(Box::from_raw(*r as *mut T));
+                    }
+                    Ok(msgs)
+                } else if -EINTR == rc {
+                    Err(XwmqError::Interrupt(rc))
+                } else if -ETIMEDOUT == rc {
+                    Err(XwmqError::Timedout(rc))
+                } else if -ENOTTHDCTX == rc {
+                    Err(XwmqError::NotThreadContext(rc))
+                } else if -EDISPMPT == rc {
+                    Err(XwmqError::DisPmpt(rc))
+                } else if -EDISBH == rc {
+                    Err(XwmqError::DisBh(rc))
+                } else if -EDISIRQ == rc {
+                    Err(XwmqError::DisIrq(rc))
+                } else if -ENODATA == rc {
+                    Err(XwmqError::NoMsg(rc))
+                } else {
+                    Err(XwmqError::Unknown(rc))
+                }
+            } else {
+                Err(XwmqError::NotInit(rc))
+            }
+        }
+    }
+
+    /// 等待从消息队列 **首端** 批量接收消息
+    ///
+    /// + 当消息队列中没有消息时，接收线程会阻塞等待。
+    /// + 取得第一条消息后不再等待，取出已经在队列中的消息，最多 `max` 条，
+    ///   所有消息在一次上锁中离开接收队列，并释放消息槽。
+    /// + 消息按离队的顺序放入 [`Vec`] 中，然后通过 [`Ok()`] 返回。
+    /// + 当线程阻塞等待被中断时，通过 [`Err()`] 返回 [`XwmqError::Interrupt`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + max: 最多接收的消息数量
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::Interrupt`] 等待被中断
+    /// + [`XwmqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwmqError::DisPmpt`] 抢占被关闭
+    /// + [`XwmqError::DisBh`] 中断底半部被关闭
+    /// + [`XwmqError::DisIrq`] 中断被关闭
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// extern crate alloc;
+    /// use alloc::string::String;
+    ///
+    /// use xwrust::xwmd::xwmq::*;
+    ///
+    /// static MQ: Xwmq<16, String> = Xwmq::new();
+    ///
+    /// pub fn xwrust_example_xwmq() {
+    ///     let (tx, rx) = MQ.init();
+    ///     // ...省略...
+    ///     match rx.dq_n(8) {
+    ///         Ok(msgs) => {
+    ///             for msg in msgs {
+    ///             }
+    ///         },
+    ///         Err(e) => {
+    ///         },
+    ///     };
+    /// }
+    /// ```
+    pub fn dq_n(&self, max: XwSz) -> Result<Vec<Box<T>>, XwmqError> {
+        self.dq_n_with(max, |mq, topic, raw, num| unsafe {
+            xwmq_dq_n(mq, topic, raw, num)
+        })
+    }
+
+    /// 限时等待从消息队列 **首端** 批量接收消息
+    ///
+    /// + 与 [`XwmqRx::dq_n()`] 相同，但等待时会指定一个唤醒时间点。
+    /// + 当到达指定的唤醒时间点，线程被唤醒，并通过 [`Err()`] 返回 [`XwmqError::Timedout`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + max: 最多接收的消息数量
+    /// + to: 期望唤醒的时间点
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::Interrupt`] 等待被中断
+    /// + [`XwmqError::Timedout`] 等待超时
+    /// + [`XwmqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwmqError::DisPmpt`] 抢占被关闭
+    /// + [`XwmqError::DisBh`] 中断底半部被关闭
+    /// + [`XwmqError::DisIrq`] 中断被关闭
+    pub fn dq_n_to(&self, max: XwSz, to: XwTm) -> Result<Vec<Box<T>>, XwmqError> {
+        self.dq_n_with(max, |mq, topic, raw, num| unsafe {
+            xwmq_dq_n_to(mq, topic, raw, num, to)
+        })
+    }
+
+    /// 等待从消息队列 **首端** 批量接收消息，且等待不可被中断
+    ///
+    /// + 与 [`XwmqRx::dq_n()`] 相同，但接收线程的阻塞等待不可被中断。
+    ///
+    /// # 参数说明
+    ///
+    /// + max: 最多接收的消息数量
+    ///
+    /// # 上下文
+    ///
+    /// + 线程
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::NotThreadContext`] 不在线程上下文内
+    /// + [`XwmqError::DisPmpt`] 抢占被关闭
+    /// + [`XwmqError::DisBh`] 中断底半部被关闭
+    /// + [`XwmqError::DisIrq`] 中断被关闭
+    pub fn dq_n_unintr(&self, max: XwSz) -> Result<Vec<Box<T>>, XwmqError> {
+        self.dq_n_with(max, |mq, topic, raw, num| unsafe {
+            xwmq_dq_n_unintr(mq, topic, raw, num)
+        })
+    }
+
+    /// 尝试从消息队列 **首端** 批量接收消息
+    ///
+    /// + 与 [`XwmqRx::dq_n()`] 相同，但当消息队列中没有消息时，立即通过 [`Err()`] 返回 [`XwmqError::NoMsg`] 。
+    ///
+    /// # 参数说明
+    ///
+    /// + max: 最多接收的消息数量
+    ///
+    /// # 上下文
+    ///
+    /// + 任意
+    ///
+    /// # 错误码
+    ///
+    /// + [`XwmqError::NotInit`] 消息队列没有初始化
+    /// + [`XwmqError::NoMsg`] 消息队列中没有消息
+    pub fn trydq_n(&self, max: XwSz) -> Result<Vec<Box<T>>, XwmqError> {
+        self.dq_n_with(max, |mq, topic, raw, num| unsafe {
+            xwmq_trydq_n(mq, topic, raw, num)
+        })
+    }
 }
@@ -0,0 +1,212 @@
+//! XWOS RUST：竞技场分配器
+//! ========
+//!
+//! 竞技场分配器从 `xwrust_mempool` 申请大块内存，然后在块内按顺序切割出小块内存。
+//! 单个对象不能被释放，但可以通过 [`Arena::mark()`] 与 [`Arena::rewind()`]
+//! 一次性释放标记之后申请的所有内存，或通过 [`Arena::reset()`] 一次性释放全部内存。
+//!
+//! 竞技场分配器适合生命周期相同的短期对象，例如解析报文、组装协议数据单元。
+//!
+//! [`Arena`] 实现了 [`GlobalAlloc`] ，可以直接调用 `alloc()` 申请内存，`dealloc()` 是空操作。
+//! 竞技场分配器不是线程安全的，只能由一个线程使用。
+//!
+//!
+//! # 示例
+//!
+//! ```rust
+//! use core::alloc::{GlobalAlloc, Layout};
+//! use xwrust::xwmm::arena::*;
+//!
+//! pub fn xwrust_example_arena() {
+//!     let arena = Arena::new();
+//!     arena.init(2048);
+//!     arena.scope(|| {
+//!         let buf = unsafe { arena.alloc(Layout::from_size_align(512, 8).unwrap()) };
+//!         // 使用buf
+//!     }); // 离开作用域时，buf被释放
+//! }
+//! ```
+//!
+//! [`GlobalAlloc`]: <https://doc.rust-lang.org/core/alloc/trait.GlobalAlloc.html>
+
+extern crate core;
+use core::ffi::*;
+use core::ptr;
+use core::cell::UnsafeCell;
+use core::alloc::{GlobalAlloc, Layout};
+
+use crate::types::*;
+
+extern "C" {
+    fn xwrustffi_arena_init(arena: *mut XwmmArena, blksize: XwSz) -> XwEr;
+    fn xwrustffi_arena_alloc(arena: *mut XwmmArena, alignment: XwSz, size: XwSz) -> *mut c_void;
+    fn xwrustffi_arena_mark(arena: *mut XwmmArena, mark: *mut ArenaMark);
+    fn xwrustffi_arena_rewind(arena: *mut XwmmArena, mark: *const ArenaMark) -> XwEr;
+    fn xwrustffi_arena_reset(arena: *mut XwmmArena);
+    fn xwrustffi_arena_release(arena: *mut XwmmArena);
+    fn xwrustffi_arena_get_used(arena: *mut XwmmArena) -> XwSz;
+    fn xwrustffi_arena_cthd_set(arena: *mut XwmmArena) -> XwEr;
+}
+
+/// XWOS竞技场分配器对象占用的内存大小
+#[cfg(target_pointer_width = "32")]
+pub const SIZEOF_XWMM_ARENA: usize = 32;
+
+/// XWOS竞技场分配器对象占用的内存大小
+#[cfg(target_pointer_width = "64")]
+pub const SIZEOF_XWMM_ARENA: usize = 64;
+
+/// 用于构建竞技场分配器的内存数组类型
+#[repr(C)]
+#[cfg_attr(target_pointer_width = "32", repr(align(8)))]
+#[cfg_attr(target_pointer_width = "64", repr(align(16)))]
+pub(crate) struct XwmmArena {
+    pub(crate) obj: [u8; SIZEOF_XWMM_ARENA],
+}
+
+/// 竞技场标记
+#[repr(C)]
+pub struct ArenaMark {
+    blk: *mut c_void,
+    pos: XwSz,
+    used: XwSz,
+}
+
+impl ArenaMark {
+    const fn new() -> Self {
+        Self {
+            blk: ptr::null_mut(),
+            pos: 0,
+            used: 0,
+        }
+    }
+}
+
+/// 竞技场分配器对象结构体
+pub struct Arena {
+    /// 用于初始化XWOS竞技场分配器对象的内存空间
+    pub(crate) arena: UnsafeCell<XwmmArena>,
+}
+
+impl !Send for Arena {}
+impl !Sync for Arena {}
+
+impl Drop for Arena {
+    fn drop(&mut self) {
+        unsafe {
+            xwrustffi_arena_release(self.arena.get());
+        }
+    }
+}
+
+impl Arena {
+    /// 新建竞技场分配器对象
+    ///
+    /// 此方法是编译期方法。
+    pub const fn new() -> Self {
+        Self {
+            arena: UnsafeCell::new(XwmmArena { obj: [0; SIZEOF_XWMM_ARENA] }),
+        }
+    }
+
+    /// 初始化竞技场分配器对象
+    ///
+    /// 竞技场分配器对象必须调用此方法一次，方可正常使用。
+    ///
+    /// # 参数说明
+    ///
+    /// + blksize: 每次向 `xwrust_mempool` 申请的内存块的最小大小
+    ///
+    /// # 错误码
+    ///
+    /// + [`-ENOSYS`] 未配置 `XWMMCFG_ARENA`
+    ///
+    /// [`-ENOSYS`]: crate::errno::ENOSYS
+    pub fn init(&self, blksize: XwSz) -> XwEr {
+        unsafe {
+            xwrustffi_arena_init(self.arena.get(), blksize)
+        }
+    }
+
+    /// 标记竞技场分配器的当前位置
+    pub fn mark(&self) -> ArenaMark {
+        let mut mark = ArenaMark::new();
+        unsafe {
+            xwrustffi_arena_mark(self.arena.get(), &mut mark);
+        }
+        mark
+    }
+
+    /// 将竞技场分配器回滚到标记的位置
+    ///
+    /// 标记之后申请的所有内存都被释放。
+    ///
+    /// # Safety
+    ///
+    /// 调用者必须保证标记之后申请的内存不再被使用。
+    pub unsafe fn rewind(&self, mark: &ArenaMark) -> XwEr {
+        xwrustffi_arena_rewind(self.arena.get(), mark)
+    }
+
+    /// 在作用域内执行闭包 `f` ，返回时回滚到进入作用域时的位置
+    ///
+    /// 闭包内申请的内存不可被带出作用域。
+    pub fn scope<R, F: FnOnce() -> R>(&self, f: F) -> R {
+        let mark = self.mark();
+        let r = f();
+        unsafe {
+            self.rewind(&mark);
+        }
+        r
+    }
+
+    /// 复位竞技场分配器
+    ///
+    /// 释放所有已经分配的内存，保留第一块内存块。
+    ///
+    /// # Safety
+    ///
+    /// 调用者必须保证之前申请的内存不再被使用。
+    pub unsafe fn reset(&self) {
+        xwrustffi_arena_reset(self.arena.get());
+    }
+
+    /// 获取已经分配出去的内存的总大小
+    pub fn used(&self) -> XwSz {
+        unsafe {
+            xwrustffi_arena_get_used(self.arena.get())
+        }
+    }
+
+    /// 设置为当前线程默认的竞技场分配器
+    ///
+    /// C代码可通过 `xwmm_arena_cthd_alloc()` 从此竞技场分配器中申请内存。
+    /// 竞技场分配器被释放之前，必须调用 [`Arena::cthd_clear()`] 。
+    ///
+    /// # 错误码
+    ///
+    /// + [`-ENOSYS`] 未配置 `XWMMCFG_ARENA_CTHD`
+    ///
+    /// [`-ENOSYS`]: crate::errno::ENOSYS
+    pub fn cthd_set(&self) -> XwEr {
+        unsafe {
+            xwrustffi_arena_cthd_set(self.arena.get())
+        }
+    }
+
+    /// 清除当前线程默认的竞技场分配器
+    pub fn cthd_clear() -> XwEr {
+        unsafe {
+            xwrustffi_arena_cthd_set(ptr::null_mut())
+        }
+    }
+}
+
+unsafe impl GlobalAlloc for Arena {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        xwrustffi_arena_alloc(self.arena.get(), layout.align(), layout.size()) as *mut _
+    }
+
+    unsafe fn dealloc(&self, _ptr: *mut u8, _layout: Layout) {
+    }
+}
@@ -3,3 +3,5 @@
 //!
 
 pub mod allocator;
+
+pub mod arena;
@@ -7,5 +7,6 @@ pub mod pm;
 pub mod thd;
 pub mod cthd;
 pub mod swt;
+pub mod workq;
 pub mod lock;
 pub mod sync;
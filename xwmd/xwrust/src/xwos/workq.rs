@@ -0,0 +1,277 @@
+//! XWOS RUST：工作队列
+//! ========
+//!
+//! XWOS RUST的工作队列是基于XWOS MP内核中的系统工作队列来实现的，只有XWOS MP内核支持。
+//!
+//! 与软件定时器不同，工作的 **回调函数** 运行在工作线程的上下文中，可以使用会导致阻塞睡眠的方法，
+//! 因此适合将中断中耗时的处理推迟到线程中执行。
+//!
+//! 与软件定时器相同，编译器无法获知 **回调函数** 什么时候会执行，
+//! 因此工作对象只能定义为静态生命周期的全局变量，工作的 **回调函数** 只能是 [`fn`] 或什么也不捕获的 [`Fn()`] 。
+//!
+//!
+//! # 创建
+//!
+//! XWOS RUST的工作可使用 [`Work::new()`] 创建。只能创建具有静态生命周期 [`static`] 约束的全局变量：
+//!
+//! ```rust
+//! use xwrust::xwos::workq::*;
+//! use xwrust::xwos::lock::spinlock::*;
+//!
+//! static WORK: Work<Spinlock<u32>> = Work::new(Spinlock::new(1));
+//! ```
+//!
+//!
+//! # 入队
+//!
+//! + [`Work::queue()`] 将工作加入本地CPU的队列；
+//! + [`Work::queue_on()`] 将工作加入指定CPU的队列；
+//! + [`Work::queue_delayed()`] 延迟一段时间后将工作加入本地CPU的队列。
+//!
+//! 入队方法可以在中断中调用。
+//!
+//!
+//! # 取消与等待
+//!
+//! + [`Work::cancel()`] 取消还未执行的工作；
+//! + [`Work::flush()`] 等待工作执行完成；
+//! + [`flush()`] 等待系统工作队列中所有已经入队的工作执行完成。
+//!
+//!
+//! [`fn`]: https://doc.rust-lang.org/std/keyword.fn.html
+//! [`Fn()`]: https://doc.rust-lang.org/core/ops/trait.Fn.html
+//! [`static`]: <https://doc.rust-lang.org/std/keyword.static.html>
+
+extern crate core;
+use core::ffi::*;
+use core::option::Option;
+use core::cell::UnsafeCell;
+use core::convert::AsRef;
+use core::convert::AsMut;
+
+use crate::types::*;
+
+extern "C" {
+    fn xwrustffi_work_init(work: *mut XwosWork,
+                           func: extern "C" fn(*mut XwosWork, *mut c_void),
+                           arg: *mut c_void);
+    fn xwrustffi_work_queue(work: *mut XwosWork) -> XwEr;
+    fn xwrustffi_work_queue_on(work: *mut XwosWork, cpuid: XwId) -> XwEr;
+    fn xwrustffi_work_queue_delayed(work: *mut XwosWork, delay: XwTm) -> XwEr;
+    fn xwrustffi_work_cancel(work: *mut XwosWork) -> XwEr;
+    fn xwrustffi_work_flush(work: *mut XwosWork) -> XwEr;
+    fn xwrustffi_work_tst_busy(work: *mut XwosWork) -> bool;
+    fn xwrustffi_workq_flush() -> XwEr;
+}
+
+/// XWOS工作对象占用的内存大小
+#[cfg(target_pointer_width = "32")]
+pub const SIZEOF_XWOS_WORK: usize = 80;
+
+/// XWOS工作对象占用的内存大小
+#[cfg(target_pointer_width = "64")]
+pub const SIZEOF_XWOS_WORK: usize = 144;
+
+/// 用于构建工作的内存数组类型
+#[repr(C)]
+#[cfg_attr(target_pointer_width = "32", repr(align(8)))]
+#[cfg_attr(target_pointer_width = "64", repr(align(16)))]
+pub(crate) struct XwosWork {
+    pub(crate) obj: [u8; SIZEOF_XWOS_WORK],
+}
+
+/// 用于构建工作的内存数组常量
+///
+/// 此常量的作用是告诉编译器工作对象需要多大的内存。
+pub(crate) const XWOS_WORK_INITIALIZER: XwosWork = XwosWork {
+    obj: [0; SIZEOF_XWOS_WORK],
+};
+
+/// 工作对象结构体
+pub struct Work<T> {
+    /// 用于初始化XWOS工作对象的内存空间
+    pub(crate) work: UnsafeCell<XwosWork>,
+    /// 回调函数
+    pub(crate) cb: UnsafeCell<Option<fn(&Self)>>,
+    /// 数据
+    pub(crate) data: UnsafeCell<T>,
+}
+
+impl<T> !Send for Work<T> {}
+
+unsafe impl<T> Sync for Work<T> {}
+
+impl<T> Work<T> {
+    /// 新建工作对象
+    ///
+    /// 此方法是编译期方法。
+    ///
+    /// # 参数说明
+    ///
+    /// + d: 工作附带的数据
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// use xwrust::xwos::workq::*;
+    ///
+    /// static WORK: Work<u32> = Work::new(0);
+    /// ```
+    pub const fn new(d: T) -> Self {
+        Self {
+            work: UnsafeCell::new(XWOS_WORK_INITIALIZER),
+            cb: UnsafeCell::new(None),
+            data: UnsafeCell::new(d),
+        }
+    }
+
+    /// 设置工作的回调函数
+    ///
+    /// 工作对象必须调用此方法一次，方可入队。
+    /// 工作在队列中或正在执行时，不可调用此方法。
+    ///
+    /// `cb` 运行在工作线程的上下文中，只能是函数或不捕获任何东西的闭包。
+    ///
+    /// # 示例
+    ///
+    /// ```rust
+    /// pub fn xwrust_example_workq() {
+    ///     WORK.init(|work| {
+    ///         // 回调函数
+    ///     });
+    ///     WORK.queue();
+    /// }
+    /// ```
+    pub fn init(&'static self, cb: fn(&Work<T>)) {
+        unsafe {
+            *self.cb.get() = Some(cb);
+            xwrustffi_work_init(self.work.get(),
+                                Work::<T>::xwrustffi_work_callback_entry,
+                                self as *const Work<T> as _);
+        }
+    }
+
+    extern "C" fn xwrustffi_work_callback_entry(_: *mut XwosWork, arg: *mut c_void) {
+        unsafe {
+            let work: &Work<T> = &*(arg as *const Work<T>);
+            if let Some(cb) = *work.cb.get() {
+                cb(work);
+            }
+        }
+    }
+
+    /// 将工作加入本地CPU的队列
+    ///
+    /// 此方法可以在中断中调用。
+    ///
+    /// # 错误码
+    ///
+    /// + [`XWOK`] 没有错误
+    /// + [`-EALREADY`] 工作已经在队列中或正在延迟
+    ///
+    /// [`XWOK`]: crate::errno::XWOK
+    /// [`-EALREADY`]: crate::errno::EALREADY
+    pub fn queue(&'static self) -> XwEr {
+        unsafe {
+            xwrustffi_work_queue(self.work.get())
+        }
+    }
+
+    /// 将工作加入指定CPU的队列
+    ///
+    /// # 参数说明
+    ///
+    /// + cpuid: CPU ID
+    ///
+    /// # 错误码
+    ///
+    /// + [`XWOK`] 没有错误
+    /// + [`-ENODEV`] CPU ID错误
+    /// + [`-EALREADY`] 工作已经在队列中或正在延迟
+    ///
+    /// [`XWOK`]: crate::errno::XWOK
+    /// [`-ENODEV`]: crate::errno::ENODEV
+    /// [`-EALREADY`]: crate::errno::EALREADY
+    pub fn queue_on(&'static self, cpuid: XwId) -> XwEr {
+        unsafe {
+            xwrustffi_work_queue_on(self.work.get(), cpuid)
+        }
+    }
+
+    /// 延迟 `delay` 后将工作加入本地CPU的队列
+    ///
+    /// # 参数说明
+    ///
+    /// + delay: 延迟的时间
+    ///
+    /// # 错误码
+    ///
+    /// + [`XWOK`] 没有错误
+    /// + [`-EALREADY`] 工作已经在队列中或正在延迟
+    ///
+    /// [`XWOK`]: crate::errno::XWOK
+    /// [`-EALREADY`]: crate::errno::EALREADY
+    pub fn queue_delayed(&'static self, delay: XwTm) -> XwEr {
+        unsafe {
+            xwrustffi_work_queue_delayed(self.work.get(), delay)
+        }
+    }
+
+    /// 取消工作
+    ///
+    /// 此方法不会等待正在执行的回调函数返回，需要等待时，可再调用 [`Work::flush()`] 。
+    ///
+    /// # 错误码
+    ///
+    /// + [`XWOK`] 没有错误
+    /// + [`-ESRCH`] 工作不在队列中，也没有在延迟
+    ///
+    /// [`XWOK`]: crate::errno::XWOK
+    /// [`-ESRCH`]: crate::errno::ESRCH
+    pub fn cancel(&'static self) -> XwEr {
+        unsafe {
+            xwrustffi_work_cancel(self.work.get())
+        }
+    }
+
+    /// 等待工作执行完成
+    ///
+    /// 不能在工作自己的回调函数中调用此方法，否则会死锁。
+    pub fn flush(&'static self) -> XwEr {
+        unsafe {
+            xwrustffi_work_flush(self.work.get())
+        }
+    }
+
+    /// 测试工作是否在队列中、正在延迟或正在执行
+    pub fn is_busy(&'static self) -> bool {
+        unsafe {
+            xwrustffi_work_tst_busy(self.work.get())
+        }
+    }
+}
+
+impl<T> AsRef<T> for Work<T> {
+    fn as_ref(&self) -> &T {
+        unsafe {
+            &*self.data.get()
+        }
+    }
+}
+
+impl<T> AsMut<T> for Work<T> {
+    fn as_mut(&mut self) -> &mut T {
+        unsafe {
+            &mut *self.data.get()
+        }
+    }
+}
+
+/// 等待系统工作队列中所有已经入队的工作执行完成
+///
+/// 不能在工作的回调函数中调用此方法，否则会死锁。
+pub fn flush() -> XwEr {
+    unsafe {
+        xwrustffi_workq_flush()
+    }
+}
@@ -0,0 +1,40 @@
+/**
+ * @file
+ * @brief xwos::Work
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#include "xwos/cxx/Work.hxx"
+
+namespace xwos {
+
+/* Non-static Member */
+Work::Work()
+{
+    xwos_work_init(&mWork, (xwos_work_f)sWorkFunction, this);
+}
+
+Work::~Work()
+{
+    xwos_work_cancel(&mWork);
+    xwos_work_flush(&mWork);
+}
+
+void Work::workFunction()
+{
+}
+
+/* Static Member */
+void Work::sWorkFunction(struct xwos_work * work, Work * obj)
+{
+    XWOS_UNUSED(work);
+    obj->workFunction();
+}
+
+} // namespace xwos
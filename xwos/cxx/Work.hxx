@@ -0,0 +1,143 @@
+/**
+ * @file
+ * @brief xwos::Work
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_cxx_Work_hxx__
+#define __xwos_cxx_Work_hxx__
+
+#include <xwos/osal/workq.hxx>
+#include <xwos/osal/skd.hxx>
+#include <xwos/osal/thd.hxx>
+
+namespace xwos {
+
+/**
+ * @defgroup xwos_cxx_Workq_Work 工作
+ * @ingroup xwos_cxx_Workq
+ *
+ * 用户需要继承 `Work` 并重新实现 `workFunction()` 。
+ *
+ *
+ * ## 头文件
+ *
+ * @ref xwos/cxx/Work.hxx
+ *
+ * @{
+ */
+
+/**
+ * @brief 工作
+ */
+class Work
+{
+  private:
+    struct xwos_work mWork; /**< 工作结构体 */
+
+  public:
+    Work(); /**< 构造函数 */
+    virtual ~Work(); /**< 析构函数：取消工作并等待工作函数返回 */
+    /**
+     * @brief 将工作加入本地CPU的队列
+     * @param[in] wq: 工作队列，默认值：系统工作队列
+     */
+    xwer_t queue(struct xwos_workq * wq = xwos_workq_get_sys())
+    {
+        return xwos_work_queue(wq, &mWork);
+    }
+    /**
+     * @brief 将工作加入指定CPU的队列
+     * @param[in] cpuid: CPU ID
+     * @param[in] wq: 工作队列，默认值：系统工作队列
+     */
+    xwer_t queueOn(xwid_t cpuid, struct xwos_workq * wq = xwos_workq_get_sys())
+    {
+        return xwos_work_queue_on(wq, cpuid, &mWork);
+    }
+    /**
+     * @brief 延迟一段时间后将工作加入指定CPU的队列
+     * @param[in] delay: 延迟的时间
+     * @param[in] cpuid: CPU ID，默认值：本地CPU
+     * @param[in] wq: 工作队列，默认值：系统工作队列
+     */
+    xwer_t queueDelayed(xwtm_t delay, xwid_t cpuid = xwos_skd_get_cpuid_lc(),
+                        struct xwos_workq * wq = xwos_workq_get_sys())
+    {
+        return xwos_work_queue_delayed(wq, cpuid, &mWork, delay);
+    }
+    xwer_t cancel() { return xwos_work_cancel(&mWork); } /**< 取消工作 */
+    xwer_t flush() { return xwos_work_flush(&mWork); } /**< 等待工作执行完成 */
+    bool isBusy() { return xwos_work_tst_busy(&mWork); } /**< 测试工作是否还未完成 */
+    struct xwos_work * getXwosObj() { return &mWork; } /**< 获取XWOS对象指针 */
+
+  protected:
+    virtual void workFunction(); /**< 工作函数，用户需要重新实现此函数 */
+
+  private:
+    static void sWorkFunction(struct xwos_work * work, Work * obj);
+};
+
+/**
+ * @} xwos_cxx_Workq_Work
+ */
+
+/**
+ * @defgroup xwos_cxx_Workq_SWorkq 静态工作队列
+ * @ingroup xwos_cxx_Workq
+ *
+ * 静态工作队列是指工作线程栈的内存在编译期由编译器分配。
+ *
+ *
+ * ## 头文件
+ *
+ * @ref xwos/cxx/Work.hxx
+ *
+ * @{
+ */
+
+/**
+ * @brief 静态工作队列
+ * @tparam TStackSize 每个工作线程栈的大小
+ */
+template<xwsz_t TStackSize = XWOS_STACK_SIZE_DEFAULT>
+class SWorkq
+{
+  private:
+    struct xwos_workq mWorkq; /**< 工作队列结构体 */
+    xwstk_t mStack[CPUCFG_CPU_NUM][TStackSize / sizeof(xwstk_t)]
+        __xwcc_alignl1cache; /**< 工作线程栈 */
+    xwer_t mCtorRc; /**< 工作队列构造的结果 */
+
+  public:
+    /**
+     * @brief 构造函数
+     * @param[in] name: 名字
+     * @param[in] prio: 工作线程的优先级
+     */
+    SWorkq(const char * name, xwpr_t prio)
+    {
+        mCtorRc = xwos_workq_init(&mWorkq, name, prio, &mStack[0][0], TStackSize);
+    }
+    xwer_t getCtorRc() { return mCtorRc; } /**< 获取工作队列构造的结果 */
+    xwer_t flush() { return xwos_workq_flush(&mWorkq); } /**< 等待所有工作执行完成 */
+    struct xwos_workq * getXwosObj() { return &mWorkq; } /**< 获取XWOS对象指针 */
+
+  private:
+    static void * operator new(xwsz_t sz) = delete;
+    void operator delete(void * obj) = delete;
+};
+
+/**
+ * @} xwos_cxx_Workq_SWorkq
+ */
+
+} // namespace xwos
+
+#endif /* xwos/cxx/Work.hxx */
@@ -61,6 +61,11 @@ ifeq ($(XWOSCFG_SKD_SWT_CXX), y)
   endif
 endif
 
+######## ######## ######## ######## Workq ######## ######## ######## ########
+ifeq ($(XWOSCFG_SKD_WORKQ_CXX), y)
+  XWOS_CXXSRCS += cxx/Work.cxx
+endif
+
 ######## ######## ######## ######## Lock ######## ######## ######## ########
 ifeq ($(XWOSCFG_LOCK_MTX_CXX), y)
   XWOS_CXXSRCS += cxx/lock/Mtx.cxx
@@ -0,0 +1,188 @@
+/**
+ * @file
+ * @brief xwos::mm::Arena
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_cxx_mm_Arena_hxx__
+#define __xwos_cxx_mm_Arena_hxx__
+
+#if __cplusplus < 201703L
+#  error "std::pmr::memory_resource requires C++17 or later C++ standard!"
+#endif
+
+extern "C" {
+#include <xwos/standard.h>
+#include <xwos/mm/arena.h>
+}
+#include <memory_resource>
+
+namespace xwos {
+namespace mm {
+
+/**
+ * @defgroup xwos_cxx_mm_Arena 竞技场分配器
+ * @ingroup xwos_cxx_mm
+ *
+ * 竞技场分配器的C++封装，实现了 `std::pmr::memory_resource` ，
+ * 可作为 `std::pmr` 容器的内存资源：
+ *
+ * ```C++
+ * xwos::mm::Arena arena("req", mempool, 2048);
+ * {
+ *     xwos::mm::Arena::Scope scope(arena);
+ *     std::pmr::vector<xwu8_t> sdu(&arena);
+ *     // ...
+ * } // 离开作用域时，回滚到进入作用域时的位置
+ * ```
+ *
+ * + `deallocate()` 是空操作，内存只能通过 `rewind()` 、 `reset()` 或
+ *   `Arena::Scope` 批量释放；
+ * + 竞技场分配器不是线程安全的。
+ *
+ *
+ * ## 头文件
+ *
+ * @ref xwos/cxx/mm/Arena.hxx
+ *
+ * @{
+ */
+
+/**
+ * @brief 竞技场分配器
+ */
+class Arena : public std::pmr::memory_resource
+{
+  public:
+    /**
+     * @brief 作用域标记，析构时将竞技场分配器回滚到构造时的位置
+     */
+    class Scope
+    {
+      private:
+        Arena & mArena;
+        struct xwmm_arena_mark mMark;
+
+      public:
+        explicit Scope(Arena & arena) : mArena(arena) { mArena.mark(&mMark); }
+        ~Scope() { mArena.rewind(&mMark); }
+        Scope(const Scope &) = delete;
+        Scope & operator=(const Scope &) = delete;
+    };
+
+  private:
+    struct xwmm_arena mArena;
+    xwer_t mCtorRc;
+
+  public:
+    /**
+     * @brief 构造函数
+     * @param[in] name: 名字
+     * @param[in] parent: 上级分配器
+     * @param[in] alloc: 上级分配器的申请函数
+     * @param[in] free: 上级分配器的释放函数
+     * @param[in] blksize: 每次向上级分配器申请的内存块的最小大小
+     */
+    Arena(const char * name, void * parent,
+          xwmm_arena_alloc_f alloc, xwmm_arena_free_f free, xwsz_t blksize)
+    {
+        mCtorRc = xwmm_arena_init(&mArena, name, parent, alloc, free, blksize);
+    }
+#if defined(XWMMCFG_MEMPOOL) && (1 == XWMMCFG_MEMPOOL)
+    /**
+     * @brief 构造函数：以内存池作为上级分配器
+     * @param[in] name: 名字
+     * @param[in] mp: 内存池的指针
+     * @param[in] blksize: 每次向内存池申请的内存块的最小大小
+     */
+    Arena(const char * name, struct xwmm_mempool * mp, xwsz_t blksize)
+    {
+        mCtorRc = xwmm_arena_init_mempool(&mArena, name, mp, blksize);
+    }
+#endif
+#if defined(XWMMCFG_BMA) && (1 == XWMMCFG_BMA)
+    /**
+     * @brief 构造函数：以伙伴算法内存块分配器作为上级分配器
+     * @param[in] name: 名字
+     * @param[in] bma: 伙伴算法内存块分配器的指针
+     * @param[in] blksize: 每次申请的内存块的最小大小
+     */
+    Arena(const char * name, struct xwmm_bma * bma, xwsz_t blksize)
+    {
+        mCtorRc = xwmm_arena_init_bma(&mArena, name, bma, blksize);
+    }
+#endif
+    ~Arena() { xwmm_arena_release(&mArena); } /**< 析构函数，归还所有内存块 */
+    Arena(const Arena &) = delete;
+    Arena & operator=(const Arena &) = delete;
+
+    xwer_t getCtorRc() { return mCtorRc; } /**< 获取构造的结果 */
+    void mark(struct xwmm_arena_mark * mk) { xwmm_arena_mark(&mArena, mk); } /**< 标记 */
+    xwer_t rewind(const struct xwmm_arena_mark * mk) /**< 回滚到标记 */
+    {
+        return xwmm_arena_rewind(&mArena, mk);
+    }
+    void reset() { xwmm_arena_reset(&mArena); } /**< 复位 */
+    void release() { xwmm_arena_release(&mArena); } /**< 归还所有内存块 */
+    xwsz_t used() { return xwmm_arena_get_used(&mArena); } /**< 已分配的内存 */
+    xwsz_t total() { return xwmm_arena_get_total(&mArena); } /**< 内存块的总大小 */
+#if defined(XWMMCFG_ARENA_CTHD) && (1 == XWMMCFG_ARENA_CTHD)
+    /**
+     * @brief 设置为当前线程默认的竞技场分配器
+     */
+    xwer_t setAsCthdDefault() { return xwmm_arena_cthd_set(&mArena); }
+#endif
+    struct xwmm_arena * getXwmmObj() { return &mArena; } /**< 获取C对象指针 */
+
+  protected:
+    /**
+     * @brief 申请内存
+     * @details
+     * + 工程可能以 `-fno-exceptions` 编译，申请失败时返回 `nullptr` ，不抛出异常；
+     * + 申请 `0` 字节时返回一个有效的地址。
+     */
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void * mem;
+        xwer_t rc;
+
+        if (alignment < XWMM_ALIGNMENT) {
+            alignment = 0;
+        }
+        if (0 == bytes) {
+            bytes = 1;
+        }
+        rc = xwmm_arena_alloc(&mArena, bytes, alignment, &mem);
+        if (rc < 0) {
+            mem = nullptr;
+        }
+        return mem;
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        XWOS_UNUSED(p);
+        XWOS_UNUSED(bytes);
+        XWOS_UNUSED(alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+/**
+ * @} xwos_cxx_mm_Arena
+ */
+
+} // namespace mm
+} // namespace xwos
+
+#endif /* xwos/cxx/mm/Arena.hxx */
@@ -0,0 +1,167 @@
+/**
+ * @file
+ * @brief XWOS通用库：CRC16
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_lib_crc16_h__
+#define __xwos_lib_crc16_h__
+
+#include <xwos/standard.h>
+
+/**
+ * @defgroup xwos_lib_crc16 CRC16
+ * @ingroup xwos_lib
+ * 常用的CRC16参数模型：
+ *
+ * | 模型                  | 多项式 | 初始值 | refin | refout | xorout | 用途              |
+ * | :-------------------- | :----: | :----: | :---: | :----: | :----: | :---------------- |
+ * | CRC-16/CCITT-FALSE    | 0x1021 | 0xFFFF | 否    | 否     | 0x0000 | 存储头部          |
+ * | CRC-16/XMODEM         | 0x1021 | 0x0000 | 否    | 否     | 0x0000 | SD卡数据块、XMODEM |
+ * | CRC-16/KERMIT         | 0x1021 | 0x0000 | 是    | 是     | 0x0000 | CCITT的镜像模型   |
+ * | CRC-16/MODBUS         | 0x8005 | 0xFFFF | 是    | 是     | 0x0000 | Modbus RTU        |
+ * | CRC-16/IBM(ARC)       | 0x8005 | 0x0000 | 是    | 是     | 0x0000 | IBM SDLC、LHA     |
+ *
+ * 每个多项式同时提供左移的查询表与其镜像多项式右移的查询表，
+ * 按位镜像翻转输入的模型使用镜像的查询表，不需要逐字节调用 `xwbop_rbit8()` 。
+ * @{
+ */
+
+extern const xwu16_t xwlib_crc16tbl_0x1021[256];
+extern const xwu16_t xwlib_crc16tbl_0x8408[256];
+extern const xwu16_t xwlib_crc16tbl_0x8005[256];
+extern const xwu16_t xwlib_crc16tbl_0xa001[256];
+
+/**
+ * @brief 增量计算CRC16的上下文
+ * @details
+ * 数据分散在多个缓冲区中或是逐段到达时，不需要拷贝到同一个缓冲区中：
+ * + 通过 @ref xwlib_crc16_init() 设置参数模型；
+ * + 每一段数据调用一次 @ref xwlib_crc16_update() ；
+ * + 通过 @ref xwlib_crc16_final() 获取结果。
+ */
+struct xwlib_crc16_ctx {
+        xwu16_t crc; /**< 余数 */
+        xwu16_t xorout; /**< 与结果异或的值 */
+        xwu16_t plynml; /**< 多项式 */
+        bool refin; /**< 是否按位镜像翻转输入的每个字节 */
+        bool refout; /**< 是否按位镜像翻转输出 */
+};
+
+/**
+ * @brief 计算一段数据的CRC16校验值
+ * @param[in,out] crc16: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示初始值
+ * + (O) 作为输出时，返回计算结果，当计算失败时，值不会发生改变
+ * @param[in] xorout: 与结果异或的值
+ * @param[in] refin: 是否按位镜像翻转输入的每个字节(xwbop_rbit8)
+ * @param[in] refout: 是否按位镜像翻转输出(xwbop_rbit16)
+ * @param[in] plynml: 多项式，取值：
+ *   @arg 0x1021
+ *   @arg 0x8005
+ * @param[in] stream: 指向数据的指针
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度，当返回不为0时，
+ *   表示计算未完成，计算结果不会镜像翻转，也不会与xorout异或。
+ * @return 错误码
+ * @retval XWOK: 没有错误，计算结果有效
+ * @retval -EFAULT: 空指针
+ * @retval -EOPNOTSUPP: 不支持的多项式
+ * @details
+ * 优先使用SOC的CRC硬件单元(SOCCFG_CRC16)计算，剩余部分再使用直驱表法计算。
+ */
+xwer_t xwlib_crc16_cal(xwu16_t * crc16,
+                       xwu16_t xorout, bool refin, bool refout, xwu16_t plynml,
+                       const xwu8_t stream[], xwsz_t * size);
+
+/**
+ * @brief 用CRC-16/CCITT-FALSE参数模型计算一段数据的校验值
+ * @param[in] stream: 指向数据的指针
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @return CRC16
+ */
+xwu16_t xwlib_crc16_calccitt(const xwu8_t stream[], xwsz_t * size);
+
+/**
+ * @brief 用CRC-16/XMODEM参数模型计算一段数据的校验值
+ * @param[in] stream: 指向数据的指针
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @return CRC16
+ */
+xwu16_t xwlib_crc16_calxmodem(const xwu8_t stream[], xwsz_t * size);
+
+/**
+ * @brief 用CRC-16/MODBUS参数模型计算一段数据的校验值
+ * @param[in] stream: 指向数据的指针
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @return CRC16
+ * @note
+ * + Modbus RTU帧中CRC16按小端顺序发送（低字节在前）。
+ */
+xwu16_t xwlib_crc16_calmodbus(const xwu8_t stream[], xwsz_t * size);
+
+/**
+ * @brief 用CRC-16/IBM(ARC)参数模型计算一段数据的校验值
+ * @param[in] stream: 指向数据的指针
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @return CRC16
+ */
+xwu16_t xwlib_crc16_calibm(const xwu8_t stream[], xwsz_t * size);
+
+/**
+ * @brief 初始化增量计算CRC16的上下文
+ * @param[in] ctx: 上下文的指针
+ * @param[in] init: 初始值
+ * @param[in] xorout: 与结果异或的值
+ * @param[in] refin: 是否按位镜像翻转输入的每个字节(xwbop_rbit8)
+ * @param[in] refout: 是否按位镜像翻转输出(xwbop_rbit16)
+ * @param[in] plynml: 多项式，取值同 @ref xwlib_crc16_cal()
+ */
+void xwlib_crc16_init(struct xwlib_crc16_ctx * ctx, xwu16_t init, xwu16_t xorout,
+                      bool refin, bool refout, xwu16_t plynml);
+
+/**
+ * @brief 增量计算一段数据的CRC16
+ * @param[in] ctx: 上下文的指针
+ * @param[in] stream: 指向数据的指针
+ * @param[in] size: 数据长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EOPNOTSUPP: 不支持的多项式
+ * @note
+ * + 上下文：任意
+ * + 可重入：多个调用者各自使用不同的上下文
+ */
+xwer_t xwlib_crc16_update(struct xwlib_crc16_ctx * ctx,
+                          const xwu8_t stream[], xwsz_t size);
+
+/**
+ * @brief 获取增量计算CRC16的结果
+ * @param[in] ctx: 上下文的指针
+ * @return CRC16
+ * @details
+ * 不会修改上下文，获取结果之后还可以继续增量计算后续的数据。
+ */
+xwu16_t xwlib_crc16_final(struct xwlib_crc16_ctx * ctx);
+
+/**
+ * @} xwos_lib_crc16
+ */
+
+#endif /* xwos/lib/crc16.h */
@@ -14,6 +14,14 @@
 #include <xwos/lib/xwbop.h>
 #include <xwos/lib/crc32.h>
 
+#if defined(XWLIBCFG_CRC32_SLICE) && (XWLIBCFG_CRC32_SLICE >= 16U)
+#  define XWLIB_CRC32_SLICE             (16U)
+#elif defined(XWLIBCFG_CRC32_SLICE) && (XWLIBCFG_CRC32_SLICE >= 8U)
+#  define XWLIB_CRC32_SLICE             (8U)
+#else
+#  define XWLIB_CRC32_SLICE             (1U)
+#endif
+
 #if defined(XWLIBCFG_CRC32_0X04C11DB7) && (1 == XWLIBCFG_CRC32_0X04C11DB7)
 /**
  * @brief CRC32多项式0x04C11DB7的查询表
@@ -278,6 +286,1009 @@ __xwlib_rodata const xwu32_t xwlib_crc32tbl_0x04c11db7[256] = {
 };
 #endif
 
+#if defined(XWLIBCFG_CRC32_0X04C11DB7) && (1 == XWLIBCFG_CRC32_0X04C11DB7) && (XWLIB_CRC32_SLICE > 1U)
+/**
+ * @brief CRC32多项式0x04C11DB7的分片查询表
+ * @details
+ * 第k行是第k+1个分片的查询表，第0个分片直接使用直驱表。
+ */
+static __xwlib_rodata
+const xwu32_t xwlib_crc32sbtbl_0x04c11db7[XWLIB_CRC32_SLICE - 1U][256] = {
+        [0] = {
+                0x00000000, 0xD219C1DC, 0xA0F29E0F, 0x72EB5FD3,
+                0x452421A9, 0x973DE075, 0xE5D6BFA6, 0x37CF7E7A,
+                0x8A484352, 0x5851828E, 0x2ABADD5D, 0xF8A31C81,
+                0xCF6C62FB, 0x1D75A327, 0x6F9EFCF4, 0xBD873D28,
+                0x10519B13, 0xC2485ACF, 0xB0A3051C, 0x62BAC4C0,
+                0x5575BABA, 0x876C7B66, 0xF58724B5, 0x279EE569,
+                0x9A19D841, 0x4800199D, 0x3AEB464E, 0xE8F28792,
+                0xDF3DF9E8, 0x0D243834, 0x7FCF67E7, 0xADD6A63B,
+                0x20A33626, 0xF2BAF7FA, 0x8051A829, 0x524869F5,
+                0x6587178F, 0xB79ED653, 0xC5758980, 0x176C485C,
+                0xAAEB7574, 0x78F2B4A8, 0x0A19EB7B, 0xD8002AA7,
+                0xEFCF54DD, 0x3DD69501, 0x4F3DCAD2, 0x9D240B0E,
+                0x30F2AD35, 0xE2EB6CE9, 0x9000333A, 0x4219F2E6,
+                0x75D68C9C, 0xA7CF4D40, 0xD5241293, 0x073DD34F,
+                0xBABAEE67, 0x68A32FBB, 0x1A487068, 0xC851B1B4,
+                0xFF9ECFCE, 0x2D870E12, 0x5F6C51C1, 0x8D75901D,
+                0x41466C4C, 0x935FAD90, 0xE1B4F243, 0x33AD339F,
+                0x04624DE5, 0xD67B8C39, 0xA490D3EA, 0x76891236,
+                0xCB0E2F1E, 0x1917EEC2, 0x6BFCB111, 0xB9E570CD,
+                0x8E2A0EB7, 0x5C33CF6B, 0x2ED890B8, 0xFCC15164,
+                0x5117F75F, 0x830E3683, 0xF1E56950, 0x23FCA88C,
+                0x1433D6F6, 0xC62A172A, 0xB4C148F9, 0x66D88925,
+                0xDB5FB40D, 0x094675D1, 0x7BAD2A02, 0xA9B4EBDE,
+                0x9E7B95A4, 0x4C625478, 0x3E890BAB, 0xEC90CA77,
+                0x61E55A6A, 0xB3FC9BB6, 0xC117C465, 0x130E05B9,
+                0x24C17BC3, 0xF6D8BA1F, 0x8433E5CC, 0x562A2410,
+                0xEBAD1938, 0x39B4D8E4, 0x4B5F8737, 0x994646EB,
+                0xAE893891, 0x7C90F94D, 0x0E7BA69E, 0xDC626742,
+                0x71B4C179, 0xA3AD00A5, 0xD1465F76, 0x035F9EAA,
+                0x3490E0D0, 0xE689210C, 0x94627EDF, 0x467BBF03,
+                0xFBFC822B, 0x29E543F7, 0x5B0E1C24, 0x8917DDF8,
+                0xBED8A382, 0x6CC1625E, 0x1E2A3D8D, 0xCC33FC51,
+                0x828CD898, 0x50951944, 0x227E4697, 0xF067874B,
+                0xC7A8F931, 0x15B138ED, 0x675A673E, 0xB543A6E2,
+                0x08C49BCA, 0xDADD5A16, 0xA83605C5, 0x7A2FC419,
+                0x4DE0BA63, 0x9FF97BBF, 0xED12246C, 0x3F0BE5B0,
+                0x92DD438B, 0x40C48257, 0x322FDD84, 0xE0361C58,
+                0xD7F96222, 0x05E0A3FE, 0x770BFC2D, 0xA5123DF1,
+                0x189500D9, 0xCA8CC105, 0xB8679ED6, 0x6A7E5F0A,
+                0x5DB12170, 0x8FA8E0AC, 0xFD43BF7F, 0x2F5A7EA3,
+                0xA22FEEBE, 0x70362F62, 0x02DD70B1, 0xD0C4B16D,
+                0xE70BCF17, 0x35120ECB, 0x47F95118, 0x95E090C4,
+                0x2867ADEC, 0xFA7E6C30, 0x889533E3, 0x5A8CF23F,
+                0x6D438C45, 0xBF5A4D99, 0xCDB1124A, 0x1FA8D396,
+                0xB27E75AD, 0x6067B471, 0x128CEBA2, 0xC0952A7E,
+                0xF75A5404, 0x254395D8, 0x57A8CA0B, 0x85B10BD7,
+                0x383636FF, 0xEA2FF723, 0x98C4A8F0, 0x4ADD692C,
+                0x7D121756, 0xAF0BD68A, 0xDDE08959, 0x0FF94885,
+                0xC3CAB4D4, 0x11D37508, 0x63382ADB, 0xB121EB07,
+                0x86EE957D, 0x54F754A1, 0x261C0B72, 0xF405CAAE,
+                0x4982F786, 0x9B9B365A, 0xE9706989, 0x3B69A855,
+                0x0CA6D62F, 0xDEBF17F3, 0xAC544820, 0x7E4D89FC,
+                0xD39B2FC7, 0x0182EE1B, 0x7369B1C8, 0xA1707014,
+                0x96BF0E6E, 0x44A6CFB2, 0x364D9061, 0xE45451BD,
+                0x59D36C95, 0x8BCAAD49, 0xF921F29A, 0x2B383346,
+                0x1CF74D3C, 0xCEEE8CE0, 0xBC05D333, 0x6E1C12EF,
+                0xE36982F2, 0x3170432E, 0x439B1CFD, 0x9182DD21,
+                0xA64DA35B, 0x74546287, 0x06BF3D54, 0xD4A6FC88,
+                0x6921C1A0, 0xBB38007C, 0xC9D35FAF, 0x1BCA9E73,
+                0x2C05E009, 0xFE1C21D5, 0x8CF77E06, 0x5EEEBFDA,
+                0xF33819E1, 0x2121D83D, 0x53CA87EE, 0x81D34632,
+                0xB61C3848, 0x6405F994, 0x16EEA647, 0xC4F7679B,
+                0x79705AB3, 0xAB699B6F, 0xD982C4BC, 0x0B9B0560,
+                0x3C547B1A, 0xEE4DBAC6, 0x9CA6E515, 0x4EBF24C9,
+        },
+        [1] = {
+                0x00000000, 0x01D8AC87, 0x03B1590E, 0x0269F589,
+                0x0762B21C, 0x06BA1E9B, 0x04D3EB12, 0x050B4795,
+                0x0EC56438, 0x0F1DC8BF, 0x0D743D36, 0x0CAC91B1,
+                0x09A7D624, 0x087F7AA3, 0x0A168F2A, 0x0BCE23AD,
+                0x1D8AC870, 0x1C5264F7, 0x1E3B917E, 0x1FE33DF9,
+                0x1AE87A6C, 0x1B30D6EB, 0x19592362, 0x18818FE5,
+                0x134FAC48, 0x129700CF, 0x10FEF546, 0x112659C1,
+                0x142D1E54, 0x15F5B2D3, 0x179C475A, 0x1644EBDD,
+                0x3B1590E0, 0x3ACD3C67, 0x38A4C9EE, 0x397C6569,
+                0x3C7722FC, 0x3DAF8E7B, 0x3FC67BF2, 0x3E1ED775,
+                0x35D0F4D8, 0x3408585F, 0x3661ADD6, 0x37B90151,
+                0x32B246C4, 0x336AEA43, 0x31031FCA, 0x30DBB34D,
+                0x269F5890, 0x2747F417, 0x252E019E, 0x24F6AD19,
+                0x21FDEA8C, 0x2025460B, 0x224CB382, 0x23941F05,
+                0x285A3CA8, 0x2982902F, 0x2BEB65A6, 0x2A33C921,
+                0x2F388EB4, 0x2EE02233, 0x2C89D7BA, 0x2D517B3D,
+                0x762B21C0, 0x77F38D47, 0x759A78CE, 0x7442D449,
+                0x714993DC, 0x70913F5B, 0x72F8CAD2, 0x73206655,
+                0x78EE45F8, 0x7936E97F, 0x7B5F1CF6, 0x7A87B071,
+                0x7F8CF7E4, 0x7E545B63, 0x7C3DAEEA, 0x7DE5026D,
+                0x6BA1E9B0, 0x6A794537, 0x6810B0BE, 0x69C81C39,
+                0x6CC35BAC, 0x6D1BF72B, 0x6F7202A2, 0x6EAAAE25,
+                0x65648D88, 0x64BC210F, 0x66D5D486, 0x670D7801,
+                0x62063F94, 0x63DE9313, 0x61B7669A, 0x606FCA1D,
+                0x4D3EB120, 0x4CE61DA7, 0x4E8FE82E, 0x4F5744A9,
+                0x4A5C033C, 0x4B84AFBB, 0x49ED5A32, 0x4835F6B5,
+                0x43FBD518, 0x4223799F, 0x404A8C16, 0x41922091,
+                0x44996704, 0x4541CB83, 0x47283E0A, 0x46F0928D,
+                0x50B47950, 0x516CD5D7, 0x5305205E, 0x52DD8CD9,
+                0x57D6CB4C, 0x560E67CB, 0x54679242, 0x55BF3EC5,
+                0x5E711D68, 0x5FA9B1EF, 0x5DC04466, 0x5C18E8E1,
+                0x5913AF74, 0x58CB03F3, 0x5AA2F67A, 0x5B7A5AFD,
+                0xEC564380, 0xED8EEF07, 0xEFE71A8E, 0xEE3FB609,
+                0xEB34F19C, 0xEAEC5D1B, 0xE885A892, 0xE95D0415,
+                0xE29327B8, 0xE34B8B3F, 0xE1227EB6, 0xE0FAD231,
+                0xE5F195A4, 0xE4293923, 0xE640CCAA, 0xE798602D,
+                0xF1DC8BF0, 0xF0042777, 0xF26DD2FE, 0xF3B57E79,
+                0xF6BE39EC, 0xF766956B, 0xF50F60E2, 0xF4D7CC65,
+                0xFF19EFC8, 0xFEC1434F, 0xFCA8B6C6, 0xFD701A41,
+                0xF87B5DD4, 0xF9A3F153, 0xFBCA04DA, 0xFA12A85D,
+                0xD743D360, 0xD69B7FE7, 0xD4F28A6E, 0xD52A26E9,
+                0xD021617C, 0xD1F9CDFB, 0xD3903872, 0xD24894F5,
+                0xD986B758, 0xD85E1BDF, 0xDA37EE56, 0xDBEF42D1,
+                0xDEE40544, 0xDF3CA9C3, 0xDD555C4A, 0xDC8DF0CD,
+                0xCAC91B10, 0xCB11B797, 0xC978421E, 0xC8A0EE99,
+                0xCDABA90C, 0xCC73058B, 0xCE1AF002, 0xCFC25C85,
+                0xC40C7F28, 0xC5D4D3AF, 0xC7BD2626, 0xC6658AA1,
+                0xC36ECD34, 0xC2B661B3, 0xC0DF943A, 0xC10738BD,
+                0x9A7D6240, 0x9BA5CEC7, 0x99CC3B4E, 0x981497C9,
+                0x9D1FD05C, 0x9CC77CDB, 0x9EAE8952, 0x9F7625D5,
+                0x94B80678, 0x9560AAFF, 0x97095F76, 0x96D1F3F1,
+                0x93DAB464, 0x920218E3, 0x906BED6A, 0x91B341ED,
+                0x87F7AA30, 0x862F06B7, 0x8446F33E, 0x859E5FB9,
+                0x8095182C, 0x814DB4AB, 0x83244122, 0x82FCEDA5,
+                0x8932CE08, 0x88EA628F, 0x8A839706, 0x8B5B3B81,
+                0x8E507C14, 0x8F88D093, 0x8DE1251A, 0x8C39899D,
+                0xA168F2A0, 0xA0B05E27, 0xA2D9ABAE, 0xA3010729,
+                0xA60A40BC, 0xA7D2EC3B, 0xA5BB19B2, 0xA463B535,
+                0xAFAD9698, 0xAE753A1F, 0xAC1CCF96, 0xADC46311,
+                0xA8CF2484, 0xA9178803, 0xAB7E7D8A, 0xAAA6D10D,
+                0xBCE23AD0, 0xBD3A9657, 0xBF5363DE, 0xBE8BCF59,
+                0xBB8088CC, 0xBA58244B, 0xB831D1C2, 0xB9E97D45,
+                0xB2275EE8, 0xB3FFF26F, 0xB19607E6, 0xB04EAB61,
+                0xB545ECF4, 0xB49D4073, 0xB6F4B5FA, 0xB72C197D,
+        },
+        [2] = {
+                0x00000000, 0xDC6D9AB7, 0xBC1A28D9, 0x6077B26E,
+                0x7CF54C05, 0xA098D6B2, 0xC0EF64DC, 0x1C82FE6B,
+                0xF9EA980A, 0x258702BD, 0x45F0B0D3, 0x999D2A64,
+                0x851FD40F, 0x59724EB8, 0x3905FCD6, 0xE5686661,
+                0xF7142DA3, 0x2B79B714, 0x4B0E057A, 0x97639FCD,
+                0x8BE161A6, 0x578CFB11, 0x37FB497F, 0xEB96D3C8,
+                0x0EFEB5A9, 0xD2932F1E, 0xB2E49D70, 0x6E8907C7,
+                0x720BF9AC, 0xAE66631B, 0xCE11D175, 0x127C4BC2,
+                0xEAE946F1, 0x3684DC46, 0x56F36E28, 0x8A9EF49F,
+                0x961C0AF4, 0x4A719043, 0x2A06222D, 0xF66BB89A,
+                0x1303DEFB, 0xCF6E444C, 0xAF19F622, 0x73746C95,
+                0x6FF692FE, 0xB39B0849, 0xD3ECBA27, 0x0F812090,
+                0x1DFD6B52, 0xC190F1E5, 0xA1E7438B, 0x7D8AD93C,
+                0x61082757, 0xBD65BDE0, 0xDD120F8E, 0x017F9539,
+                0xE417F358, 0x387A69EF, 0x580DDB81, 0x84604136,
+                0x98E2BF5D, 0x448F25EA, 0x24F89784, 0xF8950D33,
+                0xD1139055, 0x0D7E0AE2, 0x6D09B88C, 0xB164223B,
+                0xADE6DC50, 0x718B46E7, 0x11FCF489, 0xCD916E3E,
+                0x28F9085F, 0xF49492E8, 0x94E32086, 0x488EBA31,
+                0x540C445A, 0x8861DEED, 0xE8166C83, 0x347BF634,
+                0x2607BDF6, 0xFA6A2741, 0x9A1D952F, 0x46700F98,
+                0x5AF2F1F3, 0x869F6B44, 0xE6E8D92A, 0x3A85439D,
+                0xDFED25FC, 0x0380BF4B, 0x63F70D25, 0xBF9A9792,
+                0xA31869F9, 0x7F75F34E, 0x1F024120, 0xC36FDB97,
+                0x3BFAD6A4, 0xE7974C13, 0x87E0FE7D, 0x5B8D64CA,
+                0x470F9AA1, 0x9B620016, 0xFB15B278, 0x277828CF,
+                0xC2104EAE, 0x1E7DD419, 0x7E0A6677, 0xA267FCC0,
+                0xBEE502AB, 0x6288981C, 0x02FF2A72, 0xDE92B0C5,
+                0xCCEEFB07, 0x108361B0, 0x70F4D3DE, 0xAC994969,
+                0xB01BB702, 0x6C762DB5, 0x0C019FDB, 0xD06C056C,
+                0x3504630D, 0xE969F9BA, 0x891E4BD4, 0x5573D163,
+                0x49F12F08, 0x959CB5BF, 0xF5EB07D1, 0x29869D66,
+                0xA6E63D1D, 0x7A8BA7AA, 0x1AFC15C4, 0xC6918F73,
+                0xDA137118, 0x067EEBAF, 0x660959C1, 0xBA64C376,
+                0x5F0CA517, 0x83613FA0, 0xE3168DCE, 0x3F7B1779,
+                0x23F9E912, 0xFF9473A5, 0x9FE3C1CB, 0x438E5B7C,
+                0x51F210BE, 0x8D9F8A09, 0xEDE83867, 0x3185A2D0,
+                0x2D075CBB, 0xF16AC60C, 0x911D7462, 0x4D70EED5,
+                0xA81888B4, 0x74751203, 0x1402A06D, 0xC86F3ADA,
+                0xD4EDC4B1, 0x08805E06, 0x68F7EC68, 0xB49A76DF,
+                0x4C0F7BEC, 0x9062E15B, 0xF0155335, 0x2C78C982,
+                0x30FA37E9, 0xEC97AD5E, 0x8CE01F30, 0x508D8587,
+                0xB5E5E3E6, 0x69887951, 0x09FFCB3F, 0xD5925188,
+                0xC910AFE3, 0x157D3554, 0x750A873A, 0xA9671D8D,
+                0xBB1B564F, 0x6776CCF8, 0x07017E96, 0xDB6CE421,
+                0xC7EE1A4A, 0x1B8380FD, 0x7BF43293, 0xA799A824,
+                0x42F1CE45, 0x9E9C54F2, 0xFEEBE69C, 0x22867C2B,
+                0x3E048240, 0xE26918F7, 0x821EAA99, 0x5E73302E,
+                0x77F5AD48, 0xAB9837FF, 0xCBEF8591, 0x17821F26,
+                0x0B00E14D, 0xD76D7BFA, 0xB71AC994, 0x6B775323,
+                0x8E1F3542, 0x5272AFF5, 0x32051D9B, 0xEE68872C,
+                0xF2EA7947, 0x2E87E3F0, 0x4EF0519E, 0x929DCB29,
+                0x80E180EB, 0x5C8C1A5C, 0x3CFBA832, 0xE0963285,
+                0xFC14CCEE, 0x20795659, 0x400EE437, 0x9C637E80,
+                0x790B18E1, 0xA5668256, 0xC5113038, 0x197CAA8F,
+                0x05FE54E4, 0xD993CE53, 0xB9E47C3D, 0x6589E68A,
+                0x9D1CEBB9, 0x4171710E, 0x2106C360, 0xFD6B59D7,
+                0xE1E9A7BC, 0x3D843D0B, 0x5DF38F65, 0x819E15D2,
+                0x64F673B3, 0xB89BE904, 0xD8EC5B6A, 0x0481C1DD,
+                0x18033FB6, 0xC46EA501, 0xA419176F, 0x78748DD8,
+                0x6A08C61A, 0xB6655CAD, 0xD612EEC3, 0x0A7F7474,
+                0x16FD8A1F, 0xCA9010A8, 0xAAE7A2C6, 0x768A3871,
+                0x93E25E10, 0x4F8FC4A7, 0x2FF876C9, 0xF395EC7E,
+                0xEF171215, 0x337A88A2, 0x530D3ACC, 0x8F60A07B,
+        },
+        [3] = {
+                0x00000000, 0x490D678D, 0x921ACF1A, 0xDB17A897,
+                0x20F48383, 0x69F9E40E, 0xB2EE4C99, 0xFBE32B14,
+                0x41E90706, 0x08E4608B, 0xD3F3C81C, 0x9AFEAF91,
+                0x611D8485, 0x2810E308, 0xF3074B9F, 0xBA0A2C12,
+                0x83D20E0C, 0xCADF6981, 0x11C8C116, 0x58C5A69B,
+                0xA3268D8F, 0xEA2BEA02, 0x313C4295, 0x78312518,
+                0xC23B090A, 0x8B366E87, 0x5021C610, 0x192CA19D,
+                0xE2CF8A89, 0xABC2ED04, 0x70D54593, 0x39D8221E,
+                0x036501AF, 0x4A686622, 0x917FCEB5, 0xD872A938,
+                0x2391822C, 0x6A9CE5A1, 0xB18B4D36, 0xF8862ABB,
+                0x428C06A9, 0x0B816124, 0xD096C9B3, 0x999BAE3E,
+                0x6278852A, 0x2B75E2A7, 0xF0624A30, 0xB96F2DBD,
+                0x80B70FA3, 0xC9BA682E, 0x12ADC0B9, 0x5BA0A734,
+                0xA0438C20, 0xE94EEBAD, 0x3259433A, 0x7B5424B7,
+                0xC15E08A5, 0x88536F28, 0x5344C7BF, 0x1A49A032,
+                0xE1AA8B26, 0xA8A7ECAB, 0x73B0443C, 0x3ABD23B1,
+                0x06CA035E, 0x4FC764D3, 0x94D0CC44, 0xDDDDABC9,
+                0x263E80DD, 0x6F33E750, 0xB4244FC7, 0xFD29284A,
+                0x47230458, 0x0E2E63D5, 0xD539CB42, 0x9C34ACCF,
+                0x67D787DB, 0x2EDAE056, 0xF5CD48C1, 0xBCC02F4C,
+                0x85180D52, 0xCC156ADF, 0x1702C248, 0x5E0FA5C5,
+                0xA5EC8ED1, 0xECE1E95C, 0x37F641CB, 0x7EFB2646,
+                0xC4F10A54, 0x8DFC6DD9, 0x56EBC54E, 0x1FE6A2C3,
+                0xE40589D7, 0xAD08EE5A, 0x761F46CD, 0x3F122140,
+                0x05AF02F1, 0x4CA2657C, 0x97B5CDEB, 0xDEB8AA66,
+                0x255B8172, 0x6C56E6FF, 0xB7414E68, 0xFE4C29E5,
+                0x444605F7, 0x0D4B627A, 0xD65CCAED, 0x9F51AD60,
+                0x64B28674, 0x2DBFE1F9, 0xF6A8496E, 0xBFA52EE3,
+                0x867D0CFD, 0xCF706B70, 0x1467C3E7, 0x5D6AA46A,
+                0xA6898F7E, 0xEF84E8F3, 0x34934064, 0x7D9E27E9,
+                0xC7940BFB, 0x8E996C76, 0x558EC4E1, 0x1C83A36C,
+                0xE7608878, 0xAE6DEFF5, 0x757A4762, 0x3C7720EF,
+                0x0D9406BC, 0x44996131, 0x9F8EC9A6, 0xD683AE2B,
+                0x2D60853F, 0x646DE2B2, 0xBF7A4A25, 0xF6772DA8,
+                0x4C7D01BA, 0x05706637, 0xDE67CEA0, 0x976AA92D,
+                0x6C898239, 0x2584E5B4, 0xFE934D23, 0xB79E2AAE,
+                0x8E4608B0, 0xC74B6F3D, 0x1C5CC7AA, 0x5551A027,
+                0xAEB28B33, 0xE7BFECBE, 0x3CA84429, 0x75A523A4,
+                0xCFAF0FB6, 0x86A2683B, 0x5DB5C0AC, 0x14B8A721,
+                0xEF5B8C35, 0xA656EBB8, 0x7D41432F, 0x344C24A2,
+                0x0EF10713, 0x47FC609E, 0x9CEBC809, 0xD5E6AF84,
+                0x2E058490, 0x6708E31D, 0xBC1F4B8A, 0xF5122C07,
+                0x4F180015, 0x06156798, 0xDD02CF0F, 0x940FA882,
+                0x6FEC8396, 0x26E1E41B, 0xFDF64C8C, 0xB4FB2B01,
+                0x8D23091F, 0xC42E6E92, 0x1F39C605, 0x5634A188,
+                0xADD78A9C, 0xE4DAED11, 0x3FCD4586, 0x76C0220B,
+                0xCCCA0E19, 0x85C76994, 0x5ED0C103, 0x17DDA68E,
+                0xEC3E8D9A, 0xA533EA17, 0x7E244280, 0x3729250D,
+                0x0B5E05E2, 0x4253626F, 0x9944CAF8, 0xD049AD75,
+                0x2BAA8661, 0x62A7E1EC, 0xB9B0497B, 0xF0BD2EF6,
+                0x4AB702E4, 0x03BA6569, 0xD8ADCDFE, 0x91A0AA73,
+                0x6A438167, 0x234EE6EA, 0xF8594E7D, 0xB15429F0,
+                0x888C0BEE, 0xC1816C63, 0x1A96C4F4, 0x539BA379,
+                0xA878886D, 0xE175EFE0, 0x3A624777, 0x736F20FA,
+                0xC9650CE8, 0x80686B65, 0x5B7FC3F2, 0x1272A47F,
+                0xE9918F6B, 0xA09CE8E6, 0x7B8B4071, 0x328627FC,
+                0x083B044D, 0x413663C0, 0x9A21CB57, 0xD32CACDA,
+                0x28CF87CE, 0x61C2E043, 0xBAD548D4, 0xF3D82F59,
+                0x49D2034B, 0x00DF64C6, 0xDBC8CC51, 0x92C5ABDC,
+                0x692680C8, 0x202BE745, 0xFB3C4FD2, 0xB231285F,
+                0x8BE90A41, 0xC2E46DCC, 0x19F3C55B, 0x50FEA2D6,
+                0xAB1D89C2, 0xE210EE4F, 0x390746D8, 0x700A2155,
+                0xCA000D47, 0x830D6ACA, 0x581AC25D, 0x1117A5D0,
+                0xEAF48EC4, 0xA3F9E949, 0x78EE41DE, 0x31E32653,
+        },
+        [4] = {
+                0x00000000, 0x1B280D78, 0x36501AF0, 0x2D781788,
+                0x6CA035E0, 0x77883898, 0x5AF02F10, 0x41D82268,
+                0xD9406BC0, 0xC26866B8, 0xEF107130, 0xF4387C48,
+                0xB5E05E20, 0xAEC85358, 0x83B044D0, 0x989849A8,
+                0xB641CA37, 0xAD69C74F, 0x8011D0C7, 0x9B39DDBF,
+                0xDAE1FFD7, 0xC1C9F2AF, 0xECB1E527, 0xF799E85F,
+                0x6F01A1F7, 0x7429AC8F, 0x5951BB07, 0x4279B67F,
+                0x03A19417, 0x1889996F, 0x35F18EE7, 0x2ED9839F,
+                0x684289D9, 0x736A84A1, 0x5E129329, 0x453A9E51,
+                0x04E2BC39, 0x1FCAB141, 0x32B2A6C9, 0x299AABB1,
+                0xB102E219, 0xAA2AEF61, 0x8752F8E9, 0x9C7AF591,
+                0xDDA2D7F9, 0xC68ADA81, 0xEBF2CD09, 0xF0DAC071,
+                0xDE0343EE, 0xC52B4E96, 0xE853591E, 0xF37B5466,
+                0xB2A3760E, 0xA98B7B76, 0x84F36CFE, 0x9FDB6186,
+                0x0743282E, 0x1C6B2556, 0x311332DE, 0x2A3B3FA6,
+                0x6BE31DCE, 0x70CB10B6, 0x5DB3073E, 0x469B0A46,
+                0xD08513B2, 0xCBAD1ECA, 0xE6D50942, 0xFDFD043A,
+                0xBC252652, 0xA70D2B2A, 0x8A753CA2, 0x915D31DA,
+                0x09C57872, 0x12ED750A, 0x3F956282, 0x24BD6FFA,
+                0x65654D92, 0x7E4D40EA, 0x53355762, 0x481D5A1A,
+                0x66C4D985, 0x7DECD4FD, 0x5094C375, 0x4BBCCE0D,
+                0x0A64EC65, 0x114CE11D, 0x3C34F695, 0x271CFBED,
+                0xBF84B245, 0xA4ACBF3D, 0x89D4A8B5, 0x92FCA5CD,
+                0xD32487A5, 0xC80C8ADD, 0xE5749D55, 0xFE5C902D,
+                0xB8C79A6B, 0xA3EF9713, 0x8E97809B, 0x95BF8DE3,
+                0xD467AF8B, 0xCF4FA2F3, 0xE237B57B, 0xF91FB803,
+                0x6187F1AB, 0x7AAFFCD3, 0x57D7EB5B, 0x4CFFE623,
+                0x0D27C44B, 0x160FC933, 0x3B77DEBB, 0x205FD3C3,
+                0x0E86505C, 0x15AE5D24, 0x38D64AAC, 0x23FE47D4,
+                0x622665BC, 0x790E68C4, 0x54767F4C, 0x4F5E7234,
+                0xD7C63B9C, 0xCCEE36E4, 0xE196216C, 0xFABE2C14,
+                0xBB660E7C, 0xA04E0304, 0x8D36148C, 0x961E19F4,
+                0xA5CB3AD3, 0xBEE337AB, 0x939B2023, 0x88B32D5B,
+                0xC96B0F33, 0xD243024B, 0xFF3B15C3, 0xE41318BB,
+                0x7C8B5113, 0x67A35C6B, 0x4ADB4BE3, 0x51F3469B,
+                0x102B64F3, 0x0B03698B, 0x267B7E03, 0x3D53737B,
+                0x138AF0E4, 0x08A2FD9C, 0x25DAEA14, 0x3EF2E76C,
+                0x7F2AC504, 0x6402C87C, 0x497ADFF4, 0x5252D28C,
+                0xCACA9B24, 0xD1E2965C, 0xFC9A81D4, 0xE7B28CAC,
+                0xA66AAEC4, 0xBD42A3BC, 0x903AB434, 0x8B12B94C,
+                0xCD89B30A, 0xD6A1BE72, 0xFBD9A9FA, 0xE0F1A482,
+                0xA12986EA, 0xBA018B92, 0x97799C1A, 0x8C519162,
+                0x14C9D8CA, 0x0FE1D5B2, 0x2299C23A, 0x39B1CF42,
+                0x7869ED2A, 0x6341E052, 0x4E39F7DA, 0x5511FAA2,
+                0x7BC8793D, 0x60E07445, 0x4D9863CD, 0x56B06EB5,
+                0x17684CDD, 0x0C4041A5, 0x2138562D, 0x3A105B55,
+                0xA28812FD, 0xB9A01F85, 0x94D8080D, 0x8FF00575,
+                0xCE28271D, 0xD5002A65, 0xF8783DED, 0xE3503095,
+                0x754E2961, 0x6E662419, 0x431E3391, 0x58363EE9,
+                0x19EE1C81, 0x02C611F9, 0x2FBE0671, 0x34960B09,
+                0xAC0E42A1, 0xB7264FD9, 0x9A5E5851, 0x81765529,
+                0xC0AE7741, 0xDB867A39, 0xF6FE6DB1, 0xEDD660C9,
+                0xC30FE356, 0xD827EE2E, 0xF55FF9A6, 0xEE77F4DE,
+                0xAFAFD6B6, 0xB487DBCE, 0x99FFCC46, 0x82D7C13E,
+                0x1A4F8896, 0x016785EE, 0x2C1F9266, 0x37379F1E,
+                0x76EFBD76, 0x6DC7B00E, 0x40BFA786, 0x5B97AAFE,
+                0x1D0CA0B8, 0x0624ADC0, 0x2B5CBA48, 0x3074B730,
+                0x71AC9558, 0x6A849820, 0x47FC8FA8, 0x5CD482D0,
+                0xC44CCB78, 0xDF64C600, 0xF21CD188, 0xE934DCF0,
+                0xA8ECFE98, 0xB3C4F3E0, 0x9EBCE468, 0x8594E910,
+                0xAB4D6A8F, 0xB06567F7, 0x9D1D707F, 0x86357D07,
+                0xC7ED5F6F, 0xDCC55217, 0xF1BD459F, 0xEA9548E7,
+                0x720D014F, 0x69250C37, 0x445D1BBF, 0x5F7516C7,
+                0x1EAD34AF, 0x058539D7, 0x28FD2E5F, 0x33D52327,
+        },
+        [5] = {
+                0x00000000, 0x4F576811, 0x9EAED022, 0xD1F9B833,
+                0x399CBDF3, 0x76CBD5E2, 0xA7326DD1, 0xE86505C0,
+                0x73397BE6, 0x3C6E13F7, 0xED97ABC4, 0xA2C0C3D5,
+                0x4AA5C615, 0x05F2AE04, 0xD40B1637, 0x9B5C7E26,
+                0xE672F7CC, 0xA9259FDD, 0x78DC27EE, 0x378B4FFF,
+                0xDFEE4A3F, 0x90B9222E, 0x41409A1D, 0x0E17F20C,
+                0x954B8C2A, 0xDA1CE43B, 0x0BE55C08, 0x44B23419,
+                0xACD731D9, 0xE38059C8, 0x3279E1FB, 0x7D2E89EA,
+                0xC824F22F, 0x87739A3E, 0x568A220D, 0x19DD4A1C,
+                0xF1B84FDC, 0xBEEF27CD, 0x6F169FFE, 0x2041F7EF,
+                0xBB1D89C9, 0xF44AE1D8, 0x25B359EB, 0x6AE431FA,
+                0x8281343A, 0xCDD65C2B, 0x1C2FE418, 0x53788C09,
+                0x2E5605E3, 0x61016DF2, 0xB0F8D5C1, 0xFFAFBDD0,
+                0x17CAB810, 0x589DD001, 0x89646832, 0xC6330023,
+                0x5D6F7E05, 0x12381614, 0xC3C1AE27, 0x8C96C636,
+                0x64F3C3F6, 0x2BA4ABE7, 0xFA5D13D4, 0xB50A7BC5,
+                0x9488F9E9, 0xDBDF91F8, 0x0A2629CB, 0x457141DA,
+                0xAD14441A, 0xE2432C0B, 0x33BA9438, 0x7CEDFC29,
+                0xE7B1820F, 0xA8E6EA1E, 0x791F522D, 0x36483A3C,
+                0xDE2D3FFC, 0x917A57ED, 0x4083EFDE, 0x0FD487CF,
+                0x72FA0E25, 0x3DAD6634, 0xEC54DE07, 0xA303B616,
+                0x4B66B3D6, 0x0431DBC7, 0xD5C863F4, 0x9A9F0BE5,
+                0x01C375C3, 0x4E941DD2, 0x9F6DA5E1, 0xD03ACDF0,
+                0x385FC830, 0x7708A021, 0xA6F11812, 0xE9A67003,
+                0x5CAC0BC6, 0x13FB63D7, 0xC202DBE4, 0x8D55B3F5,
+                0x6530B635, 0x2A67DE24, 0xFB9E6617, 0xB4C90E06,
+                0x2F957020, 0x60C21831, 0xB13BA002, 0xFE6CC813,
+                0x1609CDD3, 0x595EA5C2, 0x88A71DF1, 0xC7F075E0,
+                0xBADEFC0A, 0xF589941B, 0x24702C28, 0x6B274439,
+                0x834241F9, 0xCC1529E8, 0x1DEC91DB, 0x52BBF9CA,
+                0xC9E787EC, 0x86B0EFFD, 0x574957CE, 0x181E3FDF,
+                0xF07B3A1F, 0xBF2C520E, 0x6ED5EA3D, 0x2182822C,
+                0x2DD0EE65, 0x62878674, 0xB37E3E47, 0xFC295656,
+                0x144C5396, 0x5B1B3B87, 0x8AE283B4, 0xC5B5EBA5,
+                0x5EE99583, 0x11BEFD92, 0xC04745A1, 0x8F102DB0,
+                0x67752870, 0x28224061, 0xF9DBF852, 0xB68C9043,
+                0xCBA219A9, 0x84F571B8, 0x550CC98B, 0x1A5BA19A,
+                0xF23EA45A, 0xBD69CC4B, 0x6C907478, 0x23C71C69,
+                0xB89B624F, 0xF7CC0A5E, 0x2635B26D, 0x6962DA7C,
+                0x8107DFBC, 0xCE50B7AD, 0x1FA90F9E, 0x50FE678F,
+                0xE5F41C4A, 0xAAA3745B, 0x7B5ACC68, 0x340DA479,
+                0xDC68A1B9, 0x933FC9A8, 0x42C6719B, 0x0D91198A,
+                0x96CD67AC, 0xD99A0FBD, 0x0863B78E, 0x4734DF9F,
+                0xAF51DA5F, 0xE006B24E, 0x31FF0A7D, 0x7EA8626C,
+                0x0386EB86, 0x4CD18397, 0x9D283BA4, 0xD27F53B5,
+                0x3A1A5675, 0x754D3E64, 0xA4B48657, 0xEBE3EE46,
+                0x70BF9060, 0x3FE8F871, 0xEE114042, 0xA1462853,
+                0x49232D93, 0x06744582, 0xD78DFDB1, 0x98DA95A0,
+                0xB958178C, 0xF60F7F9D, 0x27F6C7AE, 0x68A1AFBF,
+                0x80C4AA7F, 0xCF93C26E, 0x1E6A7A5D, 0x513D124C,
+                0xCA616C6A, 0x8536047B, 0x54CFBC48, 0x1B98D459,
+                0xF3FDD199, 0xBCAAB988, 0x6D5301BB, 0x220469AA,
+                0x5F2AE040, 0x107D8851, 0xC1843062, 0x8ED35873,
+                0x66B65DB3, 0x29E135A2, 0xF8188D91, 0xB74FE580,
+                0x2C139BA6, 0x6344F3B7, 0xB2BD4B84, 0xFDEA2395,
+                0x158F2655, 0x5AD84E44, 0x8B21F677, 0xC4769E66,
+                0x717CE5A3, 0x3E2B8DB2, 0xEFD23581, 0xA0855D90,
+                0x48E05850, 0x07B73041, 0xD64E8872, 0x9919E063,
+                0x02459E45, 0x4D12F654, 0x9CEB4E67, 0xD3BC2676,
+                0x3BD923B6, 0x748E4BA7, 0xA577F394, 0xEA209B85,
+                0x970E126F, 0xD8597A7E, 0x09A0C24D, 0x46F7AA5C,
+                0xAE92AF9C, 0xE1C5C78D, 0x303C7FBE, 0x7F6B17AF,
+                0xE4376989, 0xAB600198, 0x7A99B9AB, 0x35CED1BA,
+                0xDDABD47A, 0x92FCBC6B, 0x43050458, 0x0C526C49,
+        },
+        [6] = {
+                0x00000000, 0x5BA1DCCA, 0xB743B994, 0xECE2655E,
+                0x6A466E9F, 0x31E7B255, 0xDD05D70B, 0x86A40BC1,
+                0xD48CDD3E, 0x8F2D01F4, 0x63CF64AA, 0x386EB860,
+                0xBECAB3A1, 0xE56B6F6B, 0x09890A35, 0x5228D6FF,
+                0xADD8A7CB, 0xF6797B01, 0x1A9B1E5F, 0x413AC295,
+                0xC79EC954, 0x9C3F159E, 0x70DD70C0, 0x2B7CAC0A,
+                0x79547AF5, 0x22F5A63F, 0xCE17C361, 0x95B61FAB,
+                0x1312146A, 0x48B3C8A0, 0xA451ADFE, 0xFFF07134,
+                0x5F705221, 0x04D18EEB, 0xE833EBB5, 0xB392377F,
+                0x35363CBE, 0x6E97E074, 0x8275852A, 0xD9D459E0,
+                0x8BFC8F1F, 0xD05D53D5, 0x3CBF368B, 0x671EEA41,
+                0xE1BAE180, 0xBA1B3D4A, 0x56F95814, 0x0D5884DE,
+                0xF2A8F5EA, 0xA9092920, 0x45EB4C7E, 0x1E4A90B4,
+                0x98EE9B75, 0xC34F47BF, 0x2FAD22E1, 0x740CFE2B,
+                0x262428D4, 0x7D85F41E, 0x91679140, 0xCAC64D8A,
+                0x4C62464B, 0x17C39A81, 0xFB21FFDF, 0xA0802315,
+                0xBEE0A442, 0xE5417888, 0x09A31DD6, 0x5202C11C,
+                0xD4A6CADD, 0x8F071617, 0x63E57349, 0x3844AF83,
+                0x6A6C797C, 0x31CDA5B6, 0xDD2FC0E8, 0x868E1C22,
+                0x002A17E3, 0x5B8BCB29, 0xB769AE77, 0xECC872BD,
+                0x13380389, 0x4899DF43, 0xA47BBA1D, 0xFFDA66D7,
+                0x797E6D16, 0x22DFB1DC, 0xCE3DD482, 0x959C0848,
+                0xC7B4DEB7, 0x9C15027D, 0x70F76723, 0x2B56BBE9,
+                0xADF2B028, 0xF6536CE2, 0x1AB109BC, 0x4110D576,
+                0xE190F663, 0xBA312AA9, 0x56D34FF7, 0x0D72933D,
+                0x8BD698FC, 0xD0774436, 0x3C952168, 0x6734FDA2,
+                0x351C2B5D, 0x6EBDF797, 0x825F92C9, 0xD9FE4E03,
+                0x5F5A45C2, 0x04FB9908, 0xE819FC56, 0xB3B8209C,
+                0x4C4851A8, 0x17E98D62, 0xFB0BE83C, 0xA0AA34F6,
+                0x260E3F37, 0x7DAFE3FD, 0x914D86A3, 0xCAEC5A69,
+                0x98C48C96, 0xC365505C, 0x2F873502, 0x7426E9C8,
+                0xF282E209, 0xA9233EC3, 0x45C15B9D, 0x1E608757,
+                0x79005533, 0x22A189F9, 0xCE43ECA7, 0x95E2306D,
+                0x13463BAC, 0x48E7E766, 0xA4058238, 0xFFA45EF2,
+                0xAD8C880D, 0xF62D54C7, 0x1ACF3199, 0x416EED53,
+                0xC7CAE692, 0x9C6B3A58, 0x70895F06, 0x2B2883CC,
+                0xD4D8F2F8, 0x8F792E32, 0x639B4B6C, 0x383A97A6,
+                0xBE9E9C67, 0xE53F40AD, 0x09DD25F3, 0x527CF939,
+                0x00542FC6, 0x5BF5F30C, 0xB7179652, 0xECB64A98,
+                0x6A124159, 0x31B39D93, 0xDD51F8CD, 0x86F02407,
+                0x26700712, 0x7DD1DBD8, 0x9133BE86, 0xCA92624C,
+                0x4C36698D, 0x1797B547, 0xFB75D019, 0xA0D40CD3,
+                0xF2FCDA2C, 0xA95D06E6, 0x45BF63B8, 0x1E1EBF72,
+                0x98BAB4B3, 0xC31B6879, 0x2FF90D27, 0x7458D1ED,
+                0x8BA8A0D9, 0xD0097C13, 0x3CEB194D, 0x674AC587,
+                0xE1EECE46, 0xBA4F128C, 0x56AD77D2, 0x0D0CAB18,
+                0x5F247DE7, 0x0485A12D, 0xE867C473, 0xB3C618B9,
+                0x35621378, 0x6EC3CFB2, 0x8221AAEC, 0xD9807626,
+                0xC7E0F171, 0x9C412DBB, 0x70A348E5, 0x2B02942F,
+                0xADA69FEE, 0xF6074324, 0x1AE5267A, 0x4144FAB0,
+                0x136C2C4F, 0x48CDF085, 0xA42F95DB, 0xFF8E4911,
+                0x792A42D0, 0x228B9E1A, 0xCE69FB44, 0x95C8278E,
+                0x6A3856BA, 0x31998A70, 0xDD7BEF2E, 0x86DA33E4,
+                0x007E3825, 0x5BDFE4EF, 0xB73D81B1, 0xEC9C5D7B,
+                0xBEB48B84, 0xE515574E, 0x09F73210, 0x5256EEDA,
+                0xD4F2E51B, 0x8F5339D1, 0x63B15C8F, 0x38108045,
+                0x9890A350, 0xC3317F9A, 0x2FD31AC4, 0x7472C60E,
+                0xF2D6CDCF, 0xA9771105, 0x4595745B, 0x1E34A891,
+                0x4C1C7E6E, 0x17BDA2A4, 0xFB5FC7FA, 0xA0FE1B30,
+                0x265A10F1, 0x7DFBCC3B, 0x9119A965, 0xCAB875AF,
+                0x3548049B, 0x6EE9D851, 0x820BBD0F, 0xD9AA61C5,
+                0x5F0E6A04, 0x04AFB6CE, 0xE84DD390, 0xB3EC0F5A,
+                0xE1C4D9A5, 0xBA65056F, 0x56876031, 0x0D26BCFB,
+                0x8B82B73A, 0xD0236BF0, 0x3CC10EAE, 0x6760D264,
+        },
+#if (XWLIB_CRC32_SLICE > 8U)
+        [7] = {
+                0x00000000, 0xF200AA66, 0xE0C0497B, 0x12C0E31D,
+                0xC5418F41, 0x37412527, 0x2581C63A, 0xD7816C5C,
+                0x8E420335, 0x7C42A953, 0x6E824A4E, 0x9C82E028,
+                0x4B038C74, 0xB9032612, 0xABC3C50F, 0x59C36F69,
+                0x18451BDD, 0xEA45B1BB, 0xF88552A6, 0x0A85F8C0,
+                0xDD04949C, 0x2F043EFA, 0x3DC4DDE7, 0xCFC47781,
+                0x960718E8, 0x6407B28E, 0x76C75193, 0x84C7FBF5,
+                0x534697A9, 0xA1463DCF, 0xB386DED2, 0x418674B4,
+                0x308A37BA, 0xC28A9DDC, 0xD04A7EC1, 0x224AD4A7,
+                0xF5CBB8FB, 0x07CB129D, 0x150BF180, 0xE70B5BE6,
+                0xBEC8348F, 0x4CC89EE9, 0x5E087DF4, 0xAC08D792,
+                0x7B89BBCE, 0x898911A8, 0x9B49F2B5, 0x694958D3,
+                0x28CF2C67, 0xDACF8601, 0xC80F651C, 0x3A0FCF7A,
+                0xED8EA326, 0x1F8E0940, 0x0D4EEA5D, 0xFF4E403B,
+                0xA68D2F52, 0x548D8534, 0x464D6629, 0xB44DCC4F,
+                0x63CCA013, 0x91CC0A75, 0x830CE968, 0x710C430E,
+                0x61146F74, 0x9314C512, 0x81D4260F, 0x73D48C69,
+                0xA455E035, 0x56554A53, 0x4495A94E, 0xB6950328,
+                0xEF566C41, 0x1D56C627, 0x0F96253A, 0xFD968F5C,
+                0x2A17E300, 0xD8174966, 0xCAD7AA7B, 0x38D7001D,
+                0x795174A9, 0x8B51DECF, 0x99913DD2, 0x6B9197B4,
+                0xBC10FBE8, 0x4E10518E, 0x5CD0B293, 0xAED018F5,
+                0xF713779C, 0x0513DDFA, 0x17D33EE7, 0xE5D39481,
+                0x3252F8DD, 0xC05252BB, 0xD292B1A6, 0x20921BC0,
+                0x519E58CE, 0xA39EF2A8, 0xB15E11B5, 0x435EBBD3,
+                0x94DFD78F, 0x66DF7DE9, 0x741F9EF4, 0x861F3492,
+                0xDFDC5BFB, 0x2DDCF19D, 0x3F1C1280, 0xCD1CB8E6,
+                0x1A9DD4BA, 0xE89D7EDC, 0xFA5D9DC1, 0x085D37A7,
+                0x49DB4313, 0xBBDBE975, 0xA91B0A68, 0x5B1BA00E,
+                0x8C9ACC52, 0x7E9A6634, 0x6C5A8529, 0x9E5A2F4F,
+                0xC7994026, 0x3599EA40, 0x2759095D, 0xD559A33B,
+                0x02D8CF67, 0xF0D86501, 0xE218861C, 0x10182C7A,
+                0xC228DEE8, 0x3028748E, 0x22E89793, 0xD0E83DF5,
+                0x076951A9, 0xF569FBCF, 0xE7A918D2, 0x15A9B2B4,
+                0x4C6ADDDD, 0xBE6A77BB, 0xACAA94A6, 0x5EAA3EC0,
+                0x892B529C, 0x7B2BF8FA, 0x69EB1BE7, 0x9BEBB181,
+                0xDA6DC535, 0x286D6F53, 0x3AAD8C4E, 0xC8AD2628,
+                0x1F2C4A74, 0xED2CE012, 0xFFEC030F, 0x0DECA969,
+                0x542FC600, 0xA62F6C66, 0xB4EF8F7B, 0x46EF251D,
+                0x916E4941, 0x636EE327, 0x71AE003A, 0x83AEAA5C,
+                0xF2A2E952, 0x00A24334, 0x1262A029, 0xE0620A4F,
+                0x37E36613, 0xC5E3CC75, 0xD7232F68, 0x2523850E,
+                0x7CE0EA67, 0x8EE04001, 0x9C20A31C, 0x6E20097A,
+                0xB9A16526, 0x4BA1CF40, 0x59612C5D, 0xAB61863B,
+                0xEAE7F28F, 0x18E758E9, 0x0A27BBF4, 0xF8271192,
+                0x2FA67DCE, 0xDDA6D7A8, 0xCF6634B5, 0x3D669ED3,
+                0x64A5F1BA, 0x96A55BDC, 0x8465B8C1, 0x766512A7,
+                0xA1E47EFB, 0x53E4D49D, 0x41243780, 0xB3249DE6,
+                0xA33CB19C, 0x513C1BFA, 0x43FCF8E7, 0xB1FC5281,
+                0x667D3EDD, 0x947D94BB, 0x86BD77A6, 0x74BDDDC0,
+                0x2D7EB2A9, 0xDF7E18CF, 0xCDBEFBD2, 0x3FBE51B4,
+                0xE83F3DE8, 0x1A3F978E, 0x08FF7493, 0xFAFFDEF5,
+                0xBB79AA41, 0x49790027, 0x5BB9E33A, 0xA9B9495C,
+                0x7E382500, 0x8C388F66, 0x9EF86C7B, 0x6CF8C61D,
+                0x353BA974, 0xC73B0312, 0xD5FBE00F, 0x27FB4A69,
+                0xF07A2635, 0x027A8C53, 0x10BA6F4E, 0xE2BAC528,
+                0x93B68626, 0x61B62C40, 0x7376CF5D, 0x8176653B,
+                0x56F70967, 0xA4F7A301, 0xB637401C, 0x4437EA7A,
+                0x1DF48513, 0xEFF42F75, 0xFD34CC68, 0x0F34660E,
+                0xD8B50A52, 0x2AB5A034, 0x38754329, 0xCA75E94F,
+                0x8BF39DFB, 0x79F3379D, 0x6B33D480, 0x99337EE6,
+                0x4EB212BA, 0xBCB2B8DC, 0xAE725BC1, 0x5C72F1A7,
+                0x05B19ECE, 0xF7B134A8, 0xE571D7B5, 0x17717DD3,
+                0xC0F0118F, 0x32F0BBE9, 0x203058F4, 0xD230F292,
+        },
+        [8] = {
+                0x00000000, 0x8090A067, 0x05E05D79, 0x8570FD1E,
+                0x0BC0BAF2, 0x8B501A95, 0x0E20E78B, 0x8EB047EC,
+                0x178175E4, 0x9711D583, 0x1261289D, 0x92F188FA,
+                0x1C41CF16, 0x9CD16F71, 0x19A1926F, 0x99313208,
+                0x2F02EBC8, 0xAF924BAF, 0x2AE2B6B1, 0xAA7216D6,
+                0x24C2513A, 0xA452F15D, 0x21220C43, 0xA1B2AC24,
+                0x38839E2C, 0xB8133E4B, 0x3D63C355, 0xBDF36332,
+                0x334324DE, 0xB3D384B9, 0x36A379A7, 0xB633D9C0,
+                0x5E05D790, 0xDE9577F7, 0x5BE58AE9, 0xDB752A8E,
+                0x55C56D62, 0xD555CD05, 0x5025301B, 0xD0B5907C,
+                0x4984A274, 0xC9140213, 0x4C64FF0D, 0xCCF45F6A,
+                0x42441886, 0xC2D4B8E1, 0x47A445FF, 0xC734E598,
+                0x71073C58, 0xF1979C3F, 0x74E76121, 0xF477C146,
+                0x7AC786AA, 0xFA5726CD, 0x7F27DBD3, 0xFFB77BB4,
+                0x668649BC, 0xE616E9DB, 0x636614C5, 0xE3F6B4A2,
+                0x6D46F34E, 0xEDD65329, 0x68A6AE37, 0xE8360E50,
+                0xBC0BAF20, 0x3C9B0F47, 0xB9EBF259, 0x397B523E,
+                0xB7CB15D2, 0x375BB5B5, 0xB22B48AB, 0x32BBE8CC,
+                0xAB8ADAC4, 0x2B1A7AA3, 0xAE6A87BD, 0x2EFA27DA,
+                0xA04A6036, 0x20DAC051, 0xA5AA3D4F, 0x253A9D28,
+                0x930944E8, 0x1399E48F, 0x96E91991, 0x1679B9F6,
+                0x98C9FE1A, 0x18595E7D, 0x9D29A363, 0x1DB90304,
+                0x8488310C, 0x0418916B, 0x81686C75, 0x01F8CC12,
+                0x8F488BFE, 0x0FD82B99, 0x8AA8D687, 0x0A3876E0,
+                0xE20E78B0, 0x629ED8D7, 0xE7EE25C9, 0x677E85AE,
+                0xE9CEC242, 0x695E6225, 0xEC2E9F3B, 0x6CBE3F5C,
+                0xF58F0D54, 0x751FAD33, 0xF06F502D, 0x70FFF04A,
+                0xFE4FB7A6, 0x7EDF17C1, 0xFBAFEADF, 0x7B3F4AB8,
+                0xCD0C9378, 0x4D9C331F, 0xC8ECCE01, 0x487C6E66,
+                0xC6CC298A, 0x465C89ED, 0xC32C74F3, 0x43BCD494,
+                0xDA8DE69C, 0x5A1D46FB, 0xDF6DBBE5, 0x5FFD1B82,
+                0xD14D5C6E, 0x51DDFC09, 0xD4AD0117, 0x543DA170,
+                0x7CD643F7, 0xFC46E390, 0x79361E8E, 0xF9A6BEE9,
+                0x7716F905, 0xF7865962, 0x72F6A47C, 0xF266041B,
+                0x6B573613, 0xEBC79674, 0x6EB76B6A, 0xEE27CB0D,
+                0x60978CE1, 0xE0072C86, 0x6577D198, 0xE5E771FF,
+                0x53D4A83F, 0xD3440858, 0x5634F546, 0xD6A45521,
+                0x581412CD, 0xD884B2AA, 0x5DF44FB4, 0xDD64EFD3,
+                0x4455DDDB, 0xC4C57DBC, 0x41B580A2, 0xC12520C5,
+                0x4F956729, 0xCF05C74E, 0x4A753A50, 0xCAE59A37,
+                0x22D39467, 0xA2433400, 0x2733C91E, 0xA7A36979,
+                0x29132E95, 0xA9838EF2, 0x2CF373EC, 0xAC63D38B,
+                0x3552E183, 0xB5C241E4, 0x30B2BCFA, 0xB0221C9D,
+                0x3E925B71, 0xBE02FB16, 0x3B720608, 0xBBE2A66F,
+                0x0DD17FAF, 0x8D41DFC8, 0x083122D6, 0x88A182B1,
+                0x0611C55D, 0x8681653A, 0x03F19824, 0x83613843,
+                0x1A500A4B, 0x9AC0AA2C, 0x1FB05732, 0x9F20F755,
+                0x1190B0B9, 0x910010DE, 0x1470EDC0, 0x94E04DA7,
+                0xC0DDECD7, 0x404D4CB0, 0xC53DB1AE, 0x45AD11C9,
+                0xCB1D5625, 0x4B8DF642, 0xCEFD0B5C, 0x4E6DAB3B,
+                0xD75C9933, 0x57CC3954, 0xD2BCC44A, 0x522C642D,
+                0xDC9C23C1, 0x5C0C83A6, 0xD97C7EB8, 0x59ECDEDF,
+                0xEFDF071F, 0x6F4FA778, 0xEA3F5A66, 0x6AAFFA01,
+                0xE41FBDED, 0x648F1D8A, 0xE1FFE094, 0x616F40F3,
+                0xF85E72FB, 0x78CED29C, 0xFDBE2F82, 0x7D2E8FE5,
+                0xF39EC809, 0x730E686E, 0xF67E9570, 0x76EE3517,
+                0x9ED83B47, 0x1E489B20, 0x9B38663E, 0x1BA8C659,
+                0x951881B5, 0x158821D2, 0x90F8DCCC, 0x10687CAB,
+                0x89594EA3, 0x09C9EEC4, 0x8CB913DA, 0x0C29B3BD,
+                0x8299F451, 0x02095436, 0x8779A928, 0x07E9094F,
+                0xB1DAD08F, 0x314A70E8, 0xB43A8DF6, 0x34AA2D91,
+                0xBA1A6A7D, 0x3A8ACA1A, 0xBFFA3704, 0x3F6A9763,
+                0xA65BA56B, 0x26CB050C, 0xA3BBF812, 0x232B5875,
+                0xAD9B1F99, 0x2D0BBFFE, 0xA87B42E0, 0x28EBE287,
+        },
+        [9] = {
+                0x00000000, 0xF9AC87EE, 0xF798126B, 0x0E349585,
+                0xEBF13961, 0x125DBE8F, 0x1C692B0A, 0xE5C5ACE4,
+                0xD3236F75, 0x2A8FE89B, 0x24BB7D1E, 0xDD17FAF0,
+                0x38D25614, 0xC17ED1FA, 0xCF4A447F, 0x36E6C391,
+                0xA287C35D, 0x5B2B44B3, 0x551FD136, 0xACB356D8,
+                0x4976FA3C, 0xB0DA7DD2, 0xBEEEE857, 0x47426FB9,
+                0x71A4AC28, 0x88082BC6, 0x863CBE43, 0x7F9039AD,
+                0x9A559549, 0x63F912A7, 0x6DCD8722, 0x946100CC,
+                0x41CE9B0D, 0xB8621CE3, 0xB6568966, 0x4FFA0E88,
+                0xAA3FA26C, 0x53932582, 0x5DA7B007, 0xA40B37E9,
+                0x92EDF478, 0x6B417396, 0x6575E613, 0x9CD961FD,
+                0x791CCD19, 0x80B04AF7, 0x8E84DF72, 0x7728589C,
+                0xE3495850, 0x1AE5DFBE, 0x14D14A3B, 0xED7DCDD5,
+                0x08B86131, 0xF114E6DF, 0xFF20735A, 0x068CF4B4,
+                0x306A3725, 0xC9C6B0CB, 0xC7F2254E, 0x3E5EA2A0,
+                0xDB9B0E44, 0x223789AA, 0x2C031C2F, 0xD5AF9BC1,
+                0x839D361A, 0x7A31B1F4, 0x74052471, 0x8DA9A39F,
+                0x686C0F7B, 0x91C08895, 0x9FF41D10, 0x66589AFE,
+                0x50BE596F, 0xA912DE81, 0xA7264B04, 0x5E8ACCEA,
+                0xBB4F600E, 0x42E3E7E0, 0x4CD77265, 0xB57BF58B,
+                0x211AF547, 0xD8B672A9, 0xD682E72C, 0x2F2E60C2,
+                0xCAEBCC26, 0x33474BC8, 0x3D73DE4D, 0xC4DF59A3,
+                0xF2399A32, 0x0B951DDC, 0x05A18859, 0xFC0D0FB7,
+                0x19C8A353, 0xE06424BD, 0xEE50B138, 0x17FC36D6,
+                0xC253AD17, 0x3BFF2AF9, 0x35CBBF7C, 0xCC673892,
+                0x29A29476, 0xD00E1398, 0xDE3A861D, 0x279601F3,
+                0x1170C262, 0xE8DC458C, 0xE6E8D009, 0x1F4457E7,
+                0xFA81FB03, 0x032D7CED, 0x0D19E968, 0xF4B56E86,
+                0x60D46E4A, 0x9978E9A4, 0x974C7C21, 0x6EE0FBCF,
+                0x8B25572B, 0x7289D0C5, 0x7CBD4540, 0x8511C2AE,
+                0xB3F7013F, 0x4A5B86D1, 0x446F1354, 0xBDC394BA,
+                0x5806385E, 0xA1AABFB0, 0xAF9E2A35, 0x5632ADDB,
+                0x03FB7183, 0xFA57F66D, 0xF46363E8, 0x0DCFE406,
+                0xE80A48E2, 0x11A6CF0C, 0x1F925A89, 0xE63EDD67,
+                0xD0D81EF6, 0x29749918, 0x27400C9D, 0xDEEC8B73,
+                0x3B292797, 0xC285A079, 0xCCB135FC, 0x351DB212,
+                0xA17CB2DE, 0x58D03530, 0x56E4A0B5, 0xAF48275B,
+                0x4A8D8BBF, 0xB3210C51, 0xBD1599D4, 0x44B91E3A,
+                0x725FDDAB, 0x8BF35A45, 0x85C7CFC0, 0x7C6B482E,
+                0x99AEE4CA, 0x60026324, 0x6E36F6A1, 0x979A714F,
+                0x4235EA8E, 0xBB996D60, 0xB5ADF8E5, 0x4C017F0B,
+                0xA9C4D3EF, 0x50685401, 0x5E5CC184, 0xA7F0466A,
+                0x911685FB, 0x68BA0215, 0x668E9790, 0x9F22107E,
+                0x7AE7BC9A, 0x834B3B74, 0x8D7FAEF1, 0x74D3291F,
+                0xE0B229D3, 0x191EAE3D, 0x172A3BB8, 0xEE86BC56,
+                0x0B4310B2, 0xF2EF975C, 0xFCDB02D9, 0x05778537,
+                0x339146A6, 0xCA3DC148, 0xC40954CD, 0x3DA5D323,
+                0xD8607FC7, 0x21CCF829, 0x2FF86DAC, 0xD654EA42,
+                0x80664799, 0x79CAC077, 0x77FE55F2, 0x8E52D21C,
+                0x6B977EF8, 0x923BF916, 0x9C0F6C93, 0x65A3EB7D,
+                0x534528EC, 0xAAE9AF02, 0xA4DD3A87, 0x5D71BD69,
+                0xB8B4118D, 0x41189663, 0x4F2C03E6, 0xB6808408,
+                0x22E184C4, 0xDB4D032A, 0xD57996AF, 0x2CD51141,
+                0xC910BDA5, 0x30BC3A4B, 0x3E88AFCE, 0xC7242820,
+                0xF1C2EBB1, 0x086E6C5F, 0x065AF9DA, 0xFFF67E34,
+                0x1A33D2D0, 0xE39F553E, 0xEDABC0BB, 0x14074755,
+                0xC1A8DC94, 0x38045B7A, 0x3630CEFF, 0xCF9C4911,
+                0x2A59E5F5, 0xD3F5621B, 0xDDC1F79E, 0x246D7070,
+                0x128BB3E1, 0xEB27340F, 0xE513A18A, 0x1CBF2664,
+                0xF97A8A80, 0x00D60D6E, 0x0EE298EB, 0xF74E1F05,
+                0x632F1FC9, 0x9A839827, 0x94B70DA2, 0x6D1B8A4C,
+                0x88DE26A8, 0x7172A146, 0x7F4634C3, 0x86EAB32D,
+                0xB00C70BC, 0x49A0F752, 0x479462D7, 0xBE38E539,
+                0x5BFD49DD, 0xA251CE33, 0xAC655BB6, 0x55C9DC58,
+        },
+        [10] = {
+                0x00000000, 0x07F6E306, 0x0FEDC60C, 0x081B250A,
+                0x1FDB8C18, 0x182D6F1E, 0x10364A14, 0x17C0A912,
+                0x3FB71830, 0x3841FB36, 0x305ADE3C, 0x37AC3D3A,
+                0x206C9428, 0x279A772E, 0x2F815224, 0x2877B122,
+                0x7F6E3060, 0x7898D366, 0x7083F66C, 0x7775156A,
+                0x60B5BC78, 0x67435F7E, 0x6F587A74, 0x68AE9972,
+                0x40D92850, 0x472FCB56, 0x4F34EE5C, 0x48C20D5A,
+                0x5F02A448, 0x58F4474E, 0x50EF6244, 0x57198142,
+                0xFEDC60C0, 0xF92A83C6, 0xF131A6CC, 0xF6C745CA,
+                0xE107ECD8, 0xE6F10FDE, 0xEEEA2AD4, 0xE91CC9D2,
+                0xC16B78F0, 0xC69D9BF6, 0xCE86BEFC, 0xC9705DFA,
+                0xDEB0F4E8, 0xD94617EE, 0xD15D32E4, 0xD6ABD1E2,
+                0x81B250A0, 0x8644B3A6, 0x8E5F96AC, 0x89A975AA,
+                0x9E69DCB8, 0x999F3FBE, 0x91841AB4, 0x9672F9B2,
+                0xBE054890, 0xB9F3AB96, 0xB1E88E9C, 0xB61E6D9A,
+                0xA1DEC488, 0xA628278E, 0xAE330284, 0xA9C5E182,
+                0xF979DC37, 0xFE8F3F31, 0xF6941A3B, 0xF162F93D,
+                0xE6A2502F, 0xE154B329, 0xE94F9623, 0xEEB97525,
+                0xC6CEC407, 0xC1382701, 0xC923020B, 0xCED5E10D,
+                0xD915481F, 0xDEE3AB19, 0xD6F88E13, 0xD10E6D15,
+                0x8617EC57, 0x81E10F51, 0x89FA2A5B, 0x8E0CC95D,
+                0x99CC604F, 0x9E3A8349, 0x9621A643, 0x91D74545,
+                0xB9A0F467, 0xBE561761, 0xB64D326B, 0xB1BBD16D,
+                0xA67B787F, 0xA18D9B79, 0xA996BE73, 0xAE605D75,
+                0x07A5BCF7, 0x00535FF1, 0x08487AFB, 0x0FBE99FD,
+                0x187E30EF, 0x1F88D3E9, 0x1793F6E3, 0x106515E5,
+                0x3812A4C7, 0x3FE447C1, 0x37FF62CB, 0x300981CD,
+                0x27C928DF, 0x203FCBD9, 0x2824EED3, 0x2FD20DD5,
+                0x78CB8C97, 0x7F3D6F91, 0x77264A9B, 0x70D0A99D,
+                0x6710008F, 0x60E6E389, 0x68FDC683, 0x6F0B2585,
+                0x477C94A7, 0x408A77A1, 0x489152AB, 0x4F67B1AD,
+                0x58A718BF, 0x5F51FBB9, 0x574ADEB3, 0x50BC3DB5,
+                0xF632A5D9, 0xF1C446DF, 0xF9DF63D5, 0xFE2980D3,
+                0xE9E929C1, 0xEE1FCAC7, 0xE604EFCD, 0xE1F20CCB,
+                0xC985BDE9, 0xCE735EEF, 0xC6687BE5, 0xC19E98E3,
+                0xD65E31F1, 0xD1A8D2F7, 0xD9B3F7FD, 0xDE4514FB,
+                0x895C95B9, 0x8EAA76BF, 0x86B153B5, 0x8147B0B3,
+                0x968719A1, 0x9171FAA7, 0x996ADFAD, 0x9E9C3CAB,
+                0xB6EB8D89, 0xB11D6E8F, 0xB9064B85, 0xBEF0A883,
+                0xA9300191, 0xAEC6E297, 0xA6DDC79D, 0xA12B249B,
+                0x08EEC519, 0x0F18261F, 0x07030315, 0x00F5E013,
+                0x17354901, 0x10C3AA07, 0x18D88F0D, 0x1F2E6C0B,
+                0x3759DD29, 0x30AF3E2F, 0x38B41B25, 0x3F42F823,
+                0x28825131, 0x2F74B237, 0x276F973D, 0x2099743B,
+                0x7780F579, 0x7076167F, 0x786D3375, 0x7F9BD073,
+                0x685B7961, 0x6FAD9A67, 0x67B6BF6D, 0x60405C6B,
+                0x4837ED49, 0x4FC10E4F, 0x47DA2B45, 0x402CC843,
+                0x57EC6151, 0x501A8257, 0x5801A75D, 0x5FF7445B,
+                0x0F4B79EE, 0x08BD9AE8, 0x00A6BFE2, 0x07505CE4,
+                0x1090F5F6, 0x176616F0, 0x1F7D33FA, 0x188BD0FC,
+                0x30FC61DE, 0x370A82D8, 0x3F11A7D2, 0x38E744D4,
+                0x2F27EDC6, 0x28D10EC0, 0x20CA2BCA, 0x273CC8CC,
+                0x7025498E, 0x77D3AA88, 0x7FC88F82, 0x783E6C84,
+                0x6FFEC596, 0x68082690, 0x6013039A, 0x67E5E09C,
+                0x4F9251BE, 0x4864B2B8, 0x407F97B2, 0x478974B4,
+                0x5049DDA6, 0x57BF3EA0, 0x5FA41BAA, 0x5852F8AC,
+                0xF197192E, 0xF661FA28, 0xFE7ADF22, 0xF98C3C24,
+                0xEE4C9536, 0xE9BA7630, 0xE1A1533A, 0xE657B03C,
+                0xCE20011E, 0xC9D6E218, 0xC1CDC712, 0xC63B2414,
+                0xD1FB8D06, 0xD60D6E00, 0xDE164B0A, 0xD9E0A80C,
+                0x8EF9294E, 0x890FCA48, 0x8114EF42, 0x86E20C44,
+                0x9122A556, 0x96D44650, 0x9ECF635A, 0x9939805C,
+                0xB14E317E, 0xB6B8D278, 0xBEA3F772, 0xB9551474,
+                0xAE95BD66, 0xA9635E60, 0xA1787B6A, 0xA68E986C,
+        },
+        [11] = {
+                0x00000000, 0xE8A45605, 0xD589B1BD, 0x3D2DE7B8,
+                0xAFD27ECD, 0x477628C8, 0x7A5BCF70, 0x92FF9975,
+                0x5B65E02D, 0xB3C1B628, 0x8EEC5190, 0x66480795,
+                0xF4B79EE0, 0x1C13C8E5, 0x213E2F5D, 0xC99A7958,
+                0xB6CBC05A, 0x5E6F965F, 0x634271E7, 0x8BE627E2,
+                0x1919BE97, 0xF1BDE892, 0xCC900F2A, 0x2434592F,
+                0xEDAE2077, 0x050A7672, 0x382791CA, 0xD083C7CF,
+                0x427C5EBA, 0xAAD808BF, 0x97F5EF07, 0x7F51B902,
+                0x69569D03, 0x81F2CB06, 0xBCDF2CBE, 0x547B7ABB,
+                0xC684E3CE, 0x2E20B5CB, 0x130D5273, 0xFBA90476,
+                0x32337D2E, 0xDA972B2B, 0xE7BACC93, 0x0F1E9A96,
+                0x9DE103E3, 0x754555E6, 0x4868B25E, 0xA0CCE45B,
+                0xDF9D5D59, 0x37390B5C, 0x0A14ECE4, 0xE2B0BAE1,
+                0x704F2394, 0x98EB7591, 0xA5C69229, 0x4D62C42C,
+                0x84F8BD74, 0x6C5CEB71, 0x51710CC9, 0xB9D55ACC,
+                0x2B2AC3B9, 0xC38E95BC, 0xFEA37204, 0x16072401,
+                0xD2AD3A06, 0x3A096C03, 0x07248BBB, 0xEF80DDBE,
+                0x7D7F44CB, 0x95DB12CE, 0xA8F6F576, 0x4052A373,
+                0x89C8DA2B, 0x616C8C2E, 0x5C416B96, 0xB4E53D93,
+                0x261AA4E6, 0xCEBEF2E3, 0xF393155B, 0x1B37435E,
+                0x6466FA5C, 0x8CC2AC59, 0xB1EF4BE1, 0x594B1DE4,
+                0xCBB48491, 0x2310D294, 0x1E3D352C, 0xF6996329,
+                0x3F031A71, 0xD7A74C74, 0xEA8AABCC, 0x022EFDC9,
+                0x90D164BC, 0x787532B9, 0x4558D501, 0xADFC8304,
+                0xBBFBA705, 0x535FF100, 0x6E7216B8, 0x86D640BD,
+                0x1429D9C8, 0xFC8D8FCD, 0xC1A06875, 0x29043E70,
+                0xE09E4728, 0x083A112D, 0x3517F695, 0xDDB3A090,
+                0x4F4C39E5, 0xA7E86FE0, 0x9AC58858, 0x7261DE5D,
+                0x0D30675F, 0xE594315A, 0xD8B9D6E2, 0x301D80E7,
+                0xA2E21992, 0x4A464F97, 0x776BA82F, 0x9FCFFE2A,
+                0x56558772, 0xBEF1D177, 0x83DC36CF, 0x6B7860CA,
+                0xF987F9BF, 0x1123AFBA, 0x2C0E4802, 0xC4AA1E07,
+                0xA19B69BB, 0x493F3FBE, 0x7412D806, 0x9CB68E03,
+                0x0E491776, 0xE6ED4173, 0xDBC0A6CB, 0x3364F0CE,
+                0xFAFE8996, 0x125ADF93, 0x2F77382B, 0xC7D36E2E,
+                0x552CF75B, 0xBD88A15E, 0x80A546E6, 0x680110E3,
+                0x1750A9E1, 0xFFF4FFE4, 0xC2D9185C, 0x2A7D4E59,
+                0xB882D72C, 0x50268129, 0x6D0B6691, 0x85AF3094,
+                0x4C3549CC, 0xA4911FC9, 0x99BCF871, 0x7118AE74,
+                0xE3E73701, 0x0B436104, 0x366E86BC, 0xDECAD0B9,
+                0xC8CDF4B8, 0x2069A2BD, 0x1D444505, 0xF5E01300,
+                0x671F8A75, 0x8FBBDC70, 0xB2963BC8, 0x5A326DCD,
+                0x93A81495, 0x7B0C4290, 0x4621A528, 0xAE85F32D,
+                0x3C7A6A58, 0xD4DE3C5D, 0xE9F3DBE5, 0x01578DE0,
+                0x7E0634E2, 0x96A262E7, 0xAB8F855F, 0x432BD35A,
+                0xD1D44A2F, 0x39701C2A, 0x045DFB92, 0xECF9AD97,
+                0x2563D4CF, 0xCDC782CA, 0xF0EA6572, 0x184E3377,
+                0x8AB1AA02, 0x6215FC07, 0x5F381BBF, 0xB79C4DBA,
+                0x733653BD, 0x9B9205B8, 0xA6BFE200, 0x4E1BB405,
+                0xDCE42D70, 0x34407B75, 0x096D9CCD, 0xE1C9CAC8,
+                0x2853B390, 0xC0F7E595, 0xFDDA022D, 0x157E5428,
+                0x8781CD5D, 0x6F259B58, 0x52087CE0, 0xBAAC2AE5,
+                0xC5FD93E7, 0x2D59C5E2, 0x1074225A, 0xF8D0745F,
+                0x6A2FED2A, 0x828BBB2F, 0xBFA65C97, 0x57020A92,
+                0x9E9873CA, 0x763C25CF, 0x4B11C277, 0xA3B59472,
+                0x314A0D07, 0xD9EE5B02, 0xE4C3BCBA, 0x0C67EABF,
+                0x1A60CEBE, 0xF2C498BB, 0xCFE97F03, 0x274D2906,
+                0xB5B2B073, 0x5D16E676, 0x603B01CE, 0x889F57CB,
+                0x41052E93, 0xA9A17896, 0x948C9F2E, 0x7C28C92B,
+                0xEED7505E, 0x0673065B, 0x3B5EE1E3, 0xD3FAB7E6,
+                0xACAB0EE4, 0x440F58E1, 0x7922BF59, 0x9186E95C,
+                0x03797029, 0xEBDD262C, 0xD6F0C194, 0x3E549791,
+                0xF7CEEEC9, 0x1F6AB8CC, 0x22475F74, 0xCAE30971,
+                0x581C9004, 0xB0B8C601, 0x8D9521B9, 0x653177BC,
+        },
+        [12] = {
+                0x00000000, 0x47F7CEC1, 0x8FEF9D82, 0xC8185343,
+                0x1B1E26B3, 0x5CE9E872, 0x94F1BB31, 0xD30675F0,
+                0x363C4D66, 0x71CB83A7, 0xB9D3D0E4, 0xFE241E25,
+                0x2D226BD5, 0x6AD5A514, 0xA2CDF657, 0xE53A3896,
+                0x6C789ACC, 0x2B8F540D, 0xE397074E, 0xA460C98F,
+                0x7766BC7F, 0x309172BE, 0xF88921FD, 0xBF7EEF3C,
+                0x5A44D7AA, 0x1DB3196B, 0xD5AB4A28, 0x925C84E9,
+                0x415AF119, 0x06AD3FD8, 0xCEB56C9B, 0x8942A25A,
+                0xD8F13598, 0x9F06FB59, 0x571EA81A, 0x10E966DB,
+                0xC3EF132B, 0x8418DDEA, 0x4C008EA9, 0x0BF74068,
+                0xEECD78FE, 0xA93AB63F, 0x6122E57C, 0x26D52BBD,
+                0xF5D35E4D, 0xB224908C, 0x7A3CC3CF, 0x3DCB0D0E,
+                0xB489AF54, 0xF37E6195, 0x3B6632D6, 0x7C91FC17,
+                0xAF9789E7, 0xE8604726, 0x20781465, 0x678FDAA4,
+                0x82B5E232, 0xC5422CF3, 0x0D5A7FB0, 0x4AADB171,
+                0x99ABC481, 0xDE5C0A40, 0x16445903, 0x51B397C2,
+                0xB5237687, 0xF2D4B846, 0x3ACCEB05, 0x7D3B25C4,
+                0xAE3D5034, 0xE9CA9EF5, 0x21D2CDB6, 0x66250377,
+                0x831F3BE1, 0xC4E8F520, 0x0CF0A663, 0x4B0768A2,
+                0x98011D52, 0xDFF6D393, 0x17EE80D0, 0x50194E11,
+                0xD95BEC4B, 0x9EAC228A, 0x56B471C9, 0x1143BF08,
+                0xC245CAF8, 0x85B20439, 0x4DAA577A, 0x0A5D99BB,
+                0xEF67A12D, 0xA8906FEC, 0x60883CAF, 0x277FF26E,
+                0xF479879E, 0xB38E495F, 0x7B961A1C, 0x3C61D4DD,
+                0x6DD2431F, 0x2A258DDE, 0xE23DDE9D, 0xA5CA105C,
+                0x76CC65AC, 0x313BAB6D, 0xF923F82E, 0xBED436EF,
+                0x5BEE0E79, 0x1C19C0B8, 0xD40193FB, 0x93F65D3A,
+                0x40F028CA, 0x0707E60B, 0xCF1FB548, 0x88E87B89,
+                0x01AAD9D3, 0x465D1712, 0x8E454451, 0xC9B28A90,
+                0x1AB4FF60, 0x5D4331A1, 0x955B62E2, 0xD2ACAC23,
+                0x379694B5, 0x70615A74, 0xB8790937, 0xFF8EC7F6,
+                0x2C88B206, 0x6B7F7CC7, 0xA3672F84, 0xE490E145,
+                0x6E87F0B9, 0x29703E78, 0xE1686D3B, 0xA69FA3FA,
+                0x7599D60A, 0x326E18CB, 0xFA764B88, 0xBD818549,
+                0x58BBBDDF, 0x1F4C731E, 0xD754205D, 0x90A3EE9C,
+                0x43A59B6C, 0x045255AD, 0xCC4A06EE, 0x8BBDC82F,
+                0x02FF6A75, 0x4508A4B4, 0x8D10F7F7, 0xCAE73936,
+                0x19E14CC6, 0x5E168207, 0x960ED144, 0xD1F91F85,
+                0x34C32713, 0x7334E9D2, 0xBB2CBA91, 0xFCDB7450,
+                0x2FDD01A0, 0x682ACF61, 0xA0329C22, 0xE7C552E3,
+                0xB676C521, 0xF1810BE0, 0x399958A3, 0x7E6E9662,
+                0xAD68E392, 0xEA9F2D53, 0x22877E10, 0x6570B0D1,
+                0x804A8847, 0xC7BD4686, 0x0FA515C5, 0x4852DB04,
+                0x9B54AEF4, 0xDCA36035, 0x14BB3376, 0x534CFDB7,
+                0xDA0E5FED, 0x9DF9912C, 0x55E1C26F, 0x12160CAE,
+                0xC110795E, 0x86E7B79F, 0x4EFFE4DC, 0x09082A1D,
+                0xEC32128B, 0xABC5DC4A, 0x63DD8F09, 0x242A41C8,
+                0xF72C3438, 0xB0DBFAF9, 0x78C3A9BA, 0x3F34677B,
+                0xDBA4863E, 0x9C5348FF, 0x544B1BBC, 0x13BCD57D,
+                0xC0BAA08D, 0x874D6E4C, 0x4F553D0F, 0x08A2F3CE,
+                0xED98CB58, 0xAA6F0599, 0x627756DA, 0x2580981B,
+                0xF686EDEB, 0xB171232A, 0x79697069, 0x3E9EBEA8,
+                0xB7DC1CF2, 0xF02BD233, 0x38338170, 0x7FC44FB1,
+                0xACC23A41, 0xEB35F480, 0x232DA7C3, 0x64DA6902,
+                0x81E05194, 0xC6179F55, 0x0E0FCC16, 0x49F802D7,
+                0x9AFE7727, 0xDD09B9E6, 0x1511EAA5, 0x52E62464,
+                0x0355B3A6, 0x44A27D67, 0x8CBA2E24, 0xCB4DE0E5,
+                0x184B9515, 0x5FBC5BD4, 0x97A40897, 0xD053C656,
+                0x3569FEC0, 0x729E3001, 0xBA866342, 0xFD71AD83,
+                0x2E77D873, 0x698016B2, 0xA19845F1, 0xE66F8B30,
+                0x6F2D296A, 0x28DAE7AB, 0xE0C2B4E8, 0xA7357A29,
+                0x74330FD9, 0x33C4C118, 0xFBDC925B, 0xBC2B5C9A,
+                0x5911640C, 0x1EE6AACD, 0xD6FEF98E, 0x9109374F,
+                0x420F42BF, 0x05F88C7E, 0xCDE0DF3D, 0x8A1711FC,
+        },
+        [13] = {
+                0x00000000, 0xDD0FE172, 0xBEDEDF53, 0x63D13E21,
+                0x797CA311, 0xA4734263, 0xC7A27C42, 0x1AAD9D30,
+                0xF2F94622, 0x2FF6A750, 0x4C279971, 0x91287803,
+                0x8B85E533, 0x568A0441, 0x355B3A60, 0xE854DB12,
+                0xE13391F3, 0x3C3C7081, 0x5FED4EA0, 0x82E2AFD2,
+                0x984F32E2, 0x4540D390, 0x2691EDB1, 0xFB9E0CC3,
+                0x13CAD7D1, 0xCEC536A3, 0xAD140882, 0x701BE9F0,
+                0x6AB674C0, 0xB7B995B2, 0xD468AB93, 0x09674AE1,
+                0xC6A63E51, 0x1BA9DF23, 0x7878E102, 0xA5770070,
+                0xBFDA9D40, 0x62D57C32, 0x01044213, 0xDC0BA361,
+                0x345F7873, 0xE9509901, 0x8A81A720, 0x578E4652,
+                0x4D23DB62, 0x902C3A10, 0xF3FD0431, 0x2EF2E543,
+                0x2795AFA2, 0xFA9A4ED0, 0x994B70F1, 0x44449183,
+                0x5EE90CB3, 0x83E6EDC1, 0xE037D3E0, 0x3D383292,
+                0xD56CE980, 0x086308F2, 0x6BB236D3, 0xB6BDD7A1,
+                0xAC104A91, 0x711FABE3, 0x12CE95C2, 0xCFC174B0,
+                0x898D6115, 0x54828067, 0x3753BE46, 0xEA5C5F34,
+                0xF0F1C204, 0x2DFE2376, 0x4E2F1D57, 0x9320FC25,
+                0x7B742737, 0xA67BC645, 0xC5AAF864, 0x18A51916,
+                0x02088426, 0xDF076554, 0xBCD65B75, 0x61D9BA07,
+                0x68BEF0E6, 0xB5B11194, 0xD6602FB5, 0x0B6FCEC7,
+                0x11C253F7, 0xCCCDB285, 0xAF1C8CA4, 0x72136DD6,
+                0x9A47B6C4, 0x474857B6, 0x24996997, 0xF99688E5,
+                0xE33B15D5, 0x3E34F4A7, 0x5DE5CA86, 0x80EA2BF4,
+                0x4F2B5F44, 0x9224BE36, 0xF1F58017, 0x2CFA6165,
+                0x3657FC55, 0xEB581D27, 0x88892306, 0x5586C274,
+                0xBDD21966, 0x60DDF814, 0x030CC635, 0xDE032747,
+                0xC4AEBA77, 0x19A15B05, 0x7A706524, 0xA77F8456,
+                0xAE18CEB7, 0x73172FC5, 0x10C611E4, 0xCDC9F096,
+                0xD7646DA6, 0x0A6B8CD4, 0x69BAB2F5, 0xB4B55387,
+                0x5CE18895, 0x81EE69E7, 0xE23F57C6, 0x3F30B6B4,
+                0x259D2B84, 0xF892CAF6, 0x9B43F4D7, 0x464C15A5,
+                0x17DBDF9D, 0xCAD43EEF, 0xA90500CE, 0x740AE1BC,
+                0x6EA77C8C, 0xB3A89DFE, 0xD079A3DF, 0x0D7642AD,
+                0xE52299BF, 0x382D78CD, 0x5BFC46EC, 0x86F3A79E,
+                0x9C5E3AAE, 0x4151DBDC, 0x2280E5FD, 0xFF8F048F,
+                0xF6E84E6E, 0x2BE7AF1C, 0x4836913D, 0x9539704F,
+                0x8F94ED7F, 0x529B0C0D, 0x314A322C, 0xEC45D35E,
+                0x0411084C, 0xD91EE93E, 0xBACFD71F, 0x67C0366D,
+                0x7D6DAB5D, 0xA0624A2F, 0xC3B3740E, 0x1EBC957C,
+                0xD17DE1CC, 0x0C7200BE, 0x6FA33E9F, 0xB2ACDFED,
+                0xA80142DD, 0x750EA3AF, 0x16DF9D8E, 0xCBD07CFC,
+                0x2384A7EE, 0xFE8B469C, 0x9D5A78BD, 0x405599CF,
+                0x5AF804FF, 0x87F7E58D, 0xE426DBAC, 0x39293ADE,
+                0x304E703F, 0xED41914D, 0x8E90AF6C, 0x539F4E1E,
+                0x4932D32E, 0x943D325C, 0xF7EC0C7D, 0x2AE3ED0F,
+                0xC2B7361D, 0x1FB8D76F, 0x7C69E94E, 0xA166083C,
+                0xBBCB950C, 0x66C4747E, 0x05154A5F, 0xD81AAB2D,
+                0x9E56BE88, 0x43595FFA, 0x208861DB, 0xFD8780A9,
+                0xE72A1D99, 0x3A25FCEB, 0x59F4C2CA, 0x84FB23B8,
+                0x6CAFF8AA, 0xB1A019D8, 0xD27127F9, 0x0F7EC68B,
+                0x15D35BBB, 0xC8DCBAC9, 0xAB0D84E8, 0x7602659A,
+                0x7F652F7B, 0xA26ACE09, 0xC1BBF028, 0x1CB4115A,
+                0x06198C6A, 0xDB166D18, 0xB8C75339, 0x65C8B24B,
+                0x8D9C6959, 0x5093882B, 0x3342B60A, 0xEE4D5778,
+                0xF4E0CA48, 0x29EF2B3A, 0x4A3E151B, 0x9731F469,
+                0x58F080D9, 0x85FF61AB, 0xE62E5F8A, 0x3B21BEF8,
+                0x218C23C8, 0xFC83C2BA, 0x9F52FC9B, 0x425D1DE9,
+                0xAA09C6FB, 0x77062789, 0x14D719A8, 0xC9D8F8DA,
+                0xD37565EA, 0x0E7A8498, 0x6DABBAB9, 0xB0A45BCB,
+                0xB9C3112A, 0x64CCF058, 0x071DCE79, 0xDA122F0B,
+                0xC0BFB23B, 0x1DB05349, 0x7E616D68, 0xA36E8C1A,
+                0x4B3A5708, 0x9635B67A, 0xF5E4885B, 0x28EB6929,
+                0x3246F419, 0xEF49156B, 0x8C982B4A, 0x5197CA38,
+        },
+        [14] = {
+                0x00000000, 0x2FB7BF3A, 0x5F6F7E74, 0x70D8C14E,
+                0xBEDEFCE8, 0x916943D2, 0xE1B1829C, 0xCE063DA6,
+                0x797CE467, 0x56CB5B5D, 0x26139A13, 0x09A42529,
+                0xC7A2188F, 0xE815A7B5, 0x98CD66FB, 0xB77AD9C1,
+                0xF2F9C8CE, 0xDD4E77F4, 0xAD96B6BA, 0x82210980,
+                0x4C273426, 0x63908B1C, 0x13484A52, 0x3CFFF568,
+                0x8B852CA9, 0xA4329393, 0xD4EA52DD, 0xFB5DEDE7,
+                0x355BD041, 0x1AEC6F7B, 0x6A34AE35, 0x4583110F,
+                0xE1328C2B, 0xCE853311, 0xBE5DF25F, 0x91EA4D65,
+                0x5FEC70C3, 0x705BCFF9, 0x00830EB7, 0x2F34B18D,
+                0x984E684C, 0xB7F9D776, 0xC7211638, 0xE896A902,
+                0x269094A4, 0x09272B9E, 0x79FFEAD0, 0x564855EA,
+                0x13CB44E5, 0x3C7CFBDF, 0x4CA43A91, 0x631385AB,
+                0xAD15B80D, 0x82A20737, 0xF27AC679, 0xDDCD7943,
+                0x6AB7A082, 0x45001FB8, 0x35D8DEF6, 0x1A6F61CC,
+                0xD4695C6A, 0xFBDEE350, 0x8B06221E, 0xA4B19D24,
+                0xC6A405E1, 0xE913BADB, 0x99CB7B95, 0xB67CC4AF,
+                0x787AF909, 0x57CD4633, 0x2715877D, 0x08A23847,
+                0xBFD8E186, 0x906F5EBC, 0xE0B79FF2, 0xCF0020C8,
+                0x01061D6E, 0x2EB1A254, 0x5E69631A, 0x71DEDC20,
+                0x345DCD2F, 0x1BEA7215, 0x6B32B35B, 0x44850C61,
+                0x8A8331C7, 0xA5348EFD, 0xD5EC4FB3, 0xFA5BF089,
+                0x4D212948, 0x62969672, 0x124E573C, 0x3DF9E806,
+                0xF3FFD5A0, 0xDC486A9A, 0xAC90ABD4, 0x832714EE,
+                0x279689CA, 0x082136F0, 0x78F9F7BE, 0x574E4884,
+                0x99487522, 0xB6FFCA18, 0xC6270B56, 0xE990B46C,
+                0x5EEA6DAD, 0x715DD297, 0x018513D9, 0x2E32ACE3,
+                0xE0349145, 0xCF832E7F, 0xBF5BEF31, 0x90EC500B,
+                0xD56F4104, 0xFAD8FE3E, 0x8A003F70, 0xA5B7804A,
+                0x6BB1BDEC, 0x440602D6, 0x34DEC398, 0x1B697CA2,
+                0xAC13A563, 0x83A41A59, 0xF37CDB17, 0xDCCB642D,
+                0x12CD598B, 0x3D7AE6B1, 0x4DA227FF, 0x621598C5,
+                0x89891675, 0xA63EA94F, 0xD6E66801, 0xF951D73B,
+                0x3757EA9D, 0x18E055A7, 0x683894E9, 0x478F2BD3,
+                0xF0F5F212, 0xDF424D28, 0xAF9A8C66, 0x802D335C,
+                0x4E2B0EFA, 0x619CB1C0, 0x1144708E, 0x3EF3CFB4,
+                0x7B70DEBB, 0x54C76181, 0x241FA0CF, 0x0BA81FF5,
+                0xC5AE2253, 0xEA199D69, 0x9AC15C27, 0xB576E31D,
+                0x020C3ADC, 0x2DBB85E6, 0x5D6344A8, 0x72D4FB92,
+                0xBCD2C634, 0x9365790E, 0xE3BDB840, 0xCC0A077A,
+                0x68BB9A5E, 0x470C2564, 0x37D4E42A, 0x18635B10,
+                0xD66566B6, 0xF9D2D98C, 0x890A18C2, 0xA6BDA7F8,
+                0x11C77E39, 0x3E70C103, 0x4EA8004D, 0x611FBF77,
+                0xAF1982D1, 0x80AE3DEB, 0xF076FCA5, 0xDFC1439F,
+                0x9A425290, 0xB5F5EDAA, 0xC52D2CE4, 0xEA9A93DE,
+                0x249CAE78, 0x0B2B1142, 0x7BF3D00C, 0x54446F36,
+                0xE33EB6F7, 0xCC8909CD, 0xBC51C883, 0x93E677B9,
+                0x5DE04A1F, 0x7257F525, 0x028F346B, 0x2D388B51,
+                0x4F2D1394, 0x609AACAE, 0x10426DE0, 0x3FF5D2DA,
+                0xF1F3EF7C, 0xDE445046, 0xAE9C9108, 0x812B2E32,
+                0x3651F7F3, 0x19E648C9, 0x693E8987, 0x468936BD,
+                0x888F0B1B, 0xA738B421, 0xD7E0756F, 0xF857CA55,
+                0xBDD4DB5A, 0x92636460, 0xE2BBA52E, 0xCD0C1A14,
+                0x030A27B2, 0x2CBD9888, 0x5C6559C6, 0x73D2E6FC,
+                0xC4A83F3D, 0xEB1F8007, 0x9BC74149, 0xB470FE73,
+                0x7A76C3D5, 0x55C17CEF, 0x2519BDA1, 0x0AAE029B,
+                0xAE1F9FBF, 0x81A82085, 0xF170E1CB, 0xDEC75EF1,
+                0x10C16357, 0x3F76DC6D, 0x4FAE1D23, 0x6019A219,
+                0xD7637BD8, 0xF8D4C4E2, 0x880C05AC, 0xA7BBBA96,
+                0x69BD8730, 0x460A380A, 0x36D2F944, 0x1965467E,
+                0x5CE65771, 0x7351E84B, 0x03892905, 0x2C3E963F,
+                0xE238AB99, 0xCD8F14A3, 0xBD57D5ED, 0x92E06AD7,
+                0x259AB316, 0x0A2D0C2C, 0x7AF5CD62, 0x55427258,
+                0x9B444FFE, 0xB4F3F0C4, 0xC42B318A, 0xEB9C8EB0,
+        },
+#endif
+};
+#endif
+
 #if defined(XWLIBCFG_CRC32_0XEDB88320) && (1 == XWLIBCFG_CRC32_0XEDB88320)
 /**
  * @brief CRC32多项式0XEDB88320的查询表
@@ -542,6 +1553,3159 @@ __xwlib_rodata const xwu32_t xwlib_crc32tbl_0xedb88320[256] = {
 };
 #endif
 
+#if defined(XWLIBCFG_CRC32_0XEDB88320) && (1 == XWLIBCFG_CRC32_0XEDB88320) && (XWLIB_CRC32_SLICE > 1U)
+/**
+ * @brief CRC32多项式0xEDB88320的分片查询表
+ * @details
+ * 第k行是第k+1个分片的查询表，第0个分片直接使用直驱表。
+ */
+static __xwlib_rodata
+const xwu32_t xwlib_crc32sbtbl_0xedb88320[XWLIB_CRC32_SLICE - 1U][256] = {
+        [0] = {
+                0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3,
+                0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+                0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB,
+                0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+                0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192,
+                0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+                0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A,
+                0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+                0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761,
+                0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+                0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69,
+                0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+                0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530,
+                0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+                0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38,
+                0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+                0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6,
+                0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+                0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE,
+                0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+                0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97,
+                0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+                0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F,
+                0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+                0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864,
+                0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+                0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C,
+                0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+                0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35,
+                0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+                0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D,
+                0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+                0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88,
+                0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+                0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180,
+                0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+                0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9,
+                0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+                0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1,
+                0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+                0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A,
+                0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+                0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522,
+                0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+                0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B,
+                0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+                0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773,
+                0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+                0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D,
+                0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+                0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85,
+                0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+                0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC,
+                0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+                0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4,
+                0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+                0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F,
+                0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+                0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27,
+                0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+                0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E,
+                0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+                0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876,
+                0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72,
+        },
+        [1] = {
+                0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59,
+                0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+                0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1,
+                0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+                0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29,
+                0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+                0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91,
+                0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+                0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9,
+                0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+                0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901,
+                0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+                0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9,
+                0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+                0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71,
+                0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+                0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399,
+                0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+                0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221,
+                0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+                0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9,
+                0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+                0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151,
+                0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+                0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579,
+                0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+                0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1,
+                0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+                0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609,
+                0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+                0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1,
+                0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+                0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9,
+                0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+                0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461,
+                0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+                0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9,
+                0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+                0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711,
+                0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+                0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339,
+                0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+                0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281,
+                0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+                0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049,
+                0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+                0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1,
+                0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+                0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819,
+                0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+                0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1,
+                0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+                0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69,
+                0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+                0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1,
+                0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+                0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9,
+                0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+                0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41,
+                0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+                0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89,
+                0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+                0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31,
+                0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED,
+        },
+        [2] = {
+                0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE,
+                0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+                0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701,
+                0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+                0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871,
+                0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+                0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E,
+                0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+                0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0,
+                0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+                0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F,
+                0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+                0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F,
+                0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+                0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0,
+                0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+                0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3,
+                0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+                0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C,
+                0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+                0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C,
+                0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+                0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3,
+                0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+                0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED,
+                0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+                0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002,
+                0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+                0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72,
+                0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+                0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D,
+                0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+                0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5,
+                0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+                0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A,
+                0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+                0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A,
+                0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+                0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5,
+                0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+                0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB,
+                0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+                0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04,
+                0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+                0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174,
+                0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+                0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B,
+                0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+                0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8,
+                0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+                0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907,
+                0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+                0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677,
+                0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+                0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98,
+                0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+                0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6,
+                0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+                0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639,
+                0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+                0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949,
+                0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+                0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6,
+                0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1,
+        },
+        [3] = {
+                0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0,
+                0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+                0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111,
+                0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+                0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52,
+                0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+                0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693,
+                0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+                0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4,
+                0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+                0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15,
+                0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+                0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256,
+                0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+                0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997,
+                0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+                0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299,
+                0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+                0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958,
+                0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+                0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B,
+                0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+                0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA,
+                0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+                0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D,
+                0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+                0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C,
+                0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+                0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F,
+                0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+                0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE,
+                0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+                0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42,
+                0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+                0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183,
+                0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+                0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0,
+                0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+                0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601,
+                0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+                0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546,
+                0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+                0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87,
+                0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+                0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4,
+                0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+                0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905,
+                0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+                0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B,
+                0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+                0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA,
+                0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+                0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589,
+                0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+                0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48,
+                0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+                0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F,
+                0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+                0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE,
+                0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+                0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D,
+                0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+                0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C,
+                0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C,
+        },
+        [4] = {
+                0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE,
+                0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+                0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3,
+                0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+                0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035,
+                0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+                0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258,
+                0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+                0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798,
+                0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+                0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5,
+                0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+                0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503,
+                0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+                0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E,
+                0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+                0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2,
+                0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+                0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF,
+                0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+                0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59,
+                0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+                0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834,
+                0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+                0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4,
+                0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+                0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99,
+                0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+                0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F,
+                0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+                0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02,
+                0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+                0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676,
+                0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+                0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B,
+                0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+                0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED,
+                0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+                0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680,
+                0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+                0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340,
+                0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+                0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D,
+                0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+                0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB,
+                0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+                0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6,
+                0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+                0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A,
+                0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+                0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77,
+                0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+                0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81,
+                0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+                0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC,
+                0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+                0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C,
+                0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+                0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41,
+                0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+                0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7,
+                0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+                0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA,
+                0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC,
+        },
+        [5] = {
+                0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D,
+                0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+                0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA,
+                0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+                0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653,
+                0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+                0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834,
+                0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+                0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301,
+                0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+                0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66,
+                0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+                0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF,
+                0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+                0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8,
+                0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+                0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4,
+                0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+                0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183,
+                0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+                0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A,
+                0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+                0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D,
+                0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+                0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678,
+                0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+                0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F,
+                0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+                0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6,
+                0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+                0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1,
+                0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+                0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F,
+                0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+                0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08,
+                0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+                0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1,
+                0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+                0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6,
+                0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+                0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3,
+                0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+                0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794,
+                0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+                0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D,
+                0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+                0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A,
+                0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+                0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516,
+                0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+                0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71,
+                0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+                0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8,
+                0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+                0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF,
+                0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+                0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A,
+                0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+                0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED,
+                0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+                0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044,
+                0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+                0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23,
+                0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30,
+        },
+        [6] = {
+                0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3,
+                0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+                0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56,
+                0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+                0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8,
+                0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+                0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D,
+                0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+                0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5,
+                0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+                0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00,
+                0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+                0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E,
+                0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+                0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B,
+                0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+                0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E,
+                0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+                0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB,
+                0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+                0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425,
+                0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+                0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90,
+                0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+                0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758,
+                0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+                0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED,
+                0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+                0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673,
+                0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+                0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6,
+                0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+                0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239,
+                0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+                0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C,
+                0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+                0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312,
+                0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+                0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7,
+                0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+                0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F,
+                0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+                0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA,
+                0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+                0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144,
+                0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+                0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1,
+                0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+                0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4,
+                0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+                0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61,
+                0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+                0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF,
+                0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+                0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A,
+                0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+                0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282,
+                0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+                0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937,
+                0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+                0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9,
+                0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+                0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C,
+                0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6,
+        },
+#if (XWLIB_CRC32_SLICE > 8U)
+        [7] = {
+                0x00000000, 0x177B1443, 0x2EF62886, 0x398D3CC5,
+                0x5DEC510C, 0x4A97454F, 0x731A798A, 0x64616DC9,
+                0xBBD8A218, 0xACA3B65B, 0x952E8A9E, 0x82559EDD,
+                0xE634F314, 0xF14FE757, 0xC8C2DB92, 0xDFB9CFD1,
+                0xACC04271, 0xBBBB5632, 0x82366AF7, 0x954D7EB4,
+                0xF12C137D, 0xE657073E, 0xDFDA3BFB, 0xC8A12FB8,
+                0x1718E069, 0x0063F42A, 0x39EEC8EF, 0x2E95DCAC,
+                0x4AF4B165, 0x5D8FA526, 0x640299E3, 0x73798DA0,
+                0x82F182A3, 0x958A96E0, 0xAC07AA25, 0xBB7CBE66,
+                0xDF1DD3AF, 0xC866C7EC, 0xF1EBFB29, 0xE690EF6A,
+                0x392920BB, 0x2E5234F8, 0x17DF083D, 0x00A41C7E,
+                0x64C571B7, 0x73BE65F4, 0x4A335931, 0x5D484D72,
+                0x2E31C0D2, 0x394AD491, 0x00C7E854, 0x17BCFC17,
+                0x73DD91DE, 0x64A6859D, 0x5D2BB958, 0x4A50AD1B,
+                0x95E962CA, 0x82927689, 0xBB1F4A4C, 0xAC645E0F,
+                0xC80533C6, 0xDF7E2785, 0xE6F31B40, 0xF1880F03,
+                0xDE920307, 0xC9E91744, 0xF0642B81, 0xE71F3FC2,
+                0x837E520B, 0x94054648, 0xAD887A8D, 0xBAF36ECE,
+                0x654AA11F, 0x7231B55C, 0x4BBC8999, 0x5CC79DDA,
+                0x38A6F013, 0x2FDDE450, 0x1650D895, 0x012BCCD6,
+                0x72524176, 0x65295535, 0x5CA469F0, 0x4BDF7DB3,
+                0x2FBE107A, 0x38C50439, 0x014838FC, 0x16332CBF,
+                0xC98AE36E, 0xDEF1F72D, 0xE77CCBE8, 0xF007DFAB,
+                0x9466B262, 0x831DA621, 0xBA909AE4, 0xADEB8EA7,
+                0x5C6381A4, 0x4B1895E7, 0x7295A922, 0x65EEBD61,
+                0x018FD0A8, 0x16F4C4EB, 0x2F79F82E, 0x3802EC6D,
+                0xE7BB23BC, 0xF0C037FF, 0xC94D0B3A, 0xDE361F79,
+                0xBA5772B0, 0xAD2C66F3, 0x94A15A36, 0x83DA4E75,
+                0xF0A3C3D5, 0xE7D8D796, 0xDE55EB53, 0xC92EFF10,
+                0xAD4F92D9, 0xBA34869A, 0x83B9BA5F, 0x94C2AE1C,
+                0x4B7B61CD, 0x5C00758E, 0x658D494B, 0x72F65D08,
+                0x169730C1, 0x01EC2482, 0x38611847, 0x2F1A0C04,
+                0x6655004F, 0x712E140C, 0x48A328C9, 0x5FD83C8A,
+                0x3BB95143, 0x2CC24500, 0x154F79C5, 0x02346D86,
+                0xDD8DA257, 0xCAF6B614, 0xF37B8AD1, 0xE4009E92,
+                0x8061F35B, 0x971AE718, 0xAE97DBDD, 0xB9ECCF9E,
+                0xCA95423E, 0xDDEE567D, 0xE4636AB8, 0xF3187EFB,
+                0x97791332, 0x80020771, 0xB98F3BB4, 0xAEF42FF7,
+                0x714DE026, 0x6636F465, 0x5FBBC8A0, 0x48C0DCE3,
+                0x2CA1B12A, 0x3BDAA569, 0x025799AC, 0x152C8DEF,
+                0xE4A482EC, 0xF3DF96AF, 0xCA52AA6A, 0xDD29BE29,
+                0xB948D3E0, 0xAE33C7A3, 0x97BEFB66, 0x80C5EF25,
+                0x5F7C20F4, 0x480734B7, 0x718A0872, 0x66F11C31,
+                0x029071F8, 0x15EB65BB, 0x2C66597E, 0x3B1D4D3D,
+                0x4864C09D, 0x5F1FD4DE, 0x6692E81B, 0x71E9FC58,
+                0x15889191, 0x02F385D2, 0x3B7EB917, 0x2C05AD54,
+                0xF3BC6285, 0xE4C776C6, 0xDD4A4A03, 0xCA315E40,
+                0xAE503389, 0xB92B27CA, 0x80A61B0F, 0x97DD0F4C,
+                0xB8C70348, 0xAFBC170B, 0x96312BCE, 0x814A3F8D,
+                0xE52B5244, 0xF2504607, 0xCBDD7AC2, 0xDCA66E81,
+                0x031FA150, 0x1464B513, 0x2DE989D6, 0x3A929D95,
+                0x5EF3F05C, 0x4988E41F, 0x7005D8DA, 0x677ECC99,
+                0x14074139, 0x037C557A, 0x3AF169BF, 0x2D8A7DFC,
+                0x49EB1035, 0x5E900476, 0x671D38B3, 0x70662CF0,
+                0xAFDFE321, 0xB8A4F762, 0x8129CBA7, 0x9652DFE4,
+                0xF233B22D, 0xE548A66E, 0xDCC59AAB, 0xCBBE8EE8,
+                0x3A3681EB, 0x2D4D95A8, 0x14C0A96D, 0x03BBBD2E,
+                0x67DAD0E7, 0x70A1C4A4, 0x492CF861, 0x5E57EC22,
+                0x81EE23F3, 0x969537B0, 0xAF180B75, 0xB8631F36,
+                0xDC0272FF, 0xCB7966BC, 0xF2F45A79, 0xE58F4E3A,
+                0x96F6C39A, 0x818DD7D9, 0xB800EB1C, 0xAF7BFF5F,
+                0xCB1A9296, 0xDC6186D5, 0xE5ECBA10, 0xF297AE53,
+                0x2D2E6182, 0x3A5575C1, 0x03D84904, 0x14A35D47,
+                0x70C2308E, 0x67B924CD, 0x5E341808, 0x494F0C4B,
+        },
+        [8] = {
+                0x00000000, 0xEFC26B3E, 0x04F5D03D, 0xEB37BB03,
+                0x09EBA07A, 0xE629CB44, 0x0D1E7047, 0xE2DC1B79,
+                0x13D740F4, 0xFC152BCA, 0x172290C9, 0xF8E0FBF7,
+                0x1A3CE08E, 0xF5FE8BB0, 0x1EC930B3, 0xF10B5B8D,
+                0x27AE81E8, 0xC86CEAD6, 0x235B51D5, 0xCC993AEB,
+                0x2E452192, 0xC1874AAC, 0x2AB0F1AF, 0xC5729A91,
+                0x3479C11C, 0xDBBBAA22, 0x308C1121, 0xDF4E7A1F,
+                0x3D926166, 0xD2500A58, 0x3967B15B, 0xD6A5DA65,
+                0x4F5D03D0, 0xA09F68EE, 0x4BA8D3ED, 0xA46AB8D3,
+                0x46B6A3AA, 0xA974C894, 0x42437397, 0xAD8118A9,
+                0x5C8A4324, 0xB348281A, 0x587F9319, 0xB7BDF827,
+                0x5561E35E, 0xBAA38860, 0x51943363, 0xBE56585D,
+                0x68F38238, 0x8731E906, 0x6C065205, 0x83C4393B,
+                0x61182242, 0x8EDA497C, 0x65EDF27F, 0x8A2F9941,
+                0x7B24C2CC, 0x94E6A9F2, 0x7FD112F1, 0x901379CF,
+                0x72CF62B6, 0x9D0D0988, 0x763AB28B, 0x99F8D9B5,
+                0x9EBA07A0, 0x71786C9E, 0x9A4FD79D, 0x758DBCA3,
+                0x9751A7DA, 0x7893CCE4, 0x93A477E7, 0x7C661CD9,
+                0x8D6D4754, 0x62AF2C6A, 0x89989769, 0x665AFC57,
+                0x8486E72E, 0x6B448C10, 0x80733713, 0x6FB15C2D,
+                0xB9148648, 0x56D6ED76, 0xBDE15675, 0x52233D4B,
+                0xB0FF2632, 0x5F3D4D0C, 0xB40AF60F, 0x5BC89D31,
+                0xAAC3C6BC, 0x4501AD82, 0xAE361681, 0x41F47DBF,
+                0xA32866C6, 0x4CEA0DF8, 0xA7DDB6FB, 0x481FDDC5,
+                0xD1E70470, 0x3E256F4E, 0xD512D44D, 0x3AD0BF73,
+                0xD80CA40A, 0x37CECF34, 0xDCF97437, 0x333B1F09,
+                0xC2304484, 0x2DF22FBA, 0xC6C594B9, 0x2907FF87,
+                0xCBDBE4FE, 0x24198FC0, 0xCF2E34C3, 0x20EC5FFD,
+                0xF6498598, 0x198BEEA6, 0xF2BC55A5, 0x1D7E3E9B,
+                0xFFA225E2, 0x10604EDC, 0xFB57F5DF, 0x14959EE1,
+                0xE59EC56C, 0x0A5CAE52, 0xE16B1551, 0x0EA97E6F,
+                0xEC756516, 0x03B70E28, 0xE880B52B, 0x0742DE15,
+                0xE6050901, 0x09C7623F, 0xE2F0D93C, 0x0D32B202,
+                0xEFEEA97B, 0x002CC245, 0xEB1B7946, 0x04D91278,
+                0xF5D249F5, 0x1A1022CB, 0xF12799C8, 0x1EE5F2F6,
+                0xFC39E98F, 0x13FB82B1, 0xF8CC39B2, 0x170E528C,
+                0xC1AB88E9, 0x2E69E3D7, 0xC55E58D4, 0x2A9C33EA,
+                0xC8402893, 0x278243AD, 0xCCB5F8AE, 0x23779390,
+                0xD27CC81D, 0x3DBEA323, 0xD6891820, 0x394B731E,
+                0xDB976867, 0x34550359, 0xDF62B85A, 0x30A0D364,
+                0xA9580AD1, 0x469A61EF, 0xADADDAEC, 0x426FB1D2,
+                0xA0B3AAAB, 0x4F71C195, 0xA4467A96, 0x4B8411A8,
+                0xBA8F4A25, 0x554D211B, 0xBE7A9A18, 0x51B8F126,
+                0xB364EA5F, 0x5CA68161, 0xB7913A62, 0x5853515C,
+                0x8EF68B39, 0x6134E007, 0x8A035B04, 0x65C1303A,
+                0x871D2B43, 0x68DF407D, 0x83E8FB7E, 0x6C2A9040,
+                0x9D21CBCD, 0x72E3A0F3, 0x99D41BF0, 0x761670CE,
+                0x94CA6BB7, 0x7B080089, 0x903FBB8A, 0x7FFDD0B4,
+                0x78BF0EA1, 0x977D659F, 0x7C4ADE9C, 0x9388B5A2,
+                0x7154AEDB, 0x9E96C5E5, 0x75A17EE6, 0x9A6315D8,
+                0x6B684E55, 0x84AA256B, 0x6F9D9E68, 0x805FF556,
+                0x6283EE2F, 0x8D418511, 0x66763E12, 0x89B4552C,
+                0x5F118F49, 0xB0D3E477, 0x5BE45F74, 0xB426344A,
+                0x56FA2F33, 0xB938440D, 0x520FFF0E, 0xBDCD9430,
+                0x4CC6CFBD, 0xA304A483, 0x48331F80, 0xA7F174BE,
+                0x452D6FC7, 0xAAEF04F9, 0x41D8BFFA, 0xAE1AD4C4,
+                0x37E20D71, 0xD820664F, 0x3317DD4C, 0xDCD5B672,
+                0x3E09AD0B, 0xD1CBC635, 0x3AFC7D36, 0xD53E1608,
+                0x24354D85, 0xCBF726BB, 0x20C09DB8, 0xCF02F686,
+                0x2DDEEDFF, 0xC21C86C1, 0x292B3DC2, 0xC6E956FC,
+                0x104C8C99, 0xFF8EE7A7, 0x14B95CA4, 0xFB7B379A,
+                0x19A72CE3, 0xF66547DD, 0x1D52FCDE, 0xF29097E0,
+                0x039BCC6D, 0xEC59A753, 0x076E1C50, 0xE8AC776E,
+                0x0A706C17, 0xE5B20729, 0x0E85BC2A, 0xE147D714,
+        },
+        [9] = {
+                0x00000000, 0xC18EDFC0, 0x586CB9C1, 0x99E26601,
+                0xB0D97382, 0x7157AC42, 0xE8B5CA43, 0x293B1583,
+                0xBAC3E145, 0x7B4D3E85, 0xE2AF5884, 0x23218744,
+                0x0A1A92C7, 0xCB944D07, 0x52762B06, 0x93F8F4C6,
+                0xAEF6C4CB, 0x6F781B0B, 0xF69A7D0A, 0x3714A2CA,
+                0x1E2FB749, 0xDFA16889, 0x46430E88, 0x87CDD148,
+                0x1435258E, 0xD5BBFA4E, 0x4C599C4F, 0x8DD7438F,
+                0xA4EC560C, 0x656289CC, 0xFC80EFCD, 0x3D0E300D,
+                0x869C8FD7, 0x47125017, 0xDEF03616, 0x1F7EE9D6,
+                0x3645FC55, 0xF7CB2395, 0x6E294594, 0xAFA79A54,
+                0x3C5F6E92, 0xFDD1B152, 0x6433D753, 0xA5BD0893,
+                0x8C861D10, 0x4D08C2D0, 0xD4EAA4D1, 0x15647B11,
+                0x286A4B1C, 0xE9E494DC, 0x7006F2DD, 0xB1882D1D,
+                0x98B3389E, 0x593DE75E, 0xC0DF815F, 0x01515E9F,
+                0x92A9AA59, 0x53277599, 0xCAC51398, 0x0B4BCC58,
+                0x2270D9DB, 0xE3FE061B, 0x7A1C601A, 0xBB92BFDA,
+                0xD64819EF, 0x17C6C62F, 0x8E24A02E, 0x4FAA7FEE,
+                0x66916A6D, 0xA71FB5AD, 0x3EFDD3AC, 0xFF730C6C,
+                0x6C8BF8AA, 0xAD05276A, 0x34E7416B, 0xF5699EAB,
+                0xDC528B28, 0x1DDC54E8, 0x843E32E9, 0x45B0ED29,
+                0x78BEDD24, 0xB93002E4, 0x20D264E5, 0xE15CBB25,
+                0xC867AEA6, 0x09E97166, 0x900B1767, 0x5185C8A7,
+                0xC27D3C61, 0x03F3E3A1, 0x9A1185A0, 0x5B9F5A60,
+                0x72A44FE3, 0xB32A9023, 0x2AC8F622, 0xEB4629E2,
+                0x50D49638, 0x915A49F8, 0x08B82FF9, 0xC936F039,
+                0xE00DE5BA, 0x21833A7A, 0xB8615C7B, 0x79EF83BB,
+                0xEA17777D, 0x2B99A8BD, 0xB27BCEBC, 0x73F5117C,
+                0x5ACE04FF, 0x9B40DB3F, 0x02A2BD3E, 0xC32C62FE,
+                0xFE2252F3, 0x3FAC8D33, 0xA64EEB32, 0x67C034F2,
+                0x4EFB2171, 0x8F75FEB1, 0x169798B0, 0xD7194770,
+                0x44E1B3B6, 0x856F6C76, 0x1C8D0A77, 0xDD03D5B7,
+                0xF438C034, 0x35B61FF4, 0xAC5479F5, 0x6DDAA635,
+                0x77E1359F, 0xB66FEA5F, 0x2F8D8C5E, 0xEE03539E,
+                0xC738461D, 0x06B699DD, 0x9F54FFDC, 0x5EDA201C,
+                0xCD22D4DA, 0x0CAC0B1A, 0x954E6D1B, 0x54C0B2DB,
+                0x7DFBA758, 0xBC757898, 0x25971E99, 0xE419C159,
+                0xD917F154, 0x18992E94, 0x817B4895, 0x40F59755,
+                0x69CE82D6, 0xA8405D16, 0x31A23B17, 0xF02CE4D7,
+                0x63D41011, 0xA25ACFD1, 0x3BB8A9D0, 0xFA367610,
+                0xD30D6393, 0x1283BC53, 0x8B61DA52, 0x4AEF0592,
+                0xF17DBA48, 0x30F36588, 0xA9110389, 0x689FDC49,
+                0x41A4C9CA, 0x802A160A, 0x19C8700B, 0xD846AFCB,
+                0x4BBE5B0D, 0x8A3084CD, 0x13D2E2CC, 0xD25C3D0C,
+                0xFB67288F, 0x3AE9F74F, 0xA30B914E, 0x62854E8E,
+                0x5F8B7E83, 0x9E05A143, 0x07E7C742, 0xC6691882,
+                0xEF520D01, 0x2EDCD2C1, 0xB73EB4C0, 0x76B06B00,
+                0xE5489FC6, 0x24C64006, 0xBD242607, 0x7CAAF9C7,
+                0x5591EC44, 0x941F3384, 0x0DFD5585, 0xCC738A45,
+                0xA1A92C70, 0x6027F3B0, 0xF9C595B1, 0x384B4A71,
+                0x11705FF2, 0xD0FE8032, 0x491CE633, 0x889239F3,
+                0x1B6ACD35, 0xDAE412F5, 0x430674F4, 0x8288AB34,
+                0xABB3BEB7, 0x6A3D6177, 0xF3DF0776, 0x3251D8B6,
+                0x0F5FE8BB, 0xCED1377B, 0x5733517A, 0x96BD8EBA,
+                0xBF869B39, 0x7E0844F9, 0xE7EA22F8, 0x2664FD38,
+                0xB59C09FE, 0x7412D63E, 0xEDF0B03F, 0x2C7E6FFF,
+                0x05457A7C, 0xC4CBA5BC, 0x5D29C3BD, 0x9CA71C7D,
+                0x2735A3A7, 0xE6BB7C67, 0x7F591A66, 0xBED7C5A6,
+                0x97ECD025, 0x56620FE5, 0xCF8069E4, 0x0E0EB624,
+                0x9DF642E2, 0x5C789D22, 0xC59AFB23, 0x041424E3,
+                0x2D2F3160, 0xECA1EEA0, 0x754388A1, 0xB4CD5761,
+                0x89C3676C, 0x484DB8AC, 0xD1AFDEAD, 0x1021016D,
+                0x391A14EE, 0xF894CB2E, 0x6176AD2F, 0xA0F872EF,
+                0x33008629, 0xF28E59E9, 0x6B6C3FE8, 0xAAE2E028,
+                0x83D9F5AB, 0x42572A6B, 0xDBB54C6A, 0x1A3B93AA,
+        },
+        [10] = {
+                0x00000000, 0x9BA54C6F, 0xEC3B9E9F, 0x779ED2F0,
+                0x03063B7F, 0x98A37710, 0xEF3DA5E0, 0x7498E98F,
+                0x060C76FE, 0x9DA93A91, 0xEA37E861, 0x7192A40E,
+                0x050A4D81, 0x9EAF01EE, 0xE931D31E, 0x72949F71,
+                0x0C18EDFC, 0x97BDA193, 0xE0237363, 0x7B863F0C,
+                0x0F1ED683, 0x94BB9AEC, 0xE325481C, 0x78800473,
+                0x0A149B02, 0x91B1D76D, 0xE62F059D, 0x7D8A49F2,
+                0x0912A07D, 0x92B7EC12, 0xE5293EE2, 0x7E8C728D,
+                0x1831DBF8, 0x83949797, 0xF40A4567, 0x6FAF0908,
+                0x1B37E087, 0x8092ACE8, 0xF70C7E18, 0x6CA93277,
+                0x1E3DAD06, 0x8598E169, 0xF2063399, 0x69A37FF6,
+                0x1D3B9679, 0x869EDA16, 0xF10008E6, 0x6AA54489,
+                0x14293604, 0x8F8C7A6B, 0xF812A89B, 0x63B7E4F4,
+                0x172F0D7B, 0x8C8A4114, 0xFB1493E4, 0x60B1DF8B,
+                0x122540FA, 0x89800C95, 0xFE1EDE65, 0x65BB920A,
+                0x11237B85, 0x8A8637EA, 0xFD18E51A, 0x66BDA975,
+                0x3063B7F0, 0xABC6FB9F, 0xDC58296F, 0x47FD6500,
+                0x33658C8F, 0xA8C0C0E0, 0xDF5E1210, 0x44FB5E7F,
+                0x366FC10E, 0xADCA8D61, 0xDA545F91, 0x41F113FE,
+                0x3569FA71, 0xAECCB61E, 0xD95264EE, 0x42F72881,
+                0x3C7B5A0C, 0xA7DE1663, 0xD040C493, 0x4BE588FC,
+                0x3F7D6173, 0xA4D82D1C, 0xD346FFEC, 0x48E3B383,
+                0x3A772CF2, 0xA1D2609D, 0xD64CB26D, 0x4DE9FE02,
+                0x3971178D, 0xA2D45BE2, 0xD54A8912, 0x4EEFC57D,
+                0x28526C08, 0xB3F72067, 0xC469F297, 0x5FCCBEF8,
+                0x2B545777, 0xB0F11B18, 0xC76FC9E8, 0x5CCA8587,
+                0x2E5E1AF6, 0xB5FB5699, 0xC2658469, 0x59C0C806,
+                0x2D582189, 0xB6FD6DE6, 0xC163BF16, 0x5AC6F379,
+                0x244A81F4, 0xBFEFCD9B, 0xC8711F6B, 0x53D45304,
+                0x274CBA8B, 0xBCE9F6E4, 0xCB772414, 0x50D2687B,
+                0x2246F70A, 0xB9E3BB65, 0xCE7D6995, 0x55D825FA,
+                0x2140CC75, 0xBAE5801A, 0xCD7B52EA, 0x56DE1E85,
+                0x60C76FE0, 0xFB62238F, 0x8CFCF17F, 0x1759BD10,
+                0x63C1549F, 0xF86418F0, 0x8FFACA00, 0x145F866F,
+                0x66CB191E, 0xFD6E5571, 0x8AF08781, 0x1155CBEE,
+                0x65CD2261, 0xFE686E0E, 0x89F6BCFE, 0x1253F091,
+                0x6CDF821C, 0xF77ACE73, 0x80E41C83, 0x1B4150EC,
+                0x6FD9B963, 0xF47CF50C, 0x83E227FC, 0x18476B93,
+                0x6AD3F4E2, 0xF176B88D, 0x86E86A7D, 0x1D4D2612,
+                0x69D5CF9D, 0xF27083F2, 0x85EE5102, 0x1E4B1D6D,
+                0x78F6B418, 0xE353F877, 0x94CD2A87, 0x0F6866E8,
+                0x7BF08F67, 0xE055C308, 0x97CB11F8, 0x0C6E5D97,
+                0x7EFAC2E6, 0xE55F8E89, 0x92C15C79, 0x09641016,
+                0x7DFCF999, 0xE659B5F6, 0x91C76706, 0x0A622B69,
+                0x74EE59E4, 0xEF4B158B, 0x98D5C77B, 0x03708B14,
+                0x77E8629B, 0xEC4D2EF4, 0x9BD3FC04, 0x0076B06B,
+                0x72E22F1A, 0xE9476375, 0x9ED9B185, 0x057CFDEA,
+                0x71E41465, 0xEA41580A, 0x9DDF8AFA, 0x067AC695,
+                0x50A4D810, 0xCB01947F, 0xBC9F468F, 0x273A0AE0,
+                0x53A2E36F, 0xC807AF00, 0xBF997DF0, 0x243C319F,
+                0x56A8AEEE, 0xCD0DE281, 0xBA933071, 0x21367C1E,
+                0x55AE9591, 0xCE0BD9FE, 0xB9950B0E, 0x22304761,
+                0x5CBC35EC, 0xC7197983, 0xB087AB73, 0x2B22E71C,
+                0x5FBA0E93, 0xC41F42FC, 0xB381900C, 0x2824DC63,
+                0x5AB04312, 0xC1150F7D, 0xB68BDD8D, 0x2D2E91E2,
+                0x59B6786D, 0xC2133402, 0xB58DE6F2, 0x2E28AA9D,
+                0x489503E8, 0xD3304F87, 0xA4AE9D77, 0x3F0BD118,
+                0x4B933897, 0xD03674F8, 0xA7A8A608, 0x3C0DEA67,
+                0x4E997516, 0xD53C3979, 0xA2A2EB89, 0x3907A7E6,
+                0x4D9F4E69, 0xD63A0206, 0xA1A4D0F6, 0x3A019C99,
+                0x448DEE14, 0xDF28A27B, 0xA8B6708B, 0x33133CE4,
+                0x478BD56B, 0xDC2E9904, 0xABB04BF4, 0x3015079B,
+                0x428198EA, 0xD924D485, 0xAEBA0675, 0x351F4A1A,
+                0x4187A395, 0xDA22EFFA, 0xADBC3D0A, 0x36197165,
+        },
+        [11] = {
+                0x00000000, 0xDD96D985, 0x605CB54B, 0xBDCA6CCE,
+                0xC0B96A96, 0x1D2FB313, 0xA0E5DFDD, 0x7D730658,
+                0x5A03D36D, 0x87950AE8, 0x3A5F6626, 0xE7C9BFA3,
+                0x9ABAB9FB, 0x472C607E, 0xFAE60CB0, 0x2770D535,
+                0xB407A6DA, 0x69917F5F, 0xD45B1391, 0x09CDCA14,
+                0x74BECC4C, 0xA92815C9, 0x14E27907, 0xC974A082,
+                0xEE0475B7, 0x3392AC32, 0x8E58C0FC, 0x53CE1979,
+                0x2EBD1F21, 0xF32BC6A4, 0x4EE1AA6A, 0x937773EF,
+                0xB37E4BF5, 0x6EE89270, 0xD322FEBE, 0x0EB4273B,
+                0x73C72163, 0xAE51F8E6, 0x139B9428, 0xCE0D4DAD,
+                0xE97D9898, 0x34EB411D, 0x89212DD3, 0x54B7F456,
+                0x29C4F20E, 0xF4522B8B, 0x49984745, 0x940E9EC0,
+                0x0779ED2F, 0xDAEF34AA, 0x67255864, 0xBAB381E1,
+                0xC7C087B9, 0x1A565E3C, 0xA79C32F2, 0x7A0AEB77,
+                0x5D7A3E42, 0x80ECE7C7, 0x3D268B09, 0xE0B0528C,
+                0x9DC354D4, 0x40558D51, 0xFD9FE19F, 0x2009381A,
+                0xBD8D91AB, 0x601B482E, 0xDDD124E0, 0x0047FD65,
+                0x7D34FB3D, 0xA0A222B8, 0x1D684E76, 0xC0FE97F3,
+                0xE78E42C6, 0x3A189B43, 0x87D2F78D, 0x5A442E08,
+                0x27372850, 0xFAA1F1D5, 0x476B9D1B, 0x9AFD449E,
+                0x098A3771, 0xD41CEEF4, 0x69D6823A, 0xB4405BBF,
+                0xC9335DE7, 0x14A58462, 0xA96FE8AC, 0x74F93129,
+                0x5389E41C, 0x8E1F3D99, 0x33D55157, 0xEE4388D2,
+                0x93308E8A, 0x4EA6570F, 0xF36C3BC1, 0x2EFAE244,
+                0x0EF3DA5E, 0xD36503DB, 0x6EAF6F15, 0xB339B690,
+                0xCE4AB0C8, 0x13DC694D, 0xAE160583, 0x7380DC06,
+                0x54F00933, 0x8966D0B6, 0x34ACBC78, 0xE93A65FD,
+                0x944963A5, 0x49DFBA20, 0xF415D6EE, 0x29830F6B,
+                0xBAF47C84, 0x6762A501, 0xDAA8C9CF, 0x073E104A,
+                0x7A4D1612, 0xA7DBCF97, 0x1A11A359, 0xC7877ADC,
+                0xE0F7AFE9, 0x3D61766C, 0x80AB1AA2, 0x5D3DC327,
+                0x204EC57F, 0xFDD81CFA, 0x40127034, 0x9D84A9B1,
+                0xA06A2517, 0x7DFCFC92, 0xC036905C, 0x1DA049D9,
+                0x60D34F81, 0xBD459604, 0x008FFACA, 0xDD19234F,
+                0xFA69F67A, 0x27FF2FFF, 0x9A354331, 0x47A39AB4,
+                0x3AD09CEC, 0xE7464569, 0x5A8C29A7, 0x871AF022,
+                0x146D83CD, 0xC9FB5A48, 0x74313686, 0xA9A7EF03,
+                0xD4D4E95B, 0x094230DE, 0xB4885C10, 0x691E8595,
+                0x4E6E50A0, 0x93F88925, 0x2E32E5EB, 0xF3A43C6E,
+                0x8ED73A36, 0x5341E3B3, 0xEE8B8F7D, 0x331D56F8,
+                0x13146EE2, 0xCE82B767, 0x7348DBA9, 0xAEDE022C,
+                0xD3AD0474, 0x0E3BDDF1, 0xB3F1B13F, 0x6E6768BA,
+                0x4917BD8F, 0x9481640A, 0x294B08C4, 0xF4DDD141,
+                0x89AED719, 0x54380E9C, 0xE9F26252, 0x3464BBD7,
+                0xA713C838, 0x7A8511BD, 0xC74F7D73, 0x1AD9A4F6,
+                0x67AAA2AE, 0xBA3C7B2B, 0x07F617E5, 0xDA60CE60,
+                0xFD101B55, 0x2086C2D0, 0x9D4CAE1E, 0x40DA779B,
+                0x3DA971C3, 0xE03FA846, 0x5DF5C488, 0x80631D0D,
+                0x1DE7B4BC, 0xC0716D39, 0x7DBB01F7, 0xA02DD872,
+                0xDD5EDE2A, 0x00C807AF, 0xBD026B61, 0x6094B2E4,
+                0x47E467D1, 0x9A72BE54, 0x27B8D29A, 0xFA2E0B1F,
+                0x875D0D47, 0x5ACBD4C2, 0xE701B80C, 0x3A976189,
+                0xA9E01266, 0x7476CBE3, 0xC9BCA72D, 0x142A7EA8,
+                0x695978F0, 0xB4CFA175, 0x0905CDBB, 0xD493143E,
+                0xF3E3C10B, 0x2E75188E, 0x93BF7440, 0x4E29ADC5,
+                0x335AAB9D, 0xEECC7218, 0x53061ED6, 0x8E90C753,
+                0xAE99FF49, 0x730F26CC, 0xCEC54A02, 0x13539387,
+                0x6E2095DF, 0xB3B64C5A, 0x0E7C2094, 0xD3EAF911,
+                0xF49A2C24, 0x290CF5A1, 0x94C6996F, 0x495040EA,
+                0x342346B2, 0xE9B59F37, 0x547FF3F9, 0x89E92A7C,
+                0x1A9E5993, 0xC7088016, 0x7AC2ECD8, 0xA754355D,
+                0xDA273305, 0x07B1EA80, 0xBA7B864E, 0x67ED5FCB,
+                0x409D8AFE, 0x9D0B537B, 0x20C13FB5, 0xFD57E630,
+                0x8024E068, 0x5DB239ED, 0xE0785523, 0x3DEE8CA6,
+        },
+        [12] = {
+                0x00000000, 0x9D0FE176, 0xE16EC4AD, 0x7C6125DB,
+                0x19AC8F1B, 0x84A36E6D, 0xF8C24BB6, 0x65CDAAC0,
+                0x33591E36, 0xAE56FF40, 0xD237DA9B, 0x4F383BED,
+                0x2AF5912D, 0xB7FA705B, 0xCB9B5580, 0x5694B4F6,
+                0x66B23C6C, 0xFBBDDD1A, 0x87DCF8C1, 0x1AD319B7,
+                0x7F1EB377, 0xE2115201, 0x9E7077DA, 0x037F96AC,
+                0x55EB225A, 0xC8E4C32C, 0xB485E6F7, 0x298A0781,
+                0x4C47AD41, 0xD1484C37, 0xAD2969EC, 0x3026889A,
+                0xCD6478D8, 0x506B99AE, 0x2C0ABC75, 0xB1055D03,
+                0xD4C8F7C3, 0x49C716B5, 0x35A6336E, 0xA8A9D218,
+                0xFE3D66EE, 0x63328798, 0x1F53A243, 0x825C4335,
+                0xE791E9F5, 0x7A9E0883, 0x06FF2D58, 0x9BF0CC2E,
+                0xABD644B4, 0x36D9A5C2, 0x4AB88019, 0xD7B7616F,
+                0xB27ACBAF, 0x2F752AD9, 0x53140F02, 0xCE1BEE74,
+                0x988F5A82, 0x0580BBF4, 0x79E19E2F, 0xE4EE7F59,
+                0x8123D599, 0x1C2C34EF, 0x604D1134, 0xFD42F042,
+                0x41B9F7F1, 0xDCB61687, 0xA0D7335C, 0x3DD8D22A,
+                0x581578EA, 0xC51A999C, 0xB97BBC47, 0x24745D31,
+                0x72E0E9C7, 0xEFEF08B1, 0x938E2D6A, 0x0E81CC1C,
+                0x6B4C66DC, 0xF64387AA, 0x8A22A271, 0x172D4307,
+                0x270BCB9D, 0xBA042AEB, 0xC6650F30, 0x5B6AEE46,
+                0x3EA74486, 0xA3A8A5F0, 0xDFC9802B, 0x42C6615D,
+                0x1452D5AB, 0x895D34DD, 0xF53C1106, 0x6833F070,
+                0x0DFE5AB0, 0x90F1BBC6, 0xEC909E1D, 0x719F7F6B,
+                0x8CDD8F29, 0x11D26E5F, 0x6DB34B84, 0xF0BCAAF2,
+                0x95710032, 0x087EE144, 0x741FC49F, 0xE91025E9,
+                0xBF84911F, 0x228B7069, 0x5EEA55B2, 0xC3E5B4C4,
+                0xA6281E04, 0x3B27FF72, 0x4746DAA9, 0xDA493BDF,
+                0xEA6FB345, 0x77605233, 0x0B0177E8, 0x960E969E,
+                0xF3C33C5E, 0x6ECCDD28, 0x12ADF8F3, 0x8FA21985,
+                0xD936AD73, 0x44394C05, 0x385869DE, 0xA55788A8,
+                0xC09A2268, 0x5D95C31E, 0x21F4E6C5, 0xBCFB07B3,
+                0x8373EFE2, 0x1E7C0E94, 0x621D2B4F, 0xFF12CA39,
+                0x9ADF60F9, 0x07D0818F, 0x7BB1A454, 0xE6BE4522,
+                0xB02AF1D4, 0x2D2510A2, 0x51443579, 0xCC4BD40F,
+                0xA9867ECF, 0x34899FB9, 0x48E8BA62, 0xD5E75B14,
+                0xE5C1D38E, 0x78CE32F8, 0x04AF1723, 0x99A0F655,
+                0xFC6D5C95, 0x6162BDE3, 0x1D039838, 0x800C794E,
+                0xD698CDB8, 0x4B972CCE, 0x37F60915, 0xAAF9E863,
+                0xCF3442A3, 0x523BA3D5, 0x2E5A860E, 0xB3556778,
+                0x4E17973A, 0xD318764C, 0xAF795397, 0x3276B2E1,
+                0x57BB1821, 0xCAB4F957, 0xB6D5DC8C, 0x2BDA3DFA,
+                0x7D4E890C, 0xE041687A, 0x9C204DA1, 0x012FACD7,
+                0x64E20617, 0xF9EDE761, 0x858CC2BA, 0x188323CC,
+                0x28A5AB56, 0xB5AA4A20, 0xC9CB6FFB, 0x54C48E8D,
+                0x3109244D, 0xAC06C53B, 0xD067E0E0, 0x4D680196,
+                0x1BFCB560, 0x86F35416, 0xFA9271CD, 0x679D90BB,
+                0x02503A7B, 0x9F5FDB0D, 0xE33EFED6, 0x7E311FA0,
+                0xC2CA1813, 0x5FC5F965, 0x23A4DCBE, 0xBEAB3DC8,
+                0xDB669708, 0x4669767E, 0x3A0853A5, 0xA707B2D3,
+                0xF1930625, 0x6C9CE753, 0x10FDC288, 0x8DF223FE,
+                0xE83F893E, 0x75306848, 0x09514D93, 0x945EACE5,
+                0xA478247F, 0x3977C509, 0x4516E0D2, 0xD81901A4,
+                0xBDD4AB64, 0x20DB4A12, 0x5CBA6FC9, 0xC1B58EBF,
+                0x97213A49, 0x0A2EDB3F, 0x764FFEE4, 0xEB401F92,
+                0x8E8DB552, 0x13825424, 0x6FE371FF, 0xF2EC9089,
+                0x0FAE60CB, 0x92A181BD, 0xEEC0A466, 0x73CF4510,
+                0x1602EFD0, 0x8B0D0EA6, 0xF76C2B7D, 0x6A63CA0B,
+                0x3CF77EFD, 0xA1F89F8B, 0xDD99BA50, 0x40965B26,
+                0x255BF1E6, 0xB8541090, 0xC435354B, 0x593AD43D,
+                0x691C5CA7, 0xF413BDD1, 0x8872980A, 0x157D797C,
+                0x70B0D3BC, 0xEDBF32CA, 0x91DE1711, 0x0CD1F667,
+                0x5A454291, 0xC74AA3E7, 0xBB2B863C, 0x2624674A,
+                0x43E9CD8A, 0xDEE62CFC, 0xA2870927, 0x3F88E851,
+        },
+        [13] = {
+                0x00000000, 0xB9FBDBE8, 0xA886B191, 0x117D6A79,
+                0x8A7C6563, 0x3387BE8B, 0x22FAD4F2, 0x9B010F1A,
+                0xCF89CC87, 0x7672176F, 0x670F7D16, 0xDEF4A6FE,
+                0x45F5A9E4, 0xFC0E720C, 0xED731875, 0x5488C39D,
+                0x44629F4F, 0xFD9944A7, 0xECE42EDE, 0x551FF536,
+                0xCE1EFA2C, 0x77E521C4, 0x66984BBD, 0xDF639055,
+                0x8BEB53C8, 0x32108820, 0x236DE259, 0x9A9639B1,
+                0x019736AB, 0xB86CED43, 0xA911873A, 0x10EA5CD2,
+                0x88C53E9E, 0x313EE576, 0x20438F0F, 0x99B854E7,
+                0x02B95BFD, 0xBB428015, 0xAA3FEA6C, 0x13C43184,
+                0x474CF219, 0xFEB729F1, 0xEFCA4388, 0x56319860,
+                0xCD30977A, 0x74CB4C92, 0x65B626EB, 0xDC4DFD03,
+                0xCCA7A1D1, 0x755C7A39, 0x64211040, 0xDDDACBA8,
+                0x46DBC4B2, 0xFF201F5A, 0xEE5D7523, 0x57A6AECB,
+                0x032E6D56, 0xBAD5B6BE, 0xABA8DCC7, 0x1253072F,
+                0x89520835, 0x30A9D3DD, 0x21D4B9A4, 0x982F624C,
+                0xCAFB7B7D, 0x7300A095, 0x627DCAEC, 0xDB861104,
+                0x40871E1E, 0xF97CC5F6, 0xE801AF8F, 0x51FA7467,
+                0x0572B7FA, 0xBC896C12, 0xADF4066B, 0x140FDD83,
+                0x8F0ED299, 0x36F50971, 0x27886308, 0x9E73B8E0,
+                0x8E99E432, 0x37623FDA, 0x261F55A3, 0x9FE48E4B,
+                0x04E58151, 0xBD1E5AB9, 0xAC6330C0, 0x1598EB28,
+                0x411028B5, 0xF8EBF35D, 0xE9969924, 0x506D42CC,
+                0xCB6C4DD6, 0x7297963E, 0x63EAFC47, 0xDA1127AF,
+                0x423E45E3, 0xFBC59E0B, 0xEAB8F472, 0x53432F9A,
+                0xC8422080, 0x71B9FB68, 0x60C49111, 0xD93F4AF9,
+                0x8DB78964, 0x344C528C, 0x253138F5, 0x9CCAE31D,
+                0x07CBEC07, 0xBE3037EF, 0xAF4D5D96, 0x16B6867E,
+                0x065CDAAC, 0xBFA70144, 0xAEDA6B3D, 0x1721B0D5,
+                0x8C20BFCF, 0x35DB6427, 0x24A60E5E, 0x9D5DD5B6,
+                0xC9D5162B, 0x702ECDC3, 0x6153A7BA, 0xD8A87C52,
+                0x43A97348, 0xFA52A8A0, 0xEB2FC2D9, 0x52D41931,
+                0x4E87F0BB, 0xF77C2B53, 0xE601412A, 0x5FFA9AC2,
+                0xC4FB95D8, 0x7D004E30, 0x6C7D2449, 0xD586FFA1,
+                0x810E3C3C, 0x38F5E7D4, 0x29888DAD, 0x90735645,
+                0x0B72595F, 0xB28982B7, 0xA3F4E8CE, 0x1A0F3326,
+                0x0AE56FF4, 0xB31EB41C, 0xA263DE65, 0x1B98058D,
+                0x80990A97, 0x3962D17F, 0x281FBB06, 0x91E460EE,
+                0xC56CA373, 0x7C97789B, 0x6DEA12E2, 0xD411C90A,
+                0x4F10C610, 0xF6EB1DF8, 0xE7967781, 0x5E6DAC69,
+                0xC642CE25, 0x7FB915CD, 0x6EC47FB4, 0xD73FA45C,
+                0x4C3EAB46, 0xF5C570AE, 0xE4B81AD7, 0x5D43C13F,
+                0x09CB02A2, 0xB030D94A, 0xA14DB333, 0x18B668DB,
+                0x83B767C1, 0x3A4CBC29, 0x2B31D650, 0x92CA0DB8,
+                0x8220516A, 0x3BDB8A82, 0x2AA6E0FB, 0x935D3B13,
+                0x085C3409, 0xB1A7EFE1, 0xA0DA8598, 0x19215E70,
+                0x4DA99DED, 0xF4524605, 0xE52F2C7C, 0x5CD4F794,
+                0xC7D5F88E, 0x7E2E2366, 0x6F53491F, 0xD6A892F7,
+                0x847C8BC6, 0x3D87502E, 0x2CFA3A57, 0x9501E1BF,
+                0x0E00EEA5, 0xB7FB354D, 0xA6865F34, 0x1F7D84DC,
+                0x4BF54741, 0xF20E9CA9, 0xE373F6D0, 0x5A882D38,
+                0xC1892222, 0x7872F9CA, 0x690F93B3, 0xD0F4485B,
+                0xC01E1489, 0x79E5CF61, 0x6898A518, 0xD1637EF0,
+                0x4A6271EA, 0xF399AA02, 0xE2E4C07B, 0x5B1F1B93,
+                0x0F97D80E, 0xB66C03E6, 0xA711699F, 0x1EEAB277,
+                0x85EBBD6D, 0x3C106685, 0x2D6D0CFC, 0x9496D714,
+                0x0CB9B558, 0xB5426EB0, 0xA43F04C9, 0x1DC4DF21,
+                0x86C5D03B, 0x3F3E0BD3, 0x2E4361AA, 0x97B8BA42,
+                0xC33079DF, 0x7ACBA237, 0x6BB6C84E, 0xD24D13A6,
+                0x494C1CBC, 0xF0B7C754, 0xE1CAAD2D, 0x583176C5,
+                0x48DB2A17, 0xF120F1FF, 0xE05D9B86, 0x59A6406E,
+                0xC2A74F74, 0x7B5C949C, 0x6A21FEE5, 0xD3DA250D,
+                0x8752E690, 0x3EA93D78, 0x2FD45701, 0x962F8CE9,
+                0x0D2E83F3, 0xB4D5581B, 0xA5A83262, 0x1C53E98A,
+        },
+        [14] = {
+                0x00000000, 0xAE689191, 0x87A02563, 0x29C8B4F2,
+                0xD4314C87, 0x7A59DD16, 0x539169E4, 0xFDF9F875,
+                0x73139F4F, 0xDD7B0EDE, 0xF4B3BA2C, 0x5ADB2BBD,
+                0xA722D3C8, 0x094A4259, 0x2082F6AB, 0x8EEA673A,
+                0xE6273E9E, 0x484FAF0F, 0x61871BFD, 0xCFEF8A6C,
+                0x32167219, 0x9C7EE388, 0xB5B6577A, 0x1BDEC6EB,
+                0x9534A1D1, 0x3B5C3040, 0x129484B2, 0xBCFC1523,
+                0x4105ED56, 0xEF6D7CC7, 0xC6A5C835, 0x68CD59A4,
+                0x173F7B7D, 0xB957EAEC, 0x909F5E1E, 0x3EF7CF8F,
+                0xC30E37FA, 0x6D66A66B, 0x44AE1299, 0xEAC68308,
+                0x642CE432, 0xCA4475A3, 0xE38CC151, 0x4DE450C0,
+                0xB01DA8B5, 0x1E753924, 0x37BD8DD6, 0x99D51C47,
+                0xF11845E3, 0x5F70D472, 0x76B86080, 0xD8D0F111,
+                0x25290964, 0x8B4198F5, 0xA2892C07, 0x0CE1BD96,
+                0x820BDAAC, 0x2C634B3D, 0x05ABFFCF, 0xABC36E5E,
+                0x563A962B, 0xF85207BA, 0xD19AB348, 0x7FF222D9,
+                0x2E7EF6FA, 0x8016676B, 0xA9DED399, 0x07B64208,
+                0xFA4FBA7D, 0x54272BEC, 0x7DEF9F1E, 0xD3870E8F,
+                0x5D6D69B5, 0xF305F824, 0xDACD4CD6, 0x74A5DD47,
+                0x895C2532, 0x2734B4A3, 0x0EFC0051, 0xA09491C0,
+                0xC859C864, 0x663159F5, 0x4FF9ED07, 0xE1917C96,
+                0x1C6884E3, 0xB2001572, 0x9BC8A180, 0x35A03011,
+                0xBB4A572B, 0x1522C6BA, 0x3CEA7248, 0x9282E3D9,
+                0x6F7B1BAC, 0xC1138A3D, 0xE8DB3ECF, 0x46B3AF5E,
+                0x39418D87, 0x97291C16, 0xBEE1A8E4, 0x10893975,
+                0xED70C100, 0x43185091, 0x6AD0E463, 0xC4B875F2,
+                0x4A5212C8, 0xE43A8359, 0xCDF237AB, 0x639AA63A,
+                0x9E635E4F, 0x300BCFDE, 0x19C37B2C, 0xB7ABEABD,
+                0xDF66B319, 0x710E2288, 0x58C6967A, 0xF6AE07EB,
+                0x0B57FF9E, 0xA53F6E0F, 0x8CF7DAFD, 0x229F4B6C,
+                0xAC752C56, 0x021DBDC7, 0x2BD50935, 0x85BD98A4,
+                0x784460D1, 0xD62CF140, 0xFFE445B2, 0x518CD423,
+                0x5CFDEDF4, 0xF2957C65, 0xDB5DC897, 0x75355906,
+                0x88CCA173, 0x26A430E2, 0x0F6C8410, 0xA1041581,
+                0x2FEE72BB, 0x8186E32A, 0xA84E57D8, 0x0626C649,
+                0xFBDF3E3C, 0x55B7AFAD, 0x7C7F1B5F, 0xD2178ACE,
+                0xBADAD36A, 0x14B242FB, 0x3D7AF609, 0x93126798,
+                0x6EEB9FED, 0xC0830E7C, 0xE94BBA8E, 0x47232B1F,
+                0xC9C94C25, 0x67A1DDB4, 0x4E696946, 0xE001F8D7,
+                0x1DF800A2, 0xB3909133, 0x9A5825C1, 0x3430B450,
+                0x4BC29689, 0xE5AA0718, 0xCC62B3EA, 0x620A227B,
+                0x9FF3DA0E, 0x319B4B9F, 0x1853FF6D, 0xB63B6EFC,
+                0x38D109C6, 0x96B99857, 0xBF712CA5, 0x1119BD34,
+                0xECE04541, 0x4288D4D0, 0x6B406022, 0xC528F1B3,
+                0xADE5A817, 0x038D3986, 0x2A458D74, 0x842D1CE5,
+                0x79D4E490, 0xD7BC7501, 0xFE74C1F3, 0x501C5062,
+                0xDEF63758, 0x709EA6C9, 0x5956123B, 0xF73E83AA,
+                0x0AC77BDF, 0xA4AFEA4E, 0x8D675EBC, 0x230FCF2D,
+                0x72831B0E, 0xDCEB8A9F, 0xF5233E6D, 0x5B4BAFFC,
+                0xA6B25789, 0x08DAC618, 0x211272EA, 0x8F7AE37B,
+                0x01908441, 0xAFF815D0, 0x8630A122, 0x285830B3,
+                0xD5A1C8C6, 0x7BC95957, 0x5201EDA5, 0xFC697C34,
+                0x94A42590, 0x3ACCB401, 0x130400F3, 0xBD6C9162,
+                0x40956917, 0xEEFDF886, 0xC7354C74, 0x695DDDE5,
+                0xE7B7BADF, 0x49DF2B4E, 0x60179FBC, 0xCE7F0E2D,
+                0x3386F658, 0x9DEE67C9, 0xB426D33B, 0x1A4E42AA,
+                0x65BC6073, 0xCBD4F1E2, 0xE21C4510, 0x4C74D481,
+                0xB18D2CF4, 0x1FE5BD65, 0x362D0997, 0x98459806,
+                0x16AFFF3C, 0xB8C76EAD, 0x910FDA5F, 0x3F674BCE,
+                0xC29EB3BB, 0x6CF6222A, 0x453E96D8, 0xEB560749,
+                0x839B5EED, 0x2DF3CF7C, 0x043B7B8E, 0xAA53EA1F,
+                0x57AA126A, 0xF9C283FB, 0xD00A3709, 0x7E62A698,
+                0xF088C1A2, 0x5EE05033, 0x7728E4C1, 0xD9407550,
+                0x24B98D25, 0x8AD11CB4, 0xA319A846, 0x0D7139D7,
+        },
+#endif
+};
+#endif
+
+#if defined(XWLIBCFG_CRC32_0X1EDC6F41) && (1 == XWLIBCFG_CRC32_0X1EDC6F41)
+/**
+ * @brief CRC32多项式0x1EDC6F41的查询表
+ */
+__xwlib_rodata const xwu32_t xwlib_crc32tbl_0x1edc6f41[256] = {
+        0x00000000, 0x1EDC6F41, 0x3DB8DE82, 0x2364B1C3,
+        0x7B71BD04, 0x65ADD245, 0x46C96386, 0x58150CC7,
+        0xF6E37A08, 0xE83F1549, 0xCB5BA48A, 0xD587CBCB,
+        0x8D92C70C, 0x934EA84D, 0xB02A198E, 0xAEF676CF,
+        0xF31A9B51, 0xEDC6F410, 0xCEA245D3, 0xD07E2A92,
+        0x886B2655, 0x96B74914, 0xB5D3F8D7, 0xAB0F9796,
+        0x05F9E159, 0x1B258E18, 0x38413FDB, 0x269D509A,
+        0x7E885C5D, 0x6054331C, 0x433082DF, 0x5DECED9E,
+        0xF8E959E3, 0xE63536A2, 0xC5518761, 0xDB8DE820,
+        0x8398E4E7, 0x9D448BA6, 0xBE203A65, 0xA0FC5524,
+        0x0E0A23EB, 0x10D64CAA, 0x33B2FD69, 0x2D6E9228,
+        0x757B9EEF, 0x6BA7F1AE, 0x48C3406D, 0x561F2F2C,
+        0x0BF3C2B2, 0x152FADF3, 0x364B1C30, 0x28977371,
+        0x70827FB6, 0x6E5E10F7, 0x4D3AA134, 0x53E6CE75,
+        0xFD10B8BA, 0xE3CCD7FB, 0xC0A86638, 0xDE740979,
+        0x866105BE, 0x98BD6AFF, 0xBBD9DB3C, 0xA505B47D,
+        0xEF0EDC87, 0xF1D2B3C6, 0xD2B60205, 0xCC6A6D44,
+        0x947F6183, 0x8AA30EC2, 0xA9C7BF01, 0xB71BD040,
+        0x19EDA68F, 0x0731C9CE, 0x2455780D, 0x3A89174C,
+        0x629C1B8B, 0x7C4074CA, 0x5F24C509, 0x41F8AA48,
+        0x1C1447D6, 0x02C82897, 0x21AC9954, 0x3F70F615,
+        0x6765FAD2, 0x79B99593, 0x5ADD2450, 0x44014B11,
+        0xEAF73DDE, 0xF42B529F, 0xD74FE35C, 0xC9938C1D,
+        0x918680DA, 0x8F5AEF9B, 0xAC3E5E58, 0xB2E23119,
+        0x17E78564, 0x093BEA25, 0x2A5F5BE6, 0x348334A7,
+        0x6C963860, 0x724A5721, 0x512EE6E2, 0x4FF289A3,
+        0xE104FF6C, 0xFFD8902D, 0xDCBC21EE, 0xC2604EAF,
+        0x9A754268, 0x84A92D29, 0xA7CD9CEA, 0xB911F3AB,
+        0xE4FD1E35, 0xFA217174, 0xD945C0B7, 0xC799AFF6,
+        0x9F8CA331, 0x8150CC70, 0xA2347DB3, 0xBCE812F2,
+        0x121E643D, 0x0CC20B7C, 0x2FA6BABF, 0x317AD5FE,
+        0x696FD939, 0x77B3B678, 0x54D707BB, 0x4A0B68FA,
+        0xC0C1D64F, 0xDE1DB90E, 0xFD7908CD, 0xE3A5678C,
+        0xBBB06B4B, 0xA56C040A, 0x8608B5C9, 0x98D4DA88,
+        0x3622AC47, 0x28FEC306, 0x0B9A72C5, 0x15461D84,
+        0x4D531143, 0x538F7E02, 0x70EBCFC1, 0x6E37A080,
+        0x33DB4D1E, 0x2D07225F, 0x0E63939C, 0x10BFFCDD,
+        0x48AAF01A, 0x56769F5B, 0x75122E98, 0x6BCE41D9,
+        0xC5383716, 0xDBE45857, 0xF880E994, 0xE65C86D5,
+        0xBE498A12, 0xA095E553, 0x83F15490, 0x9D2D3BD1,
+        0x38288FAC, 0x26F4E0ED, 0x0590512E, 0x1B4C3E6F,
+        0x435932A8, 0x5D855DE9, 0x7EE1EC2A, 0x603D836B,
+        0xCECBF5A4, 0xD0179AE5, 0xF3732B26, 0xEDAF4467,
+        0xB5BA48A0, 0xAB6627E1, 0x88029622, 0x96DEF963,
+        0xCB3214FD, 0xD5EE7BBC, 0xF68ACA7F, 0xE856A53E,
+        0xB043A9F9, 0xAE9FC6B8, 0x8DFB777B, 0x9327183A,
+        0x3DD16EF5, 0x230D01B4, 0x0069B077, 0x1EB5DF36,
+        0x46A0D3F1, 0x587CBCB0, 0x7B180D73, 0x65C46232,
+        0x2FCF0AC8, 0x31136589, 0x1277D44A, 0x0CABBB0B,
+        0x54BEB7CC, 0x4A62D88D, 0x6906694E, 0x77DA060F,
+        0xD92C70C0, 0xC7F01F81, 0xE494AE42, 0xFA48C103,
+        0xA25DCDC4, 0xBC81A285, 0x9FE51346, 0x81397C07,
+        0xDCD59199, 0xC209FED8, 0xE16D4F1B, 0xFFB1205A,
+        0xA7A42C9D, 0xB97843DC, 0x9A1CF21F, 0x84C09D5E,
+        0x2A36EB91, 0x34EA84D0, 0x178E3513, 0x09525A52,
+        0x51475695, 0x4F9B39D4, 0x6CFF8817, 0x7223E756,
+        0xD726532B, 0xC9FA3C6A, 0xEA9E8DA9, 0xF442E2E8,
+        0xAC57EE2F, 0xB28B816E, 0x91EF30AD, 0x8F335FEC,
+        0x21C52923, 0x3F194662, 0x1C7DF7A1, 0x02A198E0,
+        0x5AB49427, 0x4468FB66, 0x670C4AA5, 0x79D025E4,
+        0x243CC87A, 0x3AE0A73B, 0x198416F8, 0x075879B9,
+        0x5F4D757E, 0x41911A3F, 0x62F5ABFC, 0x7C29C4BD,
+        0xD2DFB272, 0xCC03DD33, 0xEF676CF0, 0xF1BB03B1,
+        0xA9AE0F76, 0xB7726037, 0x9416D1F4, 0x8ACABEB5,
+};
+#endif
+
+#if defined(XWLIBCFG_CRC32_0X1EDC6F41) && (1 == XWLIBCFG_CRC32_0X1EDC6F41) && (XWLIB_CRC32_SLICE > 1U)
+/**
+ * @brief CRC32多项式0x1EDC6F41的分片查询表
+ * @details
+ * 第k行是第k+1个分片的查询表，第0个分片直接使用直驱表。
+ */
+static __xwlib_rodata
+const xwu32_t xwlib_crc32sbtbl_0x1edc6f41[XWLIB_CRC32_SLICE - 1U][256] = {
+        [0] = {
+                0x00000000, 0x9F5FC3DF, 0x2063E8FF, 0xBF3C2B20,
+                0x40C7D1FE, 0xDF981221, 0x60A43901, 0xFFFBFADE,
+                0x818FA3FC, 0x1ED06023, 0xA1EC4B03, 0x3EB388DC,
+                0xC1487202, 0x5E17B1DD, 0xE12B9AFD, 0x7E745922,
+                0x1DC328B9, 0x829CEB66, 0x3DA0C046, 0xA2FF0399,
+                0x5D04F947, 0xC25B3A98, 0x7D6711B8, 0xE238D267,
+                0x9C4C8B45, 0x0313489A, 0xBC2F63BA, 0x2370A065,
+                0xDC8B5ABB, 0x43D49964, 0xFCE8B244, 0x63B7719B,
+                0x3B865172, 0xA4D992AD, 0x1BE5B98D, 0x84BA7A52,
+                0x7B41808C, 0xE41E4353, 0x5B226873, 0xC47DABAC,
+                0xBA09F28E, 0x25563151, 0x9A6A1A71, 0x0535D9AE,
+                0xFACE2370, 0x6591E0AF, 0xDAADCB8F, 0x45F20850,
+                0x264579CB, 0xB91ABA14, 0x06269134, 0x997952EB,
+                0x6682A835, 0xF9DD6BEA, 0x46E140CA, 0xD9BE8315,
+                0xA7CADA37, 0x389519E8, 0x87A932C8, 0x18F6F117,
+                0xE70D0BC9, 0x7852C816, 0xC76EE336, 0x583120E9,
+                0x770CA2E4, 0xE853613B, 0x576F4A1B, 0xC83089C4,
+                0x37CB731A, 0xA894B0C5, 0x17A89BE5, 0x88F7583A,
+                0xF6830118, 0x69DCC2C7, 0xD6E0E9E7, 0x49BF2A38,
+                0xB644D0E6, 0x291B1339, 0x96273819, 0x0978FBC6,
+                0x6ACF8A5D, 0xF5904982, 0x4AAC62A2, 0xD5F3A17D,
+                0x2A085BA3, 0xB557987C, 0x0A6BB35C, 0x95347083,
+                0xEB4029A1, 0x741FEA7E, 0xCB23C15E, 0x547C0281,
+                0xAB87F85F, 0x34D83B80, 0x8BE410A0, 0x14BBD37F,
+                0x4C8AF396, 0xD3D53049, 0x6CE91B69, 0xF3B6D8B6,
+                0x0C4D2268, 0x9312E1B7, 0x2C2ECA97, 0xB3710948,
+                0xCD05506A, 0x525A93B5, 0xED66B895, 0x72397B4A,
+                0x8DC28194, 0x129D424B, 0xADA1696B, 0x32FEAAB4,
+                0x5149DB2F, 0xCE1618F0, 0x712A33D0, 0xEE75F00F,
+                0x118E0AD1, 0x8ED1C90E, 0x31EDE22E, 0xAEB221F1,
+                0xD0C678D3, 0x4F99BB0C, 0xF0A5902C, 0x6FFA53F3,
+                0x9001A92D, 0x0F5E6AF2, 0xB06241D2, 0x2F3D820D,
+                0xEE1945C8, 0x71468617, 0xCE7AAD37, 0x51256EE8,
+                0xAEDE9436, 0x318157E9, 0x8EBD7CC9, 0x11E2BF16,
+                0x6F96E634, 0xF0C925EB, 0x4FF50ECB, 0xD0AACD14,
+                0x2F5137CA, 0xB00EF415, 0x0F32DF35, 0x906D1CEA,
+                0xF3DA6D71, 0x6C85AEAE, 0xD3B9858E, 0x4CE64651,
+                0xB31DBC8F, 0x2C427F50, 0x937E5470, 0x0C2197AF,
+                0x7255CE8D, 0xED0A0D52, 0x52362672, 0xCD69E5AD,
+                0x32921F73, 0xADCDDCAC, 0x12F1F78C, 0x8DAE3453,
+                0xD59F14BA, 0x4AC0D765, 0xF5FCFC45, 0x6AA33F9A,
+                0x9558C544, 0x0A07069B, 0xB53B2DBB, 0x2A64EE64,
+                0x5410B746, 0xCB4F7499, 0x74735FB9, 0xEB2C9C66,
+                0x14D766B8, 0x8B88A567, 0x34B48E47, 0xABEB4D98,
+                0xC85C3C03, 0x5703FFDC, 0xE83FD4FC, 0x77601723,
+                0x889BEDFD, 0x17C42E22, 0xA8F80502, 0x37A7C6DD,
+                0x49D39FFF, 0xD68C5C20, 0x69B07700, 0xF6EFB4DF,
+                0x09144E01, 0x964B8DDE, 0x2977A6FE, 0xB6286521,
+                0x9915E72C, 0x064A24F3, 0xB9760FD3, 0x2629CC0C,
+                0xD9D236D2, 0x468DF50D, 0xF9B1DE2D, 0x66EE1DF2,
+                0x189A44D0, 0x87C5870F, 0x38F9AC2F, 0xA7A66FF0,
+                0x585D952E, 0xC70256F1, 0x783E7DD1, 0xE761BE0E,
+                0x84D6CF95, 0x1B890C4A, 0xA4B5276A, 0x3BEAE4B5,
+                0xC4111E6B, 0x5B4EDDB4, 0xE472F694, 0x7B2D354B,
+                0x05596C69, 0x9A06AFB6, 0x253A8496, 0xBA654749,
+                0x459EBD97, 0xDAC17E48, 0x65FD5568, 0xFAA296B7,
+                0xA293B65E, 0x3DCC7581, 0x82F05EA1, 0x1DAF9D7E,
+                0xE25467A0, 0x7D0BA47F, 0xC2378F5F, 0x5D684C80,
+                0x231C15A2, 0xBC43D67D, 0x037FFD5D, 0x9C203E82,
+                0x63DBC45C, 0xFC840783, 0x43B82CA3, 0xDCE7EF7C,
+                0xBF509EE7, 0x200F5D38, 0x9F337618, 0x006CB5C7,
+                0xFF974F19, 0x60C88CC6, 0xDFF4A7E6, 0x40AB6439,
+                0x3EDF3D1B, 0xA180FEC4, 0x1EBCD5E4, 0x81E3163B,
+                0x7E18ECE5, 0xE1472F3A, 0x5E7B041A, 0xC124C7C5,
+        },
+        [1] = {
+                0x00000000, 0xC2EEE4D1, 0x9B01A6E3, 0x59EF4232,
+                0x28DF2287, 0xEA31C656, 0xB3DE8464, 0x713060B5,
+                0x51BE450E, 0x9350A1DF, 0xCABFE3ED, 0x0851073C,
+                0x79616789, 0xBB8F8358, 0xE260C16A, 0x208E25BB,
+                0xA37C8A1C, 0x61926ECD, 0x387D2CFF, 0xFA93C82E,
+                0x8BA3A89B, 0x494D4C4A, 0x10A20E78, 0xD24CEAA9,
+                0xF2C2CF12, 0x302C2BC3, 0x69C369F1, 0xAB2D8D20,
+                0xDA1DED95, 0x18F30944, 0x411C4B76, 0x83F2AFA7,
+                0x58257B79, 0x9ACB9FA8, 0xC324DD9A, 0x01CA394B,
+                0x70FA59FE, 0xB214BD2F, 0xEBFBFF1D, 0x29151BCC,
+                0x099B3E77, 0xCB75DAA6, 0x929A9894, 0x50747C45,
+                0x21441CF0, 0xE3AAF821, 0xBA45BA13, 0x78AB5EC2,
+                0xFB59F165, 0x39B715B4, 0x60585786, 0xA2B6B357,
+                0xD386D3E2, 0x11683733, 0x48877501, 0x8A6991D0,
+                0xAAE7B46B, 0x680950BA, 0x31E61288, 0xF308F659,
+                0x823896EC, 0x40D6723D, 0x1939300F, 0xDBD7D4DE,
+                0xB04AF6F2, 0x72A41223, 0x2B4B5011, 0xE9A5B4C0,
+                0x9895D475, 0x5A7B30A4, 0x03947296, 0xC17A9647,
+                0xE1F4B3FC, 0x231A572D, 0x7AF5151F, 0xB81BF1CE,
+                0xC92B917B, 0x0BC575AA, 0x522A3798, 0x90C4D349,
+                0x13367CEE, 0xD1D8983F, 0x8837DA0D, 0x4AD93EDC,
+                0x3BE95E69, 0xF907BAB8, 0xA0E8F88A, 0x62061C5B,
+                0x428839E0, 0x8066DD31, 0xD9899F03, 0x1B677BD2,
+                0x6A571B67, 0xA8B9FFB6, 0xF156BD84, 0x33B85955,
+                0xE86F8D8B, 0x2A81695A, 0x736E2B68, 0xB180CFB9,
+                0xC0B0AF0C, 0x025E4BDD, 0x5BB109EF, 0x995FED3E,
+                0xB9D1C885, 0x7B3F2C54, 0x22D06E66, 0xE03E8AB7,
+                0x910EEA02, 0x53E00ED3, 0x0A0F4CE1, 0xC8E1A830,
+                0x4B130797, 0x89FDE346, 0xD012A174, 0x12FC45A5,
+                0x63CC2510, 0xA122C1C1, 0xF8CD83F3, 0x3A236722,
+                0x1AAD4299, 0xD843A648, 0x81ACE47A, 0x434200AB,
+                0x3272601E, 0xF09C84CF, 0xA973C6FD, 0x6B9D222C,
+                0x7E4982A5, 0xBCA76674, 0xE5482446, 0x27A6C097,
+                0x5696A022, 0x947844F3, 0xCD9706C1, 0x0F79E210,
+                0x2FF7C7AB, 0xED19237A, 0xB4F66148, 0x76188599,
+                0x0728E52C, 0xC5C601FD, 0x9C2943CF, 0x5EC7A71E,
+                0xDD3508B9, 0x1FDBEC68, 0x4634AE5A, 0x84DA4A8B,
+                0xF5EA2A3E, 0x3704CEEF, 0x6EEB8CDD, 0xAC05680C,
+                0x8C8B4DB7, 0x4E65A966, 0x178AEB54, 0xD5640F85,
+                0xA4546F30, 0x66BA8BE1, 0x3F55C9D3, 0xFDBB2D02,
+                0x266CF9DC, 0xE4821D0D, 0xBD6D5F3F, 0x7F83BBEE,
+                0x0EB3DB5B, 0xCC5D3F8A, 0x95B27DB8, 0x575C9969,
+                0x77D2BCD2, 0xB53C5803, 0xECD31A31, 0x2E3DFEE0,
+                0x5F0D9E55, 0x9DE37A84, 0xC40C38B6, 0x06E2DC67,
+                0x851073C0, 0x47FE9711, 0x1E11D523, 0xDCFF31F2,
+                0xADCF5147, 0x6F21B596, 0x36CEF7A4, 0xF4201375,
+                0xD4AE36CE, 0x1640D21F, 0x4FAF902D, 0x8D4174FC,
+                0xFC711449, 0x3E9FF098, 0x6770B2AA, 0xA59E567B,
+                0xCE037457, 0x0CED9086, 0x5502D2B4, 0x97EC3665,
+                0xE6DC56D0, 0x2432B201, 0x7DDDF033, 0xBF3314E2,
+                0x9FBD3159, 0x5D53D588, 0x04BC97BA, 0xC652736B,
+                0xB76213DE, 0x758CF70F, 0x2C63B53D, 0xEE8D51EC,
+                0x6D7FFE4B, 0xAF911A9A, 0xF67E58A8, 0x3490BC79,
+                0x45A0DCCC, 0x874E381D, 0xDEA17A2F, 0x1C4F9EFE,
+                0x3CC1BB45, 0xFE2F5F94, 0xA7C01DA6, 0x652EF977,
+                0x141E99C2, 0xD6F07D13, 0x8F1F3F21, 0x4DF1DBF0,
+                0x96260F2E, 0x54C8EBFF, 0x0D27A9CD, 0xCFC94D1C,
+                0xBEF92DA9, 0x7C17C978, 0x25F88B4A, 0xE7166F9B,
+                0xC7984A20, 0x0576AEF1, 0x5C99ECC3, 0x9E770812,
+                0xEF4768A7, 0x2DA98C76, 0x7446CE44, 0xB6A82A95,
+                0x355A8532, 0xF7B461E3, 0xAE5B23D1, 0x6CB5C700,
+                0x1D85A7B5, 0xDF6B4364, 0x86840156, 0x446AE587,
+                0x64E4C03C, 0xA60A24ED, 0xFFE566DF, 0x3D0B820E,
+                0x4C3BE2BB, 0x8ED5066A, 0xD73A4458, 0x15D4A089,
+        },
+        [2] = {
+                0x00000000, 0xFC93054A, 0xE7FA65D5, 0x1B69609F,
+                0xD128A4EB, 0x2DBBA1A1, 0x36D2C13E, 0xCA41C474,
+                0xBC8D2697, 0x401E23DD, 0x5B774342, 0xA7E44608,
+                0x6DA5827C, 0x91368736, 0x8A5FE7A9, 0x76CCE2E3,
+                0x67C6226F, 0x9B552725, 0x803C47BA, 0x7CAF42F0,
+                0xB6EE8684, 0x4A7D83CE, 0x5114E351, 0xAD87E61B,
+                0xDB4B04F8, 0x27D801B2, 0x3CB1612D, 0xC0226467,
+                0x0A63A013, 0xF6F0A559, 0xED99C5C6, 0x110AC08C,
+                0xCF8C44DE, 0x331F4194, 0x2876210B, 0xD4E52441,
+                0x1EA4E035, 0xE237E57F, 0xF95E85E0, 0x05CD80AA,
+                0x73016249, 0x8F926703, 0x94FB079C, 0x686802D6,
+                0xA229C6A2, 0x5EBAC3E8, 0x45D3A377, 0xB940A63D,
+                0xA84A66B1, 0x54D963FB, 0x4FB00364, 0xB323062E,
+                0x7962C25A, 0x85F1C710, 0x9E98A78F, 0x620BA2C5,
+                0x14C74026, 0xE854456C, 0xF33D25F3, 0x0FAE20B9,
+                0xC5EFE4CD, 0x397CE187, 0x22158118, 0xDE868452,
+                0x81C4E6FD, 0x7D57E3B7, 0x663E8328, 0x9AAD8662,
+                0x50EC4216, 0xAC7F475C, 0xB71627C3, 0x4B852289,
+                0x3D49C06A, 0xC1DAC520, 0xDAB3A5BF, 0x2620A0F5,
+                0xEC616481, 0x10F261CB, 0x0B9B0154, 0xF708041E,
+                0xE602C492, 0x1A91C1D8, 0x01F8A147, 0xFD6BA40D,
+                0x372A6079, 0xCBB96533, 0xD0D005AC, 0x2C4300E6,
+                0x5A8FE205, 0xA61CE74F, 0xBD7587D0, 0x41E6829A,
+                0x8BA746EE, 0x773443A4, 0x6C5D233B, 0x90CE2671,
+                0x4E48A223, 0xB2DBA769, 0xA9B2C7F6, 0x5521C2BC,
+                0x9F6006C8, 0x63F30382, 0x789A631D, 0x84096657,
+                0xF2C584B4, 0x0E5681FE, 0x153FE161, 0xE9ACE42B,
+                0x23ED205F, 0xDF7E2515, 0xC417458A, 0x388440C0,
+                0x298E804C, 0xD51D8506, 0xCE74E599, 0x32E7E0D3,
+                0xF8A624A7, 0x043521ED, 0x1F5C4172, 0xE3CF4438,
+                0x9503A6DB, 0x6990A391, 0x72F9C30E, 0x8E6AC644,
+                0x442B0230, 0xB8B8077A, 0xA3D167E5, 0x5F4262AF,
+                0x1D55A2BB, 0xE1C6A7F1, 0xFAAFC76E, 0x063CC224,
+                0xCC7D0650, 0x30EE031A, 0x2B876385, 0xD71466CF,
+                0xA1D8842C, 0x5D4B8166, 0x4622E1F9, 0xBAB1E4B3,
+                0x70F020C7, 0x8C63258D, 0x970A4512, 0x6B994058,
+                0x7A9380D4, 0x8600859E, 0x9D69E501, 0x61FAE04B,
+                0xABBB243F, 0x57282175, 0x4C4141EA, 0xB0D244A0,
+                0xC61EA643, 0x3A8DA309, 0x21E4C396, 0xDD77C6DC,
+                0x173602A8, 0xEBA507E2, 0xF0CC677D, 0x0C5F6237,
+                0xD2D9E665, 0x2E4AE32F, 0x352383B0, 0xC9B086FA,
+                0x03F1428E, 0xFF6247C4, 0xE40B275B, 0x18982211,
+                0x6E54C0F2, 0x92C7C5B8, 0x89AEA527, 0x753DA06D,
+                0xBF7C6419, 0x43EF6153, 0x588601CC, 0xA4150486,
+                0xB51FC40A, 0x498CC140, 0x52E5A1DF, 0xAE76A495,
+                0x643760E1, 0x98A465AB, 0x83CD0534, 0x7F5E007E,
+                0x0992E29D, 0xF501E7D7, 0xEE688748, 0x12FB8202,
+                0xD8BA4676, 0x2429433C, 0x3F4023A3, 0xC3D326E9,
+                0x9C914446, 0x6002410C, 0x7B6B2193, 0x87F824D9,
+                0x4DB9E0AD, 0xB12AE5E7, 0xAA438578, 0x56D08032,
+                0x201C62D1, 0xDC8F679B, 0xC7E60704, 0x3B75024E,
+                0xF134C63A, 0x0DA7C370, 0x16CEA3EF, 0xEA5DA6A5,
+                0xFB576629, 0x07C46363, 0x1CAD03FC, 0xE03E06B6,
+                0x2A7FC2C2, 0xD6ECC788, 0xCD85A717, 0x3116A25D,
+                0x47DA40BE, 0xBB4945F4, 0xA020256B, 0x5CB32021,
+                0x96F2E455, 0x6A61E11F, 0x71088180, 0x8D9B84CA,
+                0x531D0098, 0xAF8E05D2, 0xB4E7654D, 0x48746007,
+                0x8235A473, 0x7EA6A139, 0x65CFC1A6, 0x995CC4EC,
+                0xEF90260F, 0x13032345, 0x086A43DA, 0xF4F94690,
+                0x3EB882E4, 0xC22B87AE, 0xD942E731, 0x25D1E27B,
+                0x34DB22F7, 0xC84827BD, 0xD3214722, 0x2FB24268,
+                0xE5F3861C, 0x19608356, 0x0209E3C9, 0xFE9AE683,
+                0x88560460, 0x74C5012A, 0x6FAC61B5, 0x933F64FF,
+                0x597EA08B, 0xA5EDA5C1, 0xBE84C55E, 0x4217C014,
+        },
+        [3] = {
+                0x00000000, 0x3AAB4576, 0x75568AEC, 0x4FFDCF9A,
+                0xEAAD15D8, 0xD00650AE, 0x9FFB9F34, 0xA550DA42,
+                0xCB8644F1, 0xF12D0187, 0xBED0CE1D, 0x847B8B6B,
+                0x212B5129, 0x1B80145F, 0x547DDBC5, 0x6ED69EB3,
+                0x89D0E6A3, 0xB37BA3D5, 0xFC866C4F, 0xC62D2939,
+                0x637DF37B, 0x59D6B60D, 0x162B7997, 0x2C803CE1,
+                0x4256A252, 0x78FDE724, 0x370028BE, 0x0DAB6DC8,
+                0xA8FBB78A, 0x9250F2FC, 0xDDAD3D66, 0xE7067810,
+                0x0D7DA207, 0x37D6E771, 0x782B28EB, 0x42806D9D,
+                0xE7D0B7DF, 0xDD7BF2A9, 0x92863D33, 0xA82D7845,
+                0xC6FBE6F6, 0xFC50A380, 0xB3AD6C1A, 0x8906296C,
+                0x2C56F32E, 0x16FDB658, 0x590079C2, 0x63AB3CB4,
+                0x84AD44A4, 0xBE0601D2, 0xF1FBCE48, 0xCB508B3E,
+                0x6E00517C, 0x54AB140A, 0x1B56DB90, 0x21FD9EE6,
+                0x4F2B0055, 0x75804523, 0x3A7D8AB9, 0x00D6CFCF,
+                0xA586158D, 0x9F2D50FB, 0xD0D09F61, 0xEA7BDA17,
+                0x1AFB440E, 0x20500178, 0x6FADCEE2, 0x55068B94,
+                0xF05651D6, 0xCAFD14A0, 0x8500DB3A, 0xBFAB9E4C,
+                0xD17D00FF, 0xEBD64589, 0xA42B8A13, 0x9E80CF65,
+                0x3BD01527, 0x017B5051, 0x4E869FCB, 0x742DDABD,
+                0x932BA2AD, 0xA980E7DB, 0xE67D2841, 0xDCD66D37,
+                0x7986B775, 0x432DF203, 0x0CD03D99, 0x367B78EF,
+                0x58ADE65C, 0x6206A32A, 0x2DFB6CB0, 0x175029C6,
+                0xB200F384, 0x88ABB6F2, 0xC7567968, 0xFDFD3C1E,
+                0x1786E609, 0x2D2DA37F, 0x62D06CE5, 0x587B2993,
+                0xFD2BF3D1, 0xC780B6A7, 0x887D793D, 0xB2D63C4B,
+                0xDC00A2F8, 0xE6ABE78E, 0xA9562814, 0x93FD6D62,
+                0x36ADB720, 0x0C06F256, 0x43FB3DCC, 0x795078BA,
+                0x9E5600AA, 0xA4FD45DC, 0xEB008A46, 0xD1ABCF30,
+                0x74FB1572, 0x4E505004, 0x01AD9F9E, 0x3B06DAE8,
+                0x55D0445B, 0x6F7B012D, 0x2086CEB7, 0x1A2D8BC1,
+                0xBF7D5183, 0x85D614F5, 0xCA2BDB6F, 0xF0809E19,
+                0x35F6881C, 0x0F5DCD6A, 0x40A002F0, 0x7A0B4786,
+                0xDF5B9DC4, 0xE5F0D8B2, 0xAA0D1728, 0x90A6525E,
+                0xFE70CCED, 0xC4DB899B, 0x8B264601, 0xB18D0377,
+                0x14DDD935, 0x2E769C43, 0x618B53D9, 0x5B2016AF,
+                0xBC266EBF, 0x868D2BC9, 0xC970E453, 0xF3DBA125,
+                0x568B7B67, 0x6C203E11, 0x23DDF18B, 0x1976B4FD,
+                0x77A02A4E, 0x4D0B6F38, 0x02F6A0A2, 0x385DE5D4,
+                0x9D0D3F96, 0xA7A67AE0, 0xE85BB57A, 0xD2F0F00C,
+                0x388B2A1B, 0x02206F6D, 0x4DDDA0F7, 0x7776E581,
+                0xD2263FC3, 0xE88D7AB5, 0xA770B52F, 0x9DDBF059,
+                0xF30D6EEA, 0xC9A62B9C, 0x865BE406, 0xBCF0A170,
+                0x19A07B32, 0x230B3E44, 0x6CF6F1DE, 0x565DB4A8,
+                0xB15BCCB8, 0x8BF089CE, 0xC40D4654, 0xFEA60322,
+                0x5BF6D960, 0x615D9C16, 0x2EA0538C, 0x140B16FA,
+                0x7ADD8849, 0x4076CD3F, 0x0F8B02A5, 0x352047D3,
+                0x90709D91, 0xAADBD8E7, 0xE526177D, 0xDF8D520B,
+                0x2F0DCC12, 0x15A68964, 0x5A5B46FE, 0x60F00388,
+                0xC5A0D9CA, 0xFF0B9CBC, 0xB0F65326, 0x8A5D1650,
+                0xE48B88E3, 0xDE20CD95, 0x91DD020F, 0xAB764779,
+                0x0E269D3B, 0x348DD84D, 0x7B7017D7, 0x41DB52A1,
+                0xA6DD2AB1, 0x9C766FC7, 0xD38BA05D, 0xE920E52B,
+                0x4C703F69, 0x76DB7A1F, 0x3926B585, 0x038DF0F3,
+                0x6D5B6E40, 0x57F02B36, 0x180DE4AC, 0x22A6A1DA,
+                0x87F67B98, 0xBD5D3EEE, 0xF2A0F174, 0xC80BB402,
+                0x22706E15, 0x18DB2B63, 0x5726E4F9, 0x6D8DA18F,
+                0xC8DD7BCD, 0xF2763EBB, 0xBD8BF121, 0x8720B457,
+                0xE9F62AE4, 0xD35D6F92, 0x9CA0A008, 0xA60BE57E,
+                0x035B3F3C, 0x39F07A4A, 0x760DB5D0, 0x4CA6F0A6,
+                0xABA088B6, 0x910BCDC0, 0xDEF6025A, 0xE45D472C,
+                0x410D9D6E, 0x7BA6D818, 0x345B1782, 0x0EF052F4,
+                0x6026CC47, 0x5A8D8931, 0x157046AB, 0x2FDB03DD,
+                0x8A8BD99F, 0xB0209CE9, 0xFFDD5373, 0xC5761605,
+        },
+        [4] = {
+                0x00000000, 0x6BED1038, 0xD7DA2070, 0xBC373048,
+                0xB1682FA1, 0xDA853F99, 0x66B20FD1, 0x0D5F1FE9,
+                0x7C0C3003, 0x17E1203B, 0xABD61073, 0xC03B004B,
+                0xCD641FA2, 0xA6890F9A, 0x1ABE3FD2, 0x71532FEA,
+                0xF8186006, 0x93F5703E, 0x2FC24076, 0x442F504E,
+                0x49704FA7, 0x229D5F9F, 0x9EAA6FD7, 0xF5477FEF,
+                0x84145005, 0xEFF9403D, 0x53CE7075, 0x3823604D,
+                0x357C7FA4, 0x5E916F9C, 0xE2A65FD4, 0x894B4FEC,
+                0xEEECAF4D, 0x8501BF75, 0x39368F3D, 0x52DB9F05,
+                0x5F8480EC, 0x346990D4, 0x885EA09C, 0xE3B3B0A4,
+                0x92E09F4E, 0xF90D8F76, 0x453ABF3E, 0x2ED7AF06,
+                0x2388B0EF, 0x4865A0D7, 0xF452909F, 0x9FBF80A7,
+                0x16F4CF4B, 0x7D19DF73, 0xC12EEF3B, 0xAAC3FF03,
+                0xA79CE0EA, 0xCC71F0D2, 0x7046C09A, 0x1BABD0A2,
+                0x6AF8FF48, 0x0115EF70, 0xBD22DF38, 0xD6CFCF00,
+                0xDB90D0E9, 0xB07DC0D1, 0x0C4AF099, 0x67A7E0A1,
+                0xC30531DB, 0xA8E821E3, 0x14DF11AB, 0x7F320193,
+                0x726D1E7A, 0x19800E42, 0xA5B73E0A, 0xCE5A2E32,
+                0xBF0901D8, 0xD4E411E0, 0x68D321A8, 0x033E3190,
+                0x0E612E79, 0x658C3E41, 0xD9BB0E09, 0xB2561E31,
+                0x3B1D51DD, 0x50F041E5, 0xECC771AD, 0x872A6195,
+                0x8A757E7C, 0xE1986E44, 0x5DAF5E0C, 0x36424E34,
+                0x471161DE, 0x2CFC71E6, 0x90CB41AE, 0xFB265196,
+                0xF6794E7F, 0x9D945E47, 0x21A36E0F, 0x4A4E7E37,
+                0x2DE99E96, 0x46048EAE, 0xFA33BEE6, 0x91DEAEDE,
+                0x9C81B137, 0xF76CA10F, 0x4B5B9147, 0x20B6817F,
+                0x51E5AE95, 0x3A08BEAD, 0x863F8EE5, 0xEDD29EDD,
+                0xE08D8134, 0x8B60910C, 0x3757A144, 0x5CBAB17C,
+                0xD5F1FE90, 0xBE1CEEA8, 0x022BDEE0, 0x69C6CED8,
+                0x6499D131, 0x0F74C109, 0xB343F141, 0xD8AEE179,
+                0xA9FDCE93, 0xC210DEAB, 0x7E27EEE3, 0x15CAFEDB,
+                0x1895E132, 0x7378F10A, 0xCF4FC142, 0xA4A2D17A,
+                0x98D60CF7, 0xF33B1CCF, 0x4F0C2C87, 0x24E13CBF,
+                0x29BE2356, 0x4253336E, 0xFE640326, 0x9589131E,
+                0xE4DA3CF4, 0x8F372CCC, 0x33001C84, 0x58ED0CBC,
+                0x55B21355, 0x3E5F036D, 0x82683325, 0xE985231D,
+                0x60CE6CF1, 0x0B237CC9, 0xB7144C81, 0xDCF95CB9,
+                0xD1A64350, 0xBA4B5368, 0x067C6320, 0x6D917318,
+                0x1CC25CF2, 0x772F4CCA, 0xCB187C82, 0xA0F56CBA,
+                0xADAA7353, 0xC647636B, 0x7A705323, 0x119D431B,
+                0x763AA3BA, 0x1DD7B382, 0xA1E083CA, 0xCA0D93F2,
+                0xC7528C1B, 0xACBF9C23, 0x1088AC6B, 0x7B65BC53,
+                0x0A3693B9, 0x61DB8381, 0xDDECB3C9, 0xB601A3F1,
+                0xBB5EBC18, 0xD0B3AC20, 0x6C849C68, 0x07698C50,
+                0x8E22C3BC, 0xE5CFD384, 0x59F8E3CC, 0x3215F3F4,
+                0x3F4AEC1D, 0x54A7FC25, 0xE890CC6D, 0x837DDC55,
+                0xF22EF3BF, 0x99C3E387, 0x25F4D3CF, 0x4E19C3F7,
+                0x4346DC1E, 0x28ABCC26, 0x949CFC6E, 0xFF71EC56,
+                0x5BD33D2C, 0x303E2D14, 0x8C091D5C, 0xE7E40D64,
+                0xEABB128D, 0x815602B5, 0x3D6132FD, 0x568C22C5,
+                0x27DF0D2F, 0x4C321D17, 0xF0052D5F, 0x9BE83D67,
+                0x96B7228E, 0xFD5A32B6, 0x416D02FE, 0x2A8012C6,
+                0xA3CB5D2A, 0xC8264D12, 0x74117D5A, 0x1FFC6D62,
+                0x12A3728B, 0x794E62B3, 0xC57952FB, 0xAE9442C3,
+                0xDFC76D29, 0xB42A7D11, 0x081D4D59, 0x63F05D61,
+                0x6EAF4288, 0x054252B0, 0xB97562F8, 0xD29872C0,
+                0xB53F9261, 0xDED28259, 0x62E5B211, 0x0908A229,
+                0x0457BDC0, 0x6FBAADF8, 0xD38D9DB0, 0xB8608D88,
+                0xC933A262, 0xA2DEB25A, 0x1EE98212, 0x7504922A,
+                0x785B8DC3, 0x13B69DFB, 0xAF81ADB3, 0xC46CBD8B,
+                0x4D27F267, 0x26CAE25F, 0x9AFDD217, 0xF110C22F,
+                0xFC4FDDC6, 0x97A2CDFE, 0x2B95FDB6, 0x4078ED8E,
+                0x312BC264, 0x5AC6D25C, 0xE6F1E214, 0x8D1CF22C,
+                0x8043EDC5, 0xEBAEFDFD, 0x5799CDB5, 0x3C74DD8D,
+        },
+        [5] = {
+                0x00000000, 0x2F7076AF, 0x5EE0ED5E, 0x71909BF1,
+                0xBDC1DABC, 0x92B1AC13, 0xE32137E2, 0xCC51414D,
+                0x655FDA39, 0x4A2FAC96, 0x3BBF3767, 0x14CF41C8,
+                0xD89E0085, 0xF7EE762A, 0x867EEDDB, 0xA90E9B74,
+                0xCABFB472, 0xE5CFC2DD, 0x945F592C, 0xBB2F2F83,
+                0x777E6ECE, 0x580E1861, 0x299E8390, 0x06EEF53F,
+                0xAFE06E4B, 0x809018E4, 0xF1008315, 0xDE70F5BA,
+                0x1221B4F7, 0x3D51C258, 0x4CC159A9, 0x63B12F06,
+                0x8BA307A5, 0xA4D3710A, 0xD543EAFB, 0xFA339C54,
+                0x3662DD19, 0x1912ABB6, 0x68823047, 0x47F246E8,
+                0xEEFCDD9C, 0xC18CAB33, 0xB01C30C2, 0x9F6C466D,
+                0x533D0720, 0x7C4D718F, 0x0DDDEA7E, 0x22AD9CD1,
+                0x411CB3D7, 0x6E6CC578, 0x1FFC5E89, 0x308C2826,
+                0xFCDD696B, 0xD3AD1FC4, 0xA23D8435, 0x8D4DF29A,
+                0x244369EE, 0x0B331F41, 0x7AA384B0, 0x55D3F21F,
+                0x9982B352, 0xB6F2C5FD, 0xC7625E0C, 0xE81228A3,
+                0x099A600B, 0x26EA16A4, 0x577A8D55, 0x780AFBFA,
+                0xB45BBAB7, 0x9B2BCC18, 0xEABB57E9, 0xC5CB2146,
+                0x6CC5BA32, 0x43B5CC9D, 0x3225576C, 0x1D5521C3,
+                0xD104608E, 0xFE741621, 0x8FE48DD0, 0xA094FB7F,
+                0xC325D479, 0xEC55A2D6, 0x9DC53927, 0xB2B54F88,
+                0x7EE40EC5, 0x5194786A, 0x2004E39B, 0x0F749534,
+                0xA67A0E40, 0x890A78EF, 0xF89AE31E, 0xD7EA95B1,
+                0x1BBBD4FC, 0x34CBA253, 0x455B39A2, 0x6A2B4F0D,
+                0x823967AE, 0xAD491101, 0xDCD98AF0, 0xF3A9FC5F,
+                0x3FF8BD12, 0x1088CBBD, 0x6118504C, 0x4E6826E3,
+                0xE766BD97, 0xC816CB38, 0xB98650C9, 0x96F62666,
+                0x5AA7672B, 0x75D71184, 0x04478A75, 0x2B37FCDA,
+                0x4886D3DC, 0x67F6A573, 0x16663E82, 0x3916482D,
+                0xF5470960, 0xDA377FCF, 0xABA7E43E, 0x84D79291,
+                0x2DD909E5, 0x02A97F4A, 0x7339E4BB, 0x5C499214,
+                0x9018D359, 0xBF68A5F6, 0xCEF83E07, 0xE18848A8,
+                0x1334C016, 0x3C44B6B9, 0x4DD42D48, 0x62A45BE7,
+                0xAEF51AAA, 0x81856C05, 0xF015F7F4, 0xDF65815B,
+                0x766B1A2F, 0x591B6C80, 0x288BF771, 0x07FB81DE,
+                0xCBAAC093, 0xE4DAB63C, 0x954A2DCD, 0xBA3A5B62,
+                0xD98B7464, 0xF6FB02CB, 0x876B993A, 0xA81BEF95,
+                0x644AAED8, 0x4B3AD877, 0x3AAA4386, 0x15DA3529,
+                0xBCD4AE5D, 0x93A4D8F2, 0xE2344303, 0xCD4435AC,
+                0x011574E1, 0x2E65024E, 0x5FF599BF, 0x7085EF10,
+                0x9897C7B3, 0xB7E7B11C, 0xC6772AED, 0xE9075C42,
+                0x25561D0F, 0x0A266BA0, 0x7BB6F051, 0x54C686FE,
+                0xFDC81D8A, 0xD2B86B25, 0xA328F0D4, 0x8C58867B,
+                0x4009C736, 0x6F79B199, 0x1EE92A68, 0x31995CC7,
+                0x522873C1, 0x7D58056E, 0x0CC89E9F, 0x23B8E830,
+                0xEFE9A97D, 0xC099DFD2, 0xB1094423, 0x9E79328C,
+                0x3777A9F8, 0x1807DF57, 0x699744A6, 0x46E73209,
+                0x8AB67344, 0xA5C605EB, 0xD4569E1A, 0xFB26E8B5,
+                0x1AAEA01D, 0x35DED6B2, 0x444E4D43, 0x6B3E3BEC,
+                0xA76F7AA1, 0x881F0C0E, 0xF98F97FF, 0xD6FFE150,
+                0x7FF17A24, 0x50810C8B, 0x2111977A, 0x0E61E1D5,
+                0xC230A098, 0xED40D637, 0x9CD04DC6, 0xB3A03B69,
+                0xD011146F, 0xFF6162C0, 0x8EF1F931, 0xA1818F9E,
+                0x6DD0CED3, 0x42A0B87C, 0x3330238D, 0x1C405522,
+                0xB54ECE56, 0x9A3EB8F9, 0xEBAE2308, 0xC4DE55A7,
+                0x088F14EA, 0x27FF6245, 0x566FF9B4, 0x791F8F1B,
+                0x910DA7B8, 0xBE7DD117, 0xCFED4AE6, 0xE09D3C49,
+                0x2CCC7D04, 0x03BC0BAB, 0x722C905A, 0x5D5CE6F5,
+                0xF4527D81, 0xDB220B2E, 0xAAB290DF, 0x85C2E670,
+                0x4993A73D, 0x66E3D192, 0x17734A63, 0x38033CCC,
+                0x5BB213CA, 0x74C26565, 0x0552FE94, 0x2A22883B,
+                0xE673C976, 0xC903BFD9, 0xB8932428, 0x97E35287,
+                0x3EEDC9F3, 0x119DBF5C, 0x600D24AD, 0x4F7D5202,
+                0x832C134F, 0xAC5C65E0, 0xDDCCFE11, 0xF2BC88BE,
+        },
+        [6] = {
+                0x00000000, 0x2669802C, 0x4CD30058, 0x6ABA8074,
+                0x99A600B0, 0xBFCF809C, 0xD57500E8, 0xF31C80C4,
+                0x2D906E21, 0x0BF9EE0D, 0x61436E79, 0x472AEE55,
+                0xB4366E91, 0x925FEEBD, 0xF8E56EC9, 0xDE8CEEE5,
+                0x5B20DC42, 0x7D495C6E, 0x17F3DC1A, 0x319A5C36,
+                0xC286DCF2, 0xE4EF5CDE, 0x8E55DCAA, 0xA83C5C86,
+                0x76B0B263, 0x50D9324F, 0x3A63B23B, 0x1C0A3217,
+                0xEF16B2D3, 0xC97F32FF, 0xA3C5B28B, 0x85AC32A7,
+                0xB641B884, 0x902838A8, 0xFA92B8DC, 0xDCFB38F0,
+                0x2FE7B834, 0x098E3818, 0x6334B86C, 0x455D3840,
+                0x9BD1D6A5, 0xBDB85689, 0xD702D6FD, 0xF16B56D1,
+                0x0277D615, 0x241E5639, 0x4EA4D64D, 0x68CD5661,
+                0xED6164C6, 0xCB08E4EA, 0xA1B2649E, 0x87DBE4B2,
+                0x74C76476, 0x52AEE45A, 0x3814642E, 0x1E7DE402,
+                0xC0F10AE7, 0xE6988ACB, 0x8C220ABF, 0xAA4B8A93,
+                0x59570A57, 0x7F3E8A7B, 0x15840A0F, 0x33ED8A23,
+                0x725F1E49, 0x54369E65, 0x3E8C1E11, 0x18E59E3D,
+                0xEBF91EF9, 0xCD909ED5, 0xA72A1EA1, 0x81439E8D,
+                0x5FCF7068, 0x79A6F044, 0x131C7030, 0x3575F01C,
+                0xC66970D8, 0xE000F0F4, 0x8ABA7080, 0xACD3F0AC,
+                0x297FC20B, 0x0F164227, 0x65ACC253, 0x43C5427F,
+                0xB0D9C2BB, 0x96B04297, 0xFC0AC2E3, 0xDA6342CF,
+                0x04EFAC2A, 0x22862C06, 0x483CAC72, 0x6E552C5E,
+                0x9D49AC9A, 0xBB202CB6, 0xD19AACC2, 0xF7F32CEE,
+                0xC41EA6CD, 0xE27726E1, 0x88CDA695, 0xAEA426B9,
+                0x5DB8A67D, 0x7BD12651, 0x116BA625, 0x37022609,
+                0xE98EC8EC, 0xCFE748C0, 0xA55DC8B4, 0x83344898,
+                0x7028C85C, 0x56414870, 0x3CFBC804, 0x1A924828,
+                0x9F3E7A8F, 0xB957FAA3, 0xD3ED7AD7, 0xF584FAFB,
+                0x06987A3F, 0x20F1FA13, 0x4A4B7A67, 0x6C22FA4B,
+                0xB2AE14AE, 0x94C79482, 0xFE7D14F6, 0xD81494DA,
+                0x2B08141E, 0x0D619432, 0x67DB1446, 0x41B2946A,
+                0xE4BE3C92, 0xC2D7BCBE, 0xA86D3CCA, 0x8E04BCE6,
+                0x7D183C22, 0x5B71BC0E, 0x31CB3C7A, 0x17A2BC56,
+                0xC92E52B3, 0xEF47D29F, 0x85FD52EB, 0xA394D2C7,
+                0x50885203, 0x76E1D22F, 0x1C5B525B, 0x3A32D277,
+                0xBF9EE0D0, 0x99F760FC, 0xF34DE088, 0xD52460A4,
+                0x2638E060, 0x0051604C, 0x6AEBE038, 0x4C826014,
+                0x920E8EF1, 0xB4670EDD, 0xDEDD8EA9, 0xF8B40E85,
+                0x0BA88E41, 0x2DC10E6D, 0x477B8E19, 0x61120E35,
+                0x52FF8416, 0x7496043A, 0x1E2C844E, 0x38450462,
+                0xCB5984A6, 0xED30048A, 0x878A84FE, 0xA1E304D2,
+                0x7F6FEA37, 0x59066A1B, 0x33BCEA6F, 0x15D56A43,
+                0xE6C9EA87, 0xC0A06AAB, 0xAA1AEADF, 0x8C736AF3,
+                0x09DF5854, 0x2FB6D878, 0x450C580C, 0x6365D820,
+                0x907958E4, 0xB610D8C8, 0xDCAA58BC, 0xFAC3D890,
+                0x244F3675, 0x0226B659, 0x689C362D, 0x4EF5B601,
+                0xBDE936C5, 0x9B80B6E9, 0xF13A369D, 0xD753B6B1,
+                0x96E122DB, 0xB088A2F7, 0xDA322283, 0xFC5BA2AF,
+                0x0F47226B, 0x292EA247, 0x43942233, 0x65FDA21F,
+                0xBB714CFA, 0x9D18CCD6, 0xF7A24CA2, 0xD1CBCC8E,
+                0x22D74C4A, 0x04BECC66, 0x6E044C12, 0x486DCC3E,
+                0xCDC1FE99, 0xEBA87EB5, 0x8112FEC1, 0xA77B7EED,
+                0x5467FE29, 0x720E7E05, 0x18B4FE71, 0x3EDD7E5D,
+                0xE05190B8, 0xC6381094, 0xAC8290E0, 0x8AEB10CC,
+                0x79F79008, 0x5F9E1024, 0x35249050, 0x134D107C,
+                0x20A09A5F, 0x06C91A73, 0x6C739A07, 0x4A1A1A2B,
+                0xB9069AEF, 0x9F6F1AC3, 0xF5D59AB7, 0xD3BC1A9B,
+                0x0D30F47E, 0x2B597452, 0x41E3F426, 0x678A740A,
+                0x9496F4CE, 0xB2FF74E2, 0xD845F496, 0xFE2C74BA,
+                0x7B80461D, 0x5DE9C631, 0x37534645, 0x113AC669,
+                0xE22646AD, 0xC44FC681, 0xAEF546F5, 0x889CC6D9,
+                0x5610283C, 0x7079A810, 0x1AC32864, 0x3CAAA848,
+                0xCFB6288C, 0xE9DFA8A0, 0x836528D4, 0xA50CA8F8,
+        },
+#if (XWLIB_CRC32_SLICE > 8U)
+        [7] = {
+                0x00000000, 0xD7A01665, 0xB19C438B, 0x663C55EE,
+                0x7DE4E857, 0xAA44FE32, 0xCC78ABDC, 0x1BD8BDB9,
+                0xFBC9D0AE, 0x2C69C6CB, 0x4A559325, 0x9DF58540,
+                0x862D38F9, 0x518D2E9C, 0x37B17B72, 0xE0116D17,
+                0xE94FCE1D, 0x3EEFD878, 0x58D38D96, 0x8F739BF3,
+                0x94AB264A, 0x430B302F, 0x253765C1, 0xF29773A4,
+                0x12861EB3, 0xC52608D6, 0xA31A5D38, 0x74BA4B5D,
+                0x6F62F6E4, 0xB8C2E081, 0xDEFEB56F, 0x095EA30A,
+                0xCC43F37B, 0x1BE3E51E, 0x7DDFB0F0, 0xAA7FA695,
+                0xB1A71B2C, 0x66070D49, 0x003B58A7, 0xD79B4EC2,
+                0x378A23D5, 0xE02A35B0, 0x8616605E, 0x51B6763B,
+                0x4A6ECB82, 0x9DCEDDE7, 0xFBF28809, 0x2C529E6C,
+                0x250C3D66, 0xF2AC2B03, 0x94907EED, 0x43306888,
+                0x58E8D531, 0x8F48C354, 0xE97496BA, 0x3ED480DF,
+                0xDEC5EDC8, 0x0965FBAD, 0x6F59AE43, 0xB8F9B826,
+                0xA321059F, 0x748113FA, 0x12BD4614, 0xC51D5071,
+                0x865B89B7, 0x51FB9FD2, 0x37C7CA3C, 0xE067DC59,
+                0xFBBF61E0, 0x2C1F7785, 0x4A23226B, 0x9D83340E,
+                0x7D925919, 0xAA324F7C, 0xCC0E1A92, 0x1BAE0CF7,
+                0x0076B14E, 0xD7D6A72B, 0xB1EAF2C5, 0x664AE4A0,
+                0x6F1447AA, 0xB8B451CF, 0xDE880421, 0x09281244,
+                0x12F0AFFD, 0xC550B998, 0xA36CEC76, 0x74CCFA13,
+                0x94DD9704, 0x437D8161, 0x2541D48F, 0xF2E1C2EA,
+                0xE9397F53, 0x3E996936, 0x58A53CD8, 0x8F052ABD,
+                0x4A187ACC, 0x9DB86CA9, 0xFB843947, 0x2C242F22,
+                0x37FC929B, 0xE05C84FE, 0x8660D110, 0x51C0C775,
+                0xB1D1AA62, 0x6671BC07, 0x004DE9E9, 0xD7EDFF8C,
+                0xCC354235, 0x1B955450, 0x7DA901BE, 0xAA0917DB,
+                0xA357B4D1, 0x74F7A2B4, 0x12CBF75A, 0xC56BE13F,
+                0xDEB35C86, 0x09134AE3, 0x6F2F1F0D, 0xB88F0968,
+                0x589E647F, 0x8F3E721A, 0xE90227F4, 0x3EA23191,
+                0x257A8C28, 0xF2DA9A4D, 0x94E6CFA3, 0x4346D9C6,
+                0x126B7C2F, 0xC5CB6A4A, 0xA3F73FA4, 0x745729C1,
+                0x6F8F9478, 0xB82F821D, 0xDE13D7F3, 0x09B3C196,
+                0xE9A2AC81, 0x3E02BAE4, 0x583EEF0A, 0x8F9EF96F,
+                0x944644D6, 0x43E652B3, 0x25DA075D, 0xF27A1138,
+                0xFB24B232, 0x2C84A457, 0x4AB8F1B9, 0x9D18E7DC,
+                0x86C05A65, 0x51604C00, 0x375C19EE, 0xE0FC0F8B,
+                0x00ED629C, 0xD74D74F9, 0xB1712117, 0x66D13772,
+                0x7D098ACB, 0xAAA99CAE, 0xCC95C940, 0x1B35DF25,
+                0xDE288F54, 0x09889931, 0x6FB4CCDF, 0xB814DABA,
+                0xA3CC6703, 0x746C7166, 0x12502488, 0xC5F032ED,
+                0x25E15FFA, 0xF241499F, 0x947D1C71, 0x43DD0A14,
+                0x5805B7AD, 0x8FA5A1C8, 0xE999F426, 0x3E39E243,
+                0x37674149, 0xE0C7572C, 0x86FB02C2, 0x515B14A7,
+                0x4A83A91E, 0x9D23BF7B, 0xFB1FEA95, 0x2CBFFCF0,
+                0xCCAE91E7, 0x1B0E8782, 0x7D32D26C, 0xAA92C409,
+                0xB14A79B0, 0x66EA6FD5, 0x00D63A3B, 0xD7762C5E,
+                0x9430F598, 0x4390E3FD, 0x25ACB613, 0xF20CA076,
+                0xE9D41DCF, 0x3E740BAA, 0x58485E44, 0x8FE84821,
+                0x6FF92536, 0xB8593353, 0xDE6566BD, 0x09C570D8,
+                0x121DCD61, 0xC5BDDB04, 0xA3818EEA, 0x7421988F,
+                0x7D7F3B85, 0xAADF2DE0, 0xCCE3780E, 0x1B436E6B,
+                0x009BD3D2, 0xD73BC5B7, 0xB1079059, 0x66A7863C,
+                0x86B6EB2B, 0x5116FD4E, 0x372AA8A0, 0xE08ABEC5,
+                0xFB52037C, 0x2CF21519, 0x4ACE40F7, 0x9D6E5692,
+                0x587306E3, 0x8FD31086, 0xE9EF4568, 0x3E4F530D,
+                0x2597EEB4, 0xF237F8D1, 0x940BAD3F, 0x43ABBB5A,
+                0xA3BAD64D, 0x741AC028, 0x122695C6, 0xC58683A3,
+                0xDE5E3E1A, 0x09FE287F, 0x6FC27D91, 0xB8626BF4,
+                0xB13CC8FE, 0x669CDE9B, 0x00A08B75, 0xD7009D10,
+                0xCCD820A9, 0x1B7836CC, 0x7D446322, 0xAAE47547,
+                0x4AF51850, 0x9D550E35, 0xFB695BDB, 0x2CC94DBE,
+                0x3711F007, 0xE0B1E662, 0x868DB38C, 0x512DA5E9,
+        },
+        [8] = {
+                0x00000000, 0x24D6F85E, 0x49ADF0BC, 0x6D7B08E2,
+                0x935BE178, 0xB78D1926, 0xDAF611C4, 0xFE20E99A,
+                0x386BADB1, 0x1CBD55EF, 0x71C65D0D, 0x5510A553,
+                0xAB304CC9, 0x8FE6B497, 0xE29DBC75, 0xC64B442B,
+                0x70D75B62, 0x5401A33C, 0x397AABDE, 0x1DAC5380,
+                0xE38CBA1A, 0xC75A4244, 0xAA214AA6, 0x8EF7B2F8,
+                0x48BCF6D3, 0x6C6A0E8D, 0x0111066F, 0x25C7FE31,
+                0xDBE717AB, 0xFF31EFF5, 0x924AE717, 0xB69C1F49,
+                0xE1AEB6C4, 0xC5784E9A, 0xA8034678, 0x8CD5BE26,
+                0x72F557BC, 0x5623AFE2, 0x3B58A700, 0x1F8E5F5E,
+                0xD9C51B75, 0xFD13E32B, 0x9068EBC9, 0xB4BE1397,
+                0x4A9EFA0D, 0x6E480253, 0x03330AB1, 0x27E5F2EF,
+                0x9179EDA6, 0xB5AF15F8, 0xD8D41D1A, 0xFC02E544,
+                0x02220CDE, 0x26F4F480, 0x4B8FFC62, 0x6F59043C,
+                0xA9124017, 0x8DC4B849, 0xE0BFB0AB, 0xC46948F5,
+                0x3A49A16F, 0x1E9F5931, 0x73E451D3, 0x5732A98D,
+                0xDD8102C9, 0xF957FA97, 0x942CF275, 0xB0FA0A2B,
+                0x4EDAE3B1, 0x6A0C1BEF, 0x0777130D, 0x23A1EB53,
+                0xE5EAAF78, 0xC13C5726, 0xAC475FC4, 0x8891A79A,
+                0x76B14E00, 0x5267B65E, 0x3F1CBEBC, 0x1BCA46E2,
+                0xAD5659AB, 0x8980A1F5, 0xE4FBA917, 0xC02D5149,
+                0x3E0DB8D3, 0x1ADB408D, 0x77A0486F, 0x5376B031,
+                0x953DF41A, 0xB1EB0C44, 0xDC9004A6, 0xF846FCF8,
+                0x06661562, 0x22B0ED3C, 0x4FCBE5DE, 0x6B1D1D80,
+                0x3C2FB40D, 0x18F94C53, 0x758244B1, 0x5154BCEF,
+                0xAF745575, 0x8BA2AD2B, 0xE6D9A5C9, 0xC20F5D97,
+                0x044419BC, 0x2092E1E2, 0x4DE9E900, 0x693F115E,
+                0x971FF8C4, 0xB3C9009A, 0xDEB20878, 0xFA64F026,
+                0x4CF8EF6F, 0x682E1731, 0x05551FD3, 0x2183E78D,
+                0xDFA30E17, 0xFB75F649, 0x960EFEAB, 0xB2D806F5,
+                0x749342DE, 0x5045BA80, 0x3D3EB262, 0x19E84A3C,
+                0xE7C8A3A6, 0xC31E5BF8, 0xAE65531A, 0x8AB3AB44,
+                0xA5DE6AD3, 0x8108928D, 0xEC739A6F, 0xC8A56231,
+                0x36858BAB, 0x125373F5, 0x7F287B17, 0x5BFE8349,
+                0x9DB5C762, 0xB9633F3C, 0xD41837DE, 0xF0CECF80,
+                0x0EEE261A, 0x2A38DE44, 0x4743D6A6, 0x63952EF8,
+                0xD50931B1, 0xF1DFC9EF, 0x9CA4C10D, 0xB8723953,
+                0x4652D0C9, 0x62842897, 0x0FFF2075, 0x2B29D82B,
+                0xED629C00, 0xC9B4645E, 0xA4CF6CBC, 0x801994E2,
+                0x7E397D78, 0x5AEF8526, 0x37948DC4, 0x1342759A,
+                0x4470DC17, 0x60A62449, 0x0DDD2CAB, 0x290BD4F5,
+                0xD72B3D6F, 0xF3FDC531, 0x9E86CDD3, 0xBA50358D,
+                0x7C1B71A6, 0x58CD89F8, 0x35B6811A, 0x11607944,
+                0xEF4090DE, 0xCB966880, 0xA6ED6062, 0x823B983C,
+                0x34A78775, 0x10717F2B, 0x7D0A77C9, 0x59DC8F97,
+                0xA7FC660D, 0x832A9E53, 0xEE5196B1, 0xCA876EEF,
+                0x0CCC2AC4, 0x281AD29A, 0x4561DA78, 0x61B72226,
+                0x9F97CBBC, 0xBB4133E2, 0xD63A3B00, 0xF2ECC35E,
+                0x785F681A, 0x5C899044, 0x31F298A6, 0x152460F8,
+                0xEB048962, 0xCFD2713C, 0xA2A979DE, 0x867F8180,
+                0x4034C5AB, 0x64E23DF5, 0x09993517, 0x2D4FCD49,
+                0xD36F24D3, 0xF7B9DC8D, 0x9AC2D46F, 0xBE142C31,
+                0x08883378, 0x2C5ECB26, 0x4125C3C4, 0x65F33B9A,
+                0x9BD3D200, 0xBF052A5E, 0xD27E22BC, 0xF6A8DAE2,
+                0x30E39EC9, 0x14356697, 0x794E6E75, 0x5D98962B,
+                0xA3B87FB1, 0x876E87EF, 0xEA158F0D, 0xCEC37753,
+                0x99F1DEDE, 0xBD272680, 0xD05C2E62, 0xF48AD63C,
+                0x0AAA3FA6, 0x2E7CC7F8, 0x4307CF1A, 0x67D13744,
+                0xA19A736F, 0x854C8B31, 0xE83783D3, 0xCCE17B8D,
+                0x32C19217, 0x16176A49, 0x7B6C62AB, 0x5FBA9AF5,
+                0xE92685BC, 0xCDF07DE2, 0xA08B7500, 0x845D8D5E,
+                0x7A7D64C4, 0x5EAB9C9A, 0x33D09478, 0x17066C26,
+                0xD14D280D, 0xF59BD053, 0x98E0D8B1, 0xBC3620EF,
+                0x4216C975, 0x66C0312B, 0x0BBB39C9, 0x2F6DC197,
+        },
+        [9] = {
+                0x00000000, 0x5560BAE7, 0xAAC175CE, 0xFFA1CF29,
+                0x4B5E84DD, 0x1E3E3E3A, 0xE19FF113, 0xB4FF4BF4,
+                0x96BD09BA, 0xC3DDB35D, 0x3C7C7C74, 0x691CC693,
+                0xDDE38D67, 0x88833780, 0x7722F8A9, 0x2242424E,
+                0x33A67C35, 0x66C6C6D2, 0x996709FB, 0xCC07B31C,
+                0x78F8F8E8, 0x2D98420F, 0xD2398D26, 0x875937C1,
+                0xA51B758F, 0xF07BCF68, 0x0FDA0041, 0x5ABABAA6,
+                0xEE45F152, 0xBB254BB5, 0x4484849C, 0x11E43E7B,
+                0x674CF86A, 0x322C428D, 0xCD8D8DA4, 0x98ED3743,
+                0x2C127CB7, 0x7972C650, 0x86D30979, 0xD3B3B39E,
+                0xF1F1F1D0, 0xA4914B37, 0x5B30841E, 0x0E503EF9,
+                0xBAAF750D, 0xEFCFCFEA, 0x106E00C3, 0x450EBA24,
+                0x54EA845F, 0x018A3EB8, 0xFE2BF191, 0xAB4B4B76,
+                0x1FB40082, 0x4AD4BA65, 0xB575754C, 0xE015CFAB,
+                0xC2578DE5, 0x97373702, 0x6896F82B, 0x3DF642CC,
+                0x89090938, 0xDC69B3DF, 0x23C87CF6, 0x76A8C611,
+                0xCE99F0D4, 0x9BF94A33, 0x6458851A, 0x31383FFD,
+                0x85C77409, 0xD0A7CEEE, 0x2F0601C7, 0x7A66BB20,
+                0x5824F96E, 0x0D444389, 0xF2E58CA0, 0xA7853647,
+                0x137A7DB3, 0x461AC754, 0xB9BB087D, 0xECDBB29A,
+                0xFD3F8CE1, 0xA85F3606, 0x57FEF92F, 0x029E43C8,
+                0xB661083C, 0xE301B2DB, 0x1CA07DF2, 0x49C0C715,
+                0x6B82855B, 0x3EE23FBC, 0xC143F095, 0x94234A72,
+                0x20DC0186, 0x75BCBB61, 0x8A1D7448, 0xDF7DCEAF,
+                0xA9D508BE, 0xFCB5B259, 0x03147D70, 0x5674C797,
+                0xE28B8C63, 0xB7EB3684, 0x484AF9AD, 0x1D2A434A,
+                0x3F680104, 0x6A08BBE3, 0x95A974CA, 0xC0C9CE2D,
+                0x743685D9, 0x21563F3E, 0xDEF7F017, 0x8B974AF0,
+                0x9A73748B, 0xCF13CE6C, 0x30B20145, 0x65D2BBA2,
+                0xD12DF056, 0x844D4AB1, 0x7BEC8598, 0x2E8C3F7F,
+                0x0CCE7D31, 0x59AEC7D6, 0xA60F08FF, 0xF36FB218,
+                0x4790F9EC, 0x12F0430B, 0xED518C22, 0xB83136C5,
+                0x83EF8EE9, 0xD68F340E, 0x292EFB27, 0x7C4E41C0,
+                0xC8B10A34, 0x9DD1B0D3, 0x62707FFA, 0x3710C51D,
+                0x15528753, 0x40323DB4, 0xBF93F29D, 0xEAF3487A,
+                0x5E0C038E, 0x0B6CB969, 0xF4CD7640, 0xA1ADCCA7,
+                0xB049F2DC, 0xE529483B, 0x1A888712, 0x4FE83DF5,
+                0xFB177601, 0xAE77CCE6, 0x51D603CF, 0x04B6B928,
+                0x26F4FB66, 0x73944181, 0x8C358EA8, 0xD955344F,
+                0x6DAA7FBB, 0x38CAC55C, 0xC76B0A75, 0x920BB092,
+                0xE4A37683, 0xB1C3CC64, 0x4E62034D, 0x1B02B9AA,
+                0xAFFDF25E, 0xFA9D48B9, 0x053C8790, 0x505C3D77,
+                0x721E7F39, 0x277EC5DE, 0xD8DF0AF7, 0x8DBFB010,
+                0x3940FBE4, 0x6C204103, 0x93818E2A, 0xC6E134CD,
+                0xD7050AB6, 0x8265B051, 0x7DC47F78, 0x28A4C59F,
+                0x9C5B8E6B, 0xC93B348C, 0x369AFBA5, 0x63FA4142,
+                0x41B8030C, 0x14D8B9EB, 0xEB7976C2, 0xBE19CC25,
+                0x0AE687D1, 0x5F863D36, 0xA027F21F, 0xF54748F8,
+                0x4D767E3D, 0x1816C4DA, 0xE7B70BF3, 0xB2D7B114,
+                0x0628FAE0, 0x53484007, 0xACE98F2E, 0xF98935C9,
+                0xDBCB7787, 0x8EABCD60, 0x710A0249, 0x246AB8AE,
+                0x9095F35A, 0xC5F549BD, 0x3A548694, 0x6F343C73,
+                0x7ED00208, 0x2BB0B8EF, 0xD41177C6, 0x8171CD21,
+                0x358E86D5, 0x60EE3C32, 0x9F4FF31B, 0xCA2F49FC,
+                0xE86D0BB2, 0xBD0DB155, 0x42AC7E7C, 0x17CCC49B,
+                0xA3338F6F, 0xF6533588, 0x09F2FAA1, 0x5C924046,
+                0x2A3A8657, 0x7F5A3CB0, 0x80FBF399, 0xD59B497E,
+                0x6164028A, 0x3404B86D, 0xCBA57744, 0x9EC5CDA3,
+                0xBC878FED, 0xE9E7350A, 0x1646FA23, 0x432640C4,
+                0xF7D90B30, 0xA2B9B1D7, 0x5D187EFE, 0x0878C419,
+                0x199CFA62, 0x4CFC4085, 0xB35D8FAC, 0xE63D354B,
+                0x52C27EBF, 0x07A2C458, 0xF8030B71, 0xAD63B196,
+                0x8F21F3D8, 0xDA41493F, 0x25E08616, 0x70803CF1,
+                0xC47F7705, 0x911FCDE2, 0x6EBE02CB, 0x3BDEB82C,
+        },
+        [10] = {
+                0x00000000, 0x19037293, 0x3206E526, 0x2B0597B5,
+                0x640DCA4C, 0x7D0EB8DF, 0x560B2F6A, 0x4F085DF9,
+                0xC81B9498, 0xD118E60B, 0xFA1D71BE, 0xE31E032D,
+                0xAC165ED4, 0xB5152C47, 0x9E10BBF2, 0x8713C961,
+                0x8EEB4671, 0x97E834E2, 0xBCEDA357, 0xA5EED1C4,
+                0xEAE68C3D, 0xF3E5FEAE, 0xD8E0691B, 0xC1E31B88,
+                0x46F0D2E9, 0x5FF3A07A, 0x74F637CF, 0x6DF5455C,
+                0x22FD18A5, 0x3BFE6A36, 0x10FBFD83, 0x09F88F10,
+                0x030AE3A3, 0x1A099130, 0x310C0685, 0x280F7416,
+                0x670729EF, 0x7E045B7C, 0x5501CCC9, 0x4C02BE5A,
+                0xCB11773B, 0xD21205A8, 0xF917921D, 0xE014E08E,
+                0xAF1CBD77, 0xB61FCFE4, 0x9D1A5851, 0x84192AC2,
+                0x8DE1A5D2, 0x94E2D741, 0xBFE740F4, 0xA6E43267,
+                0xE9EC6F9E, 0xF0EF1D0D, 0xDBEA8AB8, 0xC2E9F82B,
+                0x45FA314A, 0x5CF943D9, 0x77FCD46C, 0x6EFFA6FF,
+                0x21F7FB06, 0x38F48995, 0x13F11E20, 0x0AF26CB3,
+                0x0615C746, 0x1F16B5D5, 0x34132260, 0x2D1050F3,
+                0x62180D0A, 0x7B1B7F99, 0x501EE82C, 0x491D9ABF,
+                0xCE0E53DE, 0xD70D214D, 0xFC08B6F8, 0xE50BC46B,
+                0xAA039992, 0xB300EB01, 0x98057CB4, 0x81060E27,
+                0x88FE8137, 0x91FDF3A4, 0xBAF86411, 0xA3FB1682,
+                0xECF34B7B, 0xF5F039E8, 0xDEF5AE5D, 0xC7F6DCCE,
+                0x40E515AF, 0x59E6673C, 0x72E3F089, 0x6BE0821A,
+                0x24E8DFE3, 0x3DEBAD70, 0x16EE3AC5, 0x0FED4856,
+                0x051F24E5, 0x1C1C5676, 0x3719C1C3, 0x2E1AB350,
+                0x6112EEA9, 0x78119C3A, 0x53140B8F, 0x4A17791C,
+                0xCD04B07D, 0xD407C2EE, 0xFF02555B, 0xE60127C8,
+                0xA9097A31, 0xB00A08A2, 0x9B0F9F17, 0x820CED84,
+                0x8BF46294, 0x92F71007, 0xB9F287B2, 0xA0F1F521,
+                0xEFF9A8D8, 0xF6FADA4B, 0xDDFF4DFE, 0xC4FC3F6D,
+                0x43EFF60C, 0x5AEC849F, 0x71E9132A, 0x68EA61B9,
+                0x27E23C40, 0x3EE14ED3, 0x15E4D966, 0x0CE7ABF5,
+                0x0C2B8E8C, 0x1528FC1F, 0x3E2D6BAA, 0x272E1939,
+                0x682644C0, 0x71253653, 0x5A20A1E6, 0x4323D375,
+                0xC4301A14, 0xDD336887, 0xF636FF32, 0xEF358DA1,
+                0xA03DD058, 0xB93EA2CB, 0x923B357E, 0x8B3847ED,
+                0x82C0C8FD, 0x9BC3BA6E, 0xB0C62DDB, 0xA9C55F48,
+                0xE6CD02B1, 0xFFCE7022, 0xD4CBE797, 0xCDC89504,
+                0x4ADB5C65, 0x53D82EF6, 0x78DDB943, 0x61DECBD0,
+                0x2ED69629, 0x37D5E4BA, 0x1CD0730F, 0x05D3019C,
+                0x0F216D2F, 0x16221FBC, 0x3D278809, 0x2424FA9A,
+                0x6B2CA763, 0x722FD5F0, 0x592A4245, 0x402930D6,
+                0xC73AF9B7, 0xDE398B24, 0xF53C1C91, 0xEC3F6E02,
+                0xA33733FB, 0xBA344168, 0x9131D6DD, 0x8832A44E,
+                0x81CA2B5E, 0x98C959CD, 0xB3CCCE78, 0xAACFBCEB,
+                0xE5C7E112, 0xFCC49381, 0xD7C10434, 0xCEC276A7,
+                0x49D1BFC6, 0x50D2CD55, 0x7BD75AE0, 0x62D42873,
+                0x2DDC758A, 0x34DF0719, 0x1FDA90AC, 0x06D9E23F,
+                0x0A3E49CA, 0x133D3B59, 0x3838ACEC, 0x213BDE7F,
+                0x6E338386, 0x7730F115, 0x5C3566A0, 0x45361433,
+                0xC225DD52, 0xDB26AFC1, 0xF0233874, 0xE9204AE7,
+                0xA628171E, 0xBF2B658D, 0x942EF238, 0x8D2D80AB,
+                0x84D50FBB, 0x9DD67D28, 0xB6D3EA9D, 0xAFD0980E,
+                0xE0D8C5F7, 0xF9DBB764, 0xD2DE20D1, 0xCBDD5242,
+                0x4CCE9B23, 0x55CDE9B0, 0x7EC87E05, 0x67CB0C96,
+                0x28C3516F, 0x31C023FC, 0x1AC5B449, 0x03C6C6DA,
+                0x0934AA69, 0x1037D8FA, 0x3B324F4F, 0x22313DDC,
+                0x6D396025, 0x743A12B6, 0x5F3F8503, 0x463CF790,
+                0xC12F3EF1, 0xD82C4C62, 0xF329DBD7, 0xEA2AA944,
+                0xA522F4BD, 0xBC21862E, 0x9724119B, 0x8E276308,
+                0x87DFEC18, 0x9EDC9E8B, 0xB5D9093E, 0xACDA7BAD,
+                0xE3D22654, 0xFAD154C7, 0xD1D4C372, 0xC8D7B1E1,
+                0x4FC47880, 0x56C70A13, 0x7DC29DA6, 0x64C1EF35,
+                0x2BC9B2CC, 0x32CAC05F, 0x19CF57EA, 0x00CC2579,
+        },
+        [11] = {
+                0x00000000, 0x18571D18, 0x30AE3A30, 0x28F92728,
+                0x615C7460, 0x790B6978, 0x51F24E50, 0x49A55348,
+                0xC2B8E8C0, 0xDAEFF5D8, 0xF216D2F0, 0xEA41CFE8,
+                0xA3E49CA0, 0xBBB381B8, 0x934AA690, 0x8B1DBB88,
+                0x9BADBEC1, 0x83FAA3D9, 0xAB0384F1, 0xB35499E9,
+                0xFAF1CAA1, 0xE2A6D7B9, 0xCA5FF091, 0xD208ED89,
+                0x59155601, 0x41424B19, 0x69BB6C31, 0x71EC7129,
+                0x38492261, 0x201E3F79, 0x08E71851, 0x10B00549,
+                0x298712C3, 0x31D00FDB, 0x192928F3, 0x017E35EB,
+                0x48DB66A3, 0x508C7BBB, 0x78755C93, 0x6022418B,
+                0xEB3FFA03, 0xF368E71B, 0xDB91C033, 0xC3C6DD2B,
+                0x8A638E63, 0x9234937B, 0xBACDB453, 0xA29AA94B,
+                0xB22AAC02, 0xAA7DB11A, 0x82849632, 0x9AD38B2A,
+                0xD376D862, 0xCB21C57A, 0xE3D8E252, 0xFB8FFF4A,
+                0x709244C2, 0x68C559DA, 0x403C7EF2, 0x586B63EA,
+                0x11CE30A2, 0x09992DBA, 0x21600A92, 0x3937178A,
+                0x530E2586, 0x4B59389E, 0x63A01FB6, 0x7BF702AE,
+                0x325251E6, 0x2A054CFE, 0x02FC6BD6, 0x1AAB76CE,
+                0x91B6CD46, 0x89E1D05E, 0xA118F776, 0xB94FEA6E,
+                0xF0EAB926, 0xE8BDA43E, 0xC0448316, 0xD8139E0E,
+                0xC8A39B47, 0xD0F4865F, 0xF80DA177, 0xE05ABC6F,
+                0xA9FFEF27, 0xB1A8F23F, 0x9951D517, 0x8106C80F,
+                0x0A1B7387, 0x124C6E9F, 0x3AB549B7, 0x22E254AF,
+                0x6B4707E7, 0x73101AFF, 0x5BE93DD7, 0x43BE20CF,
+                0x7A893745, 0x62DE2A5D, 0x4A270D75, 0x5270106D,
+                0x1BD54325, 0x03825E3D, 0x2B7B7915, 0x332C640D,
+                0xB831DF85, 0xA066C29D, 0x889FE5B5, 0x90C8F8AD,
+                0xD96DABE5, 0xC13AB6FD, 0xE9C391D5, 0xF1948CCD,
+                0xE1248984, 0xF973949C, 0xD18AB3B4, 0xC9DDAEAC,
+                0x8078FDE4, 0x982FE0FC, 0xB0D6C7D4, 0xA881DACC,
+                0x239C6144, 0x3BCB7C5C, 0x13325B74, 0x0B65466C,
+                0x42C01524, 0x5A97083C, 0x726E2F14, 0x6A39320C,
+                0xA61C4B0C, 0xBE4B5614, 0x96B2713C, 0x8EE56C24,
+                0xC7403F6C, 0xDF172274, 0xF7EE055C, 0xEFB91844,
+                0x64A4A3CC, 0x7CF3BED4, 0x540A99FC, 0x4C5D84E4,
+                0x05F8D7AC, 0x1DAFCAB4, 0x3556ED9C, 0x2D01F084,
+                0x3DB1F5CD, 0x25E6E8D5, 0x0D1FCFFD, 0x1548D2E5,
+                0x5CED81AD, 0x44BA9CB5, 0x6C43BB9D, 0x7414A685,
+                0xFF091D0D, 0xE75E0015, 0xCFA7273D, 0xD7F03A25,
+                0x9E55696D, 0x86027475, 0xAEFB535D, 0xB6AC4E45,
+                0x8F9B59CF, 0x97CC44D7, 0xBF3563FF, 0xA7627EE7,
+                0xEEC72DAF, 0xF69030B7, 0xDE69179F, 0xC63E0A87,
+                0x4D23B10F, 0x5574AC17, 0x7D8D8B3F, 0x65DA9627,
+                0x2C7FC56F, 0x3428D877, 0x1CD1FF5F, 0x0486E247,
+                0x1436E70E, 0x0C61FA16, 0x2498DD3E, 0x3CCFC026,
+                0x756A936E, 0x6D3D8E76, 0x45C4A95E, 0x5D93B446,
+                0xD68E0FCE, 0xCED912D6, 0xE62035FE, 0xFE7728E6,
+                0xB7D27BAE, 0xAF8566B6, 0x877C419E, 0x9F2B5C86,
+                0xF5126E8A, 0xED457392, 0xC5BC54BA, 0xDDEB49A2,
+                0x944E1AEA, 0x8C1907F2, 0xA4E020DA, 0xBCB73DC2,
+                0x37AA864A, 0x2FFD9B52, 0x0704BC7A, 0x1F53A162,
+                0x56F6F22A, 0x4EA1EF32, 0x6658C81A, 0x7E0FD502,
+                0x6EBFD04B, 0x76E8CD53, 0x5E11EA7B, 0x4646F763,
+                0x0FE3A42B, 0x17B4B933, 0x3F4D9E1B, 0x271A8303,
+                0xAC07388B, 0xB4502593, 0x9CA902BB, 0x84FE1FA3,
+                0xCD5B4CEB, 0xD50C51F3, 0xFDF576DB, 0xE5A26BC3,
+                0xDC957C49, 0xC4C26151, 0xEC3B4679, 0xF46C5B61,
+                0xBDC90829, 0xA59E1531, 0x8D673219, 0x95302F01,
+                0x1E2D9489, 0x067A8991, 0x2E83AEB9, 0x36D4B3A1,
+                0x7F71E0E9, 0x6726FDF1, 0x4FDFDAD9, 0x5788C7C1,
+                0x4738C288, 0x5F6FDF90, 0x7796F8B8, 0x6FC1E5A0,
+                0x2664B6E8, 0x3E33ABF0, 0x16CA8CD8, 0x0E9D91C0,
+                0x85802A48, 0x9DD73750, 0xB52E1078, 0xAD790D60,
+                0xE4DC5E28, 0xFC8B4330, 0xD4726418, 0xCC257900,
+        },
+        [12] = {
+                0x00000000, 0x52E4F959, 0xA5C9F2B2, 0xF72D0BEB,
+                0x554F8A25, 0x07AB737C, 0xF0867897, 0xA26281CE,
+                0xAA9F144A, 0xF87BED13, 0x0F56E6F8, 0x5DB21FA1,
+                0xFFD09E6F, 0xAD346736, 0x5A196CDD, 0x08FD9584,
+                0x4BE247D5, 0x1906BE8C, 0xEE2BB567, 0xBCCF4C3E,
+                0x1EADCDF0, 0x4C4934A9, 0xBB643F42, 0xE980C61B,
+                0xE17D539F, 0xB399AAC6, 0x44B4A12D, 0x16505874,
+                0xB432D9BA, 0xE6D620E3, 0x11FB2B08, 0x431FD251,
+                0x97C48FAA, 0xC52076F3, 0x320D7D18, 0x60E98441,
+                0xC28B058F, 0x906FFCD6, 0x6742F73D, 0x35A60E64,
+                0x3D5B9BE0, 0x6FBF62B9, 0x98926952, 0xCA76900B,
+                0x681411C5, 0x3AF0E89C, 0xCDDDE377, 0x9F391A2E,
+                0xDC26C87F, 0x8EC23126, 0x79EF3ACD, 0x2B0BC394,
+                0x8969425A, 0xDB8DBB03, 0x2CA0B0E8, 0x7E4449B1,
+                0x76B9DC35, 0x245D256C, 0xD3702E87, 0x8194D7DE,
+                0x23F65610, 0x7112AF49, 0x863FA4A2, 0xD4DB5DFB,
+                0x31557015, 0x63B1894C, 0x949C82A7, 0xC6787BFE,
+                0x641AFA30, 0x36FE0369, 0xC1D30882, 0x9337F1DB,
+                0x9BCA645F, 0xC92E9D06, 0x3E0396ED, 0x6CE76FB4,
+                0xCE85EE7A, 0x9C611723, 0x6B4C1CC8, 0x39A8E591,
+                0x7AB737C0, 0x2853CE99, 0xDF7EC572, 0x8D9A3C2B,
+                0x2FF8BDE5, 0x7D1C44BC, 0x8A314F57, 0xD8D5B60E,
+                0xD028238A, 0x82CCDAD3, 0x75E1D138, 0x27052861,
+                0x8567A9AF, 0xD78350F6, 0x20AE5B1D, 0x724AA244,
+                0xA691FFBF, 0xF47506E6, 0x03580D0D, 0x51BCF454,
+                0xF3DE759A, 0xA13A8CC3, 0x56178728, 0x04F37E71,
+                0x0C0EEBF5, 0x5EEA12AC, 0xA9C71947, 0xFB23E01E,
+                0x594161D0, 0x0BA59889, 0xFC889362, 0xAE6C6A3B,
+                0xED73B86A, 0xBF974133, 0x48BA4AD8, 0x1A5EB381,
+                0xB83C324F, 0xEAD8CB16, 0x1DF5C0FD, 0x4F1139A4,
+                0x47ECAC20, 0x15085579, 0xE2255E92, 0xB0C1A7CB,
+                0x12A32605, 0x4047DF5C, 0xB76AD4B7, 0xE58E2DEE,
+                0x62AAE02A, 0x304E1973, 0xC7631298, 0x9587EBC1,
+                0x37E56A0F, 0x65019356, 0x922C98BD, 0xC0C861E4,
+                0xC835F460, 0x9AD10D39, 0x6DFC06D2, 0x3F18FF8B,
+                0x9D7A7E45, 0xCF9E871C, 0x38B38CF7, 0x6A5775AE,
+                0x2948A7FF, 0x7BAC5EA6, 0x8C81554D, 0xDE65AC14,
+                0x7C072DDA, 0x2EE3D483, 0xD9CEDF68, 0x8B2A2631,
+                0x83D7B3B5, 0xD1334AEC, 0x261E4107, 0x74FAB85E,
+                0xD6983990, 0x847CC0C9, 0x7351CB22, 0x21B5327B,
+                0xF56E6F80, 0xA78A96D9, 0x50A79D32, 0x0243646B,
+                0xA021E5A5, 0xF2C51CFC, 0x05E81717, 0x570CEE4E,
+                0x5FF17BCA, 0x0D158293, 0xFA388978, 0xA8DC7021,
+                0x0ABEF1EF, 0x585A08B6, 0xAF77035D, 0xFD93FA04,
+                0xBE8C2855, 0xEC68D10C, 0x1B45DAE7, 0x49A123BE,
+                0xEBC3A270, 0xB9275B29, 0x4E0A50C2, 0x1CEEA99B,
+                0x14133C1F, 0x46F7C546, 0xB1DACEAD, 0xE33E37F4,
+                0x415CB63A, 0x13B84F63, 0xE4954488, 0xB671BDD1,
+                0x53FF903F, 0x011B6966, 0xF636628D, 0xA4D29BD4,
+                0x06B01A1A, 0x5454E343, 0xA379E8A8, 0xF19D11F1,
+                0xF9608475, 0xAB847D2C, 0x5CA976C7, 0x0E4D8F9E,
+                0xAC2F0E50, 0xFECBF709, 0x09E6FCE2, 0x5B0205BB,
+                0x181DD7EA, 0x4AF92EB3, 0xBDD42558, 0xEF30DC01,
+                0x4D525DCF, 0x1FB6A496, 0xE89BAF7D, 0xBA7F5624,
+                0xB282C3A0, 0xE0663AF9, 0x174B3112, 0x45AFC84B,
+                0xE7CD4985, 0xB529B0DC, 0x4204BB37, 0x10E0426E,
+                0xC43B1F95, 0x96DFE6CC, 0x61F2ED27, 0x3316147E,
+                0x917495B0, 0xC3906CE9, 0x34BD6702, 0x66599E5B,
+                0x6EA40BDF, 0x3C40F286, 0xCB6DF96D, 0x99890034,
+                0x3BEB81FA, 0x690F78A3, 0x9E227348, 0xCCC68A11,
+                0x8FD95840, 0xDD3DA119, 0x2A10AAF2, 0x78F453AB,
+                0xDA96D265, 0x88722B3C, 0x7F5F20D7, 0x2DBBD98E,
+                0x25464C0A, 0x77A2B553, 0x808FBEB8, 0xD26B47E1,
+                0x7009C62F, 0x22ED3F76, 0xD5C0349D, 0x8724CDC4,
+        },
+        [13] = {
+                0x00000000, 0xC555C054, 0x9477EFE9, 0x51222FBD,
+                0x3633B093, 0xF36670C7, 0xA2445F7A, 0x67119F2E,
+                0x6C676126, 0xA932A172, 0xF8108ECF, 0x3D454E9B,
+                0x5A54D1B5, 0x9F0111E1, 0xCE233E5C, 0x0B76FE08,
+                0xD8CEC24C, 0x1D9B0218, 0x4CB92DA5, 0x89ECEDF1,
+                0xEEFD72DF, 0x2BA8B28B, 0x7A8A9D36, 0xBFDF5D62,
+                0xB4A9A36A, 0x71FC633E, 0x20DE4C83, 0xE58B8CD7,
+                0x829A13F9, 0x47CFD3AD, 0x16EDFC10, 0xD3B83C44,
+                0xAF41EBD9, 0x6A142B8D, 0x3B360430, 0xFE63C464,
+                0x99725B4A, 0x5C279B1E, 0x0D05B4A3, 0xC85074F7,
+                0xC3268AFF, 0x06734AAB, 0x57516516, 0x9204A542,
+                0xF5153A6C, 0x3040FA38, 0x6162D585, 0xA43715D1,
+                0x778F2995, 0xB2DAE9C1, 0xE3F8C67C, 0x26AD0628,
+                0x41BC9906, 0x84E95952, 0xD5CB76EF, 0x109EB6BB,
+                0x1BE848B3, 0xDEBD88E7, 0x8F9FA75A, 0x4ACA670E,
+                0x2DDBF820, 0xE88E3874, 0xB9AC17C9, 0x7CF9D79D,
+                0x405FB8F3, 0x850A78A7, 0xD428571A, 0x117D974E,
+                0x766C0860, 0xB339C834, 0xE21BE789, 0x274E27DD,
+                0x2C38D9D5, 0xE96D1981, 0xB84F363C, 0x7D1AF668,
+                0x1A0B6946, 0xDF5EA912, 0x8E7C86AF, 0x4B2946FB,
+                0x98917ABF, 0x5DC4BAEB, 0x0CE69556, 0xC9B35502,
+                0xAEA2CA2C, 0x6BF70A78, 0x3AD525C5, 0xFF80E591,
+                0xF4F61B99, 0x31A3DBCD, 0x6081F470, 0xA5D43424,
+                0xC2C5AB0A, 0x07906B5E, 0x56B244E3, 0x93E784B7,
+                0xEF1E532A, 0x2A4B937E, 0x7B69BCC3, 0xBE3C7C97,
+                0xD92DE3B9, 0x1C7823ED, 0x4D5A0C50, 0x880FCC04,
+                0x8379320C, 0x462CF258, 0x170EDDE5, 0xD25B1DB1,
+                0xB54A829F, 0x701F42CB, 0x213D6D76, 0xE468AD22,
+                0x37D09166, 0xF2855132, 0xA3A77E8F, 0x66F2BEDB,
+                0x01E321F5, 0xC4B6E1A1, 0x9594CE1C, 0x50C10E48,
+                0x5BB7F040, 0x9EE23014, 0xCFC01FA9, 0x0A95DFFD,
+                0x6D8440D3, 0xA8D18087, 0xF9F3AF3A, 0x3CA66F6E,
+                0x80BF71E6, 0x45EAB1B2, 0x14C89E0F, 0xD19D5E5B,
+                0xB68CC175, 0x73D90121, 0x22FB2E9C, 0xE7AEEEC8,
+                0xECD810C0, 0x298DD094, 0x78AFFF29, 0xBDFA3F7D,
+                0xDAEBA053, 0x1FBE6007, 0x4E9C4FBA, 0x8BC98FEE,
+                0x5871B3AA, 0x9D2473FE, 0xCC065C43, 0x09539C17,
+                0x6E420339, 0xAB17C36D, 0xFA35ECD0, 0x3F602C84,
+                0x3416D28C, 0xF14312D8, 0xA0613D65, 0x6534FD31,
+                0x0225621F, 0xC770A24B, 0x96528DF6, 0x53074DA2,
+                0x2FFE9A3F, 0xEAAB5A6B, 0xBB8975D6, 0x7EDCB582,
+                0x19CD2AAC, 0xDC98EAF8, 0x8DBAC545, 0x48EF0511,
+                0x4399FB19, 0x86CC3B4D, 0xD7EE14F0, 0x12BBD4A4,
+                0x75AA4B8A, 0xB0FF8BDE, 0xE1DDA463, 0x24886437,
+                0xF7305873, 0x32659827, 0x6347B79A, 0xA61277CE,
+                0xC103E8E0, 0x045628B4, 0x55740709, 0x9021C75D,
+                0x9B573955, 0x5E02F901, 0x0F20D6BC, 0xCA7516E8,
+                0xAD6489C6, 0x68314992, 0x3913662F, 0xFC46A67B,
+                0xC0E0C915, 0x05B50941, 0x549726FC, 0x91C2E6A8,
+                0xF6D37986, 0x3386B9D2, 0x62A4966F, 0xA7F1563B,
+                0xAC87A833, 0x69D26867, 0x38F047DA, 0xFDA5878E,
+                0x9AB418A0, 0x5FE1D8F4, 0x0EC3F749, 0xCB96371D,
+                0x182E0B59, 0xDD7BCB0D, 0x8C59E4B0, 0x490C24E4,
+                0x2E1DBBCA, 0xEB487B9E, 0xBA6A5423, 0x7F3F9477,
+                0x74496A7F, 0xB11CAA2B, 0xE03E8596, 0x256B45C2,
+                0x427ADAEC, 0x872F1AB8, 0xD60D3505, 0x1358F551,
+                0x6FA122CC, 0xAAF4E298, 0xFBD6CD25, 0x3E830D71,
+                0x5992925F, 0x9CC7520B, 0xCDE57DB6, 0x08B0BDE2,
+                0x03C643EA, 0xC69383BE, 0x97B1AC03, 0x52E46C57,
+                0x35F5F379, 0xF0A0332D, 0xA1821C90, 0x64D7DCC4,
+                0xB76FE080, 0x723A20D4, 0x23180F69, 0xE64DCF3D,
+                0x815C5013, 0x44099047, 0x152BBFFA, 0xD07E7FAE,
+                0xDB0881A6, 0x1E5D41F2, 0x4F7F6E4F, 0x8A2AAE1B,
+                0xED3B3135, 0x286EF161, 0x794CDEDC, 0xBC191E88,
+        },
+        [14] = {
+                0x00000000, 0x1FA28C8D, 0x3F45191A, 0x20E79597,
+                0x7E8A3234, 0x6128BEB9, 0x41CF2B2E, 0x5E6DA7A3,
+                0xFD146468, 0xE2B6E8E5, 0xC2517D72, 0xDDF3F1FF,
+                0x839E565C, 0x9C3CDAD1, 0xBCDB4F46, 0xA379C3CB,
+                0xE4F4A791, 0xFB562B1C, 0xDBB1BE8B, 0xC4133206,
+                0x9A7E95A5, 0x85DC1928, 0xA53B8CBF, 0xBA990032,
+                0x19E0C3F9, 0x06424F74, 0x26A5DAE3, 0x3907566E,
+                0x676AF1CD, 0x78C87D40, 0x582FE8D7, 0x478D645A,
+                0xD7352063, 0xC897ACEE, 0xE8703979, 0xF7D2B5F4,
+                0xA9BF1257, 0xB61D9EDA, 0x96FA0B4D, 0x895887C0,
+                0x2A21440B, 0x3583C886, 0x15645D11, 0x0AC6D19C,
+                0x54AB763F, 0x4B09FAB2, 0x6BEE6F25, 0x744CE3A8,
+                0x33C187F2, 0x2C630B7F, 0x0C849EE8, 0x13261265,
+                0x4D4BB5C6, 0x52E9394B, 0x720EACDC, 0x6DAC2051,
+                0xCED5E39A, 0xD1776F17, 0xF190FA80, 0xEE32760D,
+                0xB05FD1AE, 0xAFFD5D23, 0x8F1AC8B4, 0x90B84439,
+                0xB0B62F87, 0xAF14A30A, 0x8FF3369D, 0x9051BA10,
+                0xCE3C1DB3, 0xD19E913E, 0xF17904A9, 0xEEDB8824,
+                0x4DA24BEF, 0x5200C762, 0x72E752F5, 0x6D45DE78,
+                0x332879DB, 0x2C8AF556, 0x0C6D60C1, 0x13CFEC4C,
+                0x54428816, 0x4BE0049B, 0x6B07910C, 0x74A51D81,
+                0x2AC8BA22, 0x356A36AF, 0x158DA338, 0x0A2F2FB5,
+                0xA956EC7E, 0xB6F460F3, 0x9613F564, 0x89B179E9,
+                0xD7DCDE4A, 0xC87E52C7, 0xE899C750, 0xF73B4BDD,
+                0x67830FE4, 0x78218369, 0x58C616FE, 0x47649A73,
+                0x19093DD0, 0x06ABB15D, 0x264C24CA, 0x39EEA847,
+                0x9A976B8C, 0x8535E701, 0xA5D27296, 0xBA70FE1B,
+                0xE41D59B8, 0xFBBFD535, 0xDB5840A2, 0xC4FACC2F,
+                0x8377A875, 0x9CD524F8, 0xBC32B16F, 0xA3903DE2,
+                0xFDFD9A41, 0xE25F16CC, 0xC2B8835B, 0xDD1A0FD6,
+                0x7E63CC1D, 0x61C14090, 0x4126D507, 0x5E84598A,
+                0x00E9FE29, 0x1F4B72A4, 0x3FACE733, 0x200E6BBE,
+                0x7FB0304F, 0x6012BCC2, 0x40F52955, 0x5F57A5D8,
+                0x013A027B, 0x1E988EF6, 0x3E7F1B61, 0x21DD97EC,
+                0x82A45427, 0x9D06D8AA, 0xBDE14D3D, 0xA243C1B0,
+                0xFC2E6613, 0xE38CEA9E, 0xC36B7F09, 0xDCC9F384,
+                0x9B4497DE, 0x84E61B53, 0xA4018EC4, 0xBBA30249,
+                0xE5CEA5EA, 0xFA6C2967, 0xDA8BBCF0, 0xC529307D,
+                0x6650F3B6, 0x79F27F3B, 0x5915EAAC, 0x46B76621,
+                0x18DAC182, 0x07784D0F, 0x279FD898, 0x383D5415,
+                0xA885102C, 0xB7279CA1, 0x97C00936, 0x886285BB,
+                0xD60F2218, 0xC9ADAE95, 0xE94A3B02, 0xF6E8B78F,
+                0x55917444, 0x4A33F8C9, 0x6AD46D5E, 0x7576E1D3,
+                0x2B1B4670, 0x34B9CAFD, 0x145E5F6A, 0x0BFCD3E7,
+                0x4C71B7BD, 0x53D33B30, 0x7334AEA7, 0x6C96222A,
+                0x32FB8589, 0x2D590904, 0x0DBE9C93, 0x121C101E,
+                0xB165D3D5, 0xAEC75F58, 0x8E20CACF, 0x91824642,
+                0xCFEFE1E1, 0xD04D6D6C, 0xF0AAF8FB, 0xEF087476,
+                0xCF061FC8, 0xD0A49345, 0xF04306D2, 0xEFE18A5F,
+                0xB18C2DFC, 0xAE2EA171, 0x8EC934E6, 0x916BB86B,
+                0x32127BA0, 0x2DB0F72D, 0x0D5762BA, 0x12F5EE37,
+                0x4C984994, 0x533AC519, 0x73DD508E, 0x6C7FDC03,
+                0x2BF2B859, 0x345034D4, 0x14B7A143, 0x0B152DCE,
+                0x55788A6D, 0x4ADA06E0, 0x6A3D9377, 0x759F1FFA,
+                0xD6E6DC31, 0xC94450BC, 0xE9A3C52B, 0xF60149A6,
+                0xA86CEE05, 0xB7CE6288, 0x9729F71F, 0x888B7B92,
+                0x18333FAB, 0x0791B326, 0x277626B1, 0x38D4AA3C,
+                0x66B90D9F, 0x791B8112, 0x59FC1485, 0x465E9808,
+                0xE5275BC3, 0xFA85D74E, 0xDA6242D9, 0xC5C0CE54,
+                0x9BAD69F7, 0x840FE57A, 0xA4E870ED, 0xBB4AFC60,
+                0xFCC7983A, 0xE36514B7, 0xC3828120, 0xDC200DAD,
+                0x824DAA0E, 0x9DEF2683, 0xBD08B314, 0xA2AA3F99,
+                0x01D3FC52, 0x1E7170DF, 0x3E96E548, 0x213469C5,
+                0x7F59CE66, 0x60FB42EB, 0x401CD77C, 0x5FBE5BF1,
+        },
+#endif
+};
+#endif
+
+#if defined(XWLIBCFG_CRC32_0X82F63B78) && (1 == XWLIBCFG_CRC32_0X82F63B78)
+/**
+ * @brief CRC32多项式0x82F63B78的查询表
+ */
+__xwlib_rodata const xwu32_t xwlib_crc32tbl_0x82f63b78[256] = {
+        0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4,
+        0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+        0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B,
+        0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+        0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B,
+        0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+        0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54,
+        0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+        0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A,
+        0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+        0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5,
+        0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+        0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45,
+        0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+        0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A,
+        0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+        0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48,
+        0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+        0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687,
+        0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+        0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927,
+        0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+        0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8,
+        0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+        0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096,
+        0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+        0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859,
+        0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+        0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9,
+        0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+        0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36,
+        0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+        0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C,
+        0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+        0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043,
+        0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+        0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3,
+        0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+        0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C,
+        0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+        0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652,
+        0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+        0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D,
+        0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+        0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D,
+        0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+        0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2,
+        0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+        0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530,
+        0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+        0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF,
+        0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+        0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F,
+        0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+        0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90,
+        0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+        0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE,
+        0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+        0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321,
+        0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+        0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81,
+        0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+        0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E,
+        0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351,
+};
+#endif
+
+#if defined(XWLIBCFG_CRC32_0X82F63B78) && (1 == XWLIBCFG_CRC32_0X82F63B78) && (XWLIB_CRC32_SLICE > 1U)
+/**
+ * @brief CRC32多项式0x82F63B78的分片查询表
+ * @details
+ * 第k行是第k+1个分片的查询表，第0个分片直接使用直驱表。
+ */
+static __xwlib_rodata
+const xwu32_t xwlib_crc32sbtbl_0x82f63b78[XWLIB_CRC32_SLICE - 1U][256] = {
+        [0] = {
+                0x00000000, 0x13A29877, 0x274530EE, 0x34E7A899,
+                0x4E8A61DC, 0x5D28F9AB, 0x69CF5132, 0x7A6DC945,
+                0x9D14C3B8, 0x8EB65BCF, 0xBA51F356, 0xA9F36B21,
+                0xD39EA264, 0xC03C3A13, 0xF4DB928A, 0xE7790AFD,
+                0x3FC5F181, 0x2C6769F6, 0x1880C16F, 0x0B225918,
+                0x714F905D, 0x62ED082A, 0x560AA0B3, 0x45A838C4,
+                0xA2D13239, 0xB173AA4E, 0x859402D7, 0x96369AA0,
+                0xEC5B53E5, 0xFFF9CB92, 0xCB1E630B, 0xD8BCFB7C,
+                0x7F8BE302, 0x6C297B75, 0x58CED3EC, 0x4B6C4B9B,
+                0x310182DE, 0x22A31AA9, 0x1644B230, 0x05E62A47,
+                0xE29F20BA, 0xF13DB8CD, 0xC5DA1054, 0xD6788823,
+                0xAC154166, 0xBFB7D911, 0x8B507188, 0x98F2E9FF,
+                0x404E1283, 0x53EC8AF4, 0x670B226D, 0x74A9BA1A,
+                0x0EC4735F, 0x1D66EB28, 0x298143B1, 0x3A23DBC6,
+                0xDD5AD13B, 0xCEF8494C, 0xFA1FE1D5, 0xE9BD79A2,
+                0x93D0B0E7, 0x80722890, 0xB4958009, 0xA737187E,
+                0xFF17C604, 0xECB55E73, 0xD852F6EA, 0xCBF06E9D,
+                0xB19DA7D8, 0xA23F3FAF, 0x96D89736, 0x857A0F41,
+                0x620305BC, 0x71A19DCB, 0x45463552, 0x56E4AD25,
+                0x2C896460, 0x3F2BFC17, 0x0BCC548E, 0x186ECCF9,
+                0xC0D23785, 0xD370AFF2, 0xE797076B, 0xF4359F1C,
+                0x8E585659, 0x9DFACE2E, 0xA91D66B7, 0xBABFFEC0,
+                0x5DC6F43D, 0x4E646C4A, 0x7A83C4D3, 0x69215CA4,
+                0x134C95E1, 0x00EE0D96, 0x3409A50F, 0x27AB3D78,
+                0x809C2506, 0x933EBD71, 0xA7D915E8, 0xB47B8D9F,
+                0xCE1644DA, 0xDDB4DCAD, 0xE9537434, 0xFAF1EC43,
+                0x1D88E6BE, 0x0E2A7EC9, 0x3ACDD650, 0x296F4E27,
+                0x53028762, 0x40A01F15, 0x7447B78C, 0x67E52FFB,
+                0xBF59D487, 0xACFB4CF0, 0x981CE469, 0x8BBE7C1E,
+                0xF1D3B55B, 0xE2712D2C, 0xD69685B5, 0xC5341DC2,
+                0x224D173F, 0x31EF8F48, 0x050827D1, 0x16AABFA6,
+                0x6CC776E3, 0x7F65EE94, 0x4B82460D, 0x5820DE7A,
+                0xFBC3FAF9, 0xE861628E, 0xDC86CA17, 0xCF245260,
+                0xB5499B25, 0xA6EB0352, 0x920CABCB, 0x81AE33BC,
+                0x66D73941, 0x7575A136, 0x419209AF, 0x523091D8,
+                0x285D589D, 0x3BFFC0EA, 0x0F186873, 0x1CBAF004,
+                0xC4060B78, 0xD7A4930F, 0xE3433B96, 0xF0E1A3E1,
+                0x8A8C6AA4, 0x992EF2D3, 0xADC95A4A, 0xBE6BC23D,
+                0x5912C8C0, 0x4AB050B7, 0x7E57F82E, 0x6DF56059,
+                0x1798A91C, 0x043A316B, 0x30DD99F2, 0x237F0185,
+                0x844819FB, 0x97EA818C, 0xA30D2915, 0xB0AFB162,
+                0xCAC27827, 0xD960E050, 0xED8748C9, 0xFE25D0BE,
+                0x195CDA43, 0x0AFE4234, 0x3E19EAAD, 0x2DBB72DA,
+                0x57D6BB9F, 0x447423E8, 0x70938B71, 0x63311306,
+                0xBB8DE87A, 0xA82F700D, 0x9CC8D894, 0x8F6A40E3,
+                0xF50789A6, 0xE6A511D1, 0xD242B948, 0xC1E0213F,
+                0x26992BC2, 0x353BB3B5, 0x01DC1B2C, 0x127E835B,
+                0x68134A1E, 0x7BB1D269, 0x4F567AF0, 0x5CF4E287,
+                0x04D43CFD, 0x1776A48A, 0x23910C13, 0x30339464,
+                0x4A5E5D21, 0x59FCC556, 0x6D1B6DCF, 0x7EB9F5B8,
+                0x99C0FF45, 0x8A626732, 0xBE85CFAB, 0xAD2757DC,
+                0xD74A9E99, 0xC4E806EE, 0xF00FAE77, 0xE3AD3600,
+                0x3B11CD7C, 0x28B3550B, 0x1C54FD92, 0x0FF665E5,
+                0x759BACA0, 0x663934D7, 0x52DE9C4E, 0x417C0439,
+                0xA6050EC4, 0xB5A796B3, 0x81403E2A, 0x92E2A65D,
+                0xE88F6F18, 0xFB2DF76F, 0xCFCA5FF6, 0xDC68C781,
+                0x7B5FDFFF, 0x68FD4788, 0x5C1AEF11, 0x4FB87766,
+                0x35D5BE23, 0x26772654, 0x12908ECD, 0x013216BA,
+                0xE64B1C47, 0xF5E98430, 0xC10E2CA9, 0xD2ACB4DE,
+                0xA8C17D9B, 0xBB63E5EC, 0x8F844D75, 0x9C26D502,
+                0x449A2E7E, 0x5738B609, 0x63DF1E90, 0x707D86E7,
+                0x0A104FA2, 0x19B2D7D5, 0x2D557F4C, 0x3EF7E73B,
+                0xD98EEDC6, 0xCA2C75B1, 0xFECBDD28, 0xED69455F,
+                0x97048C1A, 0x84A6146D, 0xB041BCF4, 0xA3E32483,
+        },
+        [1] = {
+                0x00000000, 0xA541927E, 0x4F6F520D, 0xEA2EC073,
+                0x9EDEA41A, 0x3B9F3664, 0xD1B1F617, 0x74F06469,
+                0x38513EC5, 0x9D10ACBB, 0x773E6CC8, 0xD27FFEB6,
+                0xA68F9ADF, 0x03CE08A1, 0xE9E0C8D2, 0x4CA15AAC,
+                0x70A27D8A, 0xD5E3EFF4, 0x3FCD2F87, 0x9A8CBDF9,
+                0xEE7CD990, 0x4B3D4BEE, 0xA1138B9D, 0x045219E3,
+                0x48F3434F, 0xEDB2D131, 0x079C1142, 0xA2DD833C,
+                0xD62DE755, 0x736C752B, 0x9942B558, 0x3C032726,
+                0xE144FB14, 0x4405696A, 0xAE2BA919, 0x0B6A3B67,
+                0x7F9A5F0E, 0xDADBCD70, 0x30F50D03, 0x95B49F7D,
+                0xD915C5D1, 0x7C5457AF, 0x967A97DC, 0x333B05A2,
+                0x47CB61CB, 0xE28AF3B5, 0x08A433C6, 0xADE5A1B8,
+                0x91E6869E, 0x34A714E0, 0xDE89D493, 0x7BC846ED,
+                0x0F382284, 0xAA79B0FA, 0x40577089, 0xE516E2F7,
+                0xA9B7B85B, 0x0CF62A25, 0xE6D8EA56, 0x43997828,
+                0x37691C41, 0x92288E3F, 0x78064E4C, 0xDD47DC32,
+                0xC76580D9, 0x622412A7, 0x880AD2D4, 0x2D4B40AA,
+                0x59BB24C3, 0xFCFAB6BD, 0x16D476CE, 0xB395E4B0,
+                0xFF34BE1C, 0x5A752C62, 0xB05BEC11, 0x151A7E6F,
+                0x61EA1A06, 0xC4AB8878, 0x2E85480B, 0x8BC4DA75,
+                0xB7C7FD53, 0x12866F2D, 0xF8A8AF5E, 0x5DE93D20,
+                0x29195949, 0x8C58CB37, 0x66760B44, 0xC337993A,
+                0x8F96C396, 0x2AD751E8, 0xC0F9919B, 0x65B803E5,
+                0x1148678C, 0xB409F5F2, 0x5E273581, 0xFB66A7FF,
+                0x26217BCD, 0x8360E9B3, 0x694E29C0, 0xCC0FBBBE,
+                0xB8FFDFD7, 0x1DBE4DA9, 0xF7908DDA, 0x52D11FA4,
+                0x1E704508, 0xBB31D776, 0x511F1705, 0xF45E857B,
+                0x80AEE112, 0x25EF736C, 0xCFC1B31F, 0x6A802161,
+                0x56830647, 0xF3C29439, 0x19EC544A, 0xBCADC634,
+                0xC85DA25D, 0x6D1C3023, 0x8732F050, 0x2273622E,
+                0x6ED23882, 0xCB93AAFC, 0x21BD6A8F, 0x84FCF8F1,
+                0xF00C9C98, 0x554D0EE6, 0xBF63CE95, 0x1A225CEB,
+                0x8B277743, 0x2E66E53D, 0xC448254E, 0x6109B730,
+                0x15F9D359, 0xB0B84127, 0x5A968154, 0xFFD7132A,
+                0xB3764986, 0x1637DBF8, 0xFC191B8B, 0x595889F5,
+                0x2DA8ED9C, 0x88E97FE2, 0x62C7BF91, 0xC7862DEF,
+                0xFB850AC9, 0x5EC498B7, 0xB4EA58C4, 0x11ABCABA,
+                0x655BAED3, 0xC01A3CAD, 0x2A34FCDE, 0x8F756EA0,
+                0xC3D4340C, 0x6695A672, 0x8CBB6601, 0x29FAF47F,
+                0x5D0A9016, 0xF84B0268, 0x1265C21B, 0xB7245065,
+                0x6A638C57, 0xCF221E29, 0x250CDE5A, 0x804D4C24,
+                0xF4BD284D, 0x51FCBA33, 0xBBD27A40, 0x1E93E83E,
+                0x5232B292, 0xF77320EC, 0x1D5DE09F, 0xB81C72E1,
+                0xCCEC1688, 0x69AD84F6, 0x83834485, 0x26C2D6FB,
+                0x1AC1F1DD, 0xBF8063A3, 0x55AEA3D0, 0xF0EF31AE,
+                0x841F55C7, 0x215EC7B9, 0xCB7007CA, 0x6E3195B4,
+                0x2290CF18, 0x87D15D66, 0x6DFF9D15, 0xC8BE0F6B,
+                0xBC4E6B02, 0x190FF97C, 0xF321390F, 0x5660AB71,
+                0x4C42F79A, 0xE90365E4, 0x032DA597, 0xA66C37E9,
+                0xD29C5380, 0x77DDC1FE, 0x9DF3018D, 0x38B293F3,
+                0x7413C95F, 0xD1525B21, 0x3B7C9B52, 0x9E3D092C,
+                0xEACD6D45, 0x4F8CFF3B, 0xA5A23F48, 0x00E3AD36,
+                0x3CE08A10, 0x99A1186E, 0x738FD81D, 0xD6CE4A63,
+                0xA23E2E0A, 0x077FBC74, 0xED517C07, 0x4810EE79,
+                0x04B1B4D5, 0xA1F026AB, 0x4BDEE6D8, 0xEE9F74A6,
+                0x9A6F10CF, 0x3F2E82B1, 0xD50042C2, 0x7041D0BC,
+                0xAD060C8E, 0x08479EF0, 0xE2695E83, 0x4728CCFD,
+                0x33D8A894, 0x96993AEA, 0x7CB7FA99, 0xD9F668E7,
+                0x9557324B, 0x3016A035, 0xDA386046, 0x7F79F238,
+                0x0B899651, 0xAEC8042F, 0x44E6C45C, 0xE1A75622,
+                0xDDA47104, 0x78E5E37A, 0x92CB2309, 0x378AB177,
+                0x437AD51E, 0xE63B4760, 0x0C158713, 0xA954156D,
+                0xE5F54FC1, 0x40B4DDBF, 0xAA9A1DCC, 0x0FDB8FB2,
+                0x7B2BEBDB, 0xDE6A79A5, 0x3444B9D6, 0x91052BA8,
+        },
+        [2] = {
+                0x00000000, 0xDD45AAB8, 0xBF672381, 0x62228939,
+                0x7B2231F3, 0xA6679B4B, 0xC4451272, 0x1900B8CA,
+                0xF64463E6, 0x2B01C95E, 0x49234067, 0x9466EADF,
+                0x8D665215, 0x5023F8AD, 0x32017194, 0xEF44DB2C,
+                0xE964B13D, 0x34211B85, 0x560392BC, 0x8B463804,
+                0x924680CE, 0x4F032A76, 0x2D21A34F, 0xF06409F7,
+                0x1F20D2DB, 0xC2657863, 0xA047F15A, 0x7D025BE2,
+                0x6402E328, 0xB9474990, 0xDB65C0A9, 0x06206A11,
+                0xD725148B, 0x0A60BE33, 0x6842370A, 0xB5079DB2,
+                0xAC072578, 0x71428FC0, 0x136006F9, 0xCE25AC41,
+                0x2161776D, 0xFC24DDD5, 0x9E0654EC, 0x4343FE54,
+                0x5A43469E, 0x8706EC26, 0xE524651F, 0x3861CFA7,
+                0x3E41A5B6, 0xE3040F0E, 0x81268637, 0x5C632C8F,
+                0x45639445, 0x98263EFD, 0xFA04B7C4, 0x27411D7C,
+                0xC805C650, 0x15406CE8, 0x7762E5D1, 0xAA274F69,
+                0xB327F7A3, 0x6E625D1B, 0x0C40D422, 0xD1057E9A,
+                0xABA65FE7, 0x76E3F55F, 0x14C17C66, 0xC984D6DE,
+                0xD0846E14, 0x0DC1C4AC, 0x6FE34D95, 0xB2A6E72D,
+                0x5DE23C01, 0x80A796B9, 0xE2851F80, 0x3FC0B538,
+                0x26C00DF2, 0xFB85A74A, 0x99A72E73, 0x44E284CB,
+                0x42C2EEDA, 0x9F874462, 0xFDA5CD5B, 0x20E067E3,
+                0x39E0DF29, 0xE4A57591, 0x8687FCA8, 0x5BC25610,
+                0xB4868D3C, 0x69C32784, 0x0BE1AEBD, 0xD6A40405,
+                0xCFA4BCCF, 0x12E11677, 0x70C39F4E, 0xAD8635F6,
+                0x7C834B6C, 0xA1C6E1D4, 0xC3E468ED, 0x1EA1C255,
+                0x07A17A9F, 0xDAE4D027, 0xB8C6591E, 0x6583F3A6,
+                0x8AC7288A, 0x57828232, 0x35A00B0B, 0xE8E5A1B3,
+                0xF1E51979, 0x2CA0B3C1, 0x4E823AF8, 0x93C79040,
+                0x95E7FA51, 0x48A250E9, 0x2A80D9D0, 0xF7C57368,
+                0xEEC5CBA2, 0x3380611A, 0x51A2E823, 0x8CE7429B,
+                0x63A399B7, 0xBEE6330F, 0xDCC4BA36, 0x0181108E,
+                0x1881A844, 0xC5C402FC, 0xA7E68BC5, 0x7AA3217D,
+                0x52A0C93F, 0x8FE56387, 0xEDC7EABE, 0x30824006,
+                0x2982F8CC, 0xF4C75274, 0x96E5DB4D, 0x4BA071F5,
+                0xA4E4AAD9, 0x79A10061, 0x1B838958, 0xC6C623E0,
+                0xDFC69B2A, 0x02833192, 0x60A1B8AB, 0xBDE41213,
+                0xBBC47802, 0x6681D2BA, 0x04A35B83, 0xD9E6F13B,
+                0xC0E649F1, 0x1DA3E349, 0x7F816A70, 0xA2C4C0C8,
+                0x4D801BE4, 0x90C5B15C, 0xF2E73865, 0x2FA292DD,
+                0x36A22A17, 0xEBE780AF, 0x89C50996, 0x5480A32E,
+                0x8585DDB4, 0x58C0770C, 0x3AE2FE35, 0xE7A7548D,
+                0xFEA7EC47, 0x23E246FF, 0x41C0CFC6, 0x9C85657E,
+                0x73C1BE52, 0xAE8414EA, 0xCCA69DD3, 0x11E3376B,
+                0x08E38FA1, 0xD5A62519, 0xB784AC20, 0x6AC10698,
+                0x6CE16C89, 0xB1A4C631, 0xD3864F08, 0x0EC3E5B0,
+                0x17C35D7A, 0xCA86F7C2, 0xA8A47EFB, 0x75E1D443,
+                0x9AA50F6F, 0x47E0A5D7, 0x25C22CEE, 0xF8878656,
+                0xE1873E9C, 0x3CC29424, 0x5EE01D1D, 0x83A5B7A5,
+                0xF90696D8, 0x24433C60, 0x4661B559, 0x9B241FE1,
+                0x8224A72B, 0x5F610D93, 0x3D4384AA, 0xE0062E12,
+                0x0F42F53E, 0xD2075F86, 0xB025D6BF, 0x6D607C07,
+                0x7460C4CD, 0xA9256E75, 0xCB07E74C, 0x16424DF4,
+                0x106227E5, 0xCD278D5D, 0xAF050464, 0x7240AEDC,
+                0x6B401616, 0xB605BCAE, 0xD4273597, 0x09629F2F,
+                0xE6264403, 0x3B63EEBB, 0x59416782, 0x8404CD3A,
+                0x9D0475F0, 0x4041DF48, 0x22635671, 0xFF26FCC9,
+                0x2E238253, 0xF36628EB, 0x9144A1D2, 0x4C010B6A,
+                0x5501B3A0, 0x88441918, 0xEA669021, 0x37233A99,
+                0xD867E1B5, 0x05224B0D, 0x6700C234, 0xBA45688C,
+                0xA345D046, 0x7E007AFE, 0x1C22F3C7, 0xC167597F,
+                0xC747336E, 0x1A0299D6, 0x782010EF, 0xA565BA57,
+                0xBC65029D, 0x6120A825, 0x0302211C, 0xDE478BA4,
+                0x31035088, 0xEC46FA30, 0x8E647309, 0x5321D9B1,
+                0x4A21617B, 0x9764CBC3, 0xF54642FA, 0x2803E842,
+        },
+        [3] = {
+                0x00000000, 0x38116FAC, 0x7022DF58, 0x4833B0F4,
+                0xE045BEB0, 0xD854D11C, 0x906761E8, 0xA8760E44,
+                0xC5670B91, 0xFD76643D, 0xB545D4C9, 0x8D54BB65,
+                0x2522B521, 0x1D33DA8D, 0x55006A79, 0x6D1105D5,
+                0x8F2261D3, 0xB7330E7F, 0xFF00BE8B, 0xC711D127,
+                0x6F67DF63, 0x5776B0CF, 0x1F45003B, 0x27546F97,
+                0x4A456A42, 0x725405EE, 0x3A67B51A, 0x0276DAB6,
+                0xAA00D4F2, 0x9211BB5E, 0xDA220BAA, 0xE2336406,
+                0x1BA8B557, 0x23B9DAFB, 0x6B8A6A0F, 0x539B05A3,
+                0xFBED0BE7, 0xC3FC644B, 0x8BCFD4BF, 0xB3DEBB13,
+                0xDECFBEC6, 0xE6DED16A, 0xAEED619E, 0x96FC0E32,
+                0x3E8A0076, 0x069B6FDA, 0x4EA8DF2E, 0x76B9B082,
+                0x948AD484, 0xAC9BBB28, 0xE4A80BDC, 0xDCB96470,
+                0x74CF6A34, 0x4CDE0598, 0x04EDB56C, 0x3CFCDAC0,
+                0x51EDDF15, 0x69FCB0B9, 0x21CF004D, 0x19DE6FE1,
+                0xB1A861A5, 0x89B90E09, 0xC18ABEFD, 0xF99BD151,
+                0x37516AAE, 0x0F400502, 0x4773B5F6, 0x7F62DA5A,
+                0xD714D41E, 0xEF05BBB2, 0xA7360B46, 0x9F2764EA,
+                0xF236613F, 0xCA270E93, 0x8214BE67, 0xBA05D1CB,
+                0x1273DF8F, 0x2A62B023, 0x625100D7, 0x5A406F7B,
+                0xB8730B7D, 0x806264D1, 0xC851D425, 0xF040BB89,
+                0x5836B5CD, 0x6027DA61, 0x28146A95, 0x10050539,
+                0x7D1400EC, 0x45056F40, 0x0D36DFB4, 0x3527B018,
+                0x9D51BE5C, 0xA540D1F0, 0xED736104, 0xD5620EA8,
+                0x2CF9DFF9, 0x14E8B055, 0x5CDB00A1, 0x64CA6F0D,
+                0xCCBC6149, 0xF4AD0EE5, 0xBC9EBE11, 0x848FD1BD,
+                0xE99ED468, 0xD18FBBC4, 0x99BC0B30, 0xA1AD649C,
+                0x09DB6AD8, 0x31CA0574, 0x79F9B580, 0x41E8DA2C,
+                0xA3DBBE2A, 0x9BCAD186, 0xD3F96172, 0xEBE80EDE,
+                0x439E009A, 0x7B8F6F36, 0x33BCDFC2, 0x0BADB06E,
+                0x66BCB5BB, 0x5EADDA17, 0x169E6AE3, 0x2E8F054F,
+                0x86F90B0B, 0xBEE864A7, 0xF6DBD453, 0xCECABBFF,
+                0x6EA2D55C, 0x56B3BAF0, 0x1E800A04, 0x269165A8,
+                0x8EE76BEC, 0xB6F60440, 0xFEC5B4B4, 0xC6D4DB18,
+                0xABC5DECD, 0x93D4B161, 0xDBE70195, 0xE3F66E39,
+                0x4B80607D, 0x73910FD1, 0x3BA2BF25, 0x03B3D089,
+                0xE180B48F, 0xD991DB23, 0x91A26BD7, 0xA9B3047B,
+                0x01C50A3F, 0x39D46593, 0x71E7D567, 0x49F6BACB,
+                0x24E7BF1E, 0x1CF6D0B2, 0x54C56046, 0x6CD40FEA,
+                0xC4A201AE, 0xFCB36E02, 0xB480DEF6, 0x8C91B15A,
+                0x750A600B, 0x4D1B0FA7, 0x0528BF53, 0x3D39D0FF,
+                0x954FDEBB, 0xAD5EB117, 0xE56D01E3, 0xDD7C6E4F,
+                0xB06D6B9A, 0x887C0436, 0xC04FB4C2, 0xF85EDB6E,
+                0x5028D52A, 0x6839BA86, 0x200A0A72, 0x181B65DE,
+                0xFA2801D8, 0xC2396E74, 0x8A0ADE80, 0xB21BB12C,
+                0x1A6DBF68, 0x227CD0C4, 0x6A4F6030, 0x525E0F9C,
+                0x3F4F0A49, 0x075E65E5, 0x4F6DD511, 0x777CBABD,
+                0xDF0AB4F9, 0xE71BDB55, 0xAF286BA1, 0x9739040D,
+                0x59F3BFF2, 0x61E2D05E, 0x29D160AA, 0x11C00F06,
+                0xB9B60142, 0x81A76EEE, 0xC994DE1A, 0xF185B1B6,
+                0x9C94B463, 0xA485DBCF, 0xECB66B3B, 0xD4A70497,
+                0x7CD10AD3, 0x44C0657F, 0x0CF3D58B, 0x34E2BA27,
+                0xD6D1DE21, 0xEEC0B18D, 0xA6F30179, 0x9EE26ED5,
+                0x36946091, 0x0E850F3D, 0x46B6BFC9, 0x7EA7D065,
+                0x13B6D5B0, 0x2BA7BA1C, 0x63940AE8, 0x5B856544,
+                0xF3F36B00, 0xCBE204AC, 0x83D1B458, 0xBBC0DBF4,
+                0x425B0AA5, 0x7A4A6509, 0x3279D5FD, 0x0A68BA51,
+                0xA21EB415, 0x9A0FDBB9, 0xD23C6B4D, 0xEA2D04E1,
+                0x873C0134, 0xBF2D6E98, 0xF71EDE6C, 0xCF0FB1C0,
+                0x6779BF84, 0x5F68D028, 0x175B60DC, 0x2F4A0F70,
+                0xCD796B76, 0xF56804DA, 0xBD5BB42E, 0x854ADB82,
+                0x2D3CD5C6, 0x152DBA6A, 0x5D1E0A9E, 0x650F6532,
+                0x081E60E7, 0x300F0F4B, 0x783CBFBF, 0x402DD013,
+                0xE85BDE57, 0xD04AB1FB, 0x9879010F, 0xA0686EA3,
+        },
+        [4] = {
+                0x00000000, 0xEF306B19, 0xDB8CA0C3, 0x34BCCBDA,
+                0xB2F53777, 0x5DC55C6E, 0x697997B4, 0x8649FCAD,
+                0x6006181F, 0x8F367306, 0xBB8AB8DC, 0x54BAD3C5,
+                0xD2F32F68, 0x3DC34471, 0x097F8FAB, 0xE64FE4B2,
+                0xC00C303E, 0x2F3C5B27, 0x1B8090FD, 0xF4B0FBE4,
+                0x72F90749, 0x9DC96C50, 0xA975A78A, 0x4645CC93,
+                0xA00A2821, 0x4F3A4338, 0x7B8688E2, 0x94B6E3FB,
+                0x12FF1F56, 0xFDCF744F, 0xC973BF95, 0x2643D48C,
+                0x85F4168D, 0x6AC47D94, 0x5E78B64E, 0xB148DD57,
+                0x370121FA, 0xD8314AE3, 0xEC8D8139, 0x03BDEA20,
+                0xE5F20E92, 0x0AC2658B, 0x3E7EAE51, 0xD14EC548,
+                0x570739E5, 0xB83752FC, 0x8C8B9926, 0x63BBF23F,
+                0x45F826B3, 0xAAC84DAA, 0x9E748670, 0x7144ED69,
+                0xF70D11C4, 0x183D7ADD, 0x2C81B107, 0xC3B1DA1E,
+                0x25FE3EAC, 0xCACE55B5, 0xFE729E6F, 0x1142F576,
+                0x970B09DB, 0x783B62C2, 0x4C87A918, 0xA3B7C201,
+                0x0E045BEB, 0xE13430F2, 0xD588FB28, 0x3AB89031,
+                0xBCF16C9C, 0x53C10785, 0x677DCC5F, 0x884DA746,
+                0x6E0243F4, 0x813228ED, 0xB58EE337, 0x5ABE882E,
+                0xDCF77483, 0x33C71F9A, 0x077BD440, 0xE84BBF59,
+                0xCE086BD5, 0x213800CC, 0x1584CB16, 0xFAB4A00F,
+                0x7CFD5CA2, 0x93CD37BB, 0xA771FC61, 0x48419778,
+                0xAE0E73CA, 0x413E18D3, 0x7582D309, 0x9AB2B810,
+                0x1CFB44BD, 0xF3CB2FA4, 0xC777E47E, 0x28478F67,
+                0x8BF04D66, 0x64C0267F, 0x507CEDA5, 0xBF4C86BC,
+                0x39057A11, 0xD6351108, 0xE289DAD2, 0x0DB9B1CB,
+                0xEBF65579, 0x04C63E60, 0x307AF5BA, 0xDF4A9EA3,
+                0x5903620E, 0xB6330917, 0x828FC2CD, 0x6DBFA9D4,
+                0x4BFC7D58, 0xA4CC1641, 0x9070DD9B, 0x7F40B682,
+                0xF9094A2F, 0x16392136, 0x2285EAEC, 0xCDB581F5,
+                0x2BFA6547, 0xC4CA0E5E, 0xF076C584, 0x1F46AE9D,
+                0x990F5230, 0x763F3929, 0x4283F2F3, 0xADB399EA,
+                0x1C08B7D6, 0xF338DCCF, 0xC7841715, 0x28B47C0C,
+                0xAEFD80A1, 0x41CDEBB8, 0x75712062, 0x9A414B7B,
+                0x7C0EAFC9, 0x933EC4D0, 0xA7820F0A, 0x48B26413,
+                0xCEFB98BE, 0x21CBF3A7, 0x1577387D, 0xFA475364,
+                0xDC0487E8, 0x3334ECF1, 0x0788272B, 0xE8B84C32,
+                0x6EF1B09F, 0x81C1DB86, 0xB57D105C, 0x5A4D7B45,
+                0xBC029FF7, 0x5332F4EE, 0x678E3F34, 0x88BE542D,
+                0x0EF7A880, 0xE1C7C399, 0xD57B0843, 0x3A4B635A,
+                0x99FCA15B, 0x76CCCA42, 0x42700198, 0xAD406A81,
+                0x2B09962C, 0xC439FD35, 0xF08536EF, 0x1FB55DF6,
+                0xF9FAB944, 0x16CAD25D, 0x22761987, 0xCD46729E,
+                0x4B0F8E33, 0xA43FE52A, 0x90832EF0, 0x7FB345E9,
+                0x59F09165, 0xB6C0FA7C, 0x827C31A6, 0x6D4C5ABF,
+                0xEB05A612, 0x0435CD0B, 0x308906D1, 0xDFB96DC8,
+                0x39F6897A, 0xD6C6E263, 0xE27A29B9, 0x0D4A42A0,
+                0x8B03BE0D, 0x6433D514, 0x508F1ECE, 0xBFBF75D7,
+                0x120CEC3D, 0xFD3C8724, 0xC9804CFE, 0x26B027E7,
+                0xA0F9DB4A, 0x4FC9B053, 0x7B757B89, 0x94451090,
+                0x720AF422, 0x9D3A9F3B, 0xA98654E1, 0x46B63FF8,
+                0xC0FFC355, 0x2FCFA84C, 0x1B736396, 0xF443088F,
+                0xD200DC03, 0x3D30B71A, 0x098C7CC0, 0xE6BC17D9,
+                0x60F5EB74, 0x8FC5806D, 0xBB794BB7, 0x544920AE,
+                0xB206C41C, 0x5D36AF05, 0x698A64DF, 0x86BA0FC6,
+                0x00F3F36B, 0xEFC39872, 0xDB7F53A8, 0x344F38B1,
+                0x97F8FAB0, 0x78C891A9, 0x4C745A73, 0xA344316A,
+                0x250DCDC7, 0xCA3DA6DE, 0xFE816D04, 0x11B1061D,
+                0xF7FEE2AF, 0x18CE89B6, 0x2C72426C, 0xC3422975,
+                0x450BD5D8, 0xAA3BBEC1, 0x9E87751B, 0x71B71E02,
+                0x57F4CA8E, 0xB8C4A197, 0x8C786A4D, 0x63480154,
+                0xE501FDF9, 0x0A3196E0, 0x3E8D5D3A, 0xD1BD3623,
+                0x37F2D291, 0xD8C2B988, 0xEC7E7252, 0x034E194B,
+                0x8507E5E6, 0x6A378EFF, 0x5E8B4525, 0xB1BB2E3C,
+        },
+        [5] = {
+                0x00000000, 0x68032CC8, 0xD0065990, 0xB8057558,
+                0xA5E0C5D1, 0xCDE3E919, 0x75E69C41, 0x1DE5B089,
+                0x4E2DFD53, 0x262ED19B, 0x9E2BA4C3, 0xF628880B,
+                0xEBCD3882, 0x83CE144A, 0x3BCB6112, 0x53C84DDA,
+                0x9C5BFAA6, 0xF458D66E, 0x4C5DA336, 0x245E8FFE,
+                0x39BB3F77, 0x51B813BF, 0xE9BD66E7, 0x81BE4A2F,
+                0xD27607F5, 0xBA752B3D, 0x02705E65, 0x6A7372AD,
+                0x7796C224, 0x1F95EEEC, 0xA7909BB4, 0xCF93B77C,
+                0x3D5B83BD, 0x5558AF75, 0xED5DDA2D, 0x855EF6E5,
+                0x98BB466C, 0xF0B86AA4, 0x48BD1FFC, 0x20BE3334,
+                0x73767EEE, 0x1B755226, 0xA370277E, 0xCB730BB6,
+                0xD696BB3F, 0xBE9597F7, 0x0690E2AF, 0x6E93CE67,
+                0xA100791B, 0xC90355D3, 0x7106208B, 0x19050C43,
+                0x04E0BCCA, 0x6CE39002, 0xD4E6E55A, 0xBCE5C992,
+                0xEF2D8448, 0x872EA880, 0x3F2BDDD8, 0x5728F110,
+                0x4ACD4199, 0x22CE6D51, 0x9ACB1809, 0xF2C834C1,
+                0x7AB7077A, 0x12B42BB2, 0xAAB15EEA, 0xC2B27222,
+                0xDF57C2AB, 0xB754EE63, 0x0F519B3B, 0x6752B7F3,
+                0x349AFA29, 0x5C99D6E1, 0xE49CA3B9, 0x8C9F8F71,
+                0x917A3FF8, 0xF9791330, 0x417C6668, 0x297F4AA0,
+                0xE6ECFDDC, 0x8EEFD114, 0x36EAA44C, 0x5EE98884,
+                0x430C380D, 0x2B0F14C5, 0x930A619D, 0xFB094D55,
+                0xA8C1008F, 0xC0C22C47, 0x78C7591F, 0x10C475D7,
+                0x0D21C55E, 0x6522E996, 0xDD279CCE, 0xB524B006,
+                0x47EC84C7, 0x2FEFA80F, 0x97EADD57, 0xFFE9F19F,
+                0xE20C4116, 0x8A0F6DDE, 0x320A1886, 0x5A09344E,
+                0x09C17994, 0x61C2555C, 0xD9C72004, 0xB1C40CCC,
+                0xAC21BC45, 0xC422908D, 0x7C27E5D5, 0x1424C91D,
+                0xDBB77E61, 0xB3B452A9, 0x0BB127F1, 0x63B20B39,
+                0x7E57BBB0, 0x16549778, 0xAE51E220, 0xC652CEE8,
+                0x959A8332, 0xFD99AFFA, 0x459CDAA2, 0x2D9FF66A,
+                0x307A46E3, 0x58796A2B, 0xE07C1F73, 0x887F33BB,
+                0xF56E0EF4, 0x9D6D223C, 0x25685764, 0x4D6B7BAC,
+                0x508ECB25, 0x388DE7ED, 0x808892B5, 0xE88BBE7D,
+                0xBB43F3A7, 0xD340DF6F, 0x6B45AA37, 0x034686FF,
+                0x1EA33676, 0x76A01ABE, 0xCEA56FE6, 0xA6A6432E,
+                0x6935F452, 0x0136D89A, 0xB933ADC2, 0xD130810A,
+                0xCCD53183, 0xA4D61D4B, 0x1CD36813, 0x74D044DB,
+                0x27180901, 0x4F1B25C9, 0xF71E5091, 0x9F1D7C59,
+                0x82F8CCD0, 0xEAFBE018, 0x52FE9540, 0x3AFDB988,
+                0xC8358D49, 0xA036A181, 0x1833D4D9, 0x7030F811,
+                0x6DD54898, 0x05D66450, 0xBDD31108, 0xD5D03DC0,
+                0x8618701A, 0xEE1B5CD2, 0x561E298A, 0x3E1D0542,
+                0x23F8B5CB, 0x4BFB9903, 0xF3FEEC5B, 0x9BFDC093,
+                0x546E77EF, 0x3C6D5B27, 0x84682E7F, 0xEC6B02B7,
+                0xF18EB23E, 0x998D9EF6, 0x2188EBAE, 0x498BC766,
+                0x1A438ABC, 0x7240A674, 0xCA45D32C, 0xA246FFE4,
+                0xBFA34F6D, 0xD7A063A5, 0x6FA516FD, 0x07A63A35,
+                0x8FD9098E, 0xE7DA2546, 0x5FDF501E, 0x37DC7CD6,
+                0x2A39CC5F, 0x423AE097, 0xFA3F95CF, 0x923CB907,
+                0xC1F4F4DD, 0xA9F7D815, 0x11F2AD4D, 0x79F18185,
+                0x6414310C, 0x0C171DC4, 0xB412689C, 0xDC114454,
+                0x1382F328, 0x7B81DFE0, 0xC384AAB8, 0xAB878670,
+                0xB66236F9, 0xDE611A31, 0x66646F69, 0x0E6743A1,
+                0x5DAF0E7B, 0x35AC22B3, 0x8DA957EB, 0xE5AA7B23,
+                0xF84FCBAA, 0x904CE762, 0x2849923A, 0x404ABEF2,
+                0xB2828A33, 0xDA81A6FB, 0x6284D3A3, 0x0A87FF6B,
+                0x17624FE2, 0x7F61632A, 0xC7641672, 0xAF673ABA,
+                0xFCAF7760, 0x94AC5BA8, 0x2CA92EF0, 0x44AA0238,
+                0x594FB2B1, 0x314C9E79, 0x8949EB21, 0xE14AC7E9,
+                0x2ED97095, 0x46DA5C5D, 0xFEDF2905, 0x96DC05CD,
+                0x8B39B544, 0xE33A998C, 0x5B3FECD4, 0x333CC01C,
+                0x60F48DC6, 0x08F7A10E, 0xB0F2D456, 0xD8F1F89E,
+                0xC5144817, 0xAD1764DF, 0x15121187, 0x7D113D4F,
+        },
+        [6] = {
+                0x00000000, 0x493C7D27, 0x9278FA4E, 0xDB448769,
+                0x211D826D, 0x6821FF4A, 0xB3657823, 0xFA590504,
+                0x423B04DA, 0x0B0779FD, 0xD043FE94, 0x997F83B3,
+                0x632686B7, 0x2A1AFB90, 0xF15E7CF9, 0xB86201DE,
+                0x847609B4, 0xCD4A7493, 0x160EF3FA, 0x5F328EDD,
+                0xA56B8BD9, 0xEC57F6FE, 0x37137197, 0x7E2F0CB0,
+                0xC64D0D6E, 0x8F717049, 0x5435F720, 0x1D098A07,
+                0xE7508F03, 0xAE6CF224, 0x7528754D, 0x3C14086A,
+                0x0D006599, 0x443C18BE, 0x9F789FD7, 0xD644E2F0,
+                0x2C1DE7F4, 0x65219AD3, 0xBE651DBA, 0xF759609D,
+                0x4F3B6143, 0x06071C64, 0xDD439B0D, 0x947FE62A,
+                0x6E26E32E, 0x271A9E09, 0xFC5E1960, 0xB5626447,
+                0x89766C2D, 0xC04A110A, 0x1B0E9663, 0x5232EB44,
+                0xA86BEE40, 0xE1579367, 0x3A13140E, 0x732F6929,
+                0xCB4D68F7, 0x827115D0, 0x593592B9, 0x1009EF9E,
+                0xEA50EA9A, 0xA36C97BD, 0x782810D4, 0x31146DF3,
+                0x1A00CB32, 0x533CB615, 0x8878317C, 0xC1444C5B,
+                0x3B1D495F, 0x72213478, 0xA965B311, 0xE059CE36,
+                0x583BCFE8, 0x1107B2CF, 0xCA4335A6, 0x837F4881,
+                0x79264D85, 0x301A30A2, 0xEB5EB7CB, 0xA262CAEC,
+                0x9E76C286, 0xD74ABFA1, 0x0C0E38C8, 0x453245EF,
+                0xBF6B40EB, 0xF6573DCC, 0x2D13BAA5, 0x642FC782,
+                0xDC4DC65C, 0x9571BB7B, 0x4E353C12, 0x07094135,
+                0xFD504431, 0xB46C3916, 0x6F28BE7F, 0x2614C358,
+                0x1700AEAB, 0x5E3CD38C, 0x857854E5, 0xCC4429C2,
+                0x361D2CC6, 0x7F2151E1, 0xA465D688, 0xED59ABAF,
+                0x553BAA71, 0x1C07D756, 0xC743503F, 0x8E7F2D18,
+                0x7426281C, 0x3D1A553B, 0xE65ED252, 0xAF62AF75,
+                0x9376A71F, 0xDA4ADA38, 0x010E5D51, 0x48322076,
+                0xB26B2572, 0xFB575855, 0x2013DF3C, 0x692FA21B,
+                0xD14DA3C5, 0x9871DEE2, 0x4335598B, 0x0A0924AC,
+                0xF05021A8, 0xB96C5C8F, 0x6228DBE6, 0x2B14A6C1,
+                0x34019664, 0x7D3DEB43, 0xA6796C2A, 0xEF45110D,
+                0x151C1409, 0x5C20692E, 0x8764EE47, 0xCE589360,
+                0x763A92BE, 0x3F06EF99, 0xE44268F0, 0xAD7E15D7,
+                0x572710D3, 0x1E1B6DF4, 0xC55FEA9D, 0x8C6397BA,
+                0xB0779FD0, 0xF94BE2F7, 0x220F659E, 0x6B3318B9,
+                0x916A1DBD, 0xD856609A, 0x0312E7F3, 0x4A2E9AD4,
+                0xF24C9B0A, 0xBB70E62D, 0x60346144, 0x29081C63,
+                0xD3511967, 0x9A6D6440, 0x4129E329, 0x08159E0E,
+                0x3901F3FD, 0x703D8EDA, 0xAB7909B3, 0xE2457494,
+                0x181C7190, 0x51200CB7, 0x8A648BDE, 0xC358F6F9,
+                0x7B3AF727, 0x32068A00, 0xE9420D69, 0xA07E704E,
+                0x5A27754A, 0x131B086D, 0xC85F8F04, 0x8163F223,
+                0xBD77FA49, 0xF44B876E, 0x2F0F0007, 0x66337D20,
+                0x9C6A7824, 0xD5560503, 0x0E12826A, 0x472EFF4D,
+                0xFF4CFE93, 0xB67083B4, 0x6D3404DD, 0x240879FA,
+                0xDE517CFE, 0x976D01D9, 0x4C2986B0, 0x0515FB97,
+                0x2E015D56, 0x673D2071, 0xBC79A718, 0xF545DA3F,
+                0x0F1CDF3B, 0x4620A21C, 0x9D642575, 0xD4585852,
+                0x6C3A598C, 0x250624AB, 0xFE42A3C2, 0xB77EDEE5,
+                0x4D27DBE1, 0x041BA6C6, 0xDF5F21AF, 0x96635C88,
+                0xAA7754E2, 0xE34B29C5, 0x380FAEAC, 0x7133D38B,
+                0x8B6AD68F, 0xC256ABA8, 0x19122CC1, 0x502E51E6,
+                0xE84C5038, 0xA1702D1F, 0x7A34AA76, 0x3308D751,
+                0xC951D255, 0x806DAF72, 0x5B29281B, 0x1215553C,
+                0x230138CF, 0x6A3D45E8, 0xB179C281, 0xF845BFA6,
+                0x021CBAA2, 0x4B20C785, 0x906440EC, 0xD9583DCB,
+                0x613A3C15, 0x28064132, 0xF342C65B, 0xBA7EBB7C,
+                0x4027BE78, 0x091BC35F, 0xD25F4436, 0x9B633911,
+                0xA777317B, 0xEE4B4C5C, 0x350FCB35, 0x7C33B612,
+                0x866AB316, 0xCF56CE31, 0x14124958, 0x5D2E347F,
+                0xE54C35A1, 0xAC704886, 0x7734CFEF, 0x3E08B2C8,
+                0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5,
+        },
+#if (XWLIB_CRC32_SLICE > 8U)
+        [7] = {
+                0x00000000, 0xF43ED648, 0xED91DA61, 0x19AF0C29,
+                0xDECFC233, 0x2AF1147B, 0x335E1852, 0xC760CE1A,
+                0xB873F297, 0x4C4D24DF, 0x55E228F6, 0xA1DCFEBE,
+                0x66BC30A4, 0x9282E6EC, 0x8B2DEAC5, 0x7F133C8D,
+                0x750B93DF, 0x81354597, 0x989A49BE, 0x6CA49FF6,
+                0xABC451EC, 0x5FFA87A4, 0x46558B8D, 0xB26B5DC5,
+                0xCD786148, 0x3946B700, 0x20E9BB29, 0xD4D76D61,
+                0x13B7A37B, 0xE7897533, 0xFE26791A, 0x0A18AF52,
+                0xEA1727BE, 0x1E29F1F6, 0x0786FDDF, 0xF3B82B97,
+                0x34D8E58D, 0xC0E633C5, 0xD9493FEC, 0x2D77E9A4,
+                0x5264D529, 0xA65A0361, 0xBFF50F48, 0x4BCBD900,
+                0x8CAB171A, 0x7895C152, 0x613ACD7B, 0x95041B33,
+                0x9F1CB461, 0x6B226229, 0x728D6E00, 0x86B3B848,
+                0x41D37652, 0xB5EDA01A, 0xAC42AC33, 0x587C7A7B,
+                0x276F46F6, 0xD35190BE, 0xCAFE9C97, 0x3EC04ADF,
+                0xF9A084C5, 0x0D9E528D, 0x14315EA4, 0xE00F88EC,
+                0xD1C2398D, 0x25FCEFC5, 0x3C53E3EC, 0xC86D35A4,
+                0x0F0DFBBE, 0xFB332DF6, 0xE29C21DF, 0x16A2F797,
+                0x69B1CB1A, 0x9D8F1D52, 0x8420117B, 0x701EC733,
+                0xB77E0929, 0x4340DF61, 0x5AEFD348, 0xAED10500,
+                0xA4C9AA52, 0x50F77C1A, 0x49587033, 0xBD66A67B,
+                0x7A066861, 0x8E38BE29, 0x9797B200, 0x63A96448,
+                0x1CBA58C5, 0xE8848E8D, 0xF12B82A4, 0x051554EC,
+                0xC2759AF6, 0x364B4CBE, 0x2FE44097, 0xDBDA96DF,
+                0x3BD51E33, 0xCFEBC87B, 0xD644C452, 0x227A121A,
+                0xE51ADC00, 0x11240A48, 0x088B0661, 0xFCB5D029,
+                0x83A6ECA4, 0x77983AEC, 0x6E3736C5, 0x9A09E08D,
+                0x5D692E97, 0xA957F8DF, 0xB0F8F4F6, 0x44C622BE,
+                0x4EDE8DEC, 0xBAE05BA4, 0xA34F578D, 0x577181C5,
+                0x90114FDF, 0x642F9997, 0x7D8095BE, 0x89BE43F6,
+                0xF6AD7F7B, 0x0293A933, 0x1B3CA51A, 0xEF027352,
+                0x2862BD48, 0xDC5C6B00, 0xC5F36729, 0x31CDB161,
+                0xA66805EB, 0x5256D3A3, 0x4BF9DF8A, 0xBFC709C2,
+                0x78A7C7D8, 0x8C991190, 0x95361DB9, 0x6108CBF1,
+                0x1E1BF77C, 0xEA252134, 0xF38A2D1D, 0x07B4FB55,
+                0xC0D4354F, 0x34EAE307, 0x2D45EF2E, 0xD97B3966,
+                0xD3639634, 0x275D407C, 0x3EF24C55, 0xCACC9A1D,
+                0x0DAC5407, 0xF992824F, 0xE03D8E66, 0x1403582E,
+                0x6B1064A3, 0x9F2EB2EB, 0x8681BEC2, 0x72BF688A,
+                0xB5DFA690, 0x41E170D8, 0x584E7CF1, 0xAC70AAB9,
+                0x4C7F2255, 0xB841F41D, 0xA1EEF834, 0x55D02E7C,
+                0x92B0E066, 0x668E362E, 0x7F213A07, 0x8B1FEC4F,
+                0xF40CD0C2, 0x0032068A, 0x199D0AA3, 0xEDA3DCEB,
+                0x2AC312F1, 0xDEFDC4B9, 0xC752C890, 0x336C1ED8,
+                0x3974B18A, 0xCD4A67C2, 0xD4E56BEB, 0x20DBBDA3,
+                0xE7BB73B9, 0x1385A5F1, 0x0A2AA9D8, 0xFE147F90,
+                0x8107431D, 0x75399555, 0x6C96997C, 0x98A84F34,
+                0x5FC8812E, 0xABF65766, 0xB2595B4F, 0x46678D07,
+                0x77AA3C66, 0x8394EA2E, 0x9A3BE607, 0x6E05304F,
+                0xA965FE55, 0x5D5B281D, 0x44F42434, 0xB0CAF27C,
+                0xCFD9CEF1, 0x3BE718B9, 0x22481490, 0xD676C2D8,
+                0x11160CC2, 0xE528DA8A, 0xFC87D6A3, 0x08B900EB,
+                0x02A1AFB9, 0xF69F79F1, 0xEF3075D8, 0x1B0EA390,
+                0xDC6E6D8A, 0x2850BBC2, 0x31FFB7EB, 0xC5C161A3,
+                0xBAD25D2E, 0x4EEC8B66, 0x5743874F, 0xA37D5107,
+                0x641D9F1D, 0x90234955, 0x898C457C, 0x7DB29334,
+                0x9DBD1BD8, 0x6983CD90, 0x702CC1B9, 0x841217F1,
+                0x4372D9EB, 0xB74C0FA3, 0xAEE3038A, 0x5ADDD5C2,
+                0x25CEE94F, 0xD1F03F07, 0xC85F332E, 0x3C61E566,
+                0xFB012B7C, 0x0F3FFD34, 0x1690F11D, 0xE2AE2755,
+                0xE8B68807, 0x1C885E4F, 0x05275266, 0xF119842E,
+                0x36794A34, 0xC2479C7C, 0xDBE89055, 0x2FD6461D,
+                0x50C57A90, 0xA4FBACD8, 0xBD54A0F1, 0x496A76B9,
+                0x8E0AB8A3, 0x7A346EEB, 0x639B62C2, 0x97A5B48A,
+        },
+        [8] = {
+                0x00000000, 0xCB567BA5, 0x934081BB, 0x5816FA1E,
+                0x236D7587, 0xE83B0E22, 0xB02DF43C, 0x7B7B8F99,
+                0x46DAEB0E, 0x8D8C90AB, 0xD59A6AB5, 0x1ECC1110,
+                0x65B79E89, 0xAEE1E52C, 0xF6F71F32, 0x3DA16497,
+                0x8DB5D61C, 0x46E3ADB9, 0x1EF557A7, 0xD5A32C02,
+                0xAED8A39B, 0x658ED83E, 0x3D982220, 0xF6CE5985,
+                0xCB6F3D12, 0x003946B7, 0x582FBCA9, 0x9379C70C,
+                0xE8024895, 0x23543330, 0x7B42C92E, 0xB014B28B,
+                0x1E87DAC9, 0xD5D1A16C, 0x8DC75B72, 0x469120D7,
+                0x3DEAAF4E, 0xF6BCD4EB, 0xAEAA2EF5, 0x65FC5550,
+                0x585D31C7, 0x930B4A62, 0xCB1DB07C, 0x004BCBD9,
+                0x7B304440, 0xB0663FE5, 0xE870C5FB, 0x2326BE5E,
+                0x93320CD5, 0x58647770, 0x00728D6E, 0xCB24F6CB,
+                0xB05F7952, 0x7B0902F7, 0x231FF8E9, 0xE849834C,
+                0xD5E8E7DB, 0x1EBE9C7E, 0x46A86660, 0x8DFE1DC5,
+                0xF685925C, 0x3DD3E9F9, 0x65C513E7, 0xAE936842,
+                0x3D0FB592, 0xF659CE37, 0xAE4F3429, 0x65194F8C,
+                0x1E62C015, 0xD534BBB0, 0x8D2241AE, 0x46743A0B,
+                0x7BD55E9C, 0xB0832539, 0xE895DF27, 0x23C3A482,
+                0x58B82B1B, 0x93EE50BE, 0xCBF8AAA0, 0x00AED105,
+                0xB0BA638E, 0x7BEC182B, 0x23FAE235, 0xE8AC9990,
+                0x93D71609, 0x58816DAC, 0x009797B2, 0xCBC1EC17,
+                0xF6608880, 0x3D36F325, 0x6520093B, 0xAE76729E,
+                0xD50DFD07, 0x1E5B86A2, 0x464D7CBC, 0x8D1B0719,
+                0x23886F5B, 0xE8DE14FE, 0xB0C8EEE0, 0x7B9E9545,
+                0x00E51ADC, 0xCBB36179, 0x93A59B67, 0x58F3E0C2,
+                0x65528455, 0xAE04FFF0, 0xF61205EE, 0x3D447E4B,
+                0x463FF1D2, 0x8D698A77, 0xD57F7069, 0x1E290BCC,
+                0xAE3DB947, 0x656BC2E2, 0x3D7D38FC, 0xF62B4359,
+                0x8D50CCC0, 0x4606B765, 0x1E104D7B, 0xD54636DE,
+                0xE8E75249, 0x23B129EC, 0x7BA7D3F2, 0xB0F1A857,
+                0xCB8A27CE, 0x00DC5C6B, 0x58CAA675, 0x939CDDD0,
+                0x7A1F6B24, 0xB1491081, 0xE95FEA9F, 0x2209913A,
+                0x59721EA3, 0x92246506, 0xCA329F18, 0x0164E4BD,
+                0x3CC5802A, 0xF793FB8F, 0xAF850191, 0x64D37A34,
+                0x1FA8F5AD, 0xD4FE8E08, 0x8CE87416, 0x47BE0FB3,
+                0xF7AABD38, 0x3CFCC69D, 0x64EA3C83, 0xAFBC4726,
+                0xD4C7C8BF, 0x1F91B31A, 0x47874904, 0x8CD132A1,
+                0xB1705636, 0x7A262D93, 0x2230D78D, 0xE966AC28,
+                0x921D23B1, 0x594B5814, 0x015DA20A, 0xCA0BD9AF,
+                0x6498B1ED, 0xAFCECA48, 0xF7D83056, 0x3C8E4BF3,
+                0x47F5C46A, 0x8CA3BFCF, 0xD4B545D1, 0x1FE33E74,
+                0x22425AE3, 0xE9142146, 0xB102DB58, 0x7A54A0FD,
+                0x012F2F64, 0xCA7954C1, 0x926FAEDF, 0x5939D57A,
+                0xE92D67F1, 0x227B1C54, 0x7A6DE64A, 0xB13B9DEF,
+                0xCA401276, 0x011669D3, 0x590093CD, 0x9256E868,
+                0xAFF78CFF, 0x64A1F75A, 0x3CB70D44, 0xF7E176E1,
+                0x8C9AF978, 0x47CC82DD, 0x1FDA78C3, 0xD48C0366,
+                0x4710DEB6, 0x8C46A513, 0xD4505F0D, 0x1F0624A8,
+                0x647DAB31, 0xAF2BD094, 0xF73D2A8A, 0x3C6B512F,
+                0x01CA35B8, 0xCA9C4E1D, 0x928AB403, 0x59DCCFA6,
+                0x22A7403F, 0xE9F13B9A, 0xB1E7C184, 0x7AB1BA21,
+                0xCAA508AA, 0x01F3730F, 0x59E58911, 0x92B3F2B4,
+                0xE9C87D2D, 0x229E0688, 0x7A88FC96, 0xB1DE8733,
+                0x8C7FE3A4, 0x47299801, 0x1F3F621F, 0xD46919BA,
+                0xAF129623, 0x6444ED86, 0x3C521798, 0xF7046C3D,
+                0x5997047F, 0x92C17FDA, 0xCAD785C4, 0x0181FE61,
+                0x7AFA71F8, 0xB1AC0A5D, 0xE9BAF043, 0x22EC8BE6,
+                0x1F4DEF71, 0xD41B94D4, 0x8C0D6ECA, 0x475B156F,
+                0x3C209AF6, 0xF776E153, 0xAF601B4D, 0x643660E8,
+                0xD422D263, 0x1F74A9C6, 0x476253D8, 0x8C34287D,
+                0xF74FA7E4, 0x3C19DC41, 0x640F265F, 0xAF595DFA,
+                0x92F8396D, 0x59AE42C8, 0x01B8B8D6, 0xCAEEC373,
+                0xB1954CEA, 0x7AC3374F, 0x22D5CD51, 0xE983B6F4,
+        },
+        [9] = {
+                0x00000000, 0x9771F7C1, 0x2B0F9973, 0xBC7E6EB2,
+                0x561F32E6, 0xC16EC527, 0x7D10AB95, 0xEA615C54,
+                0xAC3E65CC, 0x3B4F920D, 0x8731FCBF, 0x10400B7E,
+                0xFA21572A, 0x6D50A0EB, 0xD12ECE59, 0x465F3998,
+                0x5D90BD69, 0xCAE14AA8, 0x769F241A, 0xE1EED3DB,
+                0x0B8F8F8F, 0x9CFE784E, 0x208016FC, 0xB7F1E13D,
+                0xF1AED8A5, 0x66DF2F64, 0xDAA141D6, 0x4DD0B617,
+                0xA7B1EA43, 0x30C01D82, 0x8CBE7330, 0x1BCF84F1,
+                0xBB217AD2, 0x2C508D13, 0x902EE3A1, 0x075F1460,
+                0xED3E4834, 0x7A4FBFF5, 0xC631D147, 0x51402686,
+                0x171F1F1E, 0x806EE8DF, 0x3C10866D, 0xAB6171AC,
+                0x41002DF8, 0xD671DA39, 0x6A0FB48B, 0xFD7E434A,
+                0xE6B1C7BB, 0x71C0307A, 0xCDBE5EC8, 0x5ACFA909,
+                0xB0AEF55D, 0x27DF029C, 0x9BA16C2E, 0x0CD09BEF,
+                0x4A8FA277, 0xDDFE55B6, 0x61803B04, 0xF6F1CCC5,
+                0x1C909091, 0x8BE16750, 0x379F09E2, 0xA0EEFE23,
+                0x73AE8355, 0xE4DF7494, 0x58A11A26, 0xCFD0EDE7,
+                0x25B1B1B3, 0xB2C04672, 0x0EBE28C0, 0x99CFDF01,
+                0xDF90E699, 0x48E11158, 0xF49F7FEA, 0x63EE882B,
+                0x898FD47F, 0x1EFE23BE, 0xA2804D0C, 0x35F1BACD,
+                0x2E3E3E3C, 0xB94FC9FD, 0x0531A74F, 0x9240508E,
+                0x78210CDA, 0xEF50FB1B, 0x532E95A9, 0xC45F6268,
+                0x82005BF0, 0x1571AC31, 0xA90FC283, 0x3E7E3542,
+                0xD41F6916, 0x436E9ED7, 0xFF10F065, 0x686107A4,
+                0xC88FF987, 0x5FFE0E46, 0xE38060F4, 0x74F19735,
+                0x9E90CB61, 0x09E13CA0, 0xB59F5212, 0x22EEA5D3,
+                0x64B19C4B, 0xF3C06B8A, 0x4FBE0538, 0xD8CFF2F9,
+                0x32AEAEAD, 0xA5DF596C, 0x19A137DE, 0x8ED0C01F,
+                0x951F44EE, 0x026EB32F, 0xBE10DD9D, 0x29612A5C,
+                0xC3007608, 0x547181C9, 0xE80FEF7B, 0x7F7E18BA,
+                0x39212122, 0xAE50D6E3, 0x122EB851, 0x855F4F90,
+                0x6F3E13C4, 0xF84FE405, 0x44318AB7, 0xD3407D76,
+                0xE75D06AA, 0x702CF16B, 0xCC529FD9, 0x5B236818,
+                0xB142344C, 0x2633C38D, 0x9A4DAD3F, 0x0D3C5AFE,
+                0x4B636366, 0xDC1294A7, 0x606CFA15, 0xF71D0DD4,
+                0x1D7C5180, 0x8A0DA641, 0x3673C8F3, 0xA1023F32,
+                0xBACDBBC3, 0x2DBC4C02, 0x91C222B0, 0x06B3D571,
+                0xECD28925, 0x7BA37EE4, 0xC7DD1056, 0x50ACE797,
+                0x16F3DE0F, 0x818229CE, 0x3DFC477C, 0xAA8DB0BD,
+                0x40ECECE9, 0xD79D1B28, 0x6BE3759A, 0xFC92825B,
+                0x5C7C7C78, 0xCB0D8BB9, 0x7773E50B, 0xE00212CA,
+                0x0A634E9E, 0x9D12B95F, 0x216CD7ED, 0xB61D202C,
+                0xF04219B4, 0x6733EE75, 0xDB4D80C7, 0x4C3C7706,
+                0xA65D2B52, 0x312CDC93, 0x8D52B221, 0x1A2345E0,
+                0x01ECC111, 0x969D36D0, 0x2AE35862, 0xBD92AFA3,
+                0x57F3F3F7, 0xC0820436, 0x7CFC6A84, 0xEB8D9D45,
+                0xADD2A4DD, 0x3AA3531C, 0x86DD3DAE, 0x11ACCA6F,
+                0xFBCD963B, 0x6CBC61FA, 0xD0C20F48, 0x47B3F889,
+                0x94F385FF, 0x0382723E, 0xBFFC1C8C, 0x288DEB4D,
+                0xC2ECB719, 0x559D40D8, 0xE9E32E6A, 0x7E92D9AB,
+                0x38CDE033, 0xAFBC17F2, 0x13C27940, 0x84B38E81,
+                0x6ED2D2D5, 0xF9A32514, 0x45DD4BA6, 0xD2ACBC67,
+                0xC9633896, 0x5E12CF57, 0xE26CA1E5, 0x751D5624,
+                0x9F7C0A70, 0x080DFDB1, 0xB4739303, 0x230264C2,
+                0x655D5D5A, 0xF22CAA9B, 0x4E52C429, 0xD92333E8,
+                0x33426FBC, 0xA433987D, 0x184DF6CF, 0x8F3C010E,
+                0x2FD2FF2D, 0xB8A308EC, 0x04DD665E, 0x93AC919F,
+                0x79CDCDCB, 0xEEBC3A0A, 0x52C254B8, 0xC5B3A379,
+                0x83EC9AE1, 0x149D6D20, 0xA8E30392, 0x3F92F453,
+                0xD5F3A807, 0x42825FC6, 0xFEFC3174, 0x698DC6B5,
+                0x72424244, 0xE533B585, 0x594DDB37, 0xCE3C2CF6,
+                0x245D70A2, 0xB32C8763, 0x0F52E9D1, 0x98231E10,
+                0xDE7C2788, 0x490DD049, 0xF573BEFB, 0x6202493A,
+                0x8863156E, 0x1F12E2AF, 0xA36C8C1D, 0x341D7BDC,
+        },
+        [10] = {
+                0x00000000, 0x3171D430, 0x62E3A860, 0x53927C50,
+                0xC5C750C0, 0xF4B684F0, 0xA724F8A0, 0x96552C90,
+                0x8E62D771, 0xBF130341, 0xEC817F11, 0xDDF0AB21,
+                0x4BA587B1, 0x7AD45381, 0x29462FD1, 0x1837FBE1,
+                0x1929D813, 0x28580C23, 0x7BCA7073, 0x4ABBA443,
+                0xDCEE88D3, 0xED9F5CE3, 0xBE0D20B3, 0x8F7CF483,
+                0x974B0F62, 0xA63ADB52, 0xF5A8A702, 0xC4D97332,
+                0x528C5FA2, 0x63FD8B92, 0x306FF7C2, 0x011E23F2,
+                0x3253B026, 0x03226416, 0x50B01846, 0x61C1CC76,
+                0xF794E0E6, 0xC6E534D6, 0x95774886, 0xA4069CB6,
+                0xBC316757, 0x8D40B367, 0xDED2CF37, 0xEFA31B07,
+                0x79F63797, 0x4887E3A7, 0x1B159FF7, 0x2A644BC7,
+                0x2B7A6835, 0x1A0BBC05, 0x4999C055, 0x78E81465,
+                0xEEBD38F5, 0xDFCCECC5, 0x8C5E9095, 0xBD2F44A5,
+                0xA518BF44, 0x94696B74, 0xC7FB1724, 0xF68AC314,
+                0x60DFEF84, 0x51AE3BB4, 0x023C47E4, 0x334D93D4,
+                0x64A7604C, 0x55D6B47C, 0x0644C82C, 0x37351C1C,
+                0xA160308C, 0x9011E4BC, 0xC38398EC, 0xF2F24CDC,
+                0xEAC5B73D, 0xDBB4630D, 0x88261F5D, 0xB957CB6D,
+                0x2F02E7FD, 0x1E7333CD, 0x4DE14F9D, 0x7C909BAD,
+                0x7D8EB85F, 0x4CFF6C6F, 0x1F6D103F, 0x2E1CC40F,
+                0xB849E89F, 0x89383CAF, 0xDAAA40FF, 0xEBDB94CF,
+                0xF3EC6F2E, 0xC29DBB1E, 0x910FC74E, 0xA07E137E,
+                0x362B3FEE, 0x075AEBDE, 0x54C8978E, 0x65B943BE,
+                0x56F4D06A, 0x6785045A, 0x3417780A, 0x0566AC3A,
+                0x933380AA, 0xA242549A, 0xF1D028CA, 0xC0A1FCFA,
+                0xD896071B, 0xE9E7D32B, 0xBA75AF7B, 0x8B047B4B,
+                0x1D5157DB, 0x2C2083EB, 0x7FB2FFBB, 0x4EC32B8B,
+                0x4FDD0879, 0x7EACDC49, 0x2D3EA019, 0x1C4F7429,
+                0x8A1A58B9, 0xBB6B8C89, 0xE8F9F0D9, 0xD98824E9,
+                0xC1BFDF08, 0xF0CE0B38, 0xA35C7768, 0x922DA358,
+                0x04788FC8, 0x35095BF8, 0x669B27A8, 0x57EAF398,
+                0xC94EC098, 0xF83F14A8, 0xABAD68F8, 0x9ADCBCC8,
+                0x0C899058, 0x3DF84468, 0x6E6A3838, 0x5F1BEC08,
+                0x472C17E9, 0x765DC3D9, 0x25CFBF89, 0x14BE6BB9,
+                0x82EB4729, 0xB39A9319, 0xE008EF49, 0xD1793B79,
+                0xD067188B, 0xE116CCBB, 0xB284B0EB, 0x83F564DB,
+                0x15A0484B, 0x24D19C7B, 0x7743E02B, 0x4632341B,
+                0x5E05CFFA, 0x6F741BCA, 0x3CE6679A, 0x0D97B3AA,
+                0x9BC29F3A, 0xAAB34B0A, 0xF921375A, 0xC850E36A,
+                0xFB1D70BE, 0xCA6CA48E, 0x99FED8DE, 0xA88F0CEE,
+                0x3EDA207E, 0x0FABF44E, 0x5C39881E, 0x6D485C2E,
+                0x757FA7CF, 0x440E73FF, 0x179C0FAF, 0x26EDDB9F,
+                0xB0B8F70F, 0x81C9233F, 0xD25B5F6F, 0xE32A8B5F,
+                0xE234A8AD, 0xD3457C9D, 0x80D700CD, 0xB1A6D4FD,
+                0x27F3F86D, 0x16822C5D, 0x4510500D, 0x7461843D,
+                0x6C567FDC, 0x5D27ABEC, 0x0EB5D7BC, 0x3FC4038C,
+                0xA9912F1C, 0x98E0FB2C, 0xCB72877C, 0xFA03534C,
+                0xADE9A0D4, 0x9C9874E4, 0xCF0A08B4, 0xFE7BDC84,
+                0x682EF014, 0x595F2424, 0x0ACD5874, 0x3BBC8C44,
+                0x238B77A5, 0x12FAA395, 0x4168DFC5, 0x70190BF5,
+                0xE64C2765, 0xD73DF355, 0x84AF8F05, 0xB5DE5B35,
+                0xB4C078C7, 0x85B1ACF7, 0xD623D0A7, 0xE7520497,
+                0x71072807, 0x4076FC37, 0x13E48067, 0x22955457,
+                0x3AA2AFB6, 0x0BD37B86, 0x584107D6, 0x6930D3E6,
+                0xFF65FF76, 0xCE142B46, 0x9D865716, 0xACF78326,
+                0x9FBA10F2, 0xAECBC4C2, 0xFD59B892, 0xCC286CA2,
+                0x5A7D4032, 0x6B0C9402, 0x389EE852, 0x09EF3C62,
+                0x11D8C783, 0x20A913B3, 0x733B6FE3, 0x424ABBD3,
+                0xD41F9743, 0xE56E4373, 0xB6FC3F23, 0x878DEB13,
+                0x8693C8E1, 0xB7E21CD1, 0xE4706081, 0xD501B4B1,
+                0x43549821, 0x72254C11, 0x21B73041, 0x10C6E471,
+                0x08F11F90, 0x3980CBA0, 0x6A12B7F0, 0x5B6363C0,
+                0xCD364F50, 0xFC479B60, 0xAFD5E730, 0x9EA43300,
+        },
+        [11] = {
+                0x00000000, 0x30D23865, 0x61A470CA, 0x517648AF,
+                0xC348E194, 0xF39AD9F1, 0xA2EC915E, 0x923EA93B,
+                0x837DB5D9, 0xB3AF8DBC, 0xE2D9C513, 0xD20BFD76,
+                0x4035544D, 0x70E76C28, 0x21912487, 0x11431CE2,
+                0x03171D43, 0x33C52526, 0x62B36D89, 0x526155EC,
+                0xC05FFCD7, 0xF08DC4B2, 0xA1FB8C1D, 0x9129B478,
+                0x806AA89A, 0xB0B890FF, 0xE1CED850, 0xD11CE035,
+                0x4322490E, 0x73F0716B, 0x228639C4, 0x125401A1,
+                0x062E3A86, 0x36FC02E3, 0x678A4A4C, 0x57587229,
+                0xC566DB12, 0xF5B4E377, 0xA4C2ABD8, 0x941093BD,
+                0x85538F5F, 0xB581B73A, 0xE4F7FF95, 0xD425C7F0,
+                0x461B6ECB, 0x76C956AE, 0x27BF1E01, 0x176D2664,
+                0x053927C5, 0x35EB1FA0, 0x649D570F, 0x544F6F6A,
+                0xC671C651, 0xF6A3FE34, 0xA7D5B69B, 0x97078EFE,
+                0x8644921C, 0xB696AA79, 0xE7E0E2D6, 0xD732DAB3,
+                0x450C7388, 0x75DE4BED, 0x24A80342, 0x147A3B27,
+                0x0C5C750C, 0x3C8E4D69, 0x6DF805C6, 0x5D2A3DA3,
+                0xCF149498, 0xFFC6ACFD, 0xAEB0E452, 0x9E62DC37,
+                0x8F21C0D5, 0xBFF3F8B0, 0xEE85B01F, 0xDE57887A,
+                0x4C692141, 0x7CBB1924, 0x2DCD518B, 0x1D1F69EE,
+                0x0F4B684F, 0x3F99502A, 0x6EEF1885, 0x5E3D20E0,
+                0xCC0389DB, 0xFCD1B1BE, 0xADA7F911, 0x9D75C174,
+                0x8C36DD96, 0xBCE4E5F3, 0xED92AD5C, 0xDD409539,
+                0x4F7E3C02, 0x7FAC0467, 0x2EDA4CC8, 0x1E0874AD,
+                0x0A724F8A, 0x3AA077EF, 0x6BD63F40, 0x5B040725,
+                0xC93AAE1E, 0xF9E8967B, 0xA89EDED4, 0x984CE6B1,
+                0x890FFA53, 0xB9DDC236, 0xE8AB8A99, 0xD879B2FC,
+                0x4A471BC7, 0x7A9523A2, 0x2BE36B0D, 0x1B315368,
+                0x096552C9, 0x39B76AAC, 0x68C12203, 0x58131A66,
+                0xCA2DB35D, 0xFAFF8B38, 0xAB89C397, 0x9B5BFBF2,
+                0x8A18E710, 0xBACADF75, 0xEBBC97DA, 0xDB6EAFBF,
+                0x49500684, 0x79823EE1, 0x28F4764E, 0x18264E2B,
+                0x18B8EA18, 0x286AD27D, 0x791C9AD2, 0x49CEA2B7,
+                0xDBF00B8C, 0xEB2233E9, 0xBA547B46, 0x8A864323,
+                0x9BC55FC1, 0xAB1767A4, 0xFA612F0B, 0xCAB3176E,
+                0x588DBE55, 0x685F8630, 0x3929CE9F, 0x09FBF6FA,
+                0x1BAFF75B, 0x2B7DCF3E, 0x7A0B8791, 0x4AD9BFF4,
+                0xD8E716CF, 0xE8352EAA, 0xB9436605, 0x89915E60,
+                0x98D24282, 0xA8007AE7, 0xF9763248, 0xC9A40A2D,
+                0x5B9AA316, 0x6B489B73, 0x3A3ED3DC, 0x0AECEBB9,
+                0x1E96D09E, 0x2E44E8FB, 0x7F32A054, 0x4FE09831,
+                0xDDDE310A, 0xED0C096F, 0xBC7A41C0, 0x8CA879A5,
+                0x9DEB6547, 0xAD395D22, 0xFC4F158D, 0xCC9D2DE8,
+                0x5EA384D3, 0x6E71BCB6, 0x3F07F419, 0x0FD5CC7C,
+                0x1D81CDDD, 0x2D53F5B8, 0x7C25BD17, 0x4CF78572,
+                0xDEC92C49, 0xEE1B142C, 0xBF6D5C83, 0x8FBF64E6,
+                0x9EFC7804, 0xAE2E4061, 0xFF5808CE, 0xCF8A30AB,
+                0x5DB49990, 0x6D66A1F5, 0x3C10E95A, 0x0CC2D13F,
+                0x14E49F14, 0x2436A771, 0x7540EFDE, 0x4592D7BB,
+                0xD7AC7E80, 0xE77E46E5, 0xB6080E4A, 0x86DA362F,
+                0x97992ACD, 0xA74B12A8, 0xF63D5A07, 0xC6EF6262,
+                0x54D1CB59, 0x6403F33C, 0x3575BB93, 0x05A783F6,
+                0x17F38257, 0x2721BA32, 0x7657F29D, 0x4685CAF8,
+                0xD4BB63C3, 0xE4695BA6, 0xB51F1309, 0x85CD2B6C,
+                0x948E378E, 0xA45C0FEB, 0xF52A4744, 0xC5F87F21,
+                0x57C6D61A, 0x6714EE7F, 0x3662A6D0, 0x06B09EB5,
+                0x12CAA592, 0x22189DF7, 0x736ED558, 0x43BCED3D,
+                0xD1824406, 0xE1507C63, 0xB02634CC, 0x80F40CA9,
+                0x91B7104B, 0xA165282E, 0xF0136081, 0xC0C158E4,
+                0x52FFF1DF, 0x622DC9BA, 0x335B8115, 0x0389B970,
+                0x11DDB8D1, 0x210F80B4, 0x7079C81B, 0x40ABF07E,
+                0xD2955945, 0xE2476120, 0xB331298F, 0x83E311EA,
+                0x92A00D08, 0xA272356D, 0xF3047DC2, 0xC3D645A7,
+                0x51E8EC9C, 0x613AD4F9, 0x304C9C56, 0x009EA433,
+        },
+        [12] = {
+                0x00000000, 0x54075546, 0xA80EAA8C, 0xFC09FFCA,
+                0x55F123E9, 0x01F676AF, 0xFDFF8965, 0xA9F8DC23,
+                0xABE247D2, 0xFFE51294, 0x03ECED5E, 0x57EBB818,
+                0xFE13643B, 0xAA14317D, 0x561DCEB7, 0x021A9BF1,
+                0x5228F955, 0x062FAC13, 0xFA2653D9, 0xAE21069F,
+                0x07D9DABC, 0x53DE8FFA, 0xAFD77030, 0xFBD02576,
+                0xF9CABE87, 0xADCDEBC1, 0x51C4140B, 0x05C3414D,
+                0xAC3B9D6E, 0xF83CC828, 0x043537E2, 0x503262A4,
+                0xA451F2AA, 0xF056A7EC, 0x0C5F5826, 0x58580D60,
+                0xF1A0D143, 0xA5A78405, 0x59AE7BCF, 0x0DA92E89,
+                0x0FB3B578, 0x5BB4E03E, 0xA7BD1FF4, 0xF3BA4AB2,
+                0x5A429691, 0x0E45C3D7, 0xF24C3C1D, 0xA64B695B,
+                0xF6790BFF, 0xA27E5EB9, 0x5E77A173, 0x0A70F435,
+                0xA3882816, 0xF78F7D50, 0x0B86829A, 0x5F81D7DC,
+                0x5D9B4C2D, 0x099C196B, 0xF595E6A1, 0xA192B3E7,
+                0x086A6FC4, 0x5C6D3A82, 0xA064C548, 0xF463900E,
+                0x4D4F93A5, 0x1948C6E3, 0xE5413929, 0xB1466C6F,
+                0x18BEB04C, 0x4CB9E50A, 0xB0B01AC0, 0xE4B74F86,
+                0xE6ADD477, 0xB2AA8131, 0x4EA37EFB, 0x1AA42BBD,
+                0xB35CF79E, 0xE75BA2D8, 0x1B525D12, 0x4F550854,
+                0x1F676AF0, 0x4B603FB6, 0xB769C07C, 0xE36E953A,
+                0x4A964919, 0x1E911C5F, 0xE298E395, 0xB69FB6D3,
+                0xB4852D22, 0xE0827864, 0x1C8B87AE, 0x488CD2E8,
+                0xE1740ECB, 0xB5735B8D, 0x497AA447, 0x1D7DF101,
+                0xE91E610F, 0xBD193449, 0x4110CB83, 0x15179EC5,
+                0xBCEF42E6, 0xE8E817A0, 0x14E1E86A, 0x40E6BD2C,
+                0x42FC26DD, 0x16FB739B, 0xEAF28C51, 0xBEF5D917,
+                0x170D0534, 0x430A5072, 0xBF03AFB8, 0xEB04FAFE,
+                0xBB36985A, 0xEF31CD1C, 0x133832D6, 0x473F6790,
+                0xEEC7BBB3, 0xBAC0EEF5, 0x46C9113F, 0x12CE4479,
+                0x10D4DF88, 0x44D38ACE, 0xB8DA7504, 0xECDD2042,
+                0x4525FC61, 0x1122A927, 0xED2B56ED, 0xB92C03AB,
+                0x9A9F274A, 0xCE98720C, 0x32918DC6, 0x6696D880,
+                0xCF6E04A3, 0x9B6951E5, 0x6760AE2F, 0x3367FB69,
+                0x317D6098, 0x657A35DE, 0x9973CA14, 0xCD749F52,
+                0x648C4371, 0x308B1637, 0xCC82E9FD, 0x9885BCBB,
+                0xC8B7DE1F, 0x9CB08B59, 0x60B97493, 0x34BE21D5,
+                0x9D46FDF6, 0xC941A8B0, 0x3548577A, 0x614F023C,
+                0x635599CD, 0x3752CC8B, 0xCB5B3341, 0x9F5C6607,
+                0x36A4BA24, 0x62A3EF62, 0x9EAA10A8, 0xCAAD45EE,
+                0x3ECED5E0, 0x6AC980A6, 0x96C07F6C, 0xC2C72A2A,
+                0x6B3FF609, 0x3F38A34F, 0xC3315C85, 0x973609C3,
+                0x952C9232, 0xC12BC774, 0x3D2238BE, 0x69256DF8,
+                0xC0DDB1DB, 0x94DAE49D, 0x68D31B57, 0x3CD44E11,
+                0x6CE62CB5, 0x38E179F3, 0xC4E88639, 0x90EFD37F,
+                0x39170F5C, 0x6D105A1A, 0x9119A5D0, 0xC51EF096,
+                0xC7046B67, 0x93033E21, 0x6F0AC1EB, 0x3B0D94AD,
+                0x92F5488E, 0xC6F21DC8, 0x3AFBE202, 0x6EFCB744,
+                0xD7D0B4EF, 0x83D7E1A9, 0x7FDE1E63, 0x2BD94B25,
+                0x82219706, 0xD626C240, 0x2A2F3D8A, 0x7E2868CC,
+                0x7C32F33D, 0x2835A67B, 0xD43C59B1, 0x803B0CF7,
+                0x29C3D0D4, 0x7DC48592, 0x81CD7A58, 0xD5CA2F1E,
+                0x85F84DBA, 0xD1FF18FC, 0x2DF6E736, 0x79F1B270,
+                0xD0096E53, 0x840E3B15, 0x7807C4DF, 0x2C009199,
+                0x2E1A0A68, 0x7A1D5F2E, 0x8614A0E4, 0xD213F5A2,
+                0x7BEB2981, 0x2FEC7CC7, 0xD3E5830D, 0x87E2D64B,
+                0x73814645, 0x27861303, 0xDB8FECC9, 0x8F88B98F,
+                0x267065AC, 0x727730EA, 0x8E7ECF20, 0xDA799A66,
+                0xD8630197, 0x8C6454D1, 0x706DAB1B, 0x246AFE5D,
+                0x8D92227E, 0xD9957738, 0x259C88F2, 0x719BDDB4,
+                0x21A9BF10, 0x75AEEA56, 0x89A7159C, 0xDDA040DA,
+                0x74589CF9, 0x205FC9BF, 0xDC563675, 0x88516333,
+                0x8A4BF8C2, 0xDE4CAD84, 0x2245524E, 0x76420708,
+                0xDFBADB2B, 0x8BBD8E6D, 0x77B471A7, 0x23B324E1,
+        },
+        [13] = {
+                0x00000000, 0x678EFD01, 0xCF1DFA02, 0xA8930703,
+                0x9BD782F5, 0xFC597FF4, 0x54CA78F7, 0x334485F6,
+                0x3243731B, 0x55CD8E1A, 0xFD5E8919, 0x9AD07418,
+                0xA994F1EE, 0xCE1A0CEF, 0x66890BEC, 0x0107F6ED,
+                0x6486E636, 0x03081B37, 0xAB9B1C34, 0xCC15E135,
+                0xFF5164C3, 0x98DF99C2, 0x304C9EC1, 0x57C263C0,
+                0x56C5952D, 0x314B682C, 0x99D86F2F, 0xFE56922E,
+                0xCD1217D8, 0xAA9CEAD9, 0x020FEDDA, 0x658110DB,
+                0xC90DCC6C, 0xAE83316D, 0x0610366E, 0x619ECB6F,
+                0x52DA4E99, 0x3554B398, 0x9DC7B49B, 0xFA49499A,
+                0xFB4EBF77, 0x9CC04276, 0x34534575, 0x53DDB874,
+                0x60993D82, 0x0717C083, 0xAF84C780, 0xC80A3A81,
+                0xAD8B2A5A, 0xCA05D75B, 0x6296D058, 0x05182D59,
+                0x365CA8AF, 0x51D255AE, 0xF94152AD, 0x9ECFAFAC,
+                0x9FC85941, 0xF846A440, 0x50D5A343, 0x375B5E42,
+                0x041FDBB4, 0x639126B5, 0xCB0221B6, 0xAC8CDCB7,
+                0x97F7EE29, 0xF0791328, 0x58EA142B, 0x3F64E92A,
+                0x0C206CDC, 0x6BAE91DD, 0xC33D96DE, 0xA4B36BDF,
+                0xA5B49D32, 0xC23A6033, 0x6AA96730, 0x0D279A31,
+                0x3E631FC7, 0x59EDE2C6, 0xF17EE5C5, 0x96F018C4,
+                0xF371081F, 0x94FFF51E, 0x3C6CF21D, 0x5BE20F1C,
+                0x68A68AEA, 0x0F2877EB, 0xA7BB70E8, 0xC0358DE9,
+                0xC1327B04, 0xA6BC8605, 0x0E2F8106, 0x69A17C07,
+                0x5AE5F9F1, 0x3D6B04F0, 0x95F803F3, 0xF276FEF2,
+                0x5EFA2245, 0x3974DF44, 0x91E7D847, 0xF6692546,
+                0xC52DA0B0, 0xA2A35DB1, 0x0A305AB2, 0x6DBEA7B3,
+                0x6CB9515E, 0x0B37AC5F, 0xA3A4AB5C, 0xC42A565D,
+                0xF76ED3AB, 0x90E02EAA, 0x387329A9, 0x5FFDD4A8,
+                0x3A7CC473, 0x5DF23972, 0xF5613E71, 0x92EFC370,
+                0xA1AB4686, 0xC625BB87, 0x6EB6BC84, 0x09384185,
+                0x083FB768, 0x6FB14A69, 0xC7224D6A, 0xA0ACB06B,
+                0x93E8359D, 0xF466C89C, 0x5CF5CF9F, 0x3B7B329E,
+                0x2A03AAA3, 0x4D8D57A2, 0xE51E50A1, 0x8290ADA0,
+                0xB1D42856, 0xD65AD557, 0x7EC9D254, 0x19472F55,
+                0x1840D9B8, 0x7FCE24B9, 0xD75D23BA, 0xB0D3DEBB,
+                0x83975B4D, 0xE419A64C, 0x4C8AA14F, 0x2B045C4E,
+                0x4E854C95, 0x290BB194, 0x8198B697, 0xE6164B96,
+                0xD552CE60, 0xB2DC3361, 0x1A4F3462, 0x7DC1C963,
+                0x7CC63F8E, 0x1B48C28F, 0xB3DBC58C, 0xD455388D,
+                0xE711BD7B, 0x809F407A, 0x280C4779, 0x4F82BA78,
+                0xE30E66CF, 0x84809BCE, 0x2C139CCD, 0x4B9D61CC,
+                0x78D9E43A, 0x1F57193B, 0xB7C41E38, 0xD04AE339,
+                0xD14D15D4, 0xB6C3E8D5, 0x1E50EFD6, 0x79DE12D7,
+                0x4A9A9721, 0x2D146A20, 0x85876D23, 0xE2099022,
+                0x878880F9, 0xE0067DF8, 0x48957AFB, 0x2F1B87FA,
+                0x1C5F020C, 0x7BD1FF0D, 0xD342F80E, 0xB4CC050F,
+                0xB5CBF3E2, 0xD2450EE3, 0x7AD609E0, 0x1D58F4E1,
+                0x2E1C7117, 0x49928C16, 0xE1018B15, 0x868F7614,
+                0xBDF4448A, 0xDA7AB98B, 0x72E9BE88, 0x15674389,
+                0x2623C67F, 0x41AD3B7E, 0xE93E3C7D, 0x8EB0C17C,
+                0x8FB73791, 0xE839CA90, 0x40AACD93, 0x27243092,
+                0x1460B564, 0x73EE4865, 0xDB7D4F66, 0xBCF3B267,
+                0xD972A2BC, 0xBEFC5FBD, 0x166F58BE, 0x71E1A5BF,
+                0x42A52049, 0x252BDD48, 0x8DB8DA4B, 0xEA36274A,
+                0xEB31D1A7, 0x8CBF2CA6, 0x242C2BA5, 0x43A2D6A4,
+                0x70E65352, 0x1768AE53, 0xBFFBA950, 0xD8755451,
+                0x74F988E6, 0x137775E7, 0xBBE472E4, 0xDC6A8FE5,
+                0xEF2E0A13, 0x88A0F712, 0x2033F011, 0x47BD0D10,
+                0x46BAFBFD, 0x213406FC, 0x89A701FF, 0xEE29FCFE,
+                0xDD6D7908, 0xBAE38409, 0x1270830A, 0x75FE7E0B,
+                0x107F6ED0, 0x77F193D1, 0xDF6294D2, 0xB8EC69D3,
+                0x8BA8EC25, 0xEC261124, 0x44B51627, 0x233BEB26,
+                0x223C1DCB, 0x45B2E0CA, 0xED21E7C9, 0x8AAF1AC8,
+                0xB9EB9F3E, 0xDE65623F, 0x76F6653C, 0x1178983D,
+        },
+        [14] = {
+                0x00000000, 0xF20C0DFE, 0xE1F46D0D, 0x13F860F3,
+                0xC604ACEB, 0x3408A115, 0x27F0C1E6, 0xD5FCCC18,
+                0x89E52F27, 0x7BE922D9, 0x6811422A, 0x9A1D4FD4,
+                0x4FE183CC, 0xBDED8E32, 0xAE15EEC1, 0x5C19E33F,
+                0x162628BF, 0xE42A2541, 0xF7D245B2, 0x05DE484C,
+                0xD0228454, 0x222E89AA, 0x31D6E959, 0xC3DAE4A7,
+                0x9FC30798, 0x6DCF0A66, 0x7E376A95, 0x8C3B676B,
+                0x59C7AB73, 0xABCBA68D, 0xB833C67E, 0x4A3FCB80,
+                0x2C4C517E, 0xDE405C80, 0xCDB83C73, 0x3FB4318D,
+                0xEA48FD95, 0x1844F06B, 0x0BBC9098, 0xF9B09D66,
+                0xA5A97E59, 0x57A573A7, 0x445D1354, 0xB6511EAA,
+                0x63ADD2B2, 0x91A1DF4C, 0x8259BFBF, 0x7055B241,
+                0x3A6A79C1, 0xC866743F, 0xDB9E14CC, 0x29921932,
+                0xFC6ED52A, 0x0E62D8D4, 0x1D9AB827, 0xEF96B5D9,
+                0xB38F56E6, 0x41835B18, 0x527B3BEB, 0xA0773615,
+                0x758BFA0D, 0x8787F7F3, 0x947F9700, 0x66739AFE,
+                0x5898A2FC, 0xAA94AF02, 0xB96CCFF1, 0x4B60C20F,
+                0x9E9C0E17, 0x6C9003E9, 0x7F68631A, 0x8D646EE4,
+                0xD17D8DDB, 0x23718025, 0x3089E0D6, 0xC285ED28,
+                0x17792130, 0xE5752CCE, 0xF68D4C3D, 0x048141C3,
+                0x4EBE8A43, 0xBCB287BD, 0xAF4AE74E, 0x5D46EAB0,
+                0x88BA26A8, 0x7AB62B56, 0x694E4BA5, 0x9B42465B,
+                0xC75BA564, 0x3557A89A, 0x26AFC869, 0xD4A3C597,
+                0x015F098F, 0xF3530471, 0xE0AB6482, 0x12A7697C,
+                0x74D4F382, 0x86D8FE7C, 0x95209E8F, 0x672C9371,
+                0xB2D05F69, 0x40DC5297, 0x53243264, 0xA1283F9A,
+                0xFD31DCA5, 0x0F3DD15B, 0x1CC5B1A8, 0xEEC9BC56,
+                0x3B35704E, 0xC9397DB0, 0xDAC11D43, 0x28CD10BD,
+                0x62F2DB3D, 0x90FED6C3, 0x8306B630, 0x710ABBCE,
+                0xA4F677D6, 0x56FA7A28, 0x45021ADB, 0xB70E1725,
+                0xEB17F41A, 0x191BF9E4, 0x0AE39917, 0xF8EF94E9,
+                0x2D1358F1, 0xDF1F550F, 0xCCE735FC, 0x3EEB3802,
+                0xB13145F8, 0x433D4806, 0x50C528F5, 0xA2C9250B,
+                0x7735E913, 0x8539E4ED, 0x96C1841E, 0x64CD89E0,
+                0x38D46ADF, 0xCAD86721, 0xD92007D2, 0x2B2C0A2C,
+                0xFED0C634, 0x0CDCCBCA, 0x1F24AB39, 0xED28A6C7,
+                0xA7176D47, 0x551B60B9, 0x46E3004A, 0xB4EF0DB4,
+                0x6113C1AC, 0x931FCC52, 0x80E7ACA1, 0x72EBA15F,
+                0x2EF24260, 0xDCFE4F9E, 0xCF062F6D, 0x3D0A2293,
+                0xE8F6EE8B, 0x1AFAE375, 0x09028386, 0xFB0E8E78,
+                0x9D7D1486, 0x6F711978, 0x7C89798B, 0x8E857475,
+                0x5B79B86D, 0xA975B593, 0xBA8DD560, 0x4881D89E,
+                0x14983BA1, 0xE694365F, 0xF56C56AC, 0x07605B52,
+                0xD29C974A, 0x20909AB4, 0x3368FA47, 0xC164F7B9,
+                0x8B5B3C39, 0x795731C7, 0x6AAF5134, 0x98A35CCA,
+                0x4D5F90D2, 0xBF539D2C, 0xACABFDDF, 0x5EA7F021,
+                0x02BE131E, 0xF0B21EE0, 0xE34A7E13, 0x114673ED,
+                0xC4BABFF5, 0x36B6B20B, 0x254ED2F8, 0xD742DF06,
+                0xE9A9E704, 0x1BA5EAFA, 0x085D8A09, 0xFA5187F7,
+                0x2FAD4BEF, 0xDDA14611, 0xCE5926E2, 0x3C552B1C,
+                0x604CC823, 0x9240C5DD, 0x81B8A52E, 0x73B4A8D0,
+                0xA64864C8, 0x54446936, 0x47BC09C5, 0xB5B0043B,
+                0xFF8FCFBB, 0x0D83C245, 0x1E7BA2B6, 0xEC77AF48,
+                0x398B6350, 0xCB876EAE, 0xD87F0E5D, 0x2A7303A3,
+                0x766AE09C, 0x8466ED62, 0x979E8D91, 0x6592806F,
+                0xB06E4C77, 0x42624189, 0x519A217A, 0xA3962C84,
+                0xC5E5B67A, 0x37E9BB84, 0x2411DB77, 0xD61DD689,
+                0x03E11A91, 0xF1ED176F, 0xE215779C, 0x10197A62,
+                0x4C00995D, 0xBE0C94A3, 0xADF4F450, 0x5FF8F9AE,
+                0x8A0435B6, 0x78083848, 0x6BF058BB, 0x99FC5545,
+                0xD3C39EC5, 0x21CF933B, 0x3237F3C8, 0xC03BFE36,
+                0x15C7322E, 0xE7CB3FD0, 0xF4335F23, 0x063F52DD,
+                0x5A26B1E2, 0xA82ABC1C, 0xBBD2DCEF, 0x49DED111,
+                0x9C221D09, 0x6E2E10F7, 0x7DD67004, 0x8FDA7DFA,
+        },
+#endif
+};
+#endif
+
 #if defined(SOCCFG_CRC32) && (1 == SOCCFG_CRC32)
 extern
 xwer_t soc_crc32_cal(xwu32_t * crc32,
@@ -551,14 +4715,25 @@ xwer_t soc_crc32_cal(xwu32_t * crc32,
 #  define soc_crc32_cal(crc32, refin, plynml, direction, stream, size) (-EOPNOTSUPP)
 #endif
 
+#if defined(ARCHCFG_LIB_CRC32) && (1 == ARCHCFG_LIB_CRC32)
+extern
+xwer_t arch_crc32_cal(xwu32_t * crc32,
+                      bool refin, xwu32_t plynml, xwu32_t direction,
+                      const xwu8_t stream[], xwsz_t * size);
+#else
+#  define arch_crc32_cal(crc32, refin, plynml, direction, stream, size) (-EOPNOTSUPP)
+#endif
+
 static __xwlib_code
 void xwlib_crc32_swcal_ls(xwu32_t * crc32,
                           bool refin, const xwu32_t table[],
+                          const xwu32_t (* sbtbl)[256],
                           const xwu8_t stream[], xwsz_t * size);
 
 static __xwlib_code
 void xwlib_crc32_swcal_rs(xwu32_t * crc32,
                           bool refin, const xwu32_t table[],
+                          const xwu32_t (* sbtbl)[256],
                           const xwu8_t stream[], xwsz_t * size);
 
 static __xwlib_code
@@ -566,21 +4741,33 @@ xwer_t xwlib_crc32_swcal(xwu32_t * crc32,
                          bool refin, xwu32_t plynml, xwu32_t direction,
                          const xwu8_t stream[], xwsz_t * size);
 
+static __xwlib_code
+bool xwlib_crc32_tst_plynml(xwu32_t plynml);
+
+static __xwlib_code
+bool xwlib_crc32_mirror(xwu32_t * crc32, bool * refin,
+                        xwu32_t * plynml, xwu32_t * direction);
+
 /**
- * @brief 左移计算一段数据的CRC32校验值（直驱表法）
+ * @brief 左移计算一段数据的CRC32校验值（分片查表法与直驱表法）
  * @param[in,out] crc32: 指向缓冲区的指针，此缓冲区：
  * + (I) 作为输入时，表示初始值
  * + (O) 作为输出时，返回计算结果
  * @param[in] refin: 是否按位镜像翻转输入的每个字节(xwbop_rbit8)
  * @param[in] table: CRC32查询表
+ * @param[in] sbtbl: CRC32分片查询表，为 `NULL` 时只使用直驱表法
  * @param[in] stream: 指向数据的指针
  * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
  * + (I) 作为输入时，表示数据长度
  * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @details
+ * 分片查表法每次处理 `XWLIB_CRC32_SLICE` 个字节，各个分片的查表互不依赖，
+ * 剩余不足一次的字节再使用直驱表法逐字节计算。
  */
 static __xwlib_code
 void xwlib_crc32_swcal_ls(xwu32_t * crc32,
                           bool refin, const xwu32_t table[],
+                          const xwu32_t (* sbtbl)[256],
                           const xwu8_t stream[], xwsz_t * size)
 {
         xwsz_t i;
@@ -588,7 +4775,32 @@ void xwlib_crc32_swcal_ls(xwu32_t * crc32,
         xwu8_t byte;
         xwu32_t remainder = *crc32;
 
-        for (i = 0; i < *size; i++) {
+        i = 0;
+#if (XWLIB_CRC32_SLICE > 1U)
+        if ((!refin) && (NULL != sbtbl)) {
+                xwsz_t j;
+                xwu32_t sum;
+
+                for (; (i + XWLIB_CRC32_SLICE) <= *size; i += XWLIB_CRC32_SLICE) {
+                        remainder ^= ((xwu32_t)stream[i] << (xwu32_t)24) |
+                                     ((xwu32_t)stream[i + 1U] << (xwu32_t)16) |
+                                     ((xwu32_t)stream[i + 2U] << (xwu32_t)8) |
+                                     (xwu32_t)stream[i + 3U];
+                        sum = table[stream[i + XWLIB_CRC32_SLICE - 1U]];
+                        for (j = 0; j < 4U; j++) {
+                                index = (xwu8_t)(remainder >> (24U - (8U * j)));
+                                sum ^= sbtbl[XWLIB_CRC32_SLICE - 2U - j][index];
+                        }
+                        for (j = 4; j < (XWLIB_CRC32_SLICE - 1U); j++) {
+                                sum ^= sbtbl[XWLIB_CRC32_SLICE - 2U - j][stream[i + j]];
+                        }
+                        remainder = sum;
+                }
+        }
+#else
+        XWOS_UNUSED(sbtbl);
+#endif
+        for (; i < *size; i++) {
                 if (refin) {
                         byte = xwbop_rbit8(stream[i]);
                 } else {
@@ -602,12 +4814,13 @@ void xwlib_crc32_swcal_ls(xwu32_t * crc32,
 }
 
 /**
- * @brief 右移计算一段数据的CRC32校验值（直驱表法）
+ * @brief 右移计算一段数据的CRC32校验值（分片查表法与直驱表法）
  * @param[in,out] crc32: 指向缓冲区的指针，此缓冲区：
  * + (I) 作为输入时，表示初始值
  * + (O) 作为输出时，返回计算结果
  * @param[in] refin: 是否按位镜像翻转输入的每个字节(xwbop_rbit8)
  * @param[in] table: CRC32查询表
+ * @param[in] sbtbl: CRC32分片查询表，为 `NULL` 时只使用直驱表法
  * @param[in] stream: 指向数据的指针
  * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
  * + (I) 作为输入时，表示数据长度
@@ -616,6 +4829,7 @@ void xwlib_crc32_swcal_ls(xwu32_t * crc32,
 static __xwlib_code
 void xwlib_crc32_swcal_rs(xwu32_t * crc32,
                           bool refin, const xwu32_t table[],
+                          const xwu32_t (* sbtbl)[256],
                           const xwu8_t stream[], xwsz_t * size)
 {
         xwsz_t i;
@@ -623,7 +4837,32 @@ void xwlib_crc32_swcal_rs(xwu32_t * crc32,
         xwu8_t byte;
         xwu32_t remainder = *crc32;
 
-        for (i = 0; i < *size; i++) {
+        i = 0;
+#if (XWLIB_CRC32_SLICE > 1U)
+        if ((!refin) && (NULL != sbtbl)) {
+                xwsz_t j;
+                xwu32_t sum;
+
+                for (; (i + XWLIB_CRC32_SLICE) <= *size; i += XWLIB_CRC32_SLICE) {
+                        remainder ^= (xwu32_t)stream[i] |
+                                     ((xwu32_t)stream[i + 1U] << (xwu32_t)8) |
+                                     ((xwu32_t)stream[i + 2U] << (xwu32_t)16) |
+                                     ((xwu32_t)stream[i + 3U] << (xwu32_t)24);
+                        sum = table[stream[i + XWLIB_CRC32_SLICE - 1U]];
+                        for (j = 0; j < 4U; j++) {
+                                index = (xwu8_t)(remainder >> (8U * j));
+                                sum ^= sbtbl[XWLIB_CRC32_SLICE - 2U - j][index];
+                        }
+                        for (j = 4; j < (XWLIB_CRC32_SLICE - 1U); j++) {
+                                sum ^= sbtbl[XWLIB_CRC32_SLICE - 2U - j][stream[i + j]];
+                        }
+                        remainder = sum;
+                }
+        }
+#else
+        XWOS_UNUSED(sbtbl);
+#endif
+        for (; i < *size; i++) {
                 if (refin) {
                         byte = xwbop_rbit8(stream[i]);
                 } else {
@@ -651,6 +4890,9 @@ void xwlib_crc32_swcal_rs(xwu32_t * crc32,
  * @return 错误码
  * @retval XWOK: 没有错误，计算结果有效
  * @retval -EOPNOTSUPP: 不支持的多项式
+ * @details
+ * 分片查询表只适用于多项式与移位方向匹配的模型：
+ * 0x04C11DB7与0x1EDC6F41左移、0xEDB88320与0x82F63B78右移。
  */
 static __xwlib_code
 xwer_t xwlib_crc32_swcal(xwu32_t * crc32,
@@ -664,11 +4906,17 @@ xwer_t xwlib_crc32_swcal(xwu32_t * crc32,
 #if defined(XWLIBCFG_CRC32_0X04C11DB7) && (1 == XWLIBCFG_CRC32_0X04C11DB7)
         case (xwu32_t)0x04C11DB7:
                 if ((xwu32_t)XWLIB_CRC32_LEFT_SHIFT == direction) {
+#  if (XWLIB_CRC32_SLICE > 1U)
                         xwlib_crc32_swcal_ls(crc32, refin, xwlib_crc32tbl_0x04c11db7,
+                                             xwlib_crc32sbtbl_0x04c11db7,
                                              stream, size);
+#  else
+                        xwlib_crc32_swcal_ls(crc32, refin, xwlib_crc32tbl_0x04c11db7,
+                                             NULL, stream, size);
+#  endif
                 } else {
                         xwlib_crc32_swcal_rs(crc32, refin, xwlib_crc32tbl_0x04c11db7,
-                                             stream, size);
+                                             NULL, stream, size);
                 }
                 rc = XWOK;
                 break;
@@ -677,11 +4925,54 @@ xwer_t xwlib_crc32_swcal(xwu32_t * crc32,
 #if defined(XWLIBCFG_CRC32_0XEDB88320) && (1 == XWLIBCFG_CRC32_0XEDB88320)
         case (xwu32_t)0xEDB88320:
                 if ((xwu32_t)XWLIB_CRC32_RIGHT_SHIFT == direction) {
+#  if (XWLIB_CRC32_SLICE > 1U)
                         xwlib_crc32_swcal_rs(crc32, refin, xwlib_crc32tbl_0xedb88320,
+                                             xwlib_crc32sbtbl_0xedb88320,
                                              stream, size);
+#  else
+                        xwlib_crc32_swcal_rs(crc32, refin, xwlib_crc32tbl_0xedb88320,
+                                             NULL, stream, size);
+#  endif
                 } else {
                         xwlib_crc32_swcal_ls(crc32, refin, xwlib_crc32tbl_0xedb88320,
+                                             NULL, stream, size);
+                }
+                rc = XWOK;
+                break;
+#endif
+#if defined(XWLIBCFG_CRC32_0X1EDC6F41) && (1 == XWLIBCFG_CRC32_0X1EDC6F41)
+        case (xwu32_t)0x1EDC6F41:
+                if ((xwu32_t)XWLIB_CRC32_LEFT_SHIFT == direction) {
+#  if (XWLIB_CRC32_SLICE > 1U)
+                        xwlib_crc32_swcal_ls(crc32, refin, xwlib_crc32tbl_0x1edc6f41,
+                                             xwlib_crc32sbtbl_0x1edc6f41,
                                              stream, size);
+#  else
+                        xwlib_crc32_swcal_ls(crc32, refin, xwlib_crc32tbl_0x1edc6f41,
+                                             NULL, stream, size);
+#  endif
+                } else {
+                        xwlib_crc32_swcal_rs(crc32, refin, xwlib_crc32tbl_0x1edc6f41,
+                                             NULL, stream, size);
+                }
+                rc = XWOK;
+                break;
+#endif
+
+#if defined(XWLIBCFG_CRC32_0X82F63B78) && (1 == XWLIBCFG_CRC32_0X82F63B78)
+        case (xwu32_t)0x82F63B78:
+                if ((xwu32_t)XWLIB_CRC32_RIGHT_SHIFT == direction) {
+#  if (XWLIB_CRC32_SLICE > 1U)
+                        xwlib_crc32_swcal_rs(crc32, refin, xwlib_crc32tbl_0x82f63b78,
+                                             xwlib_crc32sbtbl_0x82f63b78,
+                                             stream, size);
+#  else
+                        xwlib_crc32_swcal_rs(crc32, refin, xwlib_crc32tbl_0x82f63b78,
+                                             NULL, stream, size);
+#  endif
+                } else {
+                        xwlib_crc32_swcal_ls(crc32, refin, xwlib_crc32tbl_0x82f63b78,
+                                             NULL, stream, size);
                 }
                 rc = XWOK;
                 break;
@@ -699,6 +4990,84 @@ xwer_t xwlib_crc32_swcal(xwu32_t * crc32,
         return rc;
 }
 
+/**
+ * @brief 测试是否支持多项式
+ * @param[in] plynml: 多项式
+ */
+static __xwlib_code
+bool xwlib_crc32_tst_plynml(xwu32_t plynml)
+{
+        bool ret;
+
+        // cppcheck-suppress [misra-c2012-16.6]
+        switch (plynml) {
+#if defined(XWLIBCFG_CRC32_0X04C11DB7) && (1 == XWLIBCFG_CRC32_0X04C11DB7)
+        case (xwu32_t)0x04C11DB7:
+                ret = true;
+                break;
+#endif
+#if defined(XWLIBCFG_CRC32_0XEDB88320) && (1 == XWLIBCFG_CRC32_0XEDB88320)
+        case (xwu32_t)0xEDB88320:
+                ret = true;
+                break;
+#endif
+#if defined(XWLIBCFG_CRC32_0X1EDC6F41) && (1 == XWLIBCFG_CRC32_0X1EDC6F41)
+        case (xwu32_t)0x1EDC6F41:
+                ret = true;
+                break;
+#endif
+#if defined(XWLIBCFG_CRC32_0X82F63B78) && (1 == XWLIBCFG_CRC32_0X82F63B78)
+        case (xwu32_t)0x82F63B78:
+                ret = true;
+                break;
+#endif
+        default:
+                ret = false;
+                break;
+        }
+        return ret;
+}
+
+/**
+ * @brief 将按位镜像翻转输入的模型转换为等价的不翻转输入的模型
+ * @param[in,out] crc32: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示当前的余数
+ * + (O) 作为输出时，返回镜像模型中的余数
+ * @param[in,out] refin: 是否按位镜像翻转输入的每个字节
+ * @param[in,out] plynml: 多项式
+ * @param[in,out] direction: 数据移位的方向
+ * @return 是否进行了转换
+ * @details
+ * 按位镜像翻转输入的每个字节，再用多项式 `P` 按某个方向移位计算，
+ * 等价于不翻转输入，用镜像多项式 `xwbop_rbit32(P)` 按相反的方向移位计算，
+ * 两个模型的余数互为镜像。转换后既不需要逐字节调用 `xwbop_rbit8()` ，
+ * 也可以使用分片查询表与硬件加速指令。
+ *
+ * 只有镜像多项式也被支持时才进行转换，此时计算结束后，
+ * 需要将余数再镜像翻转回来。
+ */
+static __xwlib_code
+bool xwlib_crc32_mirror(xwu32_t * crc32, bool * refin,
+                        xwu32_t * plynml, xwu32_t * direction)
+{
+        bool mirror;
+
+        if ((*refin) && xwlib_crc32_tst_plynml(xwbop_rbit32(*plynml))) {
+                *crc32 = xwbop_rbit32(*crc32);
+                *refin = false;
+                *plynml = xwbop_rbit32(*plynml);
+                if ((xwu32_t)XWLIB_CRC32_LEFT_SHIFT == *direction) {
+                        *direction = (xwu32_t)XWLIB_CRC32_RIGHT_SHIFT;
+                } else {
+                        *direction = (xwu32_t)XWLIB_CRC32_LEFT_SHIFT;
+                }
+                mirror = true;
+        } else {
+                mirror = false;
+        }
+        return mirror;
+}
+
 __xwlib_code
 xwer_t xwlib_crc32_cal(xwu32_t * crc32, xwu32_t xorout,
                        bool refin, bool refout,
@@ -709,6 +5078,7 @@ xwer_t xwlib_crc32_cal(xwu32_t * crc32, xwu32_t xorout,
         xwsz_t total;
         xwsz_t pos;
         xwu32_t res;
+        bool mirror;
 
         XWOS_VALIDATE((crc32), "nullptr", -EFAULT);
         XWOS_VALIDATE((size), "nullptr", -EFAULT);
@@ -716,15 +5086,24 @@ xwer_t xwlib_crc32_cal(xwu32_t * crc32, xwu32_t xorout,
         total = *size;
         res = *crc32;
         pos = 0;
-        /* 使用硬件计算部分CRC32校验值 */
+        /* 使用SOC的硬件单元计算部分CRC32校验值 */
         rc = soc_crc32_cal(&res, refin, plynml, direction, &stream[0], size);
         if (*size > 0) {
-                /* 使用软件计算剩余部分的CRC32校验值 */
-                pos = total - *size;
-                rc = xwlib_crc32_swcal(&res,
-                                       refin, plynml, direction,
-                                       &stream[pos], size);
+                mirror = xwlib_crc32_mirror(&res, &refin, &plynml, &direction);
+                /* 使用CPU的CRC指令计算部分CRC32校验值 */
                 pos = total - *size;
+                rc = arch_crc32_cal(&res, refin, plynml, direction, &stream[pos], size);
+                if (*size > 0) {
+                        /* 使用软件计算剩余部分的CRC32校验值 */
+                        pos = total - *size;
+                        rc = xwlib_crc32_swcal(&res,
+                                               refin, plynml, direction,
+                                               &stream[pos], size);
+                        pos = total - *size;
+                }
+                if (mirror) {
+                        res = xwbop_rbit32(res);
+                }
         }
         if (XWOK == rc) {
                 if (0 == *size) {
@@ -750,3 +5129,76 @@ xwu32_t xwlib_crc32_calms(const xwu8_t stream[], xwsz_t * size)
                         stream, size);
         return result;
 }
+
+__xwlib_code
+xwu32_t xwlib_crc32c_calms(const xwu8_t stream[], xwsz_t * size)
+{
+        xwu32_t result;
+
+        result = (xwu32_t)0xFFFFFFFF;
+        // cppcheck-suppress [misra-c2012-17.7]
+        xwlib_crc32_cal(&result, (xwu32_t)0xFFFFFFFF, false, false,
+                        (xwu32_t)0x82F63B78, XWLIB_CRC32_RIGHT_SHIFT,
+                        stream, size);
+        return result;
+}
+
+__xwlib_code
+void xwlib_crc32_init(struct xwlib_crc32_ctx * ctx, xwu32_t init, xwu32_t xorout,
+                      bool refin, bool refout,
+                      xwu32_t plynml, xwu32_t direction)
+{
+        ctx->crc = init;
+        ctx->xorout = xorout;
+        ctx->plynml = plynml;
+        ctx->direction = direction;
+        ctx->refin = refin;
+        ctx->refout = refout;
+}
+
+__xwlib_code
+void xwlib_crc32_init_ms(struct xwlib_crc32_ctx * ctx)
+{
+        xwlib_crc32_init(ctx, (xwu32_t)0xFFFFFFFF, (xwu32_t)0xFFFFFFFF, false, false,
+                         (xwu32_t)0xEDB88320, XWLIB_CRC32_RIGHT_SHIFT);
+}
+
+__xwlib_code
+void xwlib_crc32_init_c(struct xwlib_crc32_ctx * ctx)
+{
+        xwlib_crc32_init(ctx, (xwu32_t)0xFFFFFFFF, (xwu32_t)0xFFFFFFFF, false, false,
+                         (xwu32_t)0x82F63B78, XWLIB_CRC32_RIGHT_SHIFT);
+}
+
+__xwlib_code
+xwer_t xwlib_crc32_update(struct xwlib_crc32_ctx * ctx,
+                          const xwu8_t stream[], xwsz_t size)
+{
+        xwsz_t rest;
+        xwer_t rc;
+
+        XWOS_VALIDATE((ctx), "nullptr", -EFAULT);
+
+        if (size > 0U) {
+                rest = size;
+                /* 中间结果既不镜像翻转，也不与xorout异或 */
+                rc = xwlib_crc32_cal(&ctx->crc, 0, ctx->refin, false,
+                                     ctx->plynml, ctx->direction,
+                                     stream, &rest);
+        } else {
+                rc = XWOK;
+        }
+        return rc;
+}
+
+__xwlib_code
+xwu32_t xwlib_crc32_final(struct xwlib_crc32_ctx * ctx)
+{
+        xwu32_t res;
+
+        res = ctx->crc;
+        if (ctx->refout) {
+                res = xwbop_rbit32(res);
+        }
+        return res ^ ctx->xorout;
+}
@@ -23,6 +23,8 @@
 
 extern const xwu32_t xwlib_crc32tbl_0x04c11db7[256];
 extern const xwu32_t xwlib_crc32tbl_0xedb88320[256];
+extern const xwu32_t xwlib_crc32tbl_0x1edc6f41[256];
+extern const xwu32_t xwlib_crc32tbl_0x82f63b78[256];
 
 /**
  * @brief 计算CRC32的移位方向枚举
@@ -32,6 +34,23 @@ enum xwlib_crc32_shift_direction_em {
         XWLIB_CRC32_RIGHT_SHIFT, /**< 右移 */
 };
 
+/**
+ * @brief 增量计算CRC32的上下文
+ * @details
+ * 数据分散在多个缓冲区中或是逐段到达时，不需要拷贝到同一个缓冲区中：
+ * + 通过 @ref xwlib_crc32_init() 设置参数模型；
+ * + 每一段数据调用一次 @ref xwlib_crc32_update() ；
+ * + 通过 @ref xwlib_crc32_final() 获取结果。
+ */
+struct xwlib_crc32_ctx {
+        xwu32_t crc; /**< 余数 */
+        xwu32_t xorout; /**< 与结果异或的值 */
+        xwu32_t plynml; /**< 多项式 */
+        xwu32_t direction; /**< 数据移位的方向 */
+        bool refin; /**< 是否按位镜像翻转输入的每个字节 */
+        bool refout; /**< 是否按位镜像翻转输出 */
+};
+
 /**
  * @brief 计算一段数据的CRC32校验值
  * @param[in,out] crc32: 指向缓冲区的指针，此缓冲区：
@@ -43,6 +62,8 @@ enum xwlib_crc32_shift_direction_em {
  * @param[in] plynml: 多项式，取值：
  *   @arg 0x04C11DB7
  *   @arg 0xEDB88320
+ *   @arg 0x1EDC6F41：CRC-32C(Castagnoli)
+ *   @arg 0x82F63B78：CRC-32C(Castagnoli)的镜像
  * @param[in] direction: 数据移位的方向
  * @param[in] stream: 指向数据的指针
  * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
@@ -53,6 +74,18 @@ enum xwlib_crc32_shift_direction_em {
  * @retval XWOK: 没有错误，计算结果有效
  * @retval -EFAULT: 空指针
  * @retval -EOPNOTSUPP: 不支持的多项式
+ * @details
+ * 依次使用以下方式计算，前一种方式不支持或剩余字节数不满足要求时，由后一种方式继续：
+ * + SOC的CRC硬件单元(SOCCFG_CRC32)，某些平台的硬件可能有字节数的要求
+ *   （例如STM32要求字节数为4的倍数）；
+ * + CPU的CRC32指令(ARCHCFG_LIB_CRC32)，例如ARMv8A的 `crc32x` ，
+ *   只支持主流CRC32参数模型的多项式与移位方向；
+ * + 软件分片查表法(XWLIBCFG_CRC32_SLICE)，每次处理8或16个字节，
+ *   只支持多项式与移位方向匹配的模型（0x04C11DB7左移、0xEDB88320右移）；
+ * + 软件直驱表法，每次处理1个字节。
+ *
+ * 按位镜像翻转输入的模型会先转换为等价的不翻转输入的镜像模型，
+ * 因此同样可以使用CRC32指令与分片查表法。
  */
 xwer_t xwlib_crc32_cal(xwu32_t * crc32, xwu32_t xorout,
                        bool refin, bool refout,
@@ -82,12 +115,79 @@ xwer_t xwlib_crc32_cal(xwu32_t * crc32, xwu32_t xorout,
  *   - 是否按位镜像翻转输出：是
  *   - 与结果进行异或计算：0xFFFFFFFF
  * + 上面两个模型计算结果是一致的；
- * + 本算法优先使用硬件加速运算，但某些平台的硬件可能有字节数的要求
- *   （例如STM32要求字节数为4的倍数），多余的字节再采用软件计算；
- * + 本软件算法使用的是直驱表法。
+ * + 计算过程见 @ref xwlib_crc32_cal() 。
  */
 xwu32_t xwlib_crc32_calms(const xwu8_t stream[], xwsz_t * size);
 
+/**
+ * @brief 用CRC-32C(Castagnoli)参数模型计算一段数据的校验值
+ * @param[in] stream: 指向数据的指针
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据长度
+ * + (O) 作为输出时，返回剩余未计算的数据长度
+ * @return CRC32
+ * @note
+ * + CRC-32C参数模型（iSCSI、SCTP、ext4等使用）：
+ *   - 多项式：0x82F63B78（0x1EDC6F41的镜像）
+ *   - 初始值：0xFFFFFFFF
+ *   - 数据移位方向：右移
+ *   - 是否按位镜像翻转输入：否
+ *   - 是否按位镜像翻转输出：否
+ *   - 与结果进行异或计算：0xFFFFFFFF
+ */
+xwu32_t xwlib_crc32c_calms(const xwu8_t stream[], xwsz_t * size);
+
+/**
+ * @brief 初始化增量计算CRC32的上下文
+ * @param[in] ctx: 上下文的指针
+ * @param[in] init: 初始值
+ * @param[in] xorout: 与结果异或的值
+ * @param[in] refin: 是否按位镜像翻转输入的每个字节(xwbop_rbit8)
+ * @param[in] refout: 是否按位镜像翻转输出(xwbop_rbit32)
+ * @param[in] plynml: 多项式，取值同 @ref xwlib_crc32_cal()
+ * @param[in] direction: 数据移位的方向
+ */
+void xwlib_crc32_init(struct xwlib_crc32_ctx * ctx, xwu32_t init, xwu32_t xorout,
+                      bool refin, bool refout,
+                      xwu32_t plynml, xwu32_t direction);
+
+/**
+ * @brief 用主流CRC32参数模型初始化增量计算CRC32的上下文
+ * @param[in] ctx: 上下文的指针
+ */
+void xwlib_crc32_init_ms(struct xwlib_crc32_ctx * ctx);
+
+/**
+ * @brief 用CRC-32C(Castagnoli)参数模型初始化增量计算CRC32的上下文
+ * @param[in] ctx: 上下文的指针
+ */
+void xwlib_crc32_init_c(struct xwlib_crc32_ctx * ctx);
+
+/**
+ * @brief 增量计算一段数据的CRC32
+ * @param[in] ctx: 上下文的指针
+ * @param[in] stream: 指向数据的指针
+ * @param[in] size: 数据长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EOPNOTSUPP: 不支持的多项式
+ * @note
+ * + 上下文：任意
+ * + 可重入：多个调用者各自使用不同的上下文
+ */
+xwer_t xwlib_crc32_update(struct xwlib_crc32_ctx * ctx,
+                          const xwu8_t stream[], xwsz_t size);
+
+/**
+ * @brief 获取增量计算CRC32的结果
+ * @param[in] ctx: 上下文的指针
+ * @return CRC32
+ * @details
+ * 不会修改上下文，获取结果之后还可以继续增量计算后续的数据。
+ */
+xwu32_t xwlib_crc32_final(struct xwlib_crc32_ctx * ctx);
+
 /**
  * @} xwos_lib_crc32
  */
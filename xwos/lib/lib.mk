@@ -60,6 +60,9 @@ endif
 ifeq ($(XWLIBCFG_CRC32),y)
   XWOS_CSRCS += lib/crc32.c
 endif
+ifeq ($(XWLIBCFG_CRC16),y)
+  XWOS_CSRCS += lib/crc16.c
+endif
 ifeq ($(XWLIBCFG_CRC8),y)
   XWOS_CSRCS += lib/crc8.c
 endif
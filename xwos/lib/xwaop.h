@@ -2630,6 +2630,86 @@ void xwbmpaop_c0all(atomic_xwbmp_t * bmp, xwsq_t num)
         }
 }
 
+/**
+ * @brief XWOS AOPLIB：将位图中掩码部分置1
+ * @param[in] bmp: 位图的起始地址指针
+ * @param[in] msk: 掩码
+ * @param[in] num: 掩码的有效位数
+ * @note
+ * - 内存序：acq_rel
+ * - 每个 `xwbmp_t` 单独原子地修改，整个位图的修改不是一个原子操作。
+ */
+static __xwlib_inline
+void xwbmpaop_s1m(atomic_xwbmp_t * bmp, xwbmp_t msk[], xwsz_t num)
+{
+        xwsz_t n = BITS_TO_XWBMP_T(num);
+        xwsz_t i;
+
+        for (i = 0; i < n; i++) {
+                xwaop_s1m(xwbmp_t, &bmp[i], msk[i], NULL, NULL);
+        }
+}
+
+/**
+ * @brief XWOS AOPLIB：将位图中掩码部分清0
+ * @param[in] bmp: 位图的起始地址指针
+ * @param[in] msk: 掩码
+ * @param[in] num: 掩码的有效位数
+ * @note
+ * - 内存序：acq_rel
+ * - 每个 `xwbmp_t` 单独原子地修改，整个位图的修改不是一个原子操作。
+ */
+static __xwlib_inline
+void xwbmpaop_c0m(atomic_xwbmp_t * bmp, xwbmp_t msk[], xwsz_t num)
+{
+        xwsz_t n = BITS_TO_XWBMP_T(num);
+        xwsz_t i;
+
+        for (i = 0; i < n; i++) {
+                xwaop_c0m(xwbmp_t, &bmp[i], msk[i], NULL, NULL);
+        }
+}
+
+/**
+ * @brief XWOS AOPLIB：将位图中掩码部分翻转
+ * @param[in] bmp: 位图的起始地址指针
+ * @param[in] msk: 掩码
+ * @param[in] num: 掩码的有效位数
+ * @note
+ * - 内存序：acq_rel
+ * - 每个 `xwbmp_t` 单独原子地修改，整个位图的修改不是一个原子操作。
+ */
+static __xwlib_inline
+void xwbmpaop_x1m(atomic_xwbmp_t * bmp, xwbmp_t msk[], xwsz_t num)
+{
+        xwsz_t n = BITS_TO_XWBMP_T(num);
+        xwsz_t i;
+
+        for (i = 0; i < n; i++) {
+                xwaop_x1m(xwbmp_t, &bmp[i], msk[i], NULL, NULL);
+        }
+}
+
+/**
+ * @brief XWOS AOPLIB：读取位图
+ * @param[in] bmp: 位图的起始地址指针
+ * @param[out] out: 指向缓冲区的指针，通过此缓冲区返回位图的值
+ * @param[in] num: 位图中总的位数
+ * @note
+ * - 内存序：acquire
+ * - 每个 `xwbmp_t` 单独原子地读取，整个位图的读取不是一个原子操作。
+ */
+static __xwlib_inline
+void xwbmpaop_read(atomic_xwbmp_t * bmp, xwbmp_t out[], xwsz_t num)
+{
+        xwsz_t n = BITS_TO_XWBMP_T(num);
+        xwsz_t i;
+
+        for (i = 0; i < n; i++) {
+                out[i] = xwaop_load(xwbmp_t, &bmp[i], xwaop_mo_acquire);
+        }
+}
+
 /**
  * @} xwos_lib_xwbmpaop
  */
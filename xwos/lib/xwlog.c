@@ -13,10 +13,300 @@
 #include <xwos/standard.h>
 #include <stdio.h> // cppcheck-suppress [misra-c2012-21.6]
 #include <xwos/lib/xwlog.h>
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+#  include <assert.h>
+#  include <stddef.h>
+#  include <stdint.h>
+#  include <string.h>
+#  include <xwos/osal/irq.h>
+#  include <xwos/osal/skd.h>
+#  include <xwos/osal/thd.h>
+#  include <xwos/osal/sync/sem.h>
+#endif
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+#  include <string.h>
+#  include <xwos/osal/time.h>
+#endif
 
 extern xwer_t soc_log_write(const char * s, xwsz_t * n);
 extern xwer_t board_log_write(const char * s, xwsz_t * n);
 
+/**
+ * @brief 将字符串输出到日志
+ * @param[in] s: 字符串
+ * @param[in] n: 字符串的长度
+ * @return 已输出的长度或错误码
+ */
+static __xwlib_code
+int xwlog_write(const char * s, xwsz_t n)
+{
+        xwer_t rc;
+        xwsz_t sz;
+        int i;
+
+        sz = n;
+#if defined(SOCCFG_LOG) && (1 == SOCCFG_LOG)
+        rc = soc_log_write(s, &sz);
+        if (rc < 0) {
+                i = (int)rc;
+        } else {
+                i = (int)sz;
+        }
+#elif defined(BRDCFG_LOG) && (1 == BRDCFG_LOG)
+        rc = board_log_write(s, &sz);
+        if (rc < 0) {
+                i = (int)rc;
+        } else {
+                i = (int)sz;
+        }
+#else
+#  warning "Can't find the log configurations!"
+        XWOS_UNUSED(s);
+        XWOS_UNUSED(sz);
+        XWOS_UNUSED(rc);
+        i = 0;
+#endif
+        return i;
+}
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+/**
+ * @ingroup xwos_lib_xwlog_bin
+ * @{
+ */
+
+#define XWLOG_BIN_VARINT_MAX    (10U) /**< 64位数的varint的最大长度 */
+#define XWLOG_BIN_COBS_BLKSIZE  (254U) /**< COBS每块的最大数据长度 */
+#define XWLOG_BIN_STR_RSV       (2U) /**< 打包字符串时为后面每个参数预留的空间 */
+
+/**
+ * @brief 二进制日志的全局数据
+ */
+struct xwlog_bin {
+        xwlog_bin_sink_f sink; /**< 输出函数，为 `NULL` 时使用 @ref xwlog_bin_uart_sink() */
+        void * arg; /**< 输出函数的参数 */
+};
+
+static __xwlib_data
+struct xwlog_bin xwlog_bin;
+
+/**
+ * @brief 编码一个varint
+ * @param[out] dst: 缓冲区，至少 @ref XWLOG_BIN_VARINT_MAX 字节
+ * @param[in] v: 数值
+ * @return 编码后的长度
+ */
+static __xwlib_code
+xwsz_t xwlog_bin_varint(xwu8_t dst[], xwu64_t v)
+{
+        xwsz_t n;
+
+        n = 0;
+        while (v >= 0x80U) {
+                dst[n] = (xwu8_t)((v & 0x7FU) | 0x80U);
+                n++;
+                v >>= 7U;
+        }
+        dst[n] = (xwu8_t)v;
+        n++;
+        return n;
+}
+
+/**
+ * @brief zigzag编码，绝对值小的负数也编码为较短的varint
+ */
+static __xwlib_code
+xwu64_t xwlog_bin_zigzag(xws64_t v)
+{
+        return (v < 0) ? ~((xwu64_t)v << 1U) : ((xwu64_t)v << 1U);
+}
+
+/**
+ * @brief 在缓冲区中的数据之前插入一个varint
+ * @param[in] buf: 缓冲区
+ * @param[in,out] start: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示数据的起始位置
+ * + (O) 作为输出时，返回插入后数据的起始位置
+ * @param[in] v: 数值
+ */
+static __xwlib_code
+void xwlog_bin_prepend(xwu8_t buf[], xwsz_t * start, xwu64_t v)
+{
+        xwu8_t tmp[XWLOG_BIN_VARINT_MAX];
+        xwsz_t n;
+
+        n = xwlog_bin_varint(tmp, v);
+        *start -= n;
+        memcpy(&buf[*start], tmp, n); // cppcheck-suppress [misra-c2012-17.7]
+}
+
+/**
+ * @brief 输出一批二进制日志记录
+ */
+static __xwlib_code
+xwer_t xwlog_bin_output(const xwu8_t data[], xwsz_t size)
+{
+        xwlog_bin_sink_f sink;
+        xwer_t rc;
+
+        xwmb_mp_load_acquire(xwlog_bin_sink_f, sink, &xwlog_bin.sink);
+        if (NULL == sink) {
+                rc = xwlog_bin_uart_sink(NULL, data, size);
+        } else {
+                rc = sink(xwlog_bin.arg, data, size);
+        }
+        return rc;
+}
+
+/**
+ * @brief 在记录内容之前加上长度与时间戳，作为只有一条记录的一批输出
+ * @param[in] buf: 缓冲区，记录内容之前至少有 `2 * XWLOG_BIN_VARINT_MAX` 字节的空间
+ * @param[in] start: 记录内容的起始位置
+ * @param[in] end: 记录内容的结束位置
+ * @param[in] ts: 时间戳
+ */
+static __xwlib_code
+xwer_t xwlog_bin_send(xwu8_t buf[], xwsz_t start, xwsz_t end, xwtm_t ts)
+{
+        xwlog_bin_prepend(buf, &start, xwlog_bin_zigzag(ts / XWTM_US(1)));
+        xwlog_bin_prepend(buf, &start, (xwu64_t)(end - start));
+        return xwlog_bin_output(&buf[start], end - start);
+}
+
+/**
+ * @brief 在文本之前加上文本记录的编号、等级与参数的类型
+ * @param[in] buf: 缓冲区
+ * @param[in] start: 文本的起始位置
+ * @param[in] n: 文本的长度
+ * @return 记录内容的起始位置
+ */
+static __xwlib_code
+xwsz_t xwlog_bin_textrec(xwu8_t buf[], xwsz_t start, xwsz_t n)
+{
+        xwlog_bin_prepend(buf, &start, (xwu64_t)n);
+        start--;
+        buf[start] = (xwu8_t)XWLOG_BIN_ARG_STR;
+        start--;
+        buf[start] = (xwu8_t)((XWLOG_BIN_LV_TEXT << 4U) | 1U);
+        start--;
+        buf[start] = 0; /* 编号 `0` 表示文本记录 */
+        return start;
+}
+
+/**
+ * @brief XWOS API：默认的二进制日志输出函数，COBS编码后写入串口
+ * @param[in] arg: 未使用
+ * @param[in] data: 一批记录
+ * @param[in] size: 数据的长度
+ * @return 错误码
+ * @note
+ * + 上下文：依赖 `soc_log_write()` 或 `board_log_write()` 实现
+ * @details
+ * COBS编码后的数据中不含 `0x00` ，每批记录之后写入一个 `0x00` 作为分隔符，
+ * 主机端从任意位置开始接收都可以在下一个分隔符处同步。
+ * 编码时每块最多254字节，分块写入，不需要与数据一样大的缓冲区。
+ */
+__xwlib_code
+xwer_t xwlog_bin_uart_sink(void * arg, const xwu8_t data[], xwsz_t size)
+{
+        xwu8_t frame[XWLOG_BIN_COBS_BLKSIZE + 2U];
+        xwsz_t pos;
+        xwsz_t op;
+        xwsz_t n;
+        int i;
+
+        XWOS_UNUSED(arg);
+        pos = 0;
+        op = 0;
+        i = 0;
+        while (i >= 0) {
+                n = 0;
+                while (((pos + n) < size) && (0U != data[pos + n]) &&
+                       (n < XWLOG_BIN_COBS_BLKSIZE)) {
+                        n++;
+                }
+                if ((op + 1U + n) > sizeof(frame)) {
+                        i = xwlog_write((const char *)frame, op);
+                        op = 0;
+                }
+                frame[op] = (xwu8_t)(n + 1U);
+                op++;
+                memcpy(&frame[op], &data[pos], n); // cppcheck-suppress [misra-c2012-17.7]
+                op += n;
+                pos += n;
+                if (pos >= size) {
+                        break;
+                }
+                if (n < XWLOG_BIN_COBS_BLKSIZE) {
+                        /* 跳过 `0x00` ，由下一块的长度表示 */
+                        pos++;
+                }
+        }
+        if (i >= 0) {
+                if (op >= sizeof(frame)) {
+                        i = xwlog_write((const char *)frame, op);
+                        op = 0;
+                }
+                frame[op] = 0;
+                op++;
+                i = xwlog_write((const char *)frame, op);
+        }
+        return (i < 0) ? (xwer_t)i : XWOK;
+}
+
+/**
+ * @} xwos_lib_xwlog_bin
+ */
+
+/**
+ * @brief 格式化字符串，以文本记录输出到日志，参数为 `va_list`
+ */
+static __xwlib_code
+int xwlog_vpf(const char * fmt, va_list args)
+{
+        xwu8_t rec[XWLOG_BIN_HEADROOM + XWLIBCFG_XWLOG_BUFSIZE];
+        xwsz_t start;
+        xwer_t rc;
+        int i;
+
+        i = vsnprintf((char *)&rec[XWLOG_BIN_HEADROOM], XWLIBCFG_XWLOG_BUFSIZE,
+                      fmt, args);
+        if (i >= 0) {
+                if ((xwsz_t)i >= XWLIBCFG_XWLOG_BUFSIZE) {
+                        /* 已被截断 */
+                        i = (int)XWLIBCFG_XWLOG_BUFSIZE - 1;
+                }
+                start = xwlog_bin_textrec(rec, XWLOG_BIN_HEADROOM, (xwsz_t)i);
+                rc = xwlog_bin_send(rec, start, XWLOG_BIN_HEADROOM + (xwsz_t)i,
+                                    xwtm_now());
+                if (rc < 0) {
+                        i = (int)rc;
+                }
+        }
+        return i;
+}
+#else
+/**
+ * @brief 格式化字符串并输出到日志，参数为 `va_list`
+ */
+static __xwlib_code
+int xwlog_vpf(const char * fmt, va_list args)
+{
+        int i;
+        char buf[XWLIBCFG_XWLOG_BUFSIZE];
+
+        i = vsnprintf(buf, sizeof(buf), fmt, args);
+        if (i >= 0) {
+                if ((xwsz_t)i >= sizeof(buf)) {
+                        /* 已被截断 */
+                        i = (int)sizeof(buf) - 1;
+                }
+                i = xwlog_write(buf, (xwsz_t)i);
+        }
+        return i;
+}
+#endif
+
 /**
  * @brief 格式化字符串并输出到日志，同 `printf()` 函数
  * @param[in] fmt: 格式的字符串
@@ -32,39 +322,1389 @@ __xwlib_code
 int xwpf(const char * fmt, ...)
 {
         va_list args;
+        int i;
+
+        va_start(args, fmt);
+        i = xwlog_vpf(fmt, args);
+        va_end(args);
+        return i;
+}
+
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+/**
+ * @defgroup xwos_lib_xwlog_async 异步日志
+ * @ingroup xwos_lib_xwlog
+ * 同步的 `xwpf()` 在调用者的栈上格式化字符串，并等待底层输出完成，
+ * 在对时间敏感的线程或中断中打印日志会被串口拖慢。
+ * 异步日志将格式化与输出推迟到一个低优先级的线程中：
+ *
+ * + 调用者只解析格式字符串中的转换说明，将格式字符串的指针与原始参数
+ *   写入当前CPU的环形缓冲区，不调用 `vsnprintf()` ，也不访问外设；
+ * + 每个CPU各有一个环形缓冲区，写入时只关闭本地CPU的中断，
+ *   不需要任何跨CPU的锁，CPU之间不会互相竞争；
+ * + 排空线程逐个CPU读取日志，格式化后批量写入 `soc_log_write()` 或
+ *   `board_log_write()` ；
+ * + 环形缓冲区已满时丢弃日志并计数，排空线程输出被丢弃的数量。
+ *
+ * 使用限制：
+ *
+ * + 格式字符串必须是静态的（ `xwlogf()` 的格式字符串总是字符串常量）；
+ * + `%s` 的内容会被复制到日志中，长度受 `XWLIBCFG_XWLOG_ASYNC_RECSIZE` 限制；
+ * + 不支持 `%n` ，也不支持宽字符，`long double` 按 `double` 输出；
+ * + 同一个CPU上的日志保持顺序，不同CPU之间的日志不保证顺序。
+ *
+ * 调用 @ref xwlog_async_start() 之前，日志仍同步输出。
+ * @{
+ */
+
+#define XWLOG_ASYNC_RINGSIZE    (XWLIBCFG_XWLOG_ASYNC_RINGSIZE)
+#define XWLOG_ASYNC_RINGMSK     (XWLOG_ASYNC_RINGSIZE - 1U)
+#define XWLOG_ASYNC_PERIOD      XWTM_MS(10)
+#define XWLOG_ASYNC_PRIORITY    XWOS_SKD_PRIORITY_RT_MIN
+#define XWLOG_ASYNC_SPECSIZE    (40U)
+
+/**
+ * @brief 日志记录的头部
+ * @details
+ * 记录在环形缓冲区中占用的空间总是头部大小的整数倍，因此环形缓冲区末尾剩余的空间
+ * 总能容纳一个头部，需要回绕时写入一个 `fmt` 为 `NULL` 的填充记录。
+ */
+struct xwlog_async_rec {
+        const char * fmt; /**< 格式字符串，为 `NULL` 时表示填充 */
+        xwsz_t size; /**< 记录的实际大小，包括头部 */
+};
+
+#define XWLOG_ASYNC_RECALIGN    (sizeof(struct xwlog_async_rec))
+
+static_assert((XWLOG_ASYNC_RINGSIZE > 0U) &&
+              ((XWLOG_ASYNC_RINGSIZE & XWLOG_ASYNC_RINGMSK) == 0U),
+              "XWLIBCFG_XWLOG_ASYNC_RINGSIZE must be a power of 2 !");
+static_assert((XWLOG_ASYNC_RINGSIZE % XWLOG_ASYNC_RECALIGN) == 0U,
+              "XWLIBCFG_XWLOG_ASYNC_RINGSIZE must be a multiple of the record alignment !");
+
+/**
+ * @brief 每CPU的环形缓冲区
+ * @details
+ * + `head` 只由本CPU在关闭中断时写入；
+ * + `tail` 只由排空线程写入；
+ * + `head` 与 `tail` 都是自由增长的序号，对 `XWLOG_ASYNC_RINGSIZE` 取余得到位置。
+ */
+struct xwlog_async_ring {
+        xwu8_t buf[XWLOG_ASYNC_RINGSIZE] __xwcc_aligned(sizeof(xwptr_t));
+        xwsq_t head __xwcc_alignl1cache; /**< 写入的位置 */
+        xwsq_t logged; /**< 写入的日志数量 */
+        xwsq_t dropped; /**< 丢弃的日志数量 */
+        xwsq_t tail __xwcc_alignl1cache; /**< 读取的位置 */
+        xwsq_t reported; /**< 已报告的丢弃数量，只由排空线程访问 */
+};
+
+/**
+ * @brief 转换说明中参数的类别
+ */
+enum xwlog_async_arg_em {
+        XWLOG_ASYNC_ARG_NONE = 0, /**< 没有参数 */
+        XWLOG_ASYNC_ARG_CHAR, /**< `%c` ，记录为 `int` */
+        XWLOG_ASYNC_ARG_INT, /**< 整数，记录为64位，输出时使用 `ll` 长度 */
+        XWLOG_ASYNC_ARG_PTR, /**< `%p` */
+        XWLOG_ASYNC_ARG_DBL, /**< 浮点数，记录为 `double` */
+        XWLOG_ASYNC_ARG_STR, /**< `%s` ，记录长度与内容 */
+        XWLOG_ASYNC_ARG_SKIP, /**< `%n` ，只跳过参数 */
+};
+
+/**
+ * @brief 长度修饰符
+ */
+enum xwlog_async_len_em {
+        XWLOG_ASYNC_LEN_NONE = 0,
+        XWLOG_ASYNC_LEN_HH,
+        XWLOG_ASYNC_LEN_H,
+        XWLOG_ASYNC_LEN_L,
+        XWLOG_ASYNC_LEN_LL,
+        XWLOG_ASYNC_LEN_Z,
+        XWLOG_ASYNC_LEN_J,
+        XWLOG_ASYNC_LEN_T,
+        XWLOG_ASYNC_LEN_BIGL,
+};
+
+/**
+ * @brief 解析后的转换说明
+ */
+struct xwlog_async_spec {
+        const char * flags; /**< 标志 */
+        xwsz_t flagslen; /**< 标志的长度 */
+        const char * width; /**< 宽度的数字 */
+        xwsz_t widthlen; /**< 宽度的数字的长度 */
+        const char * prec; /**< 精度的数字 */
+        xwsz_t preclen; /**< 精度的数字的长度 */
+        bool widthstar; /**< 宽度由参数指定 */
+        bool precstar; /**< 精度由参数指定 */
+        bool hasprec; /**< 是否有精度 */
+        xwu8_t len; /**< 长度修饰符 */
+        xwu8_t arg; /**< 参数的类别 */
+        char conv; /**< 转换字符，为 `0` 表示转换说明无效 */
+};
+
+/**
+ * @brief 异步日志的全局数据
+ */
+struct xwlog_async {
+        struct xwlog_async_ring ring[CPUCFG_CPU_NUM]; /**< 每CPU的环形缓冲区 */
+        bool started; /**< 排空线程是否已创建 */
+        struct xwos_sem sem; /**< 唤醒排空线程的信号量 */
+        struct xwos_thd thd; /**< 排空线程 */
+        xwos_thd_d thdd; /**< 排空线程的描述符 */
+        char line[XWLIBCFG_XWLOG_BUFSIZE]; /**< 格式化一条日志的缓冲区 */
+        char batch[XWLIBCFG_XWLOG_BUFSIZE * 2U]; /**< 批量输出的缓冲区 */
+        xwsz_t batchpos; /**< 批量输出缓冲区中数据的长度 */
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+        xws64_t batchts; /**< 批量输出缓冲区中上一条记录的时间戳，单位为微秒 */
+#endif
+};
+
+static __xwlib_data
+struct xwlog_async xwlog_async;
+
+static __xwlib_data
+xwstk_t xwlog_async_stack[XWLIBCFG_XWLOG_ASYNC_STACK_SIZE / sizeof(xwstk_t)]
+__xwcc_aligned(16);
+
+static __xwlib_code
+xwer_t xwlog_async_thd_main(void * arg);
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+/**
+ * @brief 二进制记录的标记
+ * @details
+ * 二进制记录的头部中 `fmt` 指向此对象，头部之后是时间戳与记录内容。
+ */
+static __xwlib_rodata
+const char xwlog_async_binrec[1] = {'\0'};
+#endif
+
+/**
+ * @brief 解析一个转换说明
+ * @param[in] p: 指向 `%` 之后的字符
+ * @param[out] spec: 返回解析结果
+ * @return 转换说明之后的位置
+ * @details
+ * 调用者与排空线程使用同一个函数解析格式字符串，
+ * 因此两者对参数的类别与顺序的理解总是一致的。
+ */
+static __xwlib_code
+const char * xwlog_async_parse(const char * p, struct xwlog_async_spec * spec)
+{
+        spec->flags = p;
+        while ((('-' == *p) || ('+' == *p) || (' ' == *p) ||
+                ('#' == *p) || ('0' == *p)) && (spec->flagslen < 8U)) {
+                p++;
+                spec->flagslen++;
+        }
+        if ('*' == *p) {
+                spec->widthstar = true;
+                p++;
+        } else {
+                spec->width = p;
+                while ((*p >= '0') && (*p <= '9') && (spec->widthlen < 10U)) {
+                        p++;
+                        spec->widthlen++;
+                }
+        }
+        if ('.' == *p) {
+                spec->hasprec = true;
+                p++;
+                if ('*' == *p) {
+                        spec->precstar = true;
+                        p++;
+                } else {
+                        spec->prec = p;
+                        while ((*p >= '0') && (*p <= '9') && (spec->preclen < 10U)) {
+                                p++;
+                                spec->preclen++;
+                        }
+                }
+        }
+        switch (*p) {
+        case 'h':
+                p++;
+                if ('h' == *p) {
+                        p++;
+                        spec->len = XWLOG_ASYNC_LEN_HH;
+                } else {
+                        spec->len = XWLOG_ASYNC_LEN_H;
+                }
+                break;
+        case 'l':
+                p++;
+                if ('l' == *p) {
+                        p++;
+                        spec->len = XWLOG_ASYNC_LEN_LL;
+                } else {
+                        spec->len = XWLOG_ASYNC_LEN_L;
+                }
+                break;
+        case 'z':
+                p++;
+                spec->len = XWLOG_ASYNC_LEN_Z;
+                break;
+        case 'j':
+                p++;
+                spec->len = XWLOG_ASYNC_LEN_J;
+                break;
+        case 't':
+                p++;
+                spec->len = XWLOG_ASYNC_LEN_T;
+                break;
+        case 'L':
+                p++;
+                spec->len = XWLOG_ASYNC_LEN_BIGL;
+                break;
+        default:
+                spec->len = XWLOG_ASYNC_LEN_NONE;
+                break;
+        }
+        spec->conv = *p;
+        switch (*p) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+                spec->arg = XWLOG_ASYNC_ARG_INT;
+                break;
+        case 'c':
+                spec->arg = XWLOG_ASYNC_ARG_CHAR;
+                break;
+        case 'p':
+                spec->arg = XWLOG_ASYNC_ARG_PTR;
+                break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+                spec->arg = XWLOG_ASYNC_ARG_DBL;
+                break;
+        case 's':
+                spec->arg = XWLOG_ASYNC_ARG_STR;
+                break;
+        case 'n':
+                spec->arg = XWLOG_ASYNC_ARG_SKIP;
+                break;
+        default:
+                spec->arg = XWLOG_ASYNC_ARG_NONE;
+                spec->conv = '\0';
+                break;
+        }
+        if ('\0' != *p) {
+                p++;
+        }
+        return p;
+}
+
+/**
+ * @brief 按长度修饰符读取一个整数参数，并扩展为64位
+ * @param[in] ap: 指向参数列表的指针
+ * @param[in] len: 长度修饰符
+ * @param[in] sign: 是否为有符号数
+ * @details
+ * 有符号数做符号扩展，无符号数做零扩展，
+ * 输出时统一使用 `ll` 长度修饰符，结果与原来的长度相同。
+ */
+static __xwlib_code
+xwu64_t xwlog_async_fetch_int(va_list * ap, xwu8_t len, bool sign)
+{
+        xwu64_t v;
+
+        if (sign) {
+                switch (len) {
+                case XWLOG_ASYNC_LEN_HH:
+                        v = (xwu64_t)(xws64_t)(signed char)va_arg(*ap, int);
+                        break;
+                case XWLOG_ASYNC_LEN_H:
+                        v = (xwu64_t)(xws64_t)(short)va_arg(*ap, int);
+                        break;
+                case XWLOG_ASYNC_LEN_L:
+                        v = (xwu64_t)(xws64_t)va_arg(*ap, long);
+                        break;
+                case XWLOG_ASYNC_LEN_LL:
+                        v = (xwu64_t)(xws64_t)va_arg(*ap, long long);
+                        break;
+                case XWLOG_ASYNC_LEN_Z:
+                        v = (xwu64_t)(xws64_t)va_arg(*ap, ptrdiff_t);
+                        break;
+                case XWLOG_ASYNC_LEN_J:
+                        v = (xwu64_t)(xws64_t)va_arg(*ap, intmax_t);
+                        break;
+                case XWLOG_ASYNC_LEN_T:
+                        v = (xwu64_t)(xws64_t)va_arg(*ap, ptrdiff_t);
+                        break;
+                default:
+                        v = (xwu64_t)(xws64_t)va_arg(*ap, int);
+                        break;
+                }
+        } else {
+                switch (len) {
+                case XWLOG_ASYNC_LEN_HH:
+                        v = (xwu64_t)(unsigned char)va_arg(*ap, unsigned int);
+                        break;
+                case XWLOG_ASYNC_LEN_H:
+                        v = (xwu64_t)(unsigned short)va_arg(*ap, unsigned int);
+                        break;
+                case XWLOG_ASYNC_LEN_L:
+                        v = (xwu64_t)va_arg(*ap, unsigned long);
+                        break;
+                case XWLOG_ASYNC_LEN_LL:
+                        v = (xwu64_t)va_arg(*ap, unsigned long long);
+                        break;
+                case XWLOG_ASYNC_LEN_Z:
+                        v = (xwu64_t)va_arg(*ap, size_t);
+                        break;
+                case XWLOG_ASYNC_LEN_J:
+                        v = (xwu64_t)va_arg(*ap, uintmax_t);
+                        break;
+                case XWLOG_ASYNC_LEN_T:
+                        v = (xwu64_t)(size_t)va_arg(*ap, ptrdiff_t);
+                        break;
+                default:
+                        v = (xwu64_t)va_arg(*ap, unsigned int);
+                        break;
+                }
+        }
+        return v;
+}
+
+/**
+ * @brief 获取转换说明中以数字给出的精度
+ * @return 精度，没有精度或精度由参数指定时返回 `-1`
+ */
+static __xwlib_code
+int xwlog_async_spec_prec(const struct xwlog_async_spec * spec)
+{
+        xwsz_t n;
+        int prec;
+
+        if ((!spec->hasprec) || spec->precstar) {
+                prec = -1;
+        } else {
+                prec = 0;
+                for (n = 0; n < spec->preclen; n++) {
+                        prec = (prec * 10) + (int)(spec->prec[n] - '0');
+                }
+        }
+        return prec;
+}
+
+/**
+ * @brief 计算一个转换说明的参数在记录中占用的固定大小
+ * @details
+ * 字符串只计算长度字段，不计算内容。
+ */
+static __xwlib_code
+xwsz_t xwlog_async_spec_fixsize(const struct xwlog_async_spec * spec)
+{
+        xwsz_t size;
+
+        size = 0;
+        if (spec->widthstar) {
+                size += sizeof(int);
+        }
+        if (spec->precstar) {
+                size += sizeof(int);
+        }
+        switch (spec->arg) {
+        case XWLOG_ASYNC_ARG_CHAR:
+                size += sizeof(int);
+                break;
+        case XWLOG_ASYNC_ARG_INT:
+                size += sizeof(xwu64_t);
+                break;
+        case XWLOG_ASYNC_ARG_PTR:
+                size += sizeof(void *);
+                break;
+        case XWLOG_ASYNC_ARG_DBL:
+                size += sizeof(double);
+                break;
+        case XWLOG_ASYNC_ARG_STR:
+                size += sizeof(xwu16_t);
+                break;
+        default:
+                break;
+        }
+        return size;
+}
+
+/**
+ * @brief 计算格式字符串中所有参数在记录中占用的固定大小
+ */
+static __xwlib_code
+xwsz_t xwlog_async_fixsize(const char * fmt)
+{
+        struct xwlog_async_spec spec;
+        const char * p;
+        xwsz_t size;
+
+        size = 0;
+        p = fmt;
+        while ('\0' != *p) {
+                if ('%' != *p) {
+                        p++;
+                } else if ('%' == p[1]) {
+                        p += 2;
+                } else {
+                        memset(&spec, 0, sizeof(spec)); // cppcheck-suppress [misra-c2012-17.7]
+                        p = xwlog_async_parse(&p[1], &spec);
+                        size += xwlog_async_spec_fixsize(&spec);
+                }
+        }
+        return size;
+}
+
+/**
+ * @brief 向记录中追加数据
+ * @return 空间是否足够
+ */
+static __xwlib_code
+bool xwlog_async_put(xwu8_t rec[], xwsz_t * pos, const void * data, xwsz_t size)
+{
+        bool ok;
+
+        if (size <= (XWLIBCFG_XWLOG_ASYNC_RECSIZE - *pos)) {
+                memcpy(&rec[*pos], data, size); // cppcheck-suppress [misra-c2012-17.7]
+                *pos += size;
+                ok = true;
+        } else {
+                ok = false;
+        }
+        return ok;
+}
+
+/**
+ * @brief 将参数按照格式字符串编码到记录中
+ * @param[in] rec: 记录的缓冲区
+ * @param[in] fmt: 格式字符串
+ * @param[in] ap: 指向参数列表的指针
+ * @return 记录的实际大小，为 `0` 表示记录的缓冲区不足
+ */
+static __xwlib_code
+xwsz_t xwlog_async_encode(xwu8_t rec[], const char * fmt, va_list * ap)
+{
+        struct xwlog_async_spec spec;
+        const char * p;
+        const char * s;
+        xwsz_t pos;
+        xwsz_t max;
+        xwsz_t fixed;
+        xwu16_t slen;
+        xwu64_t v;
+        void * ptr;
+        double d;
+        int prec;
+        int i;
+        bool ok;
+
+        pos = sizeof(struct xwlog_async_rec);
+        /* 先计算参数的固定大小，字符串只能使用剩余的空间，
+           被截断也不会挤掉后面的参数 */
+        fixed = xwlog_async_fixsize(fmt);
+        ok = (fixed <= (XWLIBCFG_XWLOG_ASYNC_RECSIZE - pos));
+        p = fmt;
+        while (ok && ('\0' != *p)) {
+                if ('%' != *p) {
+                        p++;
+                        continue;
+                }
+                p++;
+                if ('%' == *p) {
+                        p++;
+                        continue;
+                }
+                memset(&spec, 0, sizeof(spec)); // cppcheck-suppress [misra-c2012-17.7]
+                p = xwlog_async_parse(p, &spec);
+                fixed -= xwlog_async_spec_fixsize(&spec);
+                if (spec.widthstar) {
+                        i = va_arg(*ap, int);
+                        ok = xwlog_async_put(rec, &pos, &i, sizeof(i));
+                }
+                if (ok && spec.precstar) {
+                        prec = va_arg(*ap, int);
+                        ok = xwlog_async_put(rec, &pos, &prec, sizeof(prec));
+                } else {
+                        prec = xwlog_async_spec_prec(&spec);
+                }
+                if (!ok) {
+                        break;
+                }
+                switch (spec.arg) {
+                case XWLOG_ASYNC_ARG_CHAR:
+                        i = va_arg(*ap, int);
+                        ok = xwlog_async_put(rec, &pos, &i, sizeof(i));
+                        break;
+                case XWLOG_ASYNC_ARG_INT:
+                        v = xwlog_async_fetch_int(ap, spec.len,
+                                                  ('d' == spec.conv) ||
+                                                  ('i' == spec.conv));
+                        ok = xwlog_async_put(rec, &pos, &v, sizeof(v));
+                        break;
+                case XWLOG_ASYNC_ARG_PTR:
+                        ptr = va_arg(*ap, void *);
+                        ok = xwlog_async_put(rec, &pos, &ptr, sizeof(ptr));
+                        break;
+                case XWLOG_ASYNC_ARG_DBL:
+                        if (XWLOG_ASYNC_LEN_BIGL == spec.len) {
+                                d = (double)va_arg(*ap, long double);
+                        } else {
+                                d = va_arg(*ap, double);
+                        }
+                        ok = xwlog_async_put(rec, &pos, &d, sizeof(d));
+                        break;
+                case XWLOG_ASYNC_ARG_STR:
+                        /* 字符串可能在调用者的栈上，必须复制内容，
+                           剩余空间不足时截断 */
+                        s = va_arg(*ap, const char *);
+                        if (NULL == s) {
+                                s = "(null)";
+                        }
+                        max = XWLIBCFG_XWLOG_ASYNC_RECSIZE - pos - sizeof(slen) - fixed;
+                        if ((prec >= 0) && ((xwsz_t)prec < max)) {
+                                max = (xwsz_t)prec;
+                        }
+                        if (max > 0xFFFFU) {
+                                max = 0xFFFFU;
+                        }
+                        slen = 0;
+                        while ((slen < max) && ('\0' != s[slen])) {
+                                slen++;
+                        }
+                        ok = xwlog_async_put(rec, &pos, &slen, sizeof(slen)) &&
+                             xwlog_async_put(rec, &pos, s, slen);
+                        break;
+                case XWLOG_ASYNC_ARG_SKIP:
+                        ptr = va_arg(*ap, void *);
+                        XWOS_UNUSED(ptr);
+                        break;
+                default:
+                        break;
+                }
+        }
+        if (!ok) {
+                pos = 0;
+        }
+        return pos;
+}
+
+/**
+ * @brief 将一条记录写入当前CPU的环形缓冲区
+ * @param[in] rec: 记录，头部已填写
+ * @param[in] size: 记录的实际大小，为 `0` 表示记录过长
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENOSPC: 环形缓冲区已满，记录被丢弃
+ * @retval -E2BIG: 记录过长，记录被丢弃
+ */
+static __xwlib_code
+xwer_t xwlog_async_push(const xwu8_t rec[], xwsz_t size)
+{
+        struct xwlog_async_rec * hdr;
+        struct xwlog_async_ring * ring;
+        xwsz_t need;
+        xwsz_t pad;
+        xwsz_t off;
+        xwsq_t head;
+        xwsq_t tail;
+        xwreg_t cpuirq;
+        bool wakeup;
+        xwer_t rc;
+
+        need = XWBOP_ALIGN(size, XWLOG_ASYNC_RECALIGN);
+        wakeup = false;
+        xwos_cpuirq_save_lc(&cpuirq);
+        ring = &xwlog_async.ring[xwos_skd_get_cpuid_lc()];
+        if (0U == size) {
+                ring->dropped++;
+                rc = -E2BIG;
+        } else {
+                head = ring->head;
+                xwmb_mp_load_acquire(xwsq_t, tail, &ring->tail);
+                off = (xwsz_t)head & XWLOG_ASYNC_RINGMSK;
+                pad = XWLOG_ASYNC_RINGSIZE - off;
+                if (pad >= need) {
+                        pad = 0;
+                }
+                if ((need + pad) > (XWLOG_ASYNC_RINGSIZE - (xwsz_t)(head - tail))) {
+                        ring->dropped++;
+                        rc = -ENOSPC;
+                } else {
+                        wakeup = (head == tail);
+                        if (pad > 0U) {
+                                /* 末尾空间不足，填充后回绕到开头 */
+                                hdr = (struct xwlog_async_rec *)&ring->buf[off];
+                                hdr->fmt = NULL;
+                                hdr->size = pad;
+                                off = 0;
+                        }
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        memcpy(&ring->buf[off], rec, size);
+                        xwmb_mp_store_release(xwsq_t, &ring->head, head + pad + need);
+                        ring->logged++;
+                        rc = XWOK;
+                }
+        }
+        xwos_cpuirq_restore_lc(cpuirq);
+        if (wakeup) {
+                xwos_sem_post(&xwlog_async.sem); // cppcheck-suppress [misra-c2012-17.7]
+        }
+        return rc;
+}
+
+/**
+ * @brief XWOS API：记录一条异步日志
+ * @param[in] fmt: 格式的字符串，必须是静态的
+ * @param[in] ...: 需要格式化的参数
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENOSPC: 环形缓冲区已满，日志被丢弃
+ * @retval -E2BIG: 日志过长，日志被丢弃
+ * @note
+ * + 上下文：任意
+ * @details
+ * 排空线程创建之前，日志同步输出。
+ */
+__xwlib_code
+xwer_t xwlog_async_pf(const char * fmt, ...)
+{
+        xwu8_t rec[XWLIBCFG_XWLOG_ASYNC_RECSIZE] __xwcc_aligned(sizeof(xwptr_t));
+        struct xwlog_async_rec * hdr;
+        va_list args;
+        xwsz_t size;
         xwer_t rc;
         int i;
-        xwsz_t sz;
-        char buf[XWLIBCFG_XWLOG_BUFSIZE];
 
         va_start(args, fmt);
-        i = vsnprintf(buf, sizeof(buf), fmt, args);
+        if (!xwmb_access(bool, xwlog_async.started)) {
+                i = xwlog_vpf(fmt, args);
+                va_end(args);
+                rc = (i < 0) ? (xwer_t)i : XWOK;
+                goto out;
+        }
+        size = xwlog_async_encode(rec, fmt, &args);
         va_end(args);
-        if (i < 0) {
-                goto err_vsnprintf;
+        hdr = (struct xwlog_async_rec *)rec;
+        hdr->fmt = fmt;
+        hdr->size = size;
+        rc = xwlog_async_push(rec, size);
+
+out:
+        return rc;
+}
+
+/**
+ * @brief 将十进制数追加到转换说明中
+ */
+static __xwlib_code
+void xwlog_async_spec_num(char specbuf[], xwsz_t * sp, int num)
+{
+        char digits[12];
+        xwsz_t n;
+        unsigned int v;
+
+        v = (num < 0) ? (0U - (unsigned int)num) : (unsigned int)num;
+        n = 0;
+        do {
+                digits[n] = (char)('0' + (int)(v % 10U));
+                n++;
+                v /= 10U;
+        } while (v > 0U);
+        while (n > 0U) {
+                n--;
+                specbuf[*sp] = digits[n];
+                (*sp)++;
         }
-        sz = (xwsz_t)i;
+}
 
-        /* Print the string */
-#if defined(SOCCFG_LOG) && (1 == SOCCFG_LOG)
-        rc = soc_log_write(buf, &sz);
-        if (rc < 0) {
-                i = (int)rc;
+/**
+ * @brief 重建可以直接传给 `snprintf()` 的转换说明
+ * @param[in] spec: 解析后的转换说明
+ * @param[in] width: 由参数指定的宽度
+ * @param[in] prec: 精度，小于 `0` 表示没有精度
+ * @param[out] specbuf: 返回转换说明
+ * @details
+ * + 由参数指定的宽度与精度替换为数字；
+ * + 整数统一使用 `ll` 长度修饰符，浮点数去掉 `L` 长度修饰符。
+ */
+static __xwlib_code
+void xwlog_async_mkspec(const struct xwlog_async_spec * spec, int width, int prec,
+                        char specbuf[])
+{
+        xwsz_t sp;
+
+        sp = 0;
+        specbuf[sp] = '%';
+        sp++;
+        memcpy(&specbuf[sp], spec->flags, spec->flagslen); // cppcheck-suppress [misra-c2012-17.7]
+        sp += spec->flagslen;
+        if (spec->widthstar) {
+                if (width < 0) {
+                        specbuf[sp] = '-';
+                        sp++;
+                }
+                xwlog_async_spec_num(specbuf, &sp, width);
         } else {
-                i = (int)sz;
+                memcpy(&specbuf[sp], spec->width, spec->widthlen); // cppcheck-suppress [misra-c2012-17.7]
+                sp += spec->widthlen;
         }
-#elif defined(BRDCFG_LOG) && (1 == BRDCFG_LOG)
-        rc = board_log_write(buf, &sz);
+        if (prec >= 0) {
+                specbuf[sp] = '.';
+                sp++;
+                xwlog_async_spec_num(specbuf, &sp, prec);
+        }
+        if (XWLOG_ASYNC_ARG_INT == spec->arg) {
+                specbuf[sp] = 'l';
+                sp++;
+                specbuf[sp] = 'l';
+                sp++;
+        }
+        specbuf[sp] = spec->conv;
+        sp++;
+        specbuf[sp] = '\0';
+}
+
+/**
+ * @brief 从记录中读取数据
+ */
+static __xwlib_code
+void xwlog_async_get(const xwu8_t rec[], xwsz_t * pos, void * data, xwsz_t size)
+{
+        memcpy(data, &rec[*pos], size); // cppcheck-suppress [misra-c2012-17.7]
+        *pos += size;
+}
+
+/**
+ * @brief 将一条记录格式化为字符串
+ * @param[in] hdr: 记录
+ * @param[out] buf: 字符串缓冲区
+ * @param[in] bufsize: 字符串缓冲区的大小
+ * @return 字符串的长度，超出缓冲区的部分被截断
+ */
+static __xwlib_code
+xwsz_t xwlog_async_format(const struct xwlog_async_rec * hdr,
+                          char buf[], xwsz_t bufsize)
+{
+        struct xwlog_async_spec spec;
+        char specbuf[XWLOG_ASYNC_SPECSIZE];
+        const xwu8_t * rec;
+        const char * p;
+        const char * start;
+        xwsz_t pos;
+        xwsz_t out;
+        xwu16_t slen;
+        xwu64_t v;
+        void * ptr;
+        double d;
+        int width;
+        int prec;
+        int i;
+
+        rec = (const xwu8_t *)hdr;
+        pos = sizeof(struct xwlog_async_rec);
+        out = 0;
+        p = hdr->fmt;
+        while (('\0' != *p) && (out < (bufsize - 1U))) {
+                if ('%' != *p) {
+                        buf[out] = *p;
+                        out++;
+                        p++;
+                        continue;
+                }
+                p++;
+                if ('%' == *p) {
+                        buf[out] = '%';
+                        out++;
+                        p++;
+                        continue;
+                }
+                memset(&spec, 0, sizeof(spec)); // cppcheck-suppress [misra-c2012-17.7]
+                start = p;
+                p = xwlog_async_parse(p, &spec);
+                width = 0;
+                if (spec.widthstar) {
+                        xwlog_async_get(rec, &pos, &width, sizeof(width));
+                }
+                if (spec.precstar) {
+                        xwlog_async_get(rec, &pos, &prec, sizeof(prec));
+                } else {
+                        prec = xwlog_async_spec_prec(&spec);
+                }
+                i = 0;
+                switch (spec.arg) {
+                case XWLOG_ASYNC_ARG_CHAR:
+                        xwlog_async_get(rec, &pos, &i, sizeof(i));
+                        xwlog_async_mkspec(&spec, width, prec, specbuf);
+                        i = snprintf(&buf[out], bufsize - out, specbuf, i);
+                        break;
+                case XWLOG_ASYNC_ARG_INT:
+                        xwlog_async_get(rec, &pos, &v, sizeof(v));
+                        xwlog_async_mkspec(&spec, width, prec, specbuf);
+                        if (('d' == spec.conv) || ('i' == spec.conv)) {
+                                i = snprintf(&buf[out], bufsize - out, specbuf,
+                                             (long long)v);
+                        } else {
+                                i = snprintf(&buf[out], bufsize - out, specbuf,
+                                             (unsigned long long)v);
+                        }
+                        break;
+                case XWLOG_ASYNC_ARG_PTR:
+                        xwlog_async_get(rec, &pos, &ptr, sizeof(ptr));
+                        xwlog_async_mkspec(&spec, width, prec, specbuf);
+                        i = snprintf(&buf[out], bufsize - out, specbuf, ptr);
+                        break;
+                case XWLOG_ASYNC_ARG_DBL:
+                        xwlog_async_get(rec, &pos, &d, sizeof(d));
+                        xwlog_async_mkspec(&spec, width, prec, specbuf);
+                        i = snprintf(&buf[out], bufsize - out, specbuf, d);
+                        break;
+                case XWLOG_ASYNC_ARG_STR:
+                        /* 复制的内容没有结束符，以复制的长度作为精度 */
+                        xwlog_async_get(rec, &pos, &slen, sizeof(slen));
+                        xwlog_async_mkspec(&spec, width, (int)slen, specbuf);
+                        i = snprintf(&buf[out], bufsize - out, specbuf,
+                                     (const char *)&rec[pos]);
+                        pos += slen;
+                        break;
+                case XWLOG_ASYNC_ARG_NONE:
+                        /* 无效的转换说明，与同步输出一样原样输出整个转换说明 */
+                        i = snprintf(&buf[out], bufsize - out, "%%%.*s",
+                                     (int)(p - start), start);
+                        break;
+                default:
+                        break;
+                }
+                if (i > 0) {
+                        if ((xwsz_t)i < (bufsize - out)) {
+                                out += (xwsz_t)i;
+                        } else {
+                                out = bufsize - 1U;
+                        }
+                }
+        }
+        buf[out] = '\0';
+        return out;
+}
+
+/**
+ * @brief 批量输出缓冲区中的日志
+ */
+static __xwlib_code
+void xwlog_async_flush(void)
+{
+        if (xwlog_async.batchpos > 0U) {
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwlog_bin_output((const xwu8_t *)xwlog_async.batch, xwlog_async.batchpos);
+                xwlog_async.batchts = 0;
+#else
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwlog_write(xwlog_async.batch, xwlog_async.batchpos);
+#endif
+                xwlog_async.batchpos = 0;
+        }
+}
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+/**
+ * @brief 将一条二进制记录加入批量输出缓冲区，缓冲区不足时先输出
+ * @param[in] ts: 时间戳
+ * @param[in] head: 记录内容的第一部分
+ * @param[in] headsize: 第一部分的长度
+ * @param[in] body: 记录内容的第二部分
+ * @param[in] bodysize: 第二部分的长度
+ */
+static __xwlib_code
+void xwlog_async_emit_rec(xwtm_t ts,
+                          const xwu8_t head[], xwsz_t headsize,
+                          const xwu8_t body[], xwsz_t bodysize)
+{
+        xwu8_t dt[XWLOG_BIN_VARINT_MAX];
+        xwu8_t * batch;
+        xwsz_t dtsize;
+        xwsz_t pos;
+        xws64_t us;
+
+        if (((XWLOG_BIN_VARINT_MAX * 2U) + headsize + bodysize) >
+            (sizeof(xwlog_async.batch) - xwlog_async.batchpos)) {
+                xwlog_async_flush();
+        }
+        batch = (xwu8_t *)xwlog_async.batch;
+        pos = xwlog_async.batchpos;
+        us = ts / XWTM_US(1);
+        dtsize = xwlog_bin_varint(dt, xwlog_bin_zigzag(us - xwlog_async.batchts));
+        pos += xwlog_bin_varint(&batch[pos], (xwu64_t)(dtsize + headsize + bodysize));
+        memcpy(&batch[pos], dt, dtsize); // cppcheck-suppress [misra-c2012-17.7]
+        pos += dtsize;
+        if (headsize > 0U) {
+                memcpy(&batch[pos], head, headsize); // cppcheck-suppress [misra-c2012-17.7]
+                pos += headsize;
+        }
+        memcpy(&batch[pos], body, bodysize); // cppcheck-suppress [misra-c2012-17.7]
+        pos += bodysize;
+        xwlog_async.batchpos = pos;
+        xwlog_async.batchts = us;
+}
+
+/**
+ * @brief 将一条日志作为文本记录加入批量输出缓冲区
+ */
+static __xwlib_code
+void xwlog_async_emit(const char * s, xwsz_t n)
+{
+        xwu8_t head[3U + XWLOG_BIN_VARINT_MAX];
+        xwsz_t headsize;
+
+        head[0] = 0; /* 编号 `0` 表示文本记录 */
+        head[1] = (xwu8_t)((XWLOG_BIN_LV_TEXT << 4U) | 1U);
+        head[2] = (xwu8_t)XWLOG_BIN_ARG_STR;
+        headsize = 3U + xwlog_bin_varint(&head[3], (xwu64_t)n);
+        xwlog_async_emit_rec(xwtm_now(), head, headsize, (const xwu8_t *)s, n);
+}
+#else
+/**
+ * @brief 将一条日志加入批量输出缓冲区，缓冲区不足时先输出
+ */
+static __xwlib_code
+void xwlog_async_emit(const char * s, xwsz_t n)
+{
+        if (n > (sizeof(xwlog_async.batch) - xwlog_async.batchpos)) {
+                xwlog_async_flush();
+        }
+        memcpy(&xwlog_async.batch[xwlog_async.batchpos], s, n); // cppcheck-suppress [misra-c2012-17.7]
+        xwlog_async.batchpos += n;
+}
+#endif
+
+/**
+ * @brief 输出一条环形缓冲区中的记录
+ */
+static __xwlib_code
+void xwlog_async_drain_rec(const struct xwlog_async_rec * hdr)
+{
+        xwsz_t n;
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+        const xwu8_t * rec;
+        xwtm_t ts;
+
+        if (xwlog_async_binrec == hdr->fmt) {
+                rec = (const xwu8_t *)hdr;
+                n = sizeof(struct xwlog_async_rec);
+                memcpy(&ts, &rec[n], sizeof(ts)); // cppcheck-suppress [misra-c2012-17.7]
+                n += sizeof(ts);
+                xwlog_async_emit_rec(ts, NULL, 0, &rec[n], hdr->size - n);
+        } else {
+                n = xwlog_async_format(hdr, xwlog_async.line, sizeof(xwlog_async.line));
+                xwlog_async_emit(xwlog_async.line, n);
+        }
+#else
+        n = xwlog_async_format(hdr, xwlog_async.line, sizeof(xwlog_async.line));
+        xwlog_async_emit(xwlog_async.line, n);
+#endif
+}
+
+/**
+ * @brief 读取一个CPU的环形缓冲区中所有的日志
+ */
+static __xwlib_code
+void xwlog_async_drain_ring(xwid_t cpuid)
+{
+        struct xwlog_async_ring * ring;
+        const struct xwlog_async_rec * hdr;
+        xwsq_t head;
+        xwsq_t tail;
+        xwsq_t dropped;
+        xwsz_t n;
+        int i;
+
+        ring = &xwlog_async.ring[cpuid];
+        tail = ring->tail;
+        xwmb_mp_load_acquire(xwsq_t, head, &ring->head);
+        while (tail != head) {
+                hdr = (const struct xwlog_async_rec *)
+                      &ring->buf[(xwsz_t)tail & XWLOG_ASYNC_RINGMSK];
+                if (NULL != hdr->fmt) {
+                        xwlog_async_drain_rec(hdr);
+                }
+                tail += XWBOP_ALIGN(hdr->size, XWLOG_ASYNC_RECALIGN);
+                /* 及时释放空间，调用者不必等待整个缓冲区被读完 */
+                xwmb_mp_store_release(xwsq_t, &ring->tail, tail);
+        }
+        dropped = xwmb_access(xwsq_t, ring->dropped);
+        if (dropped != ring->reported) {
+                i = snprintf(xwlog_async.line, sizeof(xwlog_async.line),
+                             "W|xwlog CPU%lu dropped %lu messages\n",
+                             (unsigned long)cpuid,
+                             (unsigned long)(dropped - ring->reported));
+                if (i > 0) {
+                        n = ((xwsz_t)i < sizeof(xwlog_async.line)) ?
+                            (xwsz_t)i : (sizeof(xwlog_async.line) - 1U);
+                        xwlog_async_emit(xwlog_async.line, n);
+                }
+                ring->reported = dropped;
+        }
+}
+
+/**
+ * @brief 排空线程的主函数
+ */
+static __xwlib_code
+xwer_t xwlog_async_thd_main(void * arg)
+{
+        xwid_t cpuid;
+
+        XWOS_UNUSED(arg);
+        while (!xwos_cthd_shld_stop()) {
+                if (xwos_cthd_shld_frz()) {
+                        xwos_cthd_freeze(); // cppcheck-suppress [misra-c2012-17.7]
+                        continue;
+                }
+                for (cpuid = 0; cpuid < (xwid_t)CPUCFG_CPU_NUM; cpuid++) {
+                        xwlog_async_drain_ring(cpuid);
+                }
+                xwlog_async_flush();
+                /* 环形缓冲区由空变为非空时调用者会唤醒本线程，
+                   超时只是为了防止错过唤醒 */
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwos_sem_wait_to(&xwlog_async.sem, xwtm_ft(XWLOG_ASYNC_PERIOD));
+        }
+        return XWOK;
+}
+
+/**
+ * @brief XWOS API：启动异步日志
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EALREADY: 已经启动
+ * @note
+ * + 上下文：线程、 `xwos_main()`
+ * @details
+ * 创建低优先级的排空线程，之后 `xwlogf()` 的日志都异步输出。
+ * 通常在 `xwos_main()` 中启动调度器之前调用。
+ */
+__xwlib_code
+xwer_t xwlog_async_start(void)
+{
+        struct xwos_thd_attr attr;
+        xwer_t rc;
+
+        if (xwlog_async.started) {
+                rc = -EALREADY;
+                goto err_started;
+        }
+        rc = xwos_sem_init(&xwlog_async.sem, 0, 1);
         if (rc < 0) {
-                i = (int)rc;
+                goto err_sem_init;
+        }
+        xwos_thd_attr_init(&attr);
+        attr.name = "xwlog.async";
+        attr.stack = xwlog_async_stack;
+        attr.stack_size = sizeof(xwlog_async_stack);
+        attr.stack_guard_size = XWOS_STACK_GUARD_SIZE_DEFAULT;
+        attr.priority = XWLOG_ASYNC_PRIORITY;
+        attr.detached = true;
+        attr.privileged = true;
+        rc = xwos_thd_init(&xwlog_async.thd, &xwlog_async.thdd, &attr,
+                           xwlog_async_thd_main, NULL);
+        if (rc < 0) {
+                goto err_thd_init;
+        }
+        xwmb_mp_store_release(bool, &xwlog_async.started, true);
+        return XWOK;
+
+err_thd_init:
+        xwos_sem_fini(&xwlog_async.sem); // cppcheck-suppress [misra-c2012-17.7]
+err_sem_init:
+err_started:
+        return rc;
+}
+
+/**
+ * @brief XWOS API：获取异步日志的统计信息
+ * @param[out] stat: 指向缓冲区的指针，通过此缓冲区返回所有CPU的统计信息之和
+ * @note
+ * + 上下文：任意
+ */
+__xwlib_code
+void xwlog_async_get_stat(struct xwlog_async_stat * stat)
+{
+        xwid_t cpuid;
+
+        stat->logged = 0;
+        stat->dropped = 0;
+        for (cpuid = 0; cpuid < (xwid_t)CPUCFG_CPU_NUM; cpuid++) {
+                stat->logged += xwmb_access(xwsq_t, xwlog_async.ring[cpuid].logged);
+                stat->dropped += xwmb_access(xwsq_t, xwlog_async.ring[cpuid].dropped);
+        }
+}
+
+/**
+ * @} xwos_lib_xwlog_async
+ */
+#endif
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+/**
+ * @ingroup xwos_lib_xwlog_bin
+ * @{
+ */
+
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+/**
+ * @brief 在记录内容之前加上头部与时间戳，写入当前CPU的环形缓冲区
+ * @param[in] buf: 缓冲区，记录内容之前至少有头部与时间戳的空间
+ * @param[in] start: 记录内容的起始位置
+ * @param[in] end: 记录内容的结束位置
+ * @param[in] ts: 时间戳
+ */
+static __xwlib_code
+xwer_t xwlog_bin_push(xwu8_t buf[], xwsz_t start, xwsz_t end, xwtm_t ts)
+{
+        struct xwlog_async_rec hdr;
+
+        start -= sizeof(ts);
+        memcpy(&buf[start], &ts, sizeof(ts)); // cppcheck-suppress [misra-c2012-17.7]
+        start -= sizeof(hdr);
+        hdr.fmt = xwlog_async_binrec;
+        hdr.size = end - start;
+        memcpy(&buf[start], &hdr, sizeof(hdr)); // cppcheck-suppress [misra-c2012-17.7]
+        return xwlog_async_push(&buf[start], end - start);
+}
+#endif
+
+/**
+ * @brief 在记录中为一个参数预留空间
+ * @param[in] pk: 打包中的记录
+ * @param[in] type: 参数的类型
+ * @param[in] size: 参数的大小
+ * @return 参数在缓冲区中的位置，空间不足时返回 `NULL`
+ */
+static __xwlib_code
+xwu8_t * xwlog_bin_reserve(struct xwlog_bin_pack * pk, xwu8_t type, xwsz_t size)
+{
+        xwu8_t * p;
+        xwu8_t * tags;
+
+        if ((pk->full) || (pk->packed >= pk->nargs) ||
+            (size > (XWLOG_BIN_BUFSIZE - pk->pos))) {
+                /* 之后的参数也不再打包，解码时缺少的参数被视为已截断 */
+                pk->full = true;
+                p = NULL;
         } else {
-                i = (int)sz;
+                p = &pk->buf[pk->pos];
+                pk->pos += size;
+                tags = &pk->buf[pk->lvpos + 1U + ((xwsz_t)pk->packed / 2U)];
+                *tags |= (xwu8_t)(type << ((pk->packed & 1U) * 4U));
+                pk->packed++;
+        }
+        return p;
+}
+
+/**
+ * @brief 打包一个以varint编码的参数
+ */
+static __xwlib_code
+void xwlog_bin_put_varint(struct xwlog_bin_pack * pk, xwu8_t type, xwu64_t v)
+{
+        xwu8_t tmp[XWLOG_BIN_VARINT_MAX];
+        xwu8_t * p;
+        xwsz_t n;
+
+        n = xwlog_bin_varint(tmp, v);
+        p = xwlog_bin_reserve(pk, type, n);
+        if (NULL != p) {
+                memcpy(p, tmp, n); // cppcheck-suppress [misra-c2012-17.7]
+        }
+}
+
+/**
+ * @brief XWOS API：开始打包一条二进制日志
+ * @param[in] pk: 打包中的记录
+ * @param[in] buf: 缓冲区，大小为 @ref XWLOG_BIN_BUFSIZE
+ * @param[in] fmt: 字典中的格式字符串
+ * @param[in] lv: 等级
+ * @param[in] nargs: 参数的数量
+ * @note
+ * + 上下文：任意
+ * @details
+ * 由 `xwlogf()` 调用，通常不需要直接使用。
+ */
+__xwlib_code
+void xwlog_bin_begin(struct xwlog_bin_pack * pk, xwu8_t buf[],
+                     const char * fmt, xwu8_t lv, xwu8_t nargs)
+{
+        xwsz_t tagsize;
+
+        pk->buf = buf;
+        pk->pos = XWLOG_BIN_HEADROOM;
+        pk->pos += xwlog_bin_varint(&buf[pk->pos], (xwu64_t)(xwptr_t)fmt + 1U);
+        pk->lvpos = pk->pos;
+        buf[pk->lvpos] = (xwu8_t)((lv << 4U) | (nargs & 0xFU));
+        pk->pos++;
+        tagsize = ((xwsz_t)nargs + 1U) / 2U;
+        memset(&buf[pk->pos], 0, tagsize); // cppcheck-suppress [misra-c2012-17.7]
+        pk->pos += tagsize;
+        pk->lv = lv;
+        pk->nargs = nargs;
+        pk->packed = 0;
+        pk->full = false;
+}
+
+/**
+ * @brief XWOS API：打包一个有符号整数参数
+ * @param[in] pk: 打包中的记录
+ * @param[in] v: 参数
+ * @note
+ * + 上下文：任意
+ */
+__xwlib_code
+void xwlog_bin_put_sint(struct xwlog_bin_pack * pk, xws64_t v)
+{
+        xwlog_bin_put_varint(pk, XWLOG_BIN_ARG_SINT, xwlog_bin_zigzag(v));
+}
+
+/**
+ * @brief XWOS API：打包一个无符号整数参数
+ * @param[in] pk: 打包中的记录
+ * @param[in] v: 参数
+ * @note
+ * + 上下文：任意
+ */
+__xwlib_code
+void xwlog_bin_put_uint(struct xwlog_bin_pack * pk, xwu64_t v)
+{
+        xwlog_bin_put_varint(pk, XWLOG_BIN_ARG_UINT, v);
+}
+
+/**
+ * @brief XWOS API：打包一个浮点数参数
+ * @param[in] pk: 打包中的记录
+ * @param[in] v: 参数
+ * @note
+ * + 上下文：任意
+ */
+__xwlib_code
+void xwlog_bin_put_dbl(struct xwlog_bin_pack * pk, double v)
+{
+        xwu8_t * p;
+
+        p = xwlog_bin_reserve(pk, XWLOG_BIN_ARG_DBL, sizeof(v));
+        if (NULL != p) {
+                memcpy(p, &v, sizeof(v)); // cppcheck-suppress [misra-c2012-17.7]
+        }
+}
+
+/**
+ * @brief XWOS API：打包一个字符串参数
+ * @param[in] pk: 打包中的记录
+ * @param[in] s: 参数
+ * @note
+ * + 上下文：任意
+ * @details
+ * 字符串可能在调用者的栈上，必须复制内容。
+ * 剩余空间不足时截断，并为后面的每个参数预留少量空间。
+ */
+__xwlib_code
+void xwlog_bin_put_str(struct xwlog_bin_pack * pk, const char * s)
+{
+        xwu8_t tmp[XWLOG_BIN_VARINT_MAX];
+        xwu8_t * p;
+        xwsz_t room;
+        xwsz_t rsv;
+        xwsz_t max;
+        xwsz_t slen;
+        xwsz_t n;
+
+        if (NULL == s) {
+                s = "(null)";
+        }
+        room = XWLOG_BIN_BUFSIZE - pk->pos;
+        rsv = (pk->packed < pk->nargs) ?
+              (((xwsz_t)pk->nargs - pk->packed - 1U) * XWLOG_BIN_STR_RSV) : 0U;
+        rsv += 2U; /* 长度字段，记录中的字符串不会超过16383字节 */
+        max = (room > rsv) ? (room - rsv) : 0U;
+        slen = 0;
+        while ((slen < max) && ('\0' != s[slen])) {
+                slen++;
+        }
+        n = xwlog_bin_varint(tmp, (xwu64_t)slen);
+        p = xwlog_bin_reserve(pk, XWLOG_BIN_ARG_STR, n + slen);
+        if (NULL != p) {
+                memcpy(p, tmp, n); // cppcheck-suppress [misra-c2012-17.7]
+                memcpy(&p[n], s, slen); // cppcheck-suppress [misra-c2012-17.7]
+        }
+}
+
+/**
+ * @brief XWOS API：打包一个指针参数
+ * @param[in] pk: 打包中的记录
+ * @param[in] p: 参数
+ * @note
+ * + 上下文：任意
+ */
+__xwlib_code
+void xwlog_bin_put_ptr(struct xwlog_bin_pack * pk, const void * p)
+{
+        xwlog_bin_put_varint(pk, XWLOG_BIN_ARG_PTR, (xwu64_t)(xwptr_t)p);
+}
+
+/**
+ * @brief XWOS API：完成打包，输出二进制日志
+ * @param[in] pk: 打包中的记录
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENOSPC: 环形缓冲区已满，日志被丢弃
+ * @note
+ * + 上下文：依赖输出函数，启动异步日志后为任意
+ * @details
+ * 启动异步日志后，记录写入当前CPU的环形缓冲区，由排空线程成批输出；
+ * 否则立即作为只有一条记录的一批输出。
+ */
+__xwlib_code
+xwer_t xwlog_bin_commit(struct xwlog_bin_pack * pk)
+{
+        xwtm_t ts;
+        xwer_t rc;
+
+        ts = xwtm_now();
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+        if (xwmb_access(bool, xwlog_async.started)) {
+                rc = xwlog_bin_push(pk->buf, XWLOG_BIN_HEADROOM, pk->pos, ts);
+        } else {
+                rc = xwlog_bin_send(pk->buf, XWLOG_BIN_HEADROOM, pk->pos, ts);
         }
 #else
-#  warning "Can't find the log configurations!"
-        i = 0;
+        rc = xwlog_bin_send(pk->buf, XWLOG_BIN_HEADROOM, pk->pos, ts);
 #endif
+        return rc;
+}
 
-err_vsnprintf:
-        return i;
+/**
+ * @brief XWOS API：设置二进制日志的输出函数
+ * @param[in] sink: 输出函数，为 `NULL` 时恢复默认的 @ref xwlog_bin_uart_sink()
+ * @param[in] arg: 输出函数的参数
+ * @note
+ * + 上下文：任意
+ * @details
+ * 输出函数在排空线程中调用，未启动异步日志时在 `xwlogf()` 的调用者中调用。
+ * 更换输出函数时，正在输出的一批记录可能仍使用原来的输出函数。
+ */
+__xwlib_code
+void xwlog_bin_set_sink(xwlog_bin_sink_f sink, void * arg)
+{
+        xwmb_access(void *, xwlog_bin.arg) = arg;
+        xwmb_mp_store_release(xwlog_bin_sink_f, &xwlog_bin.sink, sink);
 }
+
+/**
+ * @} xwos_lib_xwlog_bin
+ */
+#endif
@@ -23,73 +23,286 @@
 
 int xwpf(const char * fmt, ...);
 
+#if defined(XWLIBCFG_XWLOG_ASYNC) && (1 == XWLIBCFG_XWLOG_ASYNC)
+/**
+ * @brief 异步日志的统计信息
+ */
+struct xwlog_async_stat {
+        xwsq_t logged; /**< 已写入环形缓冲区的日志数量 */
+        xwsq_t dropped; /**< 因环形缓冲区已满或日志过长而丢弃的日志数量 */
+};
+
+xwer_t xwlog_async_start(void);
+xwer_t xwlog_async_pf(const char * fmt, ...);
+void xwlog_async_get_stat(struct xwlog_async_stat * stat);
+
+/**
+ * @brief 日志宏使用的输出函数：异步
+ */
+#  define XWLOG_PF(fmt, ...) xwlog_async_pf(fmt, ##__VA_ARGS__)
+#else
+/**
+ * @brief 日志宏使用的输出函数：同步
+ */
+#  define XWLOG_PF(fmt, ...) xwpf(fmt, ##__VA_ARGS__)
+#endif
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN)
+/**
+ * @defgroup xwos_lib_xwlog_bin 二进制日志
+ * @ingroup xwos_lib_xwlog
+ * 打开配置 `XWLIBCFG_XWLOG_BIN` 后，C语言中的 `xwlogf()` 不再输出文本：
+ *
+ * + 每个调用点的 `"标签 格式字符串"` 被放入段 `.xwlog.dict` 中，
+ *   连接脚本将此段放在不加载的地址 `0` 处，只保留在ELF文件中作为字典，
+ *   字符串的地址就是它的编号，固件中不再包含任何格式字符串；
+ * + 调用点只将编号、等级、时间戳与参数的原始值打包成紧凑的二进制记录，
+ *   参数的类型由 `_Generic` 在编译时确定，不需要在运行时解析格式字符串；
+ * + 主机端工具 `xwbs/util/py/xwlogdec.py` 从ELF文件中读取字典，
+ *   将记录还原为文本。
+ *
+ * 记录通过 @ref xwlog_bin_set_sink() 设置的输出函数成批输出，
+ * 默认的输出函数 @ref xwlog_bin_uart_sink() 将每批记录按COBS编码后，
+ * 以 `0x00` 作为分隔符写入 `soc_log_write()` 或 `board_log_write()` 。
+ * 也可以通过XWSSC的端口输出，参考 `xwssc_log_sink()` 。
+ * 打开 `XWLIBCFG_XWLOG_ASYNC` 并启动异步日志后，记录写入每CPU的环形缓冲区，
+ * 由排空线程成批输出。
+ *
+ *
+ * ## 数据格式
+ *
+ * 一批记录由若干条记录首尾相连组成，每条记录：
+ *
+ * + 记录的长度（不包括此字段）：varint；
+ * + 与上一条记录的时间戳之差，单位为微秒：zigzag varint，
+ *   每批的第一条记录与 `0` 相比，即系统时间的绝对值；
+ * + 编号：varint，为 `0` 表示文本记录，否则为字符串在字典中的地址加 `1` ；
+ * + 等级与参数的数量：1字节，高4位为等级，文本记录的等级为 `15` ，低4位为参数的数量；
+ * + 参数的类型：每个参数4位，先低后高，共 `(参数的数量 + 1) / 2` 字节；
+ * + 参数：
+ *   - @ref XWLOG_BIN_ARG_SINT ：zigzag varint；
+ *   - @ref XWLOG_BIN_ARG_UINT 、 @ref XWLOG_BIN_ARG_PTR ：varint；
+ *   - @ref XWLOG_BIN_ARG_DBL ：小端的 `double` ，8字节；
+ *   - @ref XWLOG_BIN_ARG_STR ：长度（varint）与内容，没有结束符。
+ *
+ * 文本记录只有一个字符串参数，用于输出C++与 `xwpf()` 的文本。
+ *
+ * varint每个字节的低7位为数据，先低后高，最高位表示后面是否还有字节。
+ *
+ *
+ * ## 使用限制
+ *
+ * + 每条日志最多 @ref XWLOG_BIN_MAX_ARGS 个参数；
+ * + 参数打包后不能超过 `XWLIBCFG_XWLOG_BIN_RECSIZE` ，
+ *   字符串超出时被截断，其他参数超出时记录中只保留放得下的参数；
+ * + `xwlogf()` 成为语句，不能再作为表达式使用；
+ * + C++不支持 `_Generic` ，C++中的日志仍是文本，以文本记录输出。
+ * @{
+ */
+
+#define XWLOG_BIN_MAX_ARGS      (15U) /**< 每条日志的最大参数数量 */
+#define XWLOG_BIN_HEADROOM      (32U) /**< 缓冲区头部预留给记录头部的空间 */
+#define XWLOG_BIN_BUFSIZE       (XWLOG_BIN_HEADROOM + XWLIBCFG_XWLOG_BIN_RECSIZE)
+#define XWLOG_BIN_LV_TEXT       (15U) /**< 文本记录的等级 */
+
+/**
+ * @brief 二进制日志参数的类型
+ */
+enum xwlog_bin_arg_em {
+        XWLOG_BIN_ARG_SINT = 0, /**< 有符号整数 */
+        XWLOG_BIN_ARG_UINT, /**< 无符号整数 */
+        XWLOG_BIN_ARG_DBL, /**< 浮点数 */
+        XWLOG_BIN_ARG_STR, /**< 字符串 */
+        XWLOG_BIN_ARG_PTR, /**< 指针 */
+};
+
+/**
+ * @brief 打包中的二进制日志记录
+ */
+struct xwlog_bin_pack {
+        xwu8_t * buf; /**< 缓冲区，大小为 @ref XWLOG_BIN_BUFSIZE */
+        xwsz_t pos; /**< 写入的位置 */
+        xwsz_t lvpos; /**< 等级与参数的数量在缓冲区中的位置 */
+        xwu8_t lv; /**< 等级 */
+        xwu8_t nargs; /**< 调用点的参数数量 */
+        xwu8_t packed; /**< 已打包的参数数量 */
+        bool full; /**< 缓冲区已满，之后的参数被丢弃 */
+};
+
+/**
+ * @brief 输出一批二进制日志记录的函数
+ * @param[in] arg: 设置输出函数时的参数
+ * @param[in] data: 数据
+ * @param[in] size: 数据的长度
+ */
+typedef xwer_t (* xwlog_bin_sink_f)(void * arg, const xwu8_t data[], xwsz_t size);
+
+void xwlog_bin_begin(struct xwlog_bin_pack * pk, xwu8_t buf[],
+                     const char * fmt, xwu8_t lv, xwu8_t nargs);
+void xwlog_bin_put_sint(struct xwlog_bin_pack * pk, xws64_t v);
+void xwlog_bin_put_uint(struct xwlog_bin_pack * pk, xwu64_t v);
+void xwlog_bin_put_dbl(struct xwlog_bin_pack * pk, double v);
+void xwlog_bin_put_str(struct xwlog_bin_pack * pk, const char * s);
+void xwlog_bin_put_ptr(struct xwlog_bin_pack * pk, const void * p);
+xwer_t xwlog_bin_commit(struct xwlog_bin_pack * pk);
+void xwlog_bin_set_sink(xwlog_bin_sink_f sink, void * arg);
+xwer_t xwlog_bin_uart_sink(void * arg, const xwu8_t data[], xwsz_t size);
+
+/**
+ * @brief 按参数的类型选择打包函数
+ */
+#define xwlog_bin_put(pk, x) \
+        _Generic((x), \
+                 _Bool: xwlog_bin_put_uint, \
+                 char: xwlog_bin_put_sint, \
+                 signed char: xwlog_bin_put_sint, \
+                 unsigned char: xwlog_bin_put_uint, \
+                 short: xwlog_bin_put_sint, \
+                 unsigned short: xwlog_bin_put_uint, \
+                 int: xwlog_bin_put_sint, \
+                 unsigned int: xwlog_bin_put_uint, \
+                 long: xwlog_bin_put_sint, \
+                 unsigned long: xwlog_bin_put_uint, \
+                 long long: xwlog_bin_put_sint, \
+                 unsigned long long: xwlog_bin_put_uint, \
+                 float: xwlog_bin_put_dbl, \
+                 double: xwlog_bin_put_dbl, \
+                 long double: xwlog_bin_put_dbl, \
+                 char *: xwlog_bin_put_str, \
+                 const char *: xwlog_bin_put_str, \
+                 default: xwlog_bin_put_ptr)((pk), (x))
+
+#define XWLOG_BIN_NARG(...) \
+        XWLOG_BIN_NARG_(_, ##__VA_ARGS__, \
+                        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define XWLOG_BIN_NARG_(_0, _1, _2, _3, _4, _5, _6, _7, _8, \
+                        _9, _10, _11, _12, _13, _14, _15, n, ...) n
+#define XWLOG_BIN_CAT(a, b) XWLOG_BIN_CAT_(a, b)
+#define XWLOG_BIN_CAT_(a, b) a##b
+#define XWLOG_BIN_FE_0(m)
+#define XWLOG_BIN_FE_1(m, x) m(x)
+#define XWLOG_BIN_FE_2(m, x, ...) m(x) XWLOG_BIN_FE_1(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_3(m, x, ...) m(x) XWLOG_BIN_FE_2(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_4(m, x, ...) m(x) XWLOG_BIN_FE_3(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_5(m, x, ...) m(x) XWLOG_BIN_FE_4(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_6(m, x, ...) m(x) XWLOG_BIN_FE_5(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_7(m, x, ...) m(x) XWLOG_BIN_FE_6(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_8(m, x, ...) m(x) XWLOG_BIN_FE_7(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_9(m, x, ...) m(x) XWLOG_BIN_FE_8(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_10(m, x, ...) m(x) XWLOG_BIN_FE_9(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_11(m, x, ...) m(x) XWLOG_BIN_FE_10(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_12(m, x, ...) m(x) XWLOG_BIN_FE_11(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_13(m, x, ...) m(x) XWLOG_BIN_FE_12(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_14(m, x, ...) m(x) XWLOG_BIN_FE_13(m, __VA_ARGS__)
+#define XWLOG_BIN_FE_15(m, x, ...) m(x) XWLOG_BIN_FE_14(m, __VA_ARGS__)
+#define XWLOG_BIN_FOREACH(m, ...) \
+        XWLOG_BIN_CAT(XWLOG_BIN_FE_, XWLOG_BIN_NARG(__VA_ARGS__))(m, ##__VA_ARGS__)
+#define XWLOG_BIN_PUT(x) xwlog_bin_put(&xwlog_bin_pk, (x));
+
+/**
+ * @brief 打包并输出一条二进制日志
+ * @param[in] lv: 等级
+ * @param[in] tag: 日志标签
+ * @param[in] fmt: 格式的字符串
+ * @param[in] ...: 需要格式化的参数
+ */
+#define XWLOG_BIN(lv, tag, fmt, ...) \
+        do { \
+                static const char xwlog_bin_fmt[] \
+                        __xwcc_section(".xwlog.dict") = tag " " fmt; \
+                xwu8_t xwlog_bin_buf[XWLOG_BIN_BUFSIZE]; \
+                struct xwlog_bin_pack xwlog_bin_pk; \
+                xwlog_bin_begin(&xwlog_bin_pk, xwlog_bin_buf, xwlog_bin_fmt, \
+                                (lv), XWLOG_BIN_NARG(__VA_ARGS__)); \
+                XWLOG_BIN_FOREACH(XWLOG_BIN_PUT, ##__VA_ARGS__) \
+                xwlog_bin_commit(&xwlog_bin_pk); \
+        } while (0)
+
+/**
+ * @} xwos_lib_xwlog_bin
+ */
+#endif
+
+#if defined(XWLIBCFG_XWLOG_BIN) && (1 == XWLIBCFG_XWLOG_BIN) && \
+    !defined(__cplusplus)
+/**
+ * @brief 日志宏使用的输出方式：二进制记录
+ */
+#  define XWLOG_EMIT(lv, lvc, tag, fmt, ...) XWLOG_BIN(lv, tag, fmt, ##__VA_ARGS__)
+#else
+/**
+ * @brief 日志宏使用的输出方式：文本
+ */
+#  define XWLOG_EMIT(lv, lvc, tag, fmt, ...) XWLOG_PF(lvc "|" tag " " fmt, ##__VA_ARGS__)
+#endif
+
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 0)
-#  define XWLOGF_VERBOSE(tag, fmt, ...) xwpf("V|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_V(tag, fmt, ...) xwpf("V|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_VERBOSE(tag, fmt, ...) XWLOG_EMIT(0U, "V", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_V(tag, fmt, ...) XWLOG_EMIT(0U, "V", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_VERBOSE(tag, fmt, ...)
 #  define XWLOGF_V(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 1)
-#  define XWLOGF_DEBUG(tag, fmt, ...) xwpf("D|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_D(tag, fmt, ...) xwpf("D|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_DEBUG(tag, fmt, ...) XWLOG_EMIT(1U, "D", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_D(tag, fmt, ...) XWLOG_EMIT(1U, "D", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_DEBUG(tag, fmt, ...)
 #  define XWLOGF_D(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 2)
-#  define XWLOGF_INFO(tag, fmt, ...) xwpf("I|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_I(tag, fmt, ...) xwpf("I|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_INFO(tag, fmt, ...) XWLOG_EMIT(2U, "I", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_I(tag, fmt, ...) XWLOG_EMIT(2U, "I", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_INFO(tag, fmt, ...)
 #  define XWLOGF_I(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 3)
-#  define XWLOGF_NOTICE(tag, fmt, ...) xwpf("N|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_N(tag, fmt, ...) xwpf("N|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_NOTICE(tag, fmt, ...) XWLOG_EMIT(3U, "N", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_N(tag, fmt, ...) XWLOG_EMIT(3U, "N", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_NOTICE(tag, fmt, ...)
 #  define XWLOGF_N(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 4)
-#  define XWLOGF_WARNING(tag, fmt, ...) xwpf("W|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_W(tag, fmt, ...) xwpf("W|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_WARNING(tag, fmt, ...) XWLOG_EMIT(4U, "W", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_W(tag, fmt, ...) XWLOG_EMIT(4U, "W", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_WARNING(tag, fmt, ...)
 #  define XWLOGF_W(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 5)
-#  define XWLOGF_ERR(tag, fmt, ...) xwpf("E|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_E(tag, fmt, ...) xwpf("E|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_ERR(tag, fmt, ...) XWLOG_EMIT(5U, "E", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_E(tag, fmt, ...) XWLOG_EMIT(5U, "E", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_ERR(tag, fmt, ...)
 #  define XWLOGF_E(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 6)
-#  define XWLOGF_CRIT(tag, fmt, ...) xwpf("C|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_C(tag, fmt, ...) xwpf("C|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_CRIT(tag, fmt, ...) XWLOG_EMIT(6U, "C", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_C(tag, fmt, ...) XWLOG_EMIT(6U, "C", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_CRIT(tag, fmt, ...)
 #  define XWLOGF_C(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 7)
-#  define XWLOGF_ALERT(tag, fmt, ...) xwpf("A|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_A(tag, fmt, ...) xwpf("A|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_ALERT(tag, fmt, ...) XWLOG_EMIT(7U, "A", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_A(tag, fmt, ...) XWLOG_EMIT(7U, "A", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_ALERT(tag, fmt, ...)
 #  define XWLOGF_A(tag, fmt, ...)
 #endif
 
 #if defined(XWLIBCFG_LOG) && (1 == XWLIBCFG_LOG) && (XWLIBCFG_XWLOG_LEVEL <= 8)
-#  define XWLOGF_EMERG(tag, fmt, ...) xwpf("G|" tag " " fmt, ##__VA_ARGS__)
-#  define XWLOGF_G(tag, fmt, ...) xwpf("G|" tag " " fmt, ##__VA_ARGS__)
+#  define XWLOGF_EMERG(tag, fmt, ...) XWLOG_EMIT(8U, "G", tag, fmt, ##__VA_ARGS__)
+#  define XWLOGF_G(tag, fmt, ...) XWLOG_EMIT(8U, "G", tag, fmt, ##__VA_ARGS__)
 #else
 #  define XWLOGF_EMERG(tag, fmt, ...)
 #  define XWLOGF_G(tag, fmt, ...)
@@ -115,6 +328,13 @@ int xwpf(const char * fmt, ...);
  * @details
  * 如果底层 `soc_log_write()` 或 `board_log_write()` 的实现会导致线程睡眠，
  * 不可在除线程外的其他上下文使用。
+ *
+ * 打开配置 `XWLIBCFG_XWLOG_ASYNC` 后，日志通过 @ref xwlog_async_pf() 输出，
+ * 调用者只记录格式字符串的指针与参数，格式化与输出由低优先级的线程完成，
+ * 可以在任意上下文中使用。
+ *
+ * 打开配置 `XWLIBCFG_XWLOG_BIN` 后，C语言中的日志以二进制记录输出，
+ * 参考 @ref xwos_lib_xwlog_bin 。
  */
 #define xwlogf(lv, tag, fmt, ...) XWLOGF_##lv(tag, fmt, ##__VA_ARGS__)
 
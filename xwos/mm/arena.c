@@ -0,0 +1,386 @@
+/**
+ * @file
+ * @brief XWOS内存管理：竞技场分配器
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/mm/common.h>
+#if defined(XWMMCFG_MEMPOOL) && (1 == XWMMCFG_MEMPOOL)
+#  include <xwos/mm/mempool/allocator.h>
+#endif
+#if defined(XWMMCFG_BMA) && (1 == XWMMCFG_BMA)
+#  include <xwos/mm/bma.h>
+#endif
+#if defined(XWMMCFG_ARENA_CTHD) && (1 == XWMMCFG_ARENA_CTHD)
+#  include <xwos/osal/thd.h>
+#endif
+#include <xwos/mm/arena.h>
+
+static __xwos_code
+xwer_t xwmm_arena_blk_grow(struct xwmm_arena * arena, xwsz_t need);
+
+static __xwos_code
+void xwmm_arena_blk_shrink(struct xwmm_arena * arena,
+                           struct xwmm_arena_blk * until);
+
+#if defined(XWMMCFG_MEMPOOL) && (1 == XWMMCFG_MEMPOOL)
+static __xwos_code
+xwer_t xwmm_arena_mempool_alloc(void * parent, xwsz_t * size, void ** membuf);
+
+static __xwos_code
+xwer_t xwmm_arena_mempool_free(void * parent, void * mem);
+#endif
+
+#if defined(XWMMCFG_BMA) && (1 == XWMMCFG_BMA)
+static __xwos_code
+xwsq_t xwmm_arena_bma_size_to_order(struct xwmm_bma * bma, xwsz_t size);
+
+static __xwos_code
+xwer_t xwmm_arena_bma_alloc(void * parent, xwsz_t * size, void ** membuf);
+
+static __xwos_code
+xwer_t xwmm_arena_bma_free(void * parent, void * mem);
+#endif
+
+__xwos_api
+xwer_t xwmm_arena_init(struct xwmm_arena * arena, const char * name,
+                       void * parent,
+                       xwmm_arena_alloc_f alloc, xwmm_arena_free_f free,
+                       xwsz_t blksize)
+{
+        xwer_t rc;
+
+        XWOS_VALIDATE((arena), "nullptr", -EFAULT);
+        XWOS_VALIDATE((alloc), "nullptr", -EFAULT);
+        XWOS_VALIDATE((free), "nullptr", -EFAULT);
+
+        // cppcheck-suppress [misra-c2012-17.8]
+        blksize = XWBOP_ALIGN(blksize, (xwsz_t)XWMM_ALIGNMENT);
+        if (blksize <= XWMM_ARENA_BLKHDR_SIZE) {
+                rc = -E2SMALL;
+        } else {
+                arena->name = name;
+                arena->parent = parent;
+                arena->alloc = alloc;
+                arena->free = free;
+                arena->blksize = blksize;
+                arena->curr = NULL;
+                arena->used = 0;
+                arena->total = 0;
+                rc = XWOK;
+        }
+        return rc;
+}
+
+#if defined(XWMMCFG_MEMPOOL) && (1 == XWMMCFG_MEMPOOL)
+static __xwos_code
+xwer_t xwmm_arena_mempool_alloc(void * parent, xwsz_t * size, void ** membuf)
+{
+        return xwmm_mempool_malloc((struct xwmm_mempool *)parent, *size, membuf);
+}
+
+static __xwos_code
+xwer_t xwmm_arena_mempool_free(void * parent, void * mem)
+{
+        return xwmm_mempool_free((struct xwmm_mempool *)parent, mem);
+}
+
+__xwos_api
+xwer_t xwmm_arena_init_mempool(struct xwmm_arena * arena, const char * name,
+                               struct xwmm_mempool * mp, xwsz_t blksize)
+{
+        XWOS_VALIDATE((mp), "nullptr", -EFAULT);
+
+        return xwmm_arena_init(arena, name, mp,
+                               xwmm_arena_mempool_alloc, xwmm_arena_mempool_free,
+                               blksize);
+}
+#endif
+
+#if defined(XWMMCFG_BMA) && (1 == XWMMCFG_BMA)
+/**
+ * @brief 计算能容纳指定大小的伙伴算法内存块的阶
+ * @param[in] bma: 伙伴算法内存块分配器对象的指针
+ * @param[in] size: 大小
+ * @return 阶
+ */
+static __xwos_code
+xwsq_t xwmm_arena_bma_size_to_order(struct xwmm_bma * bma, xwsz_t size)
+{
+        xwsz_t nr;
+        xwsq_t order;
+
+        nr = XWBOP_DIV_ROUND_UP(size, bma->blksize);
+        if (nr <= (xwsz_t)1) {
+                order = 0;
+        } else {
+                order = (xwsq_t)xwbop_fls(xwsz_t, nr - (xwsz_t)1) + (xwsq_t)1;
+        }
+        return order;
+}
+
+static __xwos_code
+xwer_t xwmm_arena_bma_alloc(void * parent, xwsz_t * size, void ** membuf)
+{
+        struct xwmm_bma * bma;
+        xwsq_t order;
+        xwer_t rc;
+
+        bma = (struct xwmm_bma *)parent;
+        order = xwmm_arena_bma_size_to_order(bma, *size);
+        rc = xwmm_bma_alloc(bma, order, membuf);
+        if (XWOK == rc) {
+                /* 伙伴算法分配的是整块，统计实际占用的大小 */
+                *size = ((xwsz_t)1 << order) * bma->blksize;
+        }
+        return rc;
+}
+
+static __xwos_code
+xwer_t xwmm_arena_bma_free(void * parent, void * mem)
+{
+        return xwmm_bma_free((struct xwmm_bma *)parent, mem);
+}
+
+__xwos_api
+xwer_t xwmm_arena_init_bma(struct xwmm_arena * arena, const char * name,
+                           struct xwmm_bma * bma, xwsz_t blksize)
+{
+        xwsq_t order;
+
+        XWOS_VALIDATE((bma), "nullptr", -EFAULT);
+
+        /* 伙伴算法只能分配2的n次方倍单位块，直接使用整块可避免浪费 */
+        order = xwmm_arena_bma_size_to_order(bma, blksize);
+        // cppcheck-suppress [misra-c2012-17.8]
+        blksize = ((xwsz_t)1 << order) * bma->blksize;
+        return xwmm_arena_init(arena, name, bma,
+                               xwmm_arena_bma_alloc, xwmm_arena_bma_free,
+                               blksize);
+}
+#endif
+
+/**
+ * @brief 向上级分配器申请一块新的内存块，并加入到链表尾
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] need: 新内存块中至少需要的空间，不包括块头
+ * @return 错误码
+ */
+static __xwos_code
+xwer_t xwmm_arena_blk_grow(struct xwmm_arena * arena, xwsz_t need)
+{
+        struct xwmm_arena_blk * blk;
+        xwsz_t size;
+        void * mem;
+        xwer_t rc;
+
+        size = need + XWMM_ARENA_BLKHDR_SIZE;
+        if (size < arena->blksize) {
+                size = arena->blksize;
+        }
+        rc = arena->alloc(arena->parent, &size, &mem);
+        if (XWOK == rc) {
+                blk = (struct xwmm_arena_blk *)mem;
+                blk->prev = arena->curr;
+                blk->size = size;
+                blk->pos = XWMM_ARENA_BLKHDR_SIZE;
+                arena->curr = blk;
+                arena->total += size;
+        }
+        return rc;
+}
+
+/**
+ * @brief 将链表尾部的内存块归还给上级分配器，直到遇到指定的内存块
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] until: 保留的内存块，`NULL` 表示全部归还
+ */
+static __xwos_code
+void xwmm_arena_blk_shrink(struct xwmm_arena * arena,
+                           struct xwmm_arena_blk * until)
+{
+        struct xwmm_arena_blk * blk;
+
+        while ((NULL != arena->curr) && (until != arena->curr)) {
+                blk = arena->curr;
+                arena->curr = blk->prev;
+                arena->total -= blk->size;
+                // cppcheck-suppress [misra-c2012-17.7]
+                arena->free(arena->parent, blk);
+        }
+}
+
+__xwos_api
+xwer_t xwmm_arena_alloc(struct xwmm_arena * arena, xwsz_t size, xwsz_t aligned,
+                        void ** membuf)
+{
+        struct xwmm_arena_blk * blk;
+        xwptr_t base;
+        xwptr_t addr;
+        xwer_t rc;
+
+        XWOS_VALIDATE((arena), "nullptr", -EFAULT);
+        XWOS_VALIDATE((membuf), "nullptr", -EFAULT);
+
+        if (((xwsz_t)0 == size) ||
+            ((xwsz_t)0 != (aligned & XWMM_UNALIGNED_MASK)) ||
+            ((xwsz_t)0 != (aligned & (aligned - (xwsz_t)1)))) {
+                rc = -EINVAL;
+                *membuf = NULL;
+                goto err_inval;
+        }
+        if ((xwsz_t)0 == aligned) {
+                aligned = XWMM_ALIGNMENT; // cppcheck-suppress [misra-c2012-17.8]
+        }
+        // cppcheck-suppress [misra-c2012-17.8]
+        size = XWBOP_ALIGN(size, (xwsz_t)XWMM_ALIGNMENT);
+
+        blk = arena->curr;
+        if (NULL != blk) {
+                base = (xwptr_t)blk;
+                addr = XWBOP_ALIGN(base + blk->pos, aligned);
+                if ((addr + size) <= (base + blk->size)) {
+                        goto found;
+                }
+        }
+        /* 块首地址至少按 `XWMM_ALIGNMENT` 对齐，额外预留对齐的填充空间 */
+        rc = xwmm_arena_blk_grow(arena, size + aligned - (xwsz_t)XWMM_ALIGNMENT);
+        if (rc < 0) {
+                *membuf = NULL;
+                goto err_nomem;
+        }
+        blk = arena->curr;
+        base = (xwptr_t)blk;
+        addr = XWBOP_ALIGN(base + blk->pos, aligned);
+
+found:
+        blk->pos = (addr + size) - base;
+        arena->used += size;
+        *membuf = (void *)addr;
+        return XWOK;
+
+err_nomem:
+err_inval:
+        return rc;
+}
+
+__xwos_api
+xwer_t xwmm_arena_free(struct xwmm_arena * arena, void * mem)
+{
+        XWOS_UNUSED(arena);
+        XWOS_UNUSED(mem);
+        return XWOK;
+}
+
+__xwos_api
+void xwmm_arena_mark(struct xwmm_arena * arena, struct xwmm_arena_mark * mark)
+{
+        mark->blk = arena->curr;
+        mark->pos = (NULL != arena->curr) ? arena->curr->pos : (xwsz_t)0;
+        mark->used = arena->used;
+}
+
+__xwos_api
+xwer_t xwmm_arena_rewind(struct xwmm_arena * arena,
+                         const struct xwmm_arena_mark * mark)
+{
+        struct xwmm_arena_blk * blk;
+        xwer_t rc;
+
+        XWOS_VALIDATE((arena), "nullptr", -EFAULT);
+        XWOS_VALIDATE((mark), "nullptr", -EFAULT);
+
+        if (NULL == mark->blk) {
+                xwmm_arena_reset(arena);
+                rc = XWOK;
+        } else {
+                for (blk = arena->curr; NULL != blk; blk = blk->prev) {
+                        if (blk == mark->blk) {
+                                break;
+                        }
+                }
+                if ((NULL == blk) || (mark->pos > blk->pos)) {
+                        rc = -EINVAL;
+                } else {
+                        xwmm_arena_blk_shrink(arena, blk);
+                        blk->pos = mark->pos;
+                        arena->used = mark->used;
+                        rc = XWOK;
+                }
+        }
+        return rc;
+}
+
+__xwos_api
+void xwmm_arena_reset(struct xwmm_arena * arena)
+{
+        struct xwmm_arena_blk * first;
+
+        first = arena->curr;
+        if (NULL != first) {
+                while (NULL != first->prev) {
+                        first = first->prev;
+                }
+                xwmm_arena_blk_shrink(arena, first);
+                first->pos = XWMM_ARENA_BLKHDR_SIZE;
+        }
+        arena->used = 0;
+}
+
+__xwos_api
+void xwmm_arena_release(struct xwmm_arena * arena)
+{
+        xwmm_arena_blk_shrink(arena, NULL);
+        arena->used = 0;
+}
+
+#if defined(XWMMCFG_ARENA_CTHD) && (1 == XWMMCFG_ARENA_CTHD)
+#  if (XWMMCFG_ARENA_CTHD_DATA_POS >= XWOS_THD_LOCAL_DATA_NUM)
+#    error "XWMMCFG_ARENA_CTHD_DATA_POS is out of range of thread local data!"
+#  endif
+
+__xwos_api
+xwer_t xwmm_arena_cthd_set(struct xwmm_arena * arena)
+{
+        return xwos_cthd_set_data(XWMMCFG_ARENA_CTHD_DATA_POS, arena);
+}
+
+__xwos_api
+struct xwmm_arena * xwmm_arena_cthd_get(void)
+{
+        void * data;
+        xwer_t rc;
+
+        rc = xwos_cthd_get_data(XWMMCFG_ARENA_CTHD_DATA_POS, &data);
+        if (rc < 0) {
+                data = NULL;
+        }
+        return (struct xwmm_arena *)data;
+}
+
+__xwos_api
+xwer_t xwmm_arena_cthd_alloc(xwsz_t size, xwsz_t aligned, void ** membuf)
+{
+        struct xwmm_arena * arena;
+        xwer_t rc;
+
+        XWOS_VALIDATE((membuf), "nullptr", -EFAULT);
+
+        arena = xwmm_arena_cthd_get();
+        if (NULL == arena) {
+                rc = -ENOENT;
+                *membuf = NULL;
+        } else {
+                rc = xwmm_arena_alloc(arena, size, aligned, membuf);
+        }
+        return rc;
+}
+#endif
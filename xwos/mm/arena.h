@@ -0,0 +1,333 @@
+/**
+ * @file
+ * @brief XWOS内存管理：竞技场分配器
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_mm_arena_h__
+#define __xwos_mm_arena_h__
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/mm/common.h>
+
+/**
+ * @defgroup xwmm_arena 竞技场分配器
+ * @ingroup xwmm
+ * 竞技场分配器从上级分配器（内存池、伙伴算法分配器等）申请大块内存，
+ * 并将它们串成链表，然后在块内按顺序切割出小块内存。
+ * 单个对象不能被释放，但可以通过 **标记/回滚** 一次性释放标记之后申请的所有内存，
+ * 或通过 **复位** 一次性释放全部内存。
+ *
+ * + 优点：
+ *   + 申请操作只需移动位置指针，速度非常快；
+ *   + 复位与回滚的时间只与块的数量有关，与对象的数量无关；
+ *   + 块内的对象是连续的，缓存友好。
+ * + 缺点：
+ *   + 不能释放单个对象，释放函数只是一个 **Dummy** 函数；
+ *   + 竞技场对象本身不是线程安全的。
+ * + 适用性：生命周期相同的短期对象，例如解析报文、组装协议数据单元。
+ * + 上下文的安全性：竞技场对象只能由一个上下文使用，
+ *   上下文是否安全取决于上级分配器。
+ * @{
+ */
+
+/**
+ * @brief 上级分配器的申请函数
+ * @param[in] parent: 上级分配器
+ * @param[in,out] size: 指向缓冲区的指针，此缓冲区：
+ * + (I) 作为输入时，表示需要申请的大小
+ * + (O) 作为输出时，返回实际申请到的内存块的大小，不能小于输入的大小；
+ *   上级分配器无法得知实际大小时，可保持不变
+ * @param[out] membuf: 指向地址缓存的指针，通过此指针缓存返回申请到的内存的首地址
+ */
+typedef xwer_t (* xwmm_arena_alloc_f)(void * parent, xwsz_t * size, void ** membuf);
+
+/**
+ * @brief 上级分配器的释放函数
+ * @param[in] parent: 上级分配器
+ * @param[in] mem: 内存的首地址
+ */
+typedef xwer_t (* xwmm_arena_free_f)(void * parent, void * mem);
+
+/**
+ * @brief 竞技场内存块
+ */
+struct xwmm_arena_blk {
+        struct xwmm_arena_blk * prev; /**< 前一个内存块 */
+        xwsz_t size; /**< 内存块的大小，包括块头 */
+        xwsz_t pos; /**< 块内已使用的位置 */
+};
+
+/**
+ * @brief 竞技场内存块头的大小
+ */
+#define XWMM_ARENA_BLKHDR_SIZE \
+        XWBOP_ALIGN(sizeof(struct xwmm_arena_blk), (xwsz_t)XWMM_ALIGNMENT)
+
+/**
+ * @brief 竞技场分配器
+ */
+struct xwmm_arena {
+        const char * name; /**< 名字 */
+        void * parent; /**< 上级分配器 */
+        xwmm_arena_alloc_f alloc; /**< 上级分配器的申请函数 */
+        xwmm_arena_free_f free; /**< 上级分配器的释放函数 */
+        xwsz_t blksize; /**< 每次向上级分配器申请的内存块的最小大小 */
+        struct xwmm_arena_blk * curr; /**< 当前内存块，链表尾 */
+        xwsz_t used; /**< 已经分配出去的内存的总大小 */
+        xwsz_t total; /**< 从上级分配器申请的内存的总大小 */
+};
+
+/**
+ * @brief 竞技场标记
+ */
+struct xwmm_arena_mark {
+        struct xwmm_arena_blk * blk; /**< 标记时的当前内存块 */
+        xwsz_t pos; /**< 标记时块内的位置 */
+        xwsz_t used; /**< 标记时已经分配出去的内存的总大小 */
+};
+
+/**
+ * @brief XWMM API：初始化竞技场分配器
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] name: 名字
+ * @param[in] parent: 上级分配器
+ * @param[in] alloc: 上级分配器的申请函数
+ * @param[in] free: 上级分配器的释放函数
+ * @param[in] blksize: 每次向上级分配器申请的内存块的最小大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -E2SMALL: 内存块太小
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ * @details
+ * + 初始化时不会向上级分配器申请内存，第一次申请内存时才会申请内存块。
+ */
+xwer_t xwmm_arena_init(struct xwmm_arena * arena, const char * name,
+                       void * parent,
+                       xwmm_arena_alloc_f alloc, xwmm_arena_free_f free,
+                       xwsz_t blksize);
+
+#if defined(XWMMCFG_MEMPOOL) && (1 == XWMMCFG_MEMPOOL)
+struct xwmm_mempool;
+
+/**
+ * @brief XWMM API：以内存池作为上级分配器初始化竞技场分配器
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] name: 名字
+ * @param[in] mp: 内存池的指针
+ * @param[in] blksize: 每次向内存池申请的内存块的最小大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -E2SMALL: 内存块太小
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ */
+xwer_t xwmm_arena_init_mempool(struct xwmm_arena * arena, const char * name,
+                               struct xwmm_mempool * mp, xwsz_t blksize);
+#endif
+
+#if defined(XWMMCFG_BMA) && (1 == XWMMCFG_BMA)
+struct xwmm_bma;
+
+/**
+ * @brief XWMM API：以伙伴算法内存块分配器作为上级分配器初始化竞技场分配器
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] name: 名字
+ * @param[in] bma: 伙伴算法内存块分配器的指针
+ * @param[in] blksize: 每次向伙伴算法内存块分配器申请的内存块的最小大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -E2SMALL: 内存块太小
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ * @details
+ * + 伙伴算法内存块分配器只能分配2的n次方倍单位块大小的内存，
+ *   `blksize` 会被向上调整。
+ */
+xwer_t xwmm_arena_init_bma(struct xwmm_arena * arena, const char * name,
+                           struct xwmm_bma * bma, xwsz_t blksize);
+#endif
+
+/**
+ * @brief XWMM API：从竞技场分配器中申请内存
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] size: 大小
+ * @param[in] aligned: 申请到的内存的首地址需要对齐到的边界，
+ *                     `0` 表示按照 `XWMM_ALIGNMENT` 对齐
+ * @param[out] membuf: 指向地址缓存的指针，通过此指针缓存返回申请到的内存的首地址
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: 参数无效
+ * @retval -ENOMEM: 内存不足
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ * @details
+ * + 当前内存块剩余的空间不足时，会向上级分配器申请一块新的内存块，
+ *   如果 `size` 大于内存块的大小，新的内存块会被扩大以容纳 `size` 。
+ */
+xwer_t xwmm_arena_alloc(struct xwmm_arena * arena, xwsz_t size, xwsz_t aligned,
+                        void ** membuf);
+
+/**
+ * @brief XWMM API：释放内存
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] mem: 内存的首地址
+ * @return 错误码
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ * @details
+ * + Dummy函数，竞技场分配器只能通过 `xwmm_arena_rewind()` 或
+ *   `xwmm_arena_reset()` 批量释放内存。
+ */
+xwer_t xwmm_arena_free(struct xwmm_arena * arena, void * mem);
+
+/**
+ * @brief XWMM API：标记竞技场分配器的当前位置
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[out] mark: 指向缓冲区的指针，通过此缓冲区返回标记
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ */
+void xwmm_arena_mark(struct xwmm_arena * arena, struct xwmm_arena_mark * mark);
+
+/**
+ * @brief XWMM API：将竞技场分配器回滚到标记的位置
+ * @param[in] arena: 竞技场分配器的指针
+ * @param[in] mark: 标记
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINVAL: 标记不属于此竞技场分配器或已经失效
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ * @details
+ * + 标记之后申请的所有内存都被释放，标记之后申请的内存块归还给上级分配器；
+ * + 回滚到更早的标记后，更晚的标记失效。
+ */
+xwer_t xwmm_arena_rewind(struct xwmm_arena * arena,
+                         const struct xwmm_arena_mark * mark);
+
+/**
+ * @brief XWMM API：复位竞技场分配器
+ * @param[in] arena: 竞技场分配器的指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ * @details
+ * + 释放所有已经分配的内存，保留第一块内存块，其余的内存块归还给上级分配器，
+ *   因此复位后再次申请内存时，不需要访问上级分配器。
+ */
+void xwmm_arena_reset(struct xwmm_arena * arena);
+
+/**
+ * @brief XWMM API：释放竞技场分配器所有的内存块
+ * @param[in] arena: 竞技场分配器的指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：不可重入
+ * @details
+ * + 所有的内存块都归还给上级分配器。
+ */
+void xwmm_arena_release(struct xwmm_arena * arena);
+
+/**
+ * @brief XWMM API：获取竞技场分配器已经分配出去的内存的总大小
+ * @param[in] arena: 竞技场分配器的指针
+ * @return 字节数
+ */
+static __xwcc_inline
+xwsz_t xwmm_arena_get_used(struct xwmm_arena * arena)
+{
+        return arena->used;
+}
+
+/**
+ * @brief XWMM API：获取竞技场分配器从上级分配器申请的内存的总大小
+ * @param[in] arena: 竞技场分配器的指针
+ * @return 字节数
+ */
+static __xwcc_inline
+xwsz_t xwmm_arena_get_total(struct xwmm_arena * arena)
+{
+        return arena->total;
+}
+
+#if defined(XWMMCFG_ARENA_CTHD) && (1 == XWMMCFG_ARENA_CTHD)
+/**
+ * @brief XWMM API：设置当前线程默认的竞技场分配器
+ * @param[in] arena: 竞技场分配器的指针，`NULL` 表示清除
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ECHRNG: 线程本地数据的位置超出范围
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：线程
+ * + 重入性：可重入
+ * @details
+ * + 竞技场分配器的指针存放在线程本地数据 `XWMMCFG_ARENA_CTHD_DATA_POS` 中，
+ *   用户不可再使用此位置存放其他数据。
+ */
+xwer_t xwmm_arena_cthd_set(struct xwmm_arena * arena);
+
+/**
+ * @brief XWMM API：获取当前线程默认的竞技场分配器
+ * @return 竞技场分配器的指针，`NULL` 表示当前线程没有默认的竞技场分配器
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：线程
+ * + 重入性：可重入
+ */
+struct xwmm_arena * xwmm_arena_cthd_get(void);
+
+/**
+ * @brief XWMM API：从当前线程默认的竞技场分配器中申请内存
+ * @param[in] size: 大小
+ * @param[in] aligned: 申请到的内存的首地址需要对齐到的边界
+ * @param[out] membuf: 指向地址缓存的指针，通过此指针缓存返回申请到的内存的首地址
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOENT: 当前线程没有默认的竞技场分配器
+ * @retval -EINVAL: 参数无效
+ * @retval -ENOMEM: 内存不足
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：线程
+ * + 重入性：可重入
+ */
+xwer_t xwmm_arena_cthd_alloc(xwsz_t size, xwsz_t aligned, void ** membuf);
+#endif
+
+/**
+ * @} xwmm_arena
+ */
+
+#endif /* xwos/mm/arena.h */
@@ -16,6 +16,7 @@
 #include <xwos/lib/xwbop.h>
 #include <xwos/osal/lock/spinlock.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 #include <xwos/mm/bma.h>
 
 /* #define XWMM_BMA_LOG */ /**< 调试日志开关  */
@@ -58,6 +59,9 @@ void xwmm_bma_divide_block(struct xwmm_bma * bma, struct xwmm_bma_bcb * bcb,
 static __xwos_code
 void xwmm_bma_combine(struct xwmm_bma * bma, struct xwmm_bma_bcb * bcb);
 
+static __xwos_code
+void xwmm_bma_lock(struct xwmm_bma * bma, xwreg_t * flag);
+
 __xwos_api
 xwer_t xwmm_bma_init(struct xwmm_bma * bma, const char * name,
                      xwptr_t origin, xwsz_t size,
@@ -82,6 +86,7 @@ xwer_t xwmm_bma_init(struct xwmm_bma * bma, const char * name,
         bma->blksize = blksize;
         bma->blkodr = blkodr;
         xwos_splk_init(&bma->lock);
+        xwmm_stat_cnt_init(&bma->stat);
         bma->orderlists = (struct xwmm_bma_orderlist *)&bma[(xwsz_t)1];
         bma->bcbs = (struct xwmm_bma_bcb *)&bma->orderlists[(xwsz_t)1 + blkodr];
         xwmm_bmalogf(DEBUG,
@@ -105,6 +110,29 @@ err_size:
         return rc;
 }
 
+/**
+ * @brief 锁住伙伴算法内存块分配器
+ * @param[in] bma: 伙伴算法内存块分配器对象的指针
+ * @param[out] flag: 指向缓冲区的指针，通过此缓冲区返回CPU中断标志
+ * @details
+ * + 开启统计功能时，先尝试上锁，失败时记录一次锁竞争。
+ */
+static __xwos_code
+void xwmm_bma_lock(struct xwmm_bma * bma, xwreg_t * flag)
+{
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        xwer_t rc;
+
+        rc = xwos_splk_trylock_cpuirqsv(&bma->lock, flag);
+        if (rc < 0) {
+                xwmm_stat_cnt_contend(&bma->stat);
+                xwos_splk_lock_cpuirqsv(&bma->lock, flag);
+        }
+#else
+        xwos_splk_lock_cpuirqsv(&bma->lock, flag);
+#endif
+}
+
 /**
  * @brief 从内存块首地址获得其控制块的指针
  * @param[in] bma: 伙伴算法内存块分配器对象的指针
@@ -322,7 +350,7 @@ xwer_t xwmm_bma_alloc(struct xwmm_bma * bma, xwsq_t order, void ** membuf)
 
         ol = NULL;
         bcb = err_ptr(-ENOENT);
-        xwos_splk_lock_cpuirqsv(&bma->lock, &flag);
+        xwmm_bma_lock(bma, &flag);
         for (o = order; o <= bma->blkodr; o++) {
                 ol = &bma->orderlists[o];
                 bcb = xwmm_bma_orderlist_choose(bma, ol);
@@ -332,6 +360,7 @@ xwer_t xwmm_bma_alloc(struct xwmm_bma * bma, xwsq_t order, void ** membuf)
         }
         if (is_err(bcb)) { // cppcheck-suppress [misra-c2012-14.4]
                 xwos_splk_unlock_cpuirqrs(&bma->lock, flag);
+                xwmm_stat_cnt_fail(&bma->stat);
                 rc = -ENOMEM;
                 *membuf = NULL;
         } else {
@@ -342,6 +371,7 @@ xwer_t xwmm_bma_alloc(struct xwmm_bma * bma, xwsq_t order, void ** membuf)
                              bcb->order);
                 xwmm_bma_divide_block(bma, bcb, order, ol);
                 xwos_splk_unlock_cpuirqrs(&bma->lock, flag);
+                xwmm_stat_cnt_alloc(&bma->stat, bma->blksize << order);
                 rc = XWOK;
                 *membuf = xwmm_bma_bcb_to_mem(bma, bcb);
         }
@@ -402,6 +432,7 @@ __xwos_api
 xwer_t xwmm_bma_free(struct xwmm_bma * bma, void * mem)
 {
         struct xwmm_bma_bcb * bcb;
+        xwsz_t size;
         xwreg_t flag;
         xwer_t rc;
 
@@ -428,12 +459,74 @@ xwer_t xwmm_bma_free(struct xwmm_bma * bma, void * mem)
                 rc = -EINVAL;
                 goto err_invalmem;
         }
-        xwos_splk_lock_cpuirqsv(&bma->lock, &flag);
+        /* 正在使用的块是本地数据，对 `bcb->order` 的读可在锁外。*/
+        size = bma->blksize << ((xwsq_t)bcb->order & XWMM_BMA_ORDER_MASK);
+        xwmm_bma_lock(bma, &flag);
         xwmm_bma_combine(bma, bcb);
         xwos_splk_unlock_cpuirqrs(&bma->lock, flag);
+        xwmm_stat_cnt_free(&bma->stat, size);
         return XWOK;
 
 err_invalmem:
 err_range:
         return rc;
 }
+
+__xwos_api
+xwer_t xwmm_bma_get_stat(struct xwmm_bma * bma, struct xwmm_stat * stat)
+{
+        struct xwlib_bclst_node * n;
+        xwsz_t free;
+        xwsz_t largest;
+        xwsz_t blknr;
+        xwsq_t o;
+        xwreg_t flag;
+
+        XWOS_VALIDATE((bma), "nullptr", -EFAULT);
+        XWOS_VALIDATE((stat), "nullptr", -EFAULT);
+
+        free = 0;
+        largest = 0;
+        xwos_splk_lock_cpuirqsv(&bma->lock, &flag);
+        for (o = 0; o <= bma->blkodr; o++) {
+                blknr = 0;
+                xwlib_bclst_itr_next(n, &bma->orderlists[o].head) {
+                        blknr++;
+                }
+                if ((xwsz_t)0 != blknr) {
+                        free += (bma->blksize << o) * blknr;
+                        largest = bma->blksize << o;
+                }
+        }
+        xwos_splk_unlock_cpuirqrs(&bma->lock, flag);
+        stat->total = bma->zone.size;
+        stat->used = bma->zone.size - free;
+        stat->largest_free = largest;
+        xwmm_stat_cnt_read(&bma->stat, stat);
+        return XWOK;
+}
+
+__xwos_api
+xwer_t xwmm_bma_get_odrstat(struct xwmm_bma * bma, xwsz_t nr[], xwsz_t num)
+{
+        struct xwlib_bclst_node * n;
+        xwsz_t blknr;
+        xwsq_t o;
+        xwreg_t flag;
+
+        XWOS_VALIDATE((bma), "nullptr", -EFAULT);
+        XWOS_VALIDATE((nr), "nullptr", -EFAULT);
+
+        for (o = 0; o < num; o++) {
+                blknr = 0;
+                if (o <= bma->blkodr) {
+                        xwos_splk_lock_cpuirqsv(&bma->lock, &flag);
+                        xwlib_bclst_itr_next(n, &bma->orderlists[o].head) {
+                                blknr++;
+                        }
+                        xwos_splk_unlock_cpuirqrs(&bma->lock, flag);
+                }
+                nr[o] = blknr;
+        }
+        return XWOK;
+}
@@ -18,6 +18,7 @@
 #include <xwos/lib/xwbop.h>
 #include <xwos/osal/lock/spinlock.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 
 /**
  * @defgroup xwmm_bma 伙伴算法内存块分配器
@@ -85,6 +86,9 @@ struct xwmm_bma {
         struct xwos_splk lock; /**< 保护 `orderlists` 以及 `bcbs` 的锁 */
         struct xwmm_bma_orderlist * orderlists; /**< 阶链表数组指针 */
         struct xwmm_bma_bcb * bcbs; /**< 内存块控制块数组指针 */
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        struct xwmm_stat_cnt stat; /**< 运行时计数器 */
+#endif
 };
 
 /**
@@ -141,6 +145,41 @@ xwer_t xwmm_bma_alloc(struct xwmm_bma * bma, xwsq_t order, void ** membuf);
  */
 xwer_t xwmm_bma_free(struct xwmm_bma * bma, void * mem);
 
+/**
+ * @brief XWMM API：获取伙伴算法内存块分配器的统计信息
+ * @param[in] bma: 伙伴算法内存块分配器对象的指针
+ * @param[out] stat: 指向缓冲区的指针，通过此缓冲区返回统计信息
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ * @details
+ * + 此函数需要在锁内遍历所有阶链表，耗时与空闲块的数量成正比，
+ *   不建议在对实时性要求高的场合频繁调用。
+ */
+xwer_t xwmm_bma_get_stat(struct xwmm_bma * bma, struct xwmm_stat * stat);
+
+/**
+ * @brief XWMM API：获取伙伴算法内存块分配器每一阶空闲块的数量
+ * @param[in] bma: 伙伴算法内存块分配器对象的指针
+ * @param[out] nr: 数组，通过此数组返回每一阶空闲块的数量， `nr[i]` 表示第 `i` 阶
+ * @param[in] num: 数组 `nr` 的长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ * @details
+ * + 阶的数量为 `bma->blkodr + 1` ，当 `num` 小于阶的数量时，只返回前 `num` 阶，
+ *   当 `num` 大于阶的数量时，多余的元素被填写为 `0` 。
+ */
+xwer_t xwmm_bma_get_odrstat(struct xwmm_bma * bma, xwsz_t nr[], xwsz_t num);
+
 /**
  * @} xwmm_bma
  */
@@ -13,7 +13,9 @@
 #include <xwos/standard.h>
 #include <string.h>
 #include <xwos/lib/xwbop.h>
+#include <xwos/lib/xwaop.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 #include <xwos/mm/mempool/page.h>
 #include <xwos/mm/mempool/allocator.h>
 
@@ -174,6 +176,7 @@ xwer_t xwmm_mempool_construct(struct xwmm_mempool * mp, const char * name,
         }
 
         mp->name = name;
+        xwmm_stat_cnt_init(&mp->stat);
 
         return XWOK;
 
@@ -332,7 +335,10 @@ xwer_t xwmm_mempool_malloc(struct xwmm_mempool * mp, xwsz_t size, void ** membuf
                 }
                 rc = ia->malloc(ia, size, membuf);
                 if (rc < 0) {
+                        xwmm_stat_cnt_fail(&mp->stat);
                         *membuf = NULL;
+                } else {
+                        xwmm_stat_cnt_alloc(&mp->stat, size);
                 }
         }
         return rc;
@@ -343,6 +349,7 @@ xwer_t xwmm_mempool_free(struct xwmm_mempool * mp, void * mem)
 {
         interface xwmm_mempool_i_allocator * ia;
         struct xwmm_mempool_page * pg;
+        xwsz_t size;
         xwer_t rc;
 
         XWOS_VALIDATE((mp), "nullptr", -EFAULT);
@@ -407,7 +414,11 @@ xwer_t xwmm_mempool_free(struct xwmm_mempool * mp, void * mem)
                 ia = (void *)&mp->pa;
                 break;
         }
+        size = pg->data.value;
         rc = ia->free(ia, mem);
+        if (XWOK == rc) {
+                xwmm_stat_cnt_free(&mp->stat, size);
+        }
 
 err_pg_find:
 do_nothing:
@@ -531,8 +542,113 @@ xwer_t xwmm_mempool_memalign(struct xwmm_mempool * mp,
                 break;
         }
         rc = ia->malloc(ia, size, membuf);
+        if (rc < 0) {
+                xwmm_stat_cnt_fail(&mp->stat);
+        } else {
+                xwmm_stat_cnt_alloc(&mp->stat, size);
+        }
 
 nothing:
 err_notp2:
         return rc;
 }
+
+/**
+ * @brief 对象缓存在内存池结构体中的偏移，按对象大小从小到大排列
+ */
+static __xwos_rodata const xwsz_t xwmm_mempool_oc_offset[XWMM_MEMPOOL_OC_NUM] = {
+        xwcc_offsetof(struct xwmm_mempool, oc_8),
+        xwcc_offsetof(struct xwmm_mempool, oc_16),
+        xwcc_offsetof(struct xwmm_mempool, oc_32),
+        xwcc_offsetof(struct xwmm_mempool, oc_64),
+        xwcc_offsetof(struct xwmm_mempool, oc_96),
+        xwcc_offsetof(struct xwmm_mempool, oc_128),
+        xwcc_offsetof(struct xwmm_mempool, oc_160),
+        xwcc_offsetof(struct xwmm_mempool, oc_192),
+        xwcc_offsetof(struct xwmm_mempool, oc_256),
+        xwcc_offsetof(struct xwmm_mempool, oc_320),
+        xwcc_offsetof(struct xwmm_mempool, oc_384),
+        xwcc_offsetof(struct xwmm_mempool, oc_512),
+        xwcc_offsetof(struct xwmm_mempool, oc_768),
+        xwcc_offsetof(struct xwmm_mempool, oc_1024),
+        xwcc_offsetof(struct xwmm_mempool, oc_2048),
+};
+
+/**
+ * @brief 获取内存池中第 `idx` 个对象缓存
+ * @param[in] mp: 内存池的指针
+ * @param[in] idx: 对象缓存的序号
+ * @return 对象缓存的指针
+ */
+static __xwos_code
+struct xwmm_mempool_objcache * xwmm_mempool_get_oc(struct xwmm_mempool * mp,
+                                                   xwsq_t idx)
+{
+        return (struct xwmm_mempool_objcache *)((xwptr_t)mp +
+                                                xwmm_mempool_oc_offset[idx]);
+}
+
+__xwos_api
+xwer_t xwmm_mempool_get_stat(struct xwmm_mempool * mp, struct xwmm_stat * stat)
+{
+        struct xwmm_mempool_objcache * oc;
+        xwsz_t freesize;
+        xwsz_t largest;
+        xwsz_t idleness;
+        xwsz_t idlesize;
+        xwsq_t i;
+
+        XWOS_VALIDATE((mp), "nullptr", -EFAULT);
+        XWOS_VALIDATE((stat), "nullptr", -EFAULT);
+
+        // cppcheck-suppress [misra-c2012-17.7]
+        xwmm_mempool_page_get_free(&mp->pa, &freesize, &largest);
+        idlesize = 0;
+        for (i = 0; i < XWMM_MEMPOOL_OC_NUM; i++) {
+                oc = xwmm_mempool_get_oc(mp, i);
+                idleness = xwaop_load(xwsz_t, &oc->idleness, xwaop_mo_relaxed);
+                idlesize += idleness * oc->objsize;
+                if (((xwsz_t)0 != idleness) && (largest < oc->objsize)) {
+                        largest = oc->objsize;
+                }
+        }
+        stat->total = mp->pa.zone.size;
+        stat->used = mp->pa.zone.size - freesize - idlesize;
+        stat->largest_free = largest;
+        xwmm_stat_cnt_read(&mp->stat, stat);
+        stat->contention = xwmm_mempool_page_get_contention(&mp->pa);
+        return XWOK;
+}
+
+__xwos_api
+xwer_t xwmm_mempool_get_ocstat(struct xwmm_mempool * mp,
+                               struct xwmm_mempool_ocstat ocstat[], xwsz_t num)
+{
+        struct xwmm_mempool_objcache * oc;
+        xwsq_t i;
+
+        XWOS_VALIDATE((mp), "nullptr", -EFAULT);
+        XWOS_VALIDATE((ocstat), "nullptr", -EFAULT);
+
+        if (num > (xwsz_t)XWMM_MEMPOOL_OC_NUM) {
+                num = XWMM_MEMPOOL_OC_NUM; // cppcheck-suppress [misra-c2012-17.8]
+        }
+        for (i = 0; i < num; i++) {
+                oc = xwmm_mempool_get_oc(mp, i);
+                ocstat[i].objsize = oc->objsize;
+                ocstat[i].capacity = xwaop_load(xwsz_t, &oc->capacity,
+                                                xwaop_mo_relaxed);
+                ocstat[i].idleness = xwaop_load(xwsz_t, &oc->idleness,
+                                                xwaop_mo_relaxed);
+        }
+        return XWOK;
+}
+
+__xwos_api
+xwer_t xwmm_mempool_get_odrstat(struct xwmm_mempool * mp, xwsz_t nr[], xwsz_t num)
+{
+        XWOS_VALIDATE((mp), "nullptr", -EFAULT);
+        XWOS_VALIDATE((nr), "nullptr", -EFAULT);
+
+        return xwmm_mempool_page_get_odrstat(&mp->pa, nr, num);
+}
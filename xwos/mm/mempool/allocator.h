@@ -15,6 +15,7 @@
 
 #include <xwos/standard.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 
 /**
  * @defgroup xwmm_mempool 内存池分配器
@@ -64,6 +65,7 @@
 #define XWMM_MEMPOOL_OC_768_PAGE_ODR    (0U) /**< 768字节分配器所使用的页的阶数 */
 #define XWMM_MEMPOOL_OC_1024_PAGE_ODR   (0U) /**< 1024字节分配器所使用的页的阶数 */
 #define XWMM_MEMPOOL_OC_2048_PAGE_ODR   (1U) /**< 2048字节分配器所使用的页的阶数 */
+#define XWMM_MEMPOOL_OC_NUM             (15U) /**< 对象缓存的数量 */
 
 #if (XWMM_MEMPOOL_PAGE_SIZE & XWMM_UNALIGNED_MASK)
 #  error "Page size must be aligned to XWMM_ALIGNMENT!"
@@ -101,9 +103,21 @@ struct xwmm_mempool {
         struct xwmm_mempool_objcache oc_768; /**< 768-Byte对象缓存 */
         struct xwmm_mempool_objcache oc_1024; /**< 1024-Byte对象缓存 */
         struct xwmm_mempool_objcache oc_2048; /**< 2048-Byte对象缓存 */
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        struct xwmm_stat_cnt stat; /**< 运行时计数器 */
+#endif
         xwu8_t rem[0]; /**< 结构体剩余的内存空间 */
 };
 
+/**
+ * @brief 内存池中对象缓存的统计信息
+ */
+struct xwmm_mempool_ocstat {
+        xwsz_t objsize; /**< 对象大小 */
+        xwsz_t capacity; /**< 总的对象数量 */
+        xwsz_t idleness; /**< 空闲的对象数量 */
+};
+
 /**
  * @brief XWMM API：初始化内存池
  * @param[in] mp: 内存池的指针
@@ -233,6 +247,61 @@ xwer_t xwmm_mempool_memalign(struct xwmm_mempool * mp,
                              xwsz_t alignment, xwsz_t size,
                              void ** membuf);
 
+/**
+ * @brief XWMM API：获取内存池的统计信息
+ * @param[in] mp: 内存池的指针
+ * @param[out] stat: 指向缓冲区的指针，通过此缓冲区返回统计信息
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ * @details
+ * + `stat->used` 是不可再被申请的内存大小，即已分配的页减去对象缓存中空闲的对象，
+ *   包括对象缓存的页中无法容纳一个对象的尾部空间；
+ * + `stat->peak` 是用户申请的内存大小的峰值（按对齐后的大小计算）；
+ * + `stat->largest_free` 是最大的连续空闲页的大小，当没有空闲页时，
+ *   是还有空闲对象的对象缓存中最大的对象大小；
+ * + `stat->contention` 是页分配器阶红黑树锁竞争的次数。
+ */
+xwer_t xwmm_mempool_get_stat(struct xwmm_mempool * mp, struct xwmm_stat * stat);
+
+/**
+ * @brief XWMM API：获取内存池中每个对象缓存的统计信息
+ * @param[in] mp: 内存池的指针
+ * @param[out] ocstat: 数组，通过此数组返回对象缓存的统计信息，按对象大小从小到大排列
+ * @param[in] num: 数组 `ocstat` 的长度，最多返回 @ref XWMM_MEMPOOL_OC_NUM 个
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ */
+xwer_t xwmm_mempool_get_ocstat(struct xwmm_mempool * mp,
+                               struct xwmm_mempool_ocstat ocstat[], xwsz_t num);
+
+/**
+ * @brief XWMM API：获取内存池每一阶空闲页的数量
+ * @param[in] mp: 内存池的指针
+ * @param[out] nr: 数组，通过此数组返回每一阶空闲页的数量， `nr[i]` 表示第 `i` 阶
+ * @param[in] num: 数组 `nr` 的长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ * @details
+ * + 第 `i` 阶页的大小为 `(XWMM_MEMPOOL_PAGE_SIZE << i)` ；
+ * + 当 `num` 大于阶的数量时，多余的元素被填写为 `0` 。
+ */
+xwer_t xwmm_mempool_get_odrstat(struct xwmm_mempool * mp, xwsz_t nr[], xwsz_t num);
+
 /**
  * @} xwmm_mempool
  */
@@ -14,6 +14,7 @@
 #include <xwos/lib/rbtree.h>
 #include <xwos/lib/bclst.h>
 #include <xwos/lib/xwbop.h>
+#include <xwos/lib/xwaop.h>
 #include <xwos/osal/lock/seqlock.h>
 #include <xwos/mm/common.h>
 #include <xwos/mm/mempool/i_allocator.h>
@@ -43,6 +44,10 @@ static __xwos_code
 void xwmm_mempool_page_combine(struct xwmm_mempool_page_allocator * pa,
                                struct xwmm_mempool_page * pg);
 
+static __xwos_code
+void xwmm_mempool_page_odrbtree_lock(struct xwmm_mempool_page_odrbtree * ot,
+                                     xwreg_t * flag);
+
 static __xwos_code
 xwer_t xwmm_mempool_page_odrbtree_add(struct xwmm_mempool_page_odrbtree * ot,
                                       struct xwmm_mempool_page * pg);
@@ -117,10 +122,14 @@ xwer_t xwmm_mempool_page_allocator_init(struct xwmm_mempool_page_allocator * pa,
         pa->max_order = (xwsq_t)order;
         pa->odrbtree = odrbtree;
         pa->pgarray = pgarray;
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        xwaop_write(xwsq_t, &pa->contention, 0, NULL);
+#endif
 
         for (i = 0; i <= pa->max_order; i++) {
                 xwlib_rbtree_init(&pa->odrbtree[i].tree);
                 pa->odrbtree[i].leftmost = NULL;
+                pa->odrbtree[i].nr = 0;
                 pa->odrbtree[i].owner = pa;
                 pa->odrbtree[i].order = i;
                 xwos_sqlk_init(&pa->odrbtree[i].lock);
@@ -211,6 +220,87 @@ err_already:
         return rc;
 }
 
+/**
+ * @brief XWMM API：获取页分配器每一阶空闲页的数量
+ * @param[in] pa: 页分配器的指针
+ * @param[out] nr: 数组，通过此数组返回每一阶空闲页的数量， `nr[i]` 表示第 `i` 阶
+ * @param[in] num: 数组 `nr` 的长度
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @details
+ * + 阶的数量为 `pa->max_order + 1` ，当 `num` 大于阶的数量时，多余的元素被填写为 `0` 。
+ */
+__xwos_api
+xwer_t xwmm_mempool_page_get_odrstat(struct xwmm_mempool_page_allocator * pa,
+                                     xwsz_t nr[], xwsz_t num)
+{
+        struct xwmm_mempool_page_odrbtree * ot;
+        xwsq_t odr;
+        xwsq_t seq;
+
+        for (odr = 0; odr < num; odr++) {
+                if (odr <= pa->max_order) {
+                        ot = &pa->odrbtree[odr];
+                        do {
+                                seq = xwos_sqlk_rd_begin(&ot->lock);
+                                nr[odr] = ot->nr;
+                        } while (xwos_sqlk_rd_retry(&ot->lock, seq));
+                } else {
+                        nr[odr] = 0;
+                }
+        }
+        return XWOK;
+}
+
+/**
+ * @brief XWMM API：获取页分配器中空闲页的总大小以及最大的连续空闲页
+ * @param[in] pa: 页分配器的指针
+ * @param[out] freesize: 指向缓冲区的指针，通过此缓冲区返回空闲页的总大小
+ * @param[out] largest: 指向缓冲区的指针，通过此缓冲区返回最大的连续空闲页的大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ */
+__xwos_api
+xwer_t xwmm_mempool_page_get_free(struct xwmm_mempool_page_allocator * pa,
+                                  xwsz_t * freesize, xwsz_t * largest)
+{
+        struct xwmm_mempool_page_odrbtree * ot;
+        xwsz_t nr;
+        xwsq_t odr;
+        xwsq_t seq;
+
+        *freesize = 0;
+        *largest = 0;
+        for (odr = 0; odr <= pa->max_order; odr++) {
+                ot = &pa->odrbtree[odr];
+                do {
+                        seq = xwos_sqlk_rd_begin(&ot->lock);
+                        nr = ot->nr;
+                } while (xwos_sqlk_rd_retry(&ot->lock, seq));
+                if ((xwsz_t)0 != nr) {
+                        *freesize += (pa->pgsize << odr) * nr;
+                        *largest = pa->pgsize << odr;
+                }
+        }
+        return XWOK;
+}
+
+/**
+ * @brief XWMM API：获取页分配器阶红黑树锁竞争的次数
+ * @param[in] pa: 页分配器的指针
+ * @return 锁竞争的次数，未开启配置 `XWMMCFG_STAT` 时始终为 `0`
+ */
+__xwos_api
+xwsq_t xwmm_mempool_page_get_contention(struct xwmm_mempool_page_allocator * pa)
+{
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        return xwaop_load(xwsq_t, &pa->contention, xwaop_mo_relaxed);
+#else
+        XWOS_UNUSED(pa);
+        return 0;
+#endif
+}
+
 /**
  * @brief 将大的页拆分成小的页
  * @param[in] pa: 页分配器的指针
@@ -281,6 +371,30 @@ void xwmm_mempool_page_combine(struct xwmm_mempool_page_allocator * pa,
         xwmm_mempool_page_odrbtree_add(&pa->odrbtree[odr], pg);
 }
 
+/**
+ * @brief 锁住阶红黑树
+ * @param[in] ot: 阶红黑树的指针
+ * @param[out] flag: 指向缓冲区的指针，通过此缓冲区返回CPU中断标志
+ * @details
+ * + 开启统计功能时，先尝试上锁，失败时记录一次锁竞争。
+ */
+static __xwos_code
+void xwmm_mempool_page_odrbtree_lock(struct xwmm_mempool_page_odrbtree * ot,
+                                     xwreg_t * flag)
+{
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        xwer_t rc;
+
+        rc = xwos_sqlk_wr_trylock_cpuirqsv(&ot->lock, flag);
+        if (rc < 0) {
+                xwaop_add(xwsq_t, &ot->owner->contention, 1, NULL, NULL);
+                xwos_sqlk_wr_lock_cpuirqsv(&ot->lock, flag);
+        }
+#else
+        xwos_sqlk_wr_lock_cpuirqsv(&ot->lock, flag);
+#endif
+}
+
 /**
  * @brief 增加页到阶红黑树中
  * @param[in] ot: 阶红黑树的指针
@@ -312,7 +426,7 @@ xwer_t xwmm_mempool_page_odrbtree_add(struct xwmm_mempool_page_odrbtree * ot,
         }
 
         pg->order = ot->order;
-        xwos_sqlk_wr_lock_cpuirqsv(&ot->lock, &flag);
+        xwmm_mempool_page_odrbtree_lock(ot, &flag);
         /* 当页被加入到阶红黑树中，就变成共享数据，对 `pg->mapping` 的写只在锁内。*/
         pg->mapping = XWMM_MEMPOOL_PAGE_MAPPING_FREE;
         new = &tree->root;
@@ -344,6 +458,7 @@ xwer_t xwmm_mempool_page_odrbtree_add(struct xwmm_mempool_page_odrbtree * ot,
         }
         xwlib_rbtree_link(&pg->attr.free.rbnode, lpc);
         xwlib_rbtree_insert_color(tree, &pg->attr.free.rbnode);
+        ot->nr++;
         xwos_sqlk_wr_unlock_cpuirqrs(&ot->lock, flag);
         return XWOK;
 
@@ -375,7 +490,7 @@ xwer_t xwmm_mempool_page_odrbtree_remove(struct xwmm_mempool_page_odrbtree * ot,
                 goto err_odrerr;
         }
 
-        xwos_sqlk_wr_lock_cpuirqsv(&ot->lock, &flag);
+        xwmm_mempool_page_odrbtree_lock(ot, &flag);
         /* 即将被删除的页在阶红黑树中，是共享数据。对 `pg->mapping` 的读只可在锁内。*/
         if (XWMM_MEMPOOL_PAGE_MAPPING_FREE != pg->mapping) {
                 rc = -EBUSY;
@@ -396,6 +511,7 @@ xwer_t xwmm_mempool_page_odrbtree_remove(struct xwmm_mempool_page_odrbtree * ot,
                 }
         }
         xwlib_rbtree_remove(tree, &pg->attr.free.rbnode);
+        ot->nr--;
         xwos_sqlk_wr_unlock_cpuirqrs(&ot->lock, flag);
         xwlib_rbtree_init_node(&pg->attr.free.rbnode);
         return XWOK;
@@ -421,7 +537,7 @@ xwmm_mempool_page_odrbtree_choose(struct xwmm_mempool_page_odrbtree * ot)
         struct xwlib_rbtree_node * s;
 
         tree = &ot->tree;
-        xwos_sqlk_wr_lock_cpuirqsv(&ot->lock, &flag);
+        xwmm_mempool_page_odrbtree_lock(ot, &flag);
         leftmost = ot->leftmost;
         if (NULL == leftmost) {
                 xwos_sqlk_wr_unlock_cpuirqrs(&ot->lock, flag);
@@ -440,6 +556,7 @@ xwmm_mempool_page_odrbtree_choose(struct xwmm_mempool_page_odrbtree * ot)
                 ot->leftmost = NULL;
         }
         xwlib_rbtree_remove(tree, &leftmost->attr.free.rbnode);
+        ot->nr--;
         xwos_sqlk_wr_unlock_cpuirqrs(&ot->lock, flag);
 
         xwlib_rbtree_init_node(&leftmost->attr.free.rbnode);
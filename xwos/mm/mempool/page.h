@@ -73,6 +73,7 @@ struct xwmm_mempool_page_odrbtree {
         struct xwlib_rbtree tree; /**< 红黑树 */
         struct xwmm_mempool_page * leftmost; /**< 最小序号的页 */
         xwsq_t order; /**< 红黑树的阶 */
+        xwsz_t nr; /**< 红黑树中页的数量 */
         struct xwmm_mempool_page_allocator * owner; /**< 包含此阶红黑树的页分配器 */
         struct xwos_sqlk lock; /**< 保护此结构体的锁 */
 };
@@ -88,6 +89,9 @@ struct xwmm_mempool_page_allocator {
         xwsq_t max_order; /**< 最大阶数 */
         struct xwmm_mempool_page_odrbtree * odrbtree; /**< 阶红黑树数组指针 */
         struct xwmm_mempool_page * pgarray; /**< 页数值指针 */
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        atomic_xwsq_t contention; /**< 阶红黑树锁竞争的次数 */
+#endif
 };
 
 xwer_t xwmm_mempool_page_find(struct xwmm_mempool_page_allocator * pa,
@@ -103,6 +107,11 @@ xwer_t xwmm_mempool_page_allocate(struct xwmm_mempool_page_allocator * pa,
                                   struct xwmm_mempool_page ** pgbuf);
 xwer_t xwmm_mempool_page_free(struct xwmm_mempool_page_allocator * pa,
                               struct xwmm_mempool_page * pg);
+xwer_t xwmm_mempool_page_get_odrstat(struct xwmm_mempool_page_allocator * pa,
+                                     xwsz_t nr[], xwsz_t num);
+xwer_t xwmm_mempool_page_get_free(struct xwmm_mempool_page_allocator * pa,
+                                  xwsz_t * freesize, xwsz_t * largest);
+xwsq_t xwmm_mempool_page_get_contention(struct xwmm_mempool_page_allocator * pa);
 
 /**
  * @} xwmm_mempool
@@ -15,6 +15,7 @@
 #include <xwos/lib/xwaop.h>
 #include <xwos/lib/lfq.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 #include <xwos/mm/memslice.h>
 
 __xwos_api
@@ -47,6 +48,7 @@ xwer_t xwmm_memslice_init(struct xwmm_memslice * msa, xwptr_t origin,
         msa->num_free = num_max;
         msa->ctor = ctor;
         msa->dtor = dtor;
+        xwmm_stat_cnt_init(&msa->stat);
 
         /* 构造所有对象 */
         if (NULL != ctor) {
@@ -90,11 +92,13 @@ xwer_t xwmm_memslice_alloc(struct xwmm_memslice * msa, void ** membuf)
 
         card = xwlib_lfq_pop(&msa->free_list);
         if (NULL == card) {
+                xwmm_stat_cnt_fail(&msa->stat);
                 rc = -ENOMEM;
                 *membuf = NULL;
                 goto err_lfq_pop;
         }
         xwaop_sub(xwsz_t, &msa->num_free, 1, NULL, NULL);
+        xwmm_stat_cnt_alloc(&msa->stat, msa->card_size);
         *(xwptr_t *)card = msa->backup; /* restore original data */
         *membuf = card;
         return XWOK;
@@ -122,8 +126,27 @@ xwer_t xwmm_memslice_free(struct xwmm_memslice * msa, void * mem)
                 card = (atomic_xwlfq_t *)mem;
                 xwlib_lfq_push(&msa->free_list, card);
                 xwaop_add(xwsz_t, &msa->num_free, 1, NULL, NULL);
+                xwmm_stat_cnt_free(&msa->stat, msa->card_size);
                 rc = XWOK;
         }
 
         return rc;
 }
+
+__xwos_api
+xwer_t xwmm_memslice_get_stat(struct xwmm_memslice * msa, struct xwmm_stat * stat)
+{
+        xwsz_t num_free;
+        xwsz_t num_max;
+
+        XWOS_VALIDATE((msa), "nullptr", -EFAULT);
+        XWOS_VALIDATE((stat), "nullptr", -EFAULT);
+
+        num_max = xwaop_load(xwsz_t, &msa->num_max, xwaop_mo_relaxed);
+        num_free = xwaop_load(xwsz_t, &msa->num_free, xwaop_mo_relaxed);
+        stat->total = num_max * msa->card_size;
+        stat->used = (num_max - num_free) * msa->card_size;
+        stat->largest_free = ((xwsz_t)0 == num_free) ? (xwsz_t)0 : msa->card_size;
+        xwmm_stat_cnt_read(&msa->stat, stat);
+        return XWOK;
+}
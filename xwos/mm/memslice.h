@@ -17,6 +17,7 @@
 #include <xwos/lib/bclst.h>
 #include <xwos/lib/lfq.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 
 /**
  * @defgroup xwmm_memslice 内存切片分配器
@@ -56,6 +57,9 @@ struct xwmm_memslice {
                              */
         ctor_f ctor; /**< 构造函数 */
         dtor_f dtor; /**< 析构函数 */
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        struct xwmm_stat_cnt stat; /**< 运行时计数器 */
+#endif
 };
 
 /**
@@ -106,6 +110,23 @@ xwer_t xwmm_memslice_alloc(struct xwmm_memslice * msa, void ** membuf);
  */
 xwer_t xwmm_memslice_free(struct xwmm_memslice * msa, void * mem);
 
+/**
+ * @brief XWMM API：获取内存切片分配器的统计信息
+ * @param[in] msa: 内存切片分配器对象的指针
+ * @param[out] stat: 指向缓冲区的指针，通过此缓冲区返回统计信息
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ * @details
+ * + 内存切片分配器中只有一种大小的块，当还有剩余的“卡片”时，
+ *   `stat->largest_free` 为“卡片”的大小，否则为 `0` 。
+ */
+xwer_t xwmm_memslice_get_stat(struct xwmm_memslice * msa, struct xwmm_stat * stat);
+
 /**
  * @} xwmm_memslice
  */
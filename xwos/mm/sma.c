@@ -14,6 +14,7 @@
 #include <xwos/lib/xwbop.h>
 #include <xwos/lib/xwaop.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 #include <xwos/mm/sma.h>
 
 __xwos_api
@@ -33,6 +34,7 @@ xwer_t xwmm_sma_init(struct xwmm_sma * sa,
                 sa->zone.size = size;
                 sa->pos = pos;
                 sa->name = name;
+                xwmm_stat_cnt_init(&sa->stat);
         }
         return rc;
 }
@@ -72,12 +74,18 @@ xwer_t xwmm_sma_alloc(struct xwmm_sma * sa, xwsz_t size, xwsz_t aligned,
                 tmp = XWBOP_ALIGN((sa->zone.origin + cpos), aligned);
                 npos = size + tmp - sa->zone.origin;
                 if (npos > sa->zone.size) {
+                        xwmm_stat_cnt_fail(&sa->stat);
                         rc = -ENOMEM;
                         *membuf = NULL;
                         goto err_nomem;
                 }
                 *membuf = (void *)tmp;
-        } while (XWOK != xwaop_teq_then_write(xwsq_t, &sa->pos, cpos, npos, NULL));
+                rc = xwaop_teq_then_write(xwsq_t, &sa->pos, cpos, npos, NULL);
+                if (XWOK != rc) {
+                        xwmm_stat_cnt_contend(&sa->stat);
+                }
+        } while (XWOK != rc);
+        xwmm_stat_cnt_alloc(&sa->stat, npos - cpos);
         return XWOK;
 
 err_nomem:
@@ -92,3 +100,20 @@ xwer_t xwmm_sma_free(struct xwmm_sma * sa, void * mem)
         XWOS_UNUSED(mem);
         return XWOK;
 }
+
+__xwos_api
+xwer_t xwmm_sma_get_stat(struct xwmm_sma * sa, struct xwmm_stat * stat)
+{
+        xwsq_t cpos;
+
+        XWOS_VALIDATE((sa), "nullptr", -EFAULT);
+        XWOS_VALIDATE((stat), "nullptr", -EFAULT);
+
+        cpos = xwaop_load(xwsq_t, &sa->pos, xwaop_mo_relaxed);
+        stat->total = sa->zone.size;
+        stat->used = cpos;
+        stat->largest_free = sa->zone.size - cpos;
+        xwmm_stat_cnt_read(&sa->stat, stat);
+        stat->peak = cpos;
+        return XWOK;
+}
@@ -15,6 +15,7 @@
 
 #include <xwos/standard.h>
 #include <xwos/mm/common.h>
+#include <xwos/mm/stat.h>
 
 /**
  * @defgroup xwmm_sma 简单内存分配器
@@ -37,6 +38,9 @@ struct xwmm_sma {
         struct xwmm_zone zone; /**< 内存区域 */
         const char * name; /**< 名字 */
         atomic_xwsq_t pos; /**< 当前位置指针 */
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+        struct xwmm_stat_cnt stat; /**< 运行时计数器 */
+#endif
 };
 
 /**
@@ -90,6 +94,24 @@ xwer_t xwmm_sma_alloc(struct xwmm_sma * sa, xwsz_t size, xwsz_t aligned,
  */
 xwer_t xwmm_sma_free(struct xwmm_sma * sa, void * mem);
 
+/**
+ * @brief XWMM API：获取简单内存分配器的统计信息
+ * @param[in] sa: 简单内存分配器对象
+ * @param[out] stat: 指向缓冲区的指针，通过此缓冲区返回统计信息
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @note
+ * + 同步/异步：同步
+ * + 上下文：中断、中断底半部、线程
+ * + 重入性：可重入
+ * @details
+ * + 简单内存分配器不回收内存，已经分配出去的内存大小即为当前位置指针，
+ *   包括对齐时填充的内存，因此 `stat->peak` 总是等于 `stat->used` ；
+ * + `stat->free_cnt` 始终为 `0` 。
+ */
+xwer_t xwmm_sma_get_stat(struct xwmm_sma * sa, struct xwmm_stat * stat);
+
 /**
  * @} xwmm_sma
  */
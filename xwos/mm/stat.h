@@ -0,0 +1,163 @@
+/**
+ * @file
+ * @brief XWOS内存管理：内存分配器的统计信息
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_mm_stat_h__
+#define __xwos_mm_stat_h__
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwaop.h>
+
+/**
+ * @defgroup xwmm_stat 内存分配器的统计信息
+ * @ingroup xwmm
+ * 所有内存分配器（ `bma` 、 `memslice` 、 `sma` 、 `mempool` ）都通过统一的结构体
+ * `struct xwmm_stat` 报告其使用情况：
+ *
+ * + `total` 、 `used` 、 `largest_free` 从分配器的内部数据结构中计算得出，总是有效的；
+ * + `peak` 、 `alloc_cnt` 、 `free_cnt` 、 `fail_cnt` 、 `contention` 是运行时计数器，
+ *   只有当配置 `XWMMCFG_STAT` 为 `1` 时才会被统计，否则始终为 `0` 。
+ *
+ * 各个分配器统计 `contention` 的方式：
+ *
+ * + `bma` ：尝试上锁失败的次数；
+ * + `sma` ：无锁分配时CAS操作重试的次数；
+ * + `mempool` ：页分配器的阶红黑树尝试上锁失败的次数；
+ * + `memslice` ：基于无锁队列，始终为 `0` 。
+ * @{
+ */
+
+/**
+ * @brief 内存分配器的统计信息
+ */
+struct xwmm_stat {
+        xwsz_t total; /**< 总的内存大小（单位：字节） */
+        xwsz_t used; /**< 已经分配出去的内存大小（单位：字节） */
+        xwsz_t peak; /**< 已经分配出去的内存大小的峰值（单位：字节） */
+        xwsz_t largest_free; /**< 可以一次申请到的最大的连续内存（单位：字节） */
+        xwsq_t alloc_cnt; /**< 申请成功的次数 */
+        xwsq_t free_cnt; /**< 释放的次数 */
+        xwsq_t fail_cnt; /**< 申请失败的次数 */
+        xwsq_t contention; /**< 锁竞争的次数 */
+};
+
+#if defined(XWMMCFG_STAT) && (1 == XWMMCFG_STAT)
+/**
+ * @brief 内存分配器的运行时计数器
+ */
+struct xwmm_stat_cnt {
+        atomic_xwsz_t used; /**< 已经分配出去的内存大小 */
+        atomic_xwsz_t peak; /**< 已经分配出去的内存大小的峰值 */
+        atomic_xwsq_t alloc_cnt; /**< 申请成功的次数 */
+        atomic_xwsq_t free_cnt; /**< 释放的次数 */
+        atomic_xwsq_t fail_cnt; /**< 申请失败的次数 */
+        atomic_xwsq_t contention; /**< 锁竞争的次数 */
+};
+
+/**
+ * @brief 初始化运行时计数器
+ * @param[in] cnt: 运行时计数器的指针
+ */
+static __xwcc_inline
+void xwmm_stat_cnt_init(struct xwmm_stat_cnt * cnt)
+{
+        xwaop_write(xwsz_t, &cnt->used, 0, NULL);
+        xwaop_write(xwsz_t, &cnt->peak, 0, NULL);
+        xwaop_write(xwsq_t, &cnt->alloc_cnt, 0, NULL);
+        xwaop_write(xwsq_t, &cnt->free_cnt, 0, NULL);
+        xwaop_write(xwsq_t, &cnt->fail_cnt, 0, NULL);
+        xwaop_write(xwsq_t, &cnt->contention, 0, NULL);
+}
+
+/**
+ * @brief 记录一次成功的申请
+ * @param[in] cnt: 运行时计数器的指针
+ * @param[in] size: 申请到的内存大小
+ */
+static __xwcc_inline
+void xwmm_stat_cnt_alloc(struct xwmm_stat_cnt * cnt, xwsz_t size)
+{
+        xwsz_t nv;
+
+        xwaop_add(xwsz_t, &cnt->used, size, &nv, NULL);
+        xwaop_tlt_then_write(xwsz_t, &cnt->peak, nv, nv, NULL);
+        xwaop_add(xwsq_t, &cnt->alloc_cnt, 1, NULL, NULL);
+}
+
+/**
+ * @brief 记录一次释放
+ * @param[in] cnt: 运行时计数器的指针
+ * @param[in] size: 释放的内存大小
+ */
+static __xwcc_inline
+void xwmm_stat_cnt_free(struct xwmm_stat_cnt * cnt, xwsz_t size)
+{
+        xwaop_sub(xwsz_t, &cnt->used, size, NULL, NULL);
+        xwaop_add(xwsq_t, &cnt->free_cnt, 1, NULL, NULL);
+}
+
+/**
+ * @brief 记录一次失败的申请
+ * @param[in] cnt: 运行时计数器的指针
+ */
+static __xwcc_inline
+void xwmm_stat_cnt_fail(struct xwmm_stat_cnt * cnt)
+{
+        xwaop_add(xwsq_t, &cnt->fail_cnt, 1, NULL, NULL);
+}
+
+/**
+ * @brief 记录一次锁竞争
+ * @param[in] cnt: 运行时计数器的指针
+ */
+static __xwcc_inline
+void xwmm_stat_cnt_contend(struct xwmm_stat_cnt * cnt)
+{
+        xwaop_add(xwsq_t, &cnt->contention, 1, NULL, NULL);
+}
+
+/**
+ * @brief 将运行时计数器读取到统计信息结构体中
+ * @param[in] cnt: 运行时计数器的指针
+ * @param[out] stat: 指向缓冲区的指针，通过此缓冲区返回统计信息
+ * @note
+ * + 此函数不会修改 `stat->total` 、 `stat->used` 与 `stat->largest_free` 。
+ */
+static __xwcc_inline
+void xwmm_stat_cnt_read(struct xwmm_stat_cnt * cnt, struct xwmm_stat * stat)
+{
+        stat->peak = xwaop_load(xwsz_t, &cnt->peak, xwaop_mo_relaxed);
+        stat->alloc_cnt = xwaop_load(xwsq_t, &cnt->alloc_cnt, xwaop_mo_relaxed);
+        stat->free_cnt = xwaop_load(xwsq_t, &cnt->free_cnt, xwaop_mo_relaxed);
+        stat->fail_cnt = xwaop_load(xwsq_t, &cnt->fail_cnt, xwaop_mo_relaxed);
+        stat->contention = xwaop_load(xwsq_t, &cnt->contention, xwaop_mo_relaxed);
+}
+#else
+#  define xwmm_stat_cnt_init(cnt)
+#  define xwmm_stat_cnt_alloc(cnt, size)         XWOS_UNUSED(size)
+#  define xwmm_stat_cnt_free(cnt, size)          XWOS_UNUSED(size)
+#  define xwmm_stat_cnt_fail(cnt)
+#  define xwmm_stat_cnt_contend(cnt)
+#  define xwmm_stat_cnt_read(cnt, stat) \
+        do { \
+                (stat)->peak = 0; \
+                (stat)->alloc_cnt = 0; \
+                (stat)->free_cnt = 0; \
+                (stat)->fail_cnt = 0; \
+                (stat)->contention = 0; \
+        } while (0)
+#endif
+
+/**
+ * @} xwmm_stat
+ */
+
+#endif /* xwos/mm/stat.h */
@@ -14,6 +14,9 @@
 #include <xwos/mp/pm.h>
 #include <xwos/mp/skd.h>
 #include <xwos/mp/init.h>
+#if defined(XWOSCFG_SKD_WORKQ) && (1 == XWOSCFG_SKD_WORKQ)
+#  include <xwos/mp/workq.h>
+#endif
 
 /**
  * @brief 初始化XWOS MP内核
@@ -22,10 +25,17 @@ __xwmp_init_code
 xwer_t xwmp_init(void)
 {
         xwid_t cpuid;
+        xwer_t rc;
 
         cpuid = xwmp_skd_get_cpuid_lc();
         if ((xwid_t)0 == cpuid) {
                 xwmp_pmdm_init();
         }
-        return xwmp_skd_init_lc();
+        rc = xwmp_skd_init_lc();
+#if defined(XWOSCFG_SKD_WORKQ) && (1 == XWOSCFG_SKD_WORKQ)
+        if (XWOK == rc) {
+                rc = xwmp_workq_sys_init_lc();
+        }
+#endif
+        return rc;
 }
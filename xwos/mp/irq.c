@@ -71,6 +71,19 @@ xwer_t xwmp_irq_get_id(xwirq_t * irqnbuf)
         return rc;
 }
 
+__xwmp_api
+xwer_t xwmp_irq_ipi(xwirq_t irqn, xwid_t cpuid)
+{
+        XWOS_VALIDATE((irqn < (xwirq_t)SOCCFG_IRQ_NUM),
+                      "out-of-range", -ERANGE);
+        XWOS_VALIDATE((irqn >= (-(xwirq_t)SOCCFG_EXC_NUM)),
+                      "out-of-range", -ERANGE);
+        XWOS_VALIDATE((cpuid < (xwid_t)CPUCFG_CPU_NUM),
+                      "out-of-range", -ERANGE);
+
+        return xwospl_irq_ipi(irqn, cpuid);
+}
+
 __xwmp_api
 void xwmp_cpuirq_enable_lc(void)
 {
@@ -23,6 +23,7 @@ xwer_t xwmp_irq_disable(xwirq_t irqn);
 xwer_t xwmp_irq_save(xwirq_t irqn, xwreg_t * flag);
 xwer_t xwmp_irq_restore(xwirq_t irqn, xwreg_t flag);
 xwer_t xwmp_irq_get_id(xwirq_t * irqnbuf);
+xwer_t xwmp_irq_ipi(xwirq_t irqn, xwid_t cpuid);
 void xwmp_cpuirq_enable_lc(void);
 void xwmp_cpuirq_disable_lc(void);
 void xwmp_cpuirq_resume_lc(void);
@@ -97,9 +97,6 @@ xwer_t xwmp_mtx_chprio_once(struct xwmp_mtx * mtx,
                             struct xwmp_thd ** pthd,
                             xwsq_t * seq);
 
-static __xwmp_code
-void xwmp_mtx_chprio(struct xwmp_mtx * mtx);
-
 static __xwmp_code
 xwer_t xwmp_mtx_block_to(struct xwmp_mtx * mtx,
                          struct xwmp_skd * xwskd, struct xwmp_thd * thd,
@@ -500,7 +497,7 @@ xwer_t xwmp_mtx_chprio_once(struct xwmp_mtx * mtx,
  * @param[in] mtx: 互斥锁对象的指针
  * @return 错误码
  */
-static __xwmp_code
+__xwmp_code
 void xwmp_mtx_chprio(struct xwmp_mtx * mtx)
 {
         struct xwmp_thd * thd;
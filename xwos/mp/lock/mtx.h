@@ -51,6 +51,7 @@ struct xwmp_mtx {
 };
 
 xwer_t xwmp_mtx_intr(struct xwmp_mtx * mtx, struct xwmp_thd * thd);
+void xwmp_mtx_chprio(struct xwmp_mtx * mtx);
 
 #if defined(XWOSCFG_LOCK_MTX_MEMPOOL) && (1 == XWOSCFG_LOCK_MTX_MEMPOOL)
 xwer_t xwmp_mtx_cache_init(struct xwmm_mempool * mp, xwsq_t page_order);
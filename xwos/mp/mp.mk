@@ -65,6 +65,11 @@ ifeq ($(XWOSCFG_SKD_SWT),y)
   XWOS_CSRCS += mp/swt.c
 endif
 
+######## ######## ######## ######## workq ######## ######## ######## ########
+ifeq ($(XWOSCFG_SKD_WORKQ),y)
+  XWOS_CSRCS += mp/workq.c
+endif
+
 ######## ######## ######## ######## lock ######## ######## ######## ########
 XWOS_CSRCS += mp/lock/spinlock.c
 ifeq ($(XWOSCFG_LOCK_MTX),y)
@@ -82,6 +87,9 @@ endif
 ifeq ($(XWOSCFG_SYNC_EVT),y)
   XWOS_CSRCS += mp/sync/evt.c
 endif
+ifeq ($(XWOSCFG_SYNC_AW),y)
+  XWOS_CSRCS += mp/sync/aw.c
+endif
 
 ######## ######## ######## ######## osdl ######## ######## ######## ########
 XWOS_CSRCS += mp/osdl/skd.c
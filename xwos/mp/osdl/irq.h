@@ -45,6 +45,12 @@ xwer_t xwosdl_irq_get_id(xwirq_t * irqnbuf)
         return xwmp_irq_get_id(irqnbuf);
 }
 
+static __xwcc_inline
+xwer_t xwosdl_irq_ipi(xwirq_t irqn, xwid_t cpuid)
+{
+        return xwmp_irq_ipi(irqn, cpuid);
+}
+
 static __xwcc_inline
 void xwosdl_cpuirq_enable_lc(void)
 {
@@ -0,0 +1,108 @@
+/**
+ * @file
+ * @brief XWOS MP内核操作系统接口描述层：异步等待
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_mp_osdl_sync_aw_h__
+#define __xwos_mp_osdl_sync_aw_h__
+
+#include <xwos/mp/osdl/workq.h>
+#include <xwos/mp/sync/aw.h>
+#if ((defined(XWOSCFG_SYNC_PLSEM) && (1 == XWOSCFG_SYNC_PLSEM)) || \
+     (defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)))
+#  include <xwos/mp/osdl/sync/sem.h>
+#endif
+#if defined(XWOSCFG_SYNC_COND) && (1 == XWOSCFG_SYNC_COND)
+#  include <xwos/mp/osdl/sync/cond.h>
+#endif
+#if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+#  include <xwos/mp/osdl/sync/flg.h>
+#  include <xwos/mp/osdl/sync/br.h>
+#endif
+
+#define xwosdl_aw xwmp_aw
+typedef xwmp_aw_f xwosdl_aw_f;
+
+static __xwcc_inline
+void xwosdl_aw_init(struct xwosdl_aw * aw, xwosdl_aw_f func, void * arg,
+                    struct xwosdl_workq * workq, xwid_t cpuid)
+{
+        xwmp_aw_init(aw, func, arg, workq, cpuid);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_aw_cancel(struct xwosdl_aw * aw)
+{
+        XWOS_VALIDATE((aw), "nullptr", -EFAULT);
+
+        return xwmp_aw_cancel(aw);
+}
+
+static __xwcc_inline
+bool xwosdl_aw_tst_busy(struct xwosdl_aw * aw)
+{
+        return xwmp_aw_tst_busy(aw);
+}
+
+#if ((defined(XWOSCFG_SYNC_PLSEM) && (1 == XWOSCFG_SYNC_PLSEM)) || \
+     (defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)))
+static __xwcc_inline
+xwer_t xwosdl_sem_wait_async(struct xwosdl_sem * sem, struct xwosdl_aw * aw)
+{
+        XWOS_VALIDATE((sem), "nullptr", -EFAULT);
+        XWOS_VALIDATE((aw), "nullptr", -EFAULT);
+
+#  if defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)
+        return xwmp_rtsem_wait_async(sem, aw);
+#  else
+        return xwmp_plsem_wait_async(sem, aw);
+#  endif
+}
+#endif
+
+#if defined(XWOSCFG_SYNC_COND) && (1 == XWOSCFG_SYNC_COND)
+static __xwcc_inline
+xwer_t xwosdl_cond_wait_async(struct xwosdl_cond * cond, struct xwosdl_aw * aw)
+{
+        XWOS_VALIDATE((cond), "nullptr", -EFAULT);
+        XWOS_VALIDATE((aw), "nullptr", -EFAULT);
+
+        return xwmp_cond_wait_async(cond, aw);
+}
+#endif
+
+#if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+static __xwcc_inline
+xwer_t xwosdl_flg_wait_async(struct xwosdl_flg * flg, xwsq_t trigger, bool consumption,
+                             xwbmp_t origin[], xwbmp_t msk[],
+                             struct xwosdl_aw * aw)
+{
+        XWOS_VALIDATE((flg), "nullptr", -EFAULT);
+        XWOS_VALIDATE((flg->type == XWMP_EVT_TYPE_FLG), "type-error", -ETYPE);
+        XWOS_VALIDATE((trigger < XWMP_FLG_TRIGGER_NUM), "invalid-trigger", -EINVAL);
+        XWOS_VALIDATE((origin), "nullptr", -EFAULT);
+        XWOS_VALIDATE((msk), "nullptr", -EFAULT);
+        XWOS_VALIDATE((aw), "nullptr", -EFAULT);
+
+        return xwmp_flg_wait_async(flg, trigger, consumption, origin, msk, aw);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_br_wait_async(struct xwosdl_br * br, struct xwosdl_aw * aw)
+{
+        XWOS_VALIDATE((br), "nullptr", -EFAULT);
+        XWOS_VALIDATE((br->type == XWMP_EVT_TYPE_BR), "type-error", -ETYPE);
+        XWOS_VALIDATE((aw), "nullptr", -EFAULT);
+
+        return xwmp_br_wait_async(br, aw);
+}
+#endif
+
+#endif /* xwos/mp/osdl/sync/aw.h */
@@ -61,6 +61,46 @@ xwer_t xwosdl_thd_create(xwosdl_thd_d * thdd,
 }
 #endif
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+__xwmp_code
+xwer_t xwosdl_thd_pool_init(struct xwosdl_thd_pool * pool, const char * name,
+                            struct xwosdl_thd * thds, xwstk_t * stacks,
+                            xwsz_t stack_size, xwsz_t num)
+{
+        XWOS_VALIDATE((NULL != pool), "nullptr", -EFAULT);
+        XWOS_VALIDATE((NULL != thds), "nullptr", -EFAULT);
+        XWOS_VALIDATE((NULL != stacks), "nullptr", -EFAULT);
+        XWOS_VALIDATE((stack_size >= XWMMCFG_STACK_SIZE_MIN),
+                      "stack-size", -ESIZE);
+        XWOS_VALIDATE(((stack_size & XWMM_STACK_UNALIGNED_MASK) == 0),
+                      "stack-unaligned", -EALIGN);
+        XWOS_VALIDATE((((xwptr_t)stacks & XWMM_STACK_UNALIGNED_MASK) == 0),
+                      "stack-unaligned", -EALIGN);
+
+        return xwmp_thd_pool_init(pool, name, thds, stacks, stack_size, num);
+}
+
+__xwmp_code
+xwer_t xwosdl_thd_pool_create(xwosdl_thd_d * thdd,
+                              const struct xwosdl_thd_attr * inattr,
+                              xwosdl_thd_f thdfunc, void * arg)
+{
+        xwer_t rc;
+        struct xwosdl_thd * thd;
+
+        XWOS_VALIDATE((thdd), "nullptr", -EFAULT);
+
+        rc = xwmp_thd_pool_create(&thd, inattr, thdfunc, arg);
+        if (XWOK == rc) {
+                thdd->thd = thd;
+                thdd->tik = thd->xwobj.tik;
+        } else {
+                *thdd = XWOSDL_THD_NILD;
+        }
+        return rc;
+}
+#endif
+
 __xwmp_code
 xwer_t xwosdl_thd_get_attr(struct xwosdl_thd * thd, xwsq_t tik,
                            struct xwosdl_thd_attr * attr)
@@ -62,6 +62,24 @@ xwer_t xwosdl_thd_create(xwosdl_thd_d * thdd,
                          const struct xwosdl_thd_attr * inattr,
                          xwosdl_thd_f thdfunc, void * arg);
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+#define xwosdl_thd_pool xwmp_thd_pool
+
+xwer_t xwosdl_thd_pool_init(struct xwosdl_thd_pool * pool, const char * name,
+                            struct xwosdl_thd * thds, xwstk_t * stacks,
+                            xwsz_t stack_size, xwsz_t num);
+
+xwer_t xwosdl_thd_pool_create(xwosdl_thd_d * thdd,
+                              const struct xwosdl_thd_attr * inattr,
+                              xwosdl_thd_f thdfunc, void * arg);
+
+static __xwcc_inline
+xwsz_t xwosdl_thd_pool_get_num_free(struct xwosdl_thd_pool * pool)
+{
+        return xwmp_thd_pool_get_num_free(pool);
+}
+#endif
+
 static __xwcc_inline
 xwer_t xwosdl_thd_acquire(struct xwosdl_thd * thd, xwsq_t tik)
 {
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @brief XWOS MP内核操作系统接口描述层：工作队列
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_mp_osdl_workq_h__
+#define __xwos_mp_osdl_workq_h__
+
+#include <xwos/mp/workq.h>
+
+#define xwosdl_work xwmp_work
+#define xwosdl_workq xwmp_workq
+typedef xwmp_work_f xwosdl_work_f;
+
+static __xwcc_inline
+struct xwosdl_workq * xwosdl_workq_get_sys(void)
+{
+        return &xwmp_workq_sys;
+}
+
+static __xwcc_inline
+xwer_t xwosdl_workq_init(struct xwosdl_workq * wq, const char * name, xwpr_t prio,
+                         xwstk_t * stacks, xwsz_t stack_size)
+{
+        XWOS_VALIDATE((wq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((stacks), "nullptr", -EFAULT);
+        XWOS_VALIDATE((stack_size >= XWMMCFG_STACK_SIZE_MIN),
+                      "stack-size", -ESIZE);
+        XWOS_VALIDATE(((stack_size & XWMM_STACK_UNALIGNED_MASK) == 0),
+                      "stack-unaligned", -EALIGN);
+
+        return xwmp_workq_init(wq, name, prio, stacks, stack_size);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_workq_flush(struct xwosdl_workq * wq)
+{
+        XWOS_VALIDATE((wq), "nullptr", -EFAULT);
+
+        return xwmp_workq_flush(wq);
+}
+
+static __xwcc_inline
+void xwosdl_work_init(struct xwosdl_work * work, xwosdl_work_f func, void * arg)
+{
+        xwmp_work_init(work, func, arg);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_work_queue(struct xwosdl_workq * wq, struct xwosdl_work * work)
+{
+        XWOS_VALIDATE((wq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((work), "nullptr", -EFAULT);
+
+        return xwmp_work_queue(wq, work);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_work_queue_on(struct xwosdl_workq * wq, xwid_t cpuid,
+                            struct xwosdl_work * work)
+{
+        XWOS_VALIDATE((wq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((work), "nullptr", -EFAULT);
+
+        return xwmp_work_queue_on(wq, cpuid, work);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_work_queue_delayed(struct xwosdl_workq * wq, xwid_t cpuid,
+                                 struct xwosdl_work * work, xwtm_t delay)
+{
+        XWOS_VALIDATE((wq), "nullptr", -EFAULT);
+        XWOS_VALIDATE((work), "nullptr", -EFAULT);
+
+        return xwmp_work_queue_delayed(wq, cpuid, work, delay);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_work_cancel(struct xwosdl_work * work)
+{
+        XWOS_VALIDATE((work), "nullptr", -EFAULT);
+
+        return xwmp_work_cancel(work);
+}
+
+static __xwcc_inline
+xwer_t xwosdl_work_flush(struct xwosdl_work * work)
+{
+        XWOS_VALIDATE((work), "nullptr", -EFAULT);
+
+        return xwmp_work_flush(work);
+}
+
+static __xwcc_inline
+bool xwosdl_work_tst_busy(struct xwosdl_work * work)
+{
+        return xwmp_work_tst_busy(work);
+}
+
+#endif /* xwos/mp/osdl/workq.h */
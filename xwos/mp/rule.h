@@ -27,6 +27,27 @@
 #  endif
 #endif
 
+#if defined(XWOSCFG_SKD_WORKQ) && (1 == XWOSCFG_SKD_WORKQ)
+#  if !defined(XWOSCFG_SYNC_PLSEM) || (0 == XWOSCFG_SYNC_PLSEM)
+#    error "XWOSCFG_SYNC_PLSEM must be set to '1' when (XWOSCFG_SKD_WORKQ == 1) !"
+#  endif
+#  if !defined(XWOSCFG_SYNC_COND) || (0 == XWOSCFG_SYNC_COND)
+#    error "XWOSCFG_SYNC_COND must be set to '1' when (XWOSCFG_SKD_WORKQ == 1) !"
+#  endif
+#endif
+
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+#  if !defined(XWOSCFG_SKD_WORKQ) || (0 == XWOSCFG_SKD_WORKQ)
+#    error "XWOSCFG_SKD_WORKQ must be set to '1' when (XWOSCFG_SYNC_AW == 1) !"
+#  endif
+#endif
+
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+#  if !defined(XWOSCFG_SYNC_EVT) || (0 == XWOSCFG_SYNC_EVT)
+#    error "XWOSCFG_SYNC_EVT must be set to '1' when (XWOSCFG_SYNC_BR_TREE == 1) !"
+#  endif
+#endif
+
 #if defined(XWOSCFG_SKD_THD_MEMPOOL) && (1 == XWOSCFG_SKD_THD_MEMPOOL)
 #  define XWOSRULE_SKD_THD_CREATE               1
 #elif defined(XWOSCFG_SKD_THD_MEMSLICE) && (1 == XWOSCFG_SKD_THD_MEMSLICE)
@@ -0,0 +1,304 @@
+/**
+ * @file
+ * @brief XWOS MP内核同步机制：异步等待
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ * @note
+ * + 异步等待节点继承了等待队列节点，与线程一样加入同步对象的等待队列中，
+ *   唤醒与中断的流程与线程完全相同，只是回调函数不是唤醒线程，
+ *   而是将用户的回调函数推迟到中断底半部或工作队列中执行。
+ * + 等待队列节点的回调函数在唤醒者的上下文中、所有锁都已释放后调用，
+ *   用户的回调函数因此可以再次注册异步等待，不会与唤醒者争夺锁。
+ * + `busy` 从注册开始到用户的回调函数开始执行之前都为1，
+ *   防止节点在推迟执行的过程中被重复注册。
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwaop.h>
+#include <xwos/mp/irq.h>
+#include <xwos/mp/skd.h>
+#include <xwos/mp/wqn.h>
+#if defined(XWOSCFG_SKD_BH) && (1 == XWOSCFG_SKD_BH)
+#  include <xwos/mp/bh.h>
+#endif
+#include <xwos/mp/workq.h>
+#include <xwos/mp/sync/sem.h>
+#include <xwos/mp/sync/cond.h>
+#if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+#  include <xwos/mp/sync/evt.h>
+#endif
+#include <xwos/mp/sync/aw.h>
+
+static __xwmp_code
+void xwmp_aw_run(struct xwmp_aw * aw);
+
+#if defined(XWOSCFG_SKD_BH) && (1 == XWOSCFG_SKD_BH)
+static __xwmp_code
+void xwmp_aw_bh(void * arg);
+#endif
+
+static __xwmp_code
+void xwmp_aw_work(struct xwmp_work * work, void * arg);
+
+/**
+ * @brief XWMP API：初始化异步等待节点
+ * @param[in] aw: 异步等待节点的指针
+ * @param[in] func: 回调函数
+ * @param[in] arg: 回调函数的参数
+ * @param[in] workq: 执行回调函数的工作队列，`NULL` 表示在中断底半部执行
+ * @param[in] cpuid: 执行回调函数的CPU，只在 `workq` 不为 `NULL` 时有意义
+ */
+__xwmp_api
+void xwmp_aw_init(struct xwmp_aw * aw, xwmp_aw_f func, void * arg,
+                  struct xwmp_workq * workq, xwid_t cpuid)
+{
+        xwmp_wqn_init(&aw->wqn);
+        aw->func = func;
+        aw->arg = arg;
+        aw->workq = workq;
+        aw->cpuid = cpuid;
+        aw->obj = NULL;
+        aw->objtype = (xwsq_t)XWMP_WQTYPE_UNKNOWN;
+        aw->rc = XWOK;
+        aw->flg.trigger = 0;
+        aw->flg.consumption = false;
+        aw->flg.origin = NULL;
+        aw->flg.msk = NULL;
+        aw->pos = 0;
+#if defined(XWOSCFG_SKD_BH) && (1 == XWOSCFG_SKD_BH)
+        xwmp_bh_node_init(&aw->bhn, xwmp_aw_bh, aw);
+#endif
+        xwmp_work_init(&aw->work, xwmp_aw_work, aw);
+        xwaop_store(xwsq_t, &aw->busy, xwaop_mo_release, 0);
+}
+
+/**
+ * @brief 标记异步等待节点已被注册
+ * @param[in] aw: 异步等待节点的指针
+ * @param[in] obj: 同步对象的指针
+ * @param[in] objtype: 同步对象的等待队列类型
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EALREADY: 节点已被注册，或回调函数还未开始执行
+ */
+__xwmp_code
+xwer_t xwmp_aw_arm(struct xwmp_aw * aw, void * obj, xwsq_t objtype)
+{
+        xwer_t rc;
+
+        rc = xwaop_teq_then_write(xwsq_t, &aw->busy, 0, 1, NULL);
+        if (XWOK == rc) {
+                aw->obj = obj;
+                aw->objtype = objtype;
+        } else {
+                rc = -EALREADY;
+        }
+        return rc;
+}
+
+/**
+ * @brief 将用户的回调函数推迟到中断底半部或工作队列中执行
+ * @param[in] aw: 异步等待节点的指针
+ * @param[in] rc: 等待的结果
+ * @details
+ * + 指定了工作队列时，回调函数在工作队列的工作线程中执行；
+ * + 没有指定工作队列时，回调函数在本地CPU的中断底半部中执行，
+ *   若配置 `XWOSCFG_SKD_BH` 为 `0` ，则在本地CPU的系统工作队列中执行。
+ */
+__xwmp_code
+void xwmp_aw_fire(struct xwmp_aw * aw, xwer_t rc)
+{
+        aw->rc = rc;
+        if (NULL != aw->workq) {
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_work_queue_on(aw->workq, aw->cpuid, &aw->work);
+        } else {
+#if defined(XWOSCFG_SKD_BH) && (1 == XWOSCFG_SKD_BH)
+                struct xwmp_skd * xwskd;
+                xwreg_t cpuirq;
+
+                xwmp_cpuirq_save_lc(&cpuirq);
+                xwskd = xwmp_skd_get_lc();
+                xwmp_bh_node_eq(&xwskd->bhcb, &aw->bhn);
+                xwmp_skd_req_bh(xwskd); // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_cpuirq_restore_lc(cpuirq);
+#else
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_work_queue(&xwmp_workq_sys, &aw->work);
+#endif
+        }
+}
+
+/**
+ * @brief 异步等待节点的等待队列回调函数
+ * @param[in] wqn: 等待队列节点
+ * @note
+ * + 由唤醒或中断等待队列节点的函数在释放所有锁之后调用。
+ */
+__xwmp_code
+void xwmp_aw_wqn_cb(struct xwmp_wqn * wqn)
+{
+        struct xwmp_aw * aw;
+        xwsq_t reason;
+
+        aw = xwcc_derof(wqn, struct xwmp_aw, wqn);
+        reason = xwaop_load(xwsq_t, &wqn->reason, xwaop_mo_acquire);
+        if ((xwsq_t)XWMP_WQN_REASON_UP == reason) {
+                xwmp_aw_fire(aw, XWOK);
+        } else {
+                xwmp_aw_fire(aw, -EINTR);
+        }
+}
+
+#if (1 == XWOSRULE_SKD_WQ_PL)
+/**
+ * @brief 将异步等待节点加入到管道（双循环链表）等待队列中
+ * @param[in] aw: 异步等待节点的指针
+ * @param[in] xwplwq: 管道（双循环链表）等待队列
+ * @param[in] type: 等待队列的类型
+ * @param[in] cb: 等待队列节点的回调函数
+ */
+__xwmp_code
+void xwmp_aw_eq_plwq_locked(struct xwmp_aw * aw, struct xwmp_plwq * xwplwq,
+                            xwu16_t type, xwmp_wqn_f cb)
+{
+        xwmp_splk_lock(&aw->wqn.lock);
+        aw->wqn.wq = xwplwq;
+        aw->wqn.type = type;
+        xwaop_store(xwsq_t, &aw->wqn.reason,
+                    xwaop_mo_release, (xwsq_t)XWMP_WQN_REASON_UNKNOWN);
+        aw->wqn.cb = cb;
+        xwmp_plwq_add_tail_locked(xwplwq, &aw->wqn);
+        xwmp_splk_unlock(&aw->wqn.lock);
+}
+#endif
+
+#if (1 == XWOSRULE_SKD_WQ_RT)
+/**
+ * @brief 将异步等待节点加入到实时（红黑树）等待队列中
+ * @param[in] aw: 异步等待节点的指针
+ * @param[in] xwrtwq: 实时（红黑树）等待队列
+ * @param[in] type: 等待队列的类型
+ * @details
+ * 节点以执行回调函数的上下文的优先级排队：
+ * 工作队列的工作线程的优先级，或者中断底半部的最高优先级。
+ */
+__xwmp_code
+void xwmp_aw_eq_rtwq_locked(struct xwmp_aw * aw, struct xwmp_rtwq * xwrtwq,
+                            xwu16_t type)
+{
+        xwpr_t prio;
+
+        if (NULL != aw->workq) {
+                prio = aw->workq->priority;
+        } else {
+                prio = XWMP_SKD_PRIORITY_RT_MAX;
+        }
+        xwmp_splk_lock(&aw->wqn.lock);
+        aw->wqn.wq = xwrtwq;
+        aw->wqn.type = type;
+        xwaop_store(xwsq_t, &aw->wqn.reason,
+                    xwaop_mo_release, (xwsq_t)XWMP_WQN_REASON_UNKNOWN);
+        aw->wqn.cb = xwmp_aw_wqn_cb;
+        xwmp_rtwq_add_locked(xwrtwq, &aw->wqn, prio);
+        xwmp_splk_unlock(&aw->wqn.lock);
+}
+#endif
+
+/**
+ * @brief XWMP API：取消异步等待
+ * @param[in] aw: 异步等待节点的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ESRCH: 节点不在等待队列中（未注册或已被唤醒）
+ * @details
+ * 取消成功后，回调函数仍会被执行一次，等待的结果为 `-EINTR` 。
+ */
+__xwmp_api
+xwer_t xwmp_aw_cancel(struct xwmp_aw * aw)
+{
+        xwer_t rc;
+
+        switch (aw->objtype) {
+#if defined(XWOSCFG_SYNC_PLSEM) && (1 == XWOSCFG_SYNC_PLSEM)
+        case XWMP_WQTYPE_PLSEM:
+                rc = xwmp_plsem_intr(aw->obj, &aw->wqn);
+                break;
+#endif
+#if defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)
+        case XWMP_WQTYPE_RTSEM:
+                rc = xwmp_rtsem_intr(aw->obj, &aw->wqn);
+                break;
+#endif
+#if defined(XWOSCFG_SYNC_COND) && (1 == XWOSCFG_SYNC_COND)
+        case XWMP_WQTYPE_COND:
+                rc = xwmp_cond_intr(aw->obj, &aw->wqn);
+                break;
+#endif
+#if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+        case XWMP_WQTYPE_EVENT:
+                rc = xwmp_flg_aw_intr(aw->obj, aw);
+                break;
+#endif
+        default:
+                rc = -ESRCH;
+                break;
+        }
+        return rc;
+}
+
+/**
+ * @brief XWMP API：测试异步等待节点是否已注册，或回调函数还未开始执行
+ * @param[in] aw: 异步等待节点的指针
+ * @return 布尔值
+ */
+__xwmp_api
+bool xwmp_aw_tst_busy(struct xwmp_aw * aw)
+{
+        return ((xwsq_t)0 != xwaop_load(xwsq_t, &aw->busy, xwaop_mo_acquire));
+}
+
+/**
+ * @brief 执行用户的回调函数
+ * @param[in] aw: 异步等待节点的指针
+ * @details
+ * 先清除 `busy` ，回调函数中可以再次注册同一个节点。
+ */
+static __xwmp_code
+void xwmp_aw_run(struct xwmp_aw * aw)
+{
+        xwer_t rc;
+
+        rc = aw->rc;
+        xwaop_store(xwsq_t, &aw->busy, xwaop_mo_release, 0);
+        aw->func(aw, rc, aw->arg);
+}
+
+#if defined(XWOSCFG_SKD_BH) && (1 == XWOSCFG_SKD_BH)
+/**
+ * @brief 中断底半部中执行的函数
+ * @param[in] arg: 异步等待节点的指针
+ */
+static __xwmp_code
+void xwmp_aw_bh(void * arg)
+{
+        xwmp_aw_run(arg);
+}
+#endif
+
+/**
+ * @brief 工作队列中执行的工作函数
+ * @param[in] work: 工作的指针
+ * @param[in] arg: 异步等待节点的指针
+ */
+static __xwmp_code
+void xwmp_aw_work(struct xwmp_work * work, void * arg)
+{
+        XWOS_UNUSED(work);
+        xwmp_aw_run(arg);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file
+ * @brief XWOS MP内核同步机制：异步等待
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_mp_sync_aw_h__
+#define __xwos_mp_sync_aw_h__
+
+#include <xwos/standard.h>
+#include <xwos/mp/wqn.h>
+#include <xwos/mp/plwq.h>
+#include <xwos/mp/rtwq.h>
+#if defined(XWOSCFG_SKD_BH) && (1 == XWOSCFG_SKD_BH)
+#  include <xwos/mp/bh.h>
+#endif
+#include <xwos/mp/workq.h>
+
+struct xwmp_aw;
+
+/**
+ * @brief 异步等待的回调函数
+ * @param[in] aw: 异步等待节点的指针
+ * @param[in] rc: 等待的结果：
+ * + `XWOK` ：同步对象可用
+ * + `-EINTR` ：等待被取消
+ * @param[in] arg: 用户参数
+ */
+typedef void (* xwmp_aw_f)(struct xwmp_aw *, xwer_t, void *);
+
+/**
+ * @brief 异步等待节点
+ */
+struct xwmp_aw {
+        struct xwmp_wqn wqn; /**< C语言面向对象：继承 `struct xwmp_wqn` */
+        xwmp_aw_f func; /**< 回调函数 */
+        void * arg; /**< 回调函数的参数 */
+        struct xwmp_workq * workq; /**< 执行回调函数的工作队列，
+                                        `NULL` 表示在中断底半部执行 */
+        xwid_t cpuid; /**< 执行回调函数的CPU */
+        atomic_xwsq_t busy; /**< 是否已注册且回调函数还未开始执行 */
+        void * obj; /**< 正在等待的同步对象 */
+        xwsq_t objtype; /**< 正在等待的同步对象的等待队列类型 */
+        xwer_t rc; /**< 等待的结果 */
+        struct {
+                xwsq_t trigger; /**< 事件标志的触发条件 */
+                bool consumption; /**< 是否消费事件 */
+                xwbmp_t * origin; /**< 事件标志的初始状态/触发时的状态 */
+                xwbmp_t * msk; /**< 事件标志的掩码 */
+        } flg; /**< 等待事件标志时的参数 */
+        xwsq_t pos; /**< 等待线程栅栏时占用的位置，或合并树栅栏到达时的代数 */
+#if defined(XWOSCFG_SKD_BH) && (1 == XWOSCFG_SKD_BH)
+        struct xwmp_bh_node bhn; /**< 中断底半部节点 */
+#endif
+        struct xwmp_work work; /**< 工作 */
+};
+
+void xwmp_aw_init(struct xwmp_aw * aw, xwmp_aw_f func, void * arg,
+                  struct xwmp_workq * workq, xwid_t cpuid);
+xwer_t xwmp_aw_cancel(struct xwmp_aw * aw);
+bool xwmp_aw_tst_busy(struct xwmp_aw * aw);
+
+xwer_t xwmp_aw_arm(struct xwmp_aw * aw, void * obj, xwsq_t objtype);
+void xwmp_aw_fire(struct xwmp_aw * aw, xwer_t rc);
+void xwmp_aw_wqn_cb(struct xwmp_wqn * wqn);
+#if (1 == XWOSRULE_SKD_WQ_PL)
+void xwmp_aw_eq_plwq_locked(struct xwmp_aw * aw, struct xwmp_plwq * xwplwq,
+                            xwu16_t type, xwmp_wqn_f cb);
+#endif
+#if (1 == XWOSRULE_SKD_WQ_RT)
+void xwmp_aw_eq_rtwq_locked(struct xwmp_aw * aw, struct xwmp_rtwq * xwrtwq,
+                            xwu16_t type);
+#endif
+
+#endif /* xwos/mp/sync/aw.h */
@@ -11,8 +11,13 @@
  * @note
  * - 锁的顺序：同级的锁不可同时获得
  *   + ① 等待队列的锁（plwq->lock）
+ *     + ② 互斥锁等待队列的锁（mtx->rtwq.lock）
+ *       + ③ 等待队列节点的锁（wqn->lock）
  *     + ② 等待队列节点的锁（wqn->lock）
  *     + ② 线程控制块的状态锁（thd->stlock）
+ * - 广播条件量时，若等待线程关联的互斥锁已被其他线程拥有，
+ *   只唤醒第一个等待线程，其余的线程按优先级直接转移到互斥锁的等待队列中，
+ *   由解锁操作逐个将互斥锁交给它们，避免所有线程被唤醒后又争抢同一个互斥锁。
  */
 
 #include <xwos/standard.h>
@@ -33,6 +38,7 @@
 #include <xwos/mp/tt.h>
 #include <xwos/mp/thd.h>
 #include <xwos/mp/plwq.h>
+#include <xwos/mp/rtwq.h>
 #include <xwos/mp/lock/spinlock.h>
 #include <xwos/mp/lock/seqlock.h>
 #if (defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX))
@@ -43,6 +49,9 @@
 #include <xwos/mp/sync/obj.h>
 #include <xwos/mp/sync/evt.h>
 #include <xwos/mp/sync/cond.h>
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+#  include <xwos/mp/sync/aw.h>
+#endif
 
 /* #define XWOS_CONDLOGF */ /**< 调试日志开关 */
 #ifdef XWOS_CONDLOGF
@@ -588,6 +597,118 @@ xwer_t xwmp_cond_broadcast_once(struct xwmp_cond * cond, bool * retry)
         return rc;
 }
 
+#if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
+/**
+ * @brief 将条件量等待队列中的第一个线程转移到互斥锁的等待队列中
+ * @param[in] cond: 条件量对象的指针
+ * @param[out] retry: 指向缓冲区的指针，通过此缓冲区返回是否需要继续
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENEGATIVE: 条件量已被冻结
+ * @retval -ENOLCK: 线程不能被转移，需要直接唤醒
+ * @details
+ * 只有线程等待时关联了互斥锁，并且互斥锁正被其他线程拥有时，才可转移。
+ * 转移时代替线程增加互斥锁的引用计数，线程获得互斥锁后由解锁操作减少。
+ */
+static __xwmp_code
+xwer_t xwmp_cond_requeue_once(struct xwmp_cond * cond, bool * retry)
+{
+        struct xwmp_wqn * wqn;
+        struct xwmp_thd * thd;
+        struct xwmp_mtx * mtx;
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        xwmp_plwq_lock_cpuirqsv(&cond->wq.pl, &cpuirq);
+        if (cond->count < (xwssq_t)0) {
+                xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
+                rc = -ENEGATIVE;
+                *retry = false;
+        } else if (xwlib_bclst_tst_empty(&cond->wq.pl.head)) {
+                xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
+                rc = XWOK;
+                *retry = false;
+        } else {
+                wqn = xwlib_bclst_first_entry(&cond->wq.pl.head,
+                                              struct xwmp_wqn, cln.pl);
+                thd = xwcc_derof(wqn, struct xwmp_thd, wqn);
+                mtx = wqn->rqlk;
+                rc = -ENOLCK;
+                if ((NULL != mtx) && (XWOK == xwmp_mtx_grab(mtx))) {
+                        xwmp_rtwq_lock(&mtx->rtwq);
+                        if ((NULL != mtx->ownertree) &&
+                            (&thd->mt != mtx->ownertree)) {
+                                wqn = xwmp_plwq_choose_locked(&cond->wq.pl);
+                                wqn->wq = &mtx->rtwq;
+                                wqn->type = (xwsq_t)XWMP_WQTYPE_MTX;
+                                wqn->rqed = true;
+                                xwmp_rtwq_add_locked(&mtx->rtwq, wqn, thd->dprio.wq);
+                                xwmp_splk_unlock(&wqn->lock);
+                                xwmp_rtwq_unlock(&mtx->rtwq);
+                                xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
+                                xwmp_mtx_chprio(mtx);
+                                rc = XWOK;
+                                *retry = true;
+                        } else {
+                                xwmp_rtwq_unlock(&mtx->rtwq);
+                                xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
+                                xwmp_mtx_put(mtx); // cppcheck-suppress [misra-c2012-17.7]
+                        }
+                } else {
+                        xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
+                }
+        }
+        return rc;
+}
+
+/**
+ * @brief 确定被转移到互斥锁等待队列中的线程的互斥锁状态
+ * @param[in] thd: 线程控制块对象的指针
+ * @param[out] lkst: 指向缓冲区的指针，通过此缓冲区返回互斥锁的状态
+ * @details
+ * + 线程仍在互斥锁的等待队列中（超时或被中断），将其移除，互斥锁未上锁；
+ * + 线程已被解锁操作唤醒，互斥锁已被解锁操作直接交给线程；
+ * + 线程已被 `xwmp_mtx_intr()` 中断，互斥锁未上锁。
+ */
+static __xwmp_code
+void xwmp_cond_requeue_settle(struct xwmp_thd * thd, xwsq_t * lkst)
+{
+        struct xwmp_mtx * mtx;
+        xwsq_t reason;
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        mtx = thd->wqn.rqlk;
+        xwmp_rtwq_lock_cpuirqsv(&mtx->rtwq, &cpuirq);
+        xwmp_splk_lock(&thd->wqn.lock);
+        rc = xwmp_rtwq_remove_locked(&mtx->rtwq, &thd->wqn);
+        if (XWOK == rc) {
+                thd->wqn.wq = NULL;
+                thd->wqn.type = (xwsq_t)XWMP_WQTYPE_UNKNOWN;
+                xwaop_store(xwsq_t, &thd->wqn.reason,
+                            xwaop_mo_release, (xwsq_t)XWMP_WQN_REASON_INTR);
+                thd->wqn.cb = NULL;
+                xwmp_splk_unlock(&thd->wqn.lock);
+                xwmp_splk_lock(&thd->stlock);
+                xwbop_c0m(xwsq_t, &thd->state, (xwsq_t)XWMP_SKDOBJ_ST_BLOCKING);
+                thd->dprio.wq = XWMP_SKD_PRIORITY_INVALID;
+                xwmp_splk_unlock(&thd->stlock);
+                xwmp_rtwq_unlock_cpuirqrs(&mtx->rtwq, cpuirq);
+                xwmp_mtx_chprio(mtx);
+                xwmp_mtx_put(mtx); // cppcheck-suppress [misra-c2012-17.7]
+        } else {
+                xwmp_splk_unlock(&thd->wqn.lock);
+                xwmp_rtwq_unlock_cpuirqrs(&mtx->rtwq, cpuirq);
+                reason = xwaop_load(xwsq_t, &thd->wqn.reason, xwaop_mo_relaxed);
+                if ((xwsq_t)XWMP_WQN_REASON_UP == reason) {
+                        *lkst = (xwsq_t)XWOS_LKST_LOCKED;
+                } else {
+                        xwmp_mtx_put(mtx); // cppcheck-suppress [misra-c2012-17.7]
+                }
+        }
+}
+#endif
+
 __xwmp_api
 xwer_t xwmp_cond_broadcast(struct xwmp_cond * cond)
 {
@@ -595,9 +716,17 @@ xwer_t xwmp_cond_broadcast(struct xwmp_cond * cond)
         xwer_t rc;
 
         retry = false;
-        do {
+        rc = xwmp_cond_broadcast_once(cond, &retry);
+        while (retry) {
+#if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
+                rc = xwmp_cond_requeue_once(cond, &retry);
+                if (-ENOLCK == rc) {
+                        rc = xwmp_cond_broadcast_once(cond, &retry);
+                }
+#else
                 rc = xwmp_cond_broadcast_once(cond, &retry);
-        } while (retry);
+#endif
+        }
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
         if (XWOK == rc) {
                 struct xwmp_evt * evt;
@@ -788,6 +917,8 @@ xwer_t xwmp_cond_block_to(struct xwmp_cond * cond,
         thd->dprio.wq = dprio;
         xwbop_s1m(xwsq_t, &thd->state, (xwsq_t)XWMP_SKDOBJ_ST_BLOCKING);
         xwmp_splk_unlock(&thd->stlock);
+        thd->wqn.rqlk = ((xwsq_t)XWOS_LK_MTX == lktype) ? lock : NULL;
+        thd->wqn.rqed = false;
         xwmp_thd_eq_plwq_locked(thd, &cond->wq.pl, (xwsq_t)XWMP_WQTYPE_COND);
         xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
 
@@ -842,6 +973,13 @@ xwer_t xwmp_cond_block_to(struct xwmp_cond * cond,
                 }
                 xwmp_sqlk_wr_unlock_cpuirqrs(&xwtt->lock, cpuirq);
                 rc = -EINTR;
+#if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
+                if (thd->wqn.rqed) {
+                        /* 已被唤醒，但在互斥锁的等待队列中被中断 */
+                        xwmp_cond_requeue_settle(thd, lkst);
+                        rc = XWOK;
+                }
+#endif
         } else if ((xwsq_t)XWMP_WQN_REASON_UP == reason) {
                 xwmp_sqlk_wr_lock_cpuirq(&xwtt->lock);
                 rc = xwmp_tt_remove_locked(xwtt, &thd->ttn);
@@ -851,7 +989,13 @@ xwer_t xwmp_cond_block_to(struct xwmp_cond * cond,
                         xwmp_splk_unlock(&thd->stlock);
                 }
                 xwmp_sqlk_wr_unlock_cpuirqrs(&xwtt->lock, cpuirq);
+#if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
+                if (thd->wqn.rqed) {
+                        xwmp_cond_requeue_settle(thd, lkst);
+                } else if ((xwsq_t)XWOS_LKST_UNLOCKED == *lkst) {
+#else
                 if ((xwsq_t)XWOS_LKST_UNLOCKED == *lkst) {
+#endif
                         rc = xwmp_cond_lock(lock, lktype, to, false, lkdata);
                         if (XWOK == rc) {
                                 *lkst = (xwsq_t)XWOS_LKST_LOCKED;
@@ -879,7 +1023,14 @@ xwer_t xwmp_cond_block_to(struct xwmp_cond * cond,
                         xwmp_splk_unlock(&thd->wqn.lock);
                         xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
                         reason = xwaop_load(xwsq_t, &thd->wqn.reason, xwaop_mo_relaxed);
+#if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
+                        if (thd->wqn.rqed) {
+                                xwmp_cond_requeue_settle(thd, lkst);
+                                rc = XWOK;
+                        } else if ((xwsq_t)XWMP_WQN_REASON_INTR == reason) {
+#else
                         if ((xwsq_t)XWMP_WQN_REASON_INTR == reason) {
+#endif
                                 rc = -EINTR;
                         } else if ((xwsq_t)XWMP_WQN_REASON_UP == reason) {
                                 if ((xwsq_t)XWOS_LKST_UNLOCKED == *lkst) {
@@ -915,7 +1066,14 @@ xwer_t xwmp_cond_block_to(struct xwmp_cond * cond,
                 } else {
                         xwmp_splk_unlock(&thd->wqn.lock);
                         xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
+#if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
+                        if (thd->wqn.rqed) {
+                                xwmp_cond_requeue_settle(thd, lkst);
+                                rc = XWOK;
+                        } else if ((xwsq_t)XWMP_WQN_REASON_INTR == reason) {
+#else
                         if ((xwsq_t)XWMP_WQN_REASON_INTR == reason) {
+#endif
                                 rc = -EINTR;
                         } else if ((xwsq_t)XWMP_WQN_REASON_UP == reason) {
                                 if ((xwsq_t)XWOS_LKST_UNLOCKED == *lkst) {
@@ -1048,6 +1206,8 @@ xwer_t xwmp_cond_block_unintr(struct xwmp_cond * cond,
         xwbop_s1m(xwsq_t, &thd->state, ((xwsq_t)XWMP_SKDOBJ_ST_BLOCKING |
                                         (xwsq_t)XWMP_SKDOBJ_ST_UNINTERRUPTED));
         xwmp_splk_unlock(&thd->stlock);
+        thd->wqn.rqlk = ((xwsq_t)XWOS_LK_MTX == lktype) ? lock : NULL;
+        thd->wqn.rqed = false;
         xwmp_thd_eq_plwq_locked(thd, &cond->wq.pl, (xwsq_t)XWMP_WQTYPE_COND);
         xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
 
@@ -1077,7 +1237,13 @@ xwer_t xwmp_cond_block_unintr(struct xwmp_cond * cond,
         /* 判断唤醒原因 */
         reason = xwaop_load(xwsq_t, &thd->wqn.reason, xwaop_mo_relaxed);
         if ((xwsq_t)XWMP_WQN_REASON_UP == reason) {
+#if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
+                if (thd->wqn.rqed) {
+                        xwmp_cond_requeue_settle(thd, lkst);
+                } else if ((xwsq_t)XWOS_LKST_UNLOCKED == *lkst) {
+#else
                 if ((xwsq_t)XWOS_LKST_UNLOCKED == *lkst) {
+#endif
                         rc = xwmp_cond_lock(lock, lktype, 0, true, lkdata);
                         if (XWOK == rc) {
                                 *lkst = (xwsq_t)XWOS_LKST_LOCKED;
@@ -1118,3 +1284,21 @@ xwer_t xwmp_cond_wait_unintr(struct xwmp_cond * cond,
         rc = xwmp_cond_acquire_unintr(cond, cthd, lock, lktype, lkdata, lkst);
         return rc;
 }
+
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+__xwmp_api
+xwer_t xwmp_cond_wait_async(struct xwmp_cond * cond, struct xwmp_aw * aw)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        rc = xwmp_aw_arm(aw, cond, (xwsq_t)XWMP_WQTYPE_COND);
+        if (XWOK == rc) {
+                xwmp_plwq_lock_cpuirqsv(&cond->wq.pl, &cpuirq);
+                xwmp_aw_eq_plwq_locked(aw, &cond->wq.pl, (xwu16_t)XWMP_WQTYPE_COND,
+                                       xwmp_aw_wqn_cb);
+                xwmp_plwq_unlock_cpuirqrs(&cond->wq.pl, cpuirq);
+        }
+        return rc;
+}
+#endif
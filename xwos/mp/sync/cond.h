@@ -24,6 +24,7 @@
 
 struct xwmp_thd;
 struct xwmp_evt;
+struct xwmp_aw;
 
 /**
  * @brief 条件量对象
@@ -78,5 +79,8 @@ xwer_t xwmp_cond_wait_to(struct xwmp_cond * cond,
 xwer_t xwmp_cond_wait_unintr(struct xwmp_cond * cond,
                              void * lock, xwsq_t lktype,
                              void * lkdata, xwsq_t * lkst);
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+xwer_t xwmp_cond_wait_async(struct xwmp_cond * cond, struct xwmp_aw * aw);
+#endif
 
 #endif /* xwos/mp/sync/cond.h */
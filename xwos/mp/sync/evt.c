@@ -13,12 +13,29 @@
  *   + ① plwq.lock
  *   + ① rtwq.lock
  *     + ② evt.lock
+ *       + ③ evt.awq.lock
+ * - 事件标志的快速路径：
+ *   + 修改事件标志时不加锁，使用原子操作修改位图；
+ *   + 等待者先增加 `evt->waiters` ，再以全屏障隔开，然后加锁检查触发条件；
+ *     修改者修改位图后，同样以全屏障隔开，再读取 `evt->waiters` ，
+ *     二者至少有一方能看到对方的修改；
+ *   + `evt->waiters` 为0并且没有绑定到信号选择器时，修改者不需要加锁与广播条件量。
+ * - 线程栅栏的合并树（配置 `XWOSCFG_SYNC_BR_TREE` 为 `1` ）：
+ *   + 根节点是原子计数器 `evt->brcnt` ，低16位为到达者数量，高位为代数，
+ *     到达者使用CAS增加数量，最后一个到达者将数量清0并增加代数，不需要加锁；
+ *   + 叶子节点是每个CPU的子栅栏 `evt->brn[cpuid]` ，
+ *     到达者在所在CPU的子栅栏上等待，只与同一个CPU上的到达者竞争锁；
+ *   + 最后一个到达者广播自己所在的子栅栏，其他CPU的子栅栏只单播唤醒一个等待者，
+ *     被唤醒的等待者再在所在CPU上广播自己的子栅栏，唤醒的工作分散到各个CPU上；
+ *   + 子栅栏的条件量按代数的奇偶交替使用，下一代的等待者不会被上一代的广播唤醒。
  */
 
 #include <xwos/standard.h>
 #include <xwos/lib/xwlog.h>
 #include <string.h>
 #include <xwos/lib/xwbop.h>
+#include <xwos/lib/xwaop.h>
+#include <xwos/lib/mb.h>
 #include <xwos/mm/common.h>
 #if defined(XWOSCFG_SYNC_EVT_MEMPOOL) && (1 == XWOSCFG_SYNC_EVT_MEMPOOL)
 #  include <xwos/mm/mempool/allocator.h>
@@ -35,6 +52,9 @@
 #include <xwos/mp/sync/obj.h>
 #include <xwos/mp/sync/cond.h>
 #include <xwos/mp/sync/evt.h>
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+#  include <xwos/mp/sync/aw.h>
+#endif
 
 /* #define XWOS_EVTLOGF */ /**< 调试日志开关 */
 #ifdef XWOS_EVTLOGF
@@ -134,6 +154,43 @@ static __xwmp_code
 xwer_t xwmp_flg_wait_unintr_edge(struct xwmp_evt * evt, xwsq_t trigger,
                                  xwbmp_t origin[], xwbmp_t msk[]);
 
+static __xwmp_code
+bool xwmp_evt_tst_notify(struct xwmp_evt * evt);
+
+static __xwmp_code
+xwer_t xwmp_flg_unlock_and_notify(struct xwmp_evt * evt, xwreg_t cpuirq);
+
+static __xwmp_code
+xwer_t xwmp_flg_notify(struct xwmp_evt * evt);
+
+static __xwmp_code
+bool xwmp_flg_t1ma_then_c0m(struct xwmp_evt * evt, xwbmp_t msk[]);
+
+static __xwmp_code
+bool xwmp_flg_t1mo_then_c0m(struct xwmp_evt * evt, xwbmp_t msk[]);
+
+static __xwmp_code
+bool xwmp_flg_t0ma_then_s1m(struct xwmp_evt * evt, xwbmp_t msk[]);
+
+static __xwmp_code
+bool xwmp_flg_t0mo_then_s1m(struct xwmp_evt * evt, xwbmp_t msk[]);
+
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+static __xwmp_code
+bool xwmp_flg_aw_test_locked(struct xwmp_evt * evt, struct xwmp_aw * aw);
+
+static __xwmp_code
+void xwmp_br_aw_wqn_cb(struct xwmp_wqn * wqn);
+#endif
+
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+static __xwmp_code
+void xwmp_br_brn_activate(struct xwmp_evt * evt);
+
+static __xwmp_code
+void xwmp_br_brn_deactivate(struct xwmp_evt * evt);
+#endif
+
 #if defined(XWOSCFG_SYNC_EVT_MEMPOOL) && (1 == XWOSCFG_SYNC_EVT_MEMPOOL)
 /**
  * @brief XWMP INIT CODE：初始化 `struct xwmp_evt` 的对象缓存
@@ -342,6 +399,14 @@ void xwmp_evt_free(struct xwmp_evt * evt)
 static __xwmp_code
 void xwmp_evt_construct(struct xwmp_evt * evt)
 {
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+        xwid_t i;
+
+        for (i = 0; i < (xwid_t)CPUCFG_CPU_NUM; i++) {
+                xwmp_cond_construct(&evt->brn[i].cond[0]);
+                xwmp_cond_construct(&evt->brn[i].cond[1]);
+        }
+#endif
         xwmp_synobj_construct(&evt->cond.synobj);
 }
 
@@ -368,6 +433,14 @@ void xwmp_evt_setup(struct xwmp_evt * evt, xwsz_t num,
 static __xwmp_code
 void xwmp_evt_destruct(struct xwmp_evt * evt)
 {
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+        xwid_t i;
+
+        for (i = 0; i < (xwid_t)CPUCFG_CPU_NUM; i++) {
+                xwmp_cond_destruct(&evt->brn[i].cond[0]);
+                xwmp_cond_destruct(&evt->brn[i].cond[1]);
+        }
+#endif
         xwmp_cond_destruct(&evt->cond);
 }
 
@@ -381,6 +454,9 @@ xwer_t xwmp_evt_sgc(struct xwos_object * obj)
         struct xwmp_evt * evt;
 
         evt = xwcc_derof(obj, struct xwmp_evt, cond.synobj.xwobj);
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+        xwmp_br_brn_deactivate(evt);
+#endif
         xwmp_evt_destruct(evt);
         return XWOK;
 }
@@ -396,6 +472,9 @@ xwer_t xwmp_evt_dgc(struct xwos_object * obj)
         struct xwmp_evt * evt;
 
         evt = xwcc_derof(obj, struct xwmp_evt, cond.synobj.xwobj);
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+        xwmp_br_brn_deactivate(evt);
+#endif
         xwmp_evt_free(evt);
         return XWOK;
 }
@@ -418,6 +497,13 @@ xwer_t xwmp_evt_activate(struct xwmp_evt * evt, xwsq_t type, xwobj_gc_f gcfunc)
         xwsq_t i;
 
         size = BITS_TO_XWBMP_T(evt->num);
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+        if (((xwsq_t)XWMP_EVT_TYPE_BR == (type & (xwsq_t)XWMP_EVT_TYPE_MASK)) &&
+            ((xwsq_t)evt->num > XWMP_BR_CNT_MSK)) {
+                rc = -ESIZE;
+                goto err_num_range;
+        }
+#endif
         rc = xwmp_cond_activate(&evt->cond, gcfunc);
         if (rc < 0) {
                 goto err_cond_activate;
@@ -429,6 +515,9 @@ xwer_t xwmp_evt_activate(struct xwmp_evt * evt, xwsq_t type, xwobj_gc_f gcfunc)
                 for (i = 0; i < evt->num; i++) {
                         xwbmpop_s1i(evt->msk, i);
                 }
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+                xwmp_br_brn_activate(evt);
+#endif
                 break;
         case XWMP_EVT_TYPE_SEL:
                 memset(evt->msk, 0, size); // cppcheck-suppress [misra-c2012-17.7]
@@ -440,9 +529,16 @@ xwer_t xwmp_evt_activate(struct xwmp_evt * evt, xwsq_t type, xwobj_gc_f gcfunc)
         }
         memset(evt->bmp, 0, size); // cppcheck-suppress [misra-c2012-17.7]
         xwmp_splk_init(&evt->lock);
+        xwaop_store(xwsq_t, &evt->waiters, xwaop_mo_relaxed, 0);
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+        xwmp_plwq_init(&evt->awq);
+#endif
         return XWOK;
 
 err_cond_activate:
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+err_num_range:
+#endif
         return rc;
 }
 
@@ -538,35 +634,134 @@ xwer_t xwmp_evt_get_num(struct xwmp_evt * evt, xwsz_t * numbuf)
 __xwmp_code
 xwer_t xwmp_evt_intr_all(struct xwmp_evt * evt)
 {
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+        if ((xwsq_t)XWMP_EVT_TYPE_BR == (evt->type & (xwsq_t)XWMP_EVT_TYPE_MASK)) {
+                xwid_t i;
+
+                for (i = 0; i < (xwid_t)CPUCFG_CPU_NUM; i++) {
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        xwmp_cond_intr_all(&evt->brn[i].cond[0]);
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        xwmp_cond_intr_all(&evt->brn[i].cond[1]);
+                }
+        }
+#endif
         return xwmp_cond_intr_all(&evt->cond);
 }
 
-/******** type:XWMP_EVT_TYPE_FLG ********/
-__xwmp_api
-xwer_t xwmp_flg_s1m(struct xwmp_evt * evt, xwbmp_t msk[])
+/**
+ * @brief 测试修改位图后是否需要通知等待者
+ * @param[in] evt: 事件对象的指针
+ * @return 布尔值
+ * @retval true: 有等待者，或事件对象绑定到信号选择器上
+ * @retval false: 不需要通知
+ * @note
+ * + 只能在持有锁 `evt->lock` 时，或修改位图后以全屏障隔开后调用。
+ */
+static __xwmp_code
+bool xwmp_evt_tst_notify(struct xwmp_evt * evt)
 {
-        xwreg_t cpuirq;
+        struct xwmp_evt * sel;
+        xwsq_t waiters;
 
-        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
-        xwbmpop_s1m(evt->bmp, msk, evt->num);
+        waiters = xwaop_load(xwsq_t, &evt->waiters, xwaop_mo_relaxed);
+        xwmb_mp_load_acquire(struct xwmp_evt *, sel, &evt->cond.synobj.sel.evt);
+        return (((xwsq_t)0 != waiters) || (NULL != sel));
+}
+
+/******** type:XWMP_EVT_TYPE_FLG ********/
+/**
+ * @brief 修改事件标志后，解锁并通知等待者
+ * @param[in] evt: 事件对象的指针
+ * @param[in] cpuirq: 加锁前CPU中断的状态
+ * @return 错误码 @ref xwmp_cond_broadcast()
+ * @details
+ * + 异步等待的节点在持有 `evt->lock` 时就检查触发条件，
+ *   被触发的节点从 `evt->awq` 中移除，解锁后再推迟执行其回调函数；
+ *   没有被触发的节点留在 `evt->awq` 中，不需要被唤醒后再重新加入。
+ * + 线程由条件量广播唤醒后自己检查触发条件。
+ */
+static __xwmp_code
+xwer_t xwmp_flg_unlock_and_notify(struct xwmp_evt * evt, xwreg_t cpuirq)
+{
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+        struct xwlib_bclst_head fired;
+        struct xwmp_wqn * c;
+        struct xwmp_wqn * n;
+        struct xwmp_aw * aw;
+
+        xwlib_bclst_init_head(&fired);
+        xwmp_plwq_lock(&evt->awq);
+        xwmp_plwq_itr_wqn_safe(c, n, &evt->awq) {
+                aw = xwcc_derof(c, struct xwmp_aw, wqn);
+                if (xwmp_flg_aw_test_locked(evt, aw)) {
+                        xwmp_splk_lock(&c->lock);
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        xwmp_plwq_remove_locked(&evt->awq, c);
+                        c->wq = NULL;
+                        c->type = (xwsq_t)XWMP_WQTYPE_UNKNOWN;
+                        xwaop_store(xwsq_t, &c->reason,
+                                    xwaop_mo_release, (xwsq_t)XWMP_WQN_REASON_UP);
+                        c->cb = NULL;
+                        xwmp_splk_unlock(&c->lock);
+                        xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
+                        xwlib_bclst_add_tail(&fired, &c->cln.pl);
+                }
+        }
+        xwmp_plwq_unlock(&evt->awq);
+        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+        while (!xwlib_bclst_tst_empty(&fired)) {
+                c = xwlib_bclst_first_entry(&fired, struct xwmp_wqn, cln.pl);
+                xwlib_bclst_del_init(&c->cln.pl);
+                xwmp_aw_wqn_cb(c);
+        }
+#else
         xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+#endif
         return xwmp_cond_broadcast(&evt->cond);
 }
+/**
+ * @brief 修改事件标志后，在需要时通知等待者
+ * @param[in] evt: 事件对象的指针
+ * @return 错误码
+ * @details
+ * 没有等待者时直接返回，不加锁，也不广播条件量；
+ * 有等待者时，加锁以保证等待者已经检查完触发条件并进入等待队列，再通知它们。
+ */
+static __xwmp_code
+xwer_t xwmp_flg_notify(struct xwmp_evt * evt)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        xwmb_mp_mb();
+        if (xwmp_evt_tst_notify(evt)) {
+                xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
+                rc = xwmp_flg_unlock_and_notify(evt, cpuirq);
+        } else {
+                rc = XWOK;
+        }
+        return rc;
+}
+
+__xwmp_api
+xwer_t xwmp_flg_s1m(struct xwmp_evt * evt, xwbmp_t msk[])
+{
+        xwbmpaop_s1m((atomic_xwbmp_t *)evt->bmp, msk, evt->num);
+        return xwmp_flg_notify(evt);
+}
 
 __xwmp_api
 xwer_t xwmp_flg_s1i(struct xwmp_evt * evt, xwsq_t pos)
 {
         xwer_t rc;
-        xwreg_t cpuirq;
 
         if (pos >= evt->num) {
                 rc = -ECHRNG;
                 goto err_pos_range;
         }
-        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
-        xwbmpop_s1i(evt->bmp, pos);
-        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwmp_cond_broadcast(&evt->cond);
+        xwbmpaop_s1i((atomic_xwbmp_t *)evt->bmp, pos);
+        return xwmp_flg_notify(evt);
 
 err_pos_range:
         return rc;
@@ -575,28 +770,21 @@ err_pos_range:
 __xwmp_api
 xwer_t xwmp_flg_c0m(struct xwmp_evt * evt, xwbmp_t msk[])
 {
-        xwreg_t cpuirq;
-
-        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
-        xwbmpop_c0m(evt->bmp, msk, evt->num);
-        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwmp_cond_broadcast(&evt->cond);
+        xwbmpaop_c0m((atomic_xwbmp_t *)evt->bmp, msk, evt->num);
+        return xwmp_flg_notify(evt);
 }
 
 __xwmp_api
 xwer_t xwmp_flg_c0i(struct xwmp_evt * evt, xwsq_t pos)
 {
         xwer_t rc;
-        xwreg_t cpuirq;
 
         if (pos >= evt->num) {
                 rc = -ECHRNG;
                 goto err_pos_range;
         }
-        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
-        xwbmpop_c0i(evt->bmp, pos);
-        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwmp_cond_broadcast(&evt->cond);
+        xwbmpaop_c0i((atomic_xwbmp_t *)evt->bmp, pos);
+        return xwmp_flg_notify(evt);
 
 err_pos_range:
         return rc;
@@ -606,27 +794,40 @@ __xwmp_api
 xwer_t xwmp_flg_x1m(struct xwmp_evt * evt, xwbmp_t msk[])
 {
         xwreg_t cpuirq;
+        xwer_t rc;
 
+        /* 翻转与等待者消费事件（先测试再清0或置1）不能交换顺序，因此仍需要加锁 */
         xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
-        xwbmpop_x1m(evt->bmp, msk, evt->num);
-        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwmp_cond_broadcast(&evt->cond);
+        xwbmpaop_x1m((atomic_xwbmp_t *)evt->bmp, msk, evt->num);
+        if (xwmp_evt_tst_notify(evt)) {
+                rc = xwmp_flg_unlock_and_notify(evt, cpuirq);
+        } else {
+                xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+                rc = XWOK;
+        }
+        return rc;
 }
 
 __xwmp_api
 xwer_t xwmp_flg_x1i(struct xwmp_evt * evt, xwsq_t pos)
 {
-        xwer_t rc;
         xwreg_t cpuirq;
+        xwer_t rc;
 
         if (pos >= evt->num) {
                 rc = -ECHRNG;
                 goto err_pos_range;
         }
+        /* 翻转与等待者消费事件（先测试再清0或置1）不能交换顺序，因此仍需要加锁 */
         xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
-        xwbmpop_x1i(evt->bmp, pos);
-        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwmp_cond_broadcast(&evt->cond);
+        xwbmpaop_x1i((atomic_xwbmp_t *)evt->bmp, pos);
+        if (xwmp_evt_tst_notify(evt)) {
+                rc = xwmp_flg_unlock_and_notify(evt, cpuirq);
+        } else {
+                xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+                rc = XWOK;
+        }
+        return rc;
 
 err_pos_range:
         return rc;
@@ -635,14 +836,93 @@ err_pos_range:
 __xwmp_api
 xwer_t xwmp_flg_read(struct xwmp_evt * evt, xwbmp_t out[])
 {
-        xwreg_t cpuirq;
-
-        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
-        xwbmpop_assign(out, evt->bmp, evt->num);
-        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+        xwbmpaop_read((atomic_xwbmp_t *)evt->bmp, out, evt->num);
         return XWOK;
 }
 
+/**
+ * @brief 测试掩码中的所有位是否都为1，如果是，就将它们清0
+ * @param[in] evt: 事件对象的指针
+ * @param[in] msk: 掩码
+ * @return 布尔值
+ * @note
+ * + 只能在持有锁 `evt->lock` 时调用。
+ * @details
+ * 测试与清0之间，其他CPU可能不加锁地置1或清0掩码中的位：
+ * 置1可视为发生在测试之前，清0可视为发生在清0之后，结果都与加锁时相同。
+ */
+static __xwmp_code
+bool xwmp_flg_t1ma_then_c0m(struct xwmp_evt * evt, xwbmp_t msk[])
+{
+        bool triggered;
+
+        triggered = xwbmpop_t1ma(evt->bmp, msk, evt->num);
+        if (triggered) {
+                xwbmpaop_c0m((atomic_xwbmp_t *)evt->bmp, msk, evt->num);
+        }
+        return triggered;
+}
+
+/**
+ * @brief 测试掩码中是否有任意位为1，如果是，就将掩码中的所有位清0
+ * @param[in] evt: 事件对象的指针
+ * @param[in] msk: 掩码
+ * @return 布尔值
+ * @note
+ * + 只能在持有锁 `evt->lock` 时调用。
+ */
+static __xwmp_code
+bool xwmp_flg_t1mo_then_c0m(struct xwmp_evt * evt, xwbmp_t msk[])
+{
+        bool triggered;
+
+        triggered = xwbmpop_t1mo(evt->bmp, msk, evt->num);
+        if (triggered) {
+                xwbmpaop_c0m((atomic_xwbmp_t *)evt->bmp, msk, evt->num);
+        }
+        return triggered;
+}
+
+/**
+ * @brief 测试掩码中的所有位是否都为0，如果是，就将它们置1
+ * @param[in] evt: 事件对象的指针
+ * @param[in] msk: 掩码
+ * @return 布尔值
+ * @note
+ * + 只能在持有锁 `evt->lock` 时调用。
+ */
+static __xwmp_code
+bool xwmp_flg_t0ma_then_s1m(struct xwmp_evt * evt, xwbmp_t msk[])
+{
+        bool triggered;
+
+        triggered = xwbmpop_t0ma(evt->bmp, msk, evt->num);
+        if (triggered) {
+                xwbmpaop_s1m((atomic_xwbmp_t *)evt->bmp, msk, evt->num);
+        }
+        return triggered;
+}
+
+/**
+ * @brief 测试掩码中是否有任意位为0，如果是，就将掩码中的所有位置1
+ * @param[in] evt: 事件对象的指针
+ * @param[in] msk: 掩码
+ * @return 布尔值
+ * @note
+ * + 只能在持有锁 `evt->lock` 时调用。
+ */
+static __xwmp_code
+bool xwmp_flg_t0mo_then_s1m(struct xwmp_evt * evt, xwbmp_t msk[])
+{
+        bool triggered;
+
+        triggered = xwbmpop_t0mo(evt->bmp, msk, evt->num);
+        if (triggered) {
+                xwbmpaop_s1m((atomic_xwbmp_t *)evt->bmp, msk, evt->num);
+        }
+        return triggered;
+}
+
 static __xwmp_code
 xwer_t xwmp_flg_wait_level(struct xwmp_evt * evt,
                            xwsq_t trigger, bool consumption,
@@ -662,20 +942,16 @@ xwer_t xwmp_flg_wait_level(struct xwmp_evt * evt,
                 if (consumption) {
                         switch (trigger) {
                         case XWMP_FLG_TRIGGER_SET_ALL:
-                                triggered = xwbmpop_t1ma_then_c0m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t1ma_then_c0m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_SET_ANY:
-                                triggered = xwbmpop_t1mo_then_c0m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t1mo_then_c0m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_CLR_ALL:
-                                triggered = xwbmpop_t0ma_then_s1m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t0ma_then_s1m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_CLR_ANY:
-                                triggered = xwbmpop_t0mo_then_s1m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t0mo_then_s1m(evt, msk);
                                 break;
                         default:
                                 triggered = true;
@@ -795,11 +1071,14 @@ xwer_t xwmp_flg_wait(struct xwmp_evt * evt,
 {
         xwer_t rc;
 
+        xwaop_add(xwsq_t, &evt->waiters, 1, NULL, NULL);
+        xwmb_mp_mb();
         if (trigger <= (xwsq_t)XWMP_FLG_TRIGGER_CLR_ANY) {
                 rc = xwmp_flg_wait_level(evt, trigger, consumption, origin, msk);
         } else {
                 rc = xwmp_flg_wait_edge(evt, trigger, origin, msk);
         }
+        xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
         return rc;
 }
 
@@ -823,20 +1102,16 @@ xwer_t xwmp_flg_wait_to_level(struct xwmp_evt * evt,
                 if (consumption) {
                         switch (trigger) {
                         case XWMP_FLG_TRIGGER_SET_ALL:
-                                triggered = xwbmpop_t1ma_then_c0m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t1ma_then_c0m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_SET_ANY:
-                                triggered = xwbmpop_t1mo_then_c0m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t1mo_then_c0m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_CLR_ALL:
-                                triggered = xwbmpop_t0ma_then_s1m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t0ma_then_s1m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_CLR_ANY:
-                                triggered = xwbmpop_t0mo_then_s1m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t0mo_then_s1m(evt, msk);
                                 break;
                         default:
                                 triggered = true;
@@ -958,11 +1233,14 @@ xwer_t xwmp_flg_wait_to(struct xwmp_evt * evt,
 {
         xwer_t rc;
 
+        xwaop_add(xwsq_t, &evt->waiters, 1, NULL, NULL);
+        xwmb_mp_mb();
         if (trigger <= (xwsq_t)XWMP_FLG_TRIGGER_CLR_ANY) {
                 rc = xwmp_flg_wait_to_level(evt, trigger, consumption, origin, msk, to);
         } else {
                 rc = xwmp_flg_wait_to_edge(evt, trigger, origin, msk, to);
         }
+        xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
         return rc;
 }
 
@@ -983,16 +1261,16 @@ xwer_t xwmp_flg_trywait_level(struct xwmp_evt * evt,
         if (consumption) {
                 switch (trigger) {
                 case XWMP_FLG_TRIGGER_SET_ALL:
-                        triggered = xwbmpop_t1ma_then_c0m(evt->bmp, msk, evt->num);
+                        triggered = xwmp_flg_t1ma_then_c0m(evt, msk);
                         break;
                 case XWMP_FLG_TRIGGER_SET_ANY:
-                        triggered = xwbmpop_t1mo_then_c0m(evt->bmp, msk, evt->num);
+                        triggered = xwmp_flg_t1mo_then_c0m(evt, msk);
                         break;
                 case XWMP_FLG_TRIGGER_CLR_ALL:
-                        triggered = xwbmpop_t0ma_then_s1m(evt->bmp, msk, evt->num);
+                        triggered = xwmp_flg_t0ma_then_s1m(evt, msk);
                         break;
                 case XWMP_FLG_TRIGGER_CLR_ANY:
-                        triggered = xwbmpop_t0mo_then_s1m(evt->bmp, msk, evt->num);
+                        triggered = xwmp_flg_t0mo_then_s1m(evt, msk);
                         break;
                 default:
                         triggered = true;
@@ -1108,20 +1386,16 @@ xwer_t xwmp_flg_wait_unintr_level(struct xwmp_evt * evt,
                 if (consumption) {
                         switch (trigger) {
                         case XWMP_FLG_TRIGGER_SET_ALL:
-                                triggered = xwbmpop_t1ma_then_c0m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t1ma_then_c0m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_SET_ANY:
-                                triggered = xwbmpop_t1mo_then_c0m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t1mo_then_c0m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_CLR_ALL:
-                                triggered = xwbmpop_t0ma_then_s1m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t0ma_then_s1m(evt, msk);
                                 break;
                         case XWMP_FLG_TRIGGER_CLR_ANY:
-                                triggered = xwbmpop_t0mo_then_s1m(evt->bmp, msk,
-                                                                  evt->num);
+                                triggered = xwmp_flg_t0mo_then_s1m(evt, msk);
                                 break;
                         default:
                                 triggered = true;
@@ -1241,14 +1515,179 @@ xwer_t xwmp_flg_wait_unintr(struct xwmp_evt * evt,
 {
         xwer_t rc;
 
+        xwaop_add(xwsq_t, &evt->waiters, 1, NULL, NULL);
+        xwmb_mp_mb();
         if (trigger <= (xwsq_t)XWMP_FLG_TRIGGER_CLR_ANY) {
                 rc = xwmp_flg_wait_unintr_level(evt, trigger, consumption, origin, msk);
         } else {
                 rc = xwmp_flg_wait_unintr_edge(evt, trigger, origin, msk);
         }
+        xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
         return rc;
 }
 
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+/**
+ * @brief 测试异步等待节点的触发条件
+ * @param[in] evt: 事件对象的指针
+ * @param[in] aw: 异步等待节点的指针
+ * @return 布尔值
+ * @retval true: 已触发
+ * @retval false: 未触发
+ * @note
+ * + 只能在持有锁 `evt->lock` 时调用。
+ * @details
+ * 触发时，根据触发条件更新 `aw->flg.origin` ，并消费事件。
+ */
+static __xwmp_code
+bool xwmp_flg_aw_test_locked(struct xwmp_evt * evt, struct xwmp_aw * aw)
+{
+        xwbmp_t * msk;
+        xwbmp_t * origin;
+        xwssq_t cmprc;
+        bool triggered;
+        xwbmpop_define(cur, evt->num);
+        xwbmpop_define(tmp, evt->num);
+
+        msk = aw->flg.msk;
+        origin = aw->flg.origin;
+        if (aw->flg.trigger <= (xwsq_t)XWMP_FLG_TRIGGER_CLR_ANY) {
+                xwbmpop_assign(cur, evt->bmp, evt->num);
+                if (aw->flg.consumption) {
+                        switch (aw->flg.trigger) {
+                        case XWMP_FLG_TRIGGER_SET_ALL:
+                                triggered = xwmp_flg_t1ma_then_c0m(evt, msk);
+                                break;
+                        case XWMP_FLG_TRIGGER_SET_ANY:
+                                triggered = xwmp_flg_t1mo_then_c0m(evt, msk);
+                                break;
+                        case XWMP_FLG_TRIGGER_CLR_ALL:
+                                triggered = xwmp_flg_t0ma_then_s1m(evt, msk);
+                                break;
+                        case XWMP_FLG_TRIGGER_CLR_ANY:
+                        default:
+                                triggered = xwmp_flg_t0mo_then_s1m(evt, msk);
+                                break;
+                        }
+                } else {
+                        switch (aw->flg.trigger) {
+                        case XWMP_FLG_TRIGGER_SET_ALL:
+                                triggered = xwbmpop_t1ma(evt->bmp, msk, evt->num);
+                                break;
+                        case XWMP_FLG_TRIGGER_SET_ANY:
+                                triggered = xwbmpop_t1mo(evt->bmp, msk, evt->num);
+                                break;
+                        case XWMP_FLG_TRIGGER_CLR_ALL:
+                                triggered = xwbmpop_t0ma(evt->bmp, msk, evt->num);
+                                break;
+                        case XWMP_FLG_TRIGGER_CLR_ANY:
+                        default:
+                                triggered = xwbmpop_t0mo(evt->bmp, msk, evt->num);
+                                break;
+                        }
+                }
+                if (triggered) {
+                        /* 电平触发：返回触发之前的位图状态 */
+                        xwbmpop_assign(origin, cur, evt->num);
+                }
+        } else {
+                xwbmpop_assign(cur, evt->bmp, evt->num);
+                xwbmpop_and(cur, msk, evt->num);
+                if ((xwsq_t)XWMP_FLG_TRIGGER_TGL_ALL == aw->flg.trigger) {
+                        xwbmpop_assign(tmp, cur, evt->num);
+                        xwbmpop_xor(tmp, origin, evt->num);
+                        cmprc = xwbmpop_cmp(tmp, msk, evt->num);
+                        triggered = (0 == cmprc);
+                } else {
+                        cmprc = xwbmpop_cmp(origin, cur, evt->num);
+                        triggered = (0 != cmprc);
+                }
+                if (triggered) {
+                        /* 边沿触发：返回触发后的位图状态，可作为下一次注册的初始值 */
+                        xwbmpop_assign(origin, cur, evt->num);
+                }
+        }
+        return triggered;
+}
+
+__xwmp_api
+xwer_t xwmp_flg_wait_async(struct xwmp_evt * evt,
+                           xwsq_t trigger, bool consumption,
+                           xwbmp_t origin[], xwbmp_t msk[],
+                           struct xwmp_aw * aw)
+{
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        rc = xwmp_aw_arm(aw, evt, (xwsq_t)XWMP_WQTYPE_EVENT);
+        if (rc < 0) {
+                goto err_aw_arm;
+        }
+        aw->flg.trigger = trigger;
+        aw->flg.consumption = consumption;
+        aw->flg.origin = origin;
+        aw->flg.msk = msk;
+        if (trigger > (xwsq_t)XWMP_FLG_TRIGGER_CLR_ANY) {
+                xwbmpop_and(origin, msk, evt->num);
+        }
+        xwaop_add(xwsq_t, &evt->waiters, 1, NULL, NULL);
+        xwmb_mp_mb();
+        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
+        if (xwmp_flg_aw_test_locked(evt, aw)) {
+                xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+                xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
+                xwmp_aw_fire(aw, XWOK);
+        } else {
+                xwmp_plwq_lock(&evt->awq);
+                xwmp_aw_eq_plwq_locked(aw, &evt->awq, (xwu16_t)XWMP_WQTYPE_EVENT,
+                                       xwmp_aw_wqn_cb);
+                xwmp_plwq_unlock(&evt->awq);
+                xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+        }
+
+err_aw_arm:
+        return rc;
+}
+
+/**
+ * @brief 中断事件标志的异步等待节点
+ * @param[in] evt: 事件对象的指针
+ * @param[in] aw: 异步等待节点的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ESRCH: 节点不在等待队列中
+ */
+__xwmp_code
+xwer_t xwmp_flg_aw_intr(struct xwmp_evt * evt, struct xwmp_aw * aw)
+{
+        struct xwmp_wqn * wqn;
+        xwmp_wqn_f cb;
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        wqn = &aw->wqn;
+        xwmp_plwq_lock_cpuirqsv(&evt->awq, &cpuirq);
+        xwmp_splk_lock(&wqn->lock);
+        rc = xwmp_plwq_remove_locked(&evt->awq, wqn);
+        if (XWOK == rc) {
+                wqn->wq = NULL;
+                wqn->type = (xwsq_t)XWMP_WQTYPE_UNKNOWN;
+                xwaop_store(xwsq_t, &wqn->reason,
+                            xwaop_mo_release, (xwsq_t)XWMP_WQN_REASON_INTR);
+                cb = wqn->cb;
+                wqn->cb = NULL;
+                xwmp_splk_unlock(&wqn->lock);
+                xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
+                xwmp_plwq_unlock_cpuirqrs(&evt->awq, cpuirq);
+                cb(wqn);
+        } else {
+                xwmp_splk_unlock(&wqn->lock);
+                xwmp_plwq_unlock_cpuirqrs(&evt->awq, cpuirq);
+        }
+        return rc;
+}
+#endif
+
 /******** type:XWMP_EVT_TYPE_SEL ********/
 /**
  * @brief 绑定同步对象到事件对象，事件对象类型为 `XWMP_EVT_TYPE_SEL`
@@ -1362,6 +1801,7 @@ xwer_t xwmp_sel_obj_s1i(struct xwmp_evt * evt, struct xwmp_synobj * synobj)
 {
         struct xwmp_evt * owner;
         xwreg_t cpuirq;
+        bool notify;
         xwer_t rc;
 
         xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
@@ -1371,8 +1811,11 @@ xwer_t xwmp_sel_obj_s1i(struct xwmp_evt * evt, struct xwmp_synobj * synobj)
                 goto err_notconn;
         }
         xwbmpop_s1i(evt->bmp, synobj->sel.pos);
+        notify = xwmp_evt_tst_notify(evt);
         xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        xwmp_cond_broadcast(&evt->cond); // cppcheck-suppress [misra-c2012-17.7]
+        if (notify) {
+                xwmp_cond_broadcast(&evt->cond); // cppcheck-suppress [misra-c2012-17.7]
+        }
         return XWOK;
 
 err_notconn:
@@ -1418,6 +1861,7 @@ xwer_t xwmp_sel_select(struct xwmp_evt * evt, xwbmp_t msk[], xwbmp_t trg[])
         bool triggered;
         xwsq_t lkst;
 
+        xwaop_add(xwsq_t, &evt->waiters, 1, NULL, NULL);
         xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         while (true) { // cppcheck-suppress [misra-c2012-15.4]
                 triggered = xwbmpop_t1mo(evt->bmp, msk, evt->num);
@@ -1457,6 +1901,7 @@ xwer_t xwmp_sel_select(struct xwmp_evt * evt, xwbmp_t msk[], xwbmp_t trg[])
                         }
                 }
         }
+        xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
         return rc;
 }
 
@@ -1469,6 +1914,7 @@ xwer_t xwmp_sel_select_to(struct xwmp_evt * evt, xwbmp_t msk[], xwbmp_t trg[],
         bool triggered;
         xwsq_t lkst;
 
+        xwaop_add(xwsq_t, &evt->waiters, 1, NULL, NULL);
         xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         while (true) { // cppcheck-suppress [misra-c2012-15.4]
                 triggered = xwbmpop_t1mo(evt->bmp, msk, evt->num);
@@ -1508,6 +1954,7 @@ xwer_t xwmp_sel_select_to(struct xwmp_evt * evt, xwbmp_t msk[], xwbmp_t trg[],
                         }
                 }
         }
+        xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
         return rc;
 }
 
@@ -1548,6 +1995,7 @@ xwer_t xwmp_sel_select_unintr(struct xwmp_evt * evt, xwbmp_t msk[], xwbmp_t trg[
         bool triggered;
         xwsq_t lkst;
 
+        xwaop_add(xwsq_t, &evt->waiters, 1, NULL, NULL);
         xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         while (true) { // cppcheck-suppress [misra-c2012-15.4]
                 triggered = xwbmpop_t1mo(evt->bmp, msk, evt->num);
@@ -1587,10 +2035,12 @@ xwer_t xwmp_sel_select_unintr(struct xwmp_evt * evt, xwbmp_t msk[], xwbmp_t trg[
                         }
                 }
         }
+        xwaop_sub(xwsq_t, &evt->waiters, 1, NULL, NULL);
         return rc;
 }
 
 /******** type:XWMP_EVT_TYPE_BR ********/
+#if !defined(XWOSCFG_SYNC_BR_TREE) || (0 == XWOSCFG_SYNC_BR_TREE)
 __xwmp_api
 xwer_t xwmp_br_wait(struct xwmp_evt * evt)
 {
@@ -1710,3 +2160,430 @@ err_pos_range:
         xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
         return rc;
 }
+
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+/**
+ * @brief 线程栅栏的异步等待节点的等待队列回调函数
+ * @param[in] wqn: 等待队列节点
+ * @details
+ * 与线程一样，被唤醒或被中断后释放自己在栅栏中占用的位置。
+ */
+static __xwmp_code
+void xwmp_br_aw_wqn_cb(struct xwmp_wqn * wqn)
+{
+        struct xwmp_aw * aw;
+        struct xwmp_evt * evt;
+        xwreg_t cpuirq;
+
+        aw = xwcc_derof(wqn, struct xwmp_aw, wqn);
+        evt = xwcc_derof(aw->obj, struct xwmp_evt, cond);
+        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
+        xwbmpop_c0i(evt->bmp, aw->pos);
+        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+        xwmp_aw_wqn_cb(wqn);
+}
+
+__xwmp_api
+xwer_t xwmp_br_wait_async(struct xwmp_evt * evt, struct xwmp_aw * aw)
+{
+        xwreg_t cpuirq;
+        xwssq_t pos;
+        bool triggered;
+        xwer_t rc;
+
+        xwmp_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
+        pos = xwbmpop_ffz(evt->bmp, evt->num);
+        if ((pos < 0) || (pos >= (xwssq_t)evt->num)) {
+                rc = -ECHRNG;
+                goto err_pos_range;
+        }
+        rc = xwmp_aw_arm(aw, &evt->cond, (xwsq_t)XWMP_WQTYPE_COND);
+        if (rc < 0) {
+                goto err_aw_arm;
+        }
+        xwbmpop_s1i(evt->bmp, (xwsq_t)pos);
+        triggered = xwbmpop_t1ma(evt->bmp, evt->msk, evt->num);
+        if (triggered) {
+                xwbmpop_c0i(evt->bmp, (xwsq_t)pos);
+                xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+                xwmp_cond_broadcast(&evt->cond); // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_aw_fire(aw, XWOK);
+        } else {
+                aw->pos = (xwsq_t)pos;
+                xwmp_plwq_lock(&evt->cond.wq.pl);
+                xwmp_aw_eq_plwq_locked(aw, &evt->cond.wq.pl, (xwu16_t)XWMP_WQTYPE_COND,
+                                       xwmp_br_aw_wqn_cb);
+                xwmp_plwq_unlock(&evt->cond.wq.pl);
+                xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+        }
+        return XWOK;
+
+err_aw_arm:
+err_pos_range:
+        xwmp_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+        return rc;
+}
+#endif
+
+#else
+
+/**
+ * @brief 激活线程栅栏的CPU子栅栏
+ * @param[in] evt: 事件对象的指针
+ */
+static __xwmp_code
+void xwmp_br_brn_activate(struct xwmp_evt * evt)
+{
+        struct xwmp_evt_brn * brn;
+        xwid_t i;
+
+        xwaop_store(xwsq_t, &evt->brcnt, xwaop_mo_relaxed, 0);
+        for (i = 0; i < (xwid_t)CPUCFG_CPU_NUM; i++) {
+                brn = &evt->brn[i];
+                xwmp_splk_init(&brn->lock);
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_cond_activate(&brn->cond[0], NULL);
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_cond_activate(&brn->cond[1], NULL);
+                xwaop_store(xwsq_t, &brn->wkgen, xwaop_mo_relaxed, 0);
+                brn->evt = evt;
+        }
+}
+
+/**
+ * @brief 注销线程栅栏的CPU子栅栏
+ * @param[in] evt: 事件对象的指针
+ */
+static __xwmp_code
+void xwmp_br_brn_deactivate(struct xwmp_evt * evt)
+{
+        xwid_t i;
+
+        if ((xwsq_t)XWMP_EVT_TYPE_BR == (evt->type & (xwsq_t)XWMP_EVT_TYPE_MASK)) {
+                for (i = 0; i < (xwid_t)CPUCFG_CPU_NUM; i++) {
+                        xwmp_cond_put(&evt->brn[i].cond[0]); // cppcheck-suppress [misra-c2012-17.7]
+                        xwmp_cond_put(&evt->brn[i].cond[1]); // cppcheck-suppress [misra-c2012-17.7]
+                }
+        }
+}
+
+/**
+ * @brief 获取CPU子栅栏中给定代数的到达者等待的条件量
+ * @param[in] brn: CPU子栅栏的指针
+ * @param[in] gen: 代数
+ */
+static __xwmp_code
+struct xwmp_cond * xwmp_br_brn_cond(struct xwmp_evt_brn * brn, xwsq_t gen)
+{
+        return &brn->cond[(gen / XWMP_BR_GEN_UNIT) & (xwsq_t)1];
+}
+
+/**
+ * @brief 读取线程栅栏当前的代数
+ * @param[in] evt: 事件对象的指针
+ */
+static __xwmp_code
+xwsq_t xwmp_br_gen(struct xwmp_evt * evt)
+{
+        xwsq_t cnt;
+
+        cnt = xwaop_load(xwsq_t, &evt->brcnt, xwaop_mo_acquire);
+        return cnt & ~XWMP_BR_CNT_MSK;
+}
+
+/**
+ * @brief 到达线程栅栏
+ * @param[in] evt: 事件对象的指针
+ * @param[out] gen: 指向缓冲区的指针，通过此缓冲区返回到达时的代数
+ * @return 布尔值
+ * @retval true: 最后一个到达者，栅栏已进入下一代
+ * @retval false: 还有到达者未到达
+ */
+static __xwmp_code
+bool xwmp_br_arrive(struct xwmp_evt * evt, xwsq_t * gen)
+{
+        xwsq_t ov;
+        xwsq_t nv;
+        bool last;
+        xwer_t rc;
+
+        do {
+                ov = xwaop_load(xwsq_t, &evt->brcnt, xwaop_mo_relaxed);
+                if (((ov & XWMP_BR_CNT_MSK) + (xwsq_t)1) >= (xwsq_t)evt->num) {
+                        nv = (ov & ~XWMP_BR_CNT_MSK) + XWMP_BR_GEN_UNIT;
+                        last = true;
+                } else {
+                        nv = ov + (xwsq_t)1;
+                        last = false;
+                }
+                rc = xwaop_teq_then_write(xwsq_t, &evt->brcnt, ov, nv, NULL);
+        } while (XWOK != rc);
+        *gen = ov & ~XWMP_BR_CNT_MSK;
+        return last;
+}
+
+/**
+ * @brief 取消到达线程栅栏
+ * @param[in] evt: 事件对象的指针
+ * @param[in] gen: 到达时的代数
+ * @return 布尔值
+ * @retval true: 已取消
+ * @retval false: 栅栏已进入下一代，到达者已随这一代被释放
+ */
+static __xwmp_code
+bool xwmp_br_leave(struct xwmp_evt * evt, xwsq_t gen)
+{
+        xwsq_t ov;
+        bool left;
+        xwer_t rc;
+
+        left = false;
+        do {
+                ov = xwaop_load(xwsq_t, &evt->brcnt, xwaop_mo_relaxed);
+                if ((ov & ~XWMP_BR_CNT_MSK) != gen) {
+                        break;
+                }
+                rc = xwaop_teq_then_write(xwsq_t, &evt->brcnt, ov, ov - (xwsq_t)1, NULL);
+                if (XWOK == rc) {
+                        left = true;
+                }
+        } while (!left);
+        return left;
+}
+
+/**
+ * @brief 广播CPU子栅栏，唤醒给定代数的所有到达者
+ * @param[in] brn: CPU子栅栏的指针
+ * @param[in] gen: 到达时的代数
+ * @details
+ * + `brn->wkgen` 只向前推进：每一代中，只有第一个把它推进到下一代的到达者广播，
+ *   滞后的到达者发现它已等于或超过下一代时，不再广播；
+ * + 因此每一代中，每个子栅栏最多被广播一次。
+ */
+static __xwmp_code
+void xwmp_br_brn_wake(struct xwmp_evt_brn * brn, xwsq_t gen)
+{
+        xwsq_t ngen;
+        xwsq_t ov;
+        bool wake;
+        xwer_t rc;
+
+        ngen = gen + XWMP_BR_GEN_UNIT;
+        wake = false;
+        do {
+                ov = xwaop_load(xwsq_t, &brn->wkgen, xwaop_mo_relaxed);
+                if ((xwssq_t)(ngen - ov) <= 0) {
+                        break;
+                }
+                rc = xwaop_teq_then_write(xwsq_t, &brn->wkgen, ov, ngen, NULL);
+                if (XWOK == rc) {
+                        wake = true;
+                }
+        } while (!wake);
+        if (wake) {
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_cond_broadcast(xwmp_br_brn_cond(brn, gen));
+        }
+}
+
+/**
+ * @brief 释放线程栅栏的一代到达者
+ * @param[in] evt: 事件对象的指针
+ * @param[in] cpuid: 最后一个到达者所在的CPU
+ * @param[in] gen: 被释放的代数
+ * @details
+ * + 先获取一次每个子栅栏的锁，确保已经增加计数的到达者都已加入等待队列；
+ * + 最后一个到达者所在的子栅栏直接广播，
+ *   其他子栅栏只单播唤醒一个到达者，由它在所在的CPU上广播剩余的到达者。
+ */
+static __xwmp_code
+void xwmp_br_release(struct xwmp_evt * evt, xwid_t cpuid, xwsq_t gen)
+{
+        struct xwmp_evt_brn * brn;
+        xwreg_t cpuirq;
+        xwid_t i;
+
+        for (i = 0; i < (xwid_t)CPUCFG_CPU_NUM; i++) {
+                brn = &evt->brn[i];
+                xwmp_splk_lock_cpuirqsv(&brn->lock, &cpuirq);
+                xwmp_splk_unlock_cpuirqrs(&brn->lock, cpuirq);
+                if (i == cpuid) {
+                        xwmp_br_brn_wake(brn, gen);
+                } else {
+                        // cppcheck-suppress [misra-c2012-17.7]
+                        xwmp_cond_unicast(xwmp_br_brn_cond(brn, gen));
+                }
+        }
+        /* 没有线程在 `evt->cond` 上等待，广播只用于通知绑定的信号选择器 */
+        xwmp_cond_broadcast(&evt->cond); // cppcheck-suppress [misra-c2012-17.7]
+}
+
+/**
+ * @brief 在本地CPU的子栅栏上等待所有线程到达栅栏
+ * @param[in] evt: 事件对象的指针
+ * @param[in] to: 期望唤醒的时间点
+ * @param[in] unintr: 是否不可中断
+ * @return 错误码
+ */
+static __xwmp_code
+xwer_t xwmp_br_brn_wait(struct xwmp_evt * evt, xwtm_t to, bool unintr)
+{
+        struct xwmp_evt_brn * brn;
+        struct xwmp_cond * cond;
+        xwreg_t cpuirq;
+        xwid_t cpuid;
+        xwsq_t gen;
+        xwsq_t lkst;
+        xwer_t rc;
+
+        xwmp_cpuirq_save_lc(&cpuirq);
+        cpuid = xwmp_skd_get_cpuid_lc();
+        brn = &evt->brn[cpuid];
+        xwmp_splk_lock(&brn->lock);
+        if (xwmp_br_arrive(evt, &gen)) {
+                xwmp_splk_unlock_cpuirqrs(&brn->lock, cpuirq);
+                xwmp_br_release(evt, cpuid, gen);
+                xwmp_cthd_yield();
+                rc = XWOK;
+        } else {
+                cond = xwmp_br_brn_cond(brn, gen);
+                rc = XWOK;
+                while (gen == xwmp_br_gen(evt)) {
+                        if (unintr) {
+                                rc = xwmp_cond_wait_unintr(cond,
+                                                           &brn->lock, XWOS_LK_SPLK, NULL,
+                                                           &lkst);
+                        } else {
+                                rc = xwmp_cond_wait_to(cond,
+                                                       &brn->lock, XWOS_LK_SPLK, NULL,
+                                                       to, &lkst);
+                        }
+                        if ((xwsq_t)XWOS_LKST_UNLOCKED == lkst) {
+                                xwmp_splk_lock(&brn->lock);
+                        }
+                        if (rc < 0) {
+                                break;
+                        }
+                }
+                xwmp_splk_unlock_cpuirqrs(&brn->lock, cpuirq);
+                if ((rc < 0) && (!xwmp_br_leave(evt, gen))) {
+                        /* 超时或被中断的同时，栅栏已被释放 */
+                        rc = XWOK;
+                }
+                if (XWOK == rc) {
+                        xwmp_br_brn_wake(brn, gen);
+                }
+        }
+        return rc;
+}
+
+__xwmp_api
+xwer_t xwmp_br_wait(struct xwmp_evt * evt)
+{
+        return xwmp_br_brn_wait(evt, XWTM_MAX, false);
+}
+
+__xwmp_api
+xwer_t xwmp_br_wait_to(struct xwmp_evt * evt, xwtm_t to)
+{
+        return xwmp_br_brn_wait(evt, to, false);
+}
+
+__xwmp_api
+xwer_t xwmp_br_wait_unintr(struct xwmp_evt * evt)
+{
+        return xwmp_br_brn_wait(evt, XWTM_MAX, true);
+}
+
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+/**
+ * @brief 线程栅栏的异步等待节点的等待队列回调函数
+ * @param[in] wqn: 等待队列节点
+ * @details
+ * + 被唤醒时，栅栏还未进入下一代，说明是伪唤醒，重新加入等待队列；
+ * + 被中断时，取消到达，若栅栏已经进入下一代，视为被唤醒。
+ */
+static __xwmp_code
+void xwmp_br_aw_wqn_cb(struct xwmp_wqn * wqn)
+{
+        struct xwmp_aw * aw;
+        struct xwmp_cond * cond;
+        struct xwmp_evt_brn * brn;
+        struct xwmp_evt * evt;
+        xwreg_t cpuirq;
+        xwsq_t reason;
+        xwsq_t gen;
+        xwer_t rc;
+
+        aw = xwcc_derof(wqn, struct xwmp_aw, wqn);
+        gen = aw->pos;
+        cond = aw->obj;
+        brn = xwcc_derof(cond, struct xwmp_evt_brn,
+                         cond[(gen / XWMP_BR_GEN_UNIT) & (xwsq_t)1]);
+        evt = brn->evt;
+        reason = xwaop_load(xwsq_t, &wqn->reason, xwaop_mo_acquire);
+        rc = XWOK;
+        if ((xwsq_t)XWMP_WQN_REASON_UP == reason) {
+                xwmp_splk_lock_cpuirqsv(&brn->lock, &cpuirq);
+                if (gen == xwmp_br_gen(evt)) {
+                        xwmp_plwq_lock(&cond->wq.pl);
+                        xwmp_aw_eq_plwq_locked(aw, &cond->wq.pl, (xwu16_t)XWMP_WQTYPE_COND,
+                                               xwmp_br_aw_wqn_cb);
+                        xwmp_plwq_unlock(&cond->wq.pl);
+                        rc = -EAGAIN;
+                }
+                xwmp_splk_unlock_cpuirqrs(&brn->lock, cpuirq);
+        } else if (xwmp_br_leave(evt, gen)) {
+                rc = -EINTR;
+        } else {
+                rc = XWOK;
+        }
+        if (-EAGAIN != rc) {
+                if (XWOK == rc) {
+                        xwmp_br_brn_wake(brn, gen);
+                }
+                xwmp_aw_fire(aw, rc);
+        }
+}
+
+__xwmp_api
+xwer_t xwmp_br_wait_async(struct xwmp_evt * evt, struct xwmp_aw * aw)
+{
+        struct xwmp_evt_brn * brn;
+        struct xwmp_cond * cond;
+        xwreg_t cpuirq;
+        xwid_t cpuid;
+        xwsq_t gen;
+        xwer_t rc;
+
+        xwmp_cpuirq_save_lc(&cpuirq);
+        cpuid = xwmp_skd_get_cpuid_lc();
+        brn = &evt->brn[cpuid];
+        xwmp_splk_lock(&brn->lock);
+        rc = xwmp_aw_arm(aw, &brn->cond[0], (xwsq_t)XWMP_WQTYPE_COND);
+        if (rc < 0) {
+                goto err_aw_arm;
+        }
+        if (xwmp_br_arrive(evt, &gen)) {
+                xwmp_splk_unlock_cpuirqrs(&brn->lock, cpuirq);
+                xwmp_br_release(evt, cpuid, gen);
+                xwmp_aw_fire(aw, XWOK);
+        } else {
+                cond = xwmp_br_brn_cond(brn, gen);
+                aw->pos = gen;
+                aw->obj = cond;
+                xwmp_plwq_lock(&cond->wq.pl);
+                xwmp_aw_eq_plwq_locked(aw, &cond->wq.pl, (xwu16_t)XWMP_WQTYPE_COND,
+                                       xwmp_br_aw_wqn_cb);
+                xwmp_plwq_unlock(&cond->wq.pl);
+                xwmp_splk_unlock_cpuirqrs(&brn->lock, cpuirq);
+        }
+        return XWOK;
+
+err_aw_arm:
+        xwmp_splk_unlock_cpuirqrs(&brn->lock, cpuirq);
+        return rc;
+}
+#endif
+
+#endif
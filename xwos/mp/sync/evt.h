@@ -26,6 +26,8 @@
 #include <xwos/mp/sync/obj.h>
 #include <xwos/mp/sync/cond.h>
 
+struct xwmp_aw;
+
 /**
  * @brief 事件类型枚举
  */
@@ -37,6 +39,30 @@ enum xwmp_evt_type_em {
         XWMP_EVT_TYPE_MASK = 0xFFU,
 };
 
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+/**
+ * @brief 线程栅栏计数器中到达者数量的掩码
+ */
+#define XWMP_BR_CNT_MSK                 ((xwsq_t)0xFFFFU)
+
+/**
+ * @brief 线程栅栏计数器中代数的单位
+ */
+#define XWMP_BR_GEN_UNIT                ((xwsq_t)0x10000U)
+
+struct xwmp_evt;
+
+/**
+ * @brief 线程栅栏的CPU子栅栏
+ */
+struct __xwcc_alignl1cache xwmp_evt_brn {
+        struct xwmp_splk lock; /**< 保护子栅栏等待队列的锁 */
+        struct xwmp_cond cond[2]; /**< 等待的条件量，按代数的奇偶交替使用 */
+        atomic_xwsq_t wkgen; /**< 最近一次广播子栅栏时的代数，只向前推进 */
+        struct xwmp_evt * evt; /**< 所属的线程栅栏 */
+};
+#endif
+
 /**
  * @brief 事件对象
  */
@@ -47,6 +73,14 @@ struct xwmp_evt {
         struct xwmp_splk lock; /**< 保护位图的锁 */
         xwbmp_t * bmp; /**< 事件位图 */
         xwbmp_t * msk; /**< 掩码位图 */
+        atomic_xwsq_t waiters; /**< 正在等待的线程与异步等待节点的数量 */
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+        struct xwmp_plwq awq; /**< 异步等待事件标志的节点的等待队列 */
+#endif
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+        atomic_xwsq_t brcnt; /**< 线程栅栏的计数器：高位为代数，低16位为到达者数量 */
+        struct xwmp_evt_brn brn[CPUCFG_CPU_NUM]; /**< 线程栅栏的CPU子栅栏 */
+#endif
 };
 
 #if defined(XWOSCFG_SYNC_EVT_MEMPOOL) && (1 == XWOSCFG_SYNC_EVT_MEMPOOL)
@@ -108,6 +142,13 @@ xwer_t xwmp_flg_trywait(struct xwmp_evt * evt,
 xwer_t xwmp_flg_wait_unintr(struct xwmp_evt * evt,
                             xwsq_t trigger, bool consumption,
                             xwbmp_t origin[], xwbmp_t msk[]);
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+xwer_t xwmp_flg_wait_async(struct xwmp_evt * evt,
+                           xwsq_t trigger, bool consumption,
+                           xwbmp_t origin[], xwbmp_t msk[],
+                           struct xwmp_aw * aw);
+xwer_t xwmp_flg_aw_intr(struct xwmp_evt * evt, struct xwmp_aw * aw);
+#endif
 
 /******** type:XWMP_EVT_TYPE_SEL ********/
 xwer_t xwmp_sel_obj_bind(struct xwmp_evt * evt,
@@ -131,5 +172,8 @@ xwer_t xwmp_sel_select_unintr(struct xwmp_evt * evt, xwbmp_t msk[], xwbmp_t trg[
 xwer_t xwmp_br_wait(struct xwmp_evt * evt);
 xwer_t xwmp_br_wait_to(struct xwmp_evt * evt, xwtm_t to);
 xwer_t xwmp_br_wait_unintr(struct xwmp_evt * evt);
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+xwer_t xwmp_br_wait_async(struct xwmp_evt * evt, struct xwmp_aw * aw);
+#endif
 
 #endif /* xwos/mp/sync/evt.h */
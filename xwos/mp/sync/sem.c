@@ -14,6 +14,7 @@
  *     + ② 等待队列节点的锁（wqn->lock）
  *     + ② 线程控制块的状态锁（thd->stlock）
  *     + ② 事件对象的锁（evt->lock）
+ * - 计数器在不经过0时，由快速路径通过原子操作修改，不需要获得等待队列的锁
  */
 
 #include <xwos/standard.h>
@@ -43,6 +44,9 @@
 #endif
 #include <xwos/mp/sync/obj.h>
 #include <xwos/mp/sync/sem.h>
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+#  include <xwos/mp/sync/aw.h>
+#endif
 
 /* #define XWOS_SEMLOGF */ /**< 调试日志开关 */
 #ifdef XWOS_SEMLOGF
@@ -443,7 +447,8 @@ xwer_t xwmp_sem_bind(struct xwmp_sem * sem, struct xwmp_evt * evt, xwsq_t pos)
         case XWMP_SEM_TYPE_PIPELINE:
                 xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
                 rc = xwmp_sel_obj_bind(evt, &sem->synobj, pos, true);
-                if ((XWOK == rc) && (sem->count > (xwssq_t)0)) {
+                if ((XWOK == rc) &&
+                    (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) > (xwssq_t)0)) {
                         rc = xwmp_sel_obj_s1i(evt, &sem->synobj);
                 }
                 xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
@@ -453,7 +458,8 @@ xwer_t xwmp_sem_bind(struct xwmp_sem * sem, struct xwmp_evt * evt, xwsq_t pos)
         case XWMP_SEM_TYPE_RT:
                 xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
                 rc = xwmp_sel_obj_bind(evt, &sem->synobj, pos, true);
-                if ((XWOK == rc) && (sem->count > (xwssq_t)0)) {
+                if ((XWOK == rc) &&
+                    (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) > (xwssq_t)0)) {
                         rc = xwmp_sel_obj_s1i(evt, &sem->synobj);
                 }
                 xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
@@ -510,6 +516,43 @@ xwer_t xwmp_sem_unbind(struct xwmp_sem * sem, struct xwmp_evt * evt)
 }
 #endif
 
+/**
+ * @brief 信号量的快速路径：不获取等待队列的锁增加计数器
+ * @param[in] sem: 信号量对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EACCES: 需要进入慢速路径
+ * @details
+ * + 计数器大于0时，等待队列一定为空，且绑定的信号选择器的位已经被置1，
+ *   因此计数器在区间 `(0, max)` 内时，只需要一次原子操作就可以增加计数器；
+ * + 计数器经过0的转换（唤醒等待的线程、修改信号选择器的位）与冻结，
+ *   只能在慢速路径中持有等待队列的锁时进行。持有锁时，
+ *   快速路径既不会使计数器从0变为正数，也不会使计数器从正数变为0，
+ *   因此慢速路径对计数器符号的判断在锁内是稳定的。
+ */
+static __xwmp_inline
+xwer_t xwmp_sem_fast_post(struct xwmp_sem * sem)
+{
+        return xwaop_tgtlt_then_add(xwssq_t, &sem->count, 0, sem->max, 1,
+                                    NULL, NULL);
+}
+
+/**
+ * @brief 信号量的快速路径：不获取等待队列的锁减少计数器
+ * @param[in] sem: 信号量对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EACCES: 需要进入慢速路径
+ * @details
+ * 只有计数器大于1时才可以走快速路径，计数器从1变为0时需要清除信号选择器的位，
+ * 必须进入慢速路径。
+ */
+static __xwmp_inline
+xwer_t xwmp_sem_fast_trywait(struct xwmp_sem * sem)
+{
+        return xwaop_tgt_then_sub(xwssq_t, &sem->count, 1, 1, NULL, NULL);
+}
+
 #if defined(XWOSCFG_SYNC_PLSEM) && (1 == XWOSCFG_SYNC_PLSEM)
 /**
  * @brief 激活并初始化管道信号量对象
@@ -531,7 +574,7 @@ xwer_t xwmp_plsem_activate(struct xwmp_sem * sem, xwssq_t val, xwssq_t max,
         sem->max = max;
         xwmp_plwq_init(&sem->wq.pl);
         sem->type = (xwsq_t)XWMP_SEM_TYPE_PIPELINE;
-        sem->count = val;
+        xwaop_store(xwssq_t, &sem->count, xwaop_mo_relaxed, val);
         return XWOK;
 
 err_synobj_activate:
@@ -561,10 +604,11 @@ xwer_t xwmp_plsem_freeze(struct xwmp_sem * sem)
 
         rc = XWOK;
         xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
-        if (sem->count < (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) < (xwssq_t)0) {
                 rc = -EALREADY;
         } else {
-                sem->count = (xwssq_t)XWMP_SEM_NEGTIVE;
+                xwaop_store(xwssq_t, &sem->count, xwaop_mo_relaxed,
+                            (xwssq_t)XWMP_SEM_NEGTIVE);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
                 struct xwmp_evt * evt;
                 struct xwmp_synobj * synobj;
@@ -589,11 +633,11 @@ xwer_t xwmp_plsem_thaw(struct xwmp_sem * sem)
 
         rc = XWOK;
         xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
-        if (sem->count >= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) >= (xwssq_t)0) {
                 rc = -EALREADY;
         } else {
                 sem->type = (xwsq_t)XWMP_SEM_TYPE_PIPELINE;
-                sem->count = (xwssq_t)0;
+                xwaop_store(xwssq_t, &sem->count, xwaop_mo_relaxed, (xwssq_t)0);
         }
         xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
         return rc;
@@ -637,10 +681,16 @@ xwer_t xwmp_plsem_post(struct xwmp_sem * sem)
         struct xwmp_wqn * wqn;
         xwmp_wqn_f cb;
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwmp_sem_fast_post(sem);
+        if (XWOK == rc) {
+                goto fast_posted;
+        }
+
         xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
-        if (sem->count < (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) < (xwssq_t)0) {
                 xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
                 rc = -ENEGATIVE;
         } else {
@@ -657,14 +707,13 @@ xwer_t xwmp_plsem_post(struct xwmp_sem * sem)
                         cb(wqn);
                         rc = XWOK;
                 } else {
-                        if (sem->count < sem->max) {
-                                sem->count++;
-                                rc = XWOK;
-                        } else {
+                        rc = xwaop_tlt_then_add(xwssq_t, &sem->count,
+                                                sem->max, 1, &nv, NULL);
+                        if (rc < 0) {
                                 rc = -ERANGE;
                         }
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                        if (sem->count > (xwssq_t)0) {
+                        if (nv > (xwssq_t)0) {
                                 struct xwmp_evt * evt;
                                 struct xwmp_synobj * synobj;
 
@@ -681,6 +730,8 @@ xwer_t xwmp_plsem_post(struct xwmp_sem * sem)
                         xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
                 }
         }
+
+fast_posted:
         return rc;
 }
 
@@ -838,10 +889,16 @@ xwer_t xwmp_plsem_acquire_or_block_to(struct xwmp_sem * sem, struct xwmp_skd * x
                                       struct xwmp_thd * thd, xwtm_t to)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
-        if (sem->count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) <= (xwssq_t)0) {
                 rc = xwmp_skd_wakelock_lock(xwskd);
                 if (rc < 0) {
                         /* 当前调度器正准备休眠，线程需被冻结，返回 `-EINTR` 。*/
@@ -853,9 +910,9 @@ xwer_t xwmp_plsem_acquire_or_block_to(struct xwmp_sem * sem, struct xwmp_skd * x
                         xwmp_skd_wakelock_unlock(xwskd);
                 }
         } else {
-                sem->count--;
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwmp_evt * evt;
                         struct xwmp_synobj * synobj;
 
@@ -870,6 +927,8 @@ xwer_t xwmp_plsem_acquire_or_block_to(struct xwmp_sem * sem, struct xwmp_skd * x
                 xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
                 rc = XWOK;
         }
+
+fast_acquired:
         return rc;
 }
 
@@ -1003,15 +1062,21 @@ xwer_t xwmp_plsem_acquire_or_block_unintr(struct xwmp_sem * sem,
                                           struct xwmp_skd * xwskd)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
-        if (sem->count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) <= (xwssq_t)0) {
                 rc = xwmp_plsem_block_unintr(sem, thd, xwskd, cpuirq);
         } else {
-                sem->count--;
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwmp_evt * evt;
                         struct xwmp_synobj * synobj;
 
@@ -1026,6 +1091,8 @@ xwer_t xwmp_plsem_acquire_or_block_unintr(struct xwmp_sem * sem,
                 xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
                 rc = XWOK;
         }
+
+fast_acquired:
         return rc;
 }
 
@@ -1057,15 +1124,21 @@ xwer_t xwmp_plsem_wait_unintr(struct xwmp_sem * sem)
 __xwmp_api
 xwer_t xwmp_plsem_trywait(struct xwmp_sem * sem)
 {
+        xwssq_t nv;
         xwer_t rc;
         xwreg_t cpuirq;
 
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         rc = XWOK;
         xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
-        if (sem->count > (xwssq_t)0) {
-                sem->count--;
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) > (xwssq_t)0) {
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwmp_evt * evt;
                         struct xwmp_synobj * synobj;
 
@@ -1081,8 +1154,60 @@ xwer_t xwmp_plsem_trywait(struct xwmp_sem * sem)
                 rc = -ENODATA;
         }
         xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
+
+fast_acquired:
+        return rc;
+}
+
+#  if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+__xwmp_api
+xwer_t xwmp_plsem_wait_async(struct xwmp_sem * sem, struct xwmp_aw * aw)
+{
+        xwssq_t nv;
+        xwer_t rc;
+        xwreg_t cpuirq;
+
+        rc = xwmp_aw_arm(aw, sem, (xwsq_t)XWMP_WQTYPE_PLSEM);
+        if (rc < 0) {
+                goto err_aw_arm;
+        }
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                xwmp_aw_fire(aw, XWOK);
+                goto fast_acquired;
+        }
+
+        rc = XWOK;
+        xwmp_plwq_lock_cpuirqsv(&sem->wq.pl, &cpuirq);
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) > (xwssq_t)0) {
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
+#    if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+                if ((xwssq_t)0 == nv) {
+                        struct xwmp_evt * evt;
+                        struct xwmp_synobj * synobj;
+
+                        synobj = &sem->synobj;
+                        xwmb_mp_load_acquire(struct xwmp_evt *, evt, &synobj->sel.evt);
+                        if (NULL != evt) {
+                                // cppcheck-suppress [misra-c2012-17.7]
+                                xwmp_sel_obj_c0i(evt, synobj);
+                        }
+                }
+#    endif
+                xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
+                xwmp_aw_fire(aw, XWOK);
+        } else {
+                /* 发布者将信号量直接交给等待队列中的节点，计数器不会增加 */
+                xwmp_aw_eq_plwq_locked(aw, &sem->wq.pl, (xwu16_t)XWMP_WQTYPE_PLSEM,
+                                       xwmp_aw_wqn_cb);
+                xwmp_plwq_unlock_cpuirqrs(&sem->wq.pl, cpuirq);
+        }
+
+fast_acquired:
+err_aw_arm:
         return rc;
 }
+#  endif
 #endif
 
 #if defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)
@@ -1106,7 +1231,7 @@ xwer_t xwmp_rtsem_activate(struct xwmp_sem * sem, xwssq_t val, xwssq_t max,
         sem->max = max;
         xwmp_rtwq_init(&sem->wq.rt);
         sem->type = (xwsq_t)XWMP_SEM_TYPE_RT;
-        sem->count = val;
+        xwaop_store(xwssq_t, &sem->count, xwaop_mo_relaxed, val);
         return XWOK;
 
 err_synobj_activate:
@@ -1136,10 +1261,11 @@ xwer_t xwmp_rtsem_freeze(struct xwmp_sem * sem)
 
         rc = XWOK;
         xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
-        if (sem->count < (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) < (xwssq_t)0) {
                 rc = -EALREADY;
         } else {
-                sem->count = (xwssq_t)XWMP_SEM_NEGTIVE;
+                xwaop_store(xwssq_t, &sem->count, xwaop_mo_relaxed,
+                            (xwssq_t)XWMP_SEM_NEGTIVE);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
                 struct xwmp_evt * evt;
                 struct xwmp_synobj * synobj;
@@ -1165,11 +1291,11 @@ xwer_t xwmp_rtsem_thaw(struct xwmp_sem * sem)
 
         rc = XWOK;
         xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
-        if (sem->count >= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) >= (xwssq_t)0) {
                 rc = -EALREADY;
         } else {
                 sem->type = (xwsq_t)XWMP_SEM_TYPE_RT;
-                sem->count = (xwssq_t)0;
+                xwaop_store(xwssq_t, &sem->count, xwaop_mo_relaxed, (xwssq_t)0);
         }
         xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
         return rc;
@@ -1213,10 +1339,16 @@ xwer_t xwmp_rtsem_post(struct xwmp_sem * sem)
         struct xwmp_wqn * wqn;
         xwreg_t cpuirq;
         xwmp_wqn_f cb;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwmp_sem_fast_post(sem);
+        if (XWOK == rc) {
+                goto fast_posted;
+        }
+
         xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
-        if (sem->count < (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) < (xwssq_t)0) {
                 xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
                 rc = -ENEGATIVE;
         } else {
@@ -1233,14 +1365,13 @@ xwer_t xwmp_rtsem_post(struct xwmp_sem * sem)
                         cb(wqn);
                         rc = XWOK;
                 } else {
-                        if (sem->count < sem->max) {
-                                sem->count++;
-                                rc = XWOK;
-                        } else {
+                        rc = xwaop_tlt_then_add(xwssq_t, &sem->count,
+                                                sem->max, 1, &nv, NULL);
+                        if (rc < 0) {
                                 rc = -ERANGE;
                         }
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                        if (sem->count > (xwssq_t)0) {
+                        if (nv > (xwssq_t)0) {
                                 struct xwmp_evt * evt;
                                 struct xwmp_synobj * synobj;
 
@@ -1257,6 +1388,8 @@ xwer_t xwmp_rtsem_post(struct xwmp_sem * sem)
                         xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
                 }
         }
+
+fast_posted:
         return rc;
 }
 
@@ -1412,10 +1545,16 @@ xwer_t xwmp_rtsem_acquire_or_block_to(struct xwmp_sem * sem, struct xwmp_skd * x
                                       struct xwmp_thd * thd, xwtm_t to)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
-        if (sem->count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) <= (xwssq_t)0) {
                 rc = xwmp_skd_wakelock_lock(xwskd);
                 if (rc < 0) {
                         /* 当前调度器正准备休眠，线程需被冻结，返回-EINTR。*/
@@ -1427,9 +1566,9 @@ xwer_t xwmp_rtsem_acquire_or_block_to(struct xwmp_sem * sem, struct xwmp_skd * x
                         xwmp_skd_wakelock_unlock(xwskd);
                 }
         } else {
-                sem->count--;
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwmp_evt * evt;
                         struct xwmp_synobj * synobj;
 
@@ -1445,6 +1584,7 @@ xwer_t xwmp_rtsem_acquire_or_block_to(struct xwmp_sem * sem, struct xwmp_skd * x
                 rc = XWOK;
         }
 
+fast_acquired:
         return rc;
 }
 
@@ -1578,15 +1718,21 @@ xwer_t xwmp_rtsem_acquire_or_block_unintr(struct xwmp_sem * sem,
                                           struct xwmp_skd * xwskd)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
-        if (sem->count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) <= (xwssq_t)0) {
                 rc = xwmp_rtsem_block_unintr(sem, thd, xwskd, cpuirq);
         } else {
-                sem->count--;
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwmp_evt * evt;
                         struct xwmp_synobj * synobj;
 
@@ -1601,6 +1747,8 @@ xwer_t xwmp_rtsem_acquire_or_block_unintr(struct xwmp_sem * sem,
                 xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
                 rc = XWOK;
         }
+
+fast_acquired:
         return rc;
 }
 
@@ -1631,15 +1779,21 @@ xwer_t xwmp_rtsem_wait_unintr(struct xwmp_sem * sem)
 __xwmp_api
 xwer_t xwmp_rtsem_trywait(struct xwmp_sem * sem)
 {
+        xwssq_t nv;
         xwer_t rc;
         xwreg_t cpuirq;
 
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         rc = XWOK;
         xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
-        if (sem->count > (xwssq_t)0) {
-                sem->count--;
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) > (xwssq_t)0) {
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
 #  if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwmp_evt * evt;
                         struct xwmp_synobj * synobj;
 
@@ -1655,8 +1809,59 @@ xwer_t xwmp_rtsem_trywait(struct xwmp_sem * sem)
                 rc = -ENODATA;
         }
         xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
+
+fast_acquired:
+        return rc;
+}
+
+#  if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+__xwmp_api
+xwer_t xwmp_rtsem_wait_async(struct xwmp_sem * sem, struct xwmp_aw * aw)
+{
+        xwssq_t nv;
+        xwer_t rc;
+        xwreg_t cpuirq;
+
+        rc = xwmp_aw_arm(aw, sem, (xwsq_t)XWMP_WQTYPE_RTSEM);
+        if (rc < 0) {
+                goto err_aw_arm;
+        }
+        rc = xwmp_sem_fast_trywait(sem);
+        if (XWOK == rc) {
+                xwmp_aw_fire(aw, XWOK);
+                goto fast_acquired;
+        }
+
+        rc = XWOK;
+        xwmp_rtwq_lock_cpuirqsv(&sem->wq.rt, &cpuirq);
+        if (xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed) > (xwssq_t)0) {
+                xwaop_sub(xwssq_t, &sem->count, 1, &nv, NULL);
+#    if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+                if ((xwssq_t)0 == nv) {
+                        struct xwmp_evt * evt;
+                        struct xwmp_synobj * synobj;
+
+                        synobj = &sem->synobj;
+                        xwmb_mp_load_acquire(struct xwmp_evt *, evt, &synobj->sel.evt);
+                        if (NULL != evt) {
+                                // cppcheck-suppress [misra-c2012-17.7]
+                                xwmp_sel_obj_c0i(evt, synobj);
+                        }
+                }
+#    endif
+                xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
+                xwmp_aw_fire(aw, XWOK);
+        } else {
+                /* 发布者将信号量直接交给等待队列中的节点，计数器不会增加 */
+                xwmp_aw_eq_rtwq_locked(aw, &sem->wq.rt, (xwu16_t)XWMP_WQTYPE_RTSEM);
+                xwmp_rtwq_unlock_cpuirqrs(&sem->wq.rt, cpuirq);
+        }
+
+fast_acquired:
+err_aw_arm:
         return rc;
 }
+#  endif
 #endif
 
 __xwmp_api
@@ -1669,7 +1874,7 @@ xwer_t xwmp_sem_get_max(struct xwmp_sem * sem, xwssq_t * max)
 __xwmp_api
 xwer_t xwmp_sem_get_value(struct xwmp_sem * sem, xwssq_t * val)
 {
-        *val = sem->count;
+        *val = xwaop_load(xwssq_t, &sem->count, xwaop_mo_relaxed);
         return XWOK;
 }
 
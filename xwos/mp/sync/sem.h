@@ -35,6 +35,7 @@
 #endif
 
 struct xwmp_evt;
+struct xwmp_aw;
 
 /**
  * @brief 信号量类型枚举
@@ -57,7 +58,7 @@ enum xwmp_sem_type_em {
 struct xwmp_sem {
         struct xwmp_synobj synobj; /**< C语言面向对象：继承 `struct xwmp_synobj` */
         xwsq_t type; /**< 类型 */
-        xwssq_t count; /**< 信号量计数器：<0，信号量处于负状态 */
+        atomic_xwssq_t count; /**< 信号量计数器：<0，信号量处于负状态 */
         xwssq_t max; /**< 信号量计数器的最大值 */
         union {
 #if defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)
@@ -110,6 +111,9 @@ xwer_t xwmp_plsem_wait(struct xwmp_sem * sem);
 xwer_t xwmp_plsem_wait_to(struct xwmp_sem * sem, xwtm_t xwtm);
 xwer_t xwmp_plsem_wait_unintr(struct xwmp_sem * sem);
 xwer_t xwmp_plsem_trywait(struct xwmp_sem * sem);
+#  if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+xwer_t xwmp_plsem_wait_async(struct xwmp_sem * sem, struct xwmp_aw * aw);
+#  endif
 #endif
 
 #if defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)
@@ -122,6 +126,9 @@ xwer_t xwmp_rtsem_wait(struct xwmp_sem * sem);
 xwer_t xwmp_rtsem_wait_to(struct xwmp_sem * sem, xwtm_t xwtm);
 xwer_t xwmp_rtsem_wait_unintr(struct xwmp_sem * sem);
 xwer_t xwmp_rtsem_trywait(struct xwmp_sem * sem);
+#  if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+xwer_t xwmp_rtsem_wait_async(struct xwmp_sem * sem, struct xwmp_aw * aw);
+#  endif
 #endif
 
 xwer_t xwmp_sem_get_max(struct xwmp_sem * sem, xwssq_t * max);
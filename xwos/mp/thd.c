@@ -82,6 +82,19 @@ const __xwmp_rodata char xwmp_thd_cache_name[] = "xwmp.thd.cache";
 static __xwmp_data struct xwmm_sma * xwmp_thd_cache;
 #endif
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+/**
+ * @brief 线程池链表，按线程栈的大小从小到大排列
+ */
+static __xwmp_data
+struct xwlib_bclst_head xwmp_thd_pool_list = XWLIB_BCLST_HEAD_INIT(xwmp_thd_pool_list);
+
+/**
+ * @brief 保护线程池链表的自旋锁
+ */
+static __xwmp_data struct xwmp_splk xwmp_thd_pool_lock = XWMP_SPLK_INITIALIZER;
+#endif
+
 #if defined(BRDCFG_XWSKD_THD_STACK_POOL) && (1 == BRDCFG_XWSKD_THD_STACK_POOL)
 extern
 xwer_t board_thd_stack_pool_alloc(xwsz_t stack_size, xwstk_t ** membuf);
@@ -118,6 +131,11 @@ void xwmp_thd_destruct(struct xwmp_thd * thd);
 static __xwmp_code
 xwer_t xwmp_thd_sgc(struct xwos_object * obj);
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+static __xwmp_code
+xwer_t xwmp_thd_pool_gc(struct xwos_object * obj);
+#endif
+
 #if (1 == XWOSRULE_SKD_THD_CREATE)
 static __xwmp_code
 xwer_t xwmp_thd_dgc(struct xwos_object * obj);
@@ -652,6 +670,15 @@ xwer_t xwmp_thd_create(struct xwmp_thd ** thdpbuf,
         bool allocated_stack;
         xwer_t rc;
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+        /* 未指定线程栈时，优先从线程池中获取线程对象与线程栈 */
+        if ((NULL == inattr) || (NULL == inattr->stack)) {
+                rc = xwmp_thd_pool_create(thdpbuf, inattr, thdfunc, arg);
+                if (-ENOMEM != rc) {
+                        goto thd_pool;
+                }
+        }
+#endif
         if (NULL != inattr) {
                 attr = *inattr;
                 if ((xwsz_t)0 == attr.stack_size) {
@@ -721,10 +748,218 @@ err_thd_alloc:
         }
 err_stack_alloc:
         *thdpbuf = NULL;
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+thd_pool:
+#endif
         return rc;
 }
 #endif
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+__xwmp_api
+xwer_t xwmp_thd_pool_init(struct xwmp_thd_pool * pool, const char * name,
+                          struct xwmp_thd * thds, xwstk_t * stacks,
+                          xwsz_t stack_size, xwsz_t num)
+{
+        struct xwmp_thd_pool * itr;
+        struct xwlib_bclst_node * pos;
+        xwstk_t * stk;
+        xwsz_t stknum;
+        xwsz_t i;
+        xwreg_t cpuirq;
+
+        xwlib_bclst_init_node(&pool->node);
+        pool->name = name;
+        pool->stack_size = stack_size;
+        pool->num = num;
+        pool->thds = thds;
+        pool->stacks = stacks;
+        xwlib_lfq_init(&pool->free_list);
+        stknum = stack_size / sizeof(xwstk_t);
+        for (i = num; i > (xwsz_t)0; i--) {
+                stk = &stacks[(i - (xwsz_t)1) * stknum];
+                xwlib_lfq_init((atomic_xwlfq_t *)stk);
+                xwlib_lfq_push(&pool->free_list, (atomic_xwlfq_t *)stk);
+        }
+        xwaop_write(xwsz_t, &pool->num_free, num, NULL);
+
+        /* 按线程栈的大小从小到大插入线程池链表 */
+        xwmp_splk_lock_cpuirqsv(&xwmp_thd_pool_lock, &cpuirq);
+        pos = &xwmp_thd_pool_list;
+        xwlib_bclst_itr_next_entry(itr, &xwmp_thd_pool_list,
+                                   struct xwmp_thd_pool, node) {
+                if (itr->stack_size > stack_size) {
+                        pos = &itr->node;
+                        break;
+                }
+        }
+        xwlib_bclst_add_tail(pos, &pool->node);
+        xwmp_splk_unlock_cpuirqrs(&xwmp_thd_pool_lock, cpuirq);
+        return XWOK;
+}
+
+/**
+ * @brief 从线程池中取出一个线程栈
+ * @param[in] stack_size: 线程栈的大小
+ * @param[out] poolbuf: 指向缓冲区的指针，通过此缓冲区返回线程池的指针
+ * @return 线程栈的首地址或指针类型的错误码
+ * @retval -ENOMEM: 没有能满足大小要求的空闲线程
+ * @note
+ * + 只从满足大小要求的最小的线程池中获取，不会退而求其次，
+ *   因此执行时间只与线程池的数量有关。
+ */
+static __xwmp_code
+xwstk_t * xwmp_thd_pool_get(xwsz_t stack_size, struct xwmp_thd_pool ** poolbuf)
+{
+        struct xwmp_thd_pool * pool;
+        struct xwmp_thd_pool * itr;
+        xwstk_t * stk;
+        xwreg_t cpuirq;
+
+        pool = NULL;
+        xwmp_splk_lock_cpuirqsv(&xwmp_thd_pool_lock, &cpuirq);
+        xwlib_bclst_itr_next_entry(itr, &xwmp_thd_pool_list,
+                                   struct xwmp_thd_pool, node) {
+                if (itr->stack_size >= stack_size) {
+                        pool = itr;
+                        break;
+                }
+        }
+        xwmp_splk_unlock_cpuirqrs(&xwmp_thd_pool_lock, cpuirq);
+        if (NULL == pool) {
+                stk = err_ptr(-ENOMEM);
+        } else {
+                stk = (xwstk_t *)xwlib_lfq_pop(&pool->free_list);
+                if (NULL == stk) {
+                        stk = err_ptr(-ENOMEM);
+                } else {
+                        xwaop_sub(xwsz_t, &pool->num_free, 1, NULL, NULL);
+                        *poolbuf = pool;
+                }
+        }
+        return stk;
+}
+
+/**
+ * @brief 将线程栈归还到线程池中
+ * @param[in] pool: 线程池的指针
+ * @param[in] stk: 线程栈的首地址
+ */
+static __xwmp_code
+void xwmp_thd_pool_put(struct xwmp_thd_pool * pool, xwstk_t * stk)
+{
+        xwlib_lfq_init((atomic_xwlfq_t *)stk);
+        xwlib_lfq_push(&pool->free_list, (atomic_xwlfq_t *)stk);
+        xwaop_add(xwsz_t, &pool->num_free, 1, NULL, NULL);
+}
+
+/**
+ * @brief 线程池中的线程对象的垃圾回收函数
+ * @param[in] obj: 线程对象的基类指针
+ * @note
+ * + 线程对象与线程栈不会被释放，而是回收到线程池中。
+ */
+static __xwmp_code
+xwer_t xwmp_thd_pool_gc(struct xwos_object * obj)
+{
+        struct xwmp_thd * thd;
+        struct xwmp_thd_pool * pool;
+        xwsz_t idx;
+        struct xwmp_thd_pool * itr;
+        xwreg_t cpuirq;
+
+        thd = xwcc_derof(obj, struct xwmp_thd, xwobj);
+        pool = NULL;
+        xwmp_splk_lock_cpuirqsv(&xwmp_thd_pool_lock, &cpuirq);
+        xwlib_bclst_itr_next_entry(itr, &xwmp_thd_pool_list,
+                                   struct xwmp_thd_pool, node) {
+                if ((thd >= itr->thds) && (thd < &itr->thds[itr->num])) {
+                        pool = itr;
+                        break;
+                }
+        }
+        xwmp_splk_unlock_cpuirqrs(&xwmp_thd_pool_lock, cpuirq);
+        XWOS_BUG_ON(NULL == pool);
+        idx = (xwsz_t)(thd - pool->thds);
+        xwmp_thd_destruct(thd);
+        xwmp_thd_pool_put(pool,
+                          &pool->stacks[idx * (pool->stack_size / sizeof(xwstk_t))]);
+        return XWOK;
+}
+
+__xwmp_api
+xwer_t xwmp_thd_pool_create(struct xwmp_thd ** thdpbuf,
+                            const struct xwmp_thd_attr * inattr,
+                            xwmp_thd_f thdfunc, void * arg)
+{
+        struct xwmp_thd_pool * pool;
+        struct xwmp_thd * thd;
+        struct xwmp_thd_attr attr;
+        xwstk_t * stk;
+        xwsz_t idx;
+        xwer_t rc;
+
+        if (NULL != inattr) {
+                attr = *inattr;
+                if ((xwsz_t)0 == attr.stack_size) {
+                        attr.stack_size = XWMMCFG_STACK_SIZE_DEFAULT;
+                } else if (attr.stack_size < XWMMCFG_STACK_SIZE_MIN) {
+                        attr.stack_size = XWMMCFG_STACK_SIZE_MIN;
+                } else {
+                        attr.stack_size &= XWMM_STACK_ALIGNMENT_MASK;
+                }
+                if ((xwsz_t)0 == attr.stack_guard_size) {
+                        attr.stack_guard_size = XWMMCFG_STACK_GUARD_SIZE_DEFAULT;
+                }
+        } else {
+                attr.name = NULL;
+                attr.stack_size = XWMMCFG_STACK_SIZE_DEFAULT;
+                attr.stack_guard_size = XWMMCFG_STACK_GUARD_SIZE_DEFAULT;
+                attr.priority = XWMP_SKD_PRIORITY_RT_MIN;
+                attr.detached = false;
+                attr.privileged = XWOSCFG_SKD_THD_PRIVILEGED_DEFAULT;
+        }
+
+        pool = NULL;
+        stk = xwmp_thd_pool_get(attr.stack_size, &pool);
+        if (is_err(stk)) {
+                rc = ptr_err(stk);
+                goto err_pool_get;
+        }
+        idx = (xwsz_t)(stk - pool->stacks) / (pool->stack_size / sizeof(xwstk_t));
+        thd = &pool->thds[idx];
+        attr.stack = stk;
+        attr.stack_size = pool->stack_size;
+
+        xwmp_thd_construct(thd);
+        thd->stack.flag = (xwsq_t)0;
+        rc = xwmp_thd_activate(thd, &attr, thdfunc, arg, xwmp_thd_pool_gc);
+        if (rc < 0) {
+                xwos_thdlogf(ERR, thd, "Activate Thread ... %d\r\n", rc);
+                goto err_thd_activate;
+        }
+        xwos_thdlogf(INFO, thd, "Create Thread from pool %s, "
+                     "stack: {.base = 0x%lX, .size = 0x%lX}\r\n",
+                     pool->name, thd->stack.base, thd->stack.size);
+
+        *thdpbuf = thd;
+        return XWOK;
+
+err_thd_activate:
+        xwmp_thd_destruct(thd);
+        xwmp_thd_pool_put(pool, stk);
+err_pool_get:
+        *thdpbuf = NULL;
+        return rc;
+}
+
+__xwmp_api
+xwsz_t xwmp_thd_pool_get_num_free(struct xwmp_thd_pool * pool)
+{
+        return xwaop_load(xwsz_t, &pool->num_free, xwaop_mo_relaxed);
+}
+#endif
+
 /**
  * @brief 执行退出线程的本地中断函数
  * @param[in] thd: 线程对象的指针
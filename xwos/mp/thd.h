@@ -18,6 +18,9 @@
 #include <xwos/lib/xwbop.h>
 #include <xwos/lib/bclst.h>
 #include <xwos/lib/rbtree.h>
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+#  include <xwos/lib/lfq.h>
+#endif
 #include <xwos/mm/common.h>
 #if defined(XWOSCFG_SKD_THD_MEMPOOL) && (1 == XWOSCFG_SKD_THD_MEMPOOL)
 #  include <xwos/mm/mempool/allocator.h>
@@ -121,6 +124,33 @@ struct xwmp_thd {
         } libc;
 };
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+/**
+ * @brief XWOS MP线程池
+ * @details
+ * 线程池中包含预先构造好的线程对象以及大小相同的线程栈，
+ * 每个线程池是一个尺寸等级，线程退出后，线程对象与线程栈回收到线程池中。
+ */
+struct xwmp_thd_pool {
+        struct xwlib_bclst_node node; /**< 线程池链表中的节点，按栈大小从小到大排列 */
+        const char * name; /**< 名字 */
+        xwsz_t stack_size; /**< 线程栈的大小 */
+        xwsz_t num; /**< 线程对象的数量 */
+        struct xwmp_thd * thds; /**< 线程对象数组 */
+        xwstk_t * stacks; /**< 线程栈数组 */
+        atomic_xwlfq_t free_list; /**< 空闲的线程栈无锁队列，节点为线程栈的第一个字 */
+        atomic_xwsz_t num_free; /**< 空闲的线程对象的数量 */
+};
+
+xwer_t xwmp_thd_pool_init(struct xwmp_thd_pool * pool, const char * name,
+                          struct xwmp_thd * thds, xwstk_t * stacks,
+                          xwsz_t stack_size, xwsz_t num);
+xwer_t xwmp_thd_pool_create(struct xwmp_thd ** thdpbuf,
+                            const struct xwmp_thd_attr * inattr,
+                            xwmp_thd_f thdfunc, void * arg);
+xwsz_t xwmp_thd_pool_get_num_free(struct xwmp_thd_pool * pool);
+#endif
+
 #if defined(XWOSCFG_LOCK_MTX) && (1 == XWOSCFG_LOCK_MTX)
 xwer_t xwmp_thd_chprio_once(struct xwmp_thd * thd, xwpr_t dprio,
                             struct xwmp_mtx ** pmtx);
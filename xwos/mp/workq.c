@@ -0,0 +1,791 @@
+/**
+ * @file
+ * @brief XWOS MP内核：工作队列
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ * @note
+ * + 每个工作队列在每个CPU上都有一个工作线程与一个栈式无锁队列。
+ *   入队操作只需要一次无锁的压栈与一次信号量的发布，可在中断中调用。
+ * + 工作线程一次取出本地队列中的所有工作，反转为先进先出的顺序后依次执行。
+ * + 本地队列为空时，工作线程从其他CPU的队列中窃取工作执行；
+ *   工作线程阻塞前会标记自己空闲，向正忙的CPU入队时会唤醒一个空闲的工作线程来窃取。
+ * + 被取消的工作不能从无锁队列中间删除，只会被标记为 `XWMP_WORK_ST_CANCELED` ，
+ *   工作线程取出后直接丢弃。
+ */
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwaop.h>
+#include <xwos/lib/mb.h>
+#include <xwos/mp/skd.h>
+#include <xwos/mp/tt.h>
+#include <xwos/mp/thd.h>
+#include <xwos/mp/workq.h>
+
+/**
+ * @brief 系统工作队列
+ */
+__xwmp_data struct xwmp_workq xwmp_workq_sys;
+
+/**
+ * @brief 系统工作队列的名字
+ */
+static __xwmp_rodata const char xwmp_workq_sys_name[] = "workq.sys";
+
+/**
+ * @brief 系统工作队列的初始化状态：0：未初始化；1：正在初始化；2：已初始化
+ */
+static __xwmp_data atomic_xwsq_t xwmp_workq_sys_inited = 0;
+
+/**
+ * @brief 系统工作队列的工作线程栈
+ */
+static __xwmp_data __xwcc_alignl1cache
+xwstk_t xwmp_workq_sys_stack[CPUCFG_CPU_NUM][XWOSCFG_SKD_WORKQ_STACK_SIZE / sizeof(xwstk_t)];
+
+static __xwmp_code
+void xwmp_workq_cpu_init(struct xwmp_workq * wq, xwid_t cpuid);
+
+static __xwmp_code
+xwer_t xwmp_workq_worker_init(struct xwmp_workq * wq, xwid_t cpuid,
+                              xwstk_t * stack, xwsz_t stack_size);
+
+static __xwmp_code
+xwer_t xwmp_workq_worker(struct xwmp_workq_cpu * wqc);
+
+static __xwmp_code
+struct xwmp_work * xwmp_workq_cpu_grab(struct xwmp_workq_cpu * wqc);
+
+static __xwmp_code
+void xwmp_workq_run(struct xwmp_workq_cpu * wqc, struct xwmp_work * work);
+
+static __xwmp_code
+bool xwmp_workq_steal(struct xwmp_workq_cpu * wqc);
+
+static __xwmp_code
+bool xwmp_workq_drain(struct xwmp_workq_cpu * wqc);
+
+static __xwmp_code
+void xwmp_workq_kick_idle(struct xwmp_workq * wq, xwid_t cpuid);
+
+static __xwmp_code
+void xwmp_workq_notify(struct xwmp_workq * wq);
+
+static __xwmp_code
+void xwmp_workq_push(struct xwmp_workq * wq, xwid_t cpuid,
+                     struct xwmp_work * work);
+
+static __xwmp_code
+void xwmp_work_ttn_callback(struct xwmp_ttn * ttn);
+
+/**
+ * @brief 初始化工作队列在某个CPU上的部分
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: CPU ID
+ */
+static __xwmp_code
+void xwmp_workq_cpu_init(struct xwmp_workq * wq, xwid_t cpuid)
+{
+        struct xwmp_workq_cpu * wqc;
+
+        wqc = &wq->cpu[cpuid];
+        wqc->wq = wq;
+        wqc->id = cpuid;
+        xwlib_lfq_init(&wqc->head);
+        wqc->current = NULL;
+        xwaop_write(xwsq_t, &wqc->idle, 0, NULL);
+        xwmp_plsem_init(&wqc->sem, 0, XWSSQ_MAX); // cppcheck-suppress [misra-c2012-17.7]
+}
+
+/**
+ * @brief 初始化工作队列在某个CPU上的工作线程
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: CPU ID
+ * @param[in] stack: 工作线程栈的首地址
+ * @param[in] stack_size: 工作线程栈的大小
+ * @return 错误码
+ */
+static __xwmp_code
+xwer_t xwmp_workq_worker_init(struct xwmp_workq * wq, xwid_t cpuid,
+                              xwstk_t * stack, xwsz_t stack_size)
+{
+        struct xwmp_thd_attr attr;
+
+        xwmp_thd_attr_init(&attr);
+        attr.name = wq->name;
+        attr.stack = stack;
+        attr.stack_size = stack_size;
+        attr.priority = wq->priority;
+        attr.detached = true;
+        attr.privileged = true;
+        return xwmp_thd_init(&wq->cpu[cpuid].worker, &attr,
+                             (xwmp_thd_f)xwmp_workq_worker, &wq->cpu[cpuid]);
+}
+
+/**
+ * @brief 初始化本地CPU的系统工作队列
+ * @return 错误码
+ * @note
+ * + 每个CPU在初始化调度器之后调用一次，工作线程直接创建在本地CPU上。
+ * + 第一个调用此函数的CPU初始化所有CPU共享的部分，包括每个CPU的队列与信号量，
+ *   其他CPU等待初始化完成后才创建自己的工作线程，
+ *   因此任何CPU入队或窃取时，共享的部分都已初始化。
+ */
+__xwmp_init_code
+xwer_t xwmp_workq_sys_init_lc(void)
+{
+        xwid_t cpuid;
+        xwsq_t inited;
+        xwer_t rc;
+
+        cpuid = xwmp_skd_get_cpuid_lc();
+        rc = xwaop_teq_then_write(xwsq_t, &xwmp_workq_sys_inited,
+                                  (xwsq_t)0, (xwsq_t)1, NULL);
+        if (XWOK == rc) {
+                xwmp_workq_sys.name = xwmp_workq_sys_name;
+                xwmp_workq_sys.priority = XWOSCFG_SKD_WORKQ_PRIORITY;
+                xwaop_write(xwsz_t, &xwmp_workq_sys.pending, 0, NULL);
+                xwaop_write(xwsz_t, &xwmp_workq_sys.flushing, 0, NULL);
+                xwmp_splk_init(&xwmp_workq_sys.lock);
+                xwmp_cond_init(&xwmp_workq_sys.cond); // cppcheck-suppress [misra-c2012-17.7]
+                for (inited = (xwsq_t)0; inited < (xwsq_t)CPUCFG_CPU_NUM; inited++) {
+                        xwmp_workq_cpu_init(&xwmp_workq_sys, (xwid_t)inited);
+                }
+                xwaop_store(xwsq_t, &xwmp_workq_sys_inited, xwaop_mo_release, (xwsq_t)2);
+        } else {
+                do {
+                        inited = xwaop_load(xwsq_t, &xwmp_workq_sys_inited,
+                                            xwaop_mo_acquire);
+                } while ((xwsq_t)2 != inited);
+        }
+        return xwmp_workq_worker_init(&xwmp_workq_sys, cpuid,
+                                      xwmp_workq_sys_stack[cpuid],
+                                      sizeof(xwmp_workq_sys_stack[cpuid]));
+}
+
+/**
+ * @brief XWMP API：初始化工作队列
+ * @param[in] wq: 工作队列的指针
+ * @param[in] name: 名字，也是工作线程的名字
+ * @param[in] prio: 工作线程的优先级
+ * @param[in] stacks: 工作线程栈数组，大小为 `stack_size * CPUCFG_CPU_NUM`
+ * @param[in] stack_size: 每个工作线程栈的大小
+ * @return 错误码
+ * @note
+ * + 上下文：线程
+ * @details
+ * 所有工作线程都在本地CPU上创建，运行后再各自迁移到对应的CPU上。
+ */
+__xwmp_api
+xwer_t xwmp_workq_init(struct xwmp_workq * wq, const char * name, xwpr_t prio,
+                       xwstk_t * stacks, xwsz_t stack_size)
+{
+        xwid_t cpuid;
+        xwer_t rc;
+
+        wq->name = name;
+        wq->priority = prio;
+        xwaop_write(xwsz_t, &wq->pending, 0, NULL);
+        xwaop_write(xwsz_t, &wq->flushing, 0, NULL);
+        xwmp_splk_init(&wq->lock);
+        rc = xwmp_cond_init(&wq->cond);
+        if (rc < 0) {
+                goto err_cond_init;
+        }
+        for (cpuid = (xwid_t)0; cpuid < CPUCFG_CPU_NUM; cpuid++) {
+                xwmp_workq_cpu_init(wq, cpuid);
+        }
+        for (cpuid = (xwid_t)0; cpuid < CPUCFG_CPU_NUM; cpuid++) {
+                rc = xwmp_workq_worker_init(wq, cpuid,
+                                            &stacks[(stack_size / sizeof(xwstk_t)) *
+                                                    (xwsz_t)cpuid],
+                                            stack_size);
+                if (rc < 0) {
+                        goto err_worker_init;
+                }
+        }
+        return XWOK;
+
+err_worker_init:
+err_cond_init:
+        return rc;
+}
+
+/**
+ * @brief 取出CPU队列中的所有工作，并反转为先进先出的顺序
+ * @param[in] wqc: 工作队列在某个CPU上的部分
+ * @return 第一个工作的指针
+ */
+static __xwmp_code
+struct xwmp_work * xwmp_workq_cpu_grab(struct xwmp_workq_cpu * wqc)
+{
+        struct xwmp_work * first;
+        struct xwmp_work * work;
+        xwlfq_t * n;
+
+        first = NULL;
+        n = xwlib_lfq_pop(&wqc->head);
+        while (NULL != n) {
+                work = xwcc_derof(n, struct xwmp_work, lfqn);
+                work->next = first;
+                first = work;
+                n = xwlib_lfq_pop(&wqc->head);
+        }
+        return first;
+}
+
+/**
+ * @brief 通知等待工作完成的线程
+ * @param[in] wq: 工作队列的指针
+ */
+static __xwmp_code
+void xwmp_workq_notify(struct xwmp_workq * wq)
+{
+        xwmb_mp_mb();
+        if ((xwsz_t)0 != xwaop_load(xwsz_t, &wq->flushing, xwaop_mo_relaxed)) {
+                xwmp_splk_lock(&wq->lock);
+                xwmp_cond_broadcast(&wq->cond); // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_splk_unlock(&wq->lock);
+        }
+}
+
+/**
+ * @brief 执行工作
+ * @param[in] wqc: 执行工作的CPU队列
+ * @param[in] work: 工作的指针
+ * @note
+ * + 工作函数返回后，不再访问 `work` ，工作函数可以释放工作自身。
+ */
+static __xwmp_code
+void xwmp_workq_run(struct xwmp_workq_cpu * wqc, struct xwmp_work * work)
+{
+        struct xwmp_workq * wq;
+        xwmp_work_f func;
+        void * arg;
+        xwsq_t st;
+        xwsq_t nst;
+        xwer_t rc;
+
+        wq = wqc->wq;
+        func = work->func;
+        arg = work->arg;
+        /* 先标记正在执行的工作，再清除等待状态，
+           `xwmp_work_tst_busy()` 不会看到工作短暂地处于空闲状态。 */
+        xwmb_mp_store_release(struct xwmp_work *, &wqc->current, work);
+        do {
+                st = xwaop_load(xwsq_t, &work->state, xwaop_mo_acquire);
+                nst = st & ~((xwsq_t)XWMP_WORK_ST_PENDING | (xwsq_t)XWMP_WORK_ST_CANCELED);
+                rc = xwaop_teq_then_write(xwsq_t, &work->state, st, nst, NULL);
+        } while (rc < 0);
+        if ((xwsq_t)0 == ((xwsq_t)XWMP_WORK_ST_CANCELED & st)) {
+                func(work, arg);
+        }
+        xwmb_mp_store_release(struct xwmp_work *, &wqc->current, NULL);
+        xwaop_sub(xwsz_t, &wq->pending, 1, NULL, NULL);
+        xwmp_workq_notify(wq);
+}
+
+/**
+ * @brief 从其他CPU的队列中窃取一个工作并执行
+ * @param[in] wqc: 本地CPU的队列
+ * @return 布尔值
+ * @retval true: 窃取到工作
+ * @retval false: 其他CPU的队列都是空的
+ */
+static __xwmp_code
+bool xwmp_workq_steal(struct xwmp_workq_cpu * wqc)
+{
+        struct xwmp_workq * wq;
+        struct xwmp_work * work;
+        xwlfq_t * n;
+        xwid_t i;
+        xwid_t victim;
+        bool stolen;
+
+        wq = wqc->wq;
+        stolen = false;
+        for (i = (xwid_t)1; i < CPUCFG_CPU_NUM; i++) {
+                victim = (wqc->id + i) % CPUCFG_CPU_NUM;
+                n = xwlib_lfq_pop(&wq->cpu[victim].head);
+                if (NULL != n) {
+                        work = xwcc_derof(n, struct xwmp_work, lfqn);
+                        xwmp_workq_run(wqc, work);
+                        stolen = true;
+                        break;
+                }
+        }
+        return stolen;
+}
+
+/**
+ * @brief 执行本地队列中的所有工作，本地队列为空时窃取其他CPU的工作
+ * @param[in] wqc: 工作队列在本CPU上的部分
+ * @return 布尔值
+ * @retval true: 执行了至少一个工作
+ * @retval false: 所有CPU的队列都是空的
+ */
+static __xwmp_code
+bool xwmp_workq_drain(struct xwmp_workq_cpu * wqc)
+{
+        struct xwmp_work * work;
+        struct xwmp_work * next;
+        bool busy;
+        bool ran;
+
+        ran = false;
+        do {
+                work = xwmp_workq_cpu_grab(wqc);
+                if (NULL == work) {
+                        /* 本地队列为空，窃取其他CPU的工作 */
+                        busy = xwmp_workq_steal(wqc);
+                } else {
+                        busy = true;
+                        while (NULL != work) {
+                                next = work->next;
+                                xwmp_workq_run(wqc, work);
+                                work = next;
+                        }
+                }
+                ran = ran || busy;
+        } while (busy);
+        return ran;
+}
+
+/**
+ * @brief 工作线程的主函数
+ * @param[in] wqc: 工作队列在本CPU上的部分
+ * @return 错误码
+ * @details
+ * 阻塞之前先标记空闲，再检查一次所有CPU的队列，
+ * 标记之后入队的工作会唤醒此工作线程，因此不会错过可以窃取的工作。
+ */
+static __xwmp_code
+xwer_t xwmp_workq_worker(struct xwmp_workq_cpu * wqc)
+{
+        xwer_t rc;
+
+        if (xwmp_skd_get_cpuid_lc() != wqc->id) {
+                // cppcheck-suppress [misra-c2012-17.7]
+                xwmp_thd_migrate(xwmp_skd_get_cthd_lc(), wqc->id);
+        }
+        while (!xwmp_cthd_frz_shld_stop(NULL)) {
+                xwmp_workq_drain(wqc); // cppcheck-suppress [misra-c2012-17.7]
+                xwaop_store(xwsq_t, &wqc->idle, xwaop_mo_relaxed, 1);
+                xwmb_mp_mb();
+                if (xwmp_workq_drain(wqc)) {
+                        xwaop_store(xwsq_t, &wqc->idle, xwaop_mo_relaxed, 0);
+                        continue;
+                }
+                rc = xwmp_plsem_wait(&wqc->sem);
+                xwaop_store(xwsq_t, &wqc->idle, xwaop_mo_relaxed, 0);
+                XWOS_UNUSED(rc);
+        }
+        return XWOK;
+}
+
+/**
+ * @brief XWMP API：等待工作队列中所有已经入队的工作执行完成
+ * @param[in] wq: 工作队列的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EINTR: 等待被中断
+ * @note
+ * + 上下文：线程
+ * + 不能在工作函数中调用，否则会死锁。
+ */
+__xwmp_api
+xwer_t xwmp_workq_flush(struct xwmp_workq * wq)
+{
+        xwsq_t lkst;
+        xwer_t rc;
+
+        rc = XWOK;
+        xwaop_add(xwsz_t, &wq->flushing, 1, NULL, NULL);
+        xwmb_mp_mb();
+        xwmp_splk_lock(&wq->lock);
+        while ((xwsz_t)0 != xwaop_load(xwsz_t, &wq->pending, xwaop_mo_acquire)) {
+                rc = xwmp_cond_wait(&wq->cond, &wq->lock, XWOS_LK_SPLK, NULL, &lkst);
+                if (rc < 0) {
+                        if ((xwsq_t)XWOS_LKST_UNLOCKED == lkst) {
+                                xwmp_splk_lock(&wq->lock);
+                        }
+                        break;
+                }
+        }
+        xwmp_splk_unlock(&wq->lock);
+        xwaop_sub(xwsz_t, &wq->flushing, 1, NULL, NULL);
+        return rc;
+}
+
+/**
+ * @brief XWMP API：初始化工作
+ * @param[in] work: 工作的指针
+ * @param[in] func: 工作函数
+ * @param[in] arg: 工作函数的参数
+ * @note
+ * + 上下文：任意
+ */
+__xwmp_api
+void xwmp_work_init(struct xwmp_work * work, xwmp_work_f func, void * arg)
+{
+        xwlib_lfq_init(&work->lfqn);
+        work->next = NULL;
+        work->func = func;
+        work->arg = arg;
+        xwaop_write(xwsq_t, &work->state, (xwsq_t)XWMP_WORK_ST_IDLE, NULL);
+        work->wq = NULL;
+        work->cpuid = (xwid_t)0;
+        work->xwtt = NULL;
+        xwmp_ttn_init(&work->ttn);
+}
+
+/**
+ * @brief 将工作推入某个CPU的队列，并唤醒工作线程
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: CPU ID
+ * @param[in] work: 工作的指针
+ */
+static __xwmp_code
+void xwmp_workq_push(struct xwmp_workq * wq, xwid_t cpuid,
+                     struct xwmp_work * work)
+{
+        xwaop_add(xwsz_t, &wq->pending, 1, NULL, NULL);
+        xwlib_lfq_init(&work->lfqn);
+        xwlib_lfq_push(&wq->cpu[cpuid].head, &work->lfqn);
+        xwmp_plsem_post(&wq->cpu[cpuid].sem); // cppcheck-suppress [misra-c2012-17.7]
+        xwmp_workq_kick_idle(wq, cpuid);
+}
+
+/**
+ * @brief 目标CPU的工作线程正忙时，唤醒一个空闲的工作线程窃取工作
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: 工作入队的CPU ID
+ */
+static __xwmp_code
+void xwmp_workq_kick_idle(struct xwmp_workq * wq, xwid_t cpuid)
+{
+        struct xwmp_work * current;
+        xwid_t i;
+        xwid_t thief;
+        xwer_t rc;
+
+        xwmb_mp_mb();
+        xwmb_mp_load_acquire(struct xwmp_work *, current, &wq->cpu[cpuid].current);
+        if (NULL != current) {
+                for (i = (xwid_t)1; i < CPUCFG_CPU_NUM; i++) {
+                        thief = (cpuid + i) % CPUCFG_CPU_NUM;
+                        rc = xwaop_teq_then_write(xwsq_t, &wq->cpu[thief].idle,
+                                                  (xwsq_t)1, (xwsq_t)0, NULL);
+                        if (XWOK == rc) {
+                                // cppcheck-suppress [misra-c2012-17.7]
+                                xwmp_plsem_post(&wq->cpu[thief].sem);
+                                break;
+                        }
+                }
+        }
+}
+
+/**
+ * @brief XWMP API：将工作加入某个CPU的工作队列
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: CPU ID
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENODEV: CPU ID错误
+ * @retval -EALREADY: 工作已经在队列中或时间树上
+ * @note
+ * + 上下文：任意
+ * @details
+ * 若工作已被取消，但还未离开队列，此函数会撤销取消，工作仍在原来的队列中执行。
+ */
+__xwmp_api
+xwer_t xwmp_work_queue_on(struct xwmp_workq * wq, xwid_t cpuid,
+                          struct xwmp_work * work)
+{
+        xwsq_t st;
+        xwsq_t nst;
+        bool push;
+        xwer_t rc;
+
+        if (cpuid >= CPUCFG_CPU_NUM) {
+                rc = -ENODEV;
+                goto err_badcpuid;
+        }
+        do {
+                st = xwaop_load(xwsq_t, &work->state, xwaop_mo_acquire);
+                if ((xwsq_t)0 != ((xwsq_t)XWMP_WORK_ST_CANCELED & st)) {
+                        nst = st & ~((xwsq_t)XWMP_WORK_ST_CANCELED);
+                        push = false;
+                } else if ((xwsq_t)XWMP_WORK_ST_IDLE == st) {
+                        nst = (xwsq_t)XWMP_WORK_ST_PENDING;
+                        push = true;
+                } else {
+                        rc = -EALREADY;
+                        goto err_already;
+                }
+                rc = xwaop_teq_then_write(xwsq_t, &work->state, st, nst, NULL);
+        } while (rc < 0);
+        if (push) {
+                work->wq = wq;
+                work->cpuid = cpuid;
+                xwmp_workq_push(wq, cpuid, work);
+        }
+        return XWOK;
+
+err_already:
+err_badcpuid:
+        return rc;
+}
+
+/**
+ * @brief XWMP API：将工作加入本地CPU的工作队列
+ * @param[in] wq: 工作队列的指针
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EALREADY: 工作已经在队列中或时间树上
+ * @note
+ * + 上下文：任意
+ */
+__xwmp_api
+xwer_t xwmp_work_queue(struct xwmp_workq * wq, struct xwmp_work * work)
+{
+        return xwmp_work_queue_on(wq, xwmp_skd_get_cpuid_lc(), work);
+}
+
+/**
+ * @brief 延迟工作的时间树回调函数
+ * @param[in] ttn: 时间树节点的指针
+ */
+static __xwmp_code
+void xwmp_work_ttn_callback(struct xwmp_ttn * ttn)
+{
+        struct xwmp_work * work;
+        xwsq_t st;
+        xwsq_t nst;
+        xwer_t rc;
+
+        work = xwcc_derof(ttn, struct xwmp_work, ttn);
+        xwmb_mp_store_release(struct xwmp_tt *, &work->xwtt, NULL);
+        do {
+                st = xwaop_load(xwsq_t, &work->state, xwaop_mo_acquire);
+                /* 已被取消的工作也要入队，由工作线程丢弃并通知等待的线程 */
+                nst = (st & (xwsq_t)XWMP_WORK_ST_CANCELED) | (xwsq_t)XWMP_WORK_ST_PENDING;
+                rc = xwaop_teq_then_write(xwsq_t, &work->state, st, nst, NULL);
+        } while (rc < 0);
+        xwmp_workq_push(work->wq, work->cpuid, work);
+}
+
+/**
+ * @brief XWMP API：延迟一段时间后将工作加入某个CPU的工作队列
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: CPU ID
+ * @param[in] work: 工作的指针
+ * @param[in] delay: 延迟的时间
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ENODEV: CPU ID错误
+ * @retval -EALREADY: 工作已经在队列中或时间树上
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 工作被挂在本地CPU的时间树上，超时后在时间树的回调函数中入队。
+ * + 状态在持有时间树的锁时切换为 `XWMP_WORK_ST_DELAYED` ，
+ *   `work->xwtt` 在工作被加入时间树之后才以释放语义发布，
+ *   `xwmp_work_cancel()` 看到 `NULL` 时只标记取消，由回调函数将工作入队丢弃。
+ */
+__xwmp_api
+xwer_t xwmp_work_queue_delayed(struct xwmp_workq * wq, xwid_t cpuid,
+                               struct xwmp_work * work, xwtm_t delay)
+{
+        struct xwmp_tt * xwtt;
+        xwtm_t to;
+        xwreg_t cpuirq;
+        xwsq_t st;
+        xwsq_t nst;
+        xwer_t casrc;
+        xwer_t rc;
+
+        if (cpuid >= CPUCFG_CPU_NUM) {
+                rc = -ENODEV;
+                goto err_badcpuid;
+        }
+        xwtt = &xwmp_skd_get_lc()->tt;
+        xwmp_sqlk_wr_lock_cpuirqsv(&xwtt->lock, &cpuirq);
+        rc = xwaop_teq_then_write(xwsq_t, &work->state,
+                                  (xwsq_t)XWMP_WORK_ST_IDLE,
+                                  (xwsq_t)XWMP_WORK_ST_DELAYED,
+                                  NULL);
+        if (rc < 0) {
+                xwmp_sqlk_wr_unlock_cpuirqrs(&xwtt->lock, cpuirq);
+                rc = -EALREADY;
+                goto err_already;
+        }
+        work->wq = wq;
+        work->cpuid = cpuid;
+        to = xwtm_add_safely(xwmp_syshwt_get_time(&xwtt->hwt), delay);
+        work->ttn.wkup_xwtm = to;
+        xwaop_write(xwsq_t, &work->ttn.wkuprs, (xwsq_t)XWMP_TTN_WKUPRS_UNKNOWN, NULL);
+        work->ttn.xwtt = xwtt;
+        work->ttn.cb = xwmp_work_ttn_callback;
+        rc = xwmp_tt_add_locked(xwtt, &work->ttn, cpuirq);
+        if (XWOK == rc) {
+                xwmb_mp_store_release(struct xwmp_tt *, &work->xwtt, xwtt);
+        }
+        xwmp_sqlk_wr_unlock_cpuirqrs(&xwtt->lock, cpuirq);
+        if (rc < 0) {
+                /* 不能覆盖并发的取消，只清除本函数设置的状态 */
+                do {
+                        st = xwaop_load(xwsq_t, &work->state, xwaop_mo_acquire);
+                        nst = st & ~((xwsq_t)XWMP_WORK_ST_DELAYED |
+                                     (xwsq_t)XWMP_WORK_ST_CANCELED);
+                        casrc = xwaop_teq_then_write(xwsq_t, &work->state, st, nst, NULL);
+                } while (casrc < 0);
+        }
+        return rc;
+
+err_already:
+err_badcpuid:
+        return rc;
+}
+
+/**
+ * @brief XWMP API：取消工作
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ESRCH: 工作不在队列中，也不在时间树上
+ * @note
+ * + 上下文：任意
+ * @details
+ * 此函数不会等待正在执行的工作函数返回，需要等待时，可再调用 `xwmp_work_flush()` 。
+ */
+__xwmp_api
+xwer_t xwmp_work_cancel(struct xwmp_work * work)
+{
+        struct xwmp_tt * xwtt;
+        xwsq_t st;
+        xwreg_t cpuirq;
+        xwer_t rc;
+
+        st = xwaop_load(xwsq_t, &work->state, xwaop_mo_acquire);
+        xwmb_mp_load_acquire(struct xwmp_tt *, xwtt, &work->xwtt);
+        if (((xwsq_t)0 != ((xwsq_t)XWMP_WORK_ST_DELAYED & st)) && (NULL != xwtt)) {
+                xwmp_sqlk_wr_lock_cpuirqsv(&xwtt->lock, &cpuirq);
+                if (work->xwtt == xwtt) {
+                        rc = xwmp_tt_remove_locked(xwtt, &work->ttn);
+                        if (XWOK == rc) {
+                                work->xwtt = NULL;
+                        }
+                } else {
+                        rc = -ESRCH;
+                }
+                xwmp_sqlk_wr_unlock_cpuirqrs(&xwtt->lock, cpuirq);
+                if (XWOK == rc) {
+                        /* 从时间树上删除成功，回调函数不可能再被执行。
+                           工作以取消状态入队，由工作线程丢弃并通知等待的线程。 */
+                        xwaop_write(xwsq_t, &work->state,
+                                    ((xwsq_t)XWMP_WORK_ST_PENDING |
+                                     (xwsq_t)XWMP_WORK_ST_CANCELED),
+                                    NULL);
+                        xwmp_workq_push(work->wq, work->cpuid, work);
+                        goto done;
+                }
+        }
+        /* 工作已在队列中，时间树的回调函数正在执行，或延迟工作正在被加入时间树 */
+        do {
+                st = xwaop_load(xwsq_t, &work->state, xwaop_mo_acquire);
+                if (((xwsq_t)0 != ((xwsq_t)XWMP_WORK_ST_CANCELED & st)) ||
+                    ((xwsq_t)XWMP_WORK_ST_IDLE == st)) {
+                        rc = -ESRCH;
+                        goto err_notqueued;
+                }
+                rc = xwaop_teq_then_write(xwsq_t, &work->state,
+                                          st, st | (xwsq_t)XWMP_WORK_ST_CANCELED,
+                                          NULL);
+        } while (rc < 0);
+
+done:
+        return XWOK;
+
+err_notqueued:
+        return rc;
+}
+
+/**
+ * @brief XWMP API：测试工作是否在队列中、时间树上或正在执行
+ * @param[in] work: 工作的指针
+ * @return 布尔值
+ * @note
+ * + 上下文：任意
+ */
+__xwmp_api
+bool xwmp_work_tst_busy(struct xwmp_work * work)
+{
+        struct xwmp_workq * wq;
+        struct xwmp_work * current;
+        xwsq_t st;
+        xwid_t cpuid;
+        bool busy;
+
+        st = xwaop_load(xwsq_t, &work->state, xwaop_mo_acquire);
+        busy = ((xwsq_t)XWMP_WORK_ST_IDLE != st);
+        wq = work->wq;
+        if ((!busy) && (NULL != wq)) {
+                for (cpuid = (xwid_t)0; cpuid < CPUCFG_CPU_NUM; cpuid++) {
+                        xwmb_mp_load_acquire(struct xwmp_work *, current,
+                                             &wq->cpu[cpuid].current);
+                        if (current == work) {
+                                busy = true;
+                                break;
+                        }
+                }
+        }
+        return busy;
+}
+
+/**
+ * @brief XWMP API：等待工作执行完成
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EINTR: 等待被中断
+ * @note
+ * + 上下文：线程
+ * + 不能在工作函数中等待自身，否则会死锁。
+ * @details
+ * 等待工作离开队列与时间树，且没有任何工作线程正在执行它。
+ */
+__xwmp_api
+xwer_t xwmp_work_flush(struct xwmp_work * work)
+{
+        struct xwmp_workq * wq;
+        xwsq_t lkst;
+        xwer_t rc;
+
+        rc = XWOK;
+        wq = work->wq;
+        if (NULL != wq) {
+                xwaop_add(xwsz_t, &wq->flushing, 1, NULL, NULL);
+                xwmb_mp_mb();
+                xwmp_splk_lock(&wq->lock);
+                while (xwmp_work_tst_busy(work)) {
+                        rc = xwmp_cond_wait(&wq->cond, &wq->lock, XWOS_LK_SPLK,
+                                            NULL, &lkst);
+                        if (rc < 0) {
+                                if ((xwsq_t)XWOS_LKST_UNLOCKED == lkst) {
+                                        xwmp_splk_lock(&wq->lock);
+                                }
+                                break;
+                        }
+                }
+                xwmp_splk_unlock(&wq->lock);
+                xwaop_sub(xwsz_t, &wq->flushing, 1, NULL, NULL);
+        }
+        return rc;
+}
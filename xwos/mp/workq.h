@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @brief XWOS MP内核：工作队列
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_mp_workq_h__
+#define __xwos_mp_workq_h__
+
+#include <xwos/standard.h>
+#include <xwos/lib/xwbop.h>
+#include <xwos/lib/lfq.h>
+#include <xwos/mp/skd.h>
+#include <xwos/mp/tt.h>
+#include <xwos/mp/thd.h>
+#include <xwos/mp/lock/spinlock.h>
+#include <xwos/mp/sync/sem.h>
+#include <xwos/mp/sync/cond.h>
+
+struct xwmp_work;
+struct xwmp_workq;
+
+/**
+ * @brief 工作的状态枚举
+ */
+enum xwmp_work_state_em {
+        XWMP_WORK_ST_IDLE = 0U, /**< 空闲 */
+        XWMP_WORK_ST_PENDING = XWBOP_BIT(0), /**< 在工作队列中等待执行 */
+        XWMP_WORK_ST_DELAYED = XWBOP_BIT(1), /**< 在时间树上等待超时 */
+        XWMP_WORK_ST_CANCELED = XWBOP_BIT(2), /**< 已被取消，但还未离开队列或时间树 */
+};
+
+/**
+ * @brief 工作函数
+ */
+typedef void (* xwmp_work_f)(struct xwmp_work *, void *);
+
+/**
+ * @brief 工作
+ */
+struct xwmp_work {
+        atomic_xwlfq_t lfqn; /**< 无锁队列节点 */
+        struct xwmp_work * next; /**< 工作线程本地链表中的下一个工作 */
+        xwmp_work_f func; /**< 工作函数 */
+        void * arg; /**< 工作函数的参数 */
+        atomic_xwsq_t state; /**< 状态 */
+        struct xwmp_workq * wq; /**< 工作所属的工作队列 */
+        xwid_t cpuid; /**< 执行工作的CPU */
+        struct xwmp_tt * xwtt; /**< 延迟工作所在的时间树，不在时间树上时为 `NULL` */
+        struct xwmp_ttn ttn; /**< 继承：时间树节点，被锁tt->lock保护 */
+};
+
+/**
+ * @brief 工作队列在每个CPU上的部分
+ */
+struct xwmp_workq_cpu {
+        struct xwmp_workq * wq; /**< 所属的工作队列 */
+        xwid_t id; /**< CPU ID */
+        atomic_xwlfq_t head; /**< 待执行的工作（栈式无锁队列） */
+        struct xwmp_work * current; /**< 正在执行的工作 */
+        atomic_xwsq_t idle; /**< 工作线程是否空闲，等待被唤醒窃取其他CPU的工作 */
+        struct xwmp_sem sem; /**< 唤醒工作线程的信号量 */
+        struct xwmp_thd worker; /**< 工作线程 */
+};
+
+/**
+ * @brief 工作队列
+ */
+struct xwmp_workq {
+        const char * name; /**< 名字 */
+        xwpr_t priority; /**< 工作线程的优先级 */
+        atomic_xwsz_t pending; /**< 已经入队但还未执行完的工作的数量 */
+        atomic_xwsz_t flushing; /**< 正在等待工作完成的线程的数量 */
+        struct xwmp_splk lock; /**< 保护条件量的自旋锁 */
+        struct xwmp_cond cond; /**< 等待工作完成的条件量 */
+        struct xwmp_workq_cpu cpu[CPUCFG_CPU_NUM]; /**< 每CPU的部分 */
+};
+
+extern struct xwmp_workq xwmp_workq_sys;
+
+xwer_t xwmp_workq_sys_init_lc(void);
+xwer_t xwmp_workq_init(struct xwmp_workq * wq, const char * name, xwpr_t prio,
+                       xwstk_t * stacks, xwsz_t stack_size);
+xwer_t xwmp_workq_flush(struct xwmp_workq * wq);
+
+void xwmp_work_init(struct xwmp_work * work, xwmp_work_f func, void * arg);
+xwer_t xwmp_work_queue_on(struct xwmp_workq * wq, xwid_t cpuid,
+                          struct xwmp_work * work);
+xwer_t xwmp_work_queue(struct xwmp_workq * wq, struct xwmp_work * work);
+xwer_t xwmp_work_queue_delayed(struct xwmp_workq * wq, xwid_t cpuid,
+                               struct xwmp_work * work, xwtm_t delay);
+xwer_t xwmp_work_cancel(struct xwmp_work * work);
+xwer_t xwmp_work_flush(struct xwmp_work * work);
+bool xwmp_work_tst_busy(struct xwmp_work * work);
+
+#endif /* xwos/mp/workq.h */
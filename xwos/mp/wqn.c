@@ -29,6 +29,8 @@ void xwmp_wqn_init(struct xwmp_wqn * wqn)
         wqn->wq = NULL;
         xwmp_splk_init(&wqn->lock);
         wqn->prio = XWMP_SKD_PRIORITY_INVALID;
+        wqn->rqlk = NULL;
+        wqn->rqed = false;
         xwlib_rbtree_init_node(&wqn->rbn);
         xwlib_bclst_init_node(&wqn->cln.rbb);
         wqn->cb = NULL;
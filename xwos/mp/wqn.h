@@ -62,6 +62,8 @@ struct xwmp_wqn {
         xwmp_wqn_f cb; /**< 被唤醒时的回调函数 */
         struct xwmp_splk lock; /**< 保护此结构体的锁 */
         xwpr_t prio; /**< 优先级 */
+        void * rqlk; /**< 条件量广播时可将此节点转移到其等待队列中的互斥锁 */
+        bool rqed; /**< 是否已被条件量广播转移到互斥锁的等待队列中 */
         struct xwlib_rbtree_node rbn; /**> 红黑树节点 */
         union {
                 struct xwlib_bclst_node rbb; /**< 当等待队列为 `rtwq` 时的链表节点 */
@@ -45,6 +45,10 @@
  * + `xwos_irq_save()` ：保存某个外设中断的开关，然后将其关闭
  * + `xwos_irq_restore()` ：恢复某个外设中断的开关
  *
+ * ### 核间中断
+ *
+ * + `xwos_irq_ipi()` ：向某个CPU发送核间中断，只有多核内核且移植层支持时可用
+ *
  *
  * ## C++
  *
@@ -136,6 +140,27 @@ xwer_t xwos_irq_get_id(xwirq_t * irqnbuf)
         return xwosdl_irq_get_id(irqnbuf);
 }
 
+/**
+ * @brief XWOS API：向某个CPU发送核间中断
+ * @param[in] irqn: 核间中断的中断号
+ * @param[in] cpuid: 目的地CPU的ID
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ERANGE: 中断号或CPU的ID超出范围
+ * @retval -ENOSYS: 没有实现此功能
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 中断号的含义由移植层决定，例如ARMv8-A的GIC中为SGI的编号 `0~15` 。
+ * + 目的地CPU需要事先通过 `xwos_irq_enable()` 开启此中断，并注册中断处理函数。
+ * + 单核内核（UP）中此CAPI总是返回 `-ENOSYS` 。
+ */
+static __xwos_inline_api
+xwer_t xwos_irq_ipi(xwirq_t irqn, xwid_t cpuid)
+{
+        return xwosdl_irq_ipi(irqn, cpuid);
+}
+
 /**
  * @brief XWOS API：开启本地CPU的中断
  * @note
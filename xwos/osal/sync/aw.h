@@ -0,0 +1,248 @@
+/**
+ * @file
+ * @brief 操作系统抽象层：异步等待
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_osal_sync_aw_h__
+#define __xwos_osal_sync_aw_h__
+
+#include <xwos/standard.h>
+#include <xwos/osal/jack/sync/aw.h>
+#include <xwos/osal/workq.h>
+#if ((defined(XWOSCFG_SYNC_PLSEM) && (1 == XWOSCFG_SYNC_PLSEM)) || \
+     (defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)))
+#  include <xwos/osal/sync/sem.h>
+#endif
+#if defined(XWOSCFG_SYNC_COND) && (1 == XWOSCFG_SYNC_COND)
+#  include <xwos/osal/sync/cond.h>
+#endif
+#if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+#  include <xwos/osal/sync/flg.h>
+#  include <xwos/osal/sync/br.h>
+#endif
+
+/**
+ * @defgroup xwos_sync_aw 异步等待
+ * @ingroup xwos_sync
+ * 异步等待使得调用者不需要阻塞在同步对象上，
+ * 而是注册一个回调函数，在同步对象可用时由系统推迟执行。
+ * 一个线程因此可以同时等待多个同步对象，或者在中断上下文中发起等待。
+ * 只有XWOS MP内核支持异步等待，需要配置 `XWOSCFG_SYNC_AW` 为 `1` 。
+ *
+ *
+ * ## 异步等待节点
+ *
+ * 异步等待节点 @ref xwos_aw 与线程一样加入同步对象的等待队列中排队，
+ * 唤醒的顺序与规则与等待的线程完全相同。
+ * 节点被唤醒后，回调函数在以下上下文之一中执行：
+ *
+ * + 初始化时指定了工作队列：在工作队列的指定CPU的工作线程中执行；
+ * + 没有指定工作队列：在唤醒者所在CPU的中断底半部中执行，
+ *   若配置 `XWOSCFG_SKD_BH` 为 `0` ，则在系统工作队列中执行。
+ *
+ * 同一个节点同时只能注册一次，回调函数开始执行之前，再次注册会返回 `-EALREADY` 。
+ * 回调函数中可以再次注册同一个节点。
+ *
+ *
+ * ## 注册异步等待
+ *
+ * + `xwos_sem_wait_async()` ：异步等待信号量
+ * + `xwos_cond_wait_async()` ：异步等待条件量
+ * + `xwos_flg_wait_async()` ：异步等待事件标志
+ * + `xwos_br_wait_async()` ：异步等待线程栅栏
+ *
+ * 以上CAPI都可在 **任意** 上下文使用。若同步对象已经可用，回调函数会被直接推迟执行，
+ * 不会进入等待队列。
+ *
+ *
+ * ## 取消异步等待
+ *
+ * + `xwos_aw_cancel()` ：取消异步等待，回调函数仍会被执行一次，等待的结果为 `-EINTR`
+ * + `xwos_aw_tst_busy()` ：测试异步等待节点是否已注册，或回调函数还未开始执行
+ * @{
+ */
+
+/**
+ * @brief XWOS API：异步等待节点
+ */
+struct xwos_aw {
+        struct xwosdl_aw osaw;
+};
+
+/**
+ * @brief XWOS API：异步等待的回调函数指针类型
+ * @details
+ * 回调函数的参数：
+ * + `aw` ：异步等待节点的指针
+ * + `rc` ：等待的结果， `XWOK` 表示同步对象可用， `-EINTR` 表示等待被取消
+ * + `arg` ：用户参数
+ */
+typedef void (* xwos_aw_f)(struct xwos_aw * /*aw*/, xwer_t /*rc*/, void * /*arg*/);
+
+/**
+ * @brief XWOS API：初始化异步等待节点
+ * @param[in] aw: 异步等待节点的指针
+ * @param[in] func: 回调函数
+ * @param[in] arg: 回调函数的参数
+ * @param[in] workq: 执行回调函数的工作队列，
+ *                   `NULL` 表示在唤醒者所在CPU的中断底半部中执行
+ * @param[in] cpuid: 执行回调函数的CPU，只在 `workq` 不为 `NULL` 时有意义
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+void xwos_aw_init(struct xwos_aw * aw, xwos_aw_f func, void * arg,
+                  struct xwos_workq * workq, xwid_t cpuid)
+{
+        // cppcheck-suppress [misra-c2012-11.1]
+        xwosdl_aw_init(&aw->osaw, (xwosdl_aw_f)func, arg,
+                       (NULL != workq) ? &workq->oswq : NULL, cpuid);
+}
+
+/**
+ * @brief XWOS API：取消异步等待
+ * @param[in] aw: 异步等待节点的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ESRCH: 节点不在等待队列中（未注册或已被唤醒）
+ * @note
+ * + 上下文：任意
+ * @details
+ * 取消成功后，回调函数仍会被执行一次，等待的结果为 `-EINTR` 。
+ */
+static __xwos_inline_api
+xwer_t xwos_aw_cancel(struct xwos_aw * aw)
+{
+        return xwosdl_aw_cancel(&aw->osaw);
+}
+
+/**
+ * @brief XWOS API：测试异步等待节点是否已注册，或回调函数还未开始执行
+ * @param[in] aw: 异步等待节点的指针
+ * @return 布尔值
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+bool xwos_aw_tst_busy(struct xwos_aw * aw)
+{
+        return xwosdl_aw_tst_busy(&aw->osaw);
+}
+
+#if ((defined(XWOSCFG_SYNC_PLSEM) && (1 == XWOSCFG_SYNC_PLSEM)) || \
+     (defined(XWOSCFG_SYNC_RTSEM) && (1 == XWOSCFG_SYNC_RTSEM)))
+/**
+ * @brief XWOS API：异步等待并获取信号量
+ * @param[in] sem: 信号量对象的指针
+ * @param[in] aw: 异步等待节点的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EALREADY: 节点已被注册，或回调函数还未开始执行
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 信号量的值大于0时，立即取走一个值，回调函数被直接推迟执行；
+ * + 信号量的值等于0时，节点加入信号量的等待队列，
+ *   信号量被发布时，取走一个值并执行回调函数。
+ */
+static __xwos_inline_api
+xwer_t xwos_sem_wait_async(struct xwos_sem * sem, struct xwos_aw * aw)
+{
+        return xwosdl_sem_wait_async(&sem->ossem, &aw->osaw);
+}
+#endif
+
+#if defined(XWOSCFG_SYNC_COND) && (1 == XWOSCFG_SYNC_COND)
+/**
+ * @brief XWOS API：异步等待条件量
+ * @param[in] cond: 条件量对象的指针
+ * @param[in] aw: 异步等待节点的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EALREADY: 节点已被注册，或回调函数还未开始执行
+ * @note
+ * + 上下文：任意
+ * @details
+ * 异步等待不持有锁，条件量被单播或广播时执行回调函数，
+ * 用户需要在回调函数中自行检查条件。
+ */
+static __xwos_inline_api
+xwer_t xwos_cond_wait_async(struct xwos_cond * cond, struct xwos_aw * aw)
+{
+        return xwosdl_cond_wait_async(&cond->oscond, &aw->osaw);
+}
+#endif
+
+#if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
+/**
+ * @brief XWOS API：异步等待事件标志
+ * @param[in] flg: 事件标志对象的指针
+ * @param[in] trigger: 事件触发条件，取值与 `xwos_flg_wait()` 相同
+ * @param[in] consumption: 事件触发后是否清除事件，含义与 `xwos_flg_wait()` 相同
+ * @param[in,out] origin: 指向缓冲区的指针：
+ * + 当 `trigger` 为 **电平触发** 时，
+ *   + (O) 返回事件触发 **之前** 的位图状态
+ * + 当 `trigger` 为 **边沿触发** 时，
+ *   + (I) 作为输入时，作为用于比较的初始值
+ *   + (O) 作为输出时，返回事件触发时的位图状态
+ * @param[in] msk: 事件标志对象的位图掩码
+ * @param[in] aw: 异步等待节点的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ETYPE: 事件对象类型错误
+ * @retval -EINVAL: 参数无效
+ * @retval -EALREADY: 节点已被注册，或回调函数还未开始执行
+ * @note
+ * + 上下文：任意
+ * @details
+ * + `origin` 与 `msk` 在回调函数开始执行之前必须一直有效。
+ * + 触发条件在每次修改事件标志时检测，满足条件时执行回调函数。
+ */
+static __xwos_inline_api
+xwer_t xwos_flg_wait_async(struct xwos_flg * flg, xwsq_t trigger, bool consumption,
+                           xwbmp_t origin[], xwbmp_t msk[],
+                           struct xwos_aw * aw)
+{
+        return xwosdl_flg_wait_async(&flg->osflg, trigger, consumption,
+                                     origin, msk, &aw->osaw);
+}
+
+/**
+ * @brief XWOS API：异步等待所有线程到达栅栏
+ * @param[in] br: 线程栅栏对象的指针
+ * @param[in] aw: 异步等待节点的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ETYPE: 事件对象类型错误
+ * @retval -ECHRNG: 线程栅栏已满
+ * @retval -EALREADY: 节点已被注册，或回调函数还未开始执行
+ * @note
+ * + 上下文：任意
+ * @details
+ * 异步等待节点与线程一样占用栅栏中的一个位置，
+ * 最后一个到达者到达时执行回调函数，位置被释放。
+ */
+static __xwos_inline_api
+xwer_t xwos_br_wait_async(struct xwos_br * br, struct xwos_aw * aw)
+{
+        return xwosdl_br_wait_async(&br->osbr, &aw->osaw);
+}
+#endif
+
+/**
+ * @} xwos_sync_aw
+ */
+
+#endif /* xwos/osal/sync/aw.h */
@@ -48,6 +48,11 @@
  * + `xwos_br_wait_unintr()` ：等待所有线程到达栅栏，且等待不可被中断，
  *   只能在 **线程** 上下文使用
  *
+ * XWOS MP内核中，配置 `XWOSCFG_SYNC_BR_TREE` 为 `1` 时，线程栅栏使用合并树实现：
+ * 到达者只修改一个原子计数器，并在所在CPU的子栅栏上等待，
+ * 最后一个到达者只直接唤醒本地CPU的等待者，其他CPU的等待者由各自CPU上的等待者依次唤醒。
+ * 此时线程栅栏不再限制同时等待的线程数量，不会返回 `-ECHRNG` 。
+ *
  *
  * ## 使用信号选择器选择线程栅栏
  *
@@ -385,7 +385,7 @@ xwer_t xwos_sel_select_to(struct xwos_sel * sel,
 static __xwos_inline_api
 xwer_t xwos_sel_tryselect(struct xwos_sel * sel, xwbmp_t msk[], xwbmp_t trg[])
 {
-        return xwosdl_sel_select(&sel->ossel, msk, trg);
+        return xwosdl_sel_tryselect(&sel->ossel, msk, trg);
 }
 
 /**
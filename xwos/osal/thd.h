@@ -46,6 +46,18 @@
  * 用户可以在程序运行时通过 `xwos_thd_create()` 动态创建线程。
  *
  *
+ * ## 线程池
+ *
+ * 当配置 `XWOSCFG_SKD_THD_POOL` 为 `1` 时，用户可以在编译期预先定义若干组线程对象与线程栈，
+ * 每组的线程栈大小相同，并通过 `xwos_thd_pool_init()` 注册为一个线程池：
+ *
+ * + `xwos_thd_pool_create()` ：从栈大小满足要求的最小线程池中获取线程对象与线程栈，
+ *   不会调用内存分配器，执行时间确定；
+ * + 线程退出且引用计数为0时，线程对象与线程栈被回收到线程池中，而不是释放；
+ * + 未指定 `attr->stack` 时，`xwos_thd_create()` 也会优先从线程池中获取，
+ *   线程池中没有合适的线程时，才从内存分配器中申请。
+ *
+ *
  * ## 中断线程的阻塞态和睡眠态
  *
  * 用户可以通过 `xwos_thd_intr()` 中断另一个线程的阻塞态和睡眠态。
@@ -143,6 +155,15 @@ struct xwos_thd {
  */
 typedef xwer_t (* xwos_thd_f)(void *);
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+/**
+ * @brief XWOS API：线程池
+ */
+struct xwos_thd_pool {
+        struct xwosdl_thd_pool ospool;
+};
+#endif
+
 /**
  * @brief XWOS API：线程对象描述符
  */
@@ -338,6 +359,81 @@ xwer_t xwos_thd_create(xwos_thd_d * thdd,
                                  (xwosdl_thd_f)thdfunc, arg);
 }
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+/**
+ * @brief XWOS API：初始化线程池
+ * @param[in] pool: 指向构造线程池对象内存的指针
+ * @param[in] name: 线程池的名字
+ * @param[in] thds: 线程对象数组，数组中元素的数量为 `num`
+ * @param[in] stacks: 线程栈数组，大小为 `stack_size * num`
+ * @param[in] stack_size: 每个线程栈的大小
+ * @param[in] num: 线程对象的数量
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ESIZE: 线程栈太小
+ * @retval -EALIGN: 线程栈没有对齐
+ * @note
+ * + 上下文：任意
+ * @details
+ * 线程池初始化后被注册到内核中，不可注销，通常定义为全局变量。
+ *
+ * 线程栈的首地址与大小必须满足CPU的ABI规则，定义数组时需要使用
+ * `__xwcc_aligned(XWMM_STACK_ALIGNMENT)` 或 `__xwcc_alignl1cache` 来修饰。
+ */
+static __xwos_inline_api
+xwer_t xwos_thd_pool_init(struct xwos_thd_pool * pool, const char * name,
+                          struct xwos_thd thds[], xwstk_t * stacks,
+                          xwsz_t stack_size, xwsz_t num)
+{
+        return xwosdl_thd_pool_init(&pool->ospool, name,
+                                    (struct xwosdl_thd *)thds, stacks,
+                                    stack_size, num);
+}
+
+/**
+ * @brief XWOS API：从线程池中获取线程并初始化
+ * @param[out] thdd: 指向缓冲区的指针，通过此缓冲区返回线程对象描述符
+ * @param[in] attr: 线程属性
+ * @param[in] thdfunc: 线程函数的指针
+ * @param[in] arg: 线程函数的参数
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENOMEM: 栈大小满足要求的最小线程池中已经没有空闲的线程
+ * @note
+ * + 上下文：任意
+ * @details
+ * + 参数 `attr` 可为 `NULL` ，表示采用默认属性创建线程；
+ * + `attr->stack` 会被忽略，线程栈总是来自于线程池；
+ * + 只从栈大小满足要求的最小线程池中获取，此线程池中没有空闲的线程时直接返回
+ *   `-ENOMEM` ，不会尝试更大的线程池，因此执行时间只与线程池的数量有关。
+ */
+static __xwos_inline_api
+xwer_t xwos_thd_pool_create(xwos_thd_d * thdd,
+                            const struct xwos_thd_attr * attr,
+                            xwos_thd_f thdfunc, void * arg)
+{
+        return xwosdl_thd_pool_create((xwosdl_thd_d *)thdd,
+                                      (const struct xwosdl_thd_attr *)attr,
+                                      // cppcheck-suppress [misra-c2012-11.1]
+                                      (xwosdl_thd_f)thdfunc, arg);
+}
+
+/**
+ * @brief XWOS API：获取线程池中空闲的线程数量
+ * @param[in] pool: 线程池对象的指针
+ * @return 空闲的线程数量
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+xwsz_t xwos_thd_pool_get_num_free(struct xwos_thd_pool * pool)
+{
+        return xwosdl_thd_pool_get_num_free(&pool->ospool);
+}
+#endif
+
 /**
  * @brief XWOS API：检查线程对象的标签并增加引用计数
  * @param[in] thdd: 线程对象描述符
@@ -0,0 +1,262 @@
+/**
+ * @file
+ * @brief 操作系统抽象层：工作队列
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_osal_workq_h__
+#define __xwos_osal_workq_h__
+
+#include <xwos/standard.h>
+#include <xwos/osal/jack/workq.h>
+
+/**
+ * @defgroup xwos_workq 工作队列
+ * @ingroup xwos
+ * 工作队列用于将耗时的处理从中断上下文推迟到线程上下文中执行。
+ * 工作队列在每个CPU上都有一个工作线程，驱动程序不需要为此单独创建线程。
+ * 只有XWOS MP内核支持工作队列，需要配置 `XWOSCFG_SKD_WORKQ` 为 `1` 。
+ *
+ *
+ * ## 工作队列
+ *
+ * + 系统工作队列：内核启动时自动创建，通过 `xwos_workq_get_sys()` 获取，
+ *   工作线程的优先级为 `XWOSCFG_SKD_WORKQ_PRIORITY` ；
+ * + 用户工作队列：通过 `xwos_workq_init()` 初始化，可以指定工作线程的优先级。
+ *
+ *
+ * ## 工作的入队与取消
+ *
+ * + `xwos_work_init()` ：初始化工作
+ * + `xwos_work_queue()` ：将工作加入本地CPU的队列
+ * + `xwos_work_queue_on()` ：将工作加入指定CPU的队列
+ * + `xwos_work_queue_delayed()` ：延迟一段时间后将工作加入指定CPU的队列
+ * + `xwos_work_cancel()` ：取消工作
+ *
+ * 入队与取消都是无锁的，可以在中断中调用。
+ * 某个CPU的工作线程空闲时，会从其他CPU的队列中窃取工作执行。
+ *
+ *
+ * ## 等待工作完成
+ *
+ * + `xwos_work_flush()` ：等待某个工作执行完成
+ * + `xwos_workq_flush()` ：等待工作队列中所有已经入队的工作执行完成
+ * + `xwos_work_tst_busy()` ：测试工作是否还未完成
+ *
+ *
+ * ## C++
+ *
+ * C++头文件： @ref xwos/cxx/Work.hxx
+ * @{
+ */
+
+/**
+ * @brief XWOS API：工作
+ */
+struct xwos_work {
+        struct xwosdl_work oswork;
+};
+
+/**
+ * @brief XWOS API：工作队列
+ */
+struct xwos_workq {
+        struct xwosdl_workq oswq;
+};
+
+/**
+ * @brief XWOS API：工作函数指针类型
+ */
+typedef void (* xwos_work_f)(struct xwos_work * /*work*/, void * /*arg*/);
+
+/**
+ * @brief XWOS API：获取系统工作队列
+ * @return 系统工作队列的指针
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+struct xwos_workq * xwos_workq_get_sys(void)
+{
+        return (struct xwos_workq *)xwosdl_workq_get_sys();
+}
+
+/**
+ * @brief XWOS API：初始化工作队列
+ * @param[in] wq: 指向构造工作队列对象内存的指针
+ * @param[in] name: 名字，也是工作线程的名字
+ * @param[in] prio: 工作线程的优先级
+ * @param[in] stacks: 工作线程栈数组，大小为 `stack_size * CPU数量`
+ * @param[in] stack_size: 每个工作线程栈的大小
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ESIZE: 线程栈太小
+ * @retval -EALIGN: 线程栈没有对齐
+ * @note
+ * + 上下文：线程
+ * @details
+ * 工作队列不可销毁，通常定义为全局变量。
+ */
+static __xwos_inline_api
+xwer_t xwos_workq_init(struct xwos_workq * wq, const char * name, xwpr_t prio,
+                       xwstk_t * stacks, xwsz_t stack_size)
+{
+        return xwosdl_workq_init(&wq->oswq, name, prio, stacks, stack_size);
+}
+
+/**
+ * @brief XWOS API：等待工作队列中所有已经入队的工作执行完成
+ * @param[in] wq: 工作队列的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINTR: 等待被中断
+ * @note
+ * + 上下文：线程
+ * + 不能在工作函数中调用，否则会死锁。
+ * @details
+ * 延迟工作只有在超时入队后才会被等待。
+ */
+static __xwos_inline_api
+xwer_t xwos_workq_flush(struct xwos_workq * wq)
+{
+        return xwosdl_workq_flush(&wq->oswq);
+}
+
+/**
+ * @brief XWOS API：初始化工作
+ * @param[in] work: 工作的指针
+ * @param[in] func: 工作函数
+ * @param[in] arg: 工作函数的参数
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+void xwos_work_init(struct xwos_work * work, xwos_work_f func, void * arg)
+{
+        // cppcheck-suppress [misra-c2012-11.1]
+        xwosdl_work_init(&work->oswork, (xwosdl_work_f)func, arg);
+}
+
+/**
+ * @brief XWOS API：将工作加入本地CPU的队列
+ * @param[in] wq: 工作队列的指针
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EALREADY: 工作已经在队列中或正在延迟
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+xwer_t xwos_work_queue(struct xwos_workq * wq, struct xwos_work * work)
+{
+        return xwosdl_work_queue(&wq->oswq, &work->oswork);
+}
+
+/**
+ * @brief XWOS API：将工作加入指定CPU的队列
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: CPU ID
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENODEV: CPU ID错误
+ * @retval -EALREADY: 工作已经在队列中或正在延迟
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+xwer_t xwos_work_queue_on(struct xwos_workq * wq, xwid_t cpuid,
+                          struct xwos_work * work)
+{
+        return xwosdl_work_queue_on(&wq->oswq, cpuid, &work->oswork);
+}
+
+/**
+ * @brief XWOS API：延迟一段时间后将工作加入指定CPU的队列
+ * @param[in] wq: 工作队列的指针
+ * @param[in] cpuid: CPU ID
+ * @param[in] work: 工作的指针
+ * @param[in] delay: 延迟的时间
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ENODEV: CPU ID错误
+ * @retval -EALREADY: 工作已经在队列中或正在延迟
+ * @note
+ * + 上下文：任意
+ * @details
+ * 延迟由本地CPU的时间树实现，不需要额外的软件定时器对象。
+ */
+static __xwos_inline_api
+xwer_t xwos_work_queue_delayed(struct xwos_workq * wq, xwid_t cpuid,
+                               struct xwos_work * work, xwtm_t delay)
+{
+        return xwosdl_work_queue_delayed(&wq->oswq, cpuid, &work->oswork, delay);
+}
+
+/**
+ * @brief XWOS API：取消工作
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -ESRCH: 工作不在队列中，也没有在延迟
+ * @note
+ * + 上下文：任意
+ * @details
+ * 此CAPI不会等待正在执行的工作函数返回，需要等待时，可再调用 `xwos_work_flush()` 。
+ */
+static __xwos_inline_api
+xwer_t xwos_work_cancel(struct xwos_work * work)
+{
+        return xwosdl_work_cancel(&work->oswork);
+}
+
+/**
+ * @brief XWOS API：等待工作执行完成
+ * @param[in] work: 工作的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EFAULT: 空指针
+ * @retval -EINTR: 等待被中断
+ * @note
+ * + 上下文：线程
+ * + 不能在工作函数中等待自身，否则会死锁。
+ */
+static __xwos_inline_api
+xwer_t xwos_work_flush(struct xwos_work * work)
+{
+        return xwosdl_work_flush(&work->oswork);
+}
+
+/**
+ * @brief XWOS API：测试工作是否还未完成
+ * @param[in] work: 工作的指针
+ * @return 布尔值
+ * @retval true: 工作在队列中、正在延迟或正在执行
+ * @retval false: 工作空闲
+ * @note
+ * + 上下文：任意
+ */
+static __xwos_inline_api
+bool xwos_work_tst_busy(struct xwos_work * work)
+{
+        return xwosdl_work_tst_busy(&work->oswork);
+}
+
+/**
+ * @} xwos_workq
+ */
+
+#endif /* xwos/osal/workq.h */
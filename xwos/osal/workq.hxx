@@ -0,0 +1,26 @@
+/**
+ * @file
+ * @brief C++操作系统抽象层：工作队列
+ * @author
+ * + 隐星魂 (Roy Sun) <xwos@xwos.tech>
+ * @copyright
+ * + Copyright © 2015 xwos.tech, All Rights Reserved.
+ * > This Source Code Form is subject to the terms of the Mozilla Public
+ * > License, v. 2.0. If a copy of the MPL was not distributed with this
+ * > file, You can obtain one at <http://mozilla.org/MPL/2.0/>.
+ */
+
+#ifndef __xwos_osal_workq_hxx__
+#define __xwos_osal_workq_hxx__
+#ifdef __cplusplus
+
+#if __cplusplus < 201103L
+#  error "Should use C++11 or later C++ standard!"
+#endif
+
+extern "C" {
+#include <xwos/osal/workq.h>
+}
+
+#endif /* __cplusplus */
+#endif /* xwos/osal/workq.hxx */
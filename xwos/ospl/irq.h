@@ -36,4 +36,17 @@ xwer_t xwospl_irq_disable(xwirq_t irqn);
 xwer_t xwospl_irq_save(xwirq_t irqn, xwreg_t * flag);
 xwer_t xwospl_irq_restore(xwirq_t irqn, xwreg_t flag);
 
+#if defined(XWCFG_CORE__mp)
+/**
+ * @brief XWOS移植层：向某个CPU发送核间中断
+ * @param[in] irqn: 核间中断的中断号
+ * @param[in] cpuid: 目的地CPU的ID
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -ERANGE: 中断号或CPU的ID超出范围
+ * @retval -ENOSYS: 没有实现此功能
+ */
+xwer_t xwospl_irq_ipi(xwirq_t irqn, xwid_t cpuid);
+#endif
+
 #endif /* xwos/ospl/irq.h */
@@ -45,6 +45,14 @@ xwer_t xwosdl_irq_get_id(xwirq_t * irqnbuf)
         return xwup_irq_get_id(irqnbuf);
 }
 
+static __xwcc_inline
+xwer_t xwosdl_irq_ipi(xwirq_t irqn, xwid_t cpuid)
+{
+        XWOS_UNUSED(irqn);
+        XWOS_UNUSED(cpuid);
+        return -ENOSYS;
+}
+
 static __xwcc_inline
 void xwosdl_cpuirq_enable_lc(void)
 {
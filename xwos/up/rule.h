@@ -27,6 +27,22 @@
 #  endif
 #endif
 
+#if defined(XWOSCFG_SKD_THD_POOL) && (1 == XWOSCFG_SKD_THD_POOL)
+#  error "XWOSCFG_SKD_THD_POOL is not supported by XWOS UP kernel!"
+#endif
+
+#if defined(XWOSCFG_SKD_WORKQ) && (1 == XWOSCFG_SKD_WORKQ)
+#  error "XWOSCFG_SKD_WORKQ is not supported by XWOS UP kernel!"
+#endif
+
+#if defined(XWOSCFG_SYNC_AW) && (1 == XWOSCFG_SYNC_AW)
+#  error "XWOSCFG_SYNC_AW is not supported by XWOS UP kernel!"
+#endif
+
+#if defined(XWOSCFG_SYNC_BR_TREE) && (1 == XWOSCFG_SYNC_BR_TREE)
+#  error "XWOSCFG_SYNC_BR_TREE is not supported by XWOS UP kernel!"
+#endif
+
 #if defined(XWOSCFG_SKD_THD_MEMPOOL) && (1 == XWOSCFG_SKD_THD_MEMPOOL)
 #  define XWOSRULE_SKD_THD_CREATE               1
 #elif defined(XWOSCFG_SKD_THD_MEMSLICE) && (1 == XWOSCFG_SKD_THD_MEMSLICE)
@@ -129,6 +129,12 @@ static __xwup_code
 xwer_t xwup_flg_wait_unintr_edge(struct xwup_evt * evt, xwsq_t trigger,
                                  xwbmp_t origin[], xwbmp_t msk[]);
 
+static __xwup_code
+bool xwup_evt_tst_notify(struct xwup_evt * evt);
+
+static __xwup_code
+xwer_t xwup_flg_unlock_and_notify(struct xwup_evt * evt, xwreg_t cpuirq);
+
 #if defined(XWOSCFG_SYNC_EVT_MEMPOOL) && (1 == XWOSCFG_SYNC_EVT_MEMPOOL)
 /**
  * @brief XWUP INIT CODE：初始化 `struct xwup_evt` 的对象缓存
@@ -536,6 +542,47 @@ xwer_t xwup_evt_get_num(struct xwup_evt * evt, xwsz_t * numbuf)
 }
 
 /******** type:XWUP_EVT_TYPE_FLG ********/
+/**
+ * @brief 测试修改位图后是否需要通知等待者
+ * @param[in] evt: 事件对象的指针
+ * @return 布尔值
+ * @retval true: 有线程正在等待，或事件对象绑定到信号选择器上
+ * @retval false: 不需要通知
+ * @note
+ * + 只能在持有锁 `evt->lock` 时调用。
+ */
+static __xwup_code
+bool xwup_evt_tst_notify(struct xwup_evt * evt)
+{
+        return ((!xwup_plwq_check_empty(&evt->cond.wq)) ||
+                (NULL != evt->cond.synobj.sel.evt));
+}
+
+/**
+ * @brief 修改事件标志后，解锁并在需要时通知等待者
+ * @param[in] evt: 事件对象的指针
+ * @param[in] cpuirq: 加锁前CPU中断的状态
+ * @return 错误码
+ * @details
+ * 线程检查触发条件与加入等待队列都在持有锁时完成，
+ * 因此等待队列为空并且没有绑定到信号选择器时，不需要广播条件量。
+ */
+static __xwup_code
+xwer_t xwup_flg_unlock_and_notify(struct xwup_evt * evt, xwreg_t cpuirq)
+{
+        bool notify;
+        xwer_t rc;
+
+        notify = xwup_evt_tst_notify(evt);
+        xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
+        if (notify) {
+                rc = xwup_cond_broadcast(&evt->cond);
+        } else {
+                rc = XWOK;
+        }
+        return rc;
+}
+
 __xwup_api
 xwer_t xwup_flg_s1m(struct xwup_evt * evt, xwbmp_t msk[])
 {
@@ -543,8 +590,7 @@ xwer_t xwup_flg_s1m(struct xwup_evt * evt, xwbmp_t msk[])
 
         xwup_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         xwbmpop_s1m(evt->bmp, msk, evt->num);
-        xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwup_cond_broadcast(&evt->cond);
+        return xwup_flg_unlock_and_notify(evt, cpuirq);
 }
 
 __xwup_api
@@ -559,8 +605,7 @@ xwer_t xwup_flg_s1i(struct xwup_evt * evt, xwsq_t pos)
         }
         xwup_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         xwbmpop_s1i(evt->bmp, pos);
-        xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwup_cond_broadcast(&evt->cond);
+        return xwup_flg_unlock_and_notify(evt, cpuirq);
 
 err_pos_range:
         return rc;
@@ -573,8 +618,7 @@ xwer_t xwup_flg_c0m(struct xwup_evt * evt, xwbmp_t msk[])
 
         xwup_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         xwbmpop_c0m(evt->bmp, msk, evt->num);
-        xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwup_cond_broadcast(&evt->cond);
+        return xwup_flg_unlock_and_notify(evt, cpuirq);
 }
 
 __xwup_api
@@ -589,8 +633,7 @@ xwer_t xwup_flg_c0i(struct xwup_evt * evt, xwsq_t pos)
         }
         xwup_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         xwbmpop_c0i(evt->bmp, pos);
-        xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwup_cond_broadcast(&evt->cond);
+        return xwup_flg_unlock_and_notify(evt, cpuirq);
 
 err_pos_range:
         return rc;
@@ -603,8 +646,7 @@ xwer_t xwup_flg_x1m(struct xwup_evt * evt, xwbmp_t msk[])
 
         xwup_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         xwbmpop_x1m(evt->bmp, msk, evt->num);
-        xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwup_cond_broadcast(&evt->cond);
+        return xwup_flg_unlock_and_notify(evt, cpuirq);
 }
 
 __xwup_api
@@ -619,8 +661,7 @@ xwer_t xwup_flg_x1i(struct xwup_evt * evt, xwsq_t pos)
         }
         xwup_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
         xwbmpop_x1i(evt->bmp, pos);
-        xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        return xwup_cond_broadcast(&evt->cond);
+        return xwup_flg_unlock_and_notify(evt, cpuirq);
 
 err_pos_range:
         return rc;
@@ -1349,6 +1390,7 @@ xwer_t xwup_sel_obj_s1i(struct xwup_evt * evt, struct xwup_synobj * synobj)
 {
         struct xwup_evt * owner;
         xwreg_t cpuirq;
+        bool notify;
         xwer_t rc;
 
         xwup_splk_lock_cpuirqsv(&evt->lock, &cpuirq);
@@ -1358,8 +1400,11 @@ xwer_t xwup_sel_obj_s1i(struct xwup_evt * evt, struct xwup_synobj * synobj)
                 goto err_notconn;
         }
         xwbmpop_s1i(evt->bmp, synobj->sel.pos);
+        notify = xwup_evt_tst_notify(evt);
         xwup_splk_unlock_cpuirqrs(&evt->lock, cpuirq);
-        xwup_cond_broadcast(&evt->cond); // cppcheck-suppress [misra-c2012-17.7]
+        if (notify) {
+                xwup_cond_broadcast(&evt->cond); // cppcheck-suppress [misra-c2012-17.7]
+        }
         return XWOK;
 
 err_notconn:
@@ -330,7 +330,7 @@ xwer_t xwup_plsem_activate(struct xwup_plsem * sem, xwssq_t val, xwssq_t max,
                 goto err_vsem_activate;
         }
         xwup_plwq_init(&sem->plwq);
-        sem->vsem.count = val;
+        xwaop_store(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed, val);
         sem->vsem.max = max;
         return XWOK;
 
@@ -443,11 +443,17 @@ xwer_t xwup_plsem_post(struct xwup_plsem * sem)
         struct xwup_wqn * wqn;
         xwup_wqn_f cb;
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwup_vsem_fast_post(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_posted;
+        }
+
         rc = XWOK;
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count < (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) < (xwssq_t)0) {
                 xwospl_cpuirq_restore_lc(cpuirq);
                 rc = -ENEGATIVE;
         } else {
@@ -462,13 +468,13 @@ xwer_t xwup_plsem_post(struct xwup_plsem * sem)
                         cb(wqn);
                 } else {
                         /* add plsem counter */
-                        if (sem->vsem.count < sem->vsem.max) {
-                                sem->vsem.count++;
-                        } else {
+                        rc = xwaop_tlt_then_add(xwssq_t, &sem->vsem.count,
+                                                sem->vsem.max, 1, &nv, NULL);
+                        if (rc < 0) {
                                 rc = -ERANGE;
                         }
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                        if (sem->vsem.count > (xwssq_t)0) {
+                        if (nv > (xwssq_t)0) {
                                 struct xwup_evt * evt;
 
                                 evt = sem->vsem.synobj.sel.evt;
@@ -481,6 +487,8 @@ xwer_t xwup_plsem_post(struct xwup_plsem * sem)
                         xwospl_cpuirq_restore_lc(cpuirq);
                 }
         }
+
+fast_posted:
         return rc;
 }
 
@@ -608,10 +616,16 @@ xwer_t xwup_plsem_acquire_or_block_to(struct xwup_plsem * sem,
                                       xwtm_t to)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwup_vsem_fast_trywait(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) <= (xwssq_t)0) {
 #if defined(XWOSCFG_SKD_PM) && (1 == XWOSCFG_SKD_PM)
                 rc = xwup_skd_wakelock_lock();
                 if (rc < 0) {
@@ -627,9 +641,9 @@ xwer_t xwup_plsem_acquire_or_block_to(struct xwup_plsem * sem,
                 }
 #endif
         } else {
-                sem->vsem.count--;
+                xwaop_sub(xwssq_t, &sem->vsem.count, 1, &nv, NULL);
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->vsem.count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwup_evt * evt;
 
                         evt = sem->vsem.synobj.sel.evt;
@@ -642,6 +656,8 @@ xwer_t xwup_plsem_acquire_or_block_to(struct xwup_plsem * sem,
                 xwospl_cpuirq_restore_lc(cpuirq);
                 rc = XWOK;
         }
+
+fast_acquired:
         return rc;
 }
 
@@ -764,15 +780,21 @@ static __xwup_code
 xwer_t xwup_plsem_acquire_or_block_unintr(struct xwup_plsem * sem, struct xwup_thd * thd)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwup_vsem_fast_trywait(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) <= (xwssq_t)0) {
                 rc = xwup_plsem_block_unintr(sem, thd, cpuirq);
         } else {
-                sem->vsem.count--;
+                xwaop_sub(xwssq_t, &sem->vsem.count, 1, &nv, NULL);
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->vsem.count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwup_evt * evt;
 
                         evt = sem->vsem.synobj.sel.evt;
@@ -785,6 +807,8 @@ xwer_t xwup_plsem_acquire_or_block_unintr(struct xwup_plsem * sem, struct xwup_t
                 xwospl_cpuirq_restore_lc(cpuirq);
                 rc = XWOK;
         }
+
+fast_acquired:
         return rc;
 }
 
@@ -814,15 +838,21 @@ xwer_t xwup_plsem_wait_unintr(struct xwup_plsem * sem)
 __xwup_api
 xwer_t xwup_plsem_trywait(struct xwup_plsem * sem)
 {
+        xwssq_t nv;
         xwer_t rc;
         xwreg_t cpuirq;
 
+        rc = xwup_vsem_fast_trywait(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         rc = XWOK;
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count > (xwssq_t)0) {
-                sem->vsem.count--;
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) > (xwssq_t)0) {
+                xwaop_sub(xwssq_t, &sem->vsem.count, 1, &nv, NULL);
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->vsem.count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwup_evt * evt;
 
                         evt = sem->vsem.synobj.sel.evt;
@@ -836,6 +866,8 @@ xwer_t xwup_plsem_trywait(struct xwup_plsem * sem)
                 rc = -ENODATA;
         }
         xwospl_cpuirq_restore_lc(cpuirq);
+
+fast_acquired:
         return rc;
 }
 
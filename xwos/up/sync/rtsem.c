@@ -331,7 +331,7 @@ xwer_t xwup_rtsem_activate(struct xwup_rtsem * sem,
                 goto err_vsem_activate;
         }
         xwup_rtwq_init(&sem->rtwq);
-        sem->vsem.count = val;
+        xwaop_store(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed, val);
         sem->vsem.max = max;
         return XWOK;
 
@@ -444,11 +444,17 @@ xwer_t xwup_rtsem_post(struct xwup_rtsem * sem)
         struct xwup_wqn * wqn;
         xwup_wqn_f cb;
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwup_vsem_fast_post(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_posted;
+        }
+
         rc = XWOK;
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count < (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) < (xwssq_t)0) {
                 xwospl_cpuirq_restore_lc(cpuirq);
                 rc = -ENEGATIVE;
         } else {
@@ -463,13 +469,13 @@ xwer_t xwup_rtsem_post(struct xwup_rtsem * sem)
                         cb(wqn);
                 } else {
                         /* add rtsem counter */
-                        if (sem->vsem.count < sem->vsem.max) {
-                                sem->vsem.count++;
-                        } else {
+                        rc = xwaop_tlt_then_add(xwssq_t, &sem->vsem.count,
+                                                sem->vsem.max, 1, &nv, NULL);
+                        if (rc < 0) {
                                 rc = -ERANGE;
                         }
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                        if (sem->vsem.count > (xwssq_t)0) {
+                        if (nv > (xwssq_t)0) {
                                 struct xwup_evt * evt;
 
                                 evt = sem->vsem.synobj.sel.evt;
@@ -482,6 +488,8 @@ xwer_t xwup_rtsem_post(struct xwup_rtsem * sem)
                         xwospl_cpuirq_restore_lc(cpuirq);
                 }
         }
+
+fast_posted:
         return rc;
 }
 
@@ -609,10 +617,16 @@ xwer_t xwup_rtsem_acquire_or_block_to(struct xwup_rtsem * sem,
                                       xwtm_t to)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwup_vsem_fast_trywait(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) <= (xwssq_t)0) {
 #if defined(XWOSCFG_SKD_PM) && (1 == XWOSCFG_SKD_PM)
                 rc = xwup_skd_wakelock_lock();
                 if (rc < 0) {
@@ -629,9 +643,9 @@ xwer_t xwup_rtsem_acquire_or_block_to(struct xwup_rtsem * sem,
                 }
 #endif
         } else {
-                sem->vsem.count--;
+                xwaop_sub(xwssq_t, &sem->vsem.count, 1, &nv, NULL);
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->vsem.count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwup_evt * evt;
 
                         evt = sem->vsem.synobj.sel.evt;
@@ -645,6 +659,7 @@ xwer_t xwup_rtsem_acquire_or_block_to(struct xwup_rtsem * sem,
                 rc = XWOK;
         }
 
+fast_acquired:
         return rc;
 }
 
@@ -768,15 +783,21 @@ xwer_t xwup_rtsem_acquire_or_block_unintr(struct xwup_rtsem * sem,
                                           struct xwup_thd * thd)
 {
         xwreg_t cpuirq;
+        xwssq_t nv;
         xwer_t rc;
 
+        rc = xwup_vsem_fast_trywait(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count <= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) <= (xwssq_t)0) {
                 rc = xwup_rtsem_block_unintr(sem, thd, cpuirq);
         } else {
-                sem->vsem.count--;
+                xwaop_sub(xwssq_t, &sem->vsem.count, 1, &nv, NULL);
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->vsem.count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwup_evt * evt;
 
                         evt = sem->vsem.synobj.sel.evt;
@@ -789,6 +810,8 @@ xwer_t xwup_rtsem_acquire_or_block_unintr(struct xwup_rtsem * sem,
                 xwospl_cpuirq_restore_lc(cpuirq);
                 rc = XWOK;
         }
+
+fast_acquired:
         return rc;
 }
 
@@ -818,15 +841,21 @@ xwer_t xwup_rtsem_wait_unintr(struct xwup_rtsem * sem)
 __xwup_api
 xwer_t xwup_rtsem_trywait(struct xwup_rtsem * sem)
 {
+        xwssq_t nv;
         xwer_t rc;
         xwreg_t cpuirq;
 
+        rc = xwup_vsem_fast_trywait(&sem->vsem);
+        if (XWOK == rc) {
+                goto fast_acquired;
+        }
+
         rc = XWOK;
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (sem->vsem.count > (xwssq_t)0) {
-                sem->vsem.count--;
+        if (xwaop_load(xwssq_t, &sem->vsem.count, xwaop_mo_relaxed) > (xwssq_t)0) {
+                xwaop_sub(xwssq_t, &sem->vsem.count, 1, &nv, NULL);
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
-                if ((xwssq_t)0 == sem->vsem.count) {
+                if ((xwssq_t)0 == nv) {
                         struct xwup_evt * evt;
 
                         evt = sem->vsem.synobj.sel.evt;
@@ -840,6 +869,8 @@ xwer_t xwup_rtsem_trywait(struct xwup_rtsem * sem)
                 rc = -ENODATA;
         }
         xwospl_cpuirq_restore_lc(cpuirq);
+
+fast_acquired:
         return rc;
 }
 
@@ -70,7 +70,8 @@ xwer_t xwup_vsem_bind(struct xwup_vsem * vsem, struct xwup_evt * sel, xwsq_t pos
 
         xwospl_cpuirq_save_lc(&cpuirq);
         rc = xwup_sel_obj_bind(sel, &vsem->synobj, pos, true);
-        if ((XWOK == rc) && (vsem->count > (xwssq_t)0)) {
+        if ((XWOK == rc) &&
+            (xwaop_load(xwssq_t, &vsem->count, xwaop_mo_relaxed) > (xwssq_t)0)) {
                 rc = xwup_sel_obj_s1i(sel, &vsem->synobj);
         }
         xwospl_cpuirq_restore_lc(cpuirq);
@@ -120,10 +121,10 @@ xwer_t xwup_vsem_freeze(struct xwup_vsem * vsem)
 
         rc = XWOK;
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (vsem->count < (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &vsem->count, xwaop_mo_relaxed) < (xwssq_t)0) {
                 rc = -EALREADY;
         } else {
-                vsem->count = XWUP_VSEM_NEGTIVE;
+                xwaop_store(xwssq_t, &vsem->count, xwaop_mo_relaxed, XWUP_VSEM_NEGTIVE);
 #if defined(XWOSCFG_SYNC_EVT) && (1 == XWOSCFG_SYNC_EVT)
                 struct xwup_evt * evt;
                 struct xwup_synobj * synobj;
@@ -149,10 +150,10 @@ xwer_t xwup_vsem_thaw(struct xwup_vsem * vsem)
 
         rc = XWOK;
         xwospl_cpuirq_save_lc(&cpuirq);
-        if (vsem->count >= (xwssq_t)0) {
+        if (xwaop_load(xwssq_t, &vsem->count, xwaop_mo_relaxed) >= (xwssq_t)0) {
                 rc = -EALREADY;
         } else {
-                vsem->count = 0;
+                xwaop_store(xwssq_t, &vsem->count, xwaop_mo_relaxed, (xwssq_t)0);
         }
         xwospl_cpuirq_restore_lc(cpuirq);
         return rc;
@@ -168,6 +169,6 @@ xwer_t xwup_vsem_get_max(struct xwup_vsem * vsem, xwssq_t * max)
 __xwup_code
 xwer_t xwup_vsem_get_value(struct xwup_vsem * vsem, xwssq_t * val)
 {
-        *val = vsem->count;
+        *val = xwaop_load(xwssq_t, &vsem->count, xwaop_mo_relaxed);
         return XWOK;
 }
@@ -14,6 +14,7 @@
 #define __xwos_up_sync_vsem_h__
 
 #include <xwos/standard.h>
+#include <xwos/lib/xwaop.h>
 #include <xwos/up/sync/obj.h>
 
 struct xwup_evt;
@@ -23,7 +24,7 @@ struct xwup_evt;
  */
 /* abstract */ struct xwup_vsem {
         struct xwup_synobj synobj; /**< C语言面向对象：继承 `struct xwup_synobj` */
-        xwssq_t count; /**< 信号量计数器：如果这个成员的值<0，信号量处于负状态。*/
+        atomic_xwssq_t count; /**< 信号量计数器：如果这个成员的值<0，信号量处于负状态。*/
         xwssq_t max; /**< 信号量计数器的最大值 */
 };
 
@@ -47,6 +48,40 @@ xwer_t xwup_vsem_thaw(struct xwup_vsem * sem);
 xwer_t xwup_vsem_get_max(struct xwup_vsem * sem, xwssq_t * max);
 xwer_t xwup_vsem_get_value(struct xwup_vsem * sem, xwssq_t * val);
 
+/**
+ * @brief 信号量的快速路径：不关闭中断增加计数器
+ * @param[in] vsem: 信号量对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EACCES: 需要进入慢速路径
+ * @details
+ * 计数器大于0时，等待队列一定为空，且绑定的事件对象的位已经被置1，
+ * 因此计数器在区间 `(0, max)` 内时，只需要一次原子操作就可以增加计数器。
+ * 计数器经过0的转换与冻结，只能在关闭中断的慢速路径中进行。
+ */
+static __xwup_inline
+xwer_t xwup_vsem_fast_post(struct xwup_vsem * vsem)
+{
+        return xwaop_tgtlt_then_add(xwssq_t, &vsem->count, 0, vsem->max, 1,
+                                    NULL, NULL);
+}
+
+/**
+ * @brief 信号量的快速路径：不关闭中断减少计数器
+ * @param[in] vsem: 信号量对象的指针
+ * @return 错误码
+ * @retval XWOK: 没有错误
+ * @retval -EACCES: 需要进入慢速路径
+ * @details
+ * 只有计数器大于1时才可以走快速路径，计数器从1变为0时需要清除事件对象的位，
+ * 必须进入慢速路径。
+ */
+static __xwup_inline
+xwer_t xwup_vsem_fast_trywait(struct xwup_vsem * vsem)
+{
+        return xwaop_tgt_then_sub(xwssq_t, &vsem->count, 1, 1, NULL, NULL);
+}
+
 /*
 __xwup_api
 xwer_t xwup_vsem_init(struct xwup_vsem * sem, xwssq_t val, xwssq_t max) = 0;
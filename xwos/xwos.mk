@@ -37,6 +37,10 @@ ifeq ($(XWMMCFG_MEMPOOL),y)
   XWOS_CSRCS += mm/mempool/allocator.c
 endif
 
+ifeq ($(XWMMCFG_ARENA),y)
+  XWOS_CSRCS += mm/arena.c
+endif
+
 ######## kernel ########
 XWOS_CSRCS += ospl/xwosplcb.c
 ifeq ($(XWCFG_CORE),mp)
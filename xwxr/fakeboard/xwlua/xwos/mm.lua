@@ -0,0 +1,42 @@
+--[[--------
+XWLUA模块：内存管理
+
+@module xwos.mm
+]]
+
+
+--[[--------
+获取Lua虚拟机内存池的统计信息
+
+
+
+@treturn table 统计信息<br>
++ total: 总的内存大小<br>
++ used: 已经分配出去的内存大小<br>
++ peak: 已经分配出去的内存大小的峰值<br>
++ largest: 可以一次申请到的最大的连续内存<br>
++ alloc: 申请成功的次数<br>
++ free: 释放的次数<br>
++ fail: 申请失败的次数<br>
++ contention: 锁竞争的次数<br>
++ oc: 数组，每个对象缓存的统计信息 { objsize, capacity, idleness }<br>
++ page: 数组，page[n + 1]表示第n阶空闲页的数量
+
+@usage
+st = xwos.mm.stat()
+print(st.used, st.peak)
+]]
+function stat()
+end
+
+
+--[[--------
+打印Lua虚拟机内存池的统计信息
+
+
+
+@usage
+xwos.mm.dump()
+]]
+function dump()
+end